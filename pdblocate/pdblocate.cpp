@@ -486,12 +486,8 @@ void SetBaseAddress(wstring req)
 		modules[module].pSession->put_loadAddress(addr);
 }
 
-AddrInfo GetAddr(wstring req)
+AddrInfo GetAddr(uint32_t module, uint64_t addr)
 {
-	uint32_t module;
-	uint64_t addr;
-	int charsRead = swscanf_s(req.c_str(), L"%d %llu", &module, &addr);
-
 	AddrInfo ret;
 	ZeroMemory(&ret, sizeof(ret));
 
@@ -650,15 +646,50 @@ wstring HandleRequest(wstring req)
 
 	if(type == L"getaddr")
 	{
+		uint32_t module;
+		uint64_t addr;
+		swscanf_s(payload.c_str(), L"%d %llu", &module, &addr);
+
 		wstring ret;
 		ret.resize(sizeof(AddrInfo)/sizeof(wchar_t));
 
-		AddrInfo info = GetAddr(payload);
+		AddrInfo info = GetAddr(module, addr);
 
 		memcpy(&ret[0], &info, sizeof(AddrInfo));
 
 		return ret;
 	}
+
+	// "getaddrs <module> <addr> <addr> ..." replies with one AddrInfo for each address,
+	// to save a round trip per address when resolving whole callstacks.
+	if(type == L"getaddrs")
+	{
+		const wchar_t *cur = payload.c_str();
+		wchar_t *end = NULL;
+
+		uint32_t module = (uint32_t)wcstoul(cur, &end, 10);
+		cur = end;
+
+		vector<AddrInfo> infos;
+
+		while(true)
+		{
+			uint64_t addr = _wcstoui64(cur, &end, 10);
+			if(end == cur)
+				break;
+			cur = end;
+
+			infos.push_back(GetAddr(module, addr));
+		}
+
+		wstring ret;
+		ret.resize(infos.size()*sizeof(AddrInfo)/sizeof(wchar_t));
+
+		if(!infos.empty())
+			memcpy(&ret[0], &infos[0], infos.size()*sizeof(AddrInfo));
+
+		return ret;
+	}
 	
 	return L".";
 }
@@ -706,16 +737,23 @@ int WINAPI wWinMain( __in HINSTANCE hInstance, __in_opt HINSTANCE hPrevInstance,
 
 	while(true)
 	{
-		DWORD read = 0;
-		BOOL success = ReadFile(pipe, buf, 1024, &read, NULL);
+		// batched requests can be bigger than one read, so keep reading the rest of the message
+		wstring request;
+		BOOL success = FALSE;
+		DWORD err = ERROR_SUCCESS;
 
-		if(!success || read == 0)
+		do
 		{
-			DWORD err = GetLastError();
+			DWORD read = 0;
+			success = ReadFile(pipe, buf, sizeof(buf), &read, NULL);
+			err = success ? ERROR_SUCCESS : GetLastError();
+
+			request.append(buf, buf+read/sizeof(wchar_t));
+		} while(!success && err == ERROR_MORE_DATA);
+
+		if(!success || request.empty())
 			break;
-		}
 
-		wstring request(buf, buf+read/sizeof(wchar_t));
 		if(request.back() != L'\0')
 			request.push_back(L'\0');
 
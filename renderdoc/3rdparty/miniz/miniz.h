@@ -13,6 +13,7 @@ typedef unsigned int mz_uint;
 typedef long long mz_int64;
 typedef unsigned long long mz_uint64;
 typedef int mz_bool;
+typedef unsigned long mz_ulong;
 
 typedef struct
 {
@@ -84,4 +85,10 @@ mz_bool mz_zip_writer_add_mem(mz_zip_archive *pZip, const char *pArchive_name, c
 mz_bool mz_zip_writer_finalize_archive(mz_zip_archive *pZip);
 mz_bool mz_zip_writer_end(mz_zip_archive *pZip);
 
+// zlib-style single call compression and decompression. Return 0 (MZ_OK) on success.
+// The only copy of these compiled in is the one embedded in tinyexr.cpp
+int mz_compress2(unsigned char *pDest, mz_ulong *pDest_len, const unsigned char *pSource, mz_ulong source_len, int level);
+mz_ulong mz_compressBound(mz_ulong source_len);
+int mz_uncompress(unsigned char *pDest, mz_ulong *pDest_len, const unsigned char *pSource, mz_ulong source_len);
+
 }; // extern "C"
\ No newline at end of file
@@ -71,7 +71,18 @@ struct CaptureOptions
 		  HookIntoChildren(false),
 		  RefAllResources(false),
 		  SaveAllInitials(false),
-		  CaptureAllCmdLists(false)
+		  CaptureAllCmdLists(false),
+		  CompressCaptures(false),
+		  SpillChunksToDisk(false),
+		  SpillHighWaterMark(64),
+		  AsyncCaptureWrites(false),
+		  DeltaInitialContents(false),
+		  TrackPersistentMapWrites(false),
+		  CmdListMemoryLimit(0),
+		  FilterRedundantState(false),
+		  CallstackSampleRate(0),
+		  RetroCapture(false),
+		  FramePointerCallstacks(false)
 	{}
 
 	// Whether or not to allow the application to enable vsync
@@ -130,6 +141,97 @@ struct CaptureOptions
 	// Disabled - Command lists are only captured if their recording begins during
 	//            the period when a frame capture is in progress.
 	bool32 CaptureAllCmdLists;
+
+	// Compresses the chunk stream in the logfile on disk. The data is compressed in
+	// independent blocks so that reading the log back only decompresses what's needed.
+	//
+	// Enabled - logfiles are smaller on disk, at the cost of some CPU time when
+	//           writing and reading them.
+	// Disabled - logfiles are written uncompressed.
+	bool32 CompressCaptures;
+
+	// Writes the frame's chunks out to a temporary file in the background while the
+	// frame is being captured, instead of holding them all in memory until the end
+	// of the frame. Useful when capturing applications close to their address space
+	// limit.
+	//
+	// Enabled - chunks are spilled to disk during the frame
+	// Disabled - chunks are kept in memory until the capture is written
+	bool32 SpillChunksToDisk;
+
+	// When spilling chunks to disk, the most memory in megabytes that chunks waiting
+	// to be written may occupy before the application is stalled to let the writer
+	// catch up.
+	uint32_t SpillHighWaterMark;
+
+	// Writes captures to disk on a background thread once the frame's data has been
+	// gathered, so the application isn't stalled while a large logfile is written.
+	//
+	// Enabled - the application resumes as soon as the capture is handed off, at the
+	//           cost of holding a copy of its chunks in memory until it's written
+	// Disabled - the capture is written out before the application continues
+	bool32 AsyncCaptureWrites;
+
+	// Stores texture initial contents that are unchanged since the previous capture
+	// from this application as references into that capture's logfile, so that
+	// capturing many similar frames doesn't write the same data again and again.
+	//
+	// Enabled - logfiles only contain the parts of textures that changed, but can
+	//           only be opened while the earlier logfiles they refer to are still
+	//           in the same place, or next to them. Otherwise they fail to open.
+	// Disabled - every logfile is self-contained
+	bool32 DeltaInitialContents;
+
+	// Watches for writes to persistently mapped buffers, and to the shadow copies handed
+	// out for D3D11 maps, with the OS's memory protection. Then at each point changes must
+	// be picked up only the pages that were written are compared, instead of the whole buffer.
+	//
+	// Enabled - large buffers with small writes are much cheaper to capture, but on some
+	//           platforms the first write to each page after a sync point is slower.
+	//           On linux the pages are write-protected and writes are caught with a
+	//           SIGSEGV handler. System calls that write into a mapped pointer, such as
+	//           read() directly into a buffer, fail with EFAULT. An application that
+	//           installs its own SIGSEGV handler without chaining to the previous one
+	//           will crash on the first write it sees.
+	// Disabled - every mapped buffer is compared in full at each sync point or Unmap()
+	bool32 TrackPersistentMapWrites;
+
+	// When capturing all command lists, the most memory in megabytes that command lists
+	// recorded outside of a frame capture may hold on to. Past this the command lists that
+	// were least recently executed are discarded, and a captured frame that executes one
+	// of them fails as if it had never been captured. 0 means no limit.
+	uint32_t CmdListMemoryLimit;
+
+	// Drops state-setting calls that wouldn't change the current pipeline state from the
+	// captured frame, such as an engine re-binding the same shaders and resources before
+	// every draw. Replay results are the same, but those calls won't appear in the event
+	// list. Only applies to contexts that execute immediately, not command lists.
+	//
+	// Enabled - redundant state sets are left out of the capture
+	// Disabled - every call is captured as it was made
+	bool32 FilterRedundantState;
+
+	// When capturing callstacks, only collect one for every N API events that would
+	// otherwise have one (after any filter set with RENDERDOC_SetCallstackFilter).
+	// 0 or 1 collects a callstack for every event.
+	// Ignored if CaptureCallstacks is disabled
+	uint32_t CallstackSampleRate;
+
+	// Records every frame as if it were being captured, keeping only the most recent one,
+	// so that RENDERDOC_SavePreviousFrame (or the capture key) can save a frame that has
+	// already happened. Currently only supported on D3D11.
+	//
+	// Enabled - the frame that was just presented can be saved after the fact, at the
+	//           cost of capture overhead on every frame
+	// Disabled - only frames that start after a capture is triggered can be captured
+	bool32 RetroCapture;
+
+	// When capturing callstacks on Linux, walk the chain of frame pointers instead of
+	// going through the unwinder, which is much cheaper and doesn't take any locks. Only
+	// useful if the application is built with frame pointers. Falls back to the unwinder
+	// whenever the chain leaves the thread's stack or doesn't lead towards its base.
+	// Ignored if CaptureCallstacks is disabled
+	bool32 FramePointerCallstacks;
 	
 #ifdef __cplusplus
 	void FromString(std::string str)
@@ -146,7 +248,18 @@ struct CaptureOptions
 				>> HookIntoChildren
 				>> RefAllResources
 				>> SaveAllInitials
-				>> CaptureAllCmdLists;
+				>> CaptureAllCmdLists
+				>> CompressCaptures
+				>> SpillChunksToDisk
+				>> SpillHighWaterMark
+				>> AsyncCaptureWrites
+				>> DeltaInitialContents
+				>> TrackPersistentMapWrites
+				>> CmdListMemoryLimit
+				>> FilterRedundantState
+				>> CallstackSampleRate
+				>> RetroCapture
+				>> FramePointerCallstacks;
 	}
 
 	std::string ToString() const
@@ -163,7 +276,18 @@ struct CaptureOptions
 				<< HookIntoChildren << " "
 				<< RefAllResources << " "
 				<< SaveAllInitials << " "
-				<< CaptureAllCmdLists << " ";
+				<< CaptureAllCmdLists << " "
+				<< CompressCaptures << " "
+				<< SpillChunksToDisk << " "
+				<< SpillHighWaterMark << " "
+				<< AsyncCaptureWrites << " "
+				<< DeltaInitialContents << " "
+				<< TrackPersistentMapWrites << " "
+				<< CmdListMemoryLimit << " "
+				<< FilterRedundantState << " "
+				<< CallstackSampleRate << " "
+				<< RetroCapture << " "
+				<< FramePointerCallstacks << " ";
 
 		return oss.str();
 	}
@@ -224,6 +348,104 @@ enum InAppOverlay
 	eOverlay_None = 0,
 };
 
+// Memory held by renderdoc while capturing, on behalf of one resource
+struct ResourceMemoryUsage
+{
+	// the resource's ID, as seen in captures of it
+	uint64_t ResourceID;
+
+	// the chunks recorded for the resource (creation, updates etc) that would be
+	// written into a capture that references it
+	uint32_t NumChunks;
+	uint64_t ChunkBytes;
+
+	// CPU-side copies kept of the resource's contents while it's mapped
+	uint64_t ShadowBytes;
+
+	// the resource's saved initial contents for the frame being captured. This can
+	// be an estimate where the contents are held in a GPU-side copy.
+	uint64_t InitialContentsBytes;
+};
+
+// Memory held in chunks of one type across all resources and contexts
+struct ChunkMemoryUsage
+{
+	uint32_t ChunkType;
+	uint32_t NumChunks;
+	uint64_t Bytes;
+};
+
+// CPU time renderdoc spent on its own work for one entry point, on top of the real API call,
+// summed over all threads. Entry points are identified by the chunk type they serialise.
+struct CaptureOverhead
+{
+	// ~0U for work done outside of serialising any chunk
+	uint32_t ChunkType;
+	uint64_t Calls;
+
+	// in milliseconds. These don't overlap, e.g. a record lookup during serialisation only
+	// counts towards RecordLookupTime
+	double SerialiseTime;
+	double RecordLookupTime;
+	double LockTime;
+	double ShadowDiffTime;
+	double CallstackTime;
+};
+
+// Lightweight statistics from the running application, gathered every frame whether or
+// not anything is being captured. Counts are summed over NumFrames frames.
+struct FrameStatistics
+{
+	uint32_t NumFrames;
+	uint32_t LastFrameNumber;
+
+	// in milliseconds, from one present to the next
+	double TotalFrameTime;
+	double MaxFrameTime;
+
+	// every API entry point that went through renderdoc, 0 if the API doesn't count them
+	uint64_t APICalls;
+	uint64_t Draws;
+	uint64_t Dispatches;
+	uint64_t Maps;
+	// only counts buffer maps, as texture maps don't have a cheaply known size
+	uint64_t BytesMapped;
+
+	// renderdoc's own overhead, the memory currently held in recorded chunks. Not summed
+	uint64_t CaptureChunkBytes;
+};
+
+// Conditions that trigger a capture without any input. They're checked every frame while
+// nothing is being captured, and the trigger stays armed afterwards so that rare problems
+// can be caught in long sessions. As the frame that met a condition has already been
+// presented when it's noticed, the frames following it are captured.
+struct CaptureTrigger
+{
+	// capture when a frame takes longer than this many milliseconds. 0 to ignore
+	float FrameTimeMS;
+
+	// capture when a frame has more than this many times the recent average number of draws
+	// and dispatches. 0 to ignore
+	float DrawCountSpike;
+
+	// capture when a debug marker containing this substring is pushed or set. NULL or
+	// empty to ignore. The string is copied.
+	const char *MarkerName;
+
+	// capture when this shader is bound - for D3D11 the ID3D11*Shader pointer, for OpenGL
+	// the program name passed to glUseProgram or glUseProgramStages. 0 to ignore
+	uint64_t Shader;
+
+	// how many consecutive frames to capture, into one log, each time the trigger fires
+	uint32_t NumFrames;
+
+	// frames to wait after firing before the trigger can fire again
+	uint32_t CooldownFrames;
+
+	// how many times the trigger can fire before it's disarmed. 0 for no limit
+	uint32_t MaxCaptures;
+};
+
 // API breaking change history:
 // Version 1 -> 2 - strings changed from wchar_t* to char* (UTF-8)
 // Version 2 -> 3 - StartFrameCapture, EndFrameCapture and SetActiveWindow take
@@ -231,7 +453,12 @@ enum InAppOverlay
 //                  This is either ID3D11Device* or the GL context (HGLRC/GLXContext)
 //                  You can still pass NULL to both to capture the default, as long as
 //                  there's only one device/window pair alive.
-#define RENDERDOC_API_VERSION 3
+// Version 3 -> 4 - CaptureOptions gained fields from CompressCaptures onwards, so it's larger
+//                  and RENDERDOC_SetCaptureOptions must be passed the new struct. Added
+//                  SetCallstackFilter, TriggerMultiFrameCapture, SavePreviousFrame,
+//                  SetCaptureTrigger, CaptureMarkerRegion, GetResourceMemoryUsage,
+//                  GetChunkMemoryUsage and GetCaptureOverhead.
+#define RENDERDOC_API_VERSION 4
 
 //////////////////////////////////////////////////////////////////////////
 // In-program functions
@@ -255,12 +482,39 @@ typedef bool32 (RENDERDOC_CC *pRENDERDOC_GetCapture)(uint32_t idx, char *logfile
 extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_SetCaptureOptions(const CaptureOptions *opts);
 typedef void (RENDERDOC_CC *pRENDERDOC_SetCaptureOptions)(const CaptureOptions *opts);
 
+// Restricts callstack capture to API events whose name contains one of the comma-separated
+// substrings in filter, e.g. "Draw,Dispatch". NULL or an empty string collects them for
+// every event again.
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_SetCallstackFilter(const char *filter);
+typedef void (RENDERDOC_CC *pRENDERDOC_SetCallstackFilter)(const char *filter);
+
 extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_SetActiveWindow(void *device, void *wndHandle);
 typedef void (RENDERDOC_CC *pRENDERDOC_SetActiveWindow)(void *device, void *wndHandle);
 
 extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_TriggerCapture();
 typedef void (RENDERDOC_CC *pRENDERDOC_TriggerCapture)();
 
+// Captures the next numFrames frames into a single log. The initial contents are only saved
+// once, before the first frame, and the frames are replayed one after another in the same log.
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_TriggerMultiFrameCapture(uint32_t numFrames);
+typedef void (RENDERDOC_CC *pRENDERDOC_TriggerMultiFrameCapture)(uint32_t numFrames);
+
+// With the RetroCapture option enabled, saves the current frame once it's presented. Since
+// it's been recorded from its start, this includes everything before the call too.
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_SavePreviousFrame();
+typedef void (RENDERDOC_CC *pRENDERDOC_SavePreviousFrame)();
+
+// Arms the capture trigger with the given conditions, or disarms it if trigger is NULL.
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_SetCaptureTrigger(const CaptureTrigger *trigger);
+typedef void (RENDERDOC_CC *pRENDERDOC_SetCaptureTrigger)(const CaptureTrigger *trigger);
+
+// Captures part of a frame instead of a whole one. The next time a debug marker region whose
+// name contains marker is pushed, capturing starts just before it and ends when the matching
+// pop is reached, so only that region is replayed and only the resources it references get
+// initial contents. Fires once. The string is copied, and NULL or empty cancels it.
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_CaptureMarkerRegion(const char *marker);
+typedef void (RENDERDOC_CC *pRENDERDOC_CaptureMarkerRegion)(const char *marker);
+
 extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_StartFrameCapture(void *device, void *wndHandle);
 typedef void (RENDERDOC_CC *pRENDERDOC_StartFrameCapture)(void *device, void *wndHandle);
 
@@ -282,5 +536,20 @@ typedef void (RENDERDOC_CC *pRENDERDOC_SetCaptureKeys)(KeyButton *keys, int num)
 extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_InitRemoteAccess(uint32_t *ident);
 typedef void (RENDERDOC_CC *pRENDERDOC_InitRemoteAccess)(uint32_t *ident);
 
+// Fills out up to 'count' entries in 'usage' with the memory held for each resource,
+// and returns the total number of resources available. Pass NULL/0 to query the count.
+extern "C" RENDERDOC_API uint32_t RENDERDOC_CC RENDERDOC_GetResourceMemoryUsage(ResourceMemoryUsage *usage, uint32_t count);
+typedef uint32_t (RENDERDOC_CC *pRENDERDOC_GetResourceMemoryUsage)(ResourceMemoryUsage *usage, uint32_t count);
+
+// As above, but with the memory held in chunks for each chunk type in use.
+extern "C" RENDERDOC_API uint32_t RENDERDOC_CC RENDERDOC_GetChunkMemoryUsage(ChunkMemoryUsage *usage, uint32_t count);
+typedef uint32_t (RENDERDOC_CC *pRENDERDOC_GetChunkMemoryUsage)(ChunkMemoryUsage *usage, uint32_t count);
+
+// Fills out up to 'count' entries of CPU overhead for each entry point called so far, and
+// returns how many there are. Nothing is tracked until this is first called, so call it once
+// at startup to begin tracking.
+extern "C" RENDERDOC_API uint32_t RENDERDOC_CC RENDERDOC_GetCaptureOverhead(CaptureOverhead *overhead, uint32_t count);
+typedef uint32_t (RENDERDOC_CC *pRENDERDOC_GetCaptureOverhead)(CaptureOverhead *overhead, uint32_t count);
+
 extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_UnloadCrashHandler();
 typedef void (RENDERDOC_CC *pRENDERDOC_UnloadCrashHandler)();
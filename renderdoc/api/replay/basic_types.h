@@ -31,6 +31,36 @@
 #include <vector>
 #include <string>
 
+#ifdef WIN32
+
+#ifdef RENDERDOC_EXPORTS
+#define RENDERDOC_API __declspec(dllexport)
+#else
+#define RENDERDOC_API __declspec(dllimport)
+#endif
+#define RENDERDOC_CC __cdecl
+
+#elif defined(__linux__)
+
+#ifdef RENDERDOC_EXPORTS
+#define RENDERDOC_API __attribute__ ((visibility ("default")))
+#else
+#define RENDERDOC_API
+#endif
+
+#define RENDERDOC_CC
+
+#else
+
+#error "Unknown platform"
+
+#endif
+
+// all array memory is allocated and freed inside the replay library, so that results can be
+// given out of a result arena instead of the heap (see RENDERDOC_CreateResultArena)
+extern "C" RENDERDOC_API void* RENDERDOC_CC RENDERDOC_AllocArrayMem(uint64_t sz);
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_FreeArrayMem(const void *mem);
+
 // we provide a basic templated type that is a fixed array that just contains a pointer to the element
 // array and a size. This could easily map to C as just void* and size but in C++ at least we can be
 // type safe.
@@ -62,8 +92,8 @@ struct array
 		elems = 0; count = 0;
 	}
 
-	static void deallocate(const void *p) { free((void *)p); }
-	static void *allocate(size_t s) { return malloc(s); }
+	static void deallocate(const void *p) { RENDERDOC_FreeArrayMem(p); }
+	static void *allocate(size_t s) { return RENDERDOC_AllocArrayMem((uint64_t)s); }
 
 	T &operator [](size_t i) { return elems[i]; }
 	const T &operator [](size_t i) const { return elems[i]; }
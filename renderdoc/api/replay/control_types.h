@@ -185,6 +185,20 @@ struct TextureSave
 	int jpegQuality;
 };
 
+// one texture to save as part of a batch with SaveTextures
+struct TextureSaveJob
+{
+	// the event to save the texture at
+	uint32_t frameID;
+	uint32_t eventID;
+
+	TextureSave save;
+	const char *path;
+
+	// filled out with whether or not this job's file was written
+	bool32 success;
+};
+
 struct RemoteMessage
 {
 	RemoteMessage() {}
@@ -214,4 +228,62 @@ struct RemoteMessage
 		uint32_t PID;
 		uint32_t ident;
 	} NewChild;
+
+	struct MemoryUsageData
+	{
+		struct ResourceUsage
+		{
+			ResourceId ID;
+			uint32_t NumChunks;
+			uint64_t ChunkBytes;
+			uint64_t ShadowBytes;
+			uint64_t InitialContentsBytes;
+		};
+		rdctype::array<ResourceUsage> Resources;
+
+		struct ChunkUsage
+		{
+			uint32_t ChunkType;
+			uint32_t NumChunks;
+			uint64_t Bytes;
+		};
+		rdctype::array<ChunkUsage> Chunks;
+	} MemoryUsage;
+
+	struct CopyProgressData
+	{
+		uint32_t ID;
+		float progress;
+	} CopyProgress;
+
+	// see FrameStatistics
+	struct FrameStatsData
+	{
+		uint32_t NumFrames;
+		uint32_t LastFrameNumber;
+		double TotalFrameTime;
+		double MaxFrameTime;
+		uint64_t APICalls;
+		uint64_t Draws;
+		uint64_t Dispatches;
+		uint64_t Maps;
+		uint64_t BytesMapped;
+		uint64_t CaptureChunkBytes;
+	} FrameStats;
+
+	// see CaptureOverhead
+	struct CaptureOverheadData
+	{
+		struct EntryPoint
+		{
+			uint32_t ChunkType;
+			uint64_t Calls;
+			double SerialiseTime;
+			double RecordLookupTime;
+			double LockTime;
+			double ShadowDiffTime;
+			double CallstackTime;
+		};
+		rdctype::array<EntryPoint> EntryPoints;
+	} CaptureOverhead;
 };
@@ -89,6 +89,15 @@ struct FetchBuffer
 	uint64_t byteSize;
 };
 
+// one element in each row of a structured buffer, at byteOffset from the start of the row,
+// for decoding buffer contents into typed values on the replay side
+struct BufferElement
+{
+	rdctype::str name;
+	uint32_t byteOffset;
+	ResourceFormat format;
+};
+
 struct FetchTexture
 {
 	rdctype::str name;
@@ -221,6 +230,31 @@ struct FetchDrawcall
 	rdctype::array<FetchDrawcall> children;
 };
 
+// a page of a frame's drawcalls stored flat, one entry per drawcall in each array. Rows are
+// numbered in tree order (each drawcall comes directly before its children), and drawcalls
+// refer to each other by row, with -1 meaning none. This lets the tree be walked a page at a
+// time without copying the whole nested FetchDrawcall list.
+struct FetchDrawcallTable
+{
+	FetchDrawcallTable() : firstRow(0) {}
+
+	// row of the first entry in the arrays below
+	uint32_t firstRow;
+
+	rdctype::array<uint32_t> eventID;
+	rdctype::array<uint32_t> drawcallID;
+	rdctype::array<uint32_t> flags;
+
+	rdctype::array<int32_t> parent;
+	rdctype::array<int32_t> firstChild;
+	rdctype::array<int32_t> nextSibling;
+
+	// offset of each drawcall's NUL-terminated name in names. Drawcalls with the same name
+	// share an offset
+	rdctype::array<uint32_t> nameOffset;
+	rdctype::array<char> names;
+};
+
 struct APIProperties
 {
 	APIPipelineStateType pipelineType;
@@ -239,11 +273,11 @@ struct CounterDescription
 
 struct CounterResult
 {
-	CounterResult()                            : eventID(0)  , u64(   0) {}
-	CounterResult(uint32_t EID, uint32_t c, float    data) : eventID(EID), counterID(c), f  (data) {}
-	CounterResult(uint32_t EID, uint32_t c, double   data) : eventID(EID), counterID(c), d  (data) {}
-	CounterResult(uint32_t EID, uint32_t c, uint32_t data) : eventID(EID), counterID(c), u32(data) {}
-	CounterResult(uint32_t EID, uint32_t c, uint64_t data) : eventID(EID), counterID(c), u64(data) {}
+	CounterResult()                            : eventID(0)  , u64(   0) { ClearStats(); }
+	CounterResult(uint32_t EID, uint32_t c, float    data) : eventID(EID), counterID(c), f  (data) { ClearStats(); }
+	CounterResult(uint32_t EID, uint32_t c, double   data) : eventID(EID), counterID(c), d  (data) { ClearStats(); }
+	CounterResult(uint32_t EID, uint32_t c, uint32_t data) : eventID(EID), counterID(c), u32(data) { ClearStats(); }
+	CounterResult(uint32_t EID, uint32_t c, uint64_t data) : eventID(EID), counterID(c), u64(data) { ClearStats(); }
 
 	uint32_t eventID;
 	uint32_t counterID;
@@ -254,6 +288,18 @@ struct CounterResult
 		uint32_t u32;
 		uint64_t u64;
 	};
+
+	// only filled out when the counters were fetched over several runs, otherwise numRuns
+	// is 0. The value above then comes from the median run. The rest are across all runs,
+	// converted to double, except mean and stddev which leave out runs rejected as outliers.
+	uint32_t numRuns;
+	uint32_t numOutliers;
+	double minimum;
+	double median;
+	double mean;
+	double stddev;
+
+	void ClearStats() { numRuns = numOutliers = 0; minimum = median = mean = stddev = 0.0; }
 };
 
 struct PixelValue
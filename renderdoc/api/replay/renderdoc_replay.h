@@ -32,31 +32,6 @@ typedef uint32_t bool32;
 
 #include "basic_types.h"
 
-#ifdef WIN32
-
-#ifdef RENDERDOC_EXPORTS
-#define RENDERDOC_API __declspec(dllexport)
-#else
-#define RENDERDOC_API __declspec(dllimport)
-#endif
-#define RENDERDOC_CC __cdecl
-
-#elif defined(__linux__)
-
-#ifdef RENDERDOC_EXPORTS
-#define RENDERDOC_API __attribute__ ((visibility ("default")))
-#else
-#define RENDERDOC_API
-#endif
-
-#define RENDERDOC_CC
-
-#else
-
-#error "Unknown platform"
-
-#endif
-
 // We give every resource a globally unique ID so that we can differentiate
 // between two textures allocated in the same memory (after the first is freed)
 //
@@ -109,6 +84,8 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_ClearThumbnails(Replay
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_AddThumbnail(ReplayOutput *output, void *wnd, ResourceId texID);
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_Display(ReplayOutput *output);
+// true if some visible thumbnails weren't redrawn in the last Display() and need another one
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_HasPendingThumbnails(ReplayOutput *output);
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_SetPixelContext(ReplayOutput *output, void *wnd);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_SetPixelContextLocation(ReplayOutput *output, uint32_t x, uint32_t y);
@@ -134,9 +111,23 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_InitResolver(ReplayR
  
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SetContextFilter(ReplayRenderer *rend, ResourceId id, uint32_t firstDefEv, uint32_t lastDefEv);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SetFrameEvent(ReplayRenderer *rend, uint32_t frameID, uint32_t eventID);
+// for dragging through the event list - see ReplayRenderer::SetScrubbing. Other queries made
+// while scrubbing may see the device replayed to a previewed event.
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SetScrubbing(ReplayRenderer *rend, bool32 scrubbing);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetD3D11PipelineState(ReplayRenderer *rend, D3D11PipelineState *state);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetGLPipelineState(ReplayRenderer *rend, GLPipelineState *state);
 
+// fetches results for many events at once in a single pass forward through the frame, for
+// tools that would otherwise call SetFrameEvent and then fetch results for each event.
+// d3d11/gl receive the pipeline state at each event (as from SetFrameEvent), and textureData
+// receives the contents of each texture after each event, numTextures entries per event in
+// the order the events were given. Any of the outputs can be NULL to skip fetching them.
+// The current event is left unchanged.
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FetchEventBatch(ReplayRenderer *rend, uint32_t frameID, uint32_t *eventIDs, uint32_t numEvents,
+                                                                            ResourceId *textures, uint32_t numTextures, uint32_t arrayIdx, uint32_t mip,
+                                                                            rdctype::array<D3D11PipelineState> *d3d11, rdctype::array<GLPipelineState> *gl,
+                                                                            rdctype::array< rdctype::array<byte> > *textureData);
+
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_BuildCustomShader(ReplayRenderer *rend, const char *entry, const char *source, const uint32_t compileFlags, ShaderStageType type, ResourceId *shaderID, rdctype::str *errors);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FreeCustomShader(ReplayRenderer *rend, ResourceId id);
 
@@ -147,16 +138,23 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FreeTargetResource(R
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetFrameInfo(ReplayRenderer *rend, rdctype::array<FetchFrameInfo> *frame);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDrawcalls(ReplayRenderer *rend, uint32_t frameID, rdctype::array<FetchDrawcall> *draws);
-extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FetchCounters(ReplayRenderer *rend, uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, uint32_t *counters, uint32_t numCounters, rdctype::array<CounterResult> *results);
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDrawcallCount(ReplayRenderer *rend, uint32_t frameID, uint32_t *count);
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDrawcallTable(ReplayRenderer *rend, uint32_t frameID, uint32_t firstRow, uint32_t numRows, FetchDrawcallTable *table);
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FindDrawcallRow(ReplayRenderer *rend, uint32_t frameID, uint32_t eventID, int32_t *row);
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDrawcall(ReplayRenderer *rend, uint32_t frameID, uint32_t row, FetchDrawcall *draw);
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FetchCounters(ReplayRenderer *rend, uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, uint32_t *counters, uint32_t numCounters, uint32_t numRuns, rdctype::array<CounterResult> *results);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_EnumerateCounters(ReplayRenderer *rend, rdctype::array<uint32_t> *counters);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_DescribeCounter(ReplayRenderer *rend, uint32_t counterID, CounterDescription *desc);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetTextures(ReplayRenderer *rend, rdctype::array<FetchTexture> *texs);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetBuffers(ReplayRenderer *rend, rdctype::array<FetchBuffer> *bufs);
+extern "C" RENDERDOC_API uint32_t RENDERDOC_CC ReplayRenderer_GetResourceGeneration(ReplayRenderer *rend);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetResolve(ReplayRenderer *rend, uint64_t *callstack, uint32_t callstackLen, rdctype::array<rdctype::str> *trace);
 extern "C" RENDERDOC_API ShaderReflection* RENDERDOC_CC ReplayRenderer_GetShaderDetails(ReplayRenderer *rend, ResourceId shader);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDebugMessages(ReplayRenderer *rend, rdctype::array<DebugMessage> *msgs);
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_PixelHistory(ReplayRenderer *rend, ResourceId target, uint32_t x, uint32_t y, uint32_t sampleIdx, rdctype::array<PixelModification> *history);
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_PixelHistoryBatch(ReplayRenderer *rend, ResourceId target, uint32_t *coords, uint32_t numPixels, uint32_t sampleIdx,
+                                                                              rdctype::array< rdctype::array<PixelModification> > *histories);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_DebugVertex(ReplayRenderer *rend, uint32_t vertid, uint32_t instid, uint32_t idx, uint32_t instOffset, uint32_t vertOffset, ShaderDebugTrace *trace);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_DebugPixel(ReplayRenderer *rend, uint32_t x, uint32_t y, uint32_t sample, uint32_t primitive, ShaderDebugTrace *trace);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_DebugThread(ReplayRenderer *rend, uint32_t groupid[3], uint32_t threadid[3], ShaderDebugTrace *trace);
@@ -166,6 +164,12 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetUsage(ReplayRende
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetCBufferVariableContents(ReplayRenderer *rend, ResourceId shader, uint32_t cbufslot, ResourceId buffer, uint32_t offs, rdctype::array<ShaderVariable> *vars);
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SaveTexture(ReplayRenderer *rend, const TextureSave &saveData, const char *path);
+// saves each job's texture at its event, replaying through the frame once in event order.
+// Returns true only if all jobs succeeded, and the selected event is unchanged afterwards.
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SaveTextures(ReplayRenderer *rend, TextureSaveJob *jobs, uint32_t numJobs, float *progress);
+// replays the whole frame loops times, displaying output (if not NULL) after each one, for
+// profiling the frame's GPU workload in an external tool. The selected event is unchanged afterwards.
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_ReplayLoop(ReplayRenderer *rend, uint32_t frameID, uint32_t loops, ReplayOutput *output, float *progress);
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetPostVSData(ReplayRenderer *rend, uint32_t instID, MeshDataStage stage, MeshFormat *data);
 
@@ -173,7 +177,15 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetMinMax(ReplayRend
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetHistogram(ReplayRenderer *rend, ResourceId tex, uint32_t sliceFace, uint32_t mip, uint32_t sample, float minval, float maxval, bool32 channels[4], rdctype::array<uint32_t> *histogram);
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetBufferData(ReplayRenderer *rend, ResourceId buff, uint32_t offset, uint32_t len, rdctype::array<byte> *data);
+// fetches numRows rows of rowSize bytes, stride bytes apart, packed together - e.g. just the
+// rows of a structured buffer that are visible
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetBufferDataStrided(ReplayRenderer *rend, ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows, rdctype::array<byte> *data);
+// as above but decoded into one variable per element per row, in row order
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetBufferElements(ReplayRenderer *rend, ResourceId buff, uint32_t offset, uint32_t stride, uint32_t numRows, const BufferElement *elements, uint32_t numElements, rdctype::array<ShaderVariable> *vars);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetTextureData(ReplayRenderer *rend, ResourceId tex, uint32_t arrayIdx, uint32_t mip, rdctype::array<byte> *data);
+// a rectangle of one subresource with rows packed together. Fails for block compressed,
+// MSAA and 3D textures, which need to be fetched whole.
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetTextureDataRegion(ReplayRenderer *rend, ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, rdctype::array<byte> *data);
 
 #ifdef RENDERDOC_EXPORTS
 struct RemoteAccess;
@@ -191,6 +203,11 @@ extern "C" RENDERDOC_API const char* RENDERDOC_CC RemoteAccess_GetBusyClient(Rem
 extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_TriggerCapture(RemoteAccess *access);
 extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_QueueCapture(RemoteAccess *access, uint32_t frameNumber);
 extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_CopyCapture(RemoteAccess *access, uint32_t remoteID, const char *localpath);
+extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_RequestMemoryUsage(RemoteAccess *access);
+// the target starts tracking its overhead on the first request, so the first reply is empty
+extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_RequestCaptureOverhead(RemoteAccess *access);
+// 0 stops the stream of eRemoteMsg_FrameStats
+extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_SetFrameStatsInterval(RemoteAccess *access, uint32_t milliseconds);
 
 extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_ReceiveMessage(RemoteAccess *access, RemoteMessage *msg);
 
@@ -229,6 +246,18 @@ typedef bool32 (RENDERDOC_CC *pRENDERDOC_SupportLocalReplay)(const char *logfile
 extern "C" RENDERDOC_API ReplayCreateStatus RENDERDOC_CC RENDERDOC_CreateReplayRenderer(const char *logfile, float *progress, ReplayRenderer **rend);
 typedef ReplayCreateStatus (RENDERDOC_CC *pRENDERDOC_CreateReplayRenderer)(const char *logfile, float *progress, ReplayRenderer **rend);
 
+// for replay renderers created afterwards, defer creating the internal shaders and resources
+// used for displaying and analysing textures and meshes until they are first used. Speeds up
+// opening captures for batch processing that never displays anything.
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_SetHeadlessReplay(bool32 headless);
+typedef void (RENDERDOC_CC *pRENDERDOC_SetHeadlessReplay)(bool32 headless);
+
+// for replay renderers created afterwards, replay on the given adapter (as enumerated by the API,
+// where supported) instead of the default one. ~0U goes back to the default. Running one process
+// per adapter lets batch work on several captures be split across GPUs.
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_SetReplayAdapter(uint32_t adapterIndex);
+typedef void (RENDERDOC_CC *pRENDERDOC_SetReplayAdapter)(uint32_t adapterIndex);
+
 //////////////////////////////////////////////////////////////////////////
 // Remote access and control
 //////////////////////////////////////////////////////////////////////////
@@ -275,5 +304,49 @@ typedef void (RENDERDOC_CC *pRENDERDOC_LogText)(const char *text);
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC RENDERDOC_GetThumbnail(const char *filename, byte *buf, uint32_t &len);
 typedef bool32 (RENDERDOC_CC *pRENDERDOC_GetThumbnail)(const char *filename, byte *buf, uint32_t &len);
 
+// re-encodes a logfile into a smaller archive for long-term storage, which can be
+// opened like any other logfile. Much slower to write than a normal capture.
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC RENDERDOC_ArchiveLogFile(const char *logfile, const char *archivefile);
+typedef bool32 (RENDERDOC_CC *pRENDERDOC_ArchiveLogFile)(const char *logfile, const char *archivefile);
+
+// writes a timeline of renderdoc's own recent operations in this process, e.g. loading and
+// replaying logs, as Chrome trace event JSON
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC RENDERDOC_WriteProfileTrace(const char *filename);
+typedef bool32 (RENDERDOC_CC *pRENDERDOC_WriteProfileTrace)(const char *filename);
+
+// formats count values with one printf conversion (e.g. "%.3f", "%d", "%08x"), parsed once, as
+// rows of numColumns values with colSep between values and rowSep after each row - e.g. for
+// exporting buffer contents as CSV without formatting each value separately.
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC RENDERDOC_FormatFloats(const char *format, const float *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output);
+typedef bool32 (RENDERDOC_CC *pRENDERDOC_FormatFloats)(const char *format, const float *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output);
+
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC RENDERDOC_FormatInts(const char *format, const int32_t *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output);
+typedef bool32 (RENDERDOC_CC *pRENDERDOC_FormatInts)(const char *format, const int32_t *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output);
+
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC RENDERDOC_FormatUInts(const char *format, const uint32_t *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output);
+typedef bool32 (RENDERDOC_CC *pRENDERDOC_FormatUInts)(const char *format, const uint32_t *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output);
+
 extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_FreeArrayMem(const void *mem);
 typedef void (RENDERDOC_CC *pRENDERDOC_FreeArrayMem)(const void *mem);
+
+// a result arena lets results be freed all at once, rather than with one RENDERDOC_FreeArrayMem
+// per array. While an arena is set on a thread, the arrays that ReplayRenderer_* calls on that
+// thread return are allocated from it. RENDERDOC_FreeArrayMem does nothing for arena memory,
+// and none of it can be used after RENDERDOC_FreeResultArena. An arena must only be set on
+// one thread at a time. Shader reflection is never copied - the pointers stay owned by the
+// replay - so it needs neither.
+#ifdef RENDERDOC_EXPORTS
+struct ResultArena;
+#else
+struct ResultArena { };
+#endif
+
+extern "C" RENDERDOC_API ResultArena* RENDERDOC_CC RENDERDOC_CreateResultArena();
+typedef ResultArena* (RENDERDOC_CC *pRENDERDOC_CreateResultArena)();
+
+// NULL goes back to allocating results on the heap
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_SetResultArena(ResultArena *arena);
+typedef void (RENDERDOC_CC *pRENDERDOC_SetResultArena)(ResultArena *arena);
+
+extern "C" RENDERDOC_API void RENDERDOC_CC RENDERDOC_FreeResultArena(ResultArena *arena);
+typedef void (RENDERDOC_CC *pRENDERDOC_FreeResultArena)(ResultArena *arena);
@@ -415,6 +415,9 @@ enum GPUCounters
 	eCounter_PSInvocations,
 	eCounter_RasterizedPrimitives,
 	eCounter_SamplesWritten,
+	eCounter_IAPrimitives,
+	eCounter_GSPrimitives,
+	eCounter_CSInvocations,
 
 	// IHV specific counters can be set above this point
 	// with ranges reserved for each IHV
@@ -445,6 +448,7 @@ enum ReplayCreateStatus
 	eReplayCreate_APIInitFailed,
 	eReplayCreate_APIIncompatibleVersion,
 	eReplayCreate_APIHardwareUnsupported,
+	eReplayCreate_FileMissingDependency,
 };
 
 enum RemoteMessageType
@@ -457,4 +461,8 @@ enum RemoteMessageType
 	eRemoteMsg_CaptureCopied,
 	eRemoteMsg_RegisterAPI,
 	eRemoteMsg_NewChild,
+	eRemoteMsg_MemoryUsage,
+	eRemoteMsg_CaptureCopyProgress,
+	eRemoteMsg_FrameStats,
+	eRemoteMsg_CaptureOverhead,
 };
@@ -96,6 +96,18 @@ struct ShaderVariable
 	rdctype::array<ShaderVariable> members;
 };
 
+// a single register that was written in a debug step, relative to the step before.
+// set is 0 for registers, 1 for outputs and 2+N for indexableTemps[N]
+struct ShaderRegisterChange
+{
+	uint32_t set;
+	uint32_t index;
+	ShaderVariable value;
+};
+
+// only keyframe states (including always the first state in a trace) have the full
+// registers, outputs and indexableTemps. Every other state leaves them empty and
+// lists in changes only the registers that differ from the previous state.
 struct ShaderDebugState
 {
 	rdctype::array<ShaderVariable> registers;
@@ -104,6 +116,9 @@ struct ShaderDebugState
 	rdctype::array< rdctype::array<ShaderVariable> > indexableTemps;
 
 	uint32_t nextInstruction;
+
+	bool32 keyframe;
+	rdctype::array<ShaderRegisterChange> changes;
 };
 
 struct ShaderDebugTrace
@@ -29,12 +29,33 @@
 
 #include "os/os_specific.h"
 #include "common/threading.h"
+#include "common/timing.h"
 
 #include "serialise/string_utils.h" 
 
 #include <string>
 using std::string;
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+// x86 SIMD paths for FindDiffRange, selected at runtime
+#define DIFF_SCAN_X86
+#endif
+
+#if defined(DIFF_SCAN_X86)
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define DIFF_SCAN_AVX_FUNC
+#else
+#include <cpuid.h>
+#define DIFF_SCAN_AVX_FUNC __attribute__((target("avx")))
+#endif
+
+#endif
+
 //	for(int i=0; i < 256; i++)
 //	{
 //		uint8_t comp = i&0xff;
@@ -86,141 +107,226 @@ void rdcassert(const char *condition, const char *file, unsigned int line, const
 	rdclog_int(RDCLog_Error, file, line, "Assertion failed: '%s'", condition, file, line);
 }
 
-#if 0
-static __m128 zero = {0};
-#endif
+// FindDiffRange is run over every buffer map that we keep a shadow copy of, so it can be
+// a significant part of the time spent capturing a frame. The scans compare 32 bytes at a
+// time in the widest registers the CPU supports, chosen once at startup, then narrow down
+// to the exact byte within the first (or last) stride that differs. All loads are unaligned
+// so the pointers don't need any particular alignment.
+static const size_t DiffStride = 32;
 
-// assumes a and b both point to 16-byte aligned 16-byte chunks of memory.
-// Returns if they're equal or different
-bool Vec16NotEqual(void *a, void *b)
+// returns the first byte in [start, end) that differs, or end if none do
+static size_t FirstDiffByte(const byte *a, const byte *b, size_t start, size_t end)
 {
-	// disabled SSE version as it's acting dodgy
-#if 0
-	__m128 avec = _mm_load_ps(aflt);
-	__m128 bvec = _mm_load_ps(bflt);
+	while(start < end && a[start] == b[start]) start++;
+	return start;
+}
 
-	__m128 diff = _mm_xor_ps(avec, bvec);
+// returns one past the last byte in [start, end) that differs, or start if none do
+static size_t LastDiffByte(const byte *a, const byte *b, size_t start, size_t end)
+{
+	while(end > start && a[end-1] == b[end-1]) end--;
+	return end;
+}
 
-	__m128 eq = _mm_cmpeq_ps(diff, zero);
-	int mask = _mm_movemask_ps(eq);
-	int signMask = _mm_movemask_ps(diff);
+static bool StrideNotEqual_Word(const byte *a, const byte *b)
+{
+	uint64_t a64[4], b64[4];
+	memcpy(a64, a, sizeof(a64));
+	memcpy(b64, b, sizeof(b64));
 
-	// first check ensures that diff is floatequal to zero (ie. avec bitwise equal to bvec).
-	// HOWEVER -0 is floatequal to 0, so we ensure no sign bits are set on diff
-	if((mask^0xf) || signMask != 0)
-	{
-		return true;
-	}
-	
-	return false;
-#elif defined(WIN64)
-	uint64_t *a64 = (uint64_t *)a;
-	uint64_t *b64 = (uint64_t *)b;
+	return ((a64[0]^b64[0]) | (a64[1]^b64[1]) | (a64[2]^b64[2]) | (a64[3]^b64[3])) != 0;
+}
 
-	return a64[0] != b64[0] ||
-		   a64[1] != b64[1];
-#else
-	uint32_t *a32 = (uint32_t *)a;
-	uint32_t *b32 = (uint32_t *)b;
+static size_t FirstDiff_Word(const byte *a, const byte *b, size_t size)
+{
+	size_t offs = 0;
+	for(; offs+DiffStride <= size; offs += DiffStride)
+		if(StrideNotEqual_Word(a+offs, b+offs))
+			break;
 
-	return a32[0] != b32[0] ||
-		   a32[1] != b32[1] ||
-		   a32[2] != b32[2] ||
-		   a32[3] != b32[3];
-#endif
+	return FirstDiffByte(a, b, offs, size);
 }
 
-bool FindDiffRange(void *a, void *b, size_t bufSize, size_t &diffStart, size_t &diffEnd)
+static size_t LastDiff_Word(const byte *a, const byte *b, size_t size)
 {
-	RDCASSERT(uintptr_t(a)%16 == 0);
-	RDCASSERT(uintptr_t(b)%16 == 0);
+	size_t end = size - size%DiffStride;
+
+	size_t tail = LastDiffByte(a, b, end, size);
+	if(tail > end)
+		return tail;
+
+	for(; end > 0; end -= DiffStride)
+		if(StrideNotEqual_Word(a+end-DiffStride, b+end-DiffStride))
+			return LastDiffByte(a, b, end-DiffStride, end);
+
+	return 0;
+}
+
+#if defined(DIFF_SCAN_X86)
 
-	diffStart = bufSize+1;
-	diffEnd = 0;
+static bool StrideNotEqual_SSE2(const byte *a, const byte *b)
+{
+	__m128i eq0 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)a), _mm_loadu_si128((const __m128i *)b));
+	__m128i eq1 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(a+16)), _mm_loadu_si128((const __m128i *)(b+16)));
 
-	size_t alignedSize = bufSize&(~0xf);
-	size_t numVecs = alignedSize/16;
+	return _mm_movemask_epi8(_mm_and_si128(eq0, eq1)) != 0xffff;
+}
 
+static size_t FirstDiff_SSE2(const byte *a, const byte *b, size_t size)
+{
 	size_t offs = 0;
+	for(; offs+DiffStride <= size; offs += DiffStride)
+		if(StrideNotEqual_SSE2(a+offs, b+offs))
+			break;
+
+	return FirstDiffByte(a, b, offs, size);
+}
 
-	float *aflt = (float *)a;
-	float *bflt = (float *)b;
+static size_t LastDiff_SSE2(const byte *a, const byte *b, size_t size)
+{
+	size_t end = size - size%DiffStride;
+
+	size_t tail = LastDiffByte(a, b, end, size);
+	if(tail > end)
+		return tail;
+
+	for(; end > 0; end -= DiffStride)
+		if(StrideNotEqual_SSE2(a+end-DiffStride, b+end-DiffStride))
+			return LastDiffByte(a, b, end-DiffStride, end);
+
+	return 0;
+}
+
+// only needs AVX rather than AVX2, as a bitwise xor and test is all that's needed to
+// tell if a stride differs, and the exact byte is found with a scalar loop anyway.
+DIFF_SCAN_AVX_FUNC static bool StrideNotEqual_AVX(const byte *a, const byte *b)
+{
+	__m256i diff = _mm256_castps_si256(_mm256_xor_ps(_mm256_loadu_ps((const float *)a), _mm256_loadu_ps((const float *)b)));
+
+	return _mm256_testz_si256(diff, diff) == 0;
+}
 
-	// sweep to find the start of differences
-	for(size_t v=0; v < numVecs; v++)
+DIFF_SCAN_AVX_FUNC static size_t FirstDiff_AVX(const byte *a, const byte *b, size_t size)
+{
+	size_t offs = 0;
+	for(; offs+DiffStride <= size; offs += DiffStride)
+		if(StrideNotEqual_AVX(a+offs, b+offs))
+			break;
+
+	_mm256_zeroupper();
+
+	return FirstDiffByte(a, b, offs, size);
+}
+
+DIFF_SCAN_AVX_FUNC static size_t LastDiff_AVX(const byte *a, const byte *b, size_t size)
+{
+	size_t end = size - size%DiffStride;
+
+	size_t tail = LastDiffByte(a, b, end, size);
+	if(tail > end)
+		return tail;
+
+	for(; end > 0; end -= DiffStride)
 	{
-		if(Vec16NotEqual(aflt, bflt))
+		if(StrideNotEqual_AVX(a+end-DiffStride, b+end-DiffStride))
 		{
-			diffStart = offs;
-			break;
+			_mm256_zeroupper();
+			return LastDiffByte(a, b, end-DiffStride, end);
 		}
-
-		aflt+=4;bflt+=4;offs+=4*sizeof(float);
 	}
 
-	// make sure we're byte-accurate, to comply with WRITE_NO_OVERWRITE
-	while(diffStart < bufSize && *((byte *)a + diffStart) == *((byte *)b + diffStart)) diffStart++;
+	_mm256_zeroupper();
 
-	// do we have some unaligned bytes at the end of the buffer?
-	if(bufSize > alignedSize)
-	{
-		size_t numBytes = alignedSize-bufSize;
+	return 0;
+}
 
-		// if we haven't even found a start, check in these bytes
-		if(diffStart > bufSize)
-		{
-			offs = bufSize;
+static void CPUFeatures(bool &sse2, bool &avx)
+{
+	uint32_t ecx = 0, edx = 0;
 
-			for(size_t by=0; by < numBytes; by++)
-			{
-				if(*((byte *)a + alignedSize + by) != *((byte *)b + alignedSize + by))
-				{
-					diffStart = offs;
-					break;
-				}
+#if defined(_MSC_VER)
+	int info[4] = {0};
+	__cpuid(info, 1);
+	ecx = (uint32_t)info[2];
+	edx = (uint32_t)info[3];
+#else
+	uint32_t eax = 0, ebx = 0;
+	if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		ecx = edx = 0;
+#endif
 
-				offs++;
-			}
-		}
-		
-		// sweep from the last byte to find the end
-		for(size_t by=0; by < numBytes; by++)
-		{
-			if(*((byte *)a + bufSize-1 - by) != *((byte *)b + bufSize-1 - by))
-			{
-				diffEnd = bufSize-by;
-				break;
-			}
-		}
+	sse2 = (edx & (1<<26)) != 0;
+
+	// AVX needs the OS to save the upper halves of the registers too (OSXSAVE, then XCR0)
+	avx = false;
+	if((ecx & (1<<27)) && (ecx & (1<<28)))
+	{
+#if defined(_MSC_VER)
+		uint64_t xcr0 = _xgetbv(0);
+#else
+		uint32_t lo = 0, hi = 0;
+		__asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		uint64_t xcr0 = ((uint64_t)hi<<32) | lo;
+#endif
+		avx = (xcr0 & 0x6) == 0x6;
 	}
+}
 
-	// if we haven't found a start, or we've found a start AND and end,
-	// then we're done.
-	if(diffStart > bufSize || diffEnd > 0)
-		return diffStart < bufSize;
-	
-	offs = alignedSize;
+#endif
+
+struct DiffScanner
+{
+	size_t (*FirstDiff)(const byte *a, const byte *b, size_t size);
+	size_t (*LastDiff)(const byte *a, const byte *b, size_t size);
+};
+
+static DiffScanner ChooseDiffScanner()
+{
+	DiffScanner ret = { &FirstDiff_Word, &LastDiff_Word };
 
-	// sweep from the last __m128
-	aflt = (float *)a + offs/sizeof(float) - 4;
-	bflt = (float *)b + offs/sizeof(float) - 4;
+#if defined(DIFF_SCAN_X86)
+	bool sse2 = false, avx = false;
+	CPUFeatures(sse2, avx);
 
-	for(size_t v=0; v < numVecs; v++)
+	if(avx)
 	{
-		if(Vec16NotEqual(aflt, bflt))
-		{
-			diffEnd = offs;
-			break;
-		}
+		ret.FirstDiff = &FirstDiff_AVX;
+		ret.LastDiff = &LastDiff_AVX;
+	}
+	else if(sse2)
+	{
+		ret.FirstDiff = &FirstDiff_SSE2;
+		ret.LastDiff = &LastDiff_SSE2;
+	}
+#endif
+
+	return ret;
+}
+
+// chosen during static initialisation, long before any capture could call FindDiffRange
+static const DiffScanner diffScanner = ChooseDiffScanner();
+
+bool FindDiffRange(void *a, void *b, size_t bufSize, size_t &diffStart, size_t &diffEnd)
+{
+	SCOPED_OVERHEAD(eOverhead_ShadowDiff);
+
+	const byte *abyte = (const byte *)a;
+	const byte *bbyte = (const byte *)b;
 
-		aflt-=4;bflt-=4;offs-=16;
+	diffStart = diffScanner.FirstDiff(abyte, bbyte, bufSize);
+
+	if(diffStart >= bufSize)
+	{
+		diffStart = bufSize+1;
+		diffEnd = 0;
+		return false;
 	}
-	
-	// make sure we're byte-accurate, to comply with WRITE_NO_OVERWRITE
-	while(diffEnd > 0 && *((byte *)a + diffEnd - 1) == *((byte *)b + diffEnd - 1)) diffEnd--;
-	
-	// if we found a start then we necessarily found an end
-	return diffStart < bufSize;
+
+	// there's at least one differing byte, so the end is after the start. Only the part after
+	// the start needs to be scanned. Byte-accurate, to comply with WRITE_NO_OVERWRITE
+	diffEnd = diffStart + diffScanner.LastDiff(abyte+diffStart, bbyte+diffStart, bufSize-diffStart);
+
+	return true;
 }
 
 uint32_t CalcNumMips(int w, int h, int d)
@@ -238,26 +344,193 @@ uint32_t CalcNumMips(int w, int h, int d)
 	return mipLevels;
 }
 
-static string &logfile()
+// lines for the logfile are appended to a pending buffer and written by a background thread
+// that keeps the file open, so a thread logging heavily only waits for a memcpy. The buffer is
+// bounded - a thread that fills it writes the pending lines itself. rdclog_flush() writes out
+// everything pending synchronously. Errors and fatal errors are flushed as soon as they're
+// logged, so they reach the file even if the process dies without running a crash handler.
+class LogFileWriter
 {
-	static string fn;
-	return fn;
+	public:
+		LogFileWriter() : m_File(NULL), m_Thread(0), m_Shutdown(false) {}
+
+		// returns a copy, as the name can be changed by another thread as soon as the lock is released
+		string GetFilename()
+		{
+			SCOPED_LOCK(m_FileLock);
+			return m_Filename;
+		}
+
+		void SetFilename(const char *filename)
+		{
+			Flush();
+
+			SCOPED_LOCK(m_FileLock);
+
+			if(m_File)
+				FileIO::fclose(m_File);
+			m_File = NULL;
+
+			SCOPED_LOCK(m_PendingLock);
+
+			m_Filename = "";
+			if(filename && filename[0])
+				m_Filename = filename;
+		}
+
+		void Print(const char *str)
+		{
+			bool full = false;
+
+			{
+				SCOPED_LOCK(m_PendingLock);
+
+				if(m_Filename.empty())
+					return;
+
+				if(m_Thread == 0 && !m_Shutdown)
+					m_Thread = Threading::CreateThread(&LogFileWriter::WriterThreadEntry, this);
+
+				m_Pending.append(str);
+				full = m_Pending.size() >= MaxPendingBytes;
+			}
+
+			if(full || m_Shutdown)
+				Flush();
+		}
+
+		void Flush()
+		{
+			SCOPED_LOCK(m_FileLock);
+
+			{
+				SCOPED_LOCK(m_PendingLock);
+				m_Writing.swap(m_Pending);
+			}
+
+			WritePending();
+		}
+
+		// the crashing thread could be holding either lock, so this doesn't wait for them and
+		// gives up if they're taken.
+		void CrashFlush()
+		{
+			if(!m_FileLock.Trylock())
+				return;
+
+			if(m_PendingLock.Trylock())
+			{
+				m_Writing.append(m_Pending);
+				m_Pending.clear();
+				m_PendingLock.Unlock();
+			}
+
+			WritePending();
+
+			m_FileLock.Unlock();
+		}
+
+		// waits for the writer thread to finish, then anything logged after this is written
+		// synchronously.
+		void Shutdown()
+		{
+			Threading::ThreadHandle thread = 0;
+
+			{
+				SCOPED_LOCK(m_PendingLock);
+				m_Shutdown = true;
+				thread = m_Thread;
+				m_Thread = 0;
+			}
+
+			if(thread)
+			{
+				Threading::JoinThread(thread);
+				Threading::CloseThread(thread);
+			}
+
+			Flush();
+		}
+
+	private:
+		static const size_t MaxPendingBytes = 256*1024;
+
+		// must hold m_FileLock
+		void WritePending()
+		{
+			if(m_Writing.empty())
+				return;
+
+			if(m_File == NULL && !m_Filename.empty())
+				m_File = FileIO::logfile_open(m_Filename.c_str());
+
+			if(m_File)
+			{
+				// length in bytes - the log is UTF-8 so this is NOT number of characters
+				FileIO::fwrite(m_Writing.c_str(), 1, m_Writing.size(), m_File);
+				fflush(m_File);
+			}
+
+			m_Writing.clear();
+		}
+
+		static void WriterThreadEntry(void *param)
+		{
+			((LogFileWriter *)param)->WriterThread();
+		}
+
+		void WriterThread()
+		{
+			while(!m_Shutdown)
+			{
+				Flush();
+				Threading::Sleep(10);
+			}
+		}
+
+		// m_FileLock is always taken before m_PendingLock
+		Threading::CriticalSection m_FileLock;
+		Threading::CriticalSection m_PendingLock;
+
+		string m_Filename;
+		FILE *m_File;
+
+		string m_Pending, m_Writing;
+
+		Threading::ThreadHandle m_Thread;
+		volatile bool m_Shutdown;
+};
+
+static LogFileWriter &logwriter()
+{
+	// never deleted, as other statics may still log while they're being destroyed
+	static LogFileWriter *writer = new LogFileWriter();
+	return *writer;
 }
 
-const char *rdclog_getfilename()
+static struct LogFileShutdown
+{
+	~LogFileShutdown() { logwriter().Shutdown(); }
+} logFileShutdown;
+
+string rdclog_getfilename()
 {
-	return logfile().c_str();
+	return logwriter().GetFilename();
 }
 
 void rdclog_filename(const char *filename)
 {
-	logfile() = "";
-	if(filename && filename[0])
-		logfile() = filename;
+	logwriter().SetFilename(filename);
 }
 
 void rdclog_flush()
 {
+	logwriter().Flush();
+}
+
+void rdclog_crashflush()
+{
+	logwriter().CrashFlush();
 }
 
 void rdclogprint_int(const char *str)
@@ -276,17 +549,30 @@ void rdclogprint_int(const char *str)
 	OSUtility::WriteOutput(OSUtility::Output_StdErr, str);
 #endif
 #if defined(OUTPUT_LOG_TO_DISK)
-	if(!logfile().empty())
+	logwriter().Print(str);
+#endif
+}
+
+bool rdclog_ratelimit(volatile int32_t *hits, const char *file, unsigned int line)
+{
+	int32_t count = Atomic::Inc32(hits);
+
+	if(count <= LOG_RATE_LIMIT)
+		return true;
+
+	if(count == LOG_RATE_LIMIT+1)
 	{
-		FILE *f = FileIO::fopen(logfile().c_str(), "a");
-		if(f)
-		{
-			// strlen used as byte length - str is UTF-8 so this is NOT number of characters
-			FileIO::fwrite(str, 1, strlen(str), f);
-			FileIO::fclose(f);
-		}
+		rdclog_int(RDCLog_Comment, file, line, "Hit %d times, only logging every %d from now on", LOG_RATE_LIMIT, LOG_RATE_LIMIT_INTERVAL);
+		return false;
 	}
-#endif
+
+	if(count % LOG_RATE_LIMIT_INTERVAL == 0)
+	{
+		rdclog_int(RDCLog_Comment, file, line, "Hit %d times", count);
+		return true;
+	}
+
+	return false;
 }
 
 void rdclog_int(LogType type, const char *file, unsigned int line, const char *fmt, ...)
@@ -357,4 +643,8 @@ void rdclog_int(LogType type, const char *file, unsigned int line, const char *f
 	*(output+1) = 0;
 
 	rdclogprint_int(outputBuffer);
+
+	// errors are often followed by a crash, so don't leave them waiting for the writer thread
+	if(type >= RDCLog_Error)
+		rdclog_flush();
 }
@@ -28,6 +28,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <string>
+
 #include "globalconfig.h"
 
 /////////////////////////////////////////////////
@@ -121,6 +123,8 @@ enum LogType
 #if defined(STRIP_LOG)
 #define RDCLOGFILE(fn) do { } while(0)
 #define RDCLOGDELETE() do { } while(0)
+#define RDCLOGFLUSH() do { } while(0)
+#define RDCLOGCRASHFLUSH() do { } while(0)
 
 #define RDCDEBUG(...) do { } while(0)
 #define RDCLOG(...) do { } while(0)
@@ -132,6 +136,9 @@ enum LogType
 // perform any operations necessary to flush the log
 void rdclog_flush();
 
+// as above, but safe to call from a crash handler - gives up rather than waiting on a lock
+void rdclog_crashflush();
+
 // actual low-level print to log output streams defined (useful for if we need to print
 // fatal error messages from within the more complex log function).
 void rdclogprint_int(const char *str);
@@ -141,20 +148,37 @@ void rdclog_int(LogType type, const char *file, unsigned int line, const char *f
 
 #define rdclog(type, ...) rdclog_int(type, __FILE__, __LINE__, __VA_ARGS__)
 
-const char *rdclog_getfilename();
+// counts the hits on one callsite and returns whether this one should be logged
+bool rdclog_ratelimit(volatile int32_t *hits, const char *file, unsigned int line);
+
+#define rdclog_limited(type, ...) do { static volatile int32_t rdclog_hits = 0; \
+	if(rdclog_ratelimit(&rdclog_hits, __FILE__, __LINE__)) rdclog(type, __VA_ARGS__); } while(0)
+
+std::string rdclog_getfilename();
 void rdclog_filename(const char *filename);
 
 #define RDCLOGFILE(fn) rdclog_filename(fn)
+#define RDCLOGFLUSH() rdclog_flush()
+#define RDCLOGCRASHFLUSH() rdclog_crashflush()
 #define RDCGETLOGFILE() rdclog_getfilename()
 
-#if ( !defined(RELEASE) || defined(FORCE_DEBUG_LOGS) ) && !defined(STRIP_DEBUG_LOGS)
-#define RDCDEBUG(...) rdclog(RDCLog_Debug, __VA_ARGS__)
+#if ( !defined(RELEASE) || defined(FORCE_DEBUG_LOGS) ) && !defined(STRIP_DEBUG_LOGS) && MINIMUM_LOG_LEVEL <= 0
+#define RDCDEBUG(...) rdclog_limited(RDCLog_Debug, __VA_ARGS__)
 #else
 #define RDCDEBUG(...) do { } while(0)
 #endif
 
+#if MINIMUM_LOG_LEVEL <= 1
 #define RDCLOG(...) rdclog(RDCLog_Comment, __VA_ARGS__)
-#define RDCWARN(...) rdclog(RDCLog_Warning, __VA_ARGS__)
+#else
+#define RDCLOG(...) do { } while(0)
+#endif
+
+#if MINIMUM_LOG_LEVEL <= 2
+#define RDCWARN(...) rdclog_limited(RDCLog_Warning, __VA_ARGS__)
+#else
+#define RDCWARN(...) do { } while(0)
+#endif
 
 #if defined(DEBUGBREAK_ON_ERROR_LOG)
 #define RDCERR(...) do { rdclog(RDCLog_Error, __VA_ARGS__); rdclog_flush(); RDCBREAK(); } while(0)
@@ -643,7 +643,87 @@ DXGI_FORMAT ResourceFormat2DXGIFormat(ResourceFormat format)
 	return DXGI_FORMAT_UNKNOWN;
 }
 
-bool write_dds_to_file(FILE *f, const dds_data &data)
+// works out whether a format is block compressed, and if not how many bytes each pixel takes
+static bool get_dds_pixel_layout(const ResourceFormat &format, bool &blockFormat, uint32_t &bytesPerPixel)
+{
+	blockFormat = false;
+	bytesPerPixel = 1;
+
+	if(format.special)
+	{
+		switch(format.specialFormat)
+		{
+			case eSpecial_BC1:
+			case eSpecial_BC2:
+			case eSpecial_BC3:
+			case eSpecial_BC4:
+			case eSpecial_BC5:
+			case eSpecial_BC6:
+			case eSpecial_BC7:
+				blockFormat = true;
+				return true;
+			case eSpecial_ETC2:
+			case eSpecial_EAC:
+				RDCERR("Unsupported file format, ETC2/EAC");
+				return false;
+			default:
+				break;
+		}
+	}
+
+	switch(format.specialFormat)
+	{
+		case eSpecial_R10G10B10A2:
+		case eSpecial_R9G9B9E5:
+		case eSpecial_R11G11B10:
+		case eSpecial_D24S8:
+		case eSpecial_B8G8R8A8:
+			bytesPerPixel = 4;
+			break;
+		case eSpecial_B5G6R5:
+		case eSpecial_B5G5R5A1:
+		case eSpecial_B4G4R4A4:
+			bytesPerPixel = 2;
+			break;
+		case eSpecial_D32S8:
+			bytesPerPixel = 5;
+			break;
+		case eSpecial_YUV:
+			RDCERR("Unsupported file format");
+			return false;
+		default:
+			bytesPerPixel = format.compCount*format.compByteWidth;
+	}
+
+	return true;
+}
+
+uint32_t dds_subresource_size(const dds_data &data, int mip)
+{
+	bool blockFormat = false;
+	uint32_t bytesPerPixel = 1;
+
+	if(!get_dds_pixel_layout(data.format, blockFormat, bytesPerPixel))
+		return 0;
+
+	int rowlen = RDCMAX(1, data.width>>mip);
+	int numRows = RDCMAX(1, data.height>>mip);
+	int pitch = RDCMAX(1U, rowlen * bytesPerPixel);
+
+	// pitch/rows are in blocks, not pixels, for block formats.
+	if(blockFormat)
+	{
+		numRows = RDCMAX(1, numRows/4);
+
+		int blockSize = (data.format.specialFormat == eSpecial_BC1 || data.format.specialFormat == eSpecial_BC4) ? 8 : 16;
+
+		pitch = RDCMAX(blockSize, (((rowlen+3)/4)) * blockSize);
+	}
+
+	return uint32_t(numRows*pitch);
+}
+
+bool write_dds_header(FILE *f, const dds_data &data)
 {
 	if(!f) return false;
 
@@ -669,28 +749,10 @@ bool write_dds_to_file(FILE *f, const dds_data &data)
 		header.dwFlags |= DDSD_DEPTH;
 
 	bool blockFormat = false;
+	uint32_t bytesPerPixel = 1;
 
-	if(data.format.special)
-	{
-		switch(data.format.specialFormat)
-		{
-			case eSpecial_BC1:
-			case eSpecial_BC2:
-			case eSpecial_BC3:
-			case eSpecial_BC4:
-			case eSpecial_BC5:
-			case eSpecial_BC6:
-			case eSpecial_BC7:
-				blockFormat = true;
-				break;
-			case eSpecial_ETC2:
-			case eSpecial_EAC:
-				RDCERR("Unsupported file format, ETC2/EAC");
-				return false;
-			default:
-				break;
-		}
-	}
+	if(!get_dds_pixel_layout(data.format, blockFormat, bytesPerPixel))
+		return false;
 
 	if(blockFormat)
 		header.dwFlags |= DDSD_LINEARSIZE;
@@ -724,8 +786,6 @@ bool write_dds_to_file(FILE *f, const dds_data &data)
 
 	if(headerDXT10.arraySize > 1)
 		dx10Header = true; // need to specify dx10 header to give array size
-	
-	uint32_t bytesPerPixel = 1;
 
 	if(blockFormat)
 	{
@@ -734,30 +794,6 @@ bool write_dds_to_file(FILE *f, const dds_data &data)
 	}
 	else
 	{
-		switch(data.format.specialFormat)
-		{
-			case eSpecial_R10G10B10A2:
-			case eSpecial_R9G9B9E5:
-			case eSpecial_R11G11B10:
-			case eSpecial_D24S8:
-			case eSpecial_B8G8R8A8:
-				bytesPerPixel = 4;
-				break;
-			case eSpecial_B5G6R5:
-			case eSpecial_B5G5R5A1:
-			case eSpecial_B4G4R4A4:
-				bytesPerPixel = 2;
-				break;
-			case eSpecial_D32S8:
-				bytesPerPixel = 5;
-				break;
-			case eSpecial_YUV:
-				RDCERR("Unsupported file format");
-				return false;
-			default:
-				bytesPerPixel = data.format.compCount*data.format.compByteWidth;
-		}
-		
 		header.dwPitchOrLinearSize = header.dwWidth * bytesPerPixel;
 	}
 	
@@ -819,45 +855,31 @@ bool write_dds_to_file(FILE *f, const dds_data &data)
 		header.ddspf.dwFourCC = MAKE_FOURCC('D', 'X', '1', '0');
 	}
 
-	{
-		FileIO::fwrite(&magic, sizeof(magic), 1, f);
-		FileIO::fwrite(&header, sizeof(header), 1, f);
-		if(dx10Header)
-			FileIO::fwrite(&headerDXT10, sizeof(headerDXT10), 1, f);
-
-		int i=0;
-		for(int slice=0; slice < RDCMAX(1,data.slices); slice++)
-		{
-			for(int mip=0; mip < RDCMAX(1,data.mips); mip++)
-			{
-				int numdepths = RDCMAX(1, data.depth>>mip);
-				for(int d=0; d < numdepths; d++)
-				{
-					byte *bytedata = data.subdata[i];
-
-					int rowlen = RDCMAX(1, data.width>>mip);
-					int numRows = RDCMAX(1, data.height>>mip);
-					int pitch = RDCMAX(1U, rowlen * bytesPerPixel);
-
-					// pitch/rows are in blocks, not pixels, for block formats.
-					if(blockFormat)
-					{
-						numRows = RDCMAX(1, numRows/4);
-
-						int blockSize = (data.format.specialFormat == eSpecial_BC1 || data.format.specialFormat == eSpecial_BC4) ? 8 : 16;
+	FileIO::fwrite(&magic, sizeof(magic), 1, f);
+	FileIO::fwrite(&header, sizeof(header), 1, f);
+	if(dx10Header)
+		FileIO::fwrite(&headerDXT10, sizeof(headerDXT10), 1, f);
 
-						pitch = RDCMAX(blockSize, (((rowlen+3)/4)) * blockSize);
-					}
+	return true;
+}
 
-					for(int row=0; row < numRows; row++)
-					{
-						FileIO::fwrite(bytedata, 1, pitch, f);
+bool write_dds_to_file(FILE *f, const dds_data &data)
+{
+	if(!write_dds_header(f, data))
+		return false;
 
-						bytedata += pitch;
-					}
+	int i=0;
+	for(int slice=0; slice < RDCMAX(1,data.slices); slice++)
+	{
+		for(int mip=0; mip < RDCMAX(1,data.mips); mip++)
+		{
+			uint32_t size = dds_subresource_size(data, mip);
 
-					i++;
-				}
+			int numdepths = RDCMAX(1, data.depth>>mip);
+			for(int d=0; d < numdepths; d++)
+			{
+				FileIO::fwrite(data.subdata[i], 1, size, f);
+				i++;
 			}
 		}
 	}
@@ -877,27 +899,12 @@ bool is_dds_file(FILE *f)
 	return magic == dds_fourcc;
 }
 
-dds_data load_dds_from_file(FILE *f)
+// fills out everything in the dds_data from the headers, including the size of each
+// subresource. subdata is allocated but each entry is left NULL for the caller to fill.
+static dds_data parse_dds_layout(const DDS_HEADER &header, bool dx10Header, const DDS_HEADER_DXT10 &headerDXT10)
 {
 	dds_data ret = {};
 	dds_data error = {};
-	
-	FileIO::fseek64(f, 0, SEEK_SET);
-
-	uint32_t magic = 0;
-	FileIO::fread(&magic, sizeof(magic), 1, f);
-
-	DDS_HEADER header = {};
-	FileIO::fread(&header, sizeof(header), 1, f);
-
-	bool dx10Header = false;
-	DDS_HEADER_DXT10 headerDXT10 = {};
-	
-	if(header.ddspf.dwFlags == DDPF_FOURCC && header.ddspf.dwFourCC == MAKE_FOURCC('D', 'X', '1', '0'))
-	{
-		FileIO::fread(&headerDXT10, sizeof(headerDXT10), 1, f);
-		dx10Header = true;
-	}
 
 	ret.width = RDCMAX(1U, header.dwWidth);
 	ret.height = RDCMAX(1U, header.dwHeight);
@@ -1002,54 +1009,11 @@ dds_data load_dds_from_file(FILE *f)
 		ret.format.special = false;
 	}
 	
-	uint32_t bytesPerPixel = 1;
-	switch(ret.format.specialFormat)
-	{
-		case eSpecial_R10G10B10A2:
-		case eSpecial_R9G9B9E5:
-		case eSpecial_R11G11B10:
-		case eSpecial_D24S8:
-		case eSpecial_B8G8R8A8:
-			bytesPerPixel = 4;
-			break;
-		case eSpecial_B5G6R5:
-		case eSpecial_B5G5R5A1:
-		case eSpecial_B4G4R4A4:
-			bytesPerPixel = 2;
-			break;
-		case eSpecial_D32S8:
-			bytesPerPixel = 5;
-			break;
-		case eSpecial_YUV:
-			RDCERR("Unsupported file format, YUV");
-			return error;
-		default:
-			bytesPerPixel = ret.format.compCount*ret.format.compByteWidth;
-	}
-
 	bool blockFormat = false;
+	uint32_t bytesPerPixel = 1;
 
-	if(ret.format.special)
-	{
-		switch(ret.format.specialFormat)
-		{
-			case eSpecial_BC1:
-			case eSpecial_BC2:
-			case eSpecial_BC3:
-			case eSpecial_BC4:
-			case eSpecial_BC5:
-			case eSpecial_BC6:
-			case eSpecial_BC7:
-				blockFormat = true;
-				break;
-			case eSpecial_ETC2:
-			case eSpecial_EAC:
-				RDCERR("Unsupported file format, ETC2/EAC");
-				return error;
-			default:
-				break;
-		}
-	}
+	if(!get_dds_pixel_layout(ret.format, blockFormat, bytesPerPixel))
+		return error;
 
 	ret.subsizes = new uint32_t[ret.slices * ret.mips];
 	ret.subdata = new byte*[ret.slices * ret.mips];
@@ -1059,37 +1023,94 @@ dds_data load_dds_from_file(FILE *f)
 	{
 		for(int mip=0; mip < ret.mips; mip++)
 		{
-			int rowlen = RDCMAX(1, ret.width>>mip);
-			int numRows = RDCMAX(1, ret.height>>mip);
 			int numdepths = RDCMAX(1, ret.depth>>mip);
-			int pitch = RDCMAX(1U, rowlen * bytesPerPixel);
 
-			// pitch/rows are in blocks, not pixels, for block formats.
-			if(blockFormat)
-			{
-				numRows = RDCMAX(1, numRows/4);
+			ret.subsizes[i] = numdepths*dds_subresource_size(ret, mip);
+			ret.subdata[i] = NULL;
 
-				int blockSize = (ret.format.specialFormat == eSpecial_BC1 || ret.format.specialFormat == eSpecial_BC4) ? 8 : 16;
+			i++;
+		}
+	}
 
-				pitch = RDCMAX(blockSize, (((rowlen+3)/4)) * blockSize);
-			}
+	return ret;
+}
 
-			ret.subsizes[i] = numdepths*numRows*pitch;
-			
-			byte *bytedata = ret.subdata[i] = new byte[ret.subsizes[i]];
-			
-			for(int d=0; d < numdepths; d++)
-			{
-				for(int row=0; row < numRows; row++)
-				{
-					FileIO::fread(bytedata, 1, pitch, f);
+dds_data load_dds_from_file(FILE *f)
+{
+	FileIO::fseek64(f, 0, SEEK_SET);
 
-					bytedata += pitch;
-				}
-			}
+	uint32_t magic = 0;
+	FileIO::fread(&magic, sizeof(magic), 1, f);
 
-			i++;
+	DDS_HEADER header = {};
+	FileIO::fread(&header, sizeof(header), 1, f);
+
+	bool dx10Header = false;
+	DDS_HEADER_DXT10 headerDXT10 = {};
+	
+	if(header.ddspf.dwFlags == DDPF_FOURCC && header.ddspf.dwFourCC == MAKE_FOURCC('D', 'X', '1', '0'))
+	{
+		FileIO::fread(&headerDXT10, sizeof(headerDXT10), 1, f);
+		dx10Header = true;
+	}
+
+	dds_data ret = parse_dds_layout(header, dx10Header, headerDXT10);
+
+	if(ret.subdata == NULL)
+		return ret;
+
+	// subresources are tightly packed, one after the other
+	for(int i=0; i < ret.slices*ret.mips; i++)
+	{
+		ret.subdata[i] = new byte[ret.subsizes[i]];
+		FileIO::fread(ret.subdata[i], 1, ret.subsizes[i], f);
+	}
+
+	return ret;
+}
+
+dds_data map_dds_from_memory(byte *base, uint64_t size)
+{
+	dds_data error = {};
+
+	uint64_t offs = sizeof(uint32_t) + sizeof(DDS_HEADER);
+
+	if(size < offs || *(uint32_t *)base != dds_fourcc)
+		return error;
+
+	DDS_HEADER header = {};
+	memcpy(&header, base + sizeof(uint32_t), sizeof(header));
+
+	bool dx10Header = false;
+	DDS_HEADER_DXT10 headerDXT10 = {};
+	
+	if(header.ddspf.dwFlags == DDPF_FOURCC && header.ddspf.dwFourCC == MAKE_FOURCC('D', 'X', '1', '0'))
+	{
+		if(size < offs + sizeof(headerDXT10))
+			return error;
+
+		memcpy(&headerDXT10, base + offs, sizeof(headerDXT10));
+		offs += sizeof(headerDXT10);
+		dx10Header = true;
+	}
+
+	dds_data ret = parse_dds_layout(header, dx10Header, headerDXT10);
+
+	if(ret.subdata == NULL)
+		return ret;
+
+	for(int i=0; i < ret.slices*ret.mips; i++)
+	{
+		if(offs + ret.subsizes[i] > size)
+		{
+			RDCWARN("DDS file is truncated, subresource %d extends past the end of the file", i);
+			delete[] ret.subdata;
+			delete[] ret.subsizes;
+			return error;
 		}
+
+		ret.subdata[i] = base + offs;
+		offs += ret.subsizes[i];
 	}
 
 	return ret;
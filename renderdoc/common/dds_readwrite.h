@@ -45,4 +45,17 @@ struct dds_data
 
 extern bool is_dds_file(FILE *f);
 extern dds_data load_dds_from_file(FILE *f);
-extern bool write_dds_to_file(FILE *f, const dds_data &data);
\ No newline at end of file
+
+// parses a dds file that's been mapped into memory. Each subdata entry points into the
+// mapping instead of being allocated, so only the subdata/subsizes arrays need freeing
+// and the data is only valid as long as the mapping is.
+extern dds_data map_dds_from_memory(byte *base, uint64_t size);
+extern bool write_dds_to_file(FILE *f, const dds_data &data);
+
+// for writing a dds file a piece at a time. Writes only the headers for data (subdata and
+// subsizes are ignored), after which each subresource must be written in order - for each
+// slice, for each mip, each depth slice - with dds_subresource_size() bytes.
+extern bool write_dds_header(FILE *f, const dds_data &data);
+
+// size in bytes of one depth slice of the given mip, as it's stored in the file
+extern uint32_t dds_subresource_size(const dds_data &data, int mip);
\ No newline at end of file
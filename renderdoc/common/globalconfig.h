@@ -55,6 +55,10 @@ enum
 // calls have been made
 //#define DEBUG_TEXT_SERIALISER
 
+// compile out all debug text generation in the serialiser, so reading
+// a log never formats names or values. Event descriptions will be empty
+//#define STRIP_SERIALISER_DEBUG_TEXT
+
 /////////////////////////////////////////////////
 // Logging configuration
 
@@ -85,6 +89,17 @@ enum
 // this strips them completely
 //#define STRIP_DEBUG_LOGS
 
+// compiles out logging below this level, including formatting the arguments:
+// 0 = everything, 1 = no debug logs, 2 = only warnings and errors, 3 = only errors
+#if !defined(MINIMUM_LOG_LEVEL)
+#define MINIMUM_LOG_LEVEL 0
+#endif
+
+// each RDCWARN/RDCDEBUG callsite prints this many times, then only every
+// LOG_RATE_LIMIT_INTERVAL'th time along with how many times it's been hit.
+#define LOG_RATE_LIMIT 64
+#define LOG_RATE_LIMIT_INTERVAL 4096
+
 /////////////////////////////////////////////////
 // optional features
 
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "os/os_specific.h"
+#include "common/timing.h"
 
 namespace Threading
 {
@@ -35,7 +36,18 @@ class ScopedLock
 	public:
 		ScopedLock(CriticalSection &cs)
 			: m_CS(&cs)
-		{ m_CS->Lock(); }
+		{
+			if(Overhead::Active)
+			{
+				Overhead::Scope prev = Overhead::Begin(eOverhead_Locks);
+				m_CS->Lock();
+				Overhead::End(prev);
+			}
+			else
+			{
+				m_CS->Lock();
+			}
+		}
 		~ScopedLock()
 		{ m_CS->Unlock(); }
 
@@ -62,6 +74,69 @@ class TryScopedLock
 		bool m_Owned;
 };
 
+// hands out unique IDs from a shared counter, reserving them a block at a time for each
+// thread so that threads creating many objects at once aren't all contending on a single
+// atomic. IDs always increase on any one thread, but aren't ordered between threads.
+class BlockIDAllocator
+{
+	public:
+		// IDs returned will be greater than lastID
+		BlockIDAllocator(uint64_t lastID)
+			: m_Counter((int64_t)lastID), m_Generation(0)
+		{
+			m_Slot = AllocateTLSSlot();
+		}
+
+		uint64_t Next()
+		{
+			Block *block = (Block *)GetTLSValue(m_Slot);
+
+			// blocks are deliberately not freed when a thread exits, as there's no portable way to
+			// do that. They're small and only allocated by threads that create resources.
+			if(block == NULL)
+			{
+				block = new Block();
+				block->next = block->end = 0;
+				block->generation = m_Generation;
+				SetTLSValue(m_Slot, block);
+			}
+
+			if(block->next == block->end || block->generation != m_Generation)
+			{
+				block->generation = m_Generation;
+				block->next = (uint64_t)Atomic::ExchAdd64(&m_Counter, BlockSize) + 1;
+				block->end = block->next + BlockSize;
+			}
+
+			return block->next++;
+		}
+
+		// make sure all IDs from now on are greater than lastID, including on threads that
+		// already have a block reserved. Not safe to call while other threads allocate IDs.
+		void AdvancePast(uint64_t lastID)
+		{
+			m_Counter = (int64_t)RDCMAX(uint64_t(m_Counter), lastID);
+			m_Generation++;
+		}
+
+		uint64_t GetLastID() const { return (uint64_t)m_Counter; }
+
+	private:
+		// large enough that the counter is rarely touched, small enough not to waste much of the
+		// ID space on threads that only create a few objects
+		static const int64_t BlockSize = 64;
+
+		struct Block
+		{
+			uint64_t next, end;
+			int32_t generation;
+		};
+
+		volatile int64_t m_Counter;
+		volatile int32_t m_Generation;
+		uint64_t m_Slot;
+};
+
 };
 
 #define SCOPED_LOCK(cs) Threading::ScopedLock CONCAT(scopedlock, __LINE__)(cs);
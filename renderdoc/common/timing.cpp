@@ -0,0 +1,310 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 Crytek
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "common/timing.h"
+#include "common/threading.h"
+#include "api/app/renderdoc_app.h"
+
+#include <string.h>
+#include <map>
+
+namespace Overhead
+{
+
+volatile bool Active = false;
+
+// chunk types above this share the last tracked entry, the same limit used for chunk memory
+static const uint32_t MaxChunkType = 1023;
+// the entry for time spent outside of any chunk
+static const uint32_t Unattributed = MaxChunkType+1;
+
+struct ThreadCounters
+{
+	uint32_t chunk;
+	OverheadCategory category;
+	uint64_t lastTick;
+
+	uint64_t calls[Unattributed+1];
+	uint64_t ticks[Unattributed+1][eOverhead_Count];
+};
+
+static uint64_t s_Slot = 0;
+
+// every thread's counters, only locked when a thread first registers and when fetching.
+// Counters are deliberately not freed when a thread exits, as there's no portable way to do
+// that and the totals should include threads that have finished.
+static Threading::CriticalSection s_ThreadsLock;
+static std::vector<ThreadCounters *> s_Threads;
+
+static ThreadCounters *GetCounters()
+{
+	ThreadCounters *counters = (ThreadCounters *)Threading::GetTLSValue(s_Slot);
+
+	if(counters == NULL)
+	{
+		counters = new ThreadCounters();
+		memset(counters, 0, sizeof(ThreadCounters));
+		counters->chunk = Unattributed;
+		counters->category = eOverhead_None;
+		Threading::SetTLSValue(s_Slot, counters);
+
+		// not a ScopedLock, since that is itself accounted for
+		s_ThreadsLock.Lock();
+		s_Threads.push_back(counters);
+		s_ThreadsLock.Unlock();
+	}
+
+	return counters;
+}
+
+// charge the time since the last change to whatever was running, and switch to the new state
+static Scope Switch(ThreadCounters *counters, uint32_t chunk, OverheadCategory category)
+{
+	uint64_t now = Timing::GetTick();
+
+	if(counters->category != eOverhead_None)
+		counters->ticks[counters->chunk][counters->category] += now - counters->lastTick;
+
+	Scope prev = { counters->chunk, counters->category };
+
+	counters->chunk = chunk;
+	counters->category = category;
+	counters->lastTick = now;
+
+	return prev;
+}
+
+Scope Begin(OverheadCategory category)
+{
+	ThreadCounters *counters = GetCounters();
+	return Switch(counters, counters->chunk, category);
+}
+
+Scope BeginChunk(uint32_t chunkType)
+{
+	ThreadCounters *counters = GetCounters();
+
+	uint32_t chunk = RDCMIN(chunkType, MaxChunkType);
+	counters->calls[chunk]++;
+
+	return Switch(counters, chunk, eOverhead_Serialise);
+}
+
+void End(const Scope &prev)
+{
+	Switch(GetCounters(), prev.chunk, prev.category);
+}
+
+std::vector<CaptureOverhead> Fetch()
+{
+	std::vector<CaptureOverhead> ret;
+
+	s_ThreadsLock.Lock();
+
+	if(!Active)
+	{
+		s_Slot = Threading::AllocateTLSSlot();
+		Active = true;
+		s_ThreadsLock.Unlock();
+		return ret;
+	}
+
+	double ticksPerMS = Timing::GetTickFrequency();
+
+	// other threads keep adding while we read. The totals may be a little stale but each
+	// counter is a single 64-bit value so they're never torn on the platforms we support.
+	for(uint32_t c=0; c <= Unattributed; c++)
+	{
+		uint64_t calls = 0;
+		uint64_t ticks[eOverhead_Count] = {0};
+
+		for(size_t t=0; t < s_Threads.size(); t++)
+		{
+			calls += s_Threads[t]->calls[c];
+			for(int i=0; i < eOverhead_Count; i++)
+				ticks[i] += s_Threads[t]->ticks[c][i];
+		}
+
+		bool any = calls > 0;
+		for(int i=0; i < eOverhead_Count; i++)
+			any |= ticks[i] > 0;
+
+		if(!any)
+			continue;
+
+		CaptureOverhead o;
+		o.ChunkType = (c == Unattributed) ? ~0U : c;
+		o.Calls = calls;
+		o.SerialiseTime = double(ticks[eOverhead_Serialise])/ticksPerMS;
+		o.RecordLookupTime = double(ticks[eOverhead_RecordLookup])/ticksPerMS;
+		o.LockTime = double(ticks[eOverhead_Locks])/ticksPerMS;
+		o.ShadowDiffTime = double(ticks[eOverhead_ShadowDiff])/ticksPerMS;
+		o.CallstackTime = double(ticks[eOverhead_Callstack])/ticksPerMS;
+		ret.push_back(o);
+	}
+
+	s_ThreadsLock.Unlock();
+
+	return ret;
+}
+
+};
+
+namespace Profiler
+{
+
+struct Event
+{
+	// the index of the event in this slot plus one, written last so that a slot being
+	// overwritten while we read it can be spotted
+	volatile int64_t seq;
+	uint64_t tick;
+	uint64_t thread;
+	bool begin;
+	char name[52];
+};
+
+// a power of two, so the ring index stays consistent when the counter wraps
+static const int64_t RingSize = 16384;
+
+static Event s_Events[RingSize];
+static volatile int64_t s_NextEvent = 0;
+
+static void Record(const char *name, bool begin)
+{
+	int64_t idx = Atomic::Inc64(&s_NextEvent) - 1;
+
+	Event &ev = s_Events[idx & (RingSize-1)];
+
+	ev.seq = 0;
+	ev.tick = Timing::GetTick();
+	ev.thread = Threading::GetCurrentID();
+	ev.begin = begin;
+
+	if(name)
+	{
+		strncpy(ev.name, name, sizeof(ev.name)-1);
+		ev.name[sizeof(ev.name)-1] = 0;
+	}
+	else
+	{
+		ev.name[0] = 0;
+	}
+
+	ev.seq = idx + 1;
+}
+
+void Begin(const char *name)
+{
+	Record(name, true);
+}
+
+void End()
+{
+	Record(NULL, false);
+}
+
+bool WriteChromeTrace(const char *filename)
+{
+	FILE *f = FileIO::fopen(filename, "wb");
+
+	if(f == NULL)
+	{
+		RDCERR("Can't open '%s' to write profile trace", filename);
+		return false;
+	}
+
+	int64_t last = s_NextEvent;
+	int64_t first = RDCMAX(last - RingSize, (int64_t)0);
+
+	double ticksPerUS = Timing::GetTickFrequency()/1000.0;
+	uint32_t pid = Process::GetCurrentPID();
+
+	uint64_t baseTick = 0;
+	bool haveBase = false;
+
+	// how many events are open on each thread. Ends whose begin has already been overwritten
+	// in the ring are dropped, as trace viewers don't cope with them.
+	std::map<uint64_t, int> depth;
+
+	fprintf(f, "{\"traceEvents\":[\n");
+
+	bool firstEvent = true;
+
+	for(int64_t i=first; i < last; i++)
+	{
+		Event ev = s_Events[i & (RingSize-1)];
+
+		// still being written, or already overwritten by a newer event
+		if(ev.seq != i+1 || s_Events[i & (RingSize-1)].seq != i+1)
+			continue;
+
+		if(ev.begin)
+		{
+			depth[ev.thread]++;
+		}
+		else
+		{
+			if(depth[ev.thread] == 0)
+				continue;
+			depth[ev.thread]--;
+		}
+
+		if(!haveBase)
+		{
+			baseTick = ev.tick;
+			haveBase = true;
+		}
+
+		fprintf(f, "%s{\"ph\":\"%c\",\"pid\":%u,\"tid\":%llu,\"ts\":%.3lf",
+			firstEvent ? "" : ",\n", ev.begin ? 'B' : 'E', pid, (unsigned long long)ev.thread,
+			double(ev.tick - baseTick)/ticksPerUS);
+
+		if(ev.begin)
+		{
+			fprintf(f, ",\"name\":\"");
+			for(const char *c=ev.name; *c; c++)
+			{
+				if(*c == '"' || *c == '\\')
+					fputc('\\', f);
+				if((unsigned char)*c >= 0x20)
+					fputc(*c, f);
+			}
+			fputc('"', f);
+		}
+
+		fputc('}', f);
+
+		firstEvent = false;
+	}
+
+	fprintf(f, "\n]}\n");
+
+	FileIO::fclose(f);
+
+	return true;
+}
+
+};
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 using std::string;
 
 #include <stdint.h>
@@ -57,6 +58,21 @@ class PerformanceTimer
 		uint64_t m_Start;
 };
 
+// a timeline of renderdoc's own larger operations - capturing, loading and replaying logs,
+// rendering previews - for finding where hitches come from. Begin/end events go into a ring
+// buffer shared by all threads, so only the most recent events are kept.
+namespace Profiler
+{
+	// the name is copied, and truncated if it's very long
+	void Begin(const char *name);
+	// ends the innermost operation begun on this thread
+	void End();
+
+	// writes out the events in the ring buffer as Chrome trace event JSON, which can be loaded
+	// in chrome://tracing
+	bool WriteChromeTrace(const char *filename);
+};
+
 class ScopedTimer
 {
 	public:
@@ -75,10 +91,13 @@ class ScopedTimer
 			m_Message = buf;
 			
 			va_end(args);
+
+			Profiler::Begin(buf);
 		}
 
 		~ScopedTimer()
 		{
+			Profiler::End();
 			rdclog_int(RDCLog_Comment, m_File, m_Line, "Timer %s - %.3lf ms", m_Message.c_str(), m_Timer.GetMilliseconds());
 		}
 	private:
@@ -88,4 +107,77 @@ class ScopedTimer
 		PerformanceTimer m_Timer;
 };
 
-#define SCOPED_TIMER(...) ScopedTimer CONCAT(timer, __LINE__) (__FILE__, __LINE__, __VA_ARGS__);
\ No newline at end of file
+#define SCOPED_TIMER(...) ScopedTimer CONCAT(timer, __LINE__) (__FILE__, __LINE__, __VA_ARGS__);
+// accounting of the CPU time renderdoc spends on its own work inside wrapped API calls, on
+// top of the real call. Each thread adds into its own counters so the hot path takes no locks
+// and no atomics. Time goes to whichever chunk type is being serialised on that thread, and
+// nested scopes are exclusive - time in a record lookup during serialisation only counts as
+// the lookup.
+//
+// Nothing is tracked until the first time the totals are fetched, so programs that never ask
+// don't pay for it.
+enum OverheadCategory
+{
+	eOverhead_Serialise = 0,
+	eOverhead_RecordLookup,
+	eOverhead_Locks,
+	eOverhead_ShadowDiff,
+	eOverhead_Callstack,
+	eOverhead_Count,
+	eOverhead_None = eOverhead_Count,
+};
+
+struct CaptureOverhead;
+
+namespace Overhead
+{
+	extern volatile bool Active;
+
+	// what to restore at the end of a scope
+	struct Scope
+	{
+		uint32_t chunk;
+		OverheadCategory category;
+	};
+
+	// starts charging time to category, on the current chunk
+	Scope Begin(OverheadCategory category);
+	// counts a call to chunkType and starts charging serialisation time to it
+	Scope BeginChunk(uint32_t chunkType);
+	void End(const Scope &prev);
+
+	// totals for every chunk type called so far, summed over all threads. Starts the tracking
+	// if it wasn't already running.
+	std::vector<CaptureOverhead> Fetch();
+};
+
+class ScopedOverhead
+{
+	public:
+		ScopedOverhead(OverheadCategory category)
+			: m_Active(Overhead::Active)
+		{
+			if(m_Active)
+				m_Prev = Overhead::Begin(category);
+		}
+
+		~ScopedOverhead()
+		{
+			if(m_Active)
+				Overhead::End(m_Prev);
+		}
+	private:
+		bool m_Active;
+		Overhead::Scope m_Prev;
+};
+
+#define SCOPED_OVERHEAD(category) ScopedOverhead CONCAT(overhead, __LINE__) (category);
+
+class ScopedProfile
+{
+	public:
+		ScopedProfile(const char *name) { Profiler::Begin(name); }
+		~ScopedProfile() { Profiler::End(); }
+};
+
+#define SCOPED_PROFILE(name) ScopedProfile CONCAT(profile, __LINE__) (name);
@@ -27,6 +27,9 @@
 
 #include <stdint.h>
 
+#include <vector>
+#include <algorithm>
+
 #include "common.h"
 #include "threading.h"
 
@@ -40,25 +43,40 @@ template<class T> class GetTypeName { public: static const char *Name(); };
 
 template<class C> class FriendMaker { public: typedef C Type; };
 
-// allocate each class in its own pool so we can identify the type by the pointer
+// allocate each class in its own pool so we can identify the type by the pointer.
+//
+// Allocating, freeing and IsAlloc are all lock-free. The lock is only taken to add an
+// additional pool once every existing pool is full.
+//
+// IsAlloc is called on nearly every unwrap, so it's a bounds check on the immediate pool
+// followed by a bounds check on the range covering every additional pool. Only pointers
+// inside that range need to search the sorted list of additional pools.
 template<typename WrapType, int PoolCount = 8192, int MaxPoolByteSize = 1024*1024>
 class WrappingPool
 {
 	public:
 		void *Allocate()
 		{
-			SCOPED_LOCK(m_Lock);
+			// try and allocate from immediate pool, then fall back to additional pools
+			for(ItemPool *pool = &m_ImmediatePool; pool; pool = pool->next)
+			{
+				void *ret = pool->Allocate();
+				if(ret != NULL)
+					return ret;
+			}
 
-			// try and allocate from immediate pool
-			void *ret = m_ImmediatePool.Allocate();
-			if(ret != NULL) return ret;
+			SCOPED_LOCK(m_Lock);
 
-			// fall back to additional pools, if there are any
-			for(size_t i=0; i < m_AdditionalPools.size(); i++)
+			// another thread might have added a pool while we waited for the lock, and
+			// slots may have been freed since we looked
+			ItemPool *tail = &m_ImmediatePool;
+			for(ItemPool *pool = &m_ImmediatePool; pool; pool = pool->next)
 			{
-				ret = m_AdditionalPools[i]->Allocate();
+				void *ret = pool->Allocate();
 				if(ret != NULL)
 					return ret;
+
+				tail = pool;
 			}
 
 			// warn when we need to allocate an additional pool
@@ -68,65 +86,44 @@ class WrappingPool
 			RDCWARN("Ran out of free slots in pool 0x%p!", &m_ImmediatePool.items[0]);
 #endif
 			
-			// allocate a new additional pool and use that to allocate from
-			m_AdditionalPools.push_back(new ItemPool());
+			// allocate a new additional pool and use that to allocate from. It's fully
+			// constructed before being linked in, so lock-free readers never see it half made
+			ItemPool *pool = new ItemPool();
+			void *ret = pool->Allocate();
+
+			Atomic::ExchPtr((void * volatile *)&tail->next, pool);
+			m_NumAdditionalPools++;
+
+			PublishRanges(pool);
 			
 #ifdef INCLUDE_TYPE_NAMES
-			RDCDEBUG("WrappingPool[%d]<%s>: %p -> %p", (uint32_t)m_AdditionalPools.size() - 1, GetTypeName<WrapType>::Name(),
-													&m_AdditionalPools.back()->items[0], &m_AdditionalPools.back()->items[AllocCount-1]);
+			RDCDEBUG("WrappingPool[%d]<%s>: %p -> %p", m_NumAdditionalPools - 1, GetTypeName<WrapType>::Name(),
+													&pool->items[0], &pool->items[AllocCount-1]);
 #endif
 
-			return m_AdditionalPools.back()->Allocate();
+			return ret;
 		}
 
 		bool IsAlloc(const void *p)
 		{
-			// we can check the immediate pool without locking
-			if(m_ImmediatePool.IsAlloc(p))
-				return true;
-
-			// if we have additional pools, lock and check them.
-			// TODO: Check for additional pools in a lock-free manner,
-			// to prevent the cost of locking if there are no more pools.
-			{
-				SCOPED_LOCK(m_Lock);
-
-				for(size_t i=0; i < m_AdditionalPools.size(); i++)
-					if(m_AdditionalPools[i]->IsAlloc(p))
-						return true;
-			}
-
-			return false;
+			return FindPool(p) != NULL;
 		}
 
 		void Deallocate(void *p)
 		{
-			SCOPED_LOCK(m_Lock);
+			ItemPool *pool = FindPool(p);
 
-			// try immediate pool
-			if(m_ImmediatePool.IsAlloc(p))
+			if(pool)
 			{
-				m_ImmediatePool.Deallocate(p);
+				pool->Deallocate(p);
 				return;
 			}
-			else if(!m_AdditionalPools.empty())
-			{
-				// fall back and try additional pools
-				for(size_t i=0; i < m_AdditionalPools.size(); i++)
-				{
-					if(m_AdditionalPools[i]->IsAlloc(p))
-					{
-						m_AdditionalPools[i]->Deallocate(p);
-						return;
-					}
-				}
-			}
 			
 			// this is an error - deleting an object that we don't recognise
 #ifdef INCLUDE_TYPE_NAMES
 			RDCERR("Resource being deleted through wrong pool - 0x%p not a member of %s", p, GetTypeName<WrapType>::Name());
 #else
-			RDCERR("Resource being deleted through wrong pool - 0x%p not a member of 0x%p", p, &m_ImmediatePool.items[0]));
+			RDCERR("Resource being deleted through wrong pool - 0x%p not a member of 0x%p", p, &m_ImmediatePool.items[0]);
 #endif
 		}
 
@@ -137,15 +134,29 @@ class WrappingPool
 			RDCDEBUG("WrappingPool<%s>: %p -> %p", GetTypeName<WrapType>::Name(), &m_ImmediatePool.items[0], &m_ImmediatePool.items[AllocCount-1]);
 #endif
 
+			m_NumAdditionalPools = 0;
+			m_Ranges = NULL;
+
 			RDCCOMPILE_ASSERT(PoolCount*AllocByteSize <= MaxPoolByteSize, "Pool is bigger than max pool size cap");
 			RDCCOMPILE_ASSERT(PoolCount > 2, "Pool isn't greater than 2 in size. Bad parameters?"); // make sure parameters are sane
 		}
 		~WrappingPool()
 		{
-			for(size_t i=0; i < m_AdditionalPools.size(); i++)
-				delete m_AdditionalPools[i];
+			ItemPool *pool = m_ImmediatePool.next;
+			while(pool)
+			{
+				ItemPool *next = pool->next;
+				delete pool;
+				pool = next;
+			}
+
+			m_ImmediatePool.next = NULL;
 
-			m_AdditionalPools.clear();
+			for(size_t i=0; i < m_RangeSnapshots.size(); i++)
+				delete m_RangeSnapshots[i];
+
+			m_RangeSnapshots.clear();
+			m_Ranges = NULL;
 		}
 
 		static const size_t AllocCount = PoolCount;
@@ -153,12 +164,24 @@ class WrappingPool
 
 		Threading::CriticalSection m_Lock;
 
+		// free slots are kept in an intrusive lock-free stack. Each free slot holds the
+		// index of the next free slot in its first 4 bytes (wrapped objects are always
+		// bigger than that). The stack head packs the top index in the low 32 bits with
+		// a counter in the high 32 bits that changes on every push and pop, so that a
+		// compare-exchange can't succeed on a stale head (the ABA problem).
+		//
+		// Slots past nextUnused have never been allocated and aren't in the stack, so
+		// a new pool doesn't need to touch all of its memory to build the list.
 		struct ItemPool
 		{
 			ItemPool()
 			{
-				lastAllocIdx = 0;
+				freeHead = (int64_t)EmptyIdx;
+				nextUnused = 0;
+				next = NULL;
+#if !defined(RELEASE)
 				RDCEraseEl(allocated);
+#endif
 
 				items = (WrapType *)(new uint8_t[AllocCount*AllocByteSize]);
 			}
@@ -169,32 +192,27 @@ class WrappingPool
 
 			void *Allocate()
 			{
-				int lastAlloc = lastAllocIdx;
+				uint32_t idx = PopFree();
 
-				if(allocated[lastAlloc])
+				if(idx == EmptyIdx)
 				{
-					int end = lastAlloc;
+					// nothing free to reuse, so take a slot that's never been used
+					if(nextUnused >= PoolCount)
+						return NULL;
 
-					do 
-					{
-						lastAlloc = (lastAlloc+1) % PoolCount;
-					} while (allocated[lastAlloc] && lastAlloc != end);
+					idx = (uint32_t)(Atomic::Inc32(&nextUnused) - 1);
 
-					if(allocated[lastAlloc])
-					{
+					if(idx >= (uint32_t)PoolCount)
 						return NULL;
-					}
 				}
 
-				void *ret = (void *)&items[lastAlloc];
-				allocated[lastAlloc] = true;
+				void *ret = (void *)&items[idx];
 
 #if !defined(RELEASE)
+				allocated[idx] = true;
 				memset(ret, 0xb0, AllocByteSize);
 #endif
 
-				lastAllocIdx = lastAlloc;
-
 				return ret;
 			}
 
@@ -202,21 +220,27 @@ class WrappingPool
 			{
 				RDCASSERT(IsAlloc(p));
 
+				size_t idx = (WrapType *)p-&items[0];
+
 #if !defined(RELEASE)
 				if(!IsAlloc(p))
 				{
 					RDCERR("Resource being deleted through wrong pool - 0x%p not a memory of 0x%p", p, &items[0]);
 					return;
 				}
-#endif
 
-				size_t idx = (WrapType *)p-&items[0];
+				// freeing twice would put a cycle in the free list
+				if(!allocated[idx])
+				{
+					RDCERR("Resource 0x%p being deleted twice", p);
+					return;
+				}
 
 				allocated[idx] = false;
-
-#if !defined(RELEASE)
 				memset(p, 0xfe, AllocByteSize);
 #endif
+
+				PushFree((uint32_t)idx);
 			}
 
 			bool IsAlloc(const void *p) const
@@ -224,22 +248,135 @@ class WrappingPool
 				return p >= &items[0] && p < &items[PoolCount];
 			}
 
+			uint32_t PopFree()
+			{
+				while(true)
+				{
+					int64_t head = Atomic::Read64(&freeHead);
+					uint32_t idx = uint32_t(head & 0xffffffff);
+
+					if(idx >= (uint32_t)PoolCount)
+						return EmptyIdx;
+
+					// this might already have been popped and overwritten by another
+					// thread, but then the counter in head will have changed and the
+					// exchange below fails
+					uint32_t nextIdx = *(volatile uint32_t *)&items[idx];
+
+					int64_t newHead = NextHead(head, nextIdx);
+
+					if(Atomic::CmpExch64(&freeHead, newHead, head) == head)
+						return idx;
+				}
+			}
+
+			void PushFree(uint32_t idx)
+			{
+				while(true)
+				{
+					int64_t head = Atomic::Read64(&freeHead);
+
+					*(volatile uint32_t *)&items[idx] = uint32_t(head & 0xffffffff);
+
+					int64_t newHead = NextHead(head, idx);
+
+					if(Atomic::CmpExch64(&freeHead, newHead, head) == head)
+						return;
+				}
+			}
+
+			static int64_t NextHead(int64_t head, uint32_t idx)
+			{
+				uint64_t counter = ((uint64_t)head & 0xffffffff00000000ULL) + 0x100000000ULL;
+				return (int64_t)(counter | idx);
+			}
+
+			static const uint32_t EmptyIdx = 0xffffffff;
+
 			WrapType *items;
 
-			// could possibly make this uint32s and check via bitmasks, but
-			// we'll see if it shows up in profiling
-			bool allocated[PoolCount];
+			volatile int64_t freeHead;
+			volatile int32_t nextUnused;
+
+			// the next additional pool, linked in once and never changed until shutdown
+			ItemPool * volatile next;
 
-			// store the last allocations index. Good place to start from and we
-			// go through the pool in a ring. Good performance when the pool is empty
-			// or contiguously allocated, poorer performance when the pool gets filled up.
-			// It also has the bonus of handling repeated new/free well by reallocating the
-			// same element.
-			int lastAllocIdx;
+#if !defined(RELEASE)
+			bool allocated[PoolCount];
+#endif
 		};
 		
+		// the address ranges of the additional pools, sorted by address. A new snapshot is
+		// published whenever a pool is added. Readers might still be using an old one, so
+		// they're only freed at shutdown (there are only ever a handful).
+		struct PoolRange
+		{
+			uintptr_t start, end;
+			ItemPool *pool;
+
+			bool operator <(const PoolRange &o) const { return start < o.start; }
+		};
+
+		struct RangeSnapshot
+		{
+			// covers every pool, so most pointers are rejected with one bounds check
+			uintptr_t minAddr, maxAddr;
+			std::vector<PoolRange> ranges;
+		};
+
+		ItemPool *FindPool(const void *p)
+		{
+			if(m_ImmediatePool.IsAlloc(p))
+				return &m_ImmediatePool;
+
+			const RangeSnapshot *snap = m_Ranges;
+			uintptr_t addr = (uintptr_t)p;
+
+			if(snap == NULL || addr < snap->minAddr || addr >= snap->maxAddr)
+				return NULL;
+
+			// find the last pool starting at or before addr
+			PoolRange key = { addr, addr, NULL };
+			typename std::vector<PoolRange>::const_iterator it =
+				std::upper_bound(snap->ranges.begin(), snap->ranges.end(), key);
+
+			if(it == snap->ranges.begin())
+				return NULL;
+
+			--it;
+
+			return addr < it->end ? it->pool : NULL;
+		}
+
+		// must be called with m_Lock held
+		void PublishRanges(ItemPool *pool)
+		{
+			RangeSnapshot *snap = new RangeSnapshot();
+
+			if(m_Ranges)
+				snap->ranges = m_Ranges->ranges;
+
+			PoolRange range = { (uintptr_t)&pool->items[0], (uintptr_t)&pool->items[PoolCount], pool };
+			snap->ranges.push_back(range);
+
+			std::sort(snap->ranges.begin(), snap->ranges.end());
+
+			snap->minAddr = snap->ranges.front().start;
+			snap->maxAddr = 0;
+			for(size_t i=0; i < snap->ranges.size(); i++)
+				snap->maxAddr = RDCMAX(snap->maxAddr, snap->ranges[i].end);
+
+			m_RangeSnapshots.push_back(snap);
+
+			// readers don't take the lock, so the snapshot must be complete before they can see it
+			Atomic::ExchPtr((void * volatile *)&m_Ranges, snap);
+		}
+
 		ItemPool m_ImmediatePool;
-		std::vector<ItemPool *> m_AdditionalPools;
+		int m_NumAdditionalPools;
+
+		const RangeSnapshot * volatile m_Ranges;
+		std::vector<RangeSnapshot *> m_RangeSnapshots;
 
 		friend typename FriendMaker<WrapType>::Type;
 };
@@ -27,14 +27,18 @@
 #include "serialise/string_utils.h"
 #include "serialise/serialiser.h"
 #include "replay/replay_driver.h"
+#include "core/resource_manager.h"
+#include "common/timing.h"
 
 #include <time.h>
+#include <algorithm>
 
 #include "data/version.h"
 #include "crash_handler.h"
 
 #include "stb/stb_image.h"
 #include "common/dds_readwrite.h"
+#include "jpeg-compressor/jpge.h"
 
 // not provided by tinyexr, just do by hand
 bool is_exr_file(FILE *f)
@@ -159,8 +163,15 @@ RenderDoc::RenderDoc()
 	m_CurrentDriver = RDC_Unknown;
 
 	m_Replay = false;
+	m_HeadlessReplay = false;
+	m_ReplayAdapter = ~0U;
 
-	m_Cap = false;
+	m_Bootstrap = false;
+	m_LazyCrashHandler = false;
+	m_CrashHandlerCreated = false;
+	m_Initialised = false;
+
+	m_Cap = 0;
 
 	m_FocusKeys.clear();
 	m_FocusKeys.push_back(eKey_F11);
@@ -174,45 +185,41 @@ RenderDoc::RenderDoc()
 	m_ExHandler = NULL;
 
 	m_Overlay = eOverlay_Default;
+
+	m_CallstackSampleCounter = 0;
 	
 	m_RemoteServerThreadShutdown = false;
 	m_RemoteClientThreadShutdown = false;
-}
 
-void RenderDoc::Initialise()
-{
-	Callstack::Init();
+	m_CaptureWriteThread = 0;
+	m_CaptureWriteThreadShutdown = false;
 
-	Network::Init();
-
-	m_RemoteIdent = 0;
-
-	if(!IsReplayApp())
-	{
-		uint32_t port = RenderDoc_FirstCaptureNetworkPort;
+	RDCEraseEl(m_FrameStats);
 
-		Network::Socket *sock = Network::CreateServerSocket("0.0.0.0", port&0xffff, 4);
+	m_SavePreviousFrame = false;
 
-		while(sock == NULL)
-		{
-			port++;
-			if(port > RenderDoc_LastCaptureNetworkPort)
-			{
-				m_RemoteIdent = 0;
-				break;
-			}
+	RDCEraseEl(m_Trigger);
+	m_TriggerArmed = false;
+	m_TriggerProbeMarkers = false;
+	m_TriggerProbeShaders = false;
+	m_TriggerHit = false;
+	m_TriggerCaptures = 0;
+	m_RegionMarkerArmed = false;
+	m_TriggerCooldown = 0;
+	RDCEraseEl(m_TriggerFrame);
+	m_TriggerCheckedFrame = 0;
+	m_TriggerNumFrames = 0;
+	m_TriggerAvgDraws = 0.0;
 
-			sock = Network::CreateServerSocket("0.0.0.0", port&0xffff, 4);
-		}
+	m_FrameCapturers = new FrameCapturerSnapshot();
+	m_FrameCapturerReaders = 0;
+}
 
-		if(sock)
-		{
-			m_RemoteIdent = port;
+void RenderDoc::Initialise()
+{
+	Network::Init();
 
-			m_RemoteServerThreadShutdown = false;
-			m_RemoteThread = Threading::CreateThread(RemoteAccessServerThread, (void *)sock);
-		}
-	}
+	m_RemoteIdent = 0;
 
 	// set default capture log - useful for when hooks aren't setup
 	// through the UI (and a log file isn't set manually)
@@ -229,6 +236,7 @@ void RenderDoc::Initialise()
 			SetLogFile(capture_filename.c_str());
 
 		string existingLog = RDCGETLOGFILE();
+		RDCLOGFLUSH();
 		FileIO::Copy(existingLog.c_str(), m_LoggingFilename.c_str(), true);
 		RDCLOGFILE(m_LoggingFilename.c_str());
 	}
@@ -237,22 +245,102 @@ void RenderDoc::Initialise()
 		RDCLOG("RenderDoc v%s (%s) loaded in replay application", RENDERDOC_VERSION_STRING, GIT_COMMIT_HASH);
 	else
 		RDCLOG("RenderDoc v%s (%s) capturing application", RENDERDOC_VERSION_STRING, GIT_COMMIT_HASH);
-
-	Keyboard::Init();
 	
 	m_ExHandler = NULL;
 
+	if(m_Bootstrap && !IsReplayApp())
 	{
-		string curFile;
-		FileIO::GetExecutableFilename(curFile);
+		RDCLOG("Bootstrapped, deferring initialisation until a device or context is created");
+		return;
+	}
 
-		string f = strlower(curFile);
+	EnsureInitialised();
+}
 
-		// only create crash handler when we're not in renderdoccmd.exe (to prevent infinite loop as
-		// the crash handler itself launches renderdoccmd.exe)
-		if(f.find("renderdoccmd.exe") == string::npos)
+void RenderDoc::EnsureInitialised()
+{
+	if(m_Initialised)
+		return;
+
+	SCOPED_LOCK(m_InitLock);
+
+	if(m_Initialised)
+		return;
+
+	if(m_Bootstrap)
+		RDCLOG("Completing deferred initialisation");
+
+	Callstack::Init();
+
+	EnsureRemoteAccess();
+
+	Keyboard::Init();
+
+	if(m_LazyCrashHandler && !IsReplayApp())
+		RDCLOG("Deferring crash handler until a device or context is created");
+	else
+		EnsureCrashHandler();
+
+	m_Initialised = true;
+}
+
+void RenderDoc::EnsureCrashHandler()
+{
+	// only ever done once, so that unloading the crash handler sticks
+	if(m_CrashHandlerCreated)
+		return;
+
+	SCOPED_LOCK(m_InitLock);
+
+	if(m_CrashHandlerCreated)
+		return;
+
+	m_CrashHandlerCreated = true;
+
+	string curFile;
+	FileIO::GetExecutableFilename(curFile);
+
+	string f = strlower(curFile);
+
+	// only create crash handler when we're not in renderdoccmd.exe (to prevent infinite loop as
+	// the crash handler itself launches renderdoccmd.exe)
+	if(f.find("renderdoccmd.exe") == string::npos)
+	{
+		RecreateCrashHandler();
+	}
+}
+
+void RenderDoc::EnsureRemoteAccess()
+{
+	SCOPED_LOCK(m_InitLock);
+
+	if(m_RemoteThread)
+		return;
+
+	if(!IsReplayApp())
+	{
+		uint32_t port = RenderDoc_FirstCaptureNetworkPort;
+
+		Network::Socket *sock = Network::CreateServerSocket("0.0.0.0", port&0xffff, 4);
+
+		while(sock == NULL)
 		{
-			RecreateCrashHandler();
+			port++;
+			if(port > RenderDoc_LastCaptureNetworkPort)
+			{
+				m_RemoteIdent = 0;
+				break;
+			}
+
+			sock = Network::CreateServerSocket("0.0.0.0", port&0xffff, 4);
+		}
+
+		if(sock)
+		{
+			m_RemoteIdent = port;
+
+			m_RemoteServerThreadShutdown = false;
+			m_RemoteThread = Threading::CreateThread(RemoteAccessServerThread, (void *)sock);
 		}
 	}
 }
@@ -276,6 +364,14 @@ RenderDoc::~RenderDoc()
 			RDCLOG("'Leaking' unretrieved capture %s", m_Captures[i].path.c_str());
 		}
 	}
+
+	SAFE_DELETE(m_FrameCapturers);
+	for(size_t i=0; i < m_RetiredFrameCapturers.size(); i++)
+		delete m_RetiredFrameCapturers[i];
+	m_RetiredFrameCapturers.clear();
+
+	// the logfile is kept open while logging to it
+	RDCLOGFILE(NULL);
 	
 	FileIO::Delete(m_LoggingFilename.c_str());
 
@@ -287,6 +383,14 @@ RenderDoc::~RenderDoc()
 		m_RemoteThread = 0;
 	}
 
+	if(m_CaptureWriteThread)
+	{
+		m_CaptureWriteThreadShutdown = true;
+		// as above, any capture still being written is abandoned
+		Threading::CloseThread(m_CaptureWriteThread);
+		m_CaptureWriteThread = 0;
+	}
+
 	Network::Shutdown();
 
 	FileIO::Delete(m_LoggingFilename.c_str());
@@ -308,17 +412,90 @@ void RenderDoc::Shutdown()
 		Threading::CloseThread(m_RemoteThread);
 		m_RemoteThread = 0;
 	}
+
+	if(m_CaptureWriteThread)
+	{
+		// the thread finishes writing any pending captures before exiting
+		m_CaptureWriteThreadShutdown = true;
+		Threading::JoinThread(m_CaptureWriteThread);
+		Threading::CloseThread(m_CaptureWriteThread);
+		m_CaptureWriteThread = 0;
+	}
+
+	uint64_t largeAllocs = 0, fallbackAllocs = 0;
+	LargePage::GetStats(largeAllocs, fallbackAllocs);
+	if(largeAllocs + fallbackAllocs > 0)
+		RDCLOG("Large pages backed %llu of %llu large shadow allocations", largeAllocs, largeAllocs + fallbackAllocs);
+}
+
+bool RenderDoc::FrameCapturerSnapshot::Less(const pair<DeviceWnd, FrameCap> &a, const DeviceWnd &b)
+{
+	return a.first < b;
+}
+
+const RenderDoc::FrameCap *RenderDoc::FrameCapturerSnapshot::Find(const DeviceWnd &dw) const
+{
+	auto it = std::lower_bound(capturers.begin(), capturers.end(), dw, FrameCapturerSnapshot::Less);
+
+	if(it == capturers.end() || !(it->first == dw))
+		return NULL;
+
+	return &it->second;
+}
+
+RenderDoc::FrameCap *RenderDoc::FrameCapturerSnapshot::Find(const DeviceWnd &dw)
+{
+	return const_cast<FrameCap *>(((const FrameCapturerSnapshot *)this)->Find(dw));
+}
+
+const RenderDoc::FrameCapturerSnapshot *RenderDoc::AcquireFrameCapturers()
+{
+	// the increment is a full barrier, so the snapshot read after it can't be one that a
+	// publisher has already seen no readers for
+	Atomic::Inc64(&m_FrameCapturerReaders);
+	return m_FrameCapturers;
+}
+
+void RenderDoc::ReleaseFrameCapturers()
+{
+	Atomic::Dec64(&m_FrameCapturerReaders);
+}
+
+void RenderDoc::PublishFrameCapturers(FrameCapturerSnapshot *snapshot)
+{
+	m_RetiredFrameCapturers.push_back((FrameCapturerSnapshot *)m_FrameCapturers);
+	m_FrameCapturers = snapshot;
+
+	// readers from before the publish might still hold any retired snapshot, but if there are
+	// none now then every later reader gets the new one.
+	if(Atomic::ExchAdd64(&m_FrameCapturerReaders, 0) == 0)
+	{
+		for(size_t i=0; i < m_RetiredFrameCapturers.size(); i++)
+			delete m_RetiredFrameCapturers[i];
+		m_RetiredFrameCapturers.clear();
+	}
+}
+
+bool RenderDoc::IsActiveWindow(void *dev, void *wnd)
+{
+	const FrameCapturerSnapshot *snapshot = AcquireFrameCapturers();
+	bool ret = (snapshot->activeWindow == DeviceWnd(dev, wnd));
+	ReleaseFrameCapturers();
+
+	return ret;
 }
 
 void RenderDoc::StartFrameCapture(void *dev, void *wnd)
 {
+	const FrameCapturerSnapshot *snapshot = AcquireFrameCapturers();
+
 	if(dev == NULL || wnd == NULL)
 	{
 		// if we have a single window frame capturer, use that in preference
-		if(m_WindowFrameCapturers.size() == 1)
+		if(snapshot->capturers.size() == 1)
 		{
-			auto it = m_WindowFrameCapturers.begin();
-			it->second.FrameCapturer->StartFrameCapture(it->first.dev, it->first.wnd);
+			const pair<DeviceWnd, FrameCap> &cap = snapshot->capturers[0];
+			cap.second.FrameCapturer->StartFrameCapture(cap.first.dev, cap.first.wnd);
 		}
 		// otherwise, see if we only have one default capturer
 		else if(m_DefaultFrameCapturers.size() == 1)
@@ -330,44 +507,50 @@ void RenderDoc::StartFrameCapture(void *dev, void *wnd)
 		{
 			RDCERR("Multiple frame capture methods registered, can't capture by NULL handles");
 		}
+
+		ReleaseFrameCapturers();
 		return;
 	}
 
-	DeviceWnd dw(dev, wnd);
-
-	auto it = m_WindowFrameCapturers.find(dw);
-	if(it == m_WindowFrameCapturers.end())
-	{
+	const FrameCap *cap = snapshot->Find(DeviceWnd(dev, wnd));
+	if(cap == NULL)
 		RDCERR("Couldn't find frame capturer for device %p window %p", dev, wnd);
-		return;
-	}
+	else
+		cap->FrameCapturer->StartFrameCapture(dev, wnd);
 
-	it->second.FrameCapturer->StartFrameCapture(dev, wnd);
+	ReleaseFrameCapturers();
 }
 
 void RenderDoc::SetActiveWindow(void *dev, void *wnd)
 {
 	DeviceWnd dw(dev, wnd);
 
-	auto it = m_WindowFrameCapturers.find(dw);
-	if(it == m_WindowFrameCapturers.end())
+	SCOPED_LOCK(m_FrameCapturerLock);
+
+	if(m_FrameCapturers->Find(dw) == NULL)
 	{
 		RDCERR("Couldn't find frame capturer for device %p window %p", dev, wnd);
 		return;
 	}
 
-	m_ActiveWindow = dw;
+	FrameCapturerSnapshot *snapshot = new FrameCapturerSnapshot(*m_FrameCapturers);
+	snapshot->activeWindow = dw;
+	PublishFrameCapturers(snapshot);
 }
 
 bool RenderDoc::EndFrameCapture(void *dev, void *wnd)
 {
+	const FrameCapturerSnapshot *snapshot = AcquireFrameCapturers();
+
+	bool ret = false;
+
 	if(dev == NULL || wnd == NULL)
 	{
 		// if we have a single window frame capturer, use that in preference
-		if(m_WindowFrameCapturers.size() == 1)
+		if(snapshot->capturers.size() == 1)
 		{
-			auto it = m_WindowFrameCapturers.begin();
-			return it->second.FrameCapturer->EndFrameCapture(it->first.dev, it->first.wnd);
+			const pair<DeviceWnd, FrameCap> &cap = snapshot->capturers[0];
+			ret = cap.second.FrameCapturer->EndFrameCapture(cap.first.dev, cap.first.wnd);
 		}
 		// otherwise, see if we only have one default capturer
 		else if(m_DefaultFrameCapturers.size() == 1)
@@ -379,19 +562,29 @@ bool RenderDoc::EndFrameCapture(void *dev, void *wnd)
 		{
 			RDCERR("Multiple frame capture methods registered, can't capture by NULL handles");
 		}
-		return false;
-	}
 
-	DeviceWnd dw(dev, wnd);
+		ReleaseFrameCapturers();
+		return ret;
+	}
 
-	auto it = m_WindowFrameCapturers.find(dw);
-	if(it == m_WindowFrameCapturers.end())
-	{
+	const FrameCap *cap = snapshot->Find(DeviceWnd(dev, wnd));
+	if(cap == NULL)
 		RDCERR("Couldn't find frame capturer for device %p, window %p", dev, wnd);
+	else
+		ret = cap->FrameCapturer->EndFrameCapture(dev, wnd);
+
+	ReleaseFrameCapturers();
+
+	return ret;
+}
+
+static bool AnyKeyDown(const vector<KeyButton> &keys)
+{
+	if(keys.empty())
 		return false;
-	}
 
-	return it->second.FrameCapturer->EndFrameCapture(dev, wnd);
+	vector<int> codes(keys.begin(), keys.end());
+	return Keyboard::AnyKeyDown(&codes[0], codes.size());
 }
 
 void RenderDoc::Tick()
@@ -399,29 +592,40 @@ void RenderDoc::Tick()
 	static bool prev_focus = false;
 	static bool prev_cap = false;
 
-	bool cur_focus = false;
-	for(size_t i=0; i < m_FocusKeys.size(); i++) cur_focus |= Keyboard::GetKeyState(m_FocusKeys[i]);
+	// polling the keyboard means a round trip to the OS or X server, so at high framerates
+	// only do it every few milliseconds - still far quicker than any keypress
+	static PerformanceTimer keyPollTimer;
+	const double keyPollIntervalMS = 10.0;
+
+	bool cur_focus = prev_focus;
+	bool cur_cap = prev_cap;
 
-	bool cur_cap = false;
-	for(size_t i=0; i < m_CaptureKeys.size(); i++) cur_cap |= Keyboard::GetKeyState(m_CaptureKeys[i]);
+	if(keyPollTimer.GetMilliseconds() >= keyPollIntervalMS)
+	{
+		keyPollTimer.Restart();
+
+		cur_focus = AnyKeyDown(m_FocusKeys);
+		cur_cap = AnyKeyDown(m_CaptureKeys);
+	}
 
 	if(!prev_focus && cur_focus)
 	{
-		m_Cap = false;
+		m_Cap = 0;
+
+		SCOPED_LOCK(m_FrameCapturerLock);
+
+		const vector< pair<DeviceWnd, FrameCap> > &caps = m_FrameCapturers->capturers;
 
 		// can only shift focus if we have multiple windows
-		if(m_WindowFrameCapturers.size() > 1)
+		if(caps.size() > 1)
 		{
-			for(auto it = m_WindowFrameCapturers.begin(); it != m_WindowFrameCapturers.end(); ++it)
+			for(size_t i=0; i < caps.size(); i++)
 			{
-				if(it->first == m_ActiveWindow)
+				if(caps[i].first == m_FrameCapturers->activeWindow)
 				{
-					auto nextit = it; ++nextit;
-
-					if(nextit != m_WindowFrameCapturers.end())
-						m_ActiveWindow = nextit->first;
-					else
-						m_ActiveWindow = m_WindowFrameCapturers.begin()->first;
+					FrameCapturerSnapshot *snapshot = new FrameCapturerSnapshot(*m_FrameCapturers);
+					snapshot->activeWindow = caps[(i+1) % caps.size()].first;
+					PublishFrameCapturers(snapshot);
 
 					break;
 				}
@@ -430,31 +634,221 @@ void RenderDoc::Tick()
 	}
 	if(!prev_cap && cur_cap)
 	{
-		TriggerCapture();
+		// the frame that was on screen when the key was pressed has been recorded already
+		if(m_Options.RetroCapture)
+			SavePreviousFrame();
+		else
+			TriggerCapture();
 	}
 
 	prev_focus = cur_focus;
 	prev_cap = cur_cap;
+
+	TickCaptureTrigger();
 }
 
-bool RenderDoc::ShouldTriggerCapture(uint32_t frameNumber)
+void RenderDoc::SetCaptureTrigger(const CaptureTrigger *trigger)
 {
-	bool ret = m_Cap;
+	SCOPED_LOCK(m_TriggerLock);
+
+	m_TriggerArmed = false;
+	m_TriggerProbeMarkers = false;
+	m_TriggerProbeShaders = false;
+	m_TriggerHit = false;
+
+	if(trigger == NULL)
+	{
+		RDCEraseEl(m_Trigger);
+		m_TriggerMarker = "";
+		return;
+	}
+
+	m_Trigger = *trigger;
+	m_Trigger.NumFrames = RDCMAX(1U, m_Trigger.NumFrames);
+	m_TriggerMarker = trigger->MarkerName ? trigger->MarkerName : "";
+	m_Trigger.MarkerName = NULL;
 
-	m_Cap = false;
+	m_TriggerCaptures = 0;
+	m_TriggerCooldown = 0;
+	m_TriggerNumFrames = 0;
+	m_TriggerAvgDraws = 0.0;
+
+	m_TriggerProbeMarkers = !m_TriggerMarker.empty();
+	m_TriggerProbeShaders = m_Trigger.Shader != 0;
+	m_TriggerArmed = true;
+
+	RDCLOG("Capture trigger armed: frame time %f ms, draw spike %fx, marker '%s', shader %llu",
+	       m_Trigger.FrameTimeMS, m_Trigger.DrawCountSpike, m_TriggerMarker.c_str(), m_Trigger.Shader);
+}
+
+// name isn't necessarily NUL terminated
+static bool MarkerContains(const char *name, size_t len, const string &search)
+{
+	if(search.empty() || search.length() > len)
+		return false;
+
+	for(size_t i=0; i + search.length() <= len; i++)
+		if(!strncmp(name + i, search.c_str(), search.length()))
+			return true;
+
+	return false;
+}
+
+void RenderDoc::ProbeMarker(const char *name, size_t len)
+{
+	if(name == NULL || m_TriggerHit)
+		return;
+
+	SCOPED_LOCK(m_TriggerLock);
+
+	if(MarkerContains(name, len, m_TriggerMarker))
+		m_TriggerHit = true;
+}
+
+void RenderDoc::ProbeMarker(const wchar_t *name)
+{
+	if(name == NULL || m_TriggerHit)
+		return;
+
+	string utf8 = StringFormat::Wide2UTF8(wstring(name));
+	ProbeMarker(utf8.c_str(), utf8.length());
+}
+
+void RenderDoc::SetCaptureRegionMarker(const char *marker)
+{
+	SCOPED_LOCK(m_TriggerLock);
+
+	m_RegionMarker = marker ? marker : "";
+	m_RegionMarkerArmed = !m_RegionMarker.empty();
+
+	if(m_RegionMarkerArmed)
+		RDCLOG("Capturing next marker region containing '%s'", m_RegionMarker.c_str());
+}
+
+bool RenderDoc::MatchRegionMarker(const char *name, size_t len)
+{
+	if(name == NULL || !m_RegionMarkerArmed)
+		return false;
+
+	SCOPED_LOCK(m_TriggerLock);
+
+	// checked again under the lock so only one caller can claim it
+	if(!m_RegionMarkerArmed || !MarkerContains(name, len, m_RegionMarker))
+		return false;
 
-	set<uint32_t> frames;
+	m_RegionMarkerArmed = false;
+	return true;
+}
+
+bool RenderDoc::MatchRegionMarker(const wchar_t *name)
+{
+	if(name == NULL || !m_RegionMarkerArmed)
+		return false;
+
+	string utf8 = StringFormat::Wide2UTF8(wstring(name));
+	return MatchRegionMarker(utf8.c_str(), utf8.length());
+}
+
+void RenderDoc::TickCaptureTrigger()
+{
+	if(!m_TriggerArmed)
+		return;
+
+	FrameStatistics frame;
+
+	{
+		SCOPED_LOCK(m_FrameStatsLock);
+		frame = m_TriggerFrame;
+	}
+
+	SCOPED_LOCK(m_TriggerLock);
+
+	bool probeHit = m_TriggerHit;
+	bool hit = probeHit;
+	m_TriggerHit = false;
+
+	const char *reason = hit ? "marker or shader probe" : "";
+
+	// the statistics for the frame being presented haven't been added yet, so these
+	// conditions are checked against the previous frame
+	if(frame.NumFrames > 0 && frame.LastFrameNumber != m_TriggerCheckedFrame)
+	{
+		m_TriggerCheckedFrame = frame.LastFrameNumber;
+
+		if(m_Trigger.FrameTimeMS > 0.0f && frame.MaxFrameTime > m_Trigger.FrameTimeMS)
+		{
+			hit = true;
+			reason = "frame time";
+		}
+
+		double draws = double(frame.Draws + frame.Dispatches);
+
+		// wait for the average to settle so that loading screens etc don't fire it
+		const uint32_t warmupFrames = 30;
+
+		if(m_Trigger.DrawCountSpike > 0.0f && m_TriggerNumFrames >= warmupFrames &&
+		   draws > m_TriggerAvgDraws*m_Trigger.DrawCountSpike)
+		{
+			hit = true;
+			reason = "draw count";
+		}
+
+		if(m_TriggerNumFrames == 0)
+			m_TriggerAvgDraws = draws;
+		else
+			m_TriggerAvgDraws = m_TriggerAvgDraws*0.9 + draws*0.1;
+
+		m_TriggerNumFrames++;
+	}
+
+	if(m_TriggerCooldown > 0)
+	{
+		m_TriggerCooldown--;
+		return;
+	}
+
+	if(!hit || m_Cap > 0)
+		return;
+
+	RDCLOG("Capture trigger fired on %s after frame %u", reason, frame.LastFrameNumber);
+
+	// a probe hit was in the frame being presented now, which retro capture can still save
+	if(m_Options.RetroCapture && probeHit)
+		SavePreviousFrame();
+	else
+		TriggerCapture(m_Trigger.NumFrames);
+
+	m_TriggerCaptures++;
+	// Tick only happens while idle, so the cooldown counts from the end of the capture
+	m_TriggerCooldown = m_Trigger.CooldownFrames;
+
+	if(m_Trigger.MaxCaptures > 0 && m_TriggerCaptures >= m_Trigger.MaxCaptures)
+	{
+		RDCLOG("Capture trigger disarmed after %u captures", m_TriggerCaptures);
+		m_TriggerArmed = false;
+		m_TriggerProbeMarkers = false;
+		m_TriggerProbeShaders = false;
+	}
+}
+
+uint32_t RenderDoc::ShouldTriggerCapture(uint32_t frameNumber)
+{
+	uint32_t ret = m_Cap;
+
+	m_Cap = 0;
+
+	map<uint32_t, uint32_t> frames;
 	frames.swap(m_QueuedFrameCaptures);
 	for(auto it=frames.begin(); it != frames.end(); ++it)
 	{
-		if(*it < frameNumber)
+		if(it->first < frameNumber)
 		{
 			// discard, this frame is past.
 		}
-		else if((*it) - 1 == frameNumber)
+		else if(it->first - 1 == frameNumber)
 		{
-			// we want to capture the next frame
-			ret = true;
+			// we want to capture from the next frame
+			ret = RDCMAX(ret, it->second);
 		}
 		else
 		{
@@ -466,7 +860,7 @@ bool RenderDoc::ShouldTriggerCapture(uint32_t frameNumber)
 	return ret;
 }
 
-Serialiser *RenderDoc::OpenWriteSerialiser(uint32_t frameNum, RDCInitParams *params, void *thpixels, size_t thlen, uint32_t thwidth, uint32_t thheight)
+Serialiser *RenderDoc::OpenWriteSerialiser(uint32_t frameNum, RDCInitParams *params)
 {
 	RDCASSERT(m_CurrentDriver != RDC_Unknown);
 
@@ -479,26 +873,13 @@ Serialiser *RenderDoc::OpenWriteSerialiser(uint32_t frameNum, RDCInitParams *par
 	m_CurrentLogFile = StringFormat::Fmt("%s_frame%u.rdc", m_LogFile.c_str(), frameNum);
 
 	Serialiser *fileSerialiser = new Serialiser(m_CurrentLogFile.c_str(), Serialiser::WRITING, debugSerialiser);
+
+	fileSerialiser->SetCompressed(m_Options.CompressCaptures != 0);
 	
 	
 	Serialiser *chunkSerialiser = new Serialiser(NULL, Serialiser::WRITING, debugSerialiser);
 
-	{
-		ScopedContext scope(chunkSerialiser, NULL, "Thumbnail", THUMBNAIL_DATA, false);
-
-		bool HasThumbnail = (thpixels != NULL && thwidth > 0 && thheight > 0);
-		chunkSerialiser->Serialise("HasThumbnail", HasThumbnail);
-
-		if(HasThumbnail)
-		{
-			byte *buf = (byte *)thpixels;
-			chunkSerialiser->Serialise("ThumbWidth", thwidth);
-			chunkSerialiser->Serialise("ThumbHeight", thheight);
-			chunkSerialiser->SerialiseBuffer("ThumbnailPixels", buf, thlen);
-		}
-
-		fileSerialiser->Insert(scope.Get(true));
-	}
+	// the thumbnail chunk goes first, but isn't inserted until the capture is written
 
 	{
 		ScopedContext scope(chunkSerialiser, NULL, "Capture Create Parameters", CREATE_PARAMS, false);
@@ -522,6 +903,24 @@ Serialiser *RenderDoc::OpenWriteSerialiser(uint32_t frameNum, RDCInitParams *par
 	return fileSerialiser;
 }
 
+ChunkSpillWriter *RenderDoc::OpenSpillWriter(uint32_t frameNum)
+{
+	if(!m_Options.SpillChunksToDisk)
+		return NULL;
+
+	string filename = StringFormat::Fmt("%s_frame%u.rdcspill", m_LogFile.c_str(), frameNum);
+
+	uint64_t highWaterMark = uint64_t(RDCMAX(m_Options.SpillHighWaterMark, 1U))*1024*1024;
+
+	ChunkSpillWriter *spill = new ChunkSpillWriter(filename.c_str(), highWaterMark);
+
+	// fall back to keeping chunks in memory
+	if(spill->HasError())
+		SAFE_DELETE(spill);
+
+	return spill;
+}
+
 ReplayCreateStatus RenderDoc::FillInitParams(const char *logFile, RDCDriver &driverType, string &driverName, RDCInitParams *params)
 {
 	Serialiser ser(logFile, Serialiser::READING, true);
@@ -564,6 +963,9 @@ ReplayCreateStatus RenderDoc::FillInitParams(const char *logFile, RDCDriver &dri
 
 		return eReplayCreate_InternalError;
 	}
+
+	// initial contents stored as deltas can't be replayed without the logs they're based on
+	string missingBase = FindMissingInitialDataBase(&ser);
 	
 	ser.Rewind();
 
@@ -601,6 +1003,12 @@ ReplayCreateStatus RenderDoc::FillInitParams(const char *logFile, RDCDriver &dri
 			return eReplayCreate_FileCorrupted;
 		}
 
+		if(!missingBase.empty())
+		{
+			RDCERR("Logfile '%s' stores initial contents as changes to '%s', which can't be found", logFile, missingBase.c_str());
+			return eReplayCreate_FileMissingDependency;
+		}
+
 		if(params)
 		{
 			params->m_State = READING;
@@ -732,6 +1140,47 @@ void RenderDoc::SetCaptureOptions(const CaptureOptions *opts)
 	m_Options = *opts;
 }
 
+void RenderDoc::SetCallstackFilter(const char *filter)
+{
+	SCOPED_LOCK(m_CallstackFilterLock);
+
+	vector<string> entries;
+	split(string(filter ? filter : ""), entries, ',');
+
+	m_CallstackFilter.clear();
+	for(size_t i=0; i < entries.size(); i++)
+		if(!entries[i].empty())
+			m_CallstackFilter.push_back(entries[i]);
+}
+
+bool RenderDoc::ShouldCollectCallstack(const char *name)
+{
+	{
+		SCOPED_LOCK(m_CallstackFilterLock);
+
+		if(!m_CallstackFilter.empty())
+		{
+			if(name == NULL)
+				return false;
+
+			bool match = false;
+			for(size_t i=0; !match && i < m_CallstackFilter.size(); i++)
+				match = strstr(name, m_CallstackFilter[i].c_str()) != NULL;
+
+			if(!match)
+				return false;
+		}
+	}
+
+	uint32_t rate = m_Options.CallstackSampleRate;
+	if(rate <= 1)
+		return true;
+
+	// only events that passed the filter count towards the sample rate
+	uint32_t idx = (uint32_t)Atomic::Inc32(&m_CallstackSampleCounter);
+	return (idx % rate) == 0;
+}
+
 void RenderDoc::SetLogFile(const char *logFile)
 {
 	m_LogFile = logFile;
@@ -762,11 +1211,153 @@ void RenderDoc::SetProgress(LoadProgressSection section, float delta)
 	*m_ProgressPtr = progress;
 }
 
-void RenderDoc::SuccessfullyWrittenLog()
+uint64_t RenderDoc::WriteCapture(Serialiser *fileSerialiser, ChunkSpillWriter *spill, byte *thpixels, uint32_t thwidth, uint32_t thheight)
+{
+	PendingCaptureWrite write;
+	write.ser = fileSerialiser;
+	write.spill = spill;
+	write.thpixels = thpixels;
+	write.thwidth = thwidth;
+	write.thheight = thheight;
+	write.path = m_CurrentLogFile;
+
+	if(!m_Options.AsyncCaptureWrites)
+		return FlushCaptureWrite(write);
+
+	// chunks owned by resource records may be freed or replaced as soon as the
+	// application continues, so the serialiser needs its own copies.
+	fileSerialiser->TakeOwnershipOfChunks();
+
+	{
+		SCOPED_LOCK(m_CaptureWriteLock);
+		m_PendingCaptureWrites.push_back(write);
+	}
+
+	if(m_CaptureWriteThread == 0)
+	{
+		m_CaptureWriteThreadShutdown = false;
+		m_CaptureWriteThread = Threading::CreateThread(CaptureWriteThread, (void *)this);
+
+		if(m_CaptureWriteThread == 0)
+		{
+			RDCERR("Couldn't start capture write thread, writing capture immediately");
+
+			SCOPED_LOCK(m_CaptureWriteLock);
+			for(size_t i=0; i < m_PendingCaptureWrites.size(); i++)
+				FlushCaptureWrite(m_PendingCaptureWrites[i]);
+			m_PendingCaptureWrites.clear();
+		}
+	}
+
+	RDCLOG("Handed off capture %s to be written in the background", write.path.c_str());
+
+	return 0;
+}
+
+static Chunk *MakeThumbnailChunk(byte *thpixels, uint32_t thwidth, uint32_t thheight)
+{
+#if defined(RELEASE)
+	const bool debugSerialiser = false;
+#else
+	const bool debugSerialiser = true;
+#endif
+
+	byte *jpgbuf = NULL;
+	int len = thwidth*thheight;
+
+	if(thpixels && len > 0)
+	{
+		jpgbuf = new byte[len];
+
+		jpge::params p;
+
+		p.m_quality = 40;
+
+		bool success = jpge::compress_image_to_jpeg_file_in_memory(jpgbuf, len, thwidth, thheight, 3, thpixels, p);
+
+		if(!success)
+		{
+			RDCERR("Failed to compress to jpg");
+			SAFE_DELETE_ARRAY(jpgbuf);
+		}
+	}
+
+	Serialiser chunkSerialiser(NULL, Serialiser::WRITING, debugSerialiser);
+
+	ScopedContext scope(&chunkSerialiser, NULL, "Thumbnail", THUMBNAIL_DATA, false);
+
+	bool HasThumbnail = (jpgbuf != NULL);
+	chunkSerialiser.Serialise("HasThumbnail", HasThumbnail);
+
+	if(HasThumbnail)
+	{
+		size_t thlen = (size_t)len;
+		chunkSerialiser.Serialise("ThumbWidth", thwidth);
+		chunkSerialiser.Serialise("ThumbHeight", thheight);
+		chunkSerialiser.SerialiseBuffer("ThumbnailPixels", jpgbuf, thlen);
+	}
+
+	Chunk *ret = scope.Get(true);
+
+	SAFE_DELETE_ARRAY(jpgbuf);
+
+	return ret;
+}
+
+uint64_t RenderDoc::FlushCaptureWrite(PendingCaptureWrite &write)
+{
+	// compressing the thumbnail is left until now so that it's on the write thread
+	write.ser->InsertFirst(MakeThumbnailChunk(write.thpixels, write.thwidth, write.thheight));
+	SAFE_DELETE_ARRAY(write.thpixels);
+
+	write.ser->SetSpilledChunks(write.spill);
+
+	uint64_t size = write.ser->FlushToDisk();
+
+	SAFE_DELETE(write.ser);
+	SAFE_DELETE(write.spill);
+
+	SuccessfullyWrittenLog(write.path);
+
+	return size;
+}
+
+void RenderDoc::CaptureWriteThread(void *s)
+{
+	RenderDoc *rdoc = (RenderDoc *)s;
+
+	while(true)
+	{
+		// check this before taking the queue so that no capture handed off before
+		// shutdown is missed.
+		bool shutdown = rdoc->m_CaptureWriteThreadShutdown;
+
+		vector<PendingCaptureWrite> writes;
+
+		{
+			SCOPED_LOCK(rdoc->m_CaptureWriteLock);
+			writes.swap(rdoc->m_PendingCaptureWrites);
+		}
+
+		if(writes.empty())
+		{
+			if(shutdown)
+				break;
+
+			Threading::Sleep(5);
+			continue;
+		}
+
+		for(size_t i=0; i < writes.size(); i++)
+			rdoc->FlushCaptureWrite(writes[i]);
+	}
+}
+
+void RenderDoc::SuccessfullyWrittenLog(const string &path)
 {
-	RDCLOG("Written to disk: %s", m_CurrentLogFile.c_str());	
+	RDCLOG("Written to disk: %s", path.c_str());	
 
-	CaptureData cap(m_CurrentLogFile, Timing::GetUnixTimestamp());
+	CaptureData cap(path, Timing::GetUnixTimestamp());
 	{
 		SCOPED_LOCK(m_CaptureLock);
 		m_Captures.push_back(cap);
@@ -775,14 +1366,81 @@ void RenderDoc::SuccessfullyWrittenLog()
 
 void RenderDoc::AddDefaultFrameCapturer(IFrameCapturer *cap)
 {
+	SCOPED_LOCK(m_DefaultFrameCapturerLock);
 	m_DefaultFrameCapturers.insert(cap);
 }
 
 void RenderDoc::RemoveDefaultFrameCapturer(IFrameCapturer *cap)
 {
+	SCOPED_LOCK(m_DefaultFrameCapturerLock);
 	m_DefaultFrameCapturers.erase(cap);
 }
 
+vector<ResourceMemoryUsage> RenderDoc::GetResourceMemoryUsage()
+{
+	vector<ResourceMemoryUsage> ret;
+
+	// every capturing device is registered as a default capturer, whether or not it has
+	// any windows, so this covers everything.
+	SCOPED_LOCK(m_DefaultFrameCapturerLock);
+	for(auto it=m_DefaultFrameCapturers.begin(); it != m_DefaultFrameCapturers.end(); ++it)
+		(*it)->GetResourceMemoryUsage(ret);
+
+	return ret;
+}
+
+vector<ChunkMemoryUsage> RenderDoc::GetChunkMemoryUsage()
+{
+	vector<ChunkMemoryUsage> ret;
+
+	for(uint32_t type=0; type <= Chunk::MaxTrackedChunkType; type++)
+	{
+		ChunkMemoryUsage usage;
+		usage.ChunkType = type;
+		usage.NumChunks = (uint32_t)Chunk::NumLiveChunks(type);
+		usage.Bytes = Chunk::TotalMem(type);
+
+		if(usage.NumChunks > 0)
+			ret.push_back(usage);
+	}
+
+	return ret;
+}
+
+void RenderDoc::AddFrameStatistics(const FrameStatistics &frame)
+{
+	SCOPED_LOCK(m_FrameStatsLock);
+
+	m_FrameStats.NumFrames += frame.NumFrames;
+	m_FrameStats.LastFrameNumber = frame.LastFrameNumber;
+	m_FrameStats.TotalFrameTime += frame.TotalFrameTime;
+	m_FrameStats.MaxFrameTime = RDCMAX(m_FrameStats.MaxFrameTime, frame.MaxFrameTime);
+	m_FrameStats.APICalls += frame.APICalls;
+	m_FrameStats.Draws += frame.Draws;
+	m_FrameStats.Dispatches += frame.Dispatches;
+	m_FrameStats.Maps += frame.Maps;
+	m_FrameStats.BytesMapped += frame.BytesMapped;
+
+	m_TriggerFrame = frame;
+}
+
+FrameStatistics RenderDoc::TakeFrameStatistics()
+{
+	FrameStatistics ret;
+
+	{
+		SCOPED_LOCK(m_FrameStatsLock);
+		ret = m_FrameStats;
+		RDCEraseEl(m_FrameStats);
+	}
+
+	ret.CaptureChunkBytes = 0;
+	for(uint32_t type=0; type <= Chunk::MaxTrackedChunkType; type++)
+		ret.CaptureChunkBytes += Chunk::TotalMem(type);
+
+	return ret;
+}
+
 void RenderDoc::AddFrameCapturer(void *dev, void *wnd, IFrameCapturer *cap)
 {
 	if(dev == NULL || wnd == NULL || cap == NULL)
@@ -792,49 +1450,66 @@ void RenderDoc::AddFrameCapturer(void *dev, void *wnd, IFrameCapturer *cap)
 	}
 
 	DeviceWnd dw(dev, wnd);
+
+	SCOPED_LOCK(m_FrameCapturerLock);
+
+	FrameCapturerSnapshot *snapshot = new FrameCapturerSnapshot(*m_FrameCapturers);
 	
-	auto it = m_WindowFrameCapturers.find(dw);
-	if(it != m_WindowFrameCapturers.end())
+	FrameCap *existing = snapshot->Find(dw);
+	if(existing)
 	{
-		if(it->second.FrameCapturer != cap)
+		if(existing->FrameCapturer != cap)
 			RDCERR("New different FrameCapturer being registered for known window!");
 
-		it->second.RefCount++;
+		existing->RefCount++;
 	}
 	else
 	{
-		m_WindowFrameCapturers[dw].FrameCapturer = cap;
+		FrameCap fc;
+		fc.FrameCapturer = cap;
+
+		vector< pair<DeviceWnd, FrameCap> > &caps = snapshot->capturers;
+		caps.insert(std::lower_bound(caps.begin(), caps.end(), dw, FrameCapturerSnapshot::Less), std::make_pair(dw, fc));
 	}
 
 	// the first one we see becomes the default
-	if(m_ActiveWindow == DeviceWnd())
-		m_ActiveWindow = dw;
+	if(snapshot->activeWindow == DeviceWnd())
+		snapshot->activeWindow = dw;
+
+	PublishFrameCapturers(snapshot);
 }
 
 void RenderDoc::RemoveFrameCapturer(void *dev, void *wnd)
 {
 	DeviceWnd dw(dev, wnd);
+
+	SCOPED_LOCK(m_FrameCapturerLock);
 	
-	auto it = m_WindowFrameCapturers.find(dw);
-	if(it != m_WindowFrameCapturers.end())
+	if(m_FrameCapturers->Find(dw) == NULL)
 	{
-		it->second.RefCount--;
+		RDCERR("Removing FrameCapturer for unknown window!");
+		return;
+	}
 
-		if(it->second.RefCount <= 0)
-		{
-			if(m_ActiveWindow == dw)
-			{
-				if(m_WindowFrameCapturers.size() == 1)
-					m_ActiveWindow = DeviceWnd();
-				else
-					m_ActiveWindow = m_WindowFrameCapturers.begin()->first;
-			}
+	FrameCapturerSnapshot *snapshot = new FrameCapturerSnapshot(*m_FrameCapturers);
 
-			m_WindowFrameCapturers.erase(it);
-		}
-	}
-	else
+	vector< pair<DeviceWnd, FrameCap> > &caps = snapshot->capturers;
+	auto it = std::lower_bound(caps.begin(), caps.end(), dw, FrameCapturerSnapshot::Less);
+
+	it->second.RefCount--;
+
+	if(it->second.RefCount <= 0)
 	{
-		RDCERR("Removing FrameCapturer for unknown window!");
+		caps.erase(it);
+
+		if(snapshot->activeWindow == dw)
+		{
+			if(caps.empty())
+				snapshot->activeWindow = DeviceWnd();
+			else
+				snapshot->activeWindow = caps[0].first;
+		}
 	}
+
+	PublishFrameCapturers(snapshot);
 }
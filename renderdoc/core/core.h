@@ -40,6 +40,7 @@ using std::set;
 
 class Serialiser;
 class Chunk;
+class ChunkSpillWriter;
 
 #include "api/app/renderdoc_app.h"
 #include "api/replay/replay_enums.h"
@@ -64,6 +65,9 @@ struct IFrameCapturer
 {
 	virtual void StartFrameCapture(void *dev, void *wnd) = 0;
 	virtual bool EndFrameCapture(void *dev, void *wnd) = 0;
+
+	// append the capture memory held for each resource. May be called from any thread
+	virtual void GetResourceMemoryUsage(vector<ResourceMemoryUsage> &usage) = 0;
 };
 
 enum LogState
@@ -84,6 +88,10 @@ enum SystemChunks
 	INITIAL_CONTENTS,
 
 	FIRST_CHUNK_ID,
+
+	// written by the resource manager rather than a driver. Kept well above any driver's
+	// chunks so that adding system chunks doesn't renumber them
+	INITIAL_CONTENTS_DATA = 0x3000,
 };
 
 enum RDCDriver
@@ -117,6 +125,11 @@ enum ReplayLogType
 	eReplay_Full,
 	eReplay_WithoutDraw,
 	eReplay_OnlyDraw,
+
+	// the same as eReplay_WithoutDraw, but if the previous replay was one of these to an
+	// earlier event followed by its eReplay_OnlyDraw, and nothing else has replayed since,
+	// only the events after that draw are executed. Used when stepping through the frame.
+	eReplay_WithoutDrawIncremental,
 };
 
 struct RDCInitParams
@@ -173,20 +186,61 @@ class RenderDoc
 		void Initialise();
 		void Shutdown();
 
+		// in bootstrap mode Initialise() only sets up logging, and the crash handler, remote
+		// access server, callstack and keyboard handling are deferred until EnsureInitialised()
+		// is called when the first device or context is created. This is for processes we're
+		// injected into wholesale (global hook, child processes) that may never render.
+		void SetBootstrap(bool bootstrap) { m_Bootstrap = bootstrap; }
+		void EnsureInitialised();
+
+		// with a lazy crash handler, it isn't created when initialising but by
+		// EnsureCrashHandler() once a device or context is wrapped. Saves starting the out of
+		// process handler in every process we're loaded into when most never capture.
+		void SetLazyCrashHandler(bool lazy) { m_LazyCrashHandler = lazy; }
+		void EnsureCrashHandler();
+
+		// starts the remote access server if it isn't already running, even when bootstrapped
+		void EnsureRemoteAccess();
+
 		void SetReplayApp(bool replay) { m_Replay = replay; }
 		bool IsReplayApp() const { return m_Replay; }
 
+		// headless replays never display anything, so replay devices created while this is set
+		// only create their debug rendering shaders and resources when something first needs them
+		void SetHeadlessReplay(bool headless) { m_HeadlessReplay = headless; }
+		bool IsHeadlessReplay() const { return m_HeadlessReplay; }
+
+		// index of the adapter replay devices should be created on, or ~0U for the default
+		void SetReplayAdapter(uint32_t adapterIndex) { m_ReplayAdapter = adapterIndex; }
+		uint32_t GetReplayAdapter() const { return m_ReplayAdapter; }
+
 		void BecomeReplayHost(volatile bool32 &killReplay);
 
 		void SetCaptureOptions(const CaptureOptions *opts);
 		const CaptureOptions &GetCaptureOptions() const { return m_Options; }
 
+		// comma-separated substrings of event names to collect callstacks for
+		void SetCallstackFilter(const char *filter);
+
+		// whether the top-level event 'name' being written should collect a callstack,
+		// according to the callstack filter and the sample rate in the capture options.
+		// Doesn't check CaptureCallstacks itself.
+		bool ShouldCollectCallstack(const char *name);
+
 		void RecreateCrashHandler();
 		void UnloadCrashHandler();
 		ICrashHandler *GetCrashHandler() const { return m_ExHandler; }
 
-		Serialiser *OpenWriteSerialiser(uint32_t frameNum, RDCInitParams *params, void *thpixels, size_t thlen, uint32_t thwidth, uint32_t thheight);
-		void SuccessfullyWrittenLog();
+		Serialiser *OpenWriteSerialiser(uint32_t frameNum, RDCInitParams *params);
+		ChunkSpillWriter *OpenSpillWriter(uint32_t frameNum);
+
+		// writes out the capture opened by the last OpenWriteSerialiser, taking ownership
+		// of the serialiser, spill writer and thumbnail pixels (either of which may be NULL).
+		// The thumbnail is tightly packed RGB8, top row first, allocated with new[]. It's
+		// compressed as part of the write. If the capture options ask for it, this only
+		// hands everything to a background thread and returns 0, otherwise it returns the
+		// size written.
+		uint64_t WriteCapture(Serialiser *fileSerialiser, ChunkSpillWriter *spill, byte *thpixels, uint32_t thwidth, uint32_t thheight);
 
 		void AddChildProcess(uint32_t pid, uint32_t ident)
 		{
@@ -247,14 +301,24 @@ class RenderDoc
 		void SetActiveWindow(void *dev, void *wnd);
 		bool EndFrameCapture(void *dev, void *wnd);
 
-		bool IsActiveWindow(void *dev, void *wnd) { return dev == m_ActiveWindow.dev && wnd == m_ActiveWindow.wnd; }
+		bool IsActiveWindow(void *dev, void *wnd);
+
+		vector<ResourceMemoryUsage> GetResourceMemoryUsage();
+		vector<ChunkMemoryUsage> GetChunkMemoryUsage();
+
+		// drivers report each frame's statistics at present, and the remote access thread
+		// periodically takes what's been gathered since it last looked
+		void AddFrameStatistics(const FrameStatistics &frame);
+		FrameStatistics TakeFrameStatistics();
 
-		void TriggerCapture() { m_Cap = true; }
+		// numFrames consecutive frames are captured into one log, with a single set of
+		// initial contents before the first.
+		void TriggerCapture(uint32_t numFrames = 1) { m_Cap = RDCMAX(1U, numFrames); }
 
 		uint32_t GetOverlayBits() { return m_Overlay; }
 		void MaskOverlayBits(uint32_t And, uint32_t Or) { m_Overlay = (m_Overlay & And) | Or; }
 
-		void QueueCapture(uint32_t frameNumber) { m_QueuedFrameCaptures.insert(frameNumber); }
+		void QueueCapture(uint32_t frameNumber, uint32_t numFrames = 1) { m_QueuedFrameCaptures[frameNumber] = RDCMAX(1U, numFrames); }
 
 		void SetFocusKeys(KeyButton *keys, int num)
 		{
@@ -272,7 +336,32 @@ class RenderDoc
 		const vector<KeyButton> &GetFocusKeys() { return m_FocusKeys; }
 		const vector<KeyButton> &GetCaptureKeys() { return m_CaptureKeys; }
 
-		bool ShouldTriggerCapture(uint32_t frameNumber);
+		// returns how many frames to capture starting with the next one, or 0 for none
+		uint32_t ShouldTriggerCapture(uint32_t frameNumber);
+
+		// with the RetroCapture option, the frame being recorded is saved when it's presented
+		// rather than thrown away
+		void SavePreviousFrame() { m_SavePreviousFrame = true; }
+		bool ShouldSavePreviousFrame() { bool ret = m_SavePreviousFrame; m_SavePreviousFrame = false; return ret; }
+
+		// NULL disarms the trigger
+		void SetCaptureTrigger(const CaptureTrigger *trigger);
+
+		// in-frame probes for the capture trigger's marker and shader conditions. Drivers
+		// check the inline flag first so that nothing else is done unless they're needed.
+		bool ProbeMarkers() const { return m_TriggerProbeMarkers; }
+		bool ProbeShaders() const { return m_TriggerProbeShaders; }
+		void ProbeMarker(const char *name, size_t len);
+		void ProbeMarker(const wchar_t *name);
+		void ProbeShader(uint64_t shader) { if(shader == m_Trigger.Shader) m_TriggerHit = true; }
+
+		// partial frame capture of a marker region. Drivers check the inline flag when a
+		// marker region is pushed, and if the name matches (which disarms it) capture from
+		// just before the push to just after its matching pop.
+		void SetCaptureRegionMarker(const char *marker);
+		bool ProbeRegionMarkers() const { return m_RegionMarkerArmed; }
+		bool MatchRegionMarker(const char *name, size_t len);
+		bool MatchRegionMarker(const wchar_t *name);
 	private:
 		RenderDoc();
 		~RenderDoc();
@@ -280,8 +369,10 @@ class RenderDoc
 		static RenderDoc *m_Inst;
 
 		bool m_Replay;
+		bool m_HeadlessReplay;
+		uint32_t m_ReplayAdapter;
 
-		bool m_Cap;
+		uint32_t m_Cap;
 
 		vector<KeyButton> m_FocusKeys;
 		vector<KeyButton> m_CaptureKeys;
@@ -294,11 +385,45 @@ class RenderDoc
 		CaptureOptions m_Options;
 		uint32_t m_Overlay;
 
-		set<uint32_t> m_QueuedFrameCaptures;
+		Threading::CriticalSection m_CallstackFilterLock;
+		vector<string> m_CallstackFilter;
+		volatile int32_t m_CallstackSampleCounter;
+
+		// frame number to number of frames to capture from there
+		map<uint32_t, uint32_t> m_QueuedFrameCaptures;
+
+		volatile bool m_SavePreviousFrame;
+
+		Threading::CriticalSection m_TriggerLock;
+		CaptureTrigger m_Trigger;
+		string m_TriggerMarker;
+		volatile bool m_TriggerArmed;
+		volatile bool m_TriggerProbeMarkers;
+		volatile bool m_TriggerProbeShaders;
+		// set by the probes during a frame, checked and cleared once a frame by Tick
+		volatile bool m_TriggerHit;
+		uint32_t m_TriggerCaptures;
+		uint32_t m_TriggerCooldown;
+		// the last single frame reported by a driver, and the last one checked
+		FrameStatistics m_TriggerFrame;
+		uint32_t m_TriggerCheckedFrame;
+		uint32_t m_TriggerNumFrames;
+		double m_TriggerAvgDraws;
+
+		void TickCaptureTrigger();
+
+		string m_RegionMarker;
+		volatile bool m_RegionMarkerArmed;
 
 		uint32_t m_RemoteIdent;
 		Threading::ThreadHandle m_RemoteThread;
 
+		bool m_Bootstrap;
+		bool m_LazyCrashHandler;
+		volatile bool m_CrashHandlerCreated;
+		volatile bool m_Initialised;
+		Threading::CriticalSection m_InitLock;
+
 		int32_t m_MarkerIndentLevel;
 		RDCDriver m_CurrentDriver;
 		string m_CurrentDriverName;
@@ -340,10 +465,44 @@ class RenderDoc
 			}
 		};
 
-		map<DeviceWnd, FrameCap> m_WindowFrameCapturers;
-		DeviceWnd m_ActiveWindow;
+		// window frame capturers are looked up on every present from any thread, but only change
+		// as windows come and go. So they're kept in immutable snapshots: changes copy the current
+		// snapshot under m_FrameCapturerLock and publish the copy, and lookups just read whichever
+		// snapshot is current without locking.
+		struct FrameCapturerSnapshot
+		{
+			// sorted by DeviceWnd
+			vector< pair<DeviceWnd, FrameCap> > capturers;
+			DeviceWnd activeWindow;
+
+			const FrameCap *Find(const DeviceWnd &dw) const;
+			FrameCap *Find(const DeviceWnd &dw);
+
+			static bool Less(const pair<DeviceWnd, FrameCap> &a, const DeviceWnd &b);
+		};
+
+		FrameCapturerSnapshot *volatile m_FrameCapturers;
+		// readers currently holding a snapshot. Replaced snapshots are only freed once a publish
+		// sees this at 0, since any reader starting after the publish gets the new snapshot.
+		volatile int64_t m_FrameCapturerReaders;
+		vector<FrameCapturerSnapshot *> m_RetiredFrameCapturers;
+		Threading::CriticalSection m_FrameCapturerLock;
+
+		// Acquire must be paired with Release once the snapshot is no longer used
+		const FrameCapturerSnapshot *AcquireFrameCapturers();
+		void ReleaseFrameCapturers();
+		// with m_FrameCapturerLock held, replaces the current snapshot
+		void PublishFrameCapturers(FrameCapturerSnapshot *snapshot);
+
 		set<IFrameCapturer *> m_DefaultFrameCapturers;
 
+		// only needed to protect m_DefaultFrameCapturers from the remote access thread
+		// querying memory usage while devices come and go
+		Threading::CriticalSection m_DefaultFrameCapturerLock;
+
+		Threading::CriticalSection m_FrameStatsLock;
+		FrameStatistics m_FrameStats;
+
 		volatile bool m_RemoteServerThreadShutdown;
 		volatile bool m_RemoteClientThreadShutdown;
 		Threading::CriticalSection m_SingleClientLock;
@@ -352,6 +511,25 @@ class RenderDoc
 		static void RemoteAccessServerThread(void *s);
 		static void RemoteAccessClientThread(void *s);
 
+		struct PendingCaptureWrite
+		{
+			PendingCaptureWrite() : ser(NULL), spill(NULL), thpixels(NULL), thwidth(0), thheight(0) {}
+			Serialiser *ser;
+			ChunkSpillWriter *spill;
+			byte *thpixels;
+			uint32_t thwidth, thheight;
+			string path;
+		};
+
+		Threading::CriticalSection m_CaptureWriteLock;
+		vector<PendingCaptureWrite> m_PendingCaptureWrites;
+		Threading::ThreadHandle m_CaptureWriteThread;
+		volatile bool m_CaptureWriteThreadShutdown;
+
+		static void CaptureWriteThread(void *s);
+		uint64_t FlushCaptureWrite(PendingCaptureWrite &write);
+		void SuccessfullyWrittenLog(const string &path);
+
 		ICrashHandler *m_ExHandler;
 };
 
@@ -122,7 +122,7 @@ class CrashHandler : public ICrashHandler
 
 			_CrtSetReportMode(_CRT_ASSERT, 0);
 			m_ExHandler = new google_breakpad::ExceptionHandler(dumpFolder.c_str(),
-				NULL,
+				&FlushLogBeforeDump,
 				NULL,
 				NULL,
 				google_breakpad::ExceptionHandler::HANDLER_ALL,
@@ -162,6 +162,13 @@ class CrashHandler : public ICrashHandler
 		}
 
 	private:
+		// the log is written out on a background thread, so make sure the dump's logfile is complete
+		static bool FlushLogBeforeDump(void *context, EXCEPTION_POINTERS *exinfo, MDRawAssertionInfo *assertion)
+		{
+			RDCLOGCRASHFLUSH();
+			return true;
+		}
+
 		google_breakpad::ExceptionHandler *m_ExHandler;
 };
 
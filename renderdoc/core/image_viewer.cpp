@@ -34,7 +34,7 @@ class ImageViewer : public IReplayDriver
 {
 	public:
 		ImageViewer(IReplayDriver *proxy, const char *filename, ResourceId texID)
-			: m_Proxy(proxy)
+			: m_Proxy(proxy), m_TexID(texID), m_MapBase(NULL), m_MapSize(0), m_DDS(), m_NumUploaded(0)
 		{
 			if(m_Proxy == NULL) RDCERR("Unexpectedly NULL proxy at creation of ImageViewer");
 
@@ -63,11 +63,26 @@ class ImageViewer : public IReplayDriver
 
 		virtual ~ImageViewer()
 		{
+			FreeMapping();
+
 			m_Proxy->Shutdown();
 			m_Proxy = NULL;
 		}
 
+		// takes ownership of a mapped dds file. Rather than reading and uploading every
+		// subresource up front, each is uploaded straight from the mapping the first time
+		// it's used.
+		void StreamFromMapping(byte *mapBase, uint64_t mapSize, dds_data data)
+		{
+			m_MapBase = mapBase;
+			m_MapSize = mapSize;
+			m_DDS = data;
+			m_Uploaded.resize(data.slices*data.mips, false);
+			m_NumUploaded = 0;
+		}
+
 		bool IsRemoteProxy() { return true; }
+		uint64_t GetReplayDeviceHash() { return 0; }
 		void Shutdown() { delete this; }
 
 		// pass through necessary operations to proxy
@@ -83,20 +98,28 @@ class ImageViewer : public IReplayDriver
 		void RenderCheckerboard(Vec3f light, Vec3f dark) { m_Proxy->RenderCheckerboard(light, dark); }
 		void RenderHighlightBox(float w, float h, float scale) { m_Proxy->RenderHighlightBox(w, h, scale); }
 		bool GetMinMax(ResourceId texid, uint32_t sliceFace, uint32_t mip, uint32_t sample, float *minval, float *maxval) 
-		{ return m_Proxy->GetMinMax(texid, sliceFace, mip, sample, minval, maxval); }
+		{ EnsureUploaded(texid, sliceFace, mip); return m_Proxy->GetMinMax(texid, sliceFace, mip, sample, minval, maxval); }
 		bool GetHistogram(ResourceId texid, uint32_t sliceFace, uint32_t mip, uint32_t sample, float minval, float maxval, bool channels[4], vector<uint32_t> &histogram)
-		{ return m_Proxy->GetHistogram(texid, sliceFace, mip, sample, minval, maxval, channels, histogram); }
-		bool RenderTexture(TextureDisplay cfg) { return m_Proxy->RenderTexture(cfg); }
+		{ EnsureUploaded(texid, sliceFace, mip); return m_Proxy->GetHistogram(texid, sliceFace, mip, sample, minval, maxval, channels, histogram); }
+		bool RenderTexture(TextureDisplay cfg) { EnsureUploaded(cfg.texid, cfg.sliceFace, cfg.mip); return m_Proxy->RenderTexture(cfg); }
 		void PickPixel(ResourceId texture, uint32_t x, uint32_t y, uint32_t sliceFace, uint32_t mip, uint32_t sample, float pixel[4])
-		{ m_Proxy->PickPixel(texture, x, y, sliceFace, mip, sample, pixel); }
+		{ EnsureUploaded(texture, sliceFace, mip); m_Proxy->PickPixel(texture, x, y, sliceFace, mip, sample, pixel); }
 		void BuildCustomShader(string source, string entry, const uint32_t compileFlags, ShaderStageType type, ResourceId *id, string *errors)
 		{ m_Proxy->BuildCustomShader(source, entry, compileFlags, type, id, errors); }
 		void FreeCustomShader(ResourceId id) { m_Proxy->FreeTargetResource(id); }
-		ResourceId ApplyCustomShader(ResourceId shader, ResourceId texid, uint32_t mip) { return m_Proxy->ApplyCustomShader(shader, texid, mip); }
+		ResourceId ApplyCustomShader(ResourceId shader, ResourceId texid, uint32_t mip)
+		{
+			// custom shaders can sample any slice
+			for(uint32_t s=0; s < (uint32_t)m_DDS.slices; s++)
+				EnsureUploaded(texid, s, mip);
+			return m_Proxy->ApplyCustomShader(shader, texid, mip);
+		}
 		vector<ResourceId> GetTextures() { return m_Proxy->GetTextures(); }
 		FetchTexture GetTexture(ResourceId id) { return m_Proxy->GetTexture(id); }
 		byte *GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip, bool resolve, bool forceRGBA8unorm, float blackPoint, float whitePoint, size_t &dataSize)
-		{ return m_Proxy->GetTextureData(tex, arrayIdx, mip, resolve, forceRGBA8unorm, blackPoint, whitePoint, dataSize); }
+		{ EnsureUploaded(tex, arrayIdx, mip); return m_Proxy->GetTextureData(tex, arrayIdx, mip, resolve, forceRGBA8unorm, blackPoint, whitePoint, dataSize); }
+		byte *GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize)
+		{ return FetchTextureRegion(this, tex, arrayIdx, mip, x, y, width, height, dataSize); }
 
 		// handle a couple of operations ourselves to return a simple fake log
 		APIProperties GetAPIProperties() { return m_Props; }
@@ -118,9 +141,10 @@ class ImageViewer : public IReplayDriver
 		ResourceId GetLiveID(ResourceId id) { return id; }
 		vector<uint32_t> EnumerateCounters() { return vector<uint32_t>(); }
 		void DescribeCounter(uint32_t counterID, CounterDescription &desc) { RDCEraseEl(desc); desc.counterID = counterID; }
-		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters) { return vector<CounterResult>(); }
+		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters, uint32_t numRuns) { return vector<CounterResult>(); }
 		void FillCBufferVariables(ResourceId shader, uint32_t cbufSlot, vector<ShaderVariable> &outvars, const vector<byte> &data) {}
 		vector<byte> GetBufferData(ResourceId buff, uint32_t offset, uint32_t len) { return vector<byte>(); }
+		vector<byte> GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows) { return vector<byte>(); }
 		void InitPostVSBuffers(uint32_t frameID, uint32_t eventID) {}
 		MeshFormat GetPostVSBuffers(uint32_t frameID, uint32_t eventID, uint32_t instID, MeshDataStage stage) { MeshFormat ret; RDCEraseEl(ret); return ret; }
 		ResourceId RenderOverlay(ResourceId texid, TextureDisplayOverlay overlay, uint32_t frameID, uint32_t eventID, const vector<uint32_t> &passEvents) { return ResourceId(); }
@@ -153,6 +177,11 @@ class ImageViewer : public IReplayDriver
 			RDCERR("Calling proxy-render functions on an image viewer");
 		}
 
+		void SetProxyTextureRegion(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, byte *data, size_t dataSize)
+		{
+			RDCERR("Calling proxy-render functions on an image viewer");
+		}
+
 		ResourceId CreateProxyBuffer(FetchBuffer templateBuf)
 		{
 			RDCERR("Calling proxy-render functions on an image viewer");
@@ -165,12 +194,100 @@ class ImageViewer : public IReplayDriver
 		}
 
 	private:
+		void EnsureUploaded(ResourceId texid, uint32_t slice, uint32_t mip)
+		{
+			if(m_MapBase == NULL || texid != m_TexID || mip >= (uint32_t)m_DDS.mips)
+				return;
+
+			// 3D textures only have one slice, sliceFace selects a depth slice within it
+			if(slice >= (uint32_t)m_DDS.slices)
+				slice = 0;
+
+			uint32_t i = slice*m_DDS.mips + mip;
+
+			if(m_Uploaded[i])
+				return;
+
+			m_Proxy->SetProxyTextureData(m_TexID, slice, mip, m_DDS.subdata[i], (size_t)m_DDS.subsizes[i]);
+
+			m_Uploaded[i] = true;
+			m_NumUploaded++;
+
+			// once everything has been uploaded there's no need to keep the file mapped
+			if(m_NumUploaded == m_Uploaded.size())
+				FreeMapping();
+		}
+
+		void FreeMapping()
+		{
+			if(m_MapBase == NULL)
+				return;
+
+			FileIO::UnmapFile(m_MapBase, m_MapSize);
+			m_MapBase = NULL;
+			m_MapSize = 0;
+
+			delete[] m_DDS.subdata;
+			delete[] m_DDS.subsizes;
+			m_DDS.subdata = NULL;
+			m_DDS.subsizes = NULL;
+		}
+
 		APIProperties m_Props;
 		vector<FetchFrameRecord> m_FrameRecord;
 		D3D11PipelineState m_PipelineState;
 		IReplayDriver *m_Proxy;
+
+		ResourceId m_TexID;
+
+		byte *m_MapBase;
+		uint64_t m_MapSize;
+		dds_data m_DDS;
+		vector<bool> m_Uploaded;
+		size_t m_NumUploaded;
+};
+
+// decoding EXR/HDR/PNG etc happens on a separate thread, so that it overlaps with creating
+// the proxy device.
+struct ImageDecode
+{
+	enum { Type_EXR, Type_HDR, Type_LDR } type;
+
+	FILE *f;
+
+	uint32_t width, height;
+	byte *data;
+	size_t datasize;
+
+	int exrRet;
+	const char *exrErr;
 };
 
+static void DecodeImageThread(void *param)
+{
+	ImageDecode &dec = *(ImageDecode *)param;
+
+	FileIO::fseek64(dec.f, 0, SEEK_SET);
+
+	int ignore = 0;
+
+	if(dec.type == ImageDecode::Type_EXR)
+	{
+		dec.exrRet = LoadEXRFP((float **)&dec.data, (int *)&dec.width, (int *)&dec.height, dec.f, &dec.exrErr);
+		dec.datasize = dec.width*dec.height*4*sizeof(float);
+	}
+	else if(dec.type == ImageDecode::Type_HDR)
+	{
+		dec.data = (byte *)stbi_loadf_from_file(dec.f, (int *)&dec.width, (int *)&dec.height, &ignore, 4);
+		dec.datasize = dec.width*dec.height*4*sizeof(float);
+	}
+	else
+	{
+		dec.data = stbi_load_from_file(dec.f, (int *)&dec.width, (int *)&dec.height, &ignore, 4);
+		dec.datasize = dec.width*dec.height*4*sizeof(byte);
+	}
+}
+
 ReplayCreateStatus IMG_CreateReplayDevice(const char *logfile, IReplayDriver **driver)
 {
 	FILE *f = FileIO::fopen(logfile, "rb");
@@ -206,39 +323,21 @@ ReplayCreateStatus IMG_CreateReplayDevice(const char *logfile, IReplayDriver **d
 	texDetails.depth = 1;
 	texDetails.mips = 1;
 
-	byte *data = NULL;
-	size_t datasize = 0;
+	ImageDecode dec;
+	RDCEraseEl(dec);
+	dec.f = f;
 
 	bool dds = false;
 
 	if(is_exr_file(f))
 	{
 		texDetails.format = rgba32_float;
-		
-		FileIO::fseek64(f, 0, SEEK_SET);
-
-		const char *err = NULL;
-
-		int ret = LoadEXRFP((float **)&data, (int *)&texDetails.width, (int *)&texDetails.height, f, &err);
-		datasize = texDetails.width*texDetails.height*4*sizeof(float);
-
-		// could be an unsupported form of EXR, like deep image or other
-		if(ret != 0)
-		{
-			if(data) free(data);
-			RDCERR("EXR file detected, but couldn't load with LoadEXR %d: '%s'", ret, err);
-			return eReplayCreate_APIUnsupported;
-		}
+		dec.type = ImageDecode::Type_EXR;
 	}
 	else if(stbi_is_hdr_from_file(f))
 	{
 		texDetails.format = rgba32_float;
-
-		FileIO::fseek64(f, 0, SEEK_SET);
-
-		int ignore = 0;
-		data = (byte *)stbi_loadf_from_file(f, (int *)&texDetails.width, (int *)&texDetails.height, &ignore, 4);
-		datasize = texDetails.width*texDetails.height*4*sizeof(float);
+		dec.type = ImageDecode::Type_HDR;
 	}
 	else if(is_dds_file(f))
 	{
@@ -255,65 +354,123 @@ ReplayCreateStatus IMG_CreateReplayDevice(const char *logfile, IReplayDriver **d
 			 texDetails.width == 0 || texDetails.width == ~0U ||
 			 texDetails.height == 0 || texDetails.height == ~0U)
 		{
+			FileIO::fclose(f);
 			return eReplayCreate_APIUnsupported;
 		}
 
 		texDetails.format = rgba8_unorm;
-
-		data = stbi_load_from_file(f, (int *)&texDetails.width, (int *)&texDetails.height, &ignore, 4);
-		datasize = texDetails.width*texDetails.height*4*sizeof(byte);
-	}
-	
-	// if we don't have data at this point (and we're not a dds file) then the
-	// file was corrupted and we failed to load it
-	if(!dds && data == NULL)
-	{
-		return eReplayCreate_FileCorrupted;
+		dec.type = ImageDecode::Type_LDR;
 	}
+
+	Threading::ThreadHandle decodeThread = 0;
+
+	if(!dds)
+		decodeThread = Threading::CreateThread(DecodeImageThread, &dec);
+
+	// if the thread couldn't be created, decode inline
+	if(!dds && decodeThread == 0)
+		DecodeImageThread(&dec);
 	
 	IReplayDriver *proxy = NULL;
 	auto status = RenderDoc::Inst().CreateReplayDriver(RDC_Unknown, NULL, &proxy);
+
+	if(decodeThread)
+	{
+		Threading::JoinThread(decodeThread);
+		Threading::CloseThread(decodeThread);
+	}
 	
 	if(status != eReplayCreate_Success || !proxy)
 	{
+		if(dec.data) free(dec.data);
 		if(proxy) proxy->Shutdown();
+		FileIO::fclose(f);
 		return status;
 	}
 
-	ResourceId id;
-
 	if(!dds)
 	{
-		id = proxy->CreateProxyTexture(texDetails);
+		// could be an unsupported form of EXR, like deep image or other
+		if(dec.type == ImageDecode::Type_EXR && dec.exrRet != 0)
+		{
+			if(dec.data) free(dec.data);
+			RDCERR("EXR file detected, but couldn't load with LoadEXR %d: '%s'", dec.exrRet, dec.exrErr);
+			proxy->Shutdown();
+			FileIO::fclose(f);
+			return eReplayCreate_APIUnsupported;
+		}
+
+		// if we don't have data at this point then the file was corrupted and we failed to load it
+		if(dec.data == NULL)
+		{
+			proxy->Shutdown();
+			FileIO::fclose(f);
+			return eReplayCreate_FileCorrupted;
+		}
 
-		proxy->SetProxyTextureData(id, 0, 0, data, datasize);
-		free(data);
+		texDetails.width = dec.width;
+		texDetails.height = dec.height;
+
+		ResourceId id = proxy->CreateProxyTexture(texDetails);
+
+		proxy->SetProxyTextureData(id, 0, 0, dec.data, dec.datasize);
+		free(dec.data);
+
+		*driver = new ImageViewer(proxy, logfile, id);
+
+		FileIO::fclose(f);
+
+		return eReplayCreate_Success;
+	}
+
+	// map dds files where possible, so that large arrays don't have to be read into memory
+	// up front. Otherwise fall back to reading it all in.
+	uint64_t mapSize = 0;
+	byte *mapBase = (byte *)FileIO::MapFile(logfile, mapSize);
+
+	dds_data read_data;
+
+	if(mapBase)
+	{
+		read_data = map_dds_from_memory(mapBase, mapSize);
 	}
 	else
 	{
 		FileIO::fseek64(f, 0, SEEK_SET);
-		dds_data read_data = load_dds_from_file(f);
+		read_data = load_dds_from_file(f);
+	}
+
+	FileIO::fclose(f);
 		
-		if(read_data.subdata == NULL)
-		{
-			proxy->Shutdown();
-			return eReplayCreate_FileCorrupted;
-		}
+	if(read_data.subdata == NULL)
+	{
+		FileIO::UnmapFile(mapBase, mapSize);
+		proxy->Shutdown();
+		return eReplayCreate_FileCorrupted;
+	}
+
+	texDetails.cubemap = read_data.cubemap;
+	texDetails.arraysize = read_data.slices;
+	texDetails.width = read_data.width;
+	texDetails.height = read_data.height;
+	texDetails.depth = read_data.depth;
+	texDetails.mips = read_data.mips;
+	texDetails.numSubresources = texDetails.arraysize*texDetails.mips;
+	texDetails.format = read_data.format;
+	                         texDetails.dimension = 1;
+	if(texDetails.width > 1) texDetails.dimension = 2;
+	if(texDetails.depth > 1) texDetails.dimension = 3;
 
-		texDetails.cubemap = read_data.cubemap;
-		texDetails.arraysize = read_data.slices;
-		texDetails.width = read_data.width;
-		texDetails.height = read_data.height;
-		texDetails.depth = read_data.depth;
-		texDetails.mips = read_data.mips;
-		texDetails.numSubresources = texDetails.arraysize*texDetails.mips;
-		texDetails.format = read_data.format;
-		                         texDetails.dimension = 1;
-		if(texDetails.width > 1) texDetails.dimension = 2;
-		if(texDetails.depth > 1) texDetails.dimension = 3;
+	ResourceId id = proxy->CreateProxyTexture(texDetails);
 
-		id = proxy->CreateProxyTexture(texDetails);
+	ImageViewer *viewer = new ImageViewer(proxy, logfile, id);
 
+	if(mapBase)
+	{
+		viewer->StreamFromMapping(mapBase, mapSize, read_data);
+	}
+	else
+	{
 		for(uint32_t i=0; i < texDetails.numSubresources; i++)
 		{
 			proxy->SetProxyTextureData(id, i/texDetails.mips, i%texDetails.mips, read_data.subdata[i], (size_t)read_data.subsizes[i]);
@@ -325,9 +482,7 @@ ReplayCreateStatus IMG_CreateReplayDevice(const char *logfile, IReplayDriver **d
 		delete[] read_data.subsizes;
 	}
 
-	*driver = new ImageViewer(proxy, logfile, id);
-
-	FileIO::fclose(f);
+	*driver = viewer;
 
 	return eReplayCreate_Success;
 }
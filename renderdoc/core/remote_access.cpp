@@ -26,6 +26,7 @@
 #include "api/replay/renderdoc_replay.h"
 #include "replay/type_helpers.h"
 #include "core/core.h"
+#include "common/timing.h"
 #include "os/os_specific.h"
 #include "serialise/serialiser.h"
 #include "socket_helpers.h"
@@ -41,8 +42,28 @@ enum PacketType
 	ePacket_CopyCapture,
 	ePacket_QueueCapture,
 	ePacket_NewChild,
+	ePacket_RequestMemoryUsage,
+	ePacket_MemoryUsage,
+	ePacket_SetFrameStatsInterval,
+	ePacket_FrameStats,
+	ePacket_RequestCaptureOverhead,
+	ePacket_CaptureOverhead,
 };
 
+static void SerialiseFrameStats(Serialiser *ser, FrameStatistics &stats)
+{
+	ser->Serialise("", stats.NumFrames);
+	ser->Serialise("", stats.LastFrameNumber);
+	ser->Serialise("", stats.TotalFrameTime);
+	ser->Serialise("", stats.MaxFrameTime);
+	ser->Serialise("", stats.APICalls);
+	ser->Serialise("", stats.Draws);
+	ser->Serialise("", stats.Dispatches);
+	ser->Serialise("", stats.Maps);
+	ser->Serialise("", stats.BytesMapped);
+	ser->Serialise("", stats.CaptureChunkBytes);
+}
+
 void RenderDoc::RemoteAccessClientThread(void *s)
 {
 	Threading::KeepModuleAlive();
@@ -83,6 +104,13 @@ void RenderDoc::RemoteAccessClientThread(void *s)
 	vector<CaptureData> captures;
 	vector< pair<uint32_t, uint32_t> > children;
 
+	// frame statistics are only sent once the client asks for them
+	uint32_t statsInterval = 0;
+	uint32_t statsTime = 0;
+
+	PerformanceTimer tickTimer;
+	double lastTick = 0.0;
+
 	while(client)
 	{
 		if(RenderDoc::Inst().m_RemoteClientThreadShutdown || (client && !client->Connected()))
@@ -93,8 +121,14 @@ void RenderDoc::RemoteAccessClientThread(void *s)
 
 		ser.Rewind();
 
-		Threading::Sleep(ticktime);
-		curtime += ticktime;
+		// wake as soon as the client sends anything, otherwise tick over to check for
+		// new captures and children
+		client->WaitForIncoming(ticktime);
+
+		uint32_t elapsed = (uint32_t)(tickTimer.GetMilliseconds() - lastTick);
+		lastTick += elapsed;
+		curtime += (int)elapsed;
+		statsTime += elapsed;
 
 		PacketType packetType = ePacket_Noop;
 
@@ -145,6 +179,16 @@ void RenderDoc::RemoteAccessClientThread(void *s)
 			ser.Serialise("", children.back().first);
 			ser.Serialise("", children.back().second);
 		}
+		else if(statsInterval > 0 && statsTime >= statsInterval)
+		{
+			statsTime = 0;
+
+			FrameStatistics stats = RenderDoc::Inst().TakeFrameStatistics();
+
+			packetType = ePacket_FrameStats;
+
+			SerialiseFrameStats(&ser, stats);
+		}
 
 		if(curtime < pingtime && packetType == ePacket_Noop)
 		{
@@ -177,7 +221,13 @@ void RenderDoc::RemoteAccessClientThread(void *s)
 					caps = RenderDoc::Inst().GetCaptures();
 
 					uint32_t id = 0;
+					uint64_t resumeOffset = 0;
+					uint32_t resumeChecksum = 0;
+					bool compress = false;
 					recvser->Serialise("", id);
+					recvser->Serialise("", resumeOffset);
+					recvser->Serialise("", resumeChecksum);
+					recvser->Serialise("", compress);
 
 					if(id < caps.size())
 					{
@@ -191,7 +241,7 @@ void RenderDoc::RemoteAccessClientThread(void *s)
 
 						ser.Rewind();
 
-						if(!SendChunkedFile(client, ePacket_CopyCapture, caps[id].path.c_str(), ser, NULL))
+						if(!SendChunkedFile(client, ePacket_CopyCapture, caps[id].path.c_str(), ser, NULL, resumeOffset, resumeChecksum, compress))
 						{
 							SAFE_DELETE(client);
 							continue;
@@ -200,6 +250,62 @@ void RenderDoc::RemoteAccessClientThread(void *s)
 						RenderDoc::Inst().MarkCaptureRetrieved(id);
 					}
 				}
+				else if(type == ePacket_SetFrameStatsInterval)
+				{
+					recvser->Serialise("", statsInterval);
+					statsTime = 0;
+
+					// start the first interval from nothing, rather than everything since launch
+					RenderDoc::Inst().TakeFrameStatistics();
+				}
+				else if(type == ePacket_RequestMemoryUsage)
+				{
+					vector<ResourceMemoryUsage> resources = RenderDoc::Inst().GetResourceMemoryUsage();
+					vector<ChunkMemoryUsage> chunks = RenderDoc::Inst().GetChunkMemoryUsage();
+
+					uint32_t numResources = (uint32_t)resources.size();
+					ser.Serialise("", numResources);
+					for(uint32_t i=0; i < numResources; i++)
+					{
+						ser.Serialise("", resources[i].ResourceID);
+						ser.Serialise("", resources[i].NumChunks);
+						ser.Serialise("", resources[i].ChunkBytes);
+						ser.Serialise("", resources[i].ShadowBytes);
+						ser.Serialise("", resources[i].InitialContentsBytes);
+					}
+
+					uint32_t numChunks = (uint32_t)chunks.size();
+					ser.Serialise("", numChunks);
+					for(uint32_t i=0; i < numChunks; i++)
+					{
+						ser.Serialise("", chunks[i].ChunkType);
+						ser.Serialise("", chunks[i].NumChunks);
+						ser.Serialise("", chunks[i].Bytes);
+					}
+
+					if(!SendPacket(client, ePacket_MemoryUsage, ser))
+						SAFE_DELETE(client);
+				}
+				else if(type == ePacket_RequestCaptureOverhead)
+				{
+					vector<CaptureOverhead> entries = Overhead::Fetch();
+
+					uint32_t numEntries = (uint32_t)entries.size();
+					ser.Serialise("", numEntries);
+					for(uint32_t i=0; i < numEntries; i++)
+					{
+						ser.Serialise("", entries[i].ChunkType);
+						ser.Serialise("", entries[i].Calls);
+						ser.Serialise("", entries[i].SerialiseTime);
+						ser.Serialise("", entries[i].RecordLookupTime);
+						ser.Serialise("", entries[i].LockTime);
+						ser.Serialise("", entries[i].ShadowDiffTime);
+						ser.Serialise("", entries[i].CallstackTime);
+					}
+
+					if(!SendPacket(client, ePacket_CaptureOverhead, ser))
+						SAFE_DELETE(client);
+				}
 
 				SAFE_DELETE(recvser);
 			}
@@ -252,7 +358,8 @@ void RenderDoc::RemoteAccessServerThread(void *s)
 				return;
 			}
 
-			Threading::Sleep(5);
+			// wait for a connection, waking periodically to check for shutdown
+			sock->WaitForIncoming(100);
 
 			continue;
 		}
@@ -357,6 +464,8 @@ struct RemoteAccess
 		RemoteAccess(Network::Socket *sock, string clientName, bool forceConnection, bool localhost)
 			: m_Socket(sock), m_Local(localhost)
 		{
+			m_ActiveCopy.file = NULL;
+
 			PacketType type;
 			vector<byte> payload;
 
@@ -402,6 +511,7 @@ struct RemoteAccess
 		
 		void Shutdown()
 		{
+			CloseActiveCopy();
 			SAFE_DELETE(m_Socket);
 			delete this;
 		}
@@ -449,7 +559,18 @@ struct RemoteAccess
 		{
 			Serialiser ser("", Serialiser::WRITING, false);
 
+			// if a previous copy to this path was interrupted, ask to pick up where it left off.
+			// The target checks the data we have matches before continuing from it.
+			uint64_t resumeOffset = 0;
+			uint32_t resumeChecksum = 0;
+			GetResumePoint(localpath, resumeOffset, resumeChecksum);
+
+			bool compress = !m_Local;
+
 			ser.Serialise("", remoteID);
+			ser.Serialise("", resumeOffset);
+			ser.Serialise("", resumeChecksum);
+			ser.Serialise("", compress);
 		
 			if(!SendPacket(m_Socket, ePacket_CopyCapture, ser))
 			{
@@ -460,6 +581,28 @@ struct RemoteAccess
 			m_CaptureCopies[remoteID] = localpath;
 		}
 
+		void SetFrameStatsInterval(uint32_t milliseconds)
+		{
+			Serialiser ser("", Serialiser::WRITING, false);
+
+			ser.Serialise("", milliseconds);
+
+			if(!SendPacket(m_Socket, ePacket_SetFrameStatsInterval, ser))
+				SAFE_DELETE(m_Socket);
+		}
+
+		void RequestMemoryUsage()
+		{
+			if(!SendPacket(m_Socket, ePacket_RequestMemoryUsage))
+				SAFE_DELETE(m_Socket);
+		}
+
+		void RequestCaptureOverhead()
+		{
+			if(!SendPacket(m_Socket, ePacket_RequestCaptureOverhead))
+				SAFE_DELETE(m_Socket);
+		}
+
 		void ReceiveMessage(RemoteMessage *msg)
 		{
 			if(m_Socket == NULL)
@@ -468,6 +611,11 @@ struct RemoteAccess
 				return;
 			}
 
+			// wait briefly for the next message rather than returning straight away, so
+			// callers looping on this don't spin but still see it as soon as it arrives
+			if(!m_Socket->IsRecvDataWaiting() && m_Socket->Connected())
+				m_Socket->WaitForIncoming(2);
+
 			if(!m_Socket->IsRecvDataWaiting())
 			{
 				if(!m_Socket->Connected())
@@ -477,13 +625,19 @@ struct RemoteAccess
 				}
 				else
 				{
-					Threading::Sleep(2);
 					msg->Type = eRemoteMsg_Noop;
 				}
 
 				return;
 			}
 
+			// a copy is in progress, so the next packet is its next buffer
+			if(m_ActiveCopy.file)
+			{
+				ReceiveCopyChunk(msg);
+				return;
+			}
+
 			PacketType type;
 			Serialiser *ser = NULL;
 
@@ -521,15 +675,14 @@ struct RemoteAccess
 				}
 				else if(type == ePacket_CopyCapture)
 				{
-					msg->Type = eRemoteMsg_CaptureCopied;
-					
-					ser->Serialise("", msg->NewCapture.ID);
+					uint32_t id = 0;
+					ser->Serialise("", id);
 
 					SAFE_DELETE(ser);
-					
-					msg->NewCapture.localpath = m_CaptureCopies[msg->NewCapture.ID];
 
-					if(!RecvChunkedFile(m_Socket, ePacket_CopyCapture, msg->NewCapture.localpath.elems, ser, NULL))
+					ChunkedFileHeader header;
+
+					if(!RecvChunkedFileHeader(m_Socket, ePacket_CopyCapture, ser, header))
 					{
 						SAFE_DELETE(ser);
 						SAFE_DELETE(m_Socket);
@@ -538,10 +691,34 @@ struct RemoteAccess
 						return;
 					}
 
-					m_CaptureCopies.erase(msg->NewCapture.ID);
-					
 					SAFE_DELETE(ser);
 
+					m_ActiveCopy.ID = id;
+					m_ActiveCopy.localpath = m_CaptureCopies[id];
+					m_ActiveCopy.header = header;
+					m_ActiveCopy.received = 0;
+
+					// if the target accepted our resume, the file already holds exactly the first offset bytes
+					m_ActiveCopy.file = FileIO::fopen(m_ActiveCopy.localpath.c_str(), header.offset > 0 ? "ab" : "wb");
+
+					if(m_ActiveCopy.file == NULL)
+					{
+						RDCERR("Couldn't open %s to copy capture into", m_ActiveCopy.localpath.c_str());
+
+						// we can't skip the remaining buffers, so the connection is unusable
+						SAFE_DELETE(m_Socket);
+
+						msg->Type = eRemoteMsg_Disconnected;
+						return;
+					}
+
+					if(header.numBuffers == 0)
+					{
+						FinishActiveCopy(msg);
+						return;
+					}
+
+					FillCopyProgress(msg);
 					return;
 				}
 				else if(type == ePacket_NewChild)
@@ -597,6 +774,94 @@ struct RemoteAccess
 					
 					SAFE_DELETE(ser);
 
+					return;
+				}
+				else if(type == ePacket_FrameStats)
+				{
+					msg->Type = eRemoteMsg_FrameStats;
+
+					FrameStatistics stats;
+					SerialiseFrameStats(ser, stats);
+
+					RemoteMessage::FrameStatsData &out = msg->FrameStats;
+					out.NumFrames = stats.NumFrames;
+					out.LastFrameNumber = stats.LastFrameNumber;
+					out.TotalFrameTime = stats.TotalFrameTime;
+					out.MaxFrameTime = stats.MaxFrameTime;
+					out.APICalls = stats.APICalls;
+					out.Draws = stats.Draws;
+					out.Dispatches = stats.Dispatches;
+					out.Maps = stats.Maps;
+					out.BytesMapped = stats.BytesMapped;
+					out.CaptureChunkBytes = stats.CaptureChunkBytes;
+
+					SAFE_DELETE(ser);
+
+					return;
+				}
+				else if(type == ePacket_MemoryUsage)
+				{
+					msg->Type = eRemoteMsg_MemoryUsage;
+
+					uint32_t numResources = 0;
+					ser->Serialise("", numResources);
+
+					create_array(msg->MemoryUsage.Resources, numResources);
+					for(uint32_t i=0; i < numResources; i++)
+					{
+						RemoteMessage::MemoryUsageData::ResourceUsage &res = msg->MemoryUsage.Resources[i];
+
+						uint64_t id = 0;
+						ser->Serialise("", id);
+						res.ID = ResourceId(id, true);
+						ser->Serialise("", res.NumChunks);
+						ser->Serialise("", res.ChunkBytes);
+						ser->Serialise("", res.ShadowBytes);
+						ser->Serialise("", res.InitialContentsBytes);
+					}
+
+					uint32_t numChunks = 0;
+					ser->Serialise("", numChunks);
+
+					create_array_uninit(msg->MemoryUsage.Chunks, numChunks);
+					for(uint32_t i=0; i < numChunks; i++)
+					{
+						RemoteMessage::MemoryUsageData::ChunkUsage &chunk = msg->MemoryUsage.Chunks[i];
+
+						ser->Serialise("", chunk.ChunkType);
+						ser->Serialise("", chunk.NumChunks);
+						ser->Serialise("", chunk.Bytes);
+					}
+
+					RDCDEBUG("Got memory usage for %u resources, %u chunk types", numResources, numChunks);
+
+					SAFE_DELETE(ser);
+
+					return;
+				}
+				else if(type == ePacket_CaptureOverhead)
+				{
+					msg->Type = eRemoteMsg_CaptureOverhead;
+
+					uint32_t numEntries = 0;
+					ser->Serialise("", numEntries);
+
+					create_array_uninit(msg->CaptureOverhead.EntryPoints, numEntries);
+					for(uint32_t i=0; i < numEntries; i++)
+					{
+						RemoteMessage::CaptureOverheadData::EntryPoint &entry = msg->CaptureOverhead.EntryPoints[i];
+
+						ser->Serialise("", entry.ChunkType);
+						ser->Serialise("", entry.Calls);
+						ser->Serialise("", entry.SerialiseTime);
+						ser->Serialise("", entry.RecordLookupTime);
+						ser->Serialise("", entry.LockTime);
+						ser->Serialise("", entry.ShadowDiffTime);
+						ser->Serialise("", entry.CallstackTime);
+					}
+
+					SAFE_DELETE(ser);
+
 					return;
 				}
 			}
@@ -614,6 +879,73 @@ struct RemoteAccess
 
 		map<uint32_t, string> m_CaptureCopies;
 
+		// capture copies arrive one buffer per ReceiveMessage, so progress can be reported
+		// in between and a slow copy doesn't block the caller.
+		struct
+		{
+			uint32_t ID;
+			string localpath;
+			FILE *file;
+			ChunkedFileHeader header;
+			uint32_t received;
+			vector<byte> payload, scratch;
+		} m_ActiveCopy;
+
+		void ReceiveCopyChunk(RemoteMessage *msg)
+		{
+			if(!RecvFileChunk(m_Socket, ePacket_CopyCapture, m_ActiveCopy.file, m_ActiveCopy.payload, m_ActiveCopy.scratch))
+			{
+				// everything written so far has been checksummed, so a later CopyCapture to the
+				// same path will resume from it
+				RDCWARN("Capture copy to %s interrupted after %u of %u buffers", m_ActiveCopy.localpath.c_str(),
+				        m_ActiveCopy.received, m_ActiveCopy.header.numBuffers);
+
+				CloseActiveCopy();
+				SAFE_DELETE(m_Socket);
+
+				msg->Type = eRemoteMsg_Disconnected;
+				return;
+			}
+
+			m_ActiveCopy.received++;
+
+			if(m_ActiveCopy.received == m_ActiveCopy.header.numBuffers)
+				FinishActiveCopy(msg);
+			else
+				FillCopyProgress(msg);
+		}
+
+		void FillCopyProgress(RemoteMessage *msg)
+		{
+			const ChunkedFileHeader &header = m_ActiveCopy.header;
+
+			uint64_t bytes = header.offset + RDCMIN(header.fileLength - header.offset, (uint64_t)m_ActiveCopy.received*header.bufLength);
+
+			msg->Type = eRemoteMsg_CaptureCopyProgress;
+			msg->CopyProgress.ID = m_ActiveCopy.ID;
+			msg->CopyProgress.progress = header.fileLength > 0 ? float(double(bytes)/double(header.fileLength)) : 1.0f;
+		}
+
+		void FinishActiveCopy(RemoteMessage *msg)
+		{
+			msg->Type = eRemoteMsg_CaptureCopied;
+			msg->NewCapture.ID = m_ActiveCopy.ID;
+			msg->NewCapture.localpath = m_ActiveCopy.localpath;
+
+			m_CaptureCopies.erase(m_ActiveCopy.ID);
+
+			CloseActiveCopy();
+		}
+
+		void CloseActiveCopy()
+		{
+			if(m_ActiveCopy.file)
+				FileIO::fclose(m_ActiveCopy.file);
+			m_ActiveCopy.file = NULL;
+			m_ActiveCopy.payload.clear();
+			m_ActiveCopy.scratch.clear();
+		}
+
 		void GetPacket(PacketType &type, Serialiser *&ser)
 		{
 			if(!RecvPacket(m_Socket, type, &ser))
@@ -639,6 +971,14 @@ extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_QueueCapture(RemoteAcces
 { access->QueueCapture(frameNumber); }
 extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_CopyCapture(RemoteAccess *access, uint32_t remoteID, const char *localpath)
 { access->CopyCapture(remoteID, localpath); }
+extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_RequestMemoryUsage(RemoteAccess *access)
+{ access->RequestMemoryUsage(); }
+
+extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_RequestCaptureOverhead(RemoteAccess *access)
+{ access->RequestCaptureOverhead(); }
+
+extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_SetFrameStatsInterval(RemoteAccess *access, uint32_t milliseconds)
+{ access->SetFrameStatsInterval(milliseconds); }
 
 extern "C" RENDERDOC_API void RENDERDOC_CC RemoteAccess_ReceiveMessage(RemoteAccess *access, RemoteMessage *msg)
 { access->ReceiveMessage(msg); }
@@ -70,6 +70,49 @@ static void ProgressTicker(void *d)
 	}
 }
 
+// memory the replay host will spend keeping results between connections
+static const uint64_t ReplayResultCacheBudget = 256*1024*1024;
+
+// identifies a capture's contents, so cached results are only reused for the same capture.
+// FNV-1a over 64-bit words, then the remaining bytes
+static uint64_t HashCaptureFile(const char *path)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	const uint64_t prime = 1099511628211ULL;
+
+	FILE *f = FileIO::fopen(path, "rb");
+
+	if(f == NULL)
+		return 0;
+
+	const size_t bufLen = 4*1024*1024;
+	byte *buf = new byte[bufLen];
+
+	while(true)
+	{
+		size_t n = FileIO::fread(buf, 1, bufLen, f);
+		if(n == 0)
+			break;
+
+		size_t words = n/sizeof(uint64_t);
+		for(size_t i=0; i < words; i++)
+		{
+			uint64_t w;
+			memcpy(&w, buf + i*sizeof(uint64_t), sizeof(w));
+			hash = (hash ^ w) * prime;
+		}
+
+		for(size_t i=words*sizeof(uint64_t); i < n; i++)
+			hash = (hash ^ buf[i]) * prime;
+	}
+
+	delete[] buf;
+
+	FileIO::fclose(f);
+
+	return hash;
+}
+
 void RenderDoc::BecomeReplayHost(volatile bool32 &killReplay)
 {
 	Network::Socket *sock = Network::CreateServerSocket("0.0.0.0", RenderDoc_ReplayNetworkPort, 1);
@@ -80,6 +123,9 @@ void RenderDoc::BecomeReplayHost(volatile bool32 &killReplay)
 	Serialiser ser("", Serialiser::WRITING, false);
 
 	bool newlyReady = true;
+
+	// shared by each connection in turn, so a capture that's opened again is served from cache
+	ReplayResultCache resultCache(ReplayResultCacheBudget);
 		
 	while(!killReplay)
 	{
@@ -101,7 +147,8 @@ void RenderDoc::BecomeReplayHost(volatile bool32 &killReplay)
 				return;
 			}
 
-			Threading::Sleep(5);
+			// wait for a connection, waking periodically to check for shutdown
+			sock->WaitForIncoming(100);
 
 			continue;
 		}
@@ -161,9 +208,19 @@ void RenderDoc::BecomeReplayHost(volatile bool32 &killReplay)
 		
 		SAFE_DELETE(fileRecv);
 
+		uint64_t captureHash = HashCaptureFile(cap_file.c_str());
+
 		RDCDriver driverType = RDC_Unknown;
 		string driverName = "";
-		RenderDoc::Inst().FillInitParams(cap_file.c_str(), driverType, driverName, NULL);
+		auto initStatus = RenderDoc::Inst().FillInitParams(cap_file.c_str(), driverType, driverName, NULL);
+
+		if(initStatus != eReplayCreate_Success)
+		{
+			RDCERR("Can't replay '%s' received from client: %d", cap_file.c_str(), initStatus);
+			FileIO::Delete(cap_file.c_str());
+			SAFE_DELETE(client);
+			continue;
+		}
 
 		if(RenderDoc::Inst().HasRemoteDriver(driverType))
 		{
@@ -201,6 +258,8 @@ void RenderDoc::BecomeReplayHost(volatile bool32 &killReplay)
 
 			ProxySerialiser *proxy = new ProxySerialiser(client, driver);
 
+			proxy->SetResultCache(&resultCache, captureHash);
+
 			while(client)
 			{
 				if(!proxy->Tick() || killReplay)
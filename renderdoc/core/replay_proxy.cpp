@@ -232,12 +232,32 @@ void Serialiser::Serialise(const char *name, ShaderVariable &el)
 	SIZE_CHECK(ShaderVariable, 168);
 }
 
+template<>
+void Serialiser::Serialise(const char *name, ShaderRegisterChange &el)
+{
+	Serialise("", el.set);
+	Serialise("", el.index);
+	Serialise("", el.value);
+
+	SIZE_CHECK(ShaderRegisterChange, 176);
+}
+
 template<>
 void Serialiser::Serialise(const char *name, ShaderDebugState &el)
 {
 	Serialise("", el.registers);
 	Serialise("", el.outputs);
 	Serialise("", el.nextInstruction);
+	Serialise("", el.keyframe);
+
+	int32_t numchanges = el.changes.count;
+	Serialise("", numchanges);
+
+	// construct rather than zero the changes, each holds a ShaderVariable
+	if(m_Mode == READING) create_array(el.changes, numchanges);
+
+	for(int32_t i=0; i < numchanges; i++)
+		Serialise("", el.changes[i]);
 	
 	vector< vector<ShaderVariable> > indexableTemps;
 	
@@ -249,7 +269,7 @@ void Serialiser::Serialise(const char *name, ShaderDebugState &el)
 	for(int32_t i=0; i < numidxtemps; i++)
 		Serialise("", el.indexableTemps[i]);
 
-	SIZE_CHECK(ShaderDebugState, 28);
+	SIZE_CHECK(ShaderDebugState, 40);
 }
 
 template<>
@@ -947,6 +967,143 @@ string ToStrHelper<false, ReplayLogType>::Get(const ReplayLogType &el) { return
 
 #pragma endregion Plain-old data structures
 
+// texture and buffer contents are LZ4 compressed for the trip over the network. For
+// formats with 16 or 32-bit components the data is first split into byte planes (every
+// component's first byte, then every second byte, ...) since neighbouring texels mostly
+// differ in their low bytes, and LZ4 matches far more of the planes than of the
+// interleaved data. planeStride of 1 sends the data as-is.
+static void WriteCompressedPayload(Serialiser *ser, const byte *data, size_t dataSize, uint32_t planeStride)
+{
+	if(data == NULL)
+		dataSize = 0;
+
+	if(planeStride == 0 || dataSize < planeStride)
+		planeStride = 1;
+
+	vector<byte> planes;
+	const byte *src = data;
+
+	if(planeStride > 1)
+	{
+		size_t numElems = dataSize/planeStride;
+
+		planes.resize(dataSize);
+
+		for(size_t i=0; i < numElems; i++)
+			for(uint32_t p=0; p < planeStride; p++)
+				planes[p*numElems + i] = data[i*planeStride + p];
+
+		// any trailing partial element is sent verbatim
+		for(size_t i=numElems*planeStride; i < dataSize; i++)
+			planes[i] = data[i];
+
+		src = &planes[0];
+	}
+
+	size_t compressedSize = 0;
+	byte *compressed = NULL;
+
+	if(dataSize > 0)
+	{
+		compressed = new byte[LZ4_compressBound((int)dataSize)];
+		compressedSize = (size_t)LZ4_compress((const char *)src, (char *)compressed, (int)dataSize);
+	}
+
+	ser->Serialise("", dataSize);
+	ser->Serialise("", planeStride);
+	ser->Serialise("", compressedSize);
+	if(compressedSize > 0)
+		ser->RawWriteBytes(compressed, compressedSize);
+
+	delete[] compressed;
+}
+
+// reads back a payload from WriteCompressedPayload into out. Returns false if the
+// payload was empty or failed to decompress
+static bool ReadCompressedPayload(Serialiser *ser, byte *&out, size_t &dataSize)
+{
+	uint32_t planeStride = 1;
+	size_t compressedSize = 0;
+
+	out = NULL;
+
+	ser->Serialise("", dataSize);
+	ser->Serialise("", planeStride);
+	ser->Serialise("", compressedSize);
+
+	if(compressedSize == 0 || dataSize == 0)
+	{
+		dataSize = 0;
+		return false;
+	}
+
+	const char *compressed = (const char *)ser->RawReadBytes(compressedSize);
+	if(compressed == NULL)
+	{
+		dataSize = 0;
+		return false;
+	}
+
+	byte *planes = new byte[dataSize];
+
+	int decompSize = LZ4_decompress_safe(compressed, (char *)planes, (int)compressedSize, (int)dataSize);
+
+	if(decompSize < 0 || (size_t)decompSize != dataSize)
+	{
+		RDCERR("Failed to decompress proxied data, got %d bytes, expected %llu", decompSize, (uint64_t)dataSize);
+		delete[] planes;
+		dataSize = 0;
+		return false;
+	}
+
+	if(planeStride <= 1)
+	{
+		out = planes;
+		return true;
+	}
+
+	out = new byte[dataSize];
+
+	size_t numElems = dataSize/planeStride;
+
+	for(size_t i=0; i < numElems; i++)
+		for(uint32_t p=0; p < planeStride; p++)
+			out[i*planeStride + p] = planes[p*numElems + i];
+
+	for(size_t i=numElems*planeStride; i < dataSize; i++)
+		out[i] = planes[i];
+
+	delete[] planes;
+
+	return true;
+}
+
+// bulk lists of descriptors are serialised on their own and sent as one compressed
+// payload, since the names and formats in them repeat a lot
+template<typename T>
+static void WriteCompressedList(Serialiser *ser, vector<T> &list)
+{
+	Serialiser listser(NULL, Serialiser::WRITING, false);
+	listser.Serialise("", list);
+
+	WriteCompressedPayload(ser, listser.GetRawPtr(0), (size_t)listser.GetOffset(), 1);
+}
+
+template<typename T>
+static void ReadCompressedList(Serialiser *ser, vector<T> &list)
+{
+	byte *data = NULL;
+	size_t dataSize = 0;
+
+	if(ReadCompressedPayload(ser, data, dataSize))
+	{
+		Serialiser listser(dataSize, data, false);
+		listser.Serialise("", list);
+	}
+
+	delete[] data;
+}
+
 ProxySerialiser::~ProxySerialiser()
 {
 	SAFE_DELETE(m_FromReplaySerialiser);
@@ -966,14 +1123,25 @@ bool ProxySerialiser::SendReplayCommand(CommandPacketType type)
 
 	m_ToReplaySerialiser->Rewind();
 
-	SAFE_DELETE(m_FromReplaySerialiser);
-
+	// the previous reply's serialiser is reused to receive this one
 	if(!RecvPacket(m_Socket, type, &m_FromReplaySerialiser))
 		return false;
 
 	return true;
 }
 
+ResourceId ProxySerialiser::GetProxyTexture(ResourceId texid)
+{
+	if(m_ProxyTextureIds.find(texid) == m_ProxyTextureIds.end())
+	{
+		FetchTexture tex = GetTexture(texid);
+		m_ProxyTextureIds[texid] = m_Proxy->CreateProxyTexture(tex);
+		m_ProxyTextureDetails[texid] = tex;
+	}
+
+	return m_ProxyTextureIds[texid];
+}
+
 void ProxySerialiser::EnsureTexCached(ResourceId texid, uint32_t arrayIdx, uint32_t mip)
 {
 	TextureCacheEntry entry = { texid, arrayIdx, mip };
@@ -983,13 +1151,7 @@ void ProxySerialiser::EnsureTexCached(ResourceId texid, uint32_t arrayIdx, uint3
 	
 	if(m_TextureProxyCache.find(entry) == m_TextureProxyCache.end())
 	{
-		if(m_ProxyTextureIds.find(texid) == m_ProxyTextureIds.end())
-		{
-			FetchTexture tex = GetTexture(texid);
-			m_ProxyTextureIds[texid] = m_Proxy->CreateProxyTexture(tex);
-		}
-
-		ResourceId proxyid = m_ProxyTextureIds[texid];
+		ResourceId proxyid = GetProxyTexture(texid);
 		
 		size_t size;
 		byte *data = GetTextureData(texid, arrayIdx, mip, false, false, 0.0f, 0.0f, size);
@@ -1000,9 +1162,130 @@ void ProxySerialiser::EnsureTexCached(ResourceId texid, uint32_t arrayIdx, uint3
 		delete[] data;
 
 		m_TextureProxyCache.insert(entry);
+		m_TextureTileCache.erase(entry);
 	}
 }
 
+void ProxySerialiser::EnsureTexRegionCached(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+	TextureCacheEntry entry = { texid, arrayIdx, mip };
+
+	if(m_LocalTextures.find(texid) != m_LocalTextures.end())
+		return;
+
+	if(m_TextureProxyCache.find(entry) != m_TextureProxyCache.end())
+		return;
+
+	ResourceId proxyid = GetProxyTexture(texid);
+	const FetchTexture &tex = m_ProxyTextureDetails[texid];
+
+	uint32_t mipWidth = RDCMAX(1U, tex.width>>mip);
+	uint32_t mipHeight = RDCMAX(1U, tex.height>>mip);
+
+	// small textures aren't worth the extra round trips
+	if(!TextureRegionSupported(tex) || uint64_t(mipWidth)*mipHeight < TiledTextureMinTexels)
+	{
+		EnsureTexCached(texid, arrayIdx, mip);
+		return;
+	}
+
+	if(x >= mipWidth || y >= mipHeight || width == 0 || height == 0)
+		return;
+
+	width = RDCMIN(width, mipWidth - x);
+	height = RDCMIN(height, mipHeight - y);
+
+	uint32_t tilesX = (mipWidth + TextureTileSize - 1)/TextureTileSize;
+
+	uint32_t tx0 = x/TextureTileSize, tx1 = (x + width - 1)/TextureTileSize;
+	uint32_t ty0 = y/TextureTileSize, ty1 = (y + height - 1)/TextureTileSize;
+
+	set<uint32_t> &tiles = m_TextureTileCache[entry];
+
+	// fetch the bounding box of the missing tiles in one go, so a view only costs one readback
+	uint32_t minx = ~0U, maxx = 0, miny = ~0U, maxy = 0;
+
+	for(uint32_t ty=ty0; ty <= ty1; ty++)
+	{
+		for(uint32_t tx=tx0; tx <= tx1; tx++)
+		{
+			if(tiles.find(ty*tilesX + tx) != tiles.end())
+				continue;
+
+			minx = RDCMIN(minx, tx); maxx = RDCMAX(maxx, tx);
+			miny = RDCMIN(miny, ty); maxy = RDCMAX(maxy, ty);
+		}
+	}
+
+	if(minx == ~0U)
+		return;
+
+	uint32_t rx = minx*TextureTileSize;
+	uint32_t ry = miny*TextureTileSize;
+	uint32_t rw = RDCMIN((maxx+1)*TextureTileSize, mipWidth) - rx;
+	uint32_t rh = RDCMIN((maxy+1)*TextureTileSize, mipHeight) - ry;
+
+	size_t size = 0;
+	byte *data = GetTextureDataRegion(texid, arrayIdx, mip, rx, ry, rw, rh, size);
+
+	// the remote couldn't read the region, fall back to fetching it all
+	if(data == NULL)
+	{
+		EnsureTexCached(texid, arrayIdx, mip);
+		return;
+	}
+
+	m_Proxy->SetProxyTextureRegion(proxyid, arrayIdx, mip, rx, ry, rw, rh, data, size);
+
+	delete[] data;
+
+	for(uint32_t ty=miny; ty <= maxy; ty++)
+		for(uint32_t tx=minx; tx <= maxx; tx++)
+			tiles.insert(ty*tilesX + tx);
+}
+
+void ProxySerialiser::EnsureTexVisibleCached(const TextureDisplay &cfg)
+{
+	if(m_LocalTextures.find(cfg.texid) != m_LocalTextures.end())
+		return;
+
+	GetProxyTexture(cfg.texid);
+	const FetchTexture &tex = m_ProxyTextureDetails[cfg.texid];
+
+	int32_t outWidth = 0, outHeight = 0;
+	m_Proxy->GetOutputWindowDimensions(m_BoundOutput, outWidth, outHeight);
+
+	// fit-to-window shows everything
+	if(cfg.scale <= 0.0f || outWidth <= 0 || outHeight <= 0)
+	{
+		EnsureTexCached(cfg.texid, cfg.sliceFace, cfg.mip);
+		return;
+	}
+
+	// the display offset and scale are relative to the top mip
+	float x0 = -cfg.offx/cfg.scale, x1 = (float(outWidth) - cfg.offx)/cfg.scale;
+	float y0 = -cfg.offy/cfg.scale, y1 = (float(outHeight) - cfg.offy)/cfg.scale;
+
+	if(cfg.FlipY)
+	{
+		float f0 = float(tex.height) - y1, f1 = float(tex.height) - y0;
+		y0 = f0; y1 = f1;
+	}
+
+	float mipScale = float(1U << cfg.mip);
+
+	x0 = RDCMAX(0.0f, floorf(x0/mipScale)); x1 = RDCMAX(0.0f, ceilf(x1/mipScale));
+	y0 = RDCMAX(0.0f, floorf(y0/mipScale)); y1 = RDCMAX(0.0f, ceilf(y1/mipScale));
+
+	// clamp before converting, the region itself is clamped to the mip size
+	x1 = RDCMIN(x1, float(tex.width)); y1 = RDCMIN(y1, float(tex.height));
+
+	if(x1 <= x0 || y1 <= y0)
+		return;
+
+	EnsureTexRegionCached(cfg.texid, cfg.sliceFace, cfg.mip, uint32_t(x0), uint32_t(y0), uint32_t(x1 - x0), uint32_t(y1 - y0));
+}
+
 void ProxySerialiser::EnsureBufCached(ResourceId bufid)
 {
 	if(m_BufferProxyCache.find(bufid) == m_BufferProxyCache.end())
@@ -1037,6 +1320,97 @@ bool ProxySerialiser::Tick()
 
 	m_FromReplaySerialiser->Rewind();
 
+	if(m_ResultCache == NULL)
+	{
+		DispatchCommand(type);
+	}
+	else if(type == eCommand_ReplayLog || type == eCommand_InitPostVS)
+	{
+		if(type == eCommand_ReplayLog)
+		{
+			uint32_t frameID = 0, startEventID = 0, endEventID = 0;
+			ReplayLogType replayType = eReplay_Full;
+			m_ToReplaySerialiser->Serialise("", frameID);
+			m_ToReplaySerialiser->Serialise("", startEventID);
+			m_ToReplaySerialiser->Serialise("", endEventID);
+			m_ToReplaySerialiser->Serialise("", replayType);
+
+			AdvanceReplayPosition(frameID, startEventID, endEventID, replayType);
+
+			// a replay from the start doesn't depend on any earlier ones still queued
+			if(m_ReplayPosValid)
+			{
+				for(size_t i=0; i < m_DeferredCommands.size(); )
+				{
+					if(m_DeferredCommands[i].type == eCommand_ReplayLog)
+						m_DeferredCommands.erase(m_DeferredCommands.begin()+i);
+					else
+						i++;
+				}
+			}
+		}
+		else
+		{
+			// replays to the event itself
+			m_ReplayPosValid = false;
+		}
+
+		DeferredCommand cmd;
+		cmd.type = type;
+		cmd.params.assign(m_ToReplaySerialiser->GetRawPtr(0), m_ToReplaySerialiser->GetRawPtr(0) + (size_t)m_ToReplaySerialiser->GetSize());
+		m_DeferredCommands.push_back(cmd);
+	}
+	else
+	{
+		ReplayResultCache::Key key;
+		bool cacheable = GetResultCacheKey(type, key);
+
+		const vector<byte> *reply = cacheable ? m_ResultCache->Find(key) : NULL;
+
+		if(reply)
+		{
+			if(!reply->empty())
+				m_FromReplaySerialiser->RawWriteBytes(&(*reply)[0], reply->size());
+		}
+		else
+		{
+			FlushDeferredCommands();
+
+			DispatchCommand(type);
+
+			if(cacheable)
+				m_ResultCache->Insert(key, m_FromReplaySerialiser->GetRawPtr(0), (size_t)m_FromReplaySerialiser->GetOffset());
+		}
+
+		// these replay internally, so afterwards (whether they ran or not) the remote isn't
+		// where the last ReplayLog left it
+		switch(type)
+		{
+			case eCommand_FetchCounters:
+			case eCommand_PixelHistory:
+			case eCommand_DebugVertex:
+			case eCommand_DebugPixel:
+			case eCommand_DebugThread:
+			case eCommand_RenderOverlay:
+			case eCommand_ReplaceResource:
+			case eCommand_RemoveReplacement:
+				m_ReplayPosValid = false;
+				break;
+			default:
+				break;
+		}
+	}
+
+	// m_ToReplaySerialiser is kept to receive the next command into
+
+	if(!SendPacket(m_Socket, type, *m_FromReplaySerialiser))
+		return false;
+
+	return true;
+}
+
+void ProxySerialiser::DispatchCommand(CommandPacketType type)
+{
 	switch(type)
 	{
 		case eCommand_SetCtxFilter:
@@ -1096,7 +1470,7 @@ bool ProxySerialiser::Tick()
 		case eCommand_FetchCounters:
 		{
 			vector<uint32_t> counters;
-			FetchCounters(0, 0, 0, counters);
+			FetchCounters(0, 0, 0, counters, 0);
 			break;
 		}
 		case eCommand_EnumerateCounters:
@@ -1118,6 +1492,15 @@ bool ProxySerialiser::Tick()
 		case eCommand_GetBufferData:
 			GetBufferData(ResourceId(), 0, 0);
 			break;
+		case eCommand_GetBufferDataStrided:
+			GetBufferDataStrided(ResourceId(), 0, 0, 0, 0);
+			break;
+		case eCommand_GetTextureDataRegion:
+		{
+			size_t dummy;
+			GetTextureDataRegion(ResourceId(), 0, 0, 0, 0, 0, 0, dummy);
+			break;
+		}
 		case eCommand_GetTextureData:
 		{
 			size_t dummy;
@@ -1162,15 +1545,111 @@ bool ProxySerialiser::Tick()
 			RDCERR("Unexpected command");
 			break;
 	}
+}
+
+void ProxySerialiser::FlushDeferredCommands()
+{
+	if(m_DeferredCommands.empty())
+		return;
+
+	Serialiser *command = m_ToReplaySerialiser;
+
+	for(size_t i=0; i < m_DeferredCommands.size(); i++)
+	{
+		const vector<byte> &params = m_DeferredCommands[i].params;
+
+		m_ToReplaySerialiser = new Serialiser(params.size(), params.empty() ? NULL : &params[0], false);
+
+		DispatchCommand(m_DeferredCommands[i].type);
+
+		SAFE_DELETE(m_ToReplaySerialiser);
+	}
 
-	SAFE_DELETE(m_ToReplaySerialiser);
+	m_ToReplaySerialiser = command;
 
-	if(!SendPacket(m_Socket, type, *m_FromReplaySerialiser))
+	m_DeferredCommands.clear();
+
+	// neither has a reply
+	m_FromReplaySerialiser->Rewind();
+}
+
+bool ProxySerialiser::GetResultCacheKey(CommandPacketType type, ReplayResultCache::Key &key)
+{
+	// replacements change everything downstream of them
+	if(!m_HostReplacements.empty())
 		return false;
 
+	key.capture = m_CaptureHash;
+	key.frameID = ~0U;
+	key.replayPos = ~0U;
+	key.command = (uint32_t)type;
+
+	switch(type)
+	{
+		// these read the state the replay left behind
+		case eCommand_GetTextureData:
+		case eCommand_GetBufferData:
+		case eCommand_GetBufferDataStrided:
+		case eCommand_GetTextureDataRegion:
+			if(!m_ReplayPosValid)
+				return false;
+			key.frameID = m_ReplayFrame;
+			key.replayPos = m_ReplayPos;
+			break;
+		// these are self-contained, only depending on their parameters
+		case eCommand_GetPostVS:
+		case eCommand_FetchCounters:
+			break;
+		default:
+			return false;
+	}
+
+	const byte *params = m_ToReplaySerialiser->GetRawPtr(0);
+	key.params.assign(params, params + (size_t)m_ToReplaySerialiser->GetSize());
+
 	return true;
 }
 
+const vector<byte> *ReplayResultCache::Find(const Key &key)
+{
+	auto it = m_Entries.find(key);
+	if(it == m_Entries.end())
+		return NULL;
+
+	it->second.lastUse = ++m_UseCounter;
+	return &it->second.reply;
+}
+
+void ReplayResultCache::Insert(const Key &key, const byte *reply, size_t size)
+{
+	if(key.params.size() + size > m_Budget)
+		return;
+
+	auto it = m_Entries.find(key);
+	if(it != m_Entries.end())
+	{
+		m_Size -= EntrySize(it->first, it->second);
+		m_Entries.erase(it);
+	}
+
+	Entry &entry = m_Entries[key];
+	entry.reply.assign(reply, reply + size);
+	entry.lastUse = ++m_UseCounter;
+	m_Size += EntrySize(key, entry);
+
+	// entries are large and few, so a linear search for the oldest is fine
+	while(m_Size > m_Budget)
+	{
+		auto oldest = m_Entries.begin();
+		for(auto it = m_Entries.begin(); it != m_Entries.end(); ++it)
+			if(it->second.lastUse < oldest->second.lastUse)
+				oldest = it;
+
+		m_Size -= EntrySize(oldest->first, oldest->second);
+		m_Entries.erase(oldest);
+	}
+}
+
 bool ProxySerialiser::IsRenderOutput(ResourceId id)
 {
 	for(int32_t i=0; i < m_D3D11PipelineState.m_OM.RenderTargets.count; i++)
@@ -1228,6 +1707,27 @@ vector<ResourceId> ProxySerialiser::GetTextures()
 
 	m_FromReplaySerialiser->Serialise("", ret);
 
+	// send every descriptor along with the IDs
+	vector<FetchTexture> descs;
+
+	if(m_ReplayHost)
+	{
+		descs.reserve(ret.size());
+		for(size_t i=0; i < ret.size(); i++)
+			descs.push_back(m_Remote->GetTexture(ret[i]));
+
+		WriteCompressedList(m_FromReplaySerialiser, descs);
+	}
+	else
+	{
+		ReadCompressedList(m_FromReplaySerialiser, descs);
+
+		RDCASSERT(descs.size() == ret.size());
+
+		for(size_t i=0; i < ret.size() && i < descs.size(); i++)
+			m_TextureInfoCache[ret[i]] = descs[i];
+	}
+
 	return ret;
 }
 
@@ -1253,6 +1753,13 @@ vector<DebugMessage> ProxySerialiser::GetDebugMessages()
 FetchTexture ProxySerialiser::GetTexture(ResourceId id)
 {
 	FetchTexture ret;
+
+	if(!m_ReplayHost)
+	{
+		auto it = m_TextureInfoCache.find(id);
+		if(it != m_TextureInfoCache.end())
+			return it->second;
+	}
 	
 	m_ToReplaySerialiser->Serialise("", id);
 
@@ -1287,12 +1794,40 @@ vector<ResourceId> ProxySerialiser::GetBuffers()
 
 	m_FromReplaySerialiser->Serialise("", ret);
 
+	// send every descriptor along with the IDs
+	vector<FetchBuffer> descs;
+
+	if(m_ReplayHost)
+	{
+		descs.reserve(ret.size());
+		for(size_t i=0; i < ret.size(); i++)
+			descs.push_back(m_Remote->GetBuffer(ret[i]));
+
+		WriteCompressedList(m_FromReplaySerialiser, descs);
+	}
+	else
+	{
+		ReadCompressedList(m_FromReplaySerialiser, descs);
+
+		RDCASSERT(descs.size() == ret.size());
+
+		for(size_t i=0; i < ret.size() && i < descs.size(); i++)
+			m_BufferInfoCache[ret[i]] = descs[i];
+	}
+
 	return ret;
 }
 
 FetchBuffer ProxySerialiser::GetBuffer(ResourceId id)
 {
 	FetchBuffer ret;
+
+	if(!m_ReplayHost)
+	{
+		auto it = m_BufferInfoCache.find(id);
+		if(it != m_BufferInfoCache.end())
+			return it->second;
+	}
 	
 	m_ToReplaySerialiser->Serialise("", id);
 
@@ -1331,6 +1866,77 @@ void ProxySerialiser::SavePipelineState()
 
 	m_FromReplaySerialiser->Serialise("", m_D3D11PipelineState);
 	m_FromReplaySerialiser->Serialise("", m_GLPipelineState);
+
+	// the UI looks up the live ID and reflection of every bound shader as soon as it has the
+	// state, so send those along with it. Each reflection is only ever sent once.
+	vector<ResourceId> origIDs, liveIDs, newShaders;
+
+	if(m_ReplayHost)
+	{
+		ResourceId bound[] = {
+			m_D3D11PipelineState.m_VS.Shader, m_D3D11PipelineState.m_HS.Shader, m_D3D11PipelineState.m_DS.Shader,
+			m_D3D11PipelineState.m_GS.Shader, m_D3D11PipelineState.m_PS.Shader, m_D3D11PipelineState.m_CS.Shader,
+			m_GLPipelineState.m_VS.Shader, m_GLPipelineState.m_TCS.Shader, m_GLPipelineState.m_TES.Shader,
+			m_GLPipelineState.m_GS.Shader, m_GLPipelineState.m_FS.Shader, m_GLPipelineState.m_CS.Shader,
+		};
+
+		for(size_t i=0; i < ARRAY_COUNT(bound); i++)
+		{
+			if(bound[i] == ResourceId())
+				continue;
+
+			ResourceId live = m_Remote->GetLiveID(bound[i]);
+
+			origIDs.push_back(bound[i]);
+			liveIDs.push_back(live);
+
+			if(live != ResourceId() && m_SentShaders.insert(live).second)
+				newShaders.push_back(live);
+		}
+	}
+
+	m_FromReplaySerialiser->Serialise("", origIDs);
+	m_FromReplaySerialiser->Serialise("", liveIDs);
+	m_FromReplaySerialiser->Serialise("", newShaders);
+
+	if(!m_ReplayHost)
+	{
+		for(size_t i=0; i < origIDs.size() && i < liveIDs.size(); i++)
+			m_LiveIDs[origIDs[i]] = liveIDs[i];
+	}
+
+	for(size_t i=0; i < newShaders.size(); i++)
+	{
+		ShaderReflection *refl = m_ReplayHost ? m_Remote->GetShader(newShaders[i]) : NULL;
+
+		bool hasrefl = (refl != NULL);
+		m_FromReplaySerialiser->Serialise("", hasrefl);
+
+		if(m_ReplayHost)
+		{
+			if(hasrefl)
+				m_FromReplaySerialiser->Serialise("", *refl);
+		}
+		else
+		{
+			if(hasrefl)
+			{
+				refl = new ShaderReflection();
+				m_FromReplaySerialiser->Serialise("", *refl);
+			}
+
+			auto it = m_ShaderReflectionCache.find(newShaders[i]);
+			if(it != m_ShaderReflectionCache.end())
+			{
+				delete it->second;
+				it->second = refl;
+			}
+			else
+			{
+				m_ShaderReflectionCache[newShaders[i]] = refl;
+			}
+		}
+	}
 }
 
 void ProxySerialiser::SetContextFilter(ResourceId id, uint32_t firstDefEv, uint32_t lastDefEv)
@@ -1366,14 +1972,127 @@ void ProxySerialiser::ReplayLog(uint32_t frameID, uint32_t startEventID, uint32_
 		if(!SendReplayCommand(eCommand_ReplayLog))
 			return;
 
-		m_TextureProxyCache.clear();
+		InvalidateTextureCache(frameID, startEventID, endEventID, replayType);
+
+		// buffers are updated with Map and similar between draws, which isn't tracked
+		// in the usage, so they're always re-fetched
 		m_BufferProxyCache.clear();
 	}
 }
 
+void ProxySerialiser::InvalidateTextureCache(uint32_t frameID, uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType)
+{
+	uint32_t oldPos = m_ReplayPos;
+
+	bool known = AdvanceReplayPosition(frameID, startEventID, endEventID, replayType);
+	uint32_t newPos = m_ReplayPos;
+
+	if(!known)
+	{
+		m_TextureProxyCache.clear();
+		m_TextureTileCache.clear();
+	}
+	else if(newPos != oldPos)
+	{
+		for(auto it = m_TextureProxyCache.begin(); it != m_TextureProxyCache.end(); )
+		{
+			// only GPU-written textures are kept, anything else might be updated from the
+			// CPU (UpdateSubresource, glTexSubImage) which doesn't show up in the usage
+			uint32_t flags = m_ProxyTextureDetails[it->replayid].creationFlags;
+			bool gpuWritten = (flags & (eTextureCreate_RTV|eTextureCreate_DSV|eTextureCreate_UAV)) != 0;
+
+			if(!gpuWritten || WrittenBetween(it->replayid, RDCMIN(newPos, oldPos), RDCMAX(newPos, oldPos)))
+				m_TextureProxyCache.erase(it++);
+			else
+				++it;
+		}
+
+		for(auto it = m_TextureTileCache.begin(); it != m_TextureTileCache.end(); )
+		{
+			uint32_t flags = m_ProxyTextureDetails[it->first.replayid].creationFlags;
+			bool gpuWritten = (flags & (eTextureCreate_RTV|eTextureCreate_DSV|eTextureCreate_UAV)) != 0;
+
+			if(!gpuWritten || WrittenBetween(it->first.replayid, RDCMIN(newPos, oldPos), RDCMAX(newPos, oldPos)))
+				m_TextureTileCache.erase(it++);
+			else
+				++it;
+		}
+	}
+}
+
+bool ProxySerialiser::AdvanceReplayPosition(uint32_t frameID, uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType)
+{
+	uint32_t newPos = 2*endEventID;
+	bool known = m_ReplayPosValid && frameID == m_ReplayFrame && startEventID == 0;
+
+	if(replayType == eReplay_WithoutDraw || replayType == eReplay_WithoutDrawIncremental)
+	{
+		newPos = endEventID > 0 ? 2*endEventID - 1 : 0;
+	}
+	else if(replayType == eReplay_OnlyDraw)
+	{
+		// the draw is executed on top of whatever state is there, so we only know the result
+		// if that was just before this event
+		known = known && m_ReplayPos + 1 == newPos;
+	}
+
+	// a full replay from the start gives a known position whatever came before
+	bool newKnown = (startEventID == 0) && (replayType != eReplay_OnlyDraw || known);
+
+	m_ReplayPosValid = newKnown;
+	m_ReplayFrame = frameID;
+	m_ReplayPos = newPos;
+
+	return known;
+}
+
+bool ProxySerialiser::WrittenBetween(ResourceId id, uint32_t fromPos, uint32_t toPos)
+{
+	vector<EventUsage> usage = GetUsage(id);
+
+	for(size_t i=0; i < usage.size(); i++)
+	{
+		uint32_t pos = 2*usage[i].eventID;
+
+		if(pos <= fromPos || pos > toPos)
+			continue;
+
+		switch(usage[i].usage)
+		{
+			case eUsage_SO:
+			case eUsage_VS_RWResource:
+			case eUsage_HS_RWResource:
+			case eUsage_DS_RWResource:
+			case eUsage_GS_RWResource:
+			case eUsage_PS_RWResource:
+			case eUsage_CS_RWResource:
+			case eUsage_ColourTarget:
+			case eUsage_DepthStencilTarget:
+			case eUsage_Clear:
+			case eUsage_GenMips:
+			case eUsage_Resolve:
+			case eUsage_ResolveDst:
+			case eUsage_Copy:
+			case eUsage_CopyDst:
+				return true;
+			default:
+				break;
+		}
+	}
+
+	return false;
+}
+
 vector<EventUsage> ProxySerialiser::GetUsage(ResourceId id)
 {
 	vector<EventUsage> ret;
+
+	if(!m_ReplayHost)
+	{
+		auto it = m_UsageCache.find(id);
+		if(it != m_UsageCache.end())
+			return it->second;
+	}
 	
 	m_ToReplaySerialiser->Serialise("", id);
 
@@ -1389,6 +2108,9 @@ vector<EventUsage> ProxySerialiser::GetUsage(ResourceId id)
 
 	m_FromReplaySerialiser->Serialise("", ret);
 
+	if(!m_ReplayHost)
+		m_UsageCache[id] = ret;
+
 	return ret;
 }
 
@@ -1468,7 +2190,7 @@ ResourceId ProxySerialiser::GetLiveID(ResourceId id)
 	return ret;
 }
 
-vector<CounterResult> ProxySerialiser::FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters)
+vector<CounterResult> ProxySerialiser::FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters, uint32_t numRuns)
 {
 	vector<CounterResult> ret;
 	
@@ -1476,10 +2198,13 @@ vector<CounterResult> ProxySerialiser::FetchCounters(uint32_t frameID, uint32_t
 	m_ToReplaySerialiser->Serialise("", minEventID);
 	m_ToReplaySerialiser->Serialise("", maxEventID);
 	m_ToReplaySerialiser->Serialise("", (vector<uint32_t> &)counters);
+	m_ToReplaySerialiser->Serialise("", numRuns);
 
 	if(m_ReplayHost)
 	{
-		ret = m_Remote->FetchCounters(frameID, minEventID, maxEventID, counters);
+		// the runs are repeated here on the host, so they're all real replays rather
+		// than cached copies of the first
+		ret = m_Remote->FetchCounters(frameID, minEventID, maxEventID, counters, numRuns);
 	}
 	else
 	{
@@ -1565,20 +2290,56 @@ vector<byte> ProxySerialiser::GetBufferData(ResourceId buff, uint32_t offset, ui
 	if(m_ReplayHost)
 	{
 		ret = m_Remote->GetBufferData(buff, offset, len);
-	
-		size_t sz = ret.size();
-		m_FromReplaySerialiser->Serialise("", sz);
-		m_FromReplaySerialiser->RawWriteBytes(&ret[0], sz);
+
+		// buffers are mostly vertex data or structures of 32-bit values
+		WriteCompressedPayload(m_FromReplaySerialiser, ret.empty() ? NULL : &ret[0], ret.size(), sizeof(uint32_t));
 	}
 	else
 	{
 		if(!SendReplayCommand(eCommand_GetBufferData))
 			return ret;
+
+		byte *data = NULL;
+		size_t sz = 0;
+
+		if(ReadCompressedPayload(m_FromReplaySerialiser, data, sz))
+			ret.assign(data, data+sz);
+
+		delete[] data;
+	}
+
+	return ret;
+}
+
+vector<byte> ProxySerialiser::GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows)
+{
+	vector<byte> ret;
+	
+	m_ToReplaySerialiser->Serialise("", buff);
+	m_ToReplaySerialiser->Serialise("", offset);
+	m_ToReplaySerialiser->Serialise("", stride);
+	m_ToReplaySerialiser->Serialise("", rowSize);
+	m_ToReplaySerialiser->Serialise("", numRows);
 	
+	if(m_ReplayHost)
+	{
+		// rows are packed on the host, so only the requested rows cross the connection
+		ret = m_Remote->GetBufferDataStrided(buff, offset, stride, rowSize, numRows);
+
+		WriteCompressedPayload(m_FromReplaySerialiser, ret.empty() ? NULL : &ret[0], ret.size(), sizeof(uint32_t));
+	}
+	else
+	{
+		if(!SendReplayCommand(eCommand_GetBufferDataStrided))
+			return ret;
+
+		byte *data = NULL;
 		size_t sz = 0;
-		m_FromReplaySerialiser->Serialise("", sz);
-		ret.resize(sz);
-		memcpy(&ret[0], m_FromReplaySerialiser->RawReadBytes(sz), sz);
+
+		if(ReadCompressedPayload(m_FromReplaySerialiser, data, sz))
+			ret.assign(data, data+sz);
+
+		delete[] data;
 	}
 
 	return ret;
@@ -1599,32 +2360,75 @@ byte *ProxySerialiser::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_
 	{
 		byte *data = m_Remote->GetTextureData(tex, arrayIdx, mip, resolve, forceRGBA8unorm, blackPoint, whitePoint, dataSize);
 
-		byte *compressed = new byte[dataSize+512];
-		
-		size_t compressedSize = (size_t)LZ4_compress((const char *)data, (char *)compressed, (int)dataSize);
-	
-		m_FromReplaySerialiser->Serialise("", dataSize);
-		m_FromReplaySerialiser->Serialise("", compressedSize);
-		m_FromReplaySerialiser->RawWriteBytes(compressed, compressedSize);
+		// split 16 and 32-bit component formats into byte planes
+		uint32_t planeStride = 1;
+
+		if(!forceRGBA8unorm)
+		{
+			FetchTexture fetch = m_Remote->GetTexture(tex);
+			if(!fetch.format.special && (fetch.format.compByteWidth == 2 || fetch.format.compByteWidth == 4))
+				planeStride = fetch.format.compByteWidth;
+		}
+
+		WriteCompressedPayload(m_FromReplaySerialiser, data, dataSize, planeStride);
 
 		delete[] data;
-		delete[] compressed;
 	}
 	else
 	{
 		if(!SendReplayCommand(eCommand_GetTextureData))
 			return NULL;
 
-		size_t compressedSize;
+		byte *ret = NULL;
+		ReadCompressedPayload(m_FromReplaySerialiser, ret, dataSize);
+
+		return ret;
+	}
+
+	return NULL;
+}
+
+byte *ProxySerialiser::GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize)
+{
+	m_ToReplaySerialiser->Serialise("", tex);
+	m_ToReplaySerialiser->Serialise("", arrayIdx);
+	m_ToReplaySerialiser->Serialise("", mip);
+	m_ToReplaySerialiser->Serialise("", x);
+	m_ToReplaySerialiser->Serialise("", y);
+	m_ToReplaySerialiser->Serialise("", width);
+	m_ToReplaySerialiser->Serialise("", height);
+
+	if(m_ReplayHost)
+	{
+		dataSize = 0;
+		byte *data = m_Remote->GetTextureDataRegion(tex, arrayIdx, mip, x, y, width, height, dataSize);
 
-		m_FromReplaySerialiser->Serialise("", dataSize);
-		m_FromReplaySerialiser->Serialise("", compressedSize);
+		// split 16 and 32-bit component formats into byte planes, as for whole subresources
+		uint32_t planeStride = 1;
 
-		byte *ret = new byte[dataSize+512];
+		FetchTexture fetch = m_Remote->GetTexture(tex);
+		if(!fetch.format.special && (fetch.format.compByteWidth == 2 || fetch.format.compByteWidth == 4))
+			planeStride = fetch.format.compByteWidth;
 
-		byte *compressed = (byte *)m_FromReplaySerialiser->RawReadBytes(compressedSize);
+		// an empty payload tells the other side the region couldn't be read
+		WriteCompressedPayload(m_FromReplaySerialiser, data, data ? dataSize : 0, planeStride);
 
-		size_t uncompSize = (size_t)LZ4_decompress_fast((const char *)compressed, (char *)ret, (int)dataSize);
+		delete[] data;
+	}
+	else
+	{
+		if(!SendReplayCommand(eCommand_GetTextureDataRegion))
+			return NULL;
+
+		byte *ret = NULL;
+		dataSize = 0;
+		ReadCompressedPayload(m_FromReplaySerialiser, ret, dataSize);
+
+		if(dataSize == 0)
+		{
+			delete[] ret;
+			return NULL;
+		}
 
 		return ret;
 	}
@@ -1696,6 +2500,26 @@ ResourceId ProxySerialiser::RenderOverlay(ResourceId texid, TextureDisplayOverla
 
 	m_FromReplaySerialiser->Serialise("", ret);
 
+	// the overlay is rendered outside of any event, so whatever we had cached is stale
+	if(!m_ReplayHost)
+	{
+		for(auto it = m_TextureProxyCache.begin(); it != m_TextureProxyCache.end(); )
+		{
+			if(it->replayid == ret)
+				m_TextureProxyCache.erase(it++);
+			else
+				++it;
+		}
+
+		for(auto it = m_TextureTileCache.begin(); it != m_TextureTileCache.end(); )
+		{
+			if(it->first.replayid == ret)
+				m_TextureTileCache.erase(it++);
+			else
+				++it;
+		}
+	}
+
 	return ret;
 }
 
@@ -1713,6 +2537,8 @@ ShaderReflection *ProxySerialiser::GetShader(ResourceId id)
 		if(hasrefl)
 			m_FromReplaySerialiser->Serialise("", *refl);
 
+		m_SentShaders.insert(id);
+
 		return NULL;
 	}
 
@@ -1859,11 +2685,15 @@ void ProxySerialiser::ReplaceResource(ResourceId from, ResourceId to)
 	if(m_ReplayHost)
 	{
 		m_Remote->ReplaceResource(from, to);
+		m_HostReplacements.insert(from);
 	}
 	else
 	{
 		if(!SendReplayCommand(eCommand_ReplaceResource))
 			return;
+
+		// replacements change what every event writes
+		m_ReplayPosValid = false;
 	}
 }
 
@@ -1874,11 +2704,15 @@ void ProxySerialiser::RemoveReplacement(ResourceId id)
 	if(m_ReplayHost)
 	{
 		m_Remote->RemoveReplacement(id);
+		m_HostReplacements.erase(id);
 	}
 	else
 	{
 		if(!SendReplayCommand(eCommand_RemoveReplacement))
 			return;
+
+		// replacements change what every event writes
+		m_ReplayPosValid = false;
 	}
 }
 
@@ -78,6 +78,60 @@ enum CommandPacketType
 	eCommand_GetAPIProperties,
 	
 	eCommand_PixelHistory,
+
+	eCommand_GetBufferDataStrided,
+	eCommand_GetTextureDataRegion,
+};
+
+// On the replay host, replies to the expensive read-only commands (texture and buffer
+// contents, post-transform data, counters) so that asking again - from the same client or a
+// later connection with the same capture - doesn't redo the GPU work. Replies are keyed on
+// the capture's hash, the replay position where the reply depends on it, the command and its
+// exact serialised parameters. The least recently used are evicted to stay under the budget.
+class ReplayResultCache
+{
+	public:
+		ReplayResultCache(uint64_t budget) : m_Budget(budget), m_Size(0), m_UseCounter(0) {}
+
+		struct Key
+		{
+			uint64_t capture;
+			uint32_t frameID;
+			uint32_t replayPos;
+			uint32_t command;
+			vector<byte> params;
+
+			bool operator <(const Key &o) const
+			{
+				if(capture != o.capture)
+					return capture < o.capture;
+				if(frameID != o.frameID)
+					return frameID < o.frameID;
+				if(replayPos != o.replayPos)
+					return replayPos < o.replayPos;
+				if(command != o.command)
+					return command < o.command;
+				return params < o.params;
+			}
+		};
+
+		// returns NULL if there's no reply for this key
+		const vector<byte> *Find(const Key &key);
+		void Insert(const Key &key, const byte *reply, size_t size);
+
+	private:
+		struct Entry
+		{
+			vector<byte> reply;
+			uint64_t lastUse;
+		};
+
+		map<Key, Entry> m_Entries;
+		uint64_t m_Budget;
+		uint64_t m_Size;
+		uint64_t m_UseCounter;
+
+		static uint64_t EntrySize(const Key &key, const Entry &entry) { return key.params.size() + entry.reply.size(); }
 };
 
 // This class implements IReplayDriver and StackResolver. On the local machine where the UI
@@ -95,6 +149,11 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 			m_FromReplaySerialiser = NULL;
 			m_ToReplaySerialiser = new Serialiser(NULL, Serialiser::WRITING, false);
 			m_RemoteHasResolver = false;
+			m_BoundOutput = 0;
+			m_ReplayPosValid = false;
+			m_ReplayFrame = m_ReplayPos = 0;
+			m_ResultCache = NULL;
+			m_CaptureHash = 0;
 		}
 
 		ProxySerialiser(Network::Socket *sock, IRemoteDriver *remote)
@@ -103,11 +162,26 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 			m_ToReplaySerialiser = NULL;
 			m_FromReplaySerialiser = new Serialiser(NULL, Serialiser::WRITING, false);
 			m_RemoteHasResolver = false;
+			m_BoundOutput = 0;
+			m_ReplayPosValid = false;
+			m_ReplayFrame = m_ReplayPos = 0;
+			m_ResultCache = NULL;
+			m_CaptureHash = 0;
+		}
+
+		// on the replay host, serve repeated queries for this capture from cache. The cache
+		// is owned by the caller and can outlive this connection.
+		void SetResultCache(ReplayResultCache *cache, uint64_t captureHash)
+		{
+			m_ResultCache = cache;
+			m_CaptureHash = captureHash;
 		}
 
 		virtual ~ProxySerialiser();
 
 		bool IsRemoteProxy() { return !m_ReplayHost; }
+		// results from a remote host aren't kept between sessions
+		uint64_t GetReplayDeviceHash() { return 0; }
 		void Shutdown() { delete this; }
 		
 		void ReadLogInitialisation() {}
@@ -146,6 +220,7 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 		}
 		void BindOutputWindow(uint64_t id, bool depth)
 		{
+			m_BoundOutput = id;
 			if(m_Proxy)
 				return m_Proxy->BindOutputWindow(id, depth);
 		}
@@ -199,7 +274,7 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 		{
 			if(m_Proxy)
 			{
-				EnsureTexCached(cfg.texid, cfg.sliceFace, cfg.mip);
+				EnsureTexVisibleCached(cfg);
 				cfg.texid = m_ProxyTextureIds[cfg.texid];
 				return m_Proxy->RenderTexture(cfg);
 			}
@@ -211,7 +286,7 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 		{
 			if(m_Proxy)
 			{
-				EnsureTexCached(texture, sliceFace, mip);
+				EnsureTexRegionCached(texture, sliceFace, mip, x>>mip, y>>mip, 1, 1);
 				m_Proxy->PickPixel(m_ProxyTextureIds[texture], x, y, sliceFace, mip, sample, pixel);
 			}
 		}
@@ -317,12 +392,14 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 		
 		vector<uint32_t> EnumerateCounters();
 		void DescribeCounter(uint32_t counterID, CounterDescription &desc);
-		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counterID);
+		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counterID, uint32_t numRuns);
 		
 		void FillCBufferVariables(ResourceId shader, uint32_t cbufSlot, vector<ShaderVariable> &outvars, const vector<byte> &data);
 		
 		vector<byte> GetBufferData(ResourceId buff, uint32_t offset, uint32_t len);
+		vector<byte> GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows);
 		byte *GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip, bool resolve, bool forceRGBA8unorm, float blackPoint, float whitePoint, size_t &dataSize);
+		byte *GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize);
 		
 		void InitPostVSBuffers(uint32_t frameID, uint32_t eventID);
 		MeshFormat GetPostVSBuffers(uint32_t frameID, uint32_t eventID, uint32_t instID, MeshDataStage stage);
@@ -360,6 +437,11 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 			RDCERR("Calling proxy-render functions on a proxy serialiser");
 		}
 
+		void SetProxyTextureRegion(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, byte *data, size_t dataSize)
+		{
+			RDCERR("Calling proxy-render functions on a proxy serialiser");
+		}
+
 		ResourceId CreateProxyBuffer(FetchBuffer templateBuf)
 		{
 			RDCERR("Calling proxy-render functions on a proxy serialiser");
@@ -374,7 +456,10 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 	private:
 		bool SendReplayCommand(CommandPacketType type);
 
+		ResourceId GetProxyTexture(ResourceId texid);
 		void EnsureTexCached(ResourceId texid, uint32_t arrayIdx, uint32_t mip);
+		void EnsureTexRegionCached(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+		void EnsureTexVisibleCached(const TextureDisplay &cfg);
 		void EnsureBufCached(ResourceId bufid);
 
 		struct TextureCacheEntry
@@ -395,6 +480,48 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 		set<TextureCacheEntry> m_TextureProxyCache;
 		set<ResourceId> m_LocalTextures;
 		map<ResourceId, ResourceId> m_ProxyTextureIds;
+		map<ResourceId, FetchTexture> m_ProxyTextureDetails;
+
+		// large textures are fetched in tiles, only as they're displayed or picked, rather than a
+		// whole subresource at a time. Each subresource that's partly fetched has the set of
+		// tiles (in row-major order) that are up to date, and moves to m_TextureProxyCache above
+		// if it's ever fetched whole.
+		static const uint32_t TextureTileSize = 256;
+		static const uint64_t TiledTextureMinTexels = 2048*2048;
+		map<TextureCacheEntry, set<uint32_t> > m_TextureTileCache;
+		uint64_t m_BoundOutput;
+
+		// where the last ReplayLog left the remote, in half-event steps: 2*eventID once that
+		// event has executed, 2*eventID-1 when replayed up to just before it. While this is
+		// known, cached render targets only need to be dropped if they were written between
+		// the old and new positions.
+		bool m_ReplayPosValid;
+		uint32_t m_ReplayFrame;
+		uint32_t m_ReplayPos;
+
+		// returns whether the position before this replay was known
+		bool AdvanceReplayPosition(uint32_t frameID, uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType);
+		void InvalidateTextureCache(uint32_t frameID, uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType);
+		bool WrittenBetween(ResourceId id, uint32_t fromPos, uint32_t toPos);
+
+		// on the replay host, commands are only executed when their result isn't cached. ReplayLog
+		// and InitPostVS have no reply, so with a cache they're queued until a command needs them
+		// and a run of cache hits never replays at all. m_ReplayPos* above track the position the
+		// client asked for, which is what cached replies are keyed on.
+		ReplayResultCache *m_ResultCache;
+		uint64_t m_CaptureHash;
+		set<ResourceId> m_HostReplacements;
+
+		struct DeferredCommand
+		{
+			CommandPacketType type;
+			vector<byte> params;
+		};
+		vector<DeferredCommand> m_DeferredCommands;
+
+		void DispatchCommand(CommandPacketType type);
+		void FlushDeferredCommands();
+		bool GetResultCacheKey(CommandPacketType type, ReplayResultCache::Key &key);
 		
 		set<ResourceId> m_BufferProxyCache;
 		map<ResourceId, ResourceId> m_ProxyBufferIds;
@@ -403,6 +530,17 @@ class ProxySerialiser : public IReplayDriver, Callstack::StackResolver
 
 		map<ResourceId, ShaderReflection *> m_ShaderReflectionCache;
 
+		// on the replay host, the shaders whose reflection has already been sent
+		set<ResourceId> m_SentShaders;
+
+		// usage is fixed once the log has been read, so each resource's is only fetched once
+		map<ResourceId, vector<EventUsage> > m_UsageCache;
+
+		// texture and buffer descriptors arrive in bulk with GetTextures/GetBuffers, instead
+		// of one round trip per resource when opening a log
+		map<ResourceId, FetchTexture> m_TextureInfoCache;
+		map<ResourceId, FetchBuffer> m_BufferInfoCache;
+
 		Network::Socket *m_Socket;
 		Serialiser *m_FromReplaySerialiser;
 		Serialiser *m_ToReplaySerialiser;
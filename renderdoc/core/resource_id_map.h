@@ -0,0 +1,241 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Crytek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include "common/common.h"
+
+#include "api/replay/renderdoc_replay.h"
+
+#include <vector>
+#include <utility>
+
+// an open-addressing hash map keyed by ResourceId, for the lookups that happen on
+// nearly every captured call or replayed chunk. It has the subset of the std::map
+// interface that the resource manager uses, with some differences:
+//
+// * iteration order is arbitrary, not sorted by ID.
+// * inserting (via operator[]) can invalidate all iterators. Erasing never moves
+//   other elements, so it's safe to erase while iterating as with std::map.
+// * values are default constructed in unused slots, so should be cheap to create.
+template<typename V>
+class ResourceIdMap
+{
+	private:
+		enum SlotState
+		{
+			eSlot_Empty = 0,
+			eSlot_Full,
+			eSlot_Erased,
+		};
+
+	public:
+		typedef std::pair<ResourceId, V> value_type;
+
+		class iterator
+		{
+			public:
+				iterator() : m_Map(NULL), m_Idx(0) {}
+
+				value_type &operator*() const { return m_Map->m_Slots[m_Idx]; }
+				value_type *operator->() const { return &m_Map->m_Slots[m_Idx]; }
+
+				iterator &operator++()
+				{
+					m_Idx = m_Map->NextFull(m_Idx+1);
+					return *this;
+				}
+
+				bool operator ==(const iterator &o) const { return m_Idx == o.m_Idx; }
+				bool operator !=(const iterator &o) const { return m_Idx != o.m_Idx; }
+
+			private:
+				friend class ResourceIdMap;
+				iterator(ResourceIdMap *m, size_t idx) : m_Map(m), m_Idx(idx) {}
+
+				ResourceIdMap *m_Map;
+				size_t m_Idx;
+		};
+
+		ResourceIdMap() : m_Size(0), m_Used(0), m_FirstFull(0) {}
+
+		iterator begin()
+		{
+			// erasing from the front repeatedly (e.g. while releasing everything) would make
+			// this quadratic if we always scanned from the start, so remember where we got to.
+			m_FirstFull = NextFull(m_FirstFull);
+			return iterator(this, m_FirstFull);
+		}
+
+		iterator end() { return iterator(this, m_Slots.size()); }
+
+		size_t size() const { return m_Size; }
+		bool empty() const { return m_Size == 0; }
+
+		iterator find(ResourceId id)
+		{
+			size_t idx = FindSlot(id);
+			return iterator(this, idx);
+		}
+
+		V &operator[](ResourceId id)
+		{
+			size_t idx = FindSlot(id);
+
+			if(idx != m_Slots.size())
+				return m_Slots[idx].second;
+
+			// keep at most 3/4 of the slots in use, counting erased ones, so probes stay short
+			if((m_Used+1)*4 > m_Slots.size()*3)
+				Rehash(RDCMAX((size_t)16, m_Size*4));
+
+			size_t mask = m_Slots.size()-1;
+			idx = Hash(id) & mask;
+
+			while(m_States[idx] == eSlot_Full)
+				idx = (idx+1) & mask;
+
+			if(m_States[idx] == eSlot_Empty)
+				m_Used++;
+
+			m_States[idx] = eSlot_Full;
+			m_Slots[idx].first = id;
+			m_Slots[idx].second = V();
+			m_Size++;
+
+			if(idx < m_FirstFull)
+				m_FirstFull = idx;
+
+			return m_Slots[idx].second;
+		}
+
+		void erase(iterator it)
+		{
+			if(it.m_Idx >= m_Slots.size() || m_States[it.m_Idx] != eSlot_Full)
+				return;
+
+			// leave a marker so that probes for other IDs continue past this slot
+			m_States[it.m_Idx] = eSlot_Erased;
+			m_Slots[it.m_Idx].second = V();
+			m_Size--;
+		}
+
+		size_t erase(ResourceId id)
+		{
+			iterator it = find(id);
+			if(it == end())
+				return 0;
+
+			erase(it);
+			return 1;
+		}
+
+		void clear()
+		{
+			m_Slots.clear();
+			m_States.clear();
+			m_Size = m_Used = 0;
+			m_FirstFull = 0;
+		}
+
+	private:
+		std::vector<value_type> m_Slots;
+		std::vector<byte> m_States;
+
+		// number of full slots, and of slots that are full or erased
+		size_t m_Size, m_Used;
+
+		// no full slot is before this index
+		size_t m_FirstFull;
+
+		static size_t Hash(ResourceId id)
+		{
+			// IDs are mostly sequential, so spread them with a multiplicative hash
+			uint64_t h = id.id * 0x9E3779B97F4A7C15ULL;
+			return (size_t)(h ^ (h >> 32));
+		}
+
+		size_t NextFull(size_t idx) const
+		{
+			while(idx < m_States.size() && m_States[idx] != eSlot_Full)
+				idx++;
+			return idx;
+		}
+
+		// returns the slot holding id, or m_Slots.size() if it's not present
+		size_t FindSlot(ResourceId id) const
+		{
+			if(m_Slots.empty())
+				return 0;
+
+			size_t mask = m_Slots.size()-1;
+			size_t idx = Hash(id) & mask;
+
+			while(m_States[idx] != eSlot_Empty)
+			{
+				if(m_States[idx] == eSlot_Full && m_Slots[idx].first == id)
+					return idx;
+
+				idx = (idx+1) & mask;
+			}
+
+			return m_Slots.size();
+		}
+
+		void Rehash(size_t minCapacity)
+		{
+			size_t capacity = 16;
+			while(capacity < minCapacity)
+				capacity *= 2;
+
+			std::vector<value_type> oldSlots;
+			std::vector<byte> oldStates;
+			oldSlots.swap(m_Slots);
+			oldStates.swap(m_States);
+
+			m_Slots.resize(capacity);
+			m_States.resize(capacity, (byte)eSlot_Empty);
+			m_Used = m_Size;
+			m_FirstFull = capacity;
+
+			size_t mask = capacity-1;
+
+			for(size_t i=0; i < oldSlots.size(); i++)
+			{
+				if(oldStates[i] != eSlot_Full)
+					continue;
+
+				size_t idx = Hash(oldSlots[i].first) & mask;
+				while(m_States[idx] == eSlot_Full)
+					idx = (idx+1) & mask;
+
+				m_States[idx] = eSlot_Full;
+				m_Slots[idx] = oldSlots[i];
+
+				if(idx < m_FirstFull)
+					m_FirstFull = idx;
+			}
+		}
+};
@@ -55,7 +55,8 @@ void ResourceRecord::Delete(ResourceRecordHandler *mgr)
 		{
 			if(it->second == eFrameRef_Write ||
 				it->second == eFrameRef_ReadAndWrite ||
-				it->second == eFrameRef_ReadBeforeWrite)
+				it->second == eFrameRef_ReadBeforeWrite ||
+				it->second == eFrameRef_CompleteWrite)
 			{
 				// lost a write to this resource, must mark it as gpu dirty.
 				mgr->MarkPendingDirty(it->first);
@@ -82,3 +83,106 @@ void ResourceRecord::Delete(ResourceRecordHandler *mgr)
 }
 
 
+
+string FindInitialDataBase(const string &base, const string &referencingLog)
+{
+	string path = base;
+
+	// if the logs have been moved since they were captured, they're probably still together
+	FILE *f = FileIO::fopen(path.c_str(), "rb");
+	if(f == NULL)
+	{
+		size_t baseSep = base.find_last_of("/\\");
+		size_t refSep = referencingLog.find_last_of("/\\");
+
+		path = base.substr(baseSep == string::npos ? 0 : baseSep+1);
+		if(refSep != string::npos)
+			path = referencingLog.substr(0, refSep+1) + path;
+
+		f = FileIO::fopen(path.c_str(), "rb");
+	}
+
+	if(f == NULL)
+		return "";
+
+	FileIO::fclose(f);
+
+	return path;
+}
+
+static string FindMissingInitialDataBase(Serialiser *ser, set<string> &checked, uint32_t depth)
+{
+	set<string> bases;
+
+	ser->Rewind();
+
+	while(!ser->AtEnd())
+	{
+		ser->SkipToChunk(INITIAL_CONTENTS_DATA);
+
+		if(ser->AtEnd())
+			break;
+
+		ser->PushContext(NULL, INITIAL_CONTENTS_DATA, false);
+
+		uint64_t chunkStart = ser->GetOffset();
+
+		ResourceId Id = ResourceId();
+		uint32_t Index = 0;
+		uint64_t Length = 0;
+		string BaseLog;
+
+		ser->Serialise("Id", Id);
+		ser->Serialise("Index", Index);
+		ser->Serialise("Length", Length);
+		ser->SerialiseString("BaseLog", BaseLog);
+
+		if(!BaseLog.empty())
+			bases.insert(BaseLog);
+
+		ser->SetOffset(chunkStart);
+		ser->SkipCurrentChunk();
+
+		ser->PopContext(NULL, INITIAL_CONTENTS_DATA);
+	}
+
+	ser->Rewind();
+
+	for(auto it=bases.begin(); it != bases.end(); ++it)
+	{
+		string path = FindInitialDataBase(*it, ser->GetFilename());
+
+		if(path.empty())
+			return *it;
+
+		// the same log can be reached through several chains of deltas
+		if(checked.find(path) != checked.end())
+			continue;
+
+		checked.insert(path);
+
+		// writing never chains more deltas than this, so a longer chain must be a loop
+		if(depth >= MaxInitialDataDeltas)
+			return *it;
+
+		Serialiser baseSer(path.c_str(), Serialiser::READING, false);
+
+		if(baseSer.HasError())
+			return *it;
+
+		baseSer.SetDebugText(false);
+
+		string missing = FindMissingInitialDataBase(&baseSer, checked, depth+1);
+
+		if(!missing.empty())
+			return missing;
+	}
+
+	return "";
+}
+
+string FindMissingInitialDataBase(Serialiser *ser)
+{
+	set<string> checked;
+	return FindMissingInitialDataBase(ser, checked, 0);
+}
@@ -33,9 +33,12 @@
 
 #include "serialise/serialiser.h"
 #include "common/threading.h"
+#include "core/resource_id_map.h"
 
 #include <set>
 #include <map>
+#include <vector>
+#include <algorithm>
 using std::set;
 using std::map;
 
@@ -53,6 +56,11 @@ enum FrameRefType
 	eFrameRef_ReadOnly,
 	eFrameRef_ReadAndWrite,
 	eFrameRef_ReadBeforeWrite,
+
+	// Input and state - the whole resource was overwritten (e.g. a full clear) before anything
+	// read it, so its contents at the start of the frame are irrelevant. Any later reference
+	// leaves this state alone.
+	eFrameRef_CompleteWrite,
 };
 
 class ResourceRecordHandler
@@ -62,8 +70,25 @@ class ResourceRecordHandler
 		virtual void MarkPendingDirty(ResourceId id) = 0;
 		virtual void RemoveResourceRecord(ResourceId id) = 0;
 		virtual void MarkResourceFrameReferenced(ResourceId id, FrameRefType refType) = 0;
+
+		// changes whenever resources can stop being dirty or modified. A record marked dirty in
+		// the current epoch doesn't need to be marked again.
+		virtual int32_t GetDirtyEpoch() = 0;
 };
 
+// initial contents written with the DeltaInitialContents option only store the blocks that
+// changed, and refer back to the earlier log holding the rest. After this many deltas in a row
+// the data is written in full again, so a log never depends on more than this many others.
+static const uint32_t MaxInitialDataDeltas = 8;
+
+// finds the base log of a delta as it was written, or next to referencingLog if the logs have
+// been moved together. Returns an empty string if it can't be found.
+string FindInitialDataBase(const string &base, const string &referencingLog);
+
+// follows every base log that the deltas in ser refer back to, and returns the first one that
+// can't be found or opened. Empty if the log doesn't depend on any missing logs. Rewinds ser.
+string FindMissingInitialDataBase(Serialiser *ser);
+
 // This is a generic resource record, that APIs can inherit from and use.
 // A resource is an API object that gets tracked on its own, has dependencies on other resources
 // and has its own stream of chunks.
@@ -77,9 +102,10 @@ struct ResourceRecord
 		: RefCount(1), ResID(id), UpdateCount(0),
 			DataInSerialiser(false), DataPtr(NULL), DataOffset(0),
 			Length(-1), DataWritten(false), SpecialResource(false),
-			NumSubResources(0), SubResources(NULL)
+			NumSubResources(0), SubResources(NULL), DirtyEpoch(0)
 	{
 		m_ChunkLock = NULL;
+		m_SpillWriter = NULL;
 
 		if(lock)
 			m_ChunkLock = new Threading::CriticalSection();
@@ -92,17 +118,27 @@ struct ResourceRecord
 
 	void AddParent(ResourceRecord *r)
 	{
-		if(Parents.find(r) == Parents.end())
+		if(std::find(Parents.begin(), Parents.end(), r) == Parents.end())
 		{
 			r->AddRef();
-			Parents.insert(r);
+			Parents.push_back(r);
 		}
 	}
 
 	void MarkParentsDirty(ResourceRecordHandler *mgr)
 	{
+		int32_t epoch = mgr->GetDirtyEpoch();
+
 		for(auto it = Parents.begin(); it != Parents.end(); ++it)
+		{
+			// many views of the same resource are usually dirtied together, and only the first
+			// needs to go through the manager's lock
+			if((*it)->DirtyEpoch == epoch)
+				continue;
+
+			(*it)->DirtyEpoch = epoch;
 			mgr->MarkDirtyResource((*it)->GetResourceID());
+		}
 	}
 
 	void FreeParents(ResourceRecordHandler *mgr)
@@ -118,7 +154,19 @@ struct ResourceRecord
 		DataWritten = false;
 	}
 
-	void Insert(map<int32_t, Chunk *> &recordlist)
+	// chunks tagged with their (globally increasing) ID so that chunks from many records
+	// can be put back into the order they were recorded in.
+	typedef std::vector< std::pair<int32_t, Chunk *> > ChunkList;
+
+	// sort a list gathered with Insert() into recorded order
+	static void SortChunks(ChunkList &recordlist)
+	{
+		std::sort(recordlist.begin(), recordlist.end());
+		recordlist.erase(std::unique(recordlist.begin(), recordlist.end()), recordlist.end());
+	}
+
+	// append this record's chunks (and any unwritten parents') to recordlist, unsorted.
+	void Insert(ChunkList &recordlist)
 	{
 		bool dataWritten = DataWritten;
 
@@ -134,7 +182,7 @@ struct ResourceRecord
 
 		if(!dataWritten)
 		{
-			recordlist.insert(m_Chunks.begin(), m_Chunks.end());
+			recordlist.insert(recordlist.end(), m_Chunks.begin(), m_Chunks.end());
 			
 			for(int i=0; i < NumSubResources; i++)
 				SubResources[i]->Insert(recordlist);
@@ -164,8 +212,31 @@ struct ResourceRecord
 	void AddChunk(Chunk *chunk, int32_t ID = 0)
 	{
 		LockChunks();
-		if(ID == 0) ID = GetID();
-		m_Chunks[ID] = chunk;
+		if(m_SpillWriter)
+		{
+			m_SpillWriter->Append(chunk);
+		}
+		else
+		{
+			if(ID == 0) ID = GetID();
+
+			// IDs only ever increase, unless one was passed in explicitly
+			if(m_Chunks.empty() || m_Chunks.back().first < ID)
+				m_Chunks.push_back(std::make_pair(ID, chunk));
+			else
+				m_Chunks.insert(std::lower_bound(m_Chunks.begin(), m_Chunks.end(), std::make_pair(ID, (Chunk *)NULL)),
+												std::make_pair(ID, chunk));
+		}
+		UnlockChunks();
+	}
+
+	// while set, chunks added to this record are handed to the spill writer in the
+	// order they're added instead of being held in m_Chunks. Only suitable for records
+	// whose chunks are written in one contiguous run, like a context's frame chunks.
+	void SetSpillWriter(ChunkSpillWriter *spill)
+	{
+		LockChunks();
+		m_SpillWriter = spill;
 		UnlockChunks();
 	}
 
@@ -177,6 +248,31 @@ struct ResourceRecord
 		return !m_Chunks.empty();
 	}
 
+	// total length of the chunks held by this record and its sub-resources
+	uint64_t GetChunkMemory(uint32_t &numChunks)
+	{
+		uint64_t ret = 0;
+
+		LockChunks();
+		for(auto it=m_Chunks.begin(); it != m_Chunks.end(); ++it)
+			ret += it->second->GetLength();
+		numChunks = (uint32_t)m_Chunks.size();
+
+		for(int i=0; i < NumSubResources; i++)
+		{
+			for(auto it=SubResources[i]->m_Chunks.begin(); it != SubResources[i]->m_Chunks.end(); ++it)
+				ret += it->second->GetLength();
+			numChunks += (uint32_t)SubResources[i]->m_Chunks.size();
+		}
+		UnlockChunks();
+
+		return ret;
+	}
+
+	// size of any CPU-side shadow copies of the resource. Records that allocate shadow
+	// storage hide this with their own version.
+	uint64_t GetShadowMemory() { return 0; }
+
 	size_t NumChunks() const
 	{
 		return m_Chunks.size();
@@ -192,6 +288,33 @@ struct ResourceRecord
 		UnlockChunks();
 	}
 
+	// delete any chunks of the given types, returning how many were deleted. Used to drop
+	// a history of contents updates once they're superseded by a resource's initial contents.
+	size_t DeleteChunksOfTypes(const uint32_t *types, size_t numTypes)
+	{
+		size_t numDeleted = 0;
+
+		LockChunks();
+		for(size_t i=0; i < m_Chunks.size(); i++)
+		{
+			uint32_t type = m_Chunks[i].second->GetChunkType();
+
+			if(std::find(types, types+numTypes, type) != types+numTypes)
+			{
+				SAFE_DELETE(m_Chunks[i].second);
+				numDeleted++;
+			}
+			else if(numDeleted > 0)
+			{
+				m_Chunks[i-numDeleted] = m_Chunks[i];
+			}
+		}
+		m_Chunks.resize(m_Chunks.size()-numDeleted);
+		UnlockChunks();
+
+		return numDeleted;
+	}
+
 	void DeleteChunks()
 	{
 		LockChunks();
@@ -204,18 +327,18 @@ struct ResourceRecord
 	Chunk *GetLastChunk() const
 	{
 		RDCASSERT(HasChunks());
-		return m_Chunks.rbegin()->second;
+		return m_Chunks.back().second;
 	}
 
 	int32_t GetLastChunkID() const
 	{
 		RDCASSERT(HasChunks());
-		return m_Chunks.rbegin()->first;
+		return m_Chunks.back().first;
 	}
 
 	void PopChunk()
 	{
-		m_Chunks.erase(m_Chunks.rbegin()->first);
+		m_Chunks.pop_back();
 	}
 
 	byte *GetDataPtr()
@@ -258,7 +381,11 @@ protected:
 
 	ResourceId ResID;
 
-	std::set<ResourceRecord*> Parents;
+	// nearly always only one or two, so a vector is cheaper to search and walk than a set
+	std::vector<ResourceRecord*> Parents;
+
+	// the manager's dirty epoch when MarkParentsDirty last marked this record
+	volatile int32_t DirtyEpoch;
 
 	int32_t GetID()
 	{
@@ -269,8 +396,11 @@ protected:
 
 	map<ResourceId, FrameRefType> m_FrameRefs;
 	
-	std::map<int32_t, Chunk *> m_Chunks;
+	// sorted by ID. Chunks are nearly always appended, so this is cheaper to keep and to
+	// gather at capture time than a map.
+	ChunkList m_Chunks;
 	Threading::CriticalSection *m_ChunkLock;
+	ChunkSpillWriter *m_SpillWriter;
 };
 
 // the resource manager is a utility class that's not required but is likely wanted by any API implementation.
@@ -292,11 +422,15 @@ class ResourceManager : public ResourceRecordHandler
 
 		struct InitialContentData
 		{
-			InitialContentData(ResourceType r, uint32_t n, byte *b) : resource(r), num(n), blob(b) {}
-			InitialContentData() : resource((ResourceType)RecordType::NullResource), num(0), blob(NULL) {}
+			InitialContentData(ResourceType r, uint32_t n, byte *b, uint64_t sz = 0) : resource(r), num(n), blob(b), size(sz) {}
+			InitialContentData() : resource((ResourceType)RecordType::NullResource), num(0), blob(NULL), size(0) {}
 			ResourceType resource;
 			uint32_t num;
 			byte *blob;
+
+			// how much memory the contents take up, between the blob and any copy held in
+			// resource. Only used to report capture overhead, so can be an estimate.
+			uint64_t size;
 		};
 
 		///////////////////////////////////////////
@@ -316,6 +450,8 @@ class ResourceManager : public ResourceRecordHandler
 
 		void MarkInFrame(bool inFrame) { m_InFrame = inFrame; }
 		void ReleaseInFrameResources();
+		bool HasInFrameResources() { return !m_InframeResourceMap.empty(); }
+		bool IsInFrameResource(ResourceId origid) { return m_InframeResourceMap.find(origid) != m_InframeResourceMap.end(); }
 		
 		// insert the chunks for the resources referenced in the frame
 		void InsertReferencedChunks(Serialiser *fileSer);
@@ -323,8 +459,10 @@ class ResourceManager : public ResourceRecordHandler
 		// mark resource records as unwritten, ready to be written to a new logfile.
 		void MarkUnwrittenResources();
 
-		// clear the list of frame-referenced resources - e.g. if you're about to recapture a frame
-		void ClearReferencedResources();
+		// clear the list of frame-referenced resources - e.g. if you're about to recapture a frame.
+		// If the frame's chunks are being thrown away rather than written, anything it wrote is
+		// marked dirty, since those writes are no longer recorded anywhere else.
+		void ClearReferencedResources(bool discardedFrame = false);
 		
 		// indicates this resource could have been modified by the GPU,
 		// so it's now suspect and the data we have on it might well be out of date
@@ -340,6 +478,8 @@ class ResourceManager : public ResourceRecordHandler
 		// this can be used when the resource is cleared or similar and it's in a known state
 		void MarkCleanResource(ResourceId res);
 
+		int32_t GetDirtyEpoch() { return m_DirtyEpoch; }
+
 		// returns if the resource has been marked as dirty
 		bool IsResourceDirty(ResourceId res);
 		
@@ -352,6 +492,24 @@ class ResourceManager : public ResourceRecordHandler
 
 		// generate chunks for initial contents and insert.
 		void InsertInitialContentsChunks(Serialiser *fileSer);
+
+		// serialise one subresource of a texture's data from within Serialise_InitialState, in place
+		// of SerialiseBuffer. With the DeltaInitialContents option the data is written to a separate
+		// chunk instead, containing only the blocks that changed since the last capture that wrote it.
+		// index identifies the subresource within the resource. On reading, buf is allocated if it's
+		// NULL. Data that was written inline is identical to a plain SerialiseBuffer.
+		void SerialiseInitialData(ResourceId id, uint32_t index, byte *&buf, size_t &len);
+
+		// on capture, in place of SerialiseInitialData when the data hasn't been read back yet.
+		// If the initial contents haven't been prepared again since this subresource was last
+		// written, the data can't have changed and a reference to that log is written instead.
+		// Returns false if the caller must read back the data and serialise it as normal, which
+		// includes when that log (or one it depends on) can no longer be found.
+		bool SerialiseUnchangedInitialData(ResourceId id, uint32_t index);
+
+		// append how much memory is held for each resource with a record, in chunks, shadow
+		// storage and initial contents. Safe to call from any thread.
+		void GetResourceMemoryUsage(vector<ResourceMemoryUsage> &usage);
 		
 		// Serialise out which resources need initial contents, along with whether their
 		// initial contents are in the serialised stream (e.g. RTs might still want to be
@@ -360,7 +518,9 @@ class ResourceManager : public ResourceRecordHandler
 
 
 		// handle marking a resource referenced for read or write and storing RAW access etc.
-		static bool MarkReferenced(map<ResourceId, FrameRefType> &refs, ResourceId id, FrameRefType refType);
+		// MapType is any map from ResourceId to FrameRefType (e.g. std::map or ResourceIdMap)
+		template<typename MapType>
+		static bool MarkReferenced(MapType &refs, ResourceId id, FrameRefType refType);
 		
 		// mark resource referenced somewhere in the main frame-affecting calls.
 		// That means this resource should be included in the final serialise out
@@ -390,9 +550,36 @@ class ResourceManager : public ResourceRecordHandler
 		// Serialise in which resources need initial contents and set them up.
 		void CreateInitialContents();
 
+		// read the same list as CreateInitialContents without acting on it, so that initial
+		// contents chunks (which come before the capture scope) for resources that no frame
+		// needs can be skipped instead of being created and then freed again.
+		void PeekInitialContentsNeeded();
+
+		// if the needed list has been peeked, whether id is on it. Otherwise always true.
+		bool IsInitialContentsNeeded(ResourceId id);
+
+		// read the data chunks written by SerialiseInitialData for the needed resources up front,
+		// following any deltas back to the earlier logs they refer to. Call after the needed
+		// list has been peeked, before the initial contents chunks are processed.
+		void LoadInitialContentsData();
+
 		// Apply the initial contents for the resources that need them, used at the start of a frame
 		void ApplyInitialContents();
 
+		// while enabled, initial contents chunks seen when first reading the log are only noted
+		// rather than created, for the resources Defer_InitialState allows, so the frame can be
+		// browsed before that data is uploaded. DeferInitialState returns true if the chunk at
+		// offset for resource id was deferred and should be skipped, and CreateInitialContents
+		// likewise holds back creating the same resources.
+		void SetDeferInitialStates(bool defer) { m_DeferInitialStates = defer; }
+		bool DeferInitialState(uint64_t offset, ResourceId id);
+		bool HasDeferredInitialStates() { return !m_DeferredInitialChunks.empty() || !m_DeferredCreates.empty(); }
+
+		// processes the deferred chunks, read from ser (which must be opened on the same log),
+		// then creates anything CreateInitialContents held back. Must be done before the first
+		// full replay's ApplyInitialContents. If ser is NULL only the held back contents are created.
+		void CreateDeferredInitialStates(Serialiser *ser);
+
 		// Resource wrapping, allows for querying and adding/removing of wrapper layers around resources
 		bool AddWrapper(ResourceType wrap, ResourceType real);
 		bool HasWrapper(ResourceType real);
@@ -408,10 +595,18 @@ class ResourceManager : public ResourceRecordHandler
 
 		virtual bool Force_InitialState(ResourceType res) = 0;
 		virtual bool Need_InitialStateChunk(ResourceType res) = 0;
+		// if every write to this resource goes through MarkDirtyResource (or is referenced
+		// in a captured frame), a copy from a previous Prepare_InitialState can be kept
+		// and reused until the resource is written again.
+		virtual bool Reuse_InitialState(ResourceType res) = 0;
 		virtual bool Prepare_InitialState(ResourceType res) = 0;
 		virtual bool Serialise_InitialState(ResourceType res) = 0;
 		virtual void Create_InitialState(ResourceId id, ResourceType live, bool hasData) = 0;
 		virtual void Apply_InitialState(ResourceType live, InitialContentData initial) = 0;
+		// whether this resource's initial contents can wait until the first replay. The first
+		// read of the frame can depend on some contents (e.g. reading back indirect arguments),
+		// so only return true for resources that it never reads.
+		virtual bool Defer_InitialState(ResourceType live) = 0;
 
 		LogState m_State;
 		Serialiser *m_pSerialiser;
@@ -419,46 +614,160 @@ class ResourceManager : public ResourceRecordHandler
 	private:
 		bool m_InFrame;
 
-		// very coarse lock, protects EVERYTHING. This could certainly be improved and it may be a bottleneck
-		// for performance. Given that the main use cases are write-rarely read-often the lock should be optimised
-		// for that as we only want to make sure we're not modifying the objects together, by far the most common
-		// operation is looking up data.
+		// used during replay - union of all peeked needed lists
+		set<ResourceId> m_PeekedNeededInitials;
+		bool m_PeekedInitialsNeeded;
+
+		// used during replay - offsets of initial contents chunks not processed yet, and the
+		// resources CreateInitialContents hasn't created, with whether they had data written
+		bool m_DeferInitialStates;
+		vector<uint64_t> m_DeferredInitialChunks;
+		vector< pair<ResourceId, bool> > m_DeferredCreates;
+
+		// see ResourceRecordHandler::GetDirtyEpoch
+		volatile int32_t m_DirtyEpoch;
+
+		// very coarse lock, protects everything except the reference shards below. This could certainly be
+		// improved and it may be a bottleneck for performance. Given that the main use cases are write-rarely
+		// read-often the lock should be optimised for that as we only want to make sure we're not modifying
+		// the objects together, by far the most common operation is looking up data.
 		Threading::CriticalSection m_Lock;
 
-		// easy optimisation win - don't use maps everywhere. It's convenient but not optimal, and profiling will
-		// likely prove that some or all of these could be a problem
+		// true if a previously prepared copy of this resource's initial contents is still valid
+		bool HasReusableInitialState(ResourceId id, ResourceType res, const set<ResourceId> &modified);
+
+		// data stored by SerialiseInitialData is identified by resource and subresource
+		typedef std::pair<ResourceId, uint32_t> InitialDataKey;
+
+		// deltas are compared and stored in blocks of this size
+		static const size_t InitialDataBlockSize = 4*1024;
+
+		// used during capture - what was last written for each subresource. Only block hashes are
+		// kept, holding a copy of every texture would double the capture memory overhead.
+		struct InitialDataSnapshot
+		{
+			InitialDataSnapshot() : size(0), deltas(0), current(false) {}
+			uint64_t size;
+			vector<uint64_t> hashes;
+			string log;
+			uint32_t deltas;
+			// written from the initial contents that are currently set
+			bool current;
+		};
+		map<InitialDataKey, InitialDataSnapshot> m_InitialDataSnapshots;
+
+		// used during capture - the log being written while initial contents are inserted, and the
+		// data chunks that go into it. The log is empty when data should be serialised inline.
+		string m_InitialDataLog;
+		Serialiser *m_InitialDataSer;
+		vector<Chunk*> m_InitialDataChunks;
+
+		// used during capture - whether each earlier log can still be found, along with every log
+		// it depends on, so new deltas can be based on it. Checked once per capture.
+		map<string, bool> m_InitialDataBasesFound;
+		bool IsInitialDataBaseFound(const string &log);
+
+		// used during replay - data read by LoadInitialContentsData, until it's taken by SerialiseInitialData
+		struct LoadedInitialData
+		{
+			LoadedInitialData() : data(NULL), size(0) {}
+			byte *data;
+			size_t size;
+		};
+		map<InitialDataKey, LoadedInitialData> m_LoadedInitialData;
+
+		struct InitialDataDelta
+		{
+			InitialDataDelta() : size(0) {}
+			string base;
+			uint64_t size;
+			vector<uint64_t> offsets;
+			vector<LoadedInitialData> runs;
+		};
+
+		static uint64_t HashInitialDataBlock(const byte *data, size_t len);
+		void WriteInitialDataChunk(InitialDataKey key, byte *buf, size_t len);
+
+		// reads the data chunks in ser (if wanted is NULL, those for needed resources) and resolves
+		// deltas against the logs they're based on, recursively.
+		void ReadInitialDataChunks(Serialiser *ser, const set<InitialDataKey> *wanted, map<InitialDataKey, LoadedInitialData> &data, uint32_t depth);
+		static Serialiser *OpenInitialDataBase(const string &base, const string &referencingLog);
+
+		// frame references and dirty state are updated by nearly every captured call, from any thread
+		// (e.g. D3D11 deferred contexts), so they're split by ID into shards that each have their own lock
+		// instead of serialising every thread on m_Lock. Anything needing a consistent view of every shard
+		// (typically at a frame boundary) holds a ReferencesLock. Shard locks are always taken BEFORE m_Lock.
+		static const size_t NumReferenceShards = 16;
+
+		struct ReferenceShard
+		{
+			Threading::CriticalSection lock;
+
+			// used during capture - holds resources referenced in current frame (and how they're referenced)
+			ResourceIdMap<FrameRefType> frameRefs;
+
+			// used during capture - holds resources marked as dirty, needing initial contents
+			set<ResourceId> dirty;
+			set<ResourceId> pendingDirty;
+
+			// used during capture - dirty resources written since their initial contents were
+			// last prepared, so any copy we're holding onto is out of date
+			set<ResourceId> modified;
+		};
+
+		ReferenceShard m_RefShards[NumReferenceShards];
+
+		ReferenceShard &GetShard(ResourceId id) { return m_RefShards[id.id % NumReferenceShards]; }
+
+		class ReferencesLock
+		{
+			public:
+				ReferencesLock(ResourceManager *mgr) : m_Mgr(mgr)
+				{
+					for(size_t i=0; i < NumReferenceShards; i++)
+						m_Mgr->m_RefShards[i].lock.Lock();
+				}
+				~ReferencesLock()
+				{
+					for(size_t i=NumReferenceShards; i > 0; i--)
+						m_Mgr->m_RefShards[i-1].lock.Unlock();
+				}
+			private:
+				ResourceManager *m_Mgr;
+		};
+
+		// everything keyed by ResourceId is looked up on nearly every call, so uses a flat hash map
+		// rather than std::map. None of these are iterated anywhere that depends on ID order.
 		
 		// used during capture - map from real resource to its wrapper (other way can be done just with an Unwrap)
 		map<ResourceType, ResourceType> m_WrapperMap;
 
-		// used during capture - holds resources referenced in current frame (and how they're referenced)
-		map<ResourceId, FrameRefType> m_FrameReferencedResources;
-
-		// used during capture - holds resources marked as dirty, needing initial contents
-		set<ResourceId> m_DirtyResources;
-		set<ResourceId> m_PendingDirtyResources;
-
 		// used during capture or replay - holds initial contents
-		map<ResourceId, InitialContentData> m_InitialContents;
+		ResourceIdMap<InitialContentData> m_InitialContents;
 		// on capture, if a chunk was prepared in Prepare_InitialContents and added, don't re-serialise.
 		// Some initial contents may not need the delayed readback.
-		map<ResourceId, Chunk*> m_InitialChunks;
+		ResourceIdMap<Chunk*> m_InitialChunks;
 
 		// used during capture or replay - map of resources currently alive with their real IDs, used in capture and replay.
-		map<ResourceId, ResourceType> m_CurrentResourceMap;
+		ResourceIdMap<ResourceType> m_CurrentResourceMap;
+
+		// used during capture - the current resources that Force_InitialState, which only depends on the
+		// type of resource. Kept up to date as resources come and go so that preparing initial contents
+		// doesn't need to query every live resource.
+		set<ResourceId> m_ForcedInitialStates;
 
 		// used during replay - maps back and forth from original id to live id and vice-versa
-		map<ResourceId, ResourceId> m_OriginalIDs, m_LiveIDs;
+		ResourceIdMap<ResourceId> m_OriginalIDs, m_LiveIDs;
 		
 		// used during replay - holds resources allocated and the original id that they represent
 		// for a) in-frame creations and b) pre-frame creations respectively.
-		map<ResourceId, ResourceType> m_InframeResourceMap, m_LiveResourceMap;
+		ResourceIdMap<ResourceType> m_InframeResourceMap, m_LiveResourceMap;
 
 		// used during capture - holds resource records by id.
-		map<ResourceId, RecordType*> m_ResourceRecords;
+		ResourceIdMap<RecordType*> m_ResourceRecords;
 
 		// used during replay - holds current resource replacements
-		map<ResourceId, ResourceId> m_Replacements;
+		ResourceIdMap<ResourceId> m_Replacements;
 };
 
 template<typename ResourceType, typename RecordType>
@@ -471,6 +780,12 @@ ResourceManager<ResourceType, RecordType>::ResourceManager(LogState state, Seria
 	m_pSerialiser = ser;
 	
 	m_InFrame = false;
+	m_PeekedInitialsNeeded = false;
+	m_DeferInitialStates = false;
+
+	m_DirtyEpoch = 1;
+
+	m_InitialDataSer = NULL;
 }
 
 template<typename ResourceType, typename RecordType>
@@ -501,6 +816,13 @@ void ResourceManager<ResourceType, RecordType>::Shutdown()
 			m_InitialContents.erase(m_InitialContents.begin());
 	}
 
+	for(auto it=m_LoadedInitialData.begin(); it != m_LoadedInitialData.end(); ++it)
+		SAFE_DELETE_ARRAY(it->second.data);
+
+	m_LoadedInitialData.clear();
+
+	SAFE_DELETE(m_InitialDataSer);
+
 	RDCASSERT(m_ResourceRecords.empty());
 }
 
@@ -517,9 +839,12 @@ ResourceManager<ResourceType, RecordType>::~ResourceManager()
 }
 
 template<typename ResourceType, typename RecordType>
-bool ResourceManager<ResourceType, RecordType>::MarkReferenced(map<ResourceId, FrameRefType> &refs, ResourceId id, FrameRefType refType)
+template<typename MapType>
+bool ResourceManager<ResourceType, RecordType>::MarkReferenced(MapType &refs, ResourceId id, FrameRefType refType)
 {
-	if(refs.find(id) == refs.end())
+	typename MapType::iterator it = refs.find(id);
+
+	if(it == refs.end())
 	{
 		if(refType == eFrameRef_Read)
 			refs[id] = eFrameRef_ReadOnly;
@@ -532,22 +857,24 @@ bool ResourceManager<ResourceType, RecordType>::MarkReferenced(map<ResourceId, F
 	}
 	else
 	{
+		FrameRefType &existing = it->second;
+
 		if(refType == eFrameRef_Unknown)
 		{
 			// nothing
 		}
-		else if(refs[id] == eFrameRef_Unknown)
+		else if(existing == eFrameRef_Unknown)
 		{
-			if(refType == eFrameRef_ReadBeforeWrite)
-				refs[id] = eFrameRef_ReadBeforeWrite;
+			if(refType == eFrameRef_ReadBeforeWrite || refType == eFrameRef_CompleteWrite)
+				existing = refType;
 			else if(refType == eFrameRef_Read || refType == eFrameRef_ReadOnly)
-				refs[id] = eFrameRef_ReadOnly;
+				existing = eFrameRef_ReadOnly;
 			else
-				refs[id] = eFrameRef_ReadAndWrite;
+				existing = eFrameRef_ReadAndWrite;
 		}
-		else if(refs[id] == eFrameRef_ReadOnly && refType == eFrameRef_Write)
+		else if(existing == eFrameRef_ReadOnly && refType == eFrameRef_Write)
 		{
-			refs[id] = eFrameRef_ReadBeforeWrite;
+			existing = eFrameRef_ReadBeforeWrite;
 		}
 	}
 
@@ -557,12 +884,14 @@ bool ResourceManager<ResourceType, RecordType>::MarkReferenced(map<ResourceId, F
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::MarkResourceFrameReferenced(ResourceId id, FrameRefType refType)
 {
-	SCOPED_LOCK(m_Lock);
-
 	if(id == ResourceId())
 		return;
 
-	bool newRef = MarkReferenced(m_FrameReferencedResources, id, refType);
+	ReferenceShard &shard = GetShard(id);
+
+	SCOPED_LOCK(shard.lock);
+
+	bool newRef = MarkReferenced(shard.frameRefs, id, refType);
 
 	if(newRef)
 	{
@@ -576,9 +905,15 @@ void ResourceManager<ResourceType, RecordType>::MarkResourceFrameReferenced(Reso
 template<typename ResourceType, typename RecordType>
 bool ResourceManager<ResourceType, RecordType>::ReadBeforeWrite(ResourceId id)
 {
-	if(m_FrameReferencedResources.find(id) != m_FrameReferencedResources.end())
-		return m_FrameReferencedResources[id] == eFrameRef_ReadBeforeWrite ||
-				m_FrameReferencedResources[id] == eFrameRef_ReadOnly;
+	ReferenceShard &shard = GetShard(id);
+
+	SCOPED_LOCK(shard.lock);
+
+	auto it = shard.frameRefs.find(id);
+
+	if(it != shard.frameRefs.end())
+		return it->second == eFrameRef_ReadBeforeWrite ||
+				it->second == eFrameRef_ReadOnly;
 
 	return false;
 }
@@ -586,57 +921,72 @@ bool ResourceManager<ResourceType, RecordType>::ReadBeforeWrite(ResourceId id)
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::MarkDirtyResource(ResourceId res)
 {
-	SCOPED_LOCK(m_Lock);
-
 	if(res == ResourceId())
 		return;
 
-	m_DirtyResources.insert(res);
+	ReferenceShard &shard = GetShard(res);
+
+	SCOPED_LOCK(shard.lock);
+
+	shard.dirty.insert(res);
+	shard.modified.insert(res);
 }
 
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::MarkPendingDirty(ResourceId res)
 {
-	SCOPED_LOCK(m_Lock);
-
 	if(res == ResourceId())
 		return;
 
-	m_PendingDirtyResources.insert(res);
+	ReferenceShard &shard = GetShard(res);
+
+	SCOPED_LOCK(shard.lock);
+
+	shard.pendingDirty.insert(res);
 }
 
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::FlushPendingDirty()
 {
-	SCOPED_LOCK(m_Lock);
+	for(size_t i=0; i < NumReferenceShards; i++)
+	{
+		ReferenceShard &shard = m_RefShards[i];
+
+		SCOPED_LOCK(shard.lock);
 
-	m_DirtyResources.insert(m_PendingDirtyResources.begin(), m_PendingDirtyResources.end());
-	m_PendingDirtyResources.clear();
+		shard.dirty.insert(shard.pendingDirty.begin(), shard.pendingDirty.end());
+		shard.modified.insert(shard.pendingDirty.begin(), shard.pendingDirty.end());
+		shard.pendingDirty.clear();
+	}
 }
 
 template<typename ResourceType, typename RecordType>
 bool ResourceManager<ResourceType, RecordType>::IsResourceDirty(ResourceId res)
 {
-	SCOPED_LOCK(m_Lock);
-
 	if(res == ResourceId())
 		return false;
 
-	return m_DirtyResources.find(res) != m_DirtyResources.end();
+	ReferenceShard &shard = GetShard(res);
+
+	SCOPED_LOCK(shard.lock);
+
+	return shard.dirty.find(res) != shard.dirty.end();
 }
 
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::MarkCleanResource(ResourceId res)
 {
-	SCOPED_LOCK(m_Lock);
-	
 	if(res == ResourceId())
 		return;
 
-	if(IsResourceDirty(res))
-	{
-		m_DirtyResources.erase(res);
-	}
+	ReferenceShard &shard = GetShard(res);
+
+	SCOPED_LOCK(shard.lock);
+
+	shard.dirty.erase(res);
+
+	// only after the erase, so a record marked in the new epoch really is dirty
+	Atomic::Inc32(&m_DirtyEpoch);
 }
 
 template<typename ResourceType, typename RecordType>
@@ -656,6 +1006,11 @@ void ResourceManager<ResourceType, RecordType>::SetInitialContents(ResourceId id
 	}
 	
 	m_InitialContents[id] = contents;
+
+	// anything written for this resource came from the contents just replaced
+	for(auto snap=m_InitialDataSnapshots.lower_bound(InitialDataKey(id, 0));
+			snap != m_InitialDataSnapshots.end() && snap->first.first == id; ++snap)
+		snap->second.current = false;
 }
 
 template<typename ResourceType, typename RecordType>
@@ -696,35 +1051,49 @@ typename ResourceManager<ResourceType, RecordType>::InitialContentData ResourceM
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::Serialise_InitialContentsNeeded()
 {
+	ReferencesLock refLock(this);
 	SCOPED_LOCK(m_Lock);
 
 	struct WrittenRecord { ResourceId id; bool written; };
 	vector<WrittenRecord> written;
 
-	// reasonable estimate, and these records are small
-	written.reserve(m_FrameReferencedResources.size());
-
-	for(auto it=m_FrameReferencedResources.begin(); it != m_FrameReferencedResources.end(); ++it)
+	for(size_t s=0; s < NumReferenceShards; s++)
 	{
-		RecordType *record = GetResourceRecord(it->first);
+		ReferenceShard &shard = m_RefShards[s];
 
-		if(it->second != eFrameRef_ReadOnly && it->second != eFrameRef_Unknown)
+		for(auto it=shard.frameRefs.begin(); it != shard.frameRefs.end(); ++it)
 		{
-			WrittenRecord wr = { it->first, record ? record->DataInSerialiser : true };
+			RecordType *record = GetResourceRecord(it->first);
 
-			written.push_back(wr);
+			if(it->second != eFrameRef_ReadOnly && it->second != eFrameRef_Unknown)
+			{
+				// completely overwritten resources have no initial contents chunk, so on replay
+				// they get the same cheap cleared state as a resource with no data at all.
+				bool hasData = record ? record->DataInSerialiser : true;
+				if(it->second == eFrameRef_CompleteWrite && !RenderDoc::Inst().GetCaptureOptions().SaveAllInitials)
+					hasData = false;
+
+				WrittenRecord wr = { it->first, hasData };
+
+				written.push_back(wr);
+			}
 		}
 	}
 	
-	for(auto it=m_DirtyResources.begin(); it != m_DirtyResources.end(); ++it)
+	for(size_t s=0; s < NumReferenceShards; s++)
 	{
-		ResourceId id = *it;
-		auto ref = m_FrameReferencedResources.find(id);
-		if(ref == m_FrameReferencedResources.end() || ref->second == eFrameRef_ReadOnly)
+		ReferenceShard &shard = m_RefShards[s];
+
+		for(auto it=shard.dirty.begin(); it != shard.dirty.end(); ++it)
 		{
-			WrittenRecord wr = { id, true };
+			ResourceId id = *it;
+			auto ref = shard.frameRefs.find(id);
+			if(ref == shard.frameRefs.end() || ref->second == eFrameRef_ReadOnly)
+			{
+				WrittenRecord wr = { id, true };
 
-			written.push_back(wr);
+				written.push_back(wr);
+			}
 		}
 	}
 	
@@ -756,7 +1125,10 @@ void ResourceManager<ResourceType, RecordType>::CreateInitialContents()
 
 		neededInitials.insert(id);
 
-		if(HasLiveResource(id) && m_InitialContents.find(id) == m_InitialContents.end())
+		// deferred chunks provide most of these, so wait until they've been processed
+		if(m_DeferInitialStates && HasLiveResource(id) && Defer_InitialState(GetLiveResource(id)))
+			m_DeferredCreates.push_back(std::make_pair(id, WrittenData));
+		else if(HasLiveResource(id) && m_InitialContents.find(id) == m_InitialContents.end())
 			Create_InitialState(id, GetLiveResource(id), WrittenData);
 	}
 
@@ -778,6 +1150,475 @@ void ResourceManager<ResourceType, RecordType>::CreateInitialContents()
 	}
 }
 
+template<typename ResourceType, typename RecordType>
+void ResourceManager<ResourceType, RecordType>::PeekInitialContentsNeeded()
+{
+	m_PeekedInitialsNeeded = true;
+
+	uint32_t NumWrittenResources = 0;
+	m_pSerialiser->Serialise("NumWrittenResources", NumWrittenResources);
+
+	for(uint32_t i=0; i < NumWrittenResources; i++)
+	{
+		ResourceId id = ResourceId();
+		bool WrittenData = false;
+
+		m_pSerialiser->Serialise("id", id);
+		m_pSerialiser->Serialise("WrittenData", WrittenData);
+
+		m_PeekedNeededInitials.insert(id);
+	}
+}
+
+template<typename ResourceType, typename RecordType>
+bool ResourceManager<ResourceType, RecordType>::IsInitialContentsNeeded(ResourceId id)
+{
+	if(!m_PeekedInitialsNeeded)
+		return true;
+
+	return m_PeekedNeededInitials.find(id) != m_PeekedNeededInitials.end();
+}
+
+template<typename ResourceType, typename RecordType>
+uint64_t ResourceManager<ResourceType, RecordType>::HashInitialDataBlock(const byte *data, size_t len)
+{
+	// FNV-1a a word at a time, folding the high bits back down so that every bit of
+	// the input affects the whole hash. Only used to spot changed blocks.
+	uint64_t hash = 14695981039346656037ULL;
+
+	size_t i=0;
+	for(; i+sizeof(uint64_t) <= len; i += sizeof(uint64_t))
+	{
+		uint64_t word;
+		memcpy(&word, data+i, sizeof(word));
+		hash = (hash ^ word) * 1099511628211ULL;
+		hash ^= hash >> 32;
+	}
+
+	for(; i < len; i++)
+		hash = (hash ^ data[i]) * 1099511628211ULL;
+
+	return hash;
+}
+
+template<typename ResourceType, typename RecordType>
+void ResourceManager<ResourceType, RecordType>::SerialiseInitialData(ResourceId id, uint32_t index, byte *&buf, size_t &len)
+{
+	InitialDataKey key(id, index);
+
+	if(m_State >= WRITING)
+	{
+		if(m_InitialDataLog.empty())
+			m_pSerialiser->SerialiseBuffer("", buf, len);
+		else
+			WriteInitialDataChunk(key, buf, len);
+
+		return;
+	}
+
+	// the log contains a data chunk for this subresource exactly when its data isn't inline,
+	// and LoadInitialContentsData has read all of those for needed resources.
+	auto it = m_LoadedInitialData.find(key);
+	if(it == m_LoadedInitialData.end())
+	{
+		m_pSerialiser->SerialiseBuffer("", buf, len);
+		return;
+	}
+
+	byte *data = it->second.data;
+	len = it->second.size;
+
+	m_LoadedInitialData.erase(it);
+
+	if(buf)
+	{
+		memcpy(buf, data, len);
+		delete[] data;
+	}
+	else
+	{
+		buf = data;
+	}
+}
+
+template<typename ResourceType, typename RecordType>
+bool ResourceManager<ResourceType, RecordType>::SerialiseUnchangedInitialData(ResourceId id, uint32_t index)
+{
+	if(m_State < WRITING || m_InitialDataLog.empty())
+		return false;
+
+	auto it = m_InitialDataSnapshots.find(InitialDataKey(id, index));
+	if(it == m_InitialDataSnapshots.end())
+		return false;
+
+	InitialDataSnapshot &snap = it->second;
+
+	if(!snap.current || snap.log.empty() || snap.deltas >= MaxInitialDataDeltas)
+		return false;
+
+	// all of the data comes from the earlier log, so only refer to it if opening this one will find it
+	if(!IsInitialDataBaseFound(snap.log))
+		return false;
+
+	// a delta with no changed blocks
+	ScopedContext scope(m_InitialDataSer, NULL, "Initial Contents Data", INITIAL_CONTENTS_DATA, false);
+
+	ResourceId Id = id;
+	uint32_t Index = index;
+	uint64_t Length = snap.size;
+	string BaseLog = snap.log;
+	uint32_t NumRuns = 0;
+
+	m_InitialDataSer->Serialise("Id", Id);
+	m_InitialDataSer->Serialise("Index", Index);
+	m_InitialDataSer->Serialise("Length", Length);
+	m_InitialDataSer->SerialiseString("BaseLog", BaseLog);
+	m_InitialDataSer->Serialise("NumRuns", NumRuns);
+
+	m_InitialDataChunks.push_back(scope.Get(true));
+
+	snap.log = m_InitialDataLog;
+	snap.deltas++;
+
+	return true;
+}
+
+template<typename ResourceType, typename RecordType>
+bool ResourceManager<ResourceType, RecordType>::IsInitialDataBaseFound(const string &log)
+{
+	auto it = m_InitialDataBasesFound.find(log);
+	if(it != m_InitialDataBasesFound.end())
+		return it->second;
+
+	// the log might have been deleted since it was captured, or one it depends on
+	bool found = false;
+
+	string path = FindInitialDataBase(log, m_InitialDataLog);
+
+	if(!path.empty())
+	{
+		Serialiser ser(path.c_str(), Serialiser::READING, false);
+		ser.SetDebugText(false);
+
+		found = !ser.HasError() && FindMissingInitialDataBase(&ser).empty();
+	}
+
+	if(!found)
+		RDCWARN("Earlier log '%s' is missing, writing initial contents based on it in full", log.c_str());
+
+	m_InitialDataBasesFound[log] = found;
+
+	return found;
+}
+
+template<typename ResourceType, typename RecordType>
+void ResourceManager<ResourceType, RecordType>::WriteInitialDataChunk(InitialDataKey key, byte *buf, size_t len)
+{
+	InitialDataSnapshot &snap = m_InitialDataSnapshots[key];
+
+	size_t numBlocks = (len + InitialDataBlockSize - 1)/InitialDataBlockSize;
+
+	vector<uint64_t> hashes(numBlocks);
+	for(size_t b=0; b < numBlocks; b++)
+	{
+		size_t offs = b*InitialDataBlockSize;
+		hashes[b] = HashInitialDataBlock(buf+offs, RDCMIN(len-offs, (size_t)InitialDataBlockSize));
+	}
+
+	// runs of consecutive blocks that changed, as (first block, number of blocks)
+	vector< pair<size_t, size_t> > runs;
+
+	bool delta = !snap.log.empty() && snap.size == (uint64_t)len && snap.deltas < MaxInitialDataDeltas &&
+	             IsInitialDataBaseFound(snap.log);
+
+	if(delta)
+	{
+		size_t changed = 0;
+
+		for(size_t b=0; b < numBlocks; b++)
+		{
+			if(hashes[b] == snap.hashes[b])
+				continue;
+
+			if(!runs.empty() && runs.back().first + runs.back().second == b)
+				runs.back().second++;
+			else
+				runs.push_back(std::make_pair(b, (size_t)1));
+
+			changed++;
+		}
+
+		// if most of it changed, reset the chain instead
+		if(changed*2 > numBlocks)
+			delta = false;
+	}
+
+	ScopedContext scope(m_InitialDataSer, NULL, "Initial Contents Data", INITIAL_CONTENTS_DATA, false);
+
+	ResourceId Id = key.first;
+	uint32_t Index = key.second;
+	uint64_t Length = len;
+	string BaseLog = delta ? snap.log : "";
+
+	m_InitialDataSer->Serialise("Id", Id);
+	m_InitialDataSer->Serialise("Index", Index);
+	m_InitialDataSer->Serialise("Length", Length);
+	m_InitialDataSer->SerialiseString("BaseLog", BaseLog);
+
+	if(delta)
+	{
+		uint32_t NumRuns = (uint32_t)runs.size();
+		m_InitialDataSer->Serialise("NumRuns", NumRuns);
+
+		for(size_t r=0; r < runs.size(); r++)
+		{
+			uint64_t Offset = runs[r].first*InitialDataBlockSize;
+			size_t runLen = RDCMIN(runs[r].second*InitialDataBlockSize, len-(size_t)Offset);
+			byte *runData = buf+Offset;
+
+			m_InitialDataSer->Serialise("Offset", Offset);
+			m_InitialDataSer->SerialiseBuffer("Data", runData, runLen);
+		}
+	}
+	else
+	{
+		m_InitialDataSer->SerialiseBuffer("Data", buf, len);
+	}
+
+	m_InitialDataChunks.push_back(scope.Get(true));
+
+	snap.size = len;
+	snap.hashes.swap(hashes);
+	snap.log = m_InitialDataLog;
+	snap.deltas = delta ? snap.deltas+1 : 0;
+	snap.current = true;
+}
+
+template<typename ResourceType, typename RecordType>
+void ResourceManager<ResourceType, RecordType>::LoadInitialContentsData()
+{
+	ReadInitialDataChunks(m_pSerialiser, NULL, m_LoadedInitialData, 0);
+
+	m_pSerialiser->Rewind();
+}
+
+template<typename ResourceType, typename RecordType>
+Serialiser *ResourceManager<ResourceType, RecordType>::OpenInitialDataBase(const string &base, const string &referencingLog)
+{
+	string path = FindInitialDataBase(base, referencingLog);
+
+	if(path.empty())
+	{
+		RDCERR("Can't find log '%s' that initial contents are stored in", base.c_str());
+		return NULL;
+	}
+
+	Serialiser *ser = new Serialiser(path.c_str(), Serialiser::READING, false);
+
+	if(ser->HasError())
+	{
+		RDCERR("Couldn't open log '%s' that initial contents are stored in", path.c_str());
+		SAFE_DELETE(ser);
+		return NULL;
+	}
+
+	ser->SetDebugText(false);
+
+	return ser;
+}
+
+template<typename ResourceType, typename RecordType>
+void ResourceManager<ResourceType, RecordType>::ReadInitialDataChunks(Serialiser *ser, const set<InitialDataKey> *wanted, map<InitialDataKey, LoadedInitialData> &data, uint32_t depth)
+{
+	map<InitialDataKey, InitialDataDelta> deltas;
+
+	ser->Rewind();
+
+	while(!ser->AtEnd())
+	{
+		ser->SkipToChunk(INITIAL_CONTENTS_DATA);
+
+		if(ser->AtEnd())
+			break;
+
+		ser->PushContext(NULL, INITIAL_CONTENTS_DATA, false);
+
+		uint64_t chunkStart = ser->GetOffset();
+
+		ResourceId Id = ResourceId();
+		uint32_t Index = 0;
+		uint64_t Length = 0;
+		string BaseLog;
+
+		ser->Serialise("Id", Id);
+		ser->Serialise("Index", Index);
+		ser->Serialise("Length", Length);
+		ser->SerialiseString("BaseLog", BaseLog);
+
+		InitialDataKey key(Id, Index);
+
+		bool needed = wanted ? wanted->find(key) != wanted->end() : IsInitialContentsNeeded(Id);
+
+		if(!needed)
+		{
+			ser->SetOffset(chunkStart);
+			ser->SkipCurrentChunk();
+		}
+		else if(BaseLog.empty())
+		{
+			LoadedInitialData &d = data[key];
+			SAFE_DELETE_ARRAY(d.data);
+			ser->SerialiseBuffer("Data", d.data, d.size);
+		}
+		else
+		{
+			InitialDataDelta &delta = deltas[key];
+			delta.base = BaseLog;
+			delta.size = Length;
+
+			uint32_t NumRuns = 0;
+			ser->Serialise("NumRuns", NumRuns);
+
+			for(uint32_t r=0; r < NumRuns; r++)
+			{
+				uint64_t Offset = 0;
+				LoadedInitialData run;
+
+				ser->Serialise("Offset", Offset);
+				ser->SerialiseBuffer("Data", run.data, run.size);
+
+				delta.offsets.push_back(Offset);
+				delta.runs.push_back(run);
+			}
+		}
+
+		ser->PopContext(NULL, INITIAL_CONTENTS_DATA);
+	}
+
+	if(deltas.empty())
+		return;
+
+	// open each log that's referred to once, for all the data based on it
+	map<string, set<InitialDataKey> > bases;
+	for(auto it=deltas.begin(); it != deltas.end(); ++it)
+		bases[it->second.base].insert(it->first);
+
+	for(auto b=bases.begin(); b != bases.end(); ++b)
+	{
+		map<InitialDataKey, LoadedInitialData> baseData;
+
+		// writing never chains more deltas than this, so a longer chain must be a loop
+		if(depth > MaxInitialDataDeltas)
+		{
+			RDCERR("Initial contents refer back through too many logs, at '%s'", b->first.c_str());
+		}
+		else
+		{
+			Serialiser *baseSer = OpenInitialDataBase(b->first, ser->GetFilename());
+
+			if(baseSer)
+				ReadInitialDataChunks(baseSer, &b->second, baseData, depth+1);
+
+			SAFE_DELETE(baseSer);
+		}
+
+		for(auto k=b->second.begin(); k != b->second.end(); ++k)
+		{
+			InitialDataDelta &delta = deltas[*k];
+			LoadedInitialData &d = data[*k];
+			SAFE_DELETE_ARRAY(d.data);
+
+			auto base = baseData.find(*k);
+			if(base != baseData.end() && base->second.size == delta.size)
+			{
+				d = base->second;
+				baseData.erase(base);
+			}
+			else
+			{
+				RDCERR("Missing initial contents of %llu (subresource %u) in '%s', unchanged data will be blank",
+				       k->first, k->second, b->first.c_str());
+
+				d.size = (size_t)delta.size;
+				d.data = new byte[d.size];
+				memset(d.data, 0, d.size);
+			}
+
+			for(size_t r=0; r < delta.runs.size(); r++)
+			{
+				if(delta.offsets[r] + delta.runs[r].size <= d.size)
+					memcpy(d.data + delta.offsets[r], delta.runs[r].data, delta.runs[r].size);
+				else
+					RDCERR("Corrupt initial contents delta for %llu (subresource %u)", k->first, k->second);
+
+				SAFE_DELETE_ARRAY(delta.runs[r].data);
+			}
+		}
+
+		for(auto it=baseData.begin(); it != baseData.end(); ++it)
+			SAFE_DELETE_ARRAY(it->second.data);
+	}
+}
+
+template<typename ResourceType, typename RecordType>
+bool ResourceManager<ResourceType, RecordType>::DeferInitialState(uint64_t offset, ResourceId id)
+{
+	if(!m_DeferInitialStates || !HasLiveResource(id) || !Defer_InitialState(GetLiveResource(id)))
+		return false;
+
+	m_DeferredInitialChunks.push_back(offset);
+
+	return true;
+}
+
+template<typename ResourceType, typename RecordType>
+void ResourceManager<ResourceType, RecordType>::CreateDeferredInitialStates(Serialiser *ser)
+{
+	if(!HasDeferredInitialStates())
+		return;
+
+	RDCLOG("Creating %u deferred initial contents", (uint32_t)m_DeferredInitialChunks.size());
+
+	if(ser)
+	{
+		Serialiser *prevSer = m_pSerialiser;
+		m_pSerialiser = ser;
+
+		for(size_t i=0; i < m_DeferredInitialChunks.size(); i++)
+		{
+			ser->SetOffset(m_DeferredInitialChunks[i]);
+
+			uint32_t context = ser->PushContext(NULL, 1, false);
+
+			RDCASSERT(context == INITIAL_CONTENTS);
+
+			uint64_t start = ser->GetOffset();
+
+			if(!Serialise_InitialState(ResourceType()))
+			{
+				ser->SetOffset(start);
+				ser->SkipCurrentChunk();
+			}
+
+			ser->PopContext(NULL, context);
+		}
+
+		m_pSerialiser = prevSer;
+	}
+
+	m_DeferredInitialChunks.clear();
+
+	for(size_t i=0; i < m_DeferredCreates.size(); i++)
+	{
+		ResourceId id = m_DeferredCreates[i].first;
+
+		if(HasLiveResource(id) && m_InitialContents.find(id) == m_InitialContents.end())
+			Create_InitialState(id, GetLiveResource(id), m_DeferredCreates[i].second);
+	}
+
+	m_DeferredCreates.clear();
+}
+
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::ApplyInitialContents()
 {
@@ -813,12 +1654,11 @@ void ResourceManager<ResourceType, RecordType>::MarkUnwrittenResources()
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::InsertReferencedChunks(Serialiser *fileSer)
 {
-	map<int32_t,Chunk*> sortedChunks;
+	typename RecordType::ChunkList sortedChunks;
 
+	ReferencesLock refLock(this);
 	SCOPED_LOCK(m_Lock);
 
-	RDCDEBUG("%u frame resource records", (uint32_t)m_FrameReferencedResources.size());
-
 	if(RenderDoc::Inst().GetCaptureOptions().RefAllResources)
 	{
 		for(auto it=m_ResourceRecords.begin(); it != m_ResourceRecords.end(); ++it)
@@ -831,14 +1671,27 @@ void ResourceManager<ResourceType, RecordType>::InsertReferencedChunks(Serialise
 	}
 	else
 	{
-		for(auto it=m_FrameReferencedResources.begin(); it != m_FrameReferencedResources.end(); ++it)
+		size_t numRefs = 0;
+
+		for(size_t s=0; s < NumReferenceShards; s++)
 		{
-			RecordType *record = GetResourceRecord(it->first);
-			if(record)
-				record->Insert(sortedChunks);
+			ReferenceShard &shard = m_RefShards[s];
+
+			numRefs += shard.frameRefs.size();
+
+			for(auto it=shard.frameRefs.begin(); it != shard.frameRefs.end(); ++it)
+			{
+				RecordType *record = GetResourceRecord(it->first);
+				if(record)
+					record->Insert(sortedChunks);
+			}
 		}
+
+		RDCDEBUG("%u frame resource records", (uint32_t)numRefs);
 	}
 
+	RecordType::SortChunks(sortedChunks);
+
 	RDCDEBUG("%u frame resource chunks", (uint32_t)sortedChunks.size());
 
 	for(auto it = sortedChunks.begin(); it != sortedChunks.end(); it++)
@@ -852,48 +1705,156 @@ void ResourceManager<ResourceType, RecordType>::InsertReferencedChunks(Serialise
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::PrepareInitialContents()
 {
-	for(auto it=m_DirtyResources.begin(); it != m_DirtyResources.end(); ++it)
+	SCOPED_PROFILE("Initial state prep");
+
+	// take a copy so that other threads can keep marking resources while we prepare.
+	// Anything written from here on is modified relative to the copies we're about to make.
+	vector<ResourceId> dirty;
+	set<ResourceId> modified;
+
 	{
-		ResourceId id = *it;
-		
-		if(!HasCurrentResource(id)) continue;
+		ReferencesLock refLock(this);
 
-		RecordType *record = GetResourceRecord(id);
-		ResourceType res = GetCurrentResource(id);
+		for(size_t s=0; s < NumReferenceShards; s++)
+		{
+			ReferenceShard &shard = m_RefShards[s];
 
-		if(record == NULL || record->SpecialResource) continue;
-		
-		RDCDEBUG("Dirty Resource %llu", id);
+			dirty.insert(dirty.end(), shard.dirty.begin(), shard.dirty.end());
+			modified.insert(shard.modified.begin(), shard.modified.end());
+			shard.modified.clear();
+		}
 
-		Prepare_InitialState(res);
+		// records marked before this need marking again to count as modified
+		Atomic::Inc32(&m_DirtyEpoch);
 	}
 
-	for(auto it=m_CurrentResourceMap.begin(); it != m_CurrentResourceMap.end(); ++it)
+	// when this runs every frame (e.g. for retro capture) nearly everything dirty is still
+	// unmodified, so work out what needs a fresh copy under one lock rather than several
+	// lookups per resource, then prepare outside of it.
+	vector<ResourceType> prepare;
+
 	{
-		if(it->second == (ResourceType)RecordType::NullResource) continue;
+		SCOPED_LOCK(m_Lock);
 
-		if(Force_InitialState(it->second))
+		for(auto it=dirty.begin(); it != dirty.end(); ++it)
+		{
+			ResourceId id = *it;
+
+			auto resit = m_CurrentResourceMap.find(id);
+			if(resit == m_CurrentResourceMap.end()) continue;
+
+			auto recit = m_ResourceRecords.find(id);
+			if(recit == m_ResourceRecords.end() || recit->second == NULL || recit->second->SpecialResource) continue;
+
+			if(HasReusableInitialState(id, resit->second, modified))
+			{
+				RDCDEBUG("Dirty Resource %llu unmodified since last prepared", id);
+				continue;
+			}
+
+			RDCDEBUG("Dirty Resource %llu", id);
+
+			prepare.push_back(resit->second);
+		}
+
+		for(auto it=m_ForcedInitialStates.begin(); it != m_ForcedInitialStates.end(); ++it)
 		{
-			Prepare_InitialState(it->second);
+			auto resit = m_CurrentResourceMap.find(*it);
+			if(resit == m_CurrentResourceMap.end()) continue;
+
+			if(!HasReusableInitialState(*it, resit->second, modified))
+				prepare.push_back(resit->second);
 		}
 	}
+
+	for(auto it=prepare.begin(); it != prepare.end(); ++it)
+		Prepare_InitialState(*it);
+}
+
+template<typename ResourceType, typename RecordType>
+bool ResourceManager<ResourceType, RecordType>::HasReusableInitialState(ResourceId id, ResourceType res, const set<ResourceId> &modified)
+{
+	if(modified.find(id) != modified.end() || !Reuse_InitialState(res))
+		return false;
+
+	SCOPED_LOCK(m_Lock);
+
+	return m_InitialContents.find(id) != m_InitialContents.end();
+}
+
+template<typename ResourceType, typename RecordType>
+void ResourceManager<ResourceType, RecordType>::GetResourceMemoryUsage(vector<ResourceMemoryUsage> &usage)
+{
+	SCOPED_LOCK(m_Lock);
+
+	// records can't be removed while we hold the lock, so they stay alive while we look at them
+	for(auto it=m_ResourceRecords.begin(); it != m_ResourceRecords.end(); ++it)
+	{
+		RecordType *record = it->second;
+
+		ResourceMemoryUsage res;
+		res.ResourceID = it->first.id;
+		res.ChunkBytes = record->GetChunkMemory(res.NumChunks);
+		res.ShadowBytes = record->GetShadowMemory();
+		res.InitialContentsBytes = 0;
+
+		auto initial = m_InitialContents.find(it->first);
+		if(initial != m_InitialContents.end())
+			res.InitialContentsBytes += initial->second.size;
+
+		auto initialChunk = m_InitialChunks.find(it->first);
+		if(initialChunk != m_InitialChunks.end())
+			res.InitialContentsBytes += initialChunk->second->GetLength();
+
+		usage.push_back(res);
+	}
 }
 
 template<typename ResourceType, typename RecordType>
 void ResourceManager<ResourceType, RecordType>::InsertInitialContentsChunks(Serialiser *fileSerialiser)
 {
+	ReferencesLock refLock(this);
 	SCOPED_LOCK(m_Lock);
 
-	for(auto it=m_DirtyResources.begin(); it != m_DirtyResources.end(); ++it)
+	if(RenderDoc::Inst().GetCaptureOptions().DeltaInitialContents)
 	{
-		ResourceId id = *it;
-		
-		if(m_FrameReferencedResources.find(id) == m_FrameReferencedResources.end() &&
-			 !RenderDoc::Inst().GetCaptureOptions().RefAllResources)
+		m_InitialDataLog = fileSerialiser->GetFilename();
+		m_InitialDataBasesFound.clear();
+
+		if(m_InitialDataSer == NULL)
+			m_InitialDataSer = new Serialiser(NULL, Serialiser::WRITING, false);
+	}
+
+	vector<ResourceId> dirty;
+
+	for(size_t s=0; s < NumReferenceShards; s++)
+	{
+		ReferenceShard &shard = m_RefShards[s];
+
+		for(auto it=shard.dirty.begin(); it != shard.dirty.end(); ++it)
 		{
-			RDCDEBUG("Resource %llu is GPU dirty but not referenced - skipping", id);
-			continue;
+			if(shard.frameRefs.find(*it) == shard.frameRefs.end() &&
+				 !RenderDoc::Inst().GetCaptureOptions().RefAllResources)
+			{
+				RDCDEBUG("Resource %llu is GPU dirty but not referenced - skipping", *it);
+				continue;
+			}
+
+			auto ref = shard.frameRefs.find(*it);
+			if(ref != shard.frameRefs.end() && ref->second == eFrameRef_CompleteWrite &&
+				 !RenderDoc::Inst().GetCaptureOptions().SaveAllInitials)
+			{
+				RDCDEBUG("Resource %llu is completely overwritten before being read - skipping", *it);
+				continue;
+			}
+
+			dirty.push_back(*it);
 		}
+	}
+
+	for(auto it=dirty.begin(); it != dirty.end(); ++it)
+	{
+		ResourceId id = *it;
 		
 		if(!HasCurrentResource(id)) continue;
 
@@ -956,6 +1917,22 @@ void ResourceManager<ResourceType, RecordType>::InsertInitialContentsChunks(Seri
 		delete it->second;
 
 	m_InitialChunks.clear();
+
+	// the data chunks can go anywhere in the log as they're all read up front
+	for(auto it=m_InitialDataChunks.begin(); it != m_InitialDataChunks.end(); ++it)
+		fileSerialiser->Insert(*it);
+
+	m_InitialDataChunks.clear();
+
+	m_InitialDataLog = "";
+
+	for(auto it=m_InitialDataSnapshots.begin(); it != m_InitialDataSnapshots.end();)
+	{
+		if(HasCurrentResource(it->first.first))
+			++it;
+		else
+			m_InitialDataSnapshots.erase(it++);
+	}
 }
 
 template<typename ResourceType, typename RecordType>
@@ -974,19 +1951,34 @@ void ResourceManager<ResourceType, RecordType>::ReleaseInFrameResources()
 }
 
 template<typename ResourceType, typename RecordType>
-void ResourceManager<ResourceType, RecordType>::ClearReferencedResources()
+void ResourceManager<ResourceType, RecordType>::ClearReferencedResources(bool discardedFrame)
 {	
+	ReferencesLock refLock(this);
 	SCOPED_LOCK(m_Lock);
 	
-	for(auto it=m_FrameReferencedResources.begin(); it != m_FrameReferencedResources.end(); ++it)
+	for(size_t s=0; s < NumReferenceShards; s++)
 	{
-		RecordType *record = GetResourceRecord(it->first);
+		ReferenceShard &shard = m_RefShards[s];
 
-		if(record)
-			record->Delete(this);
-	}
+		for(auto it=shard.frameRefs.begin(); it != shard.frameRefs.end(); ++it)
+		{
+			// writes inside a captured frame aren't marked dirty, so catch them here
+			if(it->second != eFrameRef_ReadOnly)
+			{
+				shard.modified.insert(it->first);
+
+				if(discardedFrame)
+					shard.dirty.insert(it->first);
+			}
 
-	m_FrameReferencedResources.clear();
+			RecordType *record = GetResourceRecord(it->first);
+
+			if(record)
+				record->Delete(this);
+		}
+
+		shard.frameRefs.clear();
+	}
 }
 
 template<typename ResourceType, typename RecordType>
@@ -1015,6 +2007,7 @@ template<typename ResourceType, typename RecordType>
 RecordType *ResourceManager<ResourceType, RecordType>::GetResourceRecord(ResourceId id)
 {
 	SCOPED_LOCK(m_Lock);
+	SCOPED_OVERHEAD(eOverhead_RecordLookup);
 
 	auto it = m_ResourceRecords.find(id);
 
@@ -1212,6 +2205,9 @@ void ResourceManager<ResourceType, RecordType>::AddCurrentResource(ResourceId id
 
 	RDCASSERT(m_CurrentResourceMap.find(id) == m_CurrentResourceMap.end());
 	m_CurrentResourceMap[id] = res;
+
+	if(res != (ResourceType)RecordType::NullResource && Force_InitialState(res))
+		m_ForcedInitialStates.insert(id);
 }
 
 template<typename ResourceType, typename RecordType>
@@ -1238,6 +2234,7 @@ void ResourceManager<ResourceType, RecordType>::ReleaseCurrentResource(ResourceI
 
 	RDCASSERT(m_CurrentResourceMap.find(id) != m_CurrentResourceMap.end());
 	m_CurrentResourceMap.erase(id);
+	m_ForcedInitialStates.erase(id);
 }
 
 template<typename ResourceType, typename RecordType>
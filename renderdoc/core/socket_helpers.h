@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include "lz4/lz4.h"
+
 template<typename PacketTypeEnum>
 bool RecvPacket(Network::Socket *sock, PacketTypeEnum &type, vector<byte> &payload)
 {
@@ -51,20 +53,46 @@ bool RecvPacket(Network::Socket *sock, PacketTypeEnum &type, vector<byte> &paylo
 	return true;
 }
 
+// receives straight into a serialiser's buffer. If *ser is already a serialiser (e.g. from
+// the previous packet) it's reused, so its buffer doesn't need to be reallocated.
 template<typename PacketTypeEnum>
 bool RecvPacket(Network::Socket *sock, PacketTypeEnum &type, Serialiser **ser)
 {
-	if(sock == NULL) return false;
+	if(sock == NULL)
+	{
+		SAFE_DELETE(*ser);
+		return false;
+	}
 
-	vector<byte> payload;
-	bool ret = RecvPacket(sock, type, payload);
-	if(!ret)
+	uint32_t t = 0;
+	uint32_t payloadLength = 0;
+
+	if(!sock->RecvDataBlocking(&t, sizeof(t)) ||
+		!sock->RecvDataBlocking(&payloadLength, sizeof(payloadLength)))
+	{
+		SAFE_DELETE(*ser);
+		return false;
+	}
+
+	byte *dst = NULL;
+
+	if(*ser)
+	{
+		dst = (*ser)->ResetForReading(payloadLength);
+	}
+	else
 	{
-		*ser = NULL;
+		*ser = new Serialiser(payloadLength, NULL, false);
+		dst = (*ser)->GetRawPtr(0);
+	}
+
+	if(!sock->RecvDataBlocking(dst, payloadLength))
+	{
+		SAFE_DELETE(*ser);
 		return false;
 	}
 
-	*ser = new Serialiser(payload.size(), &payload[0], false);
+	type = (PacketTypeEnum)t;
 
 	return true;
 }
@@ -77,13 +105,13 @@ bool SendPacket(Network::Socket *sock, PacketTypeEnum type)
 	uint32_t payloadLength = 0;
 
 	uint32_t t = (uint32_t)type;
-	if(!sock->SendDataBlocking(&t, sizeof(t)))
-		return false;
 
-	if(!sock->SendDataBlocking(&payloadLength, sizeof(payloadLength)))
-		return false;
+	Network::SendBuffer bufs[] = {
+		{ &t, sizeof(t) },
+		{ &payloadLength, sizeof(payloadLength) },
+	};
 
-	return true;
+	return sock->SendDataBlocking(bufs, 2);
 }
 
 template<typename PacketTypeEnum>
@@ -92,21 +120,210 @@ bool SendPacket(Network::Socket *sock, PacketTypeEnum type, const Serialiser &se
 	if(sock == NULL) return false;
 
 	uint32_t t = (uint32_t)type;
-	if(!sock->SendDataBlocking(&t, sizeof(t)))
-		return false;
-	
 	uint32_t payloadLength = ser.GetOffset()&0xffffffff;
-	if(!sock->SendDataBlocking(&payloadLength, sizeof(payloadLength)))
+
+	Network::SendBuffer bufs[] = {
+		{ &t, sizeof(t) },
+		{ &payloadLength, sizeof(payloadLength) },
+		{ ser.GetRawPtr(0), payloadLength },
+	};
+
+	return sock->SendDataBlocking(bufs, 3);
+}
+
+// Files are sent as a header packet (optionally with the caller's own data serialised in
+// front of it) followed by one packet per buffer. Each buffer packet carries its raw length,
+// an adler-32 of the raw data and the LZ4 compressed length (0 if it's stored uncompressed),
+// so a damaged buffer is caught before it reaches the disk.
+//
+// A receiver that already has the start of the file can ask for a resume by passing the
+// length and checksum of what it has. The sender verifies that against its own copy and
+// either continues from that offset or restarts from 0, and the header tells the receiver
+// which it chose.
+struct ChunkedFileHeader
+{
+	uint64_t fileLength;
+	uint64_t offset;
+	uint32_t bufLength;
+	uint32_t numBuffers;
+};
+
+inline uint32_t Adler32(uint32_t adler, const byte *data, size_t len)
+{
+	const uint32_t mod = 65521;
+	// largest n such that 255n(n+1)/2 + (n+1)(mod-1) fits in 32 bits
+	const size_t nmax = 5552;
+
+	uint32_t a = adler & 0xffff;
+	uint32_t b = adler >> 16;
+
+	while(len > 0)
+	{
+		size_t n = RDCMIN(len, nmax);
+		len -= n;
+
+		for(size_t i=0; i < n; i++)
+		{
+			a += data[i];
+			b += a;
+		}
+
+		data += n;
+		a %= mod;
+		b %= mod;
+	}
+
+	return (b << 16) | a;
+}
+
+// checksum of the first length bytes of f, reading from the start. Leaves the file
+// positioned at length. Returns false if the file is shorter than length.
+inline bool FileChecksum(FILE *f, uint64_t length, uint32_t &checksum)
+{
+	FileIO::fseek64(f, 0, SEEK_SET);
+
+	const size_t bufLen = 4*1024*1024;
+	byte *buf = new byte[bufLen];
+
+	checksum = 1;
+
+	while(length > 0)
+	{
+		size_t n = (size_t)RDCMIN((uint64_t)bufLen, length);
+		if(FileIO::fread(buf, 1, n, f) != n)
+			break;
+
+		checksum = Adler32(checksum, buf, n);
+		length -= n;
+	}
+
+	delete[] buf;
+
+	return length == 0;
+}
+
+// fetches the length and checksum of an existing partial copy at path, to request a resume.
+// Both are 0 if there's nothing to resume from.
+inline void GetResumePoint(const char *path, uint64_t &length, uint32_t &checksum)
+{
+	length = 0;
+	checksum = 0;
+
+	FILE *f = FileIO::fopen(path, "rb");
+
+	if(f == NULL)
+		return;
+
+	FileIO::fseek64(f, 0, SEEK_END);
+	length = FileIO::ftell64(f);
+
+	if(length == 0 || !FileChecksum(f, length, checksum))
+	{
+		length = 0;
+		checksum = 0;
+	}
+
+	FileIO::fclose(f);
+}
+
+template<typename PacketTypeEnum>
+bool SendFileChunk(Network::Socket *sock, PacketTypeEnum type, const byte *buf, uint32_t len, bool compress, vector<byte> &scratch)
+{
+	uint32_t chunkHeader[3] = { len, Adler32(1, buf, len), 0 };
+
+	const byte *data = buf;
+	uint32_t dataLen = len;
+
+	if(compress && len > 0)
+	{
+		if(scratch.size() < len) scratch.resize(len);
+
+		// only keep the compressed data if it actually saves something
+		int compSize = LZ4_compress_limitedOutput((const char *)buf, (char *)&scratch[0], (int)len, (int)len-1);
+
+		if(compSize > 0)
+		{
+			chunkHeader[2] = (uint32_t)compSize;
+			data = &scratch[0];
+			dataLen = (uint32_t)compSize;
+		}
+	}
+
+	uint32_t t = (uint32_t)type;
+	uint32_t payloadLength = sizeof(chunkHeader) + dataLen;
+
+	Network::SendBuffer bufs[] = {
+		{ &t, sizeof(t) },
+		{ &payloadLength, sizeof(payloadLength) },
+		{ chunkHeader, sizeof(chunkHeader) },
+		{ data, dataLen },
+	};
+
+	return sock->SendDataBlocking(bufs, 4);
+}
+
+// receives one buffer and writes it to f, after verifying its checksum.
+template<typename PacketTypeEnum>
+bool RecvFileChunk(Network::Socket *sock, PacketTypeEnum packetType, FILE *f, vector<byte> &payload, vector<byte> &scratch)
+{
+	PacketTypeEnum type;
+
+	if(!RecvPacket(sock, type, payload))
 		return false;
 
-	if(!sock->SendDataBlocking(ser.GetRawPtr(0), payloadLength))
+	if(type != packetType)
 		return false;
 
-	return true;
+	uint32_t chunkHeader[3];
+
+	if(payload.size() < sizeof(chunkHeader))
+		return false;
+
+	memcpy(chunkHeader, &payload[0], sizeof(chunkHeader));
+
+	uint32_t len = chunkHeader[0];
+	uint32_t compSize = chunkHeader[2];
+
+	if(len == 0)
+		return true;
+
+	const byte *data = &payload[sizeof(chunkHeader)];
+	size_t dataLen = payload.size() - sizeof(chunkHeader);
+
+	if(compSize > 0)
+	{
+		if(compSize != dataLen)
+			return false;
+
+		if(scratch.size() < len) scratch.resize(len);
+
+		int decompSize = LZ4_decompress_safe((const char *)data, (char *)&scratch[0], (int)compSize, (int)len);
+
+		if(decompSize != (int)len)
+		{
+			RDCERR("Failed to decompress file chunk");
+			return false;
+		}
+
+		data = &scratch[0];
+	}
+	else if(dataLen != len)
+	{
+		return false;
+	}
+
+	if(Adler32(1, data, len) != chunkHeader[1])
+	{
+		RDCERR("Checksum mismatch on received file chunk");
+		return false;
+	}
+
+	return FileIO::fwrite(data, 1, len, f) == len;
 }
 
+// receives the header packet. ser is left holding any of the sender's own data, at offset 0
 template<typename PacketTypeEnum>
-bool RecvChunkedFile(Network::Socket *sock, PacketTypeEnum packetType, const char *logfile, Serialiser *&ser, float *progress)
+bool RecvChunkedFileHeader(Network::Socket *sock, PacketTypeEnum packetType, Serialiser *&ser, ChunkedFileHeader &header)
 {
 	if(sock == NULL) return false;
 
@@ -119,22 +336,36 @@ bool RecvChunkedFile(Network::Socket *sock, PacketTypeEnum packetType, const cha
 	if(type != packetType)
 		return false;
 
-	ser = new Serialiser(payload.size(), &payload[0], false);
+	uint64_t headerSize = sizeof(uint64_t)*2 + sizeof(uint32_t)*2;
 
-	uint64_t fileLength;
-	uint32_t bufLength;
-	uint32_t numBuffers;
+	if(payload.size() < headerSize)
+		return false;
+
+	ser = new Serialiser(payload.size(), &payload[0], false);
 
 	uint64_t sz = ser->GetSize();
-	ser->SetOffset(sz - sizeof(uint64_t) - sizeof(uint32_t)*2);
+	ser->SetOffset(sz - headerSize);
 
-	ser->Serialise("", fileLength);
-	ser->Serialise("", bufLength);
-	ser->Serialise("", numBuffers);
+	ser->Serialise("", header.fileLength);
+	ser->Serialise("", header.offset);
+	ser->Serialise("", header.bufLength);
+	ser->Serialise("", header.numBuffers);
 
 	ser->SetOffset(0);
 
-	FILE *f = FileIO::fopen(logfile, "wb");
+	return true;
+}
+
+template<typename PacketTypeEnum>
+bool RecvChunkedFile(Network::Socket *sock, PacketTypeEnum packetType, const char *logfile, Serialiser *&ser, float *progress)
+{
+	ChunkedFileHeader header;
+
+	if(!RecvChunkedFileHeader(sock, packetType, ser, header))
+		return false;
+
+	// if the sender accepted a resume, the file already holds exactly the first offset bytes
+	FILE *f = FileIO::fopen(logfile, header.offset > 0 ? "ab" : "wb");
 
 	if(f == NULL)
 	{
@@ -143,23 +374,17 @@ bool RecvChunkedFile(Network::Socket *sock, PacketTypeEnum packetType, const cha
 	
 	if(progress) *progress = 0.0001f;
 
-	for(uint32_t i=0; i < numBuffers; i++)
-	{
-		if(!RecvPacket(sock, type, payload))
-		{
-			FileIO::fclose(f);
-			return false;
-		}
+	vector<byte> payload, scratch;
 
-		if(type != packetType)
+	for(uint32_t i=0; i < header.numBuffers; i++)
+	{
+		if(!RecvFileChunk(sock, packetType, f, payload, scratch))
 		{
 			FileIO::fclose(f);
 			return false;
 		}
 
-		FileIO::fwrite(&payload[0], 1, payload.size(), f);
-
-		if(progress) *progress = float(i+1)/float(numBuffers);
+		if(progress) *progress = float(i+1)/float(header.numBuffers);
 	}
 	
 	FileIO::fclose(f);
@@ -168,7 +393,8 @@ bool RecvChunkedFile(Network::Socket *sock, PacketTypeEnum packetType, const cha
 }
 
 template<typename PacketTypeEnum>
-bool SendChunkedFile(Network::Socket *sock, PacketTypeEnum type, const char *logfile, Serialiser &ser, float *progress)
+bool SendChunkedFile(Network::Socket *sock, PacketTypeEnum type, const char *logfile, Serialiser &ser, float *progress,
+                     uint64_t resumeOffset = 0, uint32_t resumeChecksum = 0, bool compress = true)
 {
 	if(sock == NULL) return false;
 
@@ -183,12 +409,29 @@ bool SendChunkedFile(Network::Socket *sock, PacketTypeEnum type, const char *log
 	uint64_t fileLen = FileIO::ftell64(f);
 	FileIO::fseek64(f, 0, SEEK_SET);
 
-	uint32_t bufLen = (uint32_t)RDCMIN((uint64_t)4*1024*1024, fileLen);
-	uint64_t n = fileLen / (uint64_t)bufLen;
-	uint32_t numBufs = (uint32_t)n;
-	if(fileLen % (uint64_t)bufLen > 0) numBufs++; // last remaining buffer
+	uint64_t offset = 0;
+
+	if(resumeOffset > 0 && resumeOffset <= fileLen)
+	{
+		uint32_t checksum = 0;
+		if(FileChecksum(f, resumeOffset, checksum) && checksum == resumeChecksum)
+		{
+			RDCLOG("Resuming transfer of %s at %llu of %llu bytes", logfile, resumeOffset, fileLen);
+			offset = resumeOffset;
+		}
+		else
+		{
+			FileIO::fseek64(f, 0, SEEK_SET);
+		}
+	}
+
+	uint64_t remaining = fileLen - offset;
+
+	uint32_t bufLen = 4*1024*1024;
+	uint32_t numBufs = (uint32_t)((remaining + bufLen - 1) / (uint64_t)bufLen);
 
 	ser.Serialise("", fileLen);
+	ser.Serialise("", offset);
 	ser.Serialise("", bufLen);
 	ser.Serialise("", numBufs);
 
@@ -199,25 +442,21 @@ bool SendChunkedFile(Network::Socket *sock, PacketTypeEnum type, const char *log
 	}
 
 	byte *buf = new byte[bufLen];
-
-	uint32_t t = (uint32_t)type;
+	vector<byte> scratch;
 
 	if(progress) *progress = 0.0001f;
 
 	for(uint32_t i=0; i < numBufs; i++)
 	{
-		uint32_t payloadLength = RDCMIN(bufLen, (uint32_t)(fileLen&0xffffffff));
+		uint32_t payloadLength = (uint32_t)RDCMIN((uint64_t)bufLen, remaining);
 
-		FileIO::fread(buf, 1, payloadLength, f);
+		if(FileIO::fread(buf, 1, payloadLength, f) != payloadLength)
+			break;
 
-		if(!sock->SendDataBlocking(&t, sizeof(t)) ||
-			!sock->SendDataBlocking(&payloadLength, sizeof(payloadLength)) ||
-			!sock->SendDataBlocking(buf, payloadLength))
-		{
+		if(!SendFileChunk(sock, type, buf, payloadLength, compress, scratch))
 			break;
-		}
 		
-		fileLen -= payloadLength;
+		remaining -= payloadLength;
 		if(progress) *progress = float(i+1)/float(numBufs);
 	}
 
@@ -225,7 +464,7 @@ bool SendChunkedFile(Network::Socket *sock, PacketTypeEnum type, const char *log
 
 	FileIO::fclose(f);
 
-	if(fileLen != 0)
+	if(remaining != 0)
 	{
 		return false;
 	}
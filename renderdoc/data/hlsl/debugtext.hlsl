@@ -22,8 +22,9 @@
  * THE SOFTWARE.
  ******************************************************************************/
 
-// text shader, used for the overlay in game so that we can pass indices in the positon stream
-// and it figures out the right place in the text texture to sample.
+// text shader, used for the overlay in game. Each character is an instance of a single quad,
+// with its cell position and glyph index, and it figures out the right place in the text
+// texture to sample.
 
 struct glyph
 {
@@ -43,11 +44,11 @@ struct v2f
 	float2 glyphuv : GLYPH;
 };
 
-v2f RENDERDOC_TextVS(float3 pos : POSITION, uint tex : GLYPHIDX)
+v2f RENDERDOC_TextVS(float2 pos : POSITION, float2 cell : CHARPOS, uint tex : GLYPHIDX)
 {
 	v2f OUT = (v2f)0;
 
-	float2 charPos = float2(pos.z + pos.x + TextPosition.x, -pos.y - TextPosition.y);
+	float2 charPos = float2(cell.x + pos.x + TextPosition.x, -cell.y - pos.y - TextPosition.y);
 	glyph G = glyphs[tex];
 	
 	OUT.pos = float4(charPos.xy*2.0f*TextSize*FontScreenAspect.xy + float2(-1, 1), 1, 1);
@@ -179,6 +179,70 @@ float RENDERDOC_DepthCopyMSToArray(wireframeV2F IN) : SV_Depth
 	return 0;
 }
 
+// compute versions of the copies above for colour formats, that write every sample of
+// every slice in one dispatch. There's one thread per destination texel, and the array
+// slice it writes is (source slice * sampleCount + sample).
+
+RWTexture2DArray<uint4> destArray : register(u0);
+
+[numthreads(8, 8, 1)]
+void RENDERDOC_CopyMSToArrayCS(uint3 tid : SV_DispatchThreadID)
+{
+	uint width, height, elements;
+	destArray.GetDimensions(width, height, elements);
+
+	if(tid.x >= width || tid.y >= height || tid.z >= elements)
+		return;
+
+	uint3 srcCoord = uint3(tid.x, tid.y, tid.z / sampleCount);
+	uint srcSample = tid.z % sampleCount;
+
+	uint4 val = 0;
+
+	if(sampleCount == 2)
+		val = sourceMS2.Load(srcCoord, srcSample);
+	else if(sampleCount == 4)
+		val = sourceMS4.Load(srcCoord, srcSample);
+	else if(sampleCount == 8)
+		val = sourceMS8.Load(srcCoord, srcSample);
+	else if(sampleCount == 16)
+		val = sourceMS16.Load(srcCoord, srcSample);
+	else if(sampleCount == 32)
+		val = sourceMS32.Load(srcCoord, srcSample);
+
+	destArray[tid] = val;
+}
+
+RWTexture2DArray<float4> destFloatArray : register(u0);
+
+[numthreads(8, 8, 1)]
+void RENDERDOC_FloatCopyMSToArrayCS(uint3 tid : SV_DispatchThreadID)
+{
+	uint width, height, elements;
+	destFloatArray.GetDimensions(width, height, elements);
+
+	if(tid.x >= width || tid.y >= height || tid.z >= elements)
+		return;
+
+	uint3 srcCoord = uint3(tid.x, tid.y, tid.z / sampleCount);
+	uint srcSample = tid.z % sampleCount;
+
+	float4 val = 0;
+
+	if(sampleCount == 2)
+		val = sourceFloatMS2.Load(srcCoord, srcSample);
+	else if(sampleCount == 4)
+		val = sourceFloatMS4.Load(srcCoord, srcSample);
+	else if(sampleCount == 8)
+		val = sourceFloatMS8.Load(srcCoord, srcSample);
+	else if(sampleCount == 16)
+		val = sourceFloatMS16.Load(srcCoord, srcSample);
+	else if(sampleCount == 32)
+		val = sourceFloatMS32.Load(srcCoord, srcSample);
+
+	destFloatArray[tid] = val;
+}
+
 Texture2DArray<uint4> sourceArray : register(t0);
 
 uint4 RENDERDOC_CopyArrayToMS(wireframeV2F IN, uint curSample : SV_SampleIndex) : SV_Target0
@@ -36,6 +36,60 @@
 #include "driver/d3d11/d3d11_resources.h"
 #include "driver/d3d11/d3d11_renderstate.h"
 
+// traces store the full register set only this often, other steps just store what changed
+static const size_t DebugTraceKeyframeInterval = 64;
+
+static void DiffDebugRegisters(vector<ShaderRegisterChange> &changes, uint32_t set,
+                               const rdctype::array<ShaderVariable> &prev, const rdctype::array<ShaderVariable> &cur)
+{
+	for(int32_t i=0; i < cur.count; i++)
+	{
+		if(i < prev.count && !memcmp(prev[i].value.uv, cur[i].value.uv, sizeof(cur[i].value.uv)))
+			continue;
+
+		ShaderRegisterChange c;
+		c.set = set;
+		c.index = (uint32_t)i;
+		c.value = cur[i];
+		changes.push_back(c);
+	}
+}
+
+// appends cur to the trace, either whole as a keyframe or as the registers that changed
+// since prev (which must be the state appended just before)
+static void AddDebugState(vector<ShaderDebugState> &states, const ShaderDebugState &prev, const ShaderDebugState &cur)
+{
+	ShaderDebugState s;
+	s.nextInstruction = cur.nextInstruction;
+
+	if(states.size() % DebugTraceKeyframeInterval == 0)
+	{
+		s.registers = cur.registers;
+		s.outputs = cur.outputs;
+		s.indexableTemps = cur.indexableTemps;
+		s.keyframe = true;
+		states.push_back(s);
+		return;
+	}
+
+	vector<ShaderRegisterChange> changes;
+
+	DiffDebugRegisters(changes, 0, prev.registers, cur.registers);
+	DiffDebugRegisters(changes, 1, prev.outputs, cur.outputs);
+
+	for(int32_t i=0; i < cur.indexableTemps.count; i++)
+	{
+		if(i < prev.indexableTemps.count)
+			DiffDebugRegisters(changes, 2+i, prev.indexableTemps[i], cur.indexableTemps[i]);
+		else
+			DiffDebugRegisters(changes, 2+i, rdctype::array<ShaderVariable>(), cur.indexableTemps[i]);
+	}
+
+	s.keyframe = false;
+	s.changes = changes;
+	states.push_back(s);
+}
+
 void D3D11DebugManager::FillCBufferVariables(const string &prefix, size_t &offset, bool flatten,
 												const vector<DXBC::CBufferVariable> &invars, vector<ShaderVariable> &outvars,
 											  const vector<byte> &data)
@@ -357,10 +411,10 @@ ShaderDebug::State D3D11DebugManager::CreateShaderDebugState(ShaderDebugTrace &t
 
 	bool inputCoverage = false;
 	
-	for(size_t i=0; i < dxbc->m_Declarations.size(); i++)
+	for(size_t i=0; i < dxbc->GetDeclarations().size(); i++)
 	{
-		if(dxbc->m_Declarations[i].declaration == OPCODE_DCL_INPUT &&
-			 dxbc->m_Declarations[i].operand.type == TYPE_INPUT_COVERAGE_MASK)
+		if(dxbc->GetDeclarations()[i].declaration == OPCODE_DCL_INPUT &&
+			 dxbc->GetDeclarations()[i].operand.type == TYPE_INPUT_COVERAGE_MASK)
 		{
 			inputCoverage = true;
 			break;
@@ -504,8 +558,29 @@ ShaderDebug::State D3D11DebugManager::CreateShaderDebugState(ShaderDebugTrace &t
 	return initialState;
 }
 
-void D3D11DebugManager::CreateShaderGlobalState(ShaderDebug::GlobalState &global, DXBC::DXBCFile *dxbc, uint32_t UAVStartSlot, ID3D11UnorderedAccessView **UAVs, ID3D11ShaderResourceView **SRVs)
+void D3D11DebugManager::CreateShaderGlobalState(ShaderDebug::GlobalState &global, uint32_t frameID, uint32_t eventID, DXBC::DXBCFile *dxbc,
+                                                uint32_t UAVStartSlot, ID3D11UnorderedAccessView **UAVs, ID3D11ShaderResourceView **SRVs)
 {
+	GlobalStateCache &cache = m_GlobalStateCache;
+
+	ID3D11UnorderedAccessView *uavs[D3D11_PS_CS_UAV_REGISTER_COUNT] = {0};
+	ID3D11ShaderResourceView *srvs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT] = {0};
+
+	for(int i=0; UAVs != NULL && i+UAVStartSlot < D3D11_PS_CS_UAV_REGISTER_COUNT; i++)
+		uavs[i] = UAVs[i];
+	for(int i=0; SRVs != NULL && i < D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT; i++)
+		srvs[i] = SRVs[i];
+
+	if(cache.valid && cache.frameID == frameID && cache.eventID == eventID && cache.dxbc == dxbc &&
+	   cache.UAVStartSlot == UAVStartSlot && !memcmp(cache.UAVs, uavs, sizeof(uavs)) && !memcmp(cache.SRVs, srvs, sizeof(srvs)))
+	{
+		// the interpreter writes to UAVs and groupshared memory, so hand out a copy
+		global = cache.global;
+		return;
+	}
+
+	global.Decode(dxbc);
+
 	for(int i=0; UAVs != NULL && i+UAVStartSlot < D3D11_PS_CS_UAV_REGISTER_COUNT; i++)
 	{
 		int dsti = i+UAVStartSlot;
@@ -761,12 +836,12 @@ void D3D11DebugManager::CreateShaderGlobalState(ShaderDebug::GlobalState &global
 		}
 	}
 
-	for(size_t i=0; i < dxbc->m_Declarations.size(); i++)
+	for(size_t i=0; i < dxbc->GetDeclarations().size(); i++)
 	{
-		if(dxbc->m_Declarations[i].declaration == DXBC::OPCODE_DCL_THREAD_GROUP_SHARED_MEMORY_RAW ||
-		   dxbc->m_Declarations[i].declaration == DXBC::OPCODE_DCL_THREAD_GROUP_SHARED_MEMORY_STRUCTURED)
+		if(dxbc->GetDeclarations()[i].declaration == DXBC::OPCODE_DCL_THREAD_GROUP_SHARED_MEMORY_RAW ||
+		   dxbc->GetDeclarations()[i].declaration == DXBC::OPCODE_DCL_THREAD_GROUP_SHARED_MEMORY_STRUCTURED)
 		{
-			uint32_t slot = (uint32_t)dxbc->m_Declarations[i].operand.indices[0].index;
+			uint32_t slot = (uint32_t)dxbc->GetDeclarations()[i].operand.indices[0].index;
 
 			if(global.groupshared.size() <= slot)
 			{
@@ -774,11 +849,11 @@ void D3D11DebugManager::CreateShaderGlobalState(ShaderDebug::GlobalState &global
 
 				ShaderDebug::GlobalState::groupsharedMem &mem = global.groupshared[slot];
 
-				mem.structured = (dxbc->m_Declarations[i].declaration == DXBC::OPCODE_DCL_THREAD_GROUP_SHARED_MEMORY_STRUCTURED);
+				mem.structured = (dxbc->GetDeclarations()[i].declaration == DXBC::OPCODE_DCL_THREAD_GROUP_SHARED_MEMORY_STRUCTURED);
 
-				mem.count = dxbc->m_Declarations[i].count;
+				mem.count = dxbc->GetDeclarations()[i].count;
 				if(mem.structured)
-					mem.bytestride= dxbc->m_Declarations[i].stride;
+					mem.bytestride= dxbc->GetDeclarations()[i].stride;
 				else
 					mem.bytestride= 4; // raw groupshared is implicitly uint32s
 
@@ -786,6 +861,15 @@ void D3D11DebugManager::CreateShaderGlobalState(ShaderDebug::GlobalState &global
 			}
 		}
 	}
+
+	cache.valid = true;
+	cache.frameID = frameID;
+	cache.eventID = eventID;
+	cache.dxbc = dxbc;
+	cache.UAVStartSlot = UAVStartSlot;
+	memcpy(cache.UAVs, uavs, sizeof(uavs));
+	memcpy(cache.SRVs, srvs, sizeof(srvs));
+	cache.global = global;
 }
 		
 // struct that saves pointers as we iterate through to where we ultimately
@@ -818,6 +902,8 @@ struct DebugHit
 
 ShaderDebugTrace D3D11DebugManager::DebugVertex(uint32_t frameID, uint32_t eventID, uint32_t vertid, uint32_t instid, uint32_t idx, uint32_t instOffset, uint32_t vertOffset)
 {
+	EnsureDebugRendering();
+
 	using namespace DXBC;
 	using namespace ShaderDebug;
 
@@ -892,7 +978,7 @@ ShaderDebugTrace D3D11DebugManager::DebugVertex(uint32_t frameID, uint32_t event
 	ShaderDebugTrace ret;
 	
 	GlobalState global;
-	CreateShaderGlobalState(global, dxbc, 0, NULL, rs->VS.SRVs);
+	CreateShaderGlobalState(global, frameID, eventID, dxbc, 0, NULL, rs->VS.SRVs);
 	State initialState = CreateShaderDebugState(ret, -1, dxbc, cbufData);
 
 	for(int32_t i=0; i < ret.inputs.count; i++)
@@ -1139,16 +1225,24 @@ ShaderDebugTrace D3D11DebugManager::DebugVertex(uint32_t frameID, uint32_t event
 
 	vector<ShaderDebugState> states;
 
-	states.push_back((State)initialState);
+	AddDebugState(states, initialState, initialState);
+
+	// ping pong between the two states rather than copying each step
+	State *cur = &initialState;
+	State *prev = &last;
 	
 	while(true)
 	{
-		if(initialState.Finished())
+		if(cur->Finished())
 			break;
 
-		initialState = initialState.GetNext(global, NULL);
+		State *a = prev;
+		prev = cur;
+		cur = a;
 
-		states.push_back((State)initialState);
+		prev->StepInto(global, NULL, *cur);
+
+		AddDebugState(states, *prev, *cur);
 	}
 
 	ret.states = states;
@@ -1158,6 +1252,8 @@ ShaderDebugTrace D3D11DebugManager::DebugVertex(uint32_t frameID, uint32_t event
 
 ShaderDebugTrace D3D11DebugManager::DebugPixel(uint32_t frameID, uint32_t eventID, uint32_t x, uint32_t y, uint32_t sample, uint32_t primitive)
 {
+	EnsureDebugRendering();
+
 	using namespace DXBC;
 	using namespace ShaderDebug;
 
@@ -1560,7 +1656,7 @@ ShaderDebugTrace D3D11DebugManager::DebugPixel(uint32_t frameID, uint32_t eventI
 	ShaderDebugTrace traces[4];
 	
 	GlobalState global;
-	CreateShaderGlobalState(global, dxbc, rs->OM.UAVStartSlot, rs->OM.UAVs, rs->PS.SRVs);
+	CreateShaderGlobalState(global, frameID, eventID, dxbc, rs->OM.UAVStartSlot, rs->OM.UAVs, rs->PS.SRVs);
 
 	{
 		DebugHit *hit = winner;
@@ -1697,7 +1793,7 @@ ShaderDebugTrace D3D11DebugManager::DebugPixel(uint32_t frameID, uint32_t eventI
 	
 	vector<ShaderDebugState> states;
 
-	states.push_back((State)quad[destIdx]);
+	AddDebugState(states, quad[destIdx], quad[destIdx]);
 	
 	// ping pong between so that we can have 'current' quad to update into new one
 	State quad2[4];
@@ -1710,13 +1806,13 @@ ShaderDebugTrace D3D11DebugManager::DebugPixel(uint32_t frameID, uint32_t eventI
 	do
 	{
 		for(size_t i = 0; i < 4; i++)
-			newquad[i] = curquad[i].GetNext(global, curquad);
+			curquad[i].StepInto(global, curquad, newquad[i]);
 
 		State *a = curquad;
 		curquad = newquad;
 		newquad = a;
 		
-		states.push_back((State)curquad[destIdx]);
+		AddDebugState(states, newquad[destIdx], curquad[destIdx]);
 
 		finished = curquad[destIdx].Finished();
 	}
@@ -1729,6 +1825,8 @@ ShaderDebugTrace D3D11DebugManager::DebugPixel(uint32_t frameID, uint32_t eventI
 
 ShaderDebugTrace D3D11DebugManager::DebugThread(uint32_t frameID, uint32_t eventID, uint32_t groupid[3], uint32_t threadid[3])
 {
+	EnsureDebugRendering();
+
 	using namespace DXBC;
 	using namespace ShaderDebug;
 
@@ -1762,7 +1860,7 @@ ShaderDebugTrace D3D11DebugManager::DebugThread(uint32_t frameID, uint32_t event
 	ShaderDebugTrace ret;
 		
 	GlobalState global;
-	CreateShaderGlobalState(global, dxbc, 0, rs->CS.UAVs, rs->CS.SRVs);
+	CreateShaderGlobalState(global, frameID, eventID, dxbc, 0, rs->CS.UAVs, rs->CS.SRVs);
 	State initialState = CreateShaderDebugState(ret, -1, dxbc, cbufData);
 	
 	for(int i=0; i < 3; i++)
@@ -1771,18 +1869,104 @@ ShaderDebugTrace D3D11DebugManager::DebugThread(uint32_t frameID, uint32_t event
 		initialState.semantics.ThreadID[i] = threadid[i];
 	}
 
+	// if the shader syncs the group, other threads' groupshared and UAV writes become
+	// visible at each barrier, so the whole group is simulated one barrier at a time.
+	// Otherwise the requested thread is simulated on its own.
+	bool groupSync = false;
+
+	for(size_t i=0; !groupSync && i < dxbc->GetInstructions().size(); i++)
+		groupSync = State::IsGroupSync(dxbc->GetInstructions()[i]);
+
+	uint32_t numthreads[3] = { 1, 1, 1 };
+
+	for(size_t i=0; i < dxbc->GetDeclarations().size(); i++)
+	{
+		if(dxbc->GetDeclarations()[i].declaration == OPCODE_DCL_THREAD_GROUP)
+		{
+			numthreads[0] = dxbc->GetDeclarations()[i].groupSize[0];
+			numthreads[1] = dxbc->GetDeclarations()[i].groupSize[1];
+			numthreads[2] = dxbc->GetDeclarations()[i].groupSize[2];
+		}
+	}
+
+	uint32_t requestedIdx = (threadid[2]*numthreads[1] + threadid[1])*numthreads[0] + threadid[0];
+
+	// each other thread ping-pongs between two states, in other[] and scratch[]
+	vector<State> groupStates;
+	vector<State*> other, scratch;
+
+	if(groupSync)
+	{
+		uint32_t numGroupThreads = numthreads[0]*numthreads[1]*numthreads[2];
+
+		groupStates.resize(numGroupThreads*2);
+
+		for(uint32_t t=0; t < numGroupThreads; t++)
+		{
+			if(t == requestedIdx)
+				continue;
+
+			State &s = groupStates[t*2];
+			s = initialState;
+			s.semantics.ThreadID[0] = t % numthreads[0];
+			s.semantics.ThreadID[1] = (t / numthreads[0]) % numthreads[1];
+			s.semantics.ThreadID[2] = t / (numthreads[0]*numthreads[1]);
+
+			other.push_back(&groupStates[t*2]);
+			scratch.push_back(&groupStates[t*2+1]);
+		}
+	}
+
+	State last;
+
 	vector<ShaderDebugState> states;
 
-	states.push_back((State)initialState);
+	AddDebugState(states, initialState, initialState);
+
+	// ping pong between the two states rather than copying each step
+	State *cur = &initialState;
+	State *prev = &last;
 	
 	while(true)
 	{
-		if(initialState.Finished())
-			break;
+		// run the rest of the group up to the next barrier
+		for(size_t t=0; t < other.size(); t++)
+		{
+			while(!other[t]->Finished() && !other[t]->AtGroupSync())
+			{
+				other[t]->StepInto(global, NULL, *scratch[t]);
+				std::swap(other[t], scratch[t]);
+			}
+		}
+
+		// then the requested thread, stepping over the barrier it stopped at last time
+		do
+		{
+			if(cur->Finished())
+				break;
+
+			State *a = prev;
+			prev = cur;
+			cur = a;
+
+			prev->StepInto(global, NULL, *cur);
 
-		initialState = initialState.GetNext(global, NULL);
+			AddDebugState(states, *prev, *cur);
+		}
+		while(!cur->AtGroupSync());
+
+		if(cur->Finished())
+			break;
 
-		states.push_back((State)initialState);
+		// every thread is waiting at the barrier (or has finished), release them
+		for(size_t t=0; t < other.size(); t++)
+		{
+			if(other[t]->AtGroupSync())
+			{
+				other[t]->StepInto(global, NULL, *scratch[t]);
+				std::swap(other[t], scratch[t]);
+			}
+		}
 	}
 
 	ret.states = states;
@@ -1792,6 +1976,8 @@ ShaderDebugTrace D3D11DebugManager::DebugThread(uint32_t frameID, uint32_t event
 
 void D3D11DebugManager::PickPixel(ResourceId texture, uint32_t x, uint32_t y, uint32_t sliceFace, uint32_t mip, uint32_t sample, float pixel[4])
 {
+	EnsureDebugRendering();
+
 	m_pImmediateContext->OMSetRenderTargets(1, &m_DebugRender.PickPixelRT, NULL);
 	
 	float color[4] = {0.0f, 0.0f, 0.0f, 0.0f};
@@ -1880,9 +2066,15 @@ void D3D11DebugManager::PickPixel(ResourceId texture, uint32_t x, uint32_t y, ui
 byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32_t mip, bool resolve, bool forceRGBA8unorm,
                                         float blackPoint, float whitePoint, size_t &dataSize)
 {
+	EnsureDebugRendering();
+
 	ID3D11Resource *dummyTex = NULL;
 
+	// subresource in the source texture, and in the staging texture we map. Usually we only
+	// stage the one subresource being read back, but unresolved MSAA textures are staged in
+	// full as they're copied to an array of every sample.
 	uint32_t subresource = 0;
+	uint32_t stagingSubresource = 0;
 	uint32_t mips = 0;
 	
 	dataSize = 0;
@@ -1914,7 +2106,12 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 
 		subresource = arrayIdx*mips + mip;
 
-		HRESULT hr = m_WrappedDevice->CreateTexture1D(&desc, NULL, &d);
+		D3D11_TEXTURE1D_DESC stagingDesc = desc;
+		stagingDesc.Width = RDCMAX(1U, desc.Width>>mip);
+		stagingDesc.MipLevels = 1;
+		stagingDesc.ArraySize = 1;
+
+		HRESULT hr = GetPooledTexture(stagingDesc, &d);
 
 		dummyTex = d;
 
@@ -1936,12 +2133,12 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			
 			ID3D11Texture1D *rtTex = NULL;
 
-			hr = m_WrappedDevice->CreateTexture1D(&desc, NULL, &rtTex);
+			hr = GetPooledTexture(desc, &rtTex);
 
 			if(FAILED(hr))
 			{
 				RDCERR("Couldn't create target texture to downcast texture. %08x", hr);
-				SAFE_RELEASE(d);
+				ReturnPooledTexture(d);
 				return NULL;
 			}
 
@@ -1950,18 +2147,16 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			rtvDesc.Format = desc.Format;
 			rtvDesc.Texture1D.MipSlice = mip;
 
-			ID3D11RenderTargetView *wrappedrtv = NULL;
-			hr = m_WrappedDevice->CreateRenderTargetView(rtTex, &rtvDesc, &wrappedrtv);
+			ID3D11RenderTargetView *rtv = NULL;
+			hr = m_pDevice->CreateRenderTargetView(rtTex, &rtvDesc, &rtv);
 			if(FAILED(hr))
 			{
 				RDCERR("Couldn't create target rtv to downcast texture. %08x", hr);
-				SAFE_RELEASE(d);
-				SAFE_RELEASE(rtTex);
+				ReturnPooledTexture(d);
+				ReturnPooledTexture(rtTex);
 				return NULL;
 			}
 
-			ID3D11RenderTargetView *rtv = UNWRAP(WrappedID3D11RenderTargetView, wrappedrtv);
-
 			m_pImmediateContext->OMSetRenderTargets(1, &rtv, NULL);
 			float color[4] = {0.0f, 0.0f, 0.0f, 0.0f};
 			m_pImmediateContext->ClearRenderTargetView(rtv, color);
@@ -1997,14 +2192,14 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			
 			SetOutputDimensions(oldW, oldH);
 			
-			m_pImmediateContext->CopyResource(UNWRAP(WrappedID3D11Texture1D, d), UNWRAP(WrappedID3D11Texture1D, rtTex));
-			SAFE_RELEASE(rtTex);
+			m_pImmediateContext->CopySubresourceRegion(d, 0, 0, 0, 0, rtTex, subresource, NULL);
+			ReturnPooledTexture(rtTex);
 
-			SAFE_RELEASE(wrappedrtv);
+			SAFE_RELEASE(rtv);
 		}
 		else
 		{
-			m_pImmediateContext->CopyResource(UNWRAP(WrappedID3D11Texture1D, d), wrapTex->GetReal());
+			m_pImmediateContext->CopySubresourceRegion(d, 0, 0, 0, 0, wrapTex->GetReal(), subresource, NULL);
 		}
 	}
 	else if(WrappedID3D11Texture2D::m_TextureList.find(id) != WrappedID3D11Texture2D::m_TextureList.end())
@@ -2044,7 +2239,28 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 
 		subresource = arrayIdx*mips + mip;
 
-		HRESULT hr = m_WrappedDevice->CreateTexture2D(&desc, NULL, &d);
+		D3D11_TEXTURE2D_DESC stagingDesc = desc;
+
+		if(wasms && !resolve && !forceRGBA8unorm)
+		{
+			stagingSubresource = subresource;
+		}
+		else
+		{
+			stagingDesc.Width = RDCMAX(1U, desc.Width>>mip);
+			stagingDesc.Height = RDCMAX(1U, desc.Height>>mip);
+			stagingDesc.MipLevels = 1;
+			stagingDesc.ArraySize = 1;
+
+			// block compressed textures must be whole blocks at the top mip
+			if(IsBlockFormat(stagingDesc.Format))
+			{
+				stagingDesc.Width = AlignUp4(stagingDesc.Width);
+				stagingDesc.Height = AlignUp4(stagingDesc.Height);
+			}
+		}
+
+		HRESULT hr = GetPooledTexture(stagingDesc, &d);
 
 		dummyTex = d;
 
@@ -2066,12 +2282,12 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			
 			ID3D11Texture2D *rtTex = NULL;
 
-			hr = m_WrappedDevice->CreateTexture2D(&desc, NULL, &rtTex);
+			hr = GetPooledTexture(desc, &rtTex);
 
 			if(FAILED(hr))
 			{
 				RDCERR("Couldn't create target texture to downcast texture. %08x", hr);
-				SAFE_RELEASE(d);
+				ReturnPooledTexture(d);
 				return NULL;
 			}
 
@@ -2080,18 +2296,16 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			rtvDesc.Format = desc.Format;
 			rtvDesc.Texture2D.MipSlice = mip;
 
-			ID3D11RenderTargetView *wrappedrtv = NULL;
-			hr = m_WrappedDevice->CreateRenderTargetView(rtTex, &rtvDesc, &wrappedrtv);
+			ID3D11RenderTargetView *rtv = NULL;
+			hr = m_pDevice->CreateRenderTargetView(rtTex, &rtvDesc, &rtv);
 			if(FAILED(hr))
 			{
 				RDCERR("Couldn't create target rtv to downcast texture. %08x", hr);
-				SAFE_RELEASE(d);
-				SAFE_RELEASE(rtTex);
+				ReturnPooledTexture(d);
+				ReturnPooledTexture(rtTex);
 				return NULL;
 			}
 
-			ID3D11RenderTargetView *rtv = UNWRAP(WrappedID3D11RenderTargetView, wrappedrtv);
-
 			m_pImmediateContext->OMSetRenderTargets(1, &rtv, NULL);
 			float color[4] = {0.0f, 0.0f, 0.0f, 0.0f};
 			m_pImmediateContext->ClearRenderTargetView(rtv, color);
@@ -2127,10 +2341,10 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			
 			SetOutputDimensions(oldW, oldH);
 			
-			m_pImmediateContext->CopyResource(UNWRAP(WrappedID3D11Texture2D, d), UNWRAP(WrappedID3D11Texture2D, rtTex));
-			SAFE_RELEASE(rtTex);
+			m_pImmediateContext->CopySubresourceRegion(d, 0, 0, 0, 0, rtTex, subresource, NULL);
+			ReturnPooledTexture(rtTex);
 
-			SAFE_RELEASE(wrappedrtv);
+			SAFE_RELEASE(rtv);
 		}
 		else if(wasms && resolve)
 		{
@@ -2139,27 +2353,27 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 
 			ID3D11Texture2D *resolveTex = NULL;
 
-			hr = m_WrappedDevice->CreateTexture2D(&desc, NULL, &resolveTex);
+			hr = GetPooledTexture(desc, &resolveTex);
 
 			if(FAILED(hr))
 			{
 				RDCERR("Couldn't create target texture to resolve texture. %08x", hr);
-				SAFE_RELEASE(d);
+				ReturnPooledTexture(d);
 				return NULL;
 			}
 
-			m_pImmediateContext->ResolveSubresource(UNWRAP(WrappedID3D11Texture2D, resolveTex), arrayIdx, wrapTex->GetReal(), arrayIdx, desc.Format);
-			m_pImmediateContext->CopyResource(UNWRAP(WrappedID3D11Texture2D, d), UNWRAP(WrappedID3D11Texture2D, resolveTex));
+			m_pImmediateContext->ResolveSubresource(resolveTex, arrayIdx, wrapTex->GetReal(), arrayIdx, desc.Format);
+			m_pImmediateContext->CopySubresourceRegion(d, 0, 0, 0, 0, resolveTex, subresource, NULL);
 
-			SAFE_RELEASE(resolveTex);
+			ReturnPooledTexture(resolveTex);
 		}
 		else if(wasms)
 		{
-			CopyTex2DMSToArray(UNWRAP(WrappedID3D11Texture2D, d), wrapTex->GetReal());
+			CopyTex2DMSToArray(d, wrapTex->GetReal());
 		}
 		else
 		{
-			m_pImmediateContext->CopyResource(UNWRAP(WrappedID3D11Texture2D, d), wrapTex->GetReal());
+			m_pImmediateContext->CopySubresourceRegion(d, 0, 0, 0, 0, wrapTex->GetReal(), subresource, NULL);
 		}
 	}
 	else if(WrappedID3D11Texture3D::m_TextureList.find(id) != WrappedID3D11Texture3D::m_TextureList.end())
@@ -2183,9 +2397,21 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 		if(forceRGBA8unorm)
 			desc.Format = IsSRGBFormat(desc.Format) ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
 
+		D3D11_TEXTURE3D_DESC stagingDesc = desc;
+		stagingDesc.Width = RDCMAX(1U, desc.Width>>mip);
+		stagingDesc.Height = RDCMAX(1U, desc.Height>>mip);
+		stagingDesc.Depth = RDCMAX(1U, desc.Depth>>mip);
+		stagingDesc.MipLevels = 1;
+
+		if(IsBlockFormat(stagingDesc.Format))
+		{
+			stagingDesc.Width = AlignUp4(stagingDesc.Width);
+			stagingDesc.Height = AlignUp4(stagingDesc.Height);
+		}
+
 		subresource = mip;
 
-		HRESULT hr = m_WrappedDevice->CreateTexture3D(&desc, NULL, &d);
+		HRESULT hr = GetPooledTexture(stagingDesc, &d);
 
 		dummyTex = d;
 
@@ -2207,12 +2433,12 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			
 			ID3D11Texture3D *rtTex = NULL;
 
-			hr = m_WrappedDevice->CreateTexture3D(&desc, NULL, &rtTex);
+			hr = GetPooledTexture(desc, &rtTex);
 
 			if(FAILED(hr))
 			{
 				RDCERR("Couldn't create target texture to downcast texture. %08x", hr);
-				SAFE_RELEASE(d);
+				ReturnPooledTexture(d);
 				return NULL;
 			}
 
@@ -2222,7 +2448,6 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			rtvDesc.Texture3D.MipSlice = mip;
 			rtvDesc.Texture3D.FirstWSlice = 0;
 			rtvDesc.Texture3D.WSize = 1;
-			ID3D11RenderTargetView *wrappedrtv = NULL;
 			ID3D11RenderTargetView *rtv = NULL;
 
 			D3D11_VIEWPORT viewport = { 0, 0, (float)(desc.Width>>mip), (float)(desc.Height>>mip), 0.0f, 1.0f };
@@ -2232,17 +2457,15 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 			for(UINT i=0; i < desc.Depth; i++)
 			{
 				rtvDesc.Texture3D.FirstWSlice = i;
-				hr = m_WrappedDevice->CreateRenderTargetView(rtTex, &rtvDesc, &wrappedrtv);
+				hr = m_pDevice->CreateRenderTargetView(rtTex, &rtvDesc, &rtv);
 				if(FAILED(hr))
 				{
 					RDCERR("Couldn't create target rtv to downcast texture. %08x", hr);
-					SAFE_RELEASE(d);
-					SAFE_RELEASE(rtTex);
+					ReturnPooledTexture(d);
+					ReturnPooledTexture(rtTex);
 					return NULL;
 				}
 
-				rtv = UNWRAP(WrappedID3D11RenderTargetView, wrappedrtv);
-
 				m_pImmediateContext->OMSetRenderTargets(1, &rtv, NULL);
 				float color[4] = {0.0f, 0.5f, 0.0f, 0.0f};
 				m_pImmediateContext->ClearRenderTargetView(rtv, color);
@@ -2271,24 +2494,27 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 
 				RenderTexture(texDisplay, false);
 
-				SAFE_RELEASE(wrappedrtv);
+				SAFE_RELEASE(rtv);
 			}
 			
 			SetOutputDimensions(oldW, oldH);
 			
-			m_pImmediateContext->CopyResource(UNWRAP(WrappedID3D11Texture3D, d), UNWRAP(WrappedID3D11Texture3D, rtTex));
-			SAFE_RELEASE(rtTex);
+			m_pImmediateContext->CopySubresourceRegion(d, 0, 0, 0, 0, rtTex, subresource, NULL);
+			ReturnPooledTexture(rtTex);
 		}
 		else
 		{
-			m_pImmediateContext->CopyResource(UNWRAP(WrappedID3D11Texture3D, d), wrapTex->GetReal());
+			m_pImmediateContext->CopySubresourceRegion(d, 0, 0, 0, 0, wrapTex->GetReal(), subresource, NULL);
 		}
 	}
 
+	if(dummyTex == NULL)
+		return NULL;
+
 	MapIntercept intercept;
 	
 	D3D11_MAPPED_SUBRESOURCE mapped = {0};
-	HRESULT hr = m_pImmediateContext->Map(m_ResourceManager->UnwrapResource(dummyTex), subresource, D3D11_MAP_READ, 0, &mapped);
+	HRESULT hr = m_pImmediateContext->Map(dummyTex, stagingSubresource, D3D11_MAP_READ, 0, &mapped);
 
 	byte *ret = NULL;
 
@@ -2296,22 +2522,37 @@ byte *D3D11DebugManager::GetTextureData(ResourceId id, uint32_t arrayIdx, uint32
 	{
 		ret = new byte[bytesize];
 		dataSize = bytesize;
-		intercept.InitWrappedResource(dummyTex, subresource, ret);
+
+		D3D11_RESOURCE_DIMENSION dim = D3D11_RESOURCE_DIMENSION_UNKNOWN;
+		dummyTex->GetType(&dim);
+
+		if(dim == D3D11_RESOURCE_DIMENSION_TEXTURE1D)
+			intercept.Init((ID3D11Texture1D *)dummyTex, stagingSubresource, ret);
+		else if(dim == D3D11_RESOURCE_DIMENSION_TEXTURE2D)
+			intercept.Init((ID3D11Texture2D *)dummyTex, stagingSubresource, ret);
+		else if(dim == D3D11_RESOURCE_DIMENSION_TEXTURE3D)
+			intercept.Init((ID3D11Texture3D *)dummyTex, stagingSubresource, ret);
+
 		intercept.SetD3D(mapped);
 		intercept.CopyFromD3D();
+
+		// the staging texture goes back to the pool, so it can't be left mapped
+		m_pImmediateContext->Unmap(dummyTex, stagingSubresource);
 	}
 	else
 	{
 		RDCERR("Couldn't map staging texture to retrieve data. %08x", hr);
 	}
 
-	SAFE_RELEASE(dummyTex);
+	ReturnPooledTexture(dummyTex);
 
 	return ret;
 }
 
 ResourceId D3D11DebugManager::ApplyCustomShader(ResourceId shader, ResourceId texid, uint32_t mip)
 {
+	EnsureDebugRendering();
+
 	TextureShaderDetails details = GetShaderDetails(texid, false);
 
 	CreateCustomShaderTex(details.texWidth, details.texHeight);
@@ -2403,8 +2644,68 @@ void D3D11DebugManager::CreateCustomShaderTex(uint32_t w, uint32_t h)
 	}
 }
 
+void D3D11DebugManager::CacheOverlay(ResourceId texid, TextureDisplayOverlay overlay, uint32_t frameID, uint32_t eventID, const vector<uint32_t> &passEvents)
+{
+	D3D11_TEXTURE2D_DESC desc;
+	m_OverlayRenderTex->GetDesc(&desc);
+
+	CachedOverlay c;
+	c.texid = texid;
+	c.overlay = overlay;
+	c.frameID = frameID;
+	c.eventID = eventID;
+	c.passEvents = passEvents;
+	c.bytes = uint64_t(desc.Width)*uint64_t(desc.Height)*uint64_t(desc.SampleDesc.Count)*8;
+
+	if(c.bytes > OverlayCacheBudget)
+		return;
+
+	while(!m_OverlayCache.empty() && m_OverlayCacheBytes + c.bytes > OverlayCacheBudget)
+	{
+		m_OverlayCacheBytes -= m_OverlayCache.back().bytes;
+		SAFE_RELEASE(m_OverlayCache.back().tex);
+		m_OverlayCache.pop_back();
+	}
+
+	// created through the wrapped device so the copy has an ID that can be displayed
+	c.tex = NULL;
+	HRESULT hr = m_WrappedDevice->CreateTexture2D(&desc, NULL, &c.tex);
+	if(FAILED(hr))
+	{
+		RDCERR("Failed to create cached overlay tex %08x", hr);
+		return;
+	}
+
+	m_pImmediateContext->CopyResource(UNWRAP(WrappedID3D11Texture2D, c.tex), UNWRAP(WrappedID3D11Texture2D, m_OverlayRenderTex));
+
+	m_OverlayCacheBytes += c.bytes;
+	m_OverlayCache.push_front(c);
+}
+
+void D3D11DebugManager::ClearOverlayCache()
+{
+	for(auto it=m_OverlayCache.begin(); it != m_OverlayCache.end(); ++it)
+		SAFE_RELEASE(it->tex);
+
+	m_OverlayCache.clear();
+	m_OverlayCacheBytes = 0;
+}
+
 ResourceId D3D11DebugManager::RenderOverlay(ResourceId texid, TextureDisplayOverlay overlay, uint32_t frameID, uint32_t eventID, const vector<uint32_t> &passEvents)
 {
+	EnsureDebugRendering();
+
+	// flipping back to a recently rendered overlay doesn't need to render it again
+	for(auto it=m_OverlayCache.begin(); it != m_OverlayCache.end(); ++it)
+	{
+		if(it->texid == texid && it->overlay == overlay && it->frameID == frameID &&
+		   it->eventID == eventID && it->passEvents == passEvents)
+		{
+			m_OverlayCache.splice(m_OverlayCache.begin(), m_OverlayCache, it);
+			return ((WrappedID3D11Texture2D *)m_OverlayCache.front().tex)->GetResourceID();
+		}
+	}
+
 	TextureShaderDetails details = GetShaderDetails(texid, false);
 
 	ResourceId id = texid;
@@ -2891,6 +3192,23 @@ ResourceId D3D11DebugManager::RenderOverlay(ResourceId texid, TextureDisplayOver
 
 		events.push_back(eventID);
 
+		// if this is the same pass at the same or a later event as last time, the cached
+		// overdraw texture already has every draw up to the last event, so only the draws
+		// since then need to be added. A pass keeps the same targets, so the size still matches.
+		bool incremental = (overlay == eTexOverlay_QuadOverdrawPass && m_QuadOverdraw.lastEvent != 0 &&
+		                    m_QuadOverdraw.frameID == frameID && m_QuadOverdraw.firstEvent == events[0] &&
+		                    m_QuadOverdraw.lastEvent <= eventID);
+
+		uint32_t firstEvent = events[0];
+
+		if(incremental)
+		{
+			size_t skip = 0;
+			while(skip < events.size() && events[skip] <= m_QuadOverdraw.lastEvent)
+				skip++;
+			events.erase(events.begin(), events.begin()+skip);
+		}
+
 		if(!events.empty())
 		{
 			if(overlay == eTexOverlay_QuadOverdrawPass)
@@ -2976,26 +3294,39 @@ ResourceId D3D11DebugManager::RenderOverlay(ResourceId texid, TextureDisplayOver
 				SAFE_RELEASE(tex);
 			}
 			
-			D3D11_TEXTURE2D_DESC uavTexDesc = {
-				width, height, 1U, 4U,
-				DXGI_FORMAT_R32_UINT,
-				{ 1, 0 },
-				D3D11_USAGE_DEFAULT,
-				D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_SHADER_RESOURCE,
-				0,
-				0,
-			};
+			if(m_QuadOverdraw.tex == NULL || m_QuadOverdraw.width != width || m_QuadOverdraw.height != height)
+			{
+				SAFE_RELEASE(m_QuadOverdraw.tex);
+				SAFE_RELEASE(m_QuadOverdraw.srv);
+				SAFE_RELEASE(m_QuadOverdraw.uav);
 
-			ID3D11Texture2D *overdrawTex = NULL;
-			ID3D11ShaderResourceView *overdrawSRV = NULL;
-			ID3D11UnorderedAccessView *overdrawUAV = NULL;
+				D3D11_TEXTURE2D_DESC uavTexDesc = {
+					width, height, 1U, 4U,
+					DXGI_FORMAT_R32_UINT,
+					{ 1, 0 },
+					D3D11_USAGE_DEFAULT,
+					D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_SHADER_RESOURCE,
+					0,
+					0,
+				};
+
+				m_WrappedDevice->CreateTexture2D(&uavTexDesc, NULL, &m_QuadOverdraw.tex);
+				m_WrappedDevice->CreateShaderResourceView(m_QuadOverdraw.tex, NULL, &m_QuadOverdraw.srv);
+				m_WrappedDevice->CreateUnorderedAccessView(m_QuadOverdraw.tex, NULL, &m_QuadOverdraw.uav);
+
+				m_QuadOverdraw.width = width;
+				m_QuadOverdraw.height = height;
 
-			m_WrappedDevice->CreateTexture2D(&uavTexDesc, NULL, &overdrawTex);
-			m_WrappedDevice->CreateShaderResourceView(overdrawTex, NULL, &overdrawSRV);
-			m_WrappedDevice->CreateUnorderedAccessView(overdrawTex, NULL, &overdrawUAV);
+				incremental = false;
+			}
+
+			ID3D11UnorderedAccessView *overdrawUAV = m_QuadOverdraw.uav;
 			
-			UINT val = 0;
-			m_WrappedContext->ClearUnorderedAccessViewUint(overdrawUAV, &val);
+			if(!incremental)
+			{
+				UINT val = 0;
+				m_WrappedContext->ClearUnorderedAccessViewUint(overdrawUAV, &val);
+			}
 
 			for(size_t i=0; i < events.size(); i++)
 			{
@@ -3044,7 +3375,13 @@ ResourceId D3D11DebugManager::RenderOverlay(ResourceId texid, TextureDisplayOver
 			}
 
 			SAFE_RELEASE(depthOverride);
-			
+
+			if(overlay == eTexOverlay_QuadOverdrawPass)
+				m_WrappedDevice->ReplayLog(frameID, 0, eventID, eReplay_WithoutDraw);
+		}
+
+		if(m_QuadOverdraw.srv)
+		{
 			// resolve pass
 			{
 				m_pImmediateContext->VSSetShader(m_DebugRender.FullscreenVS, NULL, 0);
@@ -3068,18 +3405,27 @@ ResourceId D3D11DebugManager::RenderOverlay(ResourceId texid, TextureDisplayOver
 				float clearColour[] = { 0.0f, 0.0f, 0.0f, 0.0f };
 				m_pImmediateContext->ClearRenderTargetView(rtv, clearColour);
 
-				ID3D11ShaderResourceView *srv = ((WrappedID3D11ShaderResourceView *)overdrawSRV)->GetReal();
+				ID3D11ShaderResourceView *srv = ((WrappedID3D11ShaderResourceView *)m_QuadOverdraw.srv)->GetReal();
 				m_pImmediateContext->PSSetShaderResources(0, 1, &srv);
 
 				m_pImmediateContext->Draw(3, 0);
+
+				// the texture is kept, so don't leave it bound for the next time it's a UAV
+				srv = NULL;
+				m_pImmediateContext->PSSetShaderResources(0, 1, &srv);
 			}
-			
-			SAFE_RELEASE(overdrawTex);
-			SAFE_RELEASE(overdrawSRV);
-			SAFE_RELEASE(overdrawUAV);
-			
-			if(overlay == eTexOverlay_QuadOverdrawPass)
-				m_WrappedDevice->ReplayLog(frameID, 0, eventID, eReplay_WithoutDraw);
+		}
+
+		if(overlay == eTexOverlay_QuadOverdrawPass)
+		{
+			m_QuadOverdraw.frameID = frameID;
+			m_QuadOverdraw.firstEvent = firstEvent;
+			m_QuadOverdraw.lastEvent = eventID;
+		}
+		else
+		{
+			// the texture now only holds this draw
+			m_QuadOverdraw.lastEvent = 0;
 		}
 	}
 	else if(preDrawDepth)
@@ -3295,6 +3641,8 @@ ResourceId D3D11DebugManager::RenderOverlay(ResourceId texid, TextureDisplayOver
 
 	old.ApplyState(m_WrappedContext);
 
+	CacheOverlay(texid, overlay, frameID, eventID, passEvents);
+
 	return m_OverlayResourceId;
 }
 
@@ -3429,6 +3777,8 @@ void D3D11DebugManager::PixelHistoryCopyPixel(CopyPixelParams &p, uint32_t x, ui
 
 vector<PixelModification> D3D11DebugManager::PixelHistory(uint32_t frameID, vector<EventUsage> events, ResourceId target, uint32_t x, uint32_t y, uint32_t sampleIdx)
 {
+	EnsureDebugRendering();
+
 	vector<PixelModification> history;
 
 	// this function needs a *huge* amount of tidying, refactoring and documenting.
@@ -3748,6 +4098,7 @@ vector<PixelModification> D3D11DebugManager::PixelHistory(uint32_t frameID, vect
 		TestMustPass_Scissor        = 1<<7, // if the scissor is enabled, pixel lies inside all regions (could be only one)
 		TestMustFail_DepthTesting   = 1<<8, // if the comparison func is NEVER
 		TestMustFail_StencilTesting = 1<<9, // if the comparison func is NEVER for both faces, or one face is backface culled and the other is NEVER
+		TestMustFail_Viewport       = 1<<10, // if the pixel lies outside all viewports. The event can't touch it, so isn't queried at all
 	};
 
 #if 1
@@ -4074,6 +4425,8 @@ vector<PixelModification> D3D11DebugManager::PixelHistory(uint32_t frameID, vect
 		m_pImmediateContext->OMSetBlendState(m_DebugRender.NopBlendState, blendFactor, sampleMask);
 		m_pImmediateContext->OMSetDepthStencilState(m_DebugRender.NopDepthState, stencilRef);
 
+		bool inViewport = false;
+
 		for(UINT i=0; i < curNumViews; i++)
 		{
 			// calculate scissor, relative to this viewport, that encloses only (x,y) pixel
@@ -4092,6 +4445,24 @@ vector<PixelModification> D3D11DebugManager::PixelHistory(uint32_t frameID, vect
 				newScissors[i].top = LONG(y);
 				newScissors[i].right = newScissors[i].left+1;
 				newScissors[i].bottom = newScissors[i].top+1;
+
+				inViewport = true;
+			}
+		}
+
+		// a draw can't rasterise to a pixel outside all of its viewports, so don't bother
+		// replaying it under the occlusion query or counting its fragments. The query would
+		// always come back empty. Clears don't go by the viewport so are never culled.
+		bool culled = false;
+
+		if(!inViewport && !uavOutput)
+		{
+			const FetchDrawcall *draw = m_WrappedDevice->GetDrawcall(frameID, events[ev].eventID);
+
+			if(draw && (draw->flags & eDraw_Clear) == 0)
+			{
+				culled = true;
+				flags[ev] |= TestMustFail_Viewport;
 			}
 		}
 
@@ -4278,18 +4649,21 @@ vector<PixelModification> D3D11DebugManager::PixelHistory(uint32_t frameID, vect
 		
 		PixelHistoryCopyPixel(depthCopyParams, storex*pixstoreStride + 0, storey);
 
-		m_pImmediateContext->Begin(occl[ev]);
+		if(!culled)
+		{
+			m_pImmediateContext->Begin(occl[ev]);
 
-		// For UAV output we only want to replay once in pristine conditions (only fetching before/after values)
-		if(!uavOutput)
-			m_WrappedDevice->ReplayLog(frameID, 0, events[ev].eventID, eReplay_OnlyDraw);
+			// For UAV output we only want to replay once in pristine conditions (only fetching before/after values)
+			if(!uavOutput)
+				m_WrappedDevice->ReplayLog(frameID, 0, events[ev].eventID, eReplay_OnlyDraw);
 
-		m_pImmediateContext->End(occl[ev]);
+			m_pImmediateContext->End(occl[ev]);
+		}
 		
 		m_pImmediateContext->PSSetShader(curPS, curInst, curNumInst);
 
 		// determine how many fragments returned from the shader
-		if(!uavOutput)
+		if(!uavOutput && !culled)
 		{
 			D3D11_RASTERIZER_DESC rdsc = rsDesc;
 
@@ -4385,11 +4759,19 @@ vector<PixelModification> D3D11DebugManager::PixelHistory(uint32_t frameID, vect
 
 	for(size_t i=0; i < occl.size(); i++)
 	{
-		do
+		if(flags[i] & TestMustFail_Viewport)
 		{
-			hr = m_pImmediateContext->GetData(occl[i], &occlData, sizeof(occlData), 0);
-		} while(hr == S_FALSE);
-		RDCASSERT(hr == S_OK);
+			// never queried, see above
+			occlData = 0;
+		}
+		else
+		{
+			do
+			{
+				hr = m_pImmediateContext->GetData(occl[i], &occlData, sizeof(occlData), 0);
+			} while(hr == S_FALSE);
+			RDCASSERT(hr == S_OK);
+		}
 
 		const FetchDrawcall *draw = m_WrappedDevice->GetDrawcall(frameID, events[i].eventID);
 
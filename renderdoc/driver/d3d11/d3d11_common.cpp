@@ -876,6 +876,33 @@ ShaderConstant MakeConstantBufferVariable(DXBC::CBufferVariable var, uint32_t &o
 	return ret;
 }
 
+ShaderBytecodeKey GetShaderBytecodeKey(const void *bytecode, size_t length)
+{
+	ShaderBytecodeKey ret;
+	RDCEraseEl(ret);
+
+	ret.length = (uint32_t)length;
+
+	const uint32_t *words = (const uint32_t *)bytecode;
+
+	// hash is 4 uints, starting after the FOURCC of 'DXBC'
+	if(length >= sizeof(uint32_t)*5 && words[0] == MAKE_FOURCC('D', 'X', 'B', 'C'))
+	{
+		memcpy(ret.hash, &words[1], sizeof(ret.hash));
+		return ret;
+	}
+
+	// FNV-1a, in case anything ever passes bytecode without a valid header
+	uint64_t fnv = 0xcbf29ce484222325ULL;
+	const byte *bytes = (const byte *)bytecode;
+	for(size_t i=0; i < length; i++)
+		fnv = (fnv ^ bytes[i]) * 0x100000001b3ULL;
+
+	memcpy(ret.hash, &fnv, sizeof(fnv));
+
+	return ret;
+}
+
 ShaderReflection *MakeShaderReflection(DXBC::DXBCFile *dxbc)
 {
 	if(dxbc == NULL || !RenderDoc::Inst().IsReplayApp())
@@ -896,7 +923,7 @@ ShaderReflection *MakeShaderReflection(DXBC::DXBCFile *dxbc)
 		}
 	}
 
-	ret->Disassembly = dxbc->m_Disassembly;
+	ret->Disassembly = dxbc->GetDisassembly();
 
 	ret->InputSig = dxbc->m_InputSig;
 	ret->OutputSig = dxbc->m_OutputSig;
@@ -48,6 +48,23 @@ D3D11_PRIMITIVE_TOPOLOGY MakeD3D11PrimitiveTopology(PrimitiveTopology Topo);
 
 ShaderReflection *MakeShaderReflection(DXBC::DXBCFile *dxbc);
 
+// identifies a shader bytecode blob by its contents. For DXBC this is the checksum
+// in the header, otherwise a hash of the whole blob.
+struct ShaderBytecodeKey
+{
+	uint32_t hash[4];
+	uint32_t length;
+
+	bool operator <(const ShaderBytecodeKey &o) const
+	{
+		if(length != o.length)
+			return length < o.length;
+		return memcmp(hash, o.hash, sizeof(hash)) < 0;
+	}
+};
+
+ShaderBytecodeKey GetShaderBytecodeKey(const void *bytecode, size_t length);
+
 template<class T>
 inline void SetDebugName( T* pObj, const char* name )
 {
@@ -304,6 +321,8 @@ enum D3D11ChunkType
 	CONTEXT_CAPTURE_HEADER, // chunk at beginning of context's chunk stream
 	CONTEXT_CAPTURE_FOOTER, // chunk at end of context's chunk stream
 
+	SHADER_BYTECODE,
+
 	NUM_D3D11_CHUNKS,
 };
 
@@ -145,13 +145,21 @@ WrappedID3D11DeviceContext::WrappedID3D11DeviceContext(WrappedID3D11Device* real
 	m_SuccessfulCapture = true;
 	m_FailureReason = CaptureSucceeded;
 	m_EmptyCommandList = true;
+	RDCEraseEl(m_FrameStats);
+	m_FilterRedundantSets = false;
+	m_UsedUAVCounters = false;
+	m_FirstCmdListEvent = ~0U;
+	m_ReplayEndEventID = ~0U;
 
 	m_DrawcallStack.push_back(&m_ParentDrawcall);
 
 	m_CurEventID = 1;
 	m_CurDrawcallID = 1;
 
+	m_DrawcallCallback = NULL;
+
 	m_MarkerIndentLevel = 0;
+	m_RegionCaptureLevel = -1;
 #if defined(INCLUDE_D3D_11_1)
 	m_UserAnnotation.SetContext(this);
 #endif
@@ -188,6 +196,8 @@ WrappedID3D11DeviceContext::~WrappedID3D11DeviceContext()
 		SAFE_RELEASE(it->second.query);
 	}
 
+	ReleaseCachedCmdLists();
+
 	if(m_State >= WRITING)
 	{
 		SAFE_DELETE(m_pSerialiser);
@@ -387,6 +397,13 @@ void WrappedID3D11DeviceContext::AttemptCapture()
 {
 	m_State = WRITING_CAPFRAME;
 
+	m_pSerialiser->SetChunkArena(true);
+
+	// deferred contexts can't be filtered, as their command lists start from the default
+	// state when executed rather than the state we're tracking
+	m_FilterRedundantSets = GetType() == D3D11_DEVICE_CONTEXT_IMMEDIATE &&
+	                        RenderDoc::Inst().GetCaptureOptions().FilterRedundantState;
+
 	m_FailureReason = CaptureSucceeded;
 
 	// deferred contexts are initially NOT successful unless empty. That's because we don't have the serialised
@@ -437,6 +454,10 @@ void WrappedID3D11DeviceContext::FinishCapture()
 	{
 		m_State = WRITING_IDLE;
 
+		m_pSerialiser->SetChunkArena(false);
+
+		m_FilterRedundantSets = false;
+
 		m_SuccessfulCapture = false;
 		m_FailureReason = CaptureSucceeded;
 	}
@@ -458,18 +479,9 @@ void WrappedID3D11DeviceContext::EndCaptureFrame()
 	m_pSerialiser->Serialise("HasCallstack", HasCallstack);	
 
 	if(HasCallstack)
-	{
-		Callstack::Stackwalk *call = Callstack::Collect();
-
-		RDCASSERT(call->NumLevels() < 0xff);
-
-		size_t numLevels = call->NumLevels();
-		uint64_t *stack = (uint64_t *)call->GetAddrs();
+		m_pSerialiser->SerialiseCallstack();
 
-		m_pSerialiser->Serialise("callstack", stack, numLevels);
-
-		delete call;
-	}
+	Serialise_FrameDebugMessages();
 
 	m_ContextRecord->AddChunk(scope.Get());
 }
@@ -610,6 +622,21 @@ void WrappedID3D11DeviceContext::ProcessChunk(uint64_t offset, D3D11ChunkType ch
 	}
 	
 	RDCASSERT(WrappedID3D11DeviceContext::IsAlloc(context));
+
+	if(context != this && !forceExecute)
+	{
+		if(m_State == READING)
+		{
+			m_PendingCmdListChunks[context].push_back(m_CurEventID);
+		}
+		else if(m_State == EXECUTING && SkipCachedCmdListChunk(m_CurEventID))
+		{
+			m_pSerialiser->SetOffset(cOffs);
+			m_pSerialiser->SkipCurrentChunk();
+			m_pSerialiser->PopContext(NULL, chunk);
+			return;
+		}
+	}
 	
 	LogState state = context->m_State;
 
@@ -620,6 +647,21 @@ void WrappedID3D11DeviceContext::ProcessChunk(uint64_t offset, D3D11ChunkType ch
 
 	m_AddedDrawcall = false;
 
+	if(context == this && m_State == EXECUTING && !forceExecute)
+	{
+		uint64_t argOffs = m_pSerialiser->GetOffset();
+
+		if(ExecuteDecodedChunk(offset, chunk))
+		{
+			m_pSerialiser->SetOffset(cOffs);
+			m_pSerialiser->SkipCurrentChunk();
+			m_pSerialiser->PopContext(NULL, chunk);
+			return;
+		}
+
+		m_pSerialiser->SetOffset(argOffs);
+	}
+
 	switch(chunk)
 	{
 	case SET_INPUT_LAYOUT:
@@ -896,16 +938,10 @@ void WrappedID3D11DeviceContext::ProcessChunk(uint64_t offset, D3D11ChunkType ch
 			m_pSerialiser->Serialise("HasCallstack", HasCallstack);	
 
 			if(HasCallstack)
-			{
-				size_t numLevels = 0;
-				uint64_t *stack = NULL;
-
-				m_pSerialiser->Serialise("callstack", stack, numLevels);
+				m_pSerialiser->SerialiseCallstack();
 
-				m_pSerialiser->SetCallstack(stack, numLevels);
-
-				SAFE_DELETE_ARRAY(stack);
-			}
+			if(m_pDevice->GetLogVersion() >= 0x00000C)
+				Serialise_FrameDebugMessages();
 
 			if(m_State == READING)
 			{
@@ -953,6 +989,272 @@ void WrappedID3D11DeviceContext::ProcessChunk(uint64_t offset, D3D11ChunkType ch
 		context->m_State = state;
 }
 
+void WrappedID3D11DeviceContext::ClearDecodedChunks()
+{
+	m_DecodedChunks.clear();
+	m_DecodedObjects.clear();
+	m_DecodedChunkIdx.clear();
+
+	// the lists would reference the old objects
+	ReleaseCachedCmdLists();
+}
+
+void WrappedID3D11DeviceContext::ReleaseCachedCmdLists()
+{
+	for(auto it = m_CachedCmdLists.begin(); it != m_CachedCmdLists.end(); ++it)
+		SAFE_RELEASE(it->second);
+	m_CachedCmdLists.clear();
+}
+
+void WrappedID3D11DeviceContext::RestoreCachedCmdLists()
+{
+	// the resource manager takes a reference of its own, so the list survives this replay's
+	// in-frame resources being released.
+	for(auto it = m_CachedCmdLists.begin(); it != m_CachedCmdLists.end(); ++it)
+	{
+		it->second->AddRef();
+		m_pDevice->GetResourceManager()->AddLiveResource(it->first, it->second);
+	}
+}
+
+bool WrappedID3D11DeviceContext::SkipCachedCmdListChunk(uint32_t eventID)
+{
+	auto it = m_CmdListChunks.find(eventID);
+	if(it == m_CmdListChunks.end())
+		return false;
+
+	ResourceId cmdList = it->second;
+
+	// stopping part-way through the recording needs the deferred context's state up to there,
+	// and a callback may be watching the recorded events, so record it again.
+	auto cached = m_CachedCmdLists.find(cmdList);
+	if(cached != m_CachedCmdLists.end())
+	{
+		if(m_DrawcallCallback == NULL && m_CmdListFinish[cmdList] <= m_ReplayEndEventID)
+			return true;
+
+		SAFE_RELEASE(cached->second);
+		m_CachedCmdLists.erase(cached);
+	}
+
+	return false;
+}
+
+void WrappedID3D11DeviceContext::FinishedCmdList(WrappedID3D11DeviceContext *context, ResourceId cmdList, ID3D11CommandList *list, bool restoreState)
+{
+	if(m_State == READING)
+	{
+		vector<uint32_t> &events = m_PendingCmdListChunks[context];
+		for(size_t i=0; i < events.size(); i++)
+			m_CmdListChunks[events[i]] = cmdList;
+		m_CmdListFinish[cmdList] = m_CurEventID;
+		events.clear();
+	}
+
+	// a list that keeps the deferred context's state leaves it for the next recording to
+	// start from, so that must be recorded each time. Lists from the initial read aren't kept,
+	// only ones a replay has actually executed up to.
+	if(m_State == EXECUTING && !restoreState)
+	{
+		ID3D11CommandList *&cached = m_CachedCmdLists[cmdList];
+		list->AddRef();
+		SAFE_RELEASE(cached);
+		cached = list;
+	}
+}
+
+bool WrappedID3D11DeviceContext::DecodeChunk(uint64_t offset, D3D11ChunkType chunk, DecodedChunk &decoded)
+{
+	enum { eObj_None, eObj_Layout, eObj_Buffer, eObj_SRV, eObj_Sampler } objType = eObj_None;
+
+	switch(chunk)
+	{
+		case SET_TOPOLOGY:
+			break;
+		case SET_INPUT_LAYOUT:
+			objType = eObj_Layout;
+			break;
+		case SET_VS_CBUFFERS: case SET_HS_CBUFFERS: case SET_DS_CBUFFERS:
+		case SET_GS_CBUFFERS: case SET_PS_CBUFFERS: case SET_CS_CBUFFERS:
+			objType = eObj_Buffer;
+			break;
+		case SET_VS_RESOURCES: case SET_HS_RESOURCES: case SET_DS_RESOURCES:
+		case SET_GS_RESOURCES: case SET_PS_RESOURCES: case SET_CS_RESOURCES:
+			objType = eObj_SRV;
+			break;
+		case SET_VS_SAMPLERS: case SET_HS_SAMPLERS: case SET_DS_SAMPLERS:
+		case SET_GS_SAMPLERS: case SET_PS_SAMPLERS: case SET_CS_SAMPLERS:
+			objType = eObj_Sampler;
+			break;
+		default:
+			return false;
+	}
+
+	decoded.offset = offset;
+	decoded.chunk = chunk;
+	decoded.start = 0;
+	decoded.num = 0;
+	decoded.objects = m_DecodedObjects.size();
+
+	vector<ResourceId> ids;
+
+	if(chunk == SET_TOPOLOGY)
+	{
+		SERIALISE_ELEMENT(D3D11_PRIMITIVE_TOPOLOGY, Topology, D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED);
+		decoded.start = (UINT)Topology;
+	}
+	else if(chunk == SET_INPUT_LAYOUT)
+	{
+		SERIALISE_ELEMENT(ResourceId, InputLayout, ResourceId());
+		ids.push_back(InputLayout);
+	}
+	else
+	{
+		SERIALISE_ELEMENT(uint32_t, StartSlot, 0);
+		SERIALISE_ELEMENT(uint32_t, Num, 0);
+
+		decoded.start = StartSlot;
+
+		for(uint32_t i=0; i < Num; i++)
+		{
+			SERIALISE_ELEMENT(ResourceId, id, ResourceId());
+			ids.push_back(id);
+		}
+	}
+
+	D3D11ResourceManager *rm = m_pDevice->GetResourceManager();
+
+	for(size_t i=0; i < ids.size(); i++)
+	{
+		// objects created in the frame are recreated on each replay, so can't be held on to
+		if(rm->IsInFrameResource(ids[i]))
+		{
+			m_DecodedObjects.resize(decoded.objects);
+			return false;
+		}
+
+		ID3D11DeviceChild *live = rm->HasLiveResource(ids[i]) ? rm->GetLiveResource(ids[i]) : NULL;
+
+		void *obj = NULL;
+		if(objType == eObj_Layout)       obj = (ID3D11InputLayout *)live;
+		else if(objType == eObj_Buffer)  obj = (ID3D11Buffer *)live;
+		else if(objType == eObj_SRV)     obj = (ID3D11ShaderResourceView *)live;
+		else if(objType == eObj_Sampler) obj = (ID3D11SamplerState *)live;
+
+		m_DecodedObjects.push_back(obj);
+	}
+
+	decoded.num = (UINT)ids.size();
+
+	return true;
+}
+
+bool WrappedID3D11DeviceContext::ExecuteDecodedChunk(uint64_t offset, D3D11ChunkType chunk)
+{
+	if(m_CurEventID >= m_DecodedChunkIdx.size())
+		m_DecodedChunkIdx.resize(m_CurEventID+1, 0);
+
+	uint32_t &idx = m_DecodedChunkIdx[m_CurEventID];
+
+	if(idx == 0)
+	{
+		DecodedChunk decoded;
+
+		if(DecodeChunk(offset, chunk, decoded))
+		{
+			m_DecodedChunks.push_back(decoded);
+			idx = (uint32_t)m_DecodedChunks.size();
+		}
+		else
+		{
+			idx = ~0U;
+		}
+	}
+
+	if(idx == ~0U)
+		return false;
+
+	const DecodedChunk &d = m_DecodedChunks[idx-1];
+
+	if(d.offset != offset || d.chunk != chunk)
+	{
+		RDCERR("Decoded chunk doesn't match chunk at event %u", m_CurEventID);
+		return false;
+	}
+
+	// the wrapped functions do the same as replaying the chunk once the objects are
+	// looked up, as nothing is being recorded.
+	void **objs = d.num > 0 ? &m_DecodedObjects[d.objects] : NULL;
+
+	switch(d.chunk)
+	{
+		case SET_INPUT_LAYOUT: IASetInputLayout((ID3D11InputLayout *)objs[0]); break;
+		case SET_TOPOLOGY: IASetPrimitiveTopology((D3D11_PRIMITIVE_TOPOLOGY)d.start); break;
+
+		case SET_VS_CBUFFERS: VSSetConstantBuffers(d.start, d.num, (ID3D11Buffer **)objs); break;
+		case SET_VS_RESOURCES: VSSetShaderResources(d.start, d.num, (ID3D11ShaderResourceView **)objs); break;
+		case SET_VS_SAMPLERS: VSSetSamplers(d.start, d.num, (ID3D11SamplerState **)objs); break;
+
+		case SET_HS_CBUFFERS: HSSetConstantBuffers(d.start, d.num, (ID3D11Buffer **)objs); break;
+		case SET_HS_RESOURCES: HSSetShaderResources(d.start, d.num, (ID3D11ShaderResourceView **)objs); break;
+		case SET_HS_SAMPLERS: HSSetSamplers(d.start, d.num, (ID3D11SamplerState **)objs); break;
+
+		case SET_DS_CBUFFERS: DSSetConstantBuffers(d.start, d.num, (ID3D11Buffer **)objs); break;
+		case SET_DS_RESOURCES: DSSetShaderResources(d.start, d.num, (ID3D11ShaderResourceView **)objs); break;
+		case SET_DS_SAMPLERS: DSSetSamplers(d.start, d.num, (ID3D11SamplerState **)objs); break;
+
+		case SET_GS_CBUFFERS: GSSetConstantBuffers(d.start, d.num, (ID3D11Buffer **)objs); break;
+		case SET_GS_RESOURCES: GSSetShaderResources(d.start, d.num, (ID3D11ShaderResourceView **)objs); break;
+		case SET_GS_SAMPLERS: GSSetSamplers(d.start, d.num, (ID3D11SamplerState **)objs); break;
+
+		case SET_PS_CBUFFERS: PSSetConstantBuffers(d.start, d.num, (ID3D11Buffer **)objs); break;
+		case SET_PS_RESOURCES: PSSetShaderResources(d.start, d.num, (ID3D11ShaderResourceView **)objs); break;
+		case SET_PS_SAMPLERS: PSSetSamplers(d.start, d.num, (ID3D11SamplerState **)objs); break;
+
+		case SET_CS_CBUFFERS: CSSetConstantBuffers(d.start, d.num, (ID3D11Buffer **)objs); break;
+		case SET_CS_RESOURCES: CSSetShaderResources(d.start, d.num, (ID3D11ShaderResourceView **)objs); break;
+		case SET_CS_SAMPLERS: CSSetSamplers(d.start, d.num, (ID3D11SamplerState **)objs); break;
+
+		default:
+			return false;
+	}
+
+	return true;
+}
+
+static bool HasHiddenCounter(ID3D11UnorderedAccessView *uav)
+{
+	D3D11_UNORDERED_ACCESS_VIEW_DESC desc;
+	uav->GetDesc(&desc);
+
+	return desc.ViewDimension == D3D11_UAV_DIMENSION_BUFFER &&
+	       (desc.Buffer.Flags & (D3D11_BUFFER_UAV_FLAG_COUNTER|D3D11_BUFFER_UAV_FLAG_APPEND)) != 0;
+}
+
+void WrappedID3D11DeviceContext::GetWrittenResources(set<ResourceId> &ids)
+{
+	ids.insert(m_UpdatedResources.begin(), m_UpdatedResources.end());
+
+	for(auto it = m_ResourceUses.begin(); it != m_ResourceUses.end(); ++it)
+	{
+		for(size_t i=0; i < it->second.size(); i++)
+		{
+			ResourceUsage u = it->second[i].usage;
+
+			if(u == eUsage_SO ||
+				(u >= eUsage_VS_RWResource && u <= eUsage_CS_RWResource) ||
+				u == eUsage_ColourTarget || u == eUsage_DepthStencilTarget ||
+				u == eUsage_Clear || u == eUsage_GenMips ||
+				u == eUsage_Resolve || u == eUsage_ResolveDst ||
+				u == eUsage_Copy || u == eUsage_CopyDst)
+			{
+				ids.insert(it->first);
+				break;
+			}
+		}
+	}
+}
+
 void WrappedID3D11DeviceContext::AddUsage(FetchDrawcall d)
 {
 	const D3D11RenderState *pipe = m_CurrentPipelineState;
@@ -961,6 +1263,9 @@ void WrappedID3D11DeviceContext::AddUsage(FetchDrawcall d)
 	if((d.flags & (eDraw_Drawcall|eDraw_Dispatch|eDraw_CmdList)) == 0)
 		return;
 
+	if(d.flags & eDraw_CmdList)
+		m_FirstCmdListEvent = RDCMIN(m_FirstCmdListEvent, e);
+
 	//////////////////////////////
 	// IA
 
@@ -978,6 +1283,13 @@ void WrappedID3D11DeviceContext::AddUsage(FetchDrawcall d)
 	for(int s=0; s < 6; s++)
 	{
 		const D3D11RenderState::shader &sh = shArr[s];
+
+		if(sh.Shader)
+		{
+			ResourceId shid = GetIDForResource(sh.Shader);
+			if(m_ShaderFirstUse.find(shid) == m_ShaderFirstUse.end())
+				m_ShaderFirstUse[shid] = e;
+		}
 		
 		for(int i=0; i < D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT; i++)
 			if(sh.Used_CB(i))
@@ -991,7 +1303,10 @@ void WrappedID3D11DeviceContext::AddUsage(FetchDrawcall d)
 		{
 			for(int i=0; i < D3D11_PS_CS_UAV_REGISTER_COUNT; i++)
 				if(pipe->CS.Used_UAV(i) && pipe->CS.UAVs[i])
+				{
 					m_ResourceUses[((WrappedID3D11UnorderedAccessView *)pipe->CS.UAVs[i])->GetResourceResID()].push_back(EventUsage(e, eUsage_CS_RWResource));
+					m_UsedUAVCounters |= HasHiddenCounter(pipe->CS.UAVs[i]);
+				}
 		}
 	}
 	
@@ -1007,7 +1322,10 @@ void WrappedID3D11DeviceContext::AddUsage(FetchDrawcall d)
 
 	for(int i=0; i < D3D11_PS_CS_UAV_REGISTER_COUNT; i++)
 		if(pipe->PS.Used_UAV(i) && pipe->OM.UAVs[i])
+		{
 			m_ResourceUses[((WrappedID3D11UnorderedAccessView *)pipe->OM.UAVs[i])->GetResourceResID()].push_back(EventUsage(e, eUsage_PS_RWResource));
+			m_UsedUAVCounters |= HasHiddenCounter(pipe->OM.UAVs[i]);
+		}
 	
 	if(pipe->OM.DepthView) // assuming for now that any DSV bound is used.
 		m_ResourceUses[((WrappedID3D11DepthStencilView *)pipe->OM.DepthView)->GetResourceResID()].push_back(EventUsage(e, eUsage_DepthStencilTarget));
@@ -1162,6 +1480,17 @@ FetchAPIEvent WrappedID3D11DeviceContext::GetEvent(uint32_t eventID)
 	return m_Events[0];
 }
 
+uint32_t WrappedID3D11DeviceContext::GetNextEventID(uint32_t eventID)
+{
+	for(size_t i=0; i < m_Events.size(); i++)
+	{
+		if(m_Events[i].eventID > eventID)
+			return m_Events[i].eventID;
+	}
+
+	return eventID+1;
+}
+
 void WrappedID3D11DeviceContext::ReplayFakeContext(ResourceId id)
 {
 	m_FakeContext = id;
@@ -1191,6 +1520,8 @@ void WrappedID3D11DeviceContext::ReplayLog(LogState readType, uint32_t startEven
 	
 	if(m_State == EXECUTING)
 	{
+		m_ReplayEndEventID = endEventID;
+
 		FetchAPIEvent ev = GetEvent(startEventID);
 		m_CurEventID = ev.eventID;
 		m_pSerialiser->SetOffset(ev.fileOffset);
@@ -1212,6 +1543,9 @@ void WrappedID3D11DeviceContext::ReplayLog(LogState readType, uint32_t startEven
 
 	m_pDevice->GetResourceManager()->MarkInFrame(true);
 
+	if(m_State == EXECUTING)
+		RestoreCachedCmdLists();
+
 	while(1)
 	{
 		if(m_State == EXECUTING && m_CurEventID > endEventID)
@@ -1224,14 +1558,23 @@ void WrappedID3D11DeviceContext::ReplayLog(LogState readType, uint32_t startEven
 
 		D3D11ChunkType chunktype = (D3D11ChunkType)m_pSerialiser->PushContext(NULL, 1, false);
 
+		bool callback = m_State == EXECUTING && m_DrawcallCallback && m_DrawcallCallback->PreDraw(m_CurEventID);
+
 		ProcessChunk(offset, chunktype, false);
+
+		if(callback)
+			m_DrawcallCallback->PostDraw(m_CurEventID);
 		
 		RenderDoc::Inst().SetProgress(FileInitialRead, float(offset)/float(m_pSerialiser->GetSize()));
 		
-		// for now just abort after capture scope. Really we'd need to support multiple frames
-		// but for now this will do.
-		if(chunktype == CONTEXT_CAPTURE_FOOTER)
+		// a capture of several frames has a footer after each one, with the frames following
+		// on in the same stream. Only the last footer ends the context's chunks.
+		if(m_pSerialiser->AtEnd())
+		{
+			if(chunktype != CONTEXT_CAPTURE_FOOTER)
+				RDCERR("Chunk stream ended without a frame footer, at event %u", m_CurEventID);
 			break;
+		}
 		
 		m_CurEventID++;
 	}
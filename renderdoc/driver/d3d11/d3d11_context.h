@@ -27,6 +27,7 @@
 
 #include "core/core.h"
 #include "api/replay/renderdoc_replay.h"
+#include "replay/type_helpers.h"
 
 #include "d3d11_common.h"
 
@@ -123,11 +124,34 @@ struct DrawcallTreeNode
 		for(size_t i=0; i < children.size(); i++)
 		{
 			ret[i] = children[i].draw;
-			ret[i].children = children[i].Bake();
+			children[i].BakeChildren(ret[i].children);
 		}
 
 		return ret;
 	}
+
+	// bakes straight into the final array, so each drawcall is only copied once no matter
+	// how deeply it's nested (rather than once per level going via a vector)
+	void BakeChildren(rdctype::array<FetchDrawcall> &ret)
+	{
+		create_array_uninit(ret, children.size());
+		for(int32_t i=0; i < ret.count; i++)
+		{
+			new (ret.elems+i) FetchDrawcall(children[i].draw);
+			children[i].BakeChildren(ret[i].children);
+		}
+	}
+};
+
+// called around events while replaying, so that a whole frame can be instrumented in
+// one replay instead of replaying up to each drawcall in turn.
+struct D3D11DrawcallCallback
+{
+	virtual ~D3D11DrawcallCallback() {}
+
+	// called before the event executes. Return true to have PostDraw called after it
+	virtual bool PreDraw(uint32_t eventID) = 0;
+	virtual void PostDraw(uint32_t eventID) = 0;
 };
 
 #if defined(INCLUDE_D3D_11_1)
@@ -173,6 +197,36 @@ private:
 
 	map<ResourceId, vector<EventUsage> > m_ResourceUses;
 
+	// the first drawcall or dispatch each shader (by live ID) is used in on this context.
+	// lets a replaced shader only invalidate replay state from that point on
+	map<ResourceId, uint32_t> m_ShaderFirstUse;
+	// command lists run shaders that aren't in this context's pipeline state
+	uint32_t m_FirstCmdListEvent;
+
+	// resources (live IDs) written by Unmap or UpdateSubresource, which aren't usages
+	// themselves, and whether any append/counter UAVs were used. Only filled while reading.
+	set<ResourceId> m_UpdatedResources;
+	bool m_UsedUAVCounters;
+
+	// on replay, the binding chunks that make up most of a frame are decoded the first time
+	// they're executed, with their live objects already looked up. Later replays re-issue
+	// them from here and skip over the chunk, instead of deserialising it again.
+	struct DecodedChunk
+	{
+		uint64_t offset; // the chunk this was decoded from
+		D3D11ChunkType chunk;
+		UINT start, num;
+		size_t objects; // index of the first of 'num' objects in m_DecodedObjects
+	};
+	vector<DecodedChunk> m_DecodedChunks;
+	vector<void *> m_DecodedObjects; // already cast to the type the chunk's function takes
+	// indexed by event ID. 0 is not yet decoded, ~0U can't be decoded, otherwise the
+	// index+1 in m_DecodedChunks.
+	vector<uint32_t> m_DecodedChunkIdx;
+
+	bool ExecuteDecodedChunk(uint64_t offset, D3D11ChunkType chunk);
+	bool DecodeChunk(uint64_t offset, D3D11ChunkType chunk, DecodedChunk &decoded);
+
 	WrappedID3D11Device* m_pDevice;
 	ID3D11DeviceContext* m_pRealContext;
 #if defined(INCLUDE_D3D_11_1)
@@ -197,6 +251,14 @@ private:
 	bool m_SuccessfulCapture;
 	bool m_EmptyCommandList;
 
+	// draws, dispatches and maps counted for the frame statistics. The device takes them at
+	// each present
+	FrameStatistics m_FrameStats;
+
+	// with CaptureOptions::FilterRedundantState, while the immediate context is capturing
+	// a frame it doesn't serialise sets that wouldn't change its current pipeline state.
+	bool m_FilterRedundantSets;
+
 	ResourceId m_FakeContext;
 
 	bool m_DoStateVerify;
@@ -209,6 +271,8 @@ private:
 	WrappedID3DUserDefinedAnnotation m_UserAnnotation;
 #endif
 	int32_t m_MarkerIndentLevel;
+	// while capturing a marker region, the indent level its pop returns to. -1 otherwise
+	int32_t m_RegionCaptureLevel;
 
 	struct Annotation
 	{
@@ -222,14 +286,39 @@ private:
 	uint64_t m_CurChunkOffset;
 	uint32_t m_CurEventID, m_CurDrawcallID;
 
+	D3D11DrawcallCallback *m_DrawcallCallback;
+
 	DrawcallTreeNode m_ParentDrawcall;
 	map<ResourceId,DrawcallTreeNode> m_CmdLists;
 
+	// on replay, the command list (original ID) each deferred context chunk is recorded into,
+	// by event ID, and the event that finishes each list. Filled out while reading. Lists in
+	// m_CachedCmdLists were finished by a previous replay from a full recording, so a replay
+	// that covers the whole recording skips it and executes the existing list. The lists are
+	// created in-frame, so they're released along with the other in-frame resources at the
+	// start of each full replay - m_CachedCmdLists holds its own reference to each, and
+	// RestoreCachedCmdLists() makes them live again.
+	map<uint32_t, ResourceId> m_CmdListChunks;
+	map<ResourceId, uint32_t> m_CmdListFinish;
+	map<WrappedID3D11DeviceContext *, vector<uint32_t> > m_PendingCmdListChunks;
+	map<ResourceId, ID3D11CommandList *> m_CachedCmdLists;
+	uint32_t m_ReplayEndEventID;
+
+	bool SkipCachedCmdListChunk(uint32_t eventID);
+	void FinishedCmdList(WrappedID3D11DeviceContext *context, ResourceId cmdList, ID3D11CommandList *list, bool restoreState);
+	void RestoreCachedCmdLists();
+	void ReleaseCachedCmdLists();
+
 	list<DrawcallTreeNode *> m_DrawcallStack;
 
 	const char *GetChunkName(D3D11ChunkType idx);
 	
 	void Serialise_DebugMessages();
+	void Serialise_FrameDebugMessages();
+
+	// while reading, the events that raised debug messages and how many, in order. The
+	// messages themselves are only serialised at the end of the frame
+	vector< pair<uint32_t, uint32_t> > m_PendingDebugMessages;
 
 	void DrainAnnotationQueue();
 
@@ -258,6 +347,8 @@ public:
 	void BeginFrame();
 	void EndFrame();
 
+	FrameStatistics &GetFrameStatistics() { return m_FrameStats; }
+
 	bool Serialise_BeginCaptureFrame(bool applyInitialState);
 	void BeginCaptureFrame();
 	void EndCaptureFrame();
@@ -278,15 +369,45 @@ public:
 	void ProcessChunk(uint64_t offset, D3D11ChunkType chunk, bool forceExecute);
 	void ReplayFakeContext(ResourceId id);
 	void ReplayLog(LogState readType, uint32_t startEventID, uint32_t endEventID, bool partial);
+
+	// set while replaying to be called around each executed event, or NULL to clear it
+	void SetDrawcallCallback(D3D11DrawcallCallback *cb) { m_DrawcallCallback = cb; }
 	
 	void MarkResourceReferenced(ResourceId id, FrameRefType refType);
 
-	vector<EventUsage> GetUsage(ResourceId id) { return m_ResourceUses[id]; }
+	vector<EventUsage> GetUsage(ResourceId id)
+	{
+		auto it = m_ResourceUses.find(id);
+		if(it == m_ResourceUses.end())
+			return vector<EventUsage>();
+		return it->second;
+	}
+
+	// returns the first event that executes the given shader, or ~0U if it's not known to be
+	// used by any event on this context
+	uint32_t GetShaderFirstUse(ResourceId id)
+	{
+		auto it = m_ShaderFirstUse.find(id);
+		if(it == m_ShaderFirstUse.end())
+			return ~0U;
+		return RDCMIN(it->second, m_FirstCmdListEvent);
+	}
+
+	// fills out the live IDs of every resource that's written to in the log, to know what
+	// must be snapshotted to restore the log's state at an event.
+	void GetWrittenResources(set<ResourceId> &ids);
+	bool UsedUAVCounters() { return m_UsedUAVCounters; }
+
+	// must be called if a replay would look up different live objects, e.g. when a resource
+	// is replaced. Also drops the command lists kept from previous replays.
+	void ClearDecodedChunks();
 
 	void ClearMaps();
 
 	uint32_t GetEventID() { return m_CurEventID; }
 	FetchAPIEvent GetEvent(uint32_t eventID);
+	// returns the first event after eventID, to continue a replay from
+	uint32_t GetNextEventID(uint32_t eventID);
 
 	const DrawcallTreeNode &GetRootDraw() { return m_ParentDrawcall; }
 	
@@ -50,6 +50,9 @@ bool WrappedID3D11DeviceContext::Serialise_UpdateSubresource1(ID3D11Resource *pD
 	{
 		if(m_pDevice->GetResourceManager()->HasLiveResource(idx))
 			DestResource = (ID3D11Resource *)m_pDevice->GetResourceManager()->GetLiveResource(idx);
+
+		if(m_State == READING && m_pDevice->GetResourceManager()->HasLiveResource(idx))
+			m_UpdatedResources.insert(m_pDevice->GetResourceManager()->GetLiveID(idx));
 	}
 
 	if(isUpdate)
@@ -130,7 +133,7 @@ bool WrappedID3D11DeviceContext::Serialise_UpdateSubresource1(ID3D11Resource *pD
 
 		SERIALISE_ELEMENT(uint32_t, SourceDataLength, (uint32_t)srcLength);
 
-		SERIALISE_ELEMENT_BUF(byte *, SourceData, (byte *)pSrcData, SourceDataLength);
+		SERIALISE_ELEMENT_BUF_EXTERNAL(byte *, SourceData, (byte *)pSrcData, SourceDataLength);
 
 		if(m_State < WRITING && DestResource != NULL)
 		{
@@ -102,6 +102,9 @@ bool WrappedID3D11DeviceContext::Serialise_PopEvent()
 
 void WrappedID3D11DeviceContext::SetMarker(uint32_t col, const wchar_t *name)
 {
+	if(RenderDoc::Inst().ProbeMarkers())
+		RenderDoc::Inst().ProbeMarker(name);
+
 	if(m_State == WRITING_CAPFRAME)
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_MARKER);
@@ -114,6 +117,19 @@ void WrappedID3D11DeviceContext::SetMarker(uint32_t col, const wchar_t *name)
 
 int WrappedID3D11DeviceContext::PushEvent(uint32_t col, const wchar_t *name)
 {
+	if(RenderDoc::Inst().ProbeMarkers())
+		RenderDoc::Inst().ProbeMarker(name);
+
+	// the capture starts before this push is recorded, so the region is the whole log
+	if(RenderDoc::Inst().ProbeRegionMarkers() && GetType() == D3D11_DEVICE_CONTEXT_IMMEDIATE &&
+		 m_State == WRITING_IDLE && RenderDoc::Inst().MatchRegionMarker(name))
+	{
+		m_pDevice->StartFrameCapture(m_pDevice, NULL);
+
+		if(m_State == WRITING_CAPFRAME)
+			m_RegionCaptureLevel = m_MarkerIndentLevel;
+	}
+
 	if(m_State == WRITING_CAPFRAME)
 	{
 		SCOPED_SERIALISE_CONTEXT(PUSH_EVENT);
@@ -136,8 +152,16 @@ int WrappedID3D11DeviceContext::PopEvent()
 
 		m_ContextRecord->AddChunk(scope.Get());
 	}
+
+	--m_MarkerIndentLevel;
+
+	if(m_RegionCaptureLevel >= 0 && m_MarkerIndentLevel <= m_RegionCaptureLevel)
+	{
+		m_RegionCaptureLevel = -1;
+		m_pDevice->EndFrameCapture(m_pDevice, NULL);
+	}
 	
-	return --m_MarkerIndentLevel;
+	return m_MarkerIndentLevel;
 }
 
 void WrappedID3D11DeviceContext::ThreadSafe_SetMarker(uint32_t col, const wchar_t *name)
@@ -312,7 +336,8 @@ void WrappedID3D11DeviceContext::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->IA.Topo, Topology)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_TOPOLOGY);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -349,7 +374,8 @@ void WrappedID3D11DeviceContext::IASetInputLayout(ID3D11InputLayout *pInputLayou
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->IA.Layout, pInputLayout)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_INPUT_LAYOUT);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -414,7 +440,10 @@ void WrappedID3D11DeviceContext::IASetVertexBuffers(UINT StartSlot, UINT NumBuff
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->IA.VBs, ppVertexBuffers, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->IA.Strides, pStrides, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->IA.Offsets, pOffsets, StartSlot, NumBuffers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_VBUFFER);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -466,7 +495,10 @@ void WrappedID3D11DeviceContext::IASetIndexBuffer(ID3D11Buffer *pIndexBuffer, DX
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->IA.IndexBuffer, pIndexBuffer) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->IA.IndexFormat, Format) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->IA.IndexOffset, Offset)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_IBUFFER);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -623,7 +655,10 @@ void WrappedID3D11DeviceContext::VSSetConstantBuffers(UINT StartSlot, UINT NumBu
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->VS.ConstantBuffers, ppConstantBuffers, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->VS.CBOffsets, NullCBOffsets, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->VS.CBCounts, NullCBCounts, StartSlot, NumBuffers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_VS_CBUFFERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -688,7 +723,8 @@ void WrappedID3D11DeviceContext::VSSetShaderResources(UINT StartSlot, UINT NumVi
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->VS.SRVs, ppShaderResourceViews, StartSlot, NumViews)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_VS_RESOURCES);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -756,7 +792,8 @@ void WrappedID3D11DeviceContext::VSSetSamplers(UINT StartSlot, UINT NumSamplers,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->VS.Samplers, ppSamplers, StartSlot, NumSamplers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_VS_SAMPLERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -820,7 +857,13 @@ void WrappedID3D11DeviceContext::VSSetShader(ID3D11VertexShader *pVertexShader,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(RenderDoc::Inst().ProbeShaders())
+		RenderDoc::Inst().ProbeShader((uint64_t)(uintptr_t)pVertexShader);
+
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->VS.Shader, (ID3D11DeviceChild *)pVertexShader) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->VS.NumInstances, NumClassInstances) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->VS.Instances, ppClassInstances, 0, NumClassInstances)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_VS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -984,7 +1027,10 @@ void WrappedID3D11DeviceContext::HSSetConstantBuffers(UINT StartSlot, UINT NumBu
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->HS.ConstantBuffers, ppConstantBuffers, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->HS.CBOffsets, NullCBOffsets, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->HS.CBCounts, NullCBCounts, StartSlot, NumBuffers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_HS_CBUFFERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1049,7 +1095,8 @@ void WrappedID3D11DeviceContext::HSSetShaderResources(UINT StartSlot, UINT NumVi
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->HS.SRVs, ppShaderResourceViews, StartSlot, NumViews)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_HS_RESOURCES);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1117,7 +1164,8 @@ void WrappedID3D11DeviceContext::HSSetSamplers(UINT StartSlot, UINT NumSamplers,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->HS.Samplers, ppSamplers, StartSlot, NumSamplers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_HS_SAMPLERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1181,7 +1229,13 @@ void WrappedID3D11DeviceContext::HSSetShader(ID3D11HullShader *pHullShader, ID3D
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(RenderDoc::Inst().ProbeShaders())
+		RenderDoc::Inst().ProbeShader((uint64_t)(uintptr_t)pHullShader);
+
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->HS.Shader, (ID3D11DeviceChild *)pHullShader) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->HS.NumInstances, NumClassInstances) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->HS.Instances, ppClassInstances, 0, NumClassInstances)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_HS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1344,7 +1398,10 @@ void WrappedID3D11DeviceContext::DSSetConstantBuffers(UINT StartSlot, UINT NumBu
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->DS.ConstantBuffers, ppConstantBuffers, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->DS.CBOffsets, NullCBOffsets, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->DS.CBCounts, NullCBCounts, StartSlot, NumBuffers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_DS_CBUFFERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1409,7 +1466,8 @@ void WrappedID3D11DeviceContext::DSSetShaderResources(UINT StartSlot, UINT NumVi
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->DS.SRVs, ppShaderResourceViews, StartSlot, NumViews)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_DS_RESOURCES);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1477,7 +1535,8 @@ void WrappedID3D11DeviceContext::DSSetSamplers(UINT StartSlot, UINT NumSamplers,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->DS.Samplers, ppSamplers, StartSlot, NumSamplers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_DS_SAMPLERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1541,7 +1600,13 @@ void WrappedID3D11DeviceContext::DSSetShader(ID3D11DomainShader *pDomainShader,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(RenderDoc::Inst().ProbeShaders())
+		RenderDoc::Inst().ProbeShader((uint64_t)(uintptr_t)pDomainShader);
+
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->DS.Shader, (ID3D11DeviceChild *)pDomainShader) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->DS.NumInstances, NumClassInstances) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->DS.Instances, ppClassInstances, 0, NumClassInstances)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_DS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1704,7 +1769,10 @@ void WrappedID3D11DeviceContext::GSSetConstantBuffers(UINT StartSlot, UINT NumBu
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->GS.ConstantBuffers, ppConstantBuffers, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->GS.CBOffsets, NullCBOffsets, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->GS.CBCounts, NullCBCounts, StartSlot, NumBuffers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_GS_CBUFFERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1769,7 +1837,8 @@ void WrappedID3D11DeviceContext::GSSetShaderResources(UINT StartSlot, UINT NumVi
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->GS.SRVs, ppShaderResourceViews, StartSlot, NumViews)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_GS_RESOURCES);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1837,7 +1906,8 @@ void WrappedID3D11DeviceContext::GSSetSamplers(UINT StartSlot, UINT NumSamplers,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->GS.Samplers, ppSamplers, StartSlot, NumSamplers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_GS_SAMPLERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -1901,7 +1971,13 @@ void WrappedID3D11DeviceContext::GSSetShader( ID3D11GeometryShader *pShader, ID3
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(RenderDoc::Inst().ProbeShaders())
+		RenderDoc::Inst().ProbeShader((uint64_t)(uintptr_t)pShader);
+
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->GS.Shader, (ID3D11DeviceChild *)pShader) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->GS.NumInstances, NumClassInstances) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->GS.Instances, ppClassInstances, 0, NumClassInstances)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_GS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2225,7 +2301,9 @@ void WrappedID3D11DeviceContext::RSSetViewports(UINT NumViewports, const D3D11_V
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->RS.NumViews, NumViewports) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->RS.Viewports, pViewports, 0, NumViewports)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_VIEWPORTS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2264,7 +2342,9 @@ void WrappedID3D11DeviceContext::RSSetScissorRects(UINT NumRects, const D3D11_RE
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->RS.NumScissors, NumRects) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->RS.Scissors, pRects, 0, NumRects)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_SCISSORS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2315,7 +2395,8 @@ void WrappedID3D11DeviceContext::RSSetState(ID3D11RasterizerState *pRasterizerSt
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->RS.State, pRasterizerState)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_RASTER);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2478,7 +2559,10 @@ void WrappedID3D11DeviceContext::PSSetConstantBuffers(UINT StartSlot, UINT NumBu
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->PS.ConstantBuffers, ppConstantBuffers, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->PS.CBOffsets, NullCBOffsets, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->PS.CBCounts, NullCBCounts, StartSlot, NumBuffers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_PS_CBUFFERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2541,7 +2625,8 @@ void WrappedID3D11DeviceContext::PSSetShaderResources(UINT StartSlot, UINT NumVi
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->PS.SRVs, ppShaderResourceViews, StartSlot, NumViews)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_PS_RESOURCES);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2607,7 +2692,8 @@ void WrappedID3D11DeviceContext::PSSetSamplers(UINT StartSlot, UINT NumSamplers,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->PS.Samplers, ppSamplers, StartSlot, NumSamplers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_PS_SAMPLERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2670,7 +2756,13 @@ void WrappedID3D11DeviceContext::PSSetShader(ID3D11PixelShader *pPixelShader, ID
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(RenderDoc::Inst().ProbeShaders())
+		RenderDoc::Inst().ProbeShader((uint64_t)(uintptr_t)pPixelShader);
+
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->PS.Shader, (ID3D11DeviceChild *)pPixelShader) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->PS.NumInstances, NumClassInstances) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->PS.Instances, ppClassInstances, 0, NumClassInstances)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_PS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2900,7 +2992,18 @@ void WrappedID3D11DeviceContext::OMSetRenderTargets(UINT NumViews, ID3D11RenderT
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	ID3D11RenderTargetView *RTs[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {0};
+	for(UINT i=0; i < NumViews && ppRenderTargetViews; i++)
+		RTs[i] = ppRenderTargetViews[i];
+
+	ID3D11UnorderedAccessView *UAVs[D3D11_PS_CS_UAV_REGISTER_COUNT] = {0};
+
+	// this also unbinds any UAVs, so it's only redundant if there weren't any
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.RenderTargets, RTs, 0, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.DepthView, pDepthStencilView) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.UAVStartSlot, NumViews) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.UAVs, UAVs, 0, D3D11_PS_CS_UAV_REGISTER_COUNT)))
 	{
 		SCOPED_SERIALISE_SMALL_CONTEXT(SET_RTARGET);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -2908,10 +3011,6 @@ void WrappedID3D11DeviceContext::OMSetRenderTargets(UINT NumViews, ID3D11RenderT
 		
 		m_ContextRecord->AddChunk(scope.Get());
 	}
-	
-	ID3D11RenderTargetView *RTs[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {0};
-	for(UINT i=0; i < NumViews && ppRenderTargetViews; i++)
-		RTs[i] = ppRenderTargetViews[i];
 
 	// this function always sets all render targets
 	if(m_CurrentPipelineState->ValidOutputMerger(RTs, pDepthStencilView))
@@ -2944,7 +3043,6 @@ void WrappedID3D11DeviceContext::OMSetRenderTargets(UINT NumViews, ID3D11RenderT
 		}
 	}
 
-	ID3D11UnorderedAccessView *UAVs[D3D11_PS_CS_UAV_REGISTER_COUNT] = {0};
 	m_CurrentPipelineState->ChangeRefWrite(m_CurrentPipelineState->OM.UAVs, UAVs, 0, D3D11_PS_CS_UAV_REGISTER_COUNT);
 	
 	for(UINT i=0; i < NumViews; i++)
@@ -3266,7 +3364,12 @@ void WrappedID3D11DeviceContext::OMSetBlendState(ID3D11BlendState *pBlendState,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	FLOAT DefaultBlendFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.BlendState, pBlendState) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.BlendFactor, BlendFactor ? BlendFactor : DefaultBlendFactor, 0, 4) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.SampleMask, SampleMask)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_BLEND);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -3274,8 +3377,6 @@ void WrappedID3D11DeviceContext::OMSetBlendState(ID3D11BlendState *pBlendState,
 
 		m_ContextRecord->AddChunk(scope.Get());
 	}
-
-	FLOAT DefaultBlendFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
 	
 	m_CurrentPipelineState->ChangeRefRead(m_CurrentPipelineState->OM.BlendState, pBlendState);
 	if(BlendFactor != NULL)
@@ -3321,7 +3422,9 @@ void WrappedID3D11DeviceContext::OMSetDepthStencilState(ID3D11DepthStencilState
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.DepthStencilState, pDepthStencilState) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->OM.StencRef, StencilRef&0xff)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_DEPTHSTENCIL);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -3348,44 +3451,33 @@ void WrappedID3D11DeviceContext::Serialise_DebugMessages()
 
 	m_EmptyCommandList = false;
 
-	// only grab debug messages for the immediate context, without serialising all
+	// only count debug messages for the immediate context, without serialising all
 	// API use there's no way to find out which messages come from which context :(.
+	uint32_t newMessages = 0;
 	if(m_State == WRITING_CAPFRAME && GetType() == D3D11_DEVICE_CONTEXT_IMMEDIATE)
 	{
-		debugMessages = m_pDevice->GetDebugMessages();
+		newMessages = m_pDevice->CountNewDebugMessages();
 	}
 
-	SERIALISE_ELEMENT(bool, HasCallstack, RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws != 0);
+	SERIALISE_ELEMENT(bool, HasCallstack, RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws != 0 &&
+		RenderDoc::Inst().ShouldCollectCallstack(m_pSerialiser->GetChunkName()));
 
 	if(HasCallstack)
-	{
-		if(m_State >= WRITING)
-		{
-			Callstack::Stackwalk *call = Callstack::Collect();
-
-			RDCASSERT(call->NumLevels() < 0xff);
-
-			size_t numLevels = call->NumLevels();
-			uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-			m_pSerialiser->Serialise("callstack", stack, numLevels);
-
-			delete call;
-		}
-		else
-		{
-			size_t numLevels = 0;
-			uint64_t *stack = NULL;
+		m_pSerialiser->SerialiseCallstack();
 
-			m_pSerialiser->Serialise("callstack", stack, numLevels);
+	// the messages are fetched and serialised all at once at the end of the frame, in
+	// Serialise_FrameDebugMessages. Here only the number this event raised is recorded.
+	if(m_State >= WRITING || m_pDevice->GetLogVersion() >= 0x00000C)
+	{
+		SERIALISE_ELEMENT_VARINT(uint32_t, NumNewMessages, newMessages);
 
-			m_pSerialiser->SetCallstack(stack, numLevels);
+		if(m_State == READING && NumNewMessages > 0)
+			m_PendingDebugMessages.push_back(std::make_pair(m_CurEventID, NumNewMessages));
 
-			SAFE_DELETE_ARRAY(stack);
-		}
+		return;
 	}
 
-	SERIALISE_ELEMENT(uint32_t, NumMessages, (uint32_t)debugMessages.size());
+	SERIALISE_ELEMENT_VARINT(uint32_t, NumMessages, (uint32_t)debugMessages.size());
 
 	for(uint32_t i=0; i < NumMessages; i++)
 	{
@@ -3418,15 +3510,132 @@ void WrappedID3D11DeviceContext::Serialise_DebugMessages()
 	}
 }
 
+void WrappedID3D11DeviceContext::Serialise_FrameDebugMessages()
+{
+	// each distinct message is only stored once, with every message raised in the frame
+	// stored as an index into them.
+	vector<DebugMessage> uniqueMessages;
+	vector<uint32_t> messageIndices;
+
+	if(m_State >= WRITING)
+	{
+		vector<DebugMessage> debugMessages = m_pDevice->GetDebugMessages();
+
+		map<string, uint32_t> uniqueLookup;
+		messageIndices.reserve(debugMessages.size());
+
+		for(size_t i=0; i < debugMessages.size(); i++)
+		{
+			const DebugMessage &msg = debugMessages[i];
+
+			string key = StringFormat::Fmt("%u %u %u ", msg.category, msg.severity, msg.messageID);
+			key += msg.description.elems;
+
+			auto it = uniqueLookup.find(key);
+			if(it == uniqueLookup.end())
+			{
+				it = uniqueLookup.insert(std::make_pair(key, (uint32_t)uniqueMessages.size())).first;
+				uniqueMessages.push_back(msg);
+			}
+
+			messageIndices.push_back(it->second);
+		}
+	}
+
+	SERIALISE_ELEMENT_VARINT(uint32_t, NumUnique, (uint32_t)uniqueMessages.size());
+
+	if(m_State < WRITING)
+		uniqueMessages.resize(NumUnique);
+
+	for(uint32_t i=0; i < NumUnique; i++)
+	{
+		ScopedContext msgscope(m_pSerialiser, m_pDebugSerialiser, "DebugMessage", "DebugMessage", 0, false);
+
+		string desc;
+		if(m_State >= WRITING)
+			desc = uniqueMessages[i].description.elems;
+
+		SERIALISE_ELEMENT(uint32_t, Category, uniqueMessages[i].category);
+		SERIALISE_ELEMENT(uint32_t, Severity, uniqueMessages[i].severity);
+		SERIALISE_ELEMENT(uint32_t, ID, uniqueMessages[i].messageID);
+		SERIALISE_ELEMENT(string, Description, desc);
+
+		if(m_State < WRITING)
+		{
+			uniqueMessages[i].source = eDbgSource_API;
+			uniqueMessages[i].category = (DebugMessageCategory)Category;
+			uniqueMessages[i].severity = (DebugMessageSeverity)Severity;
+			uniqueMessages[i].messageID = ID;
+			uniqueMessages[i].description = Description;
+		}
+	}
+
+	SERIALISE_ELEMENT_VARINT(uint32_t, NumMessages, (uint32_t)messageIndices.size());
+
+	if(m_State < WRITING)
+		messageIndices.resize(NumMessages);
+
+	for(uint32_t i=0; i < NumMessages; i++)
+		m_pSerialiser->SerialiseVarint("MessageIndex", messageIndices[i]);
+
+	if(m_State != READING)
+		return;
+
+	// messages raised after the last event that counted them, e.g. by Present(), belong to
+	// the end of the frame
+	uint32_t counted = 0;
+	for(size_t i=0; i < m_PendingDebugMessages.size(); i++)
+		counted += m_PendingDebugMessages[i].second;
+
+	if(counted < NumMessages)
+		m_PendingDebugMessages.push_back(std::make_pair(m_CurEventID, NumMessages - counted));
+
+	// hand each event its messages in order, with runs of the same message at one event
+	// collapsed into a single one.
+	uint32_t m = 0;
+	for(size_t i=0; i < m_PendingDebugMessages.size(); i++)
+	{
+		uint32_t eventEnd = RDCMIN(NumMessages, m + m_PendingDebugMessages[i].second);
+
+		while(m < eventEnd)
+		{
+			uint32_t idx = messageIndices[m];
+
+			uint32_t repeats = 1;
+			while(m+repeats < eventEnd && messageIndices[m+repeats] == idx)
+				repeats++;
+
+			if(idx < NumUnique)
+			{
+				DebugMessage msg = uniqueMessages[idx];
+				msg.eventID = m_PendingDebugMessages[i].first;
+
+				if(repeats > 1)
+					msg.description = StringFormat::Fmt("%s (repeated %u times)", msg.description.elems, repeats);
+
+				m_pDevice->AddDebugMessage(msg);
+			}
+			else
+			{
+				RDCERR("Invalid debug message index %u, only %u messages", idx, NumUnique);
+			}
+
+			m += repeats;
+		}
+	}
+
+	m_PendingDebugMessages.clear();
+}
+
 
 bool WrappedID3D11DeviceContext::Serialise_DrawIndexedInstanced(UINT IndexCountPerInstance_, UINT InstanceCount_, UINT StartIndexLocation_,
 																INT BaseVertexLocation_, UINT StartInstanceLocation_)
 {
-	SERIALISE_ELEMENT(uint32_t, IndexCountPerInstance, IndexCountPerInstance_);
-	SERIALISE_ELEMENT(uint32_t, InstanceCount, InstanceCount_);
-	SERIALISE_ELEMENT(uint32_t, StartIndexLocation, StartIndexLocation_);
-	SERIALISE_ELEMENT(int32_t, BaseVertexLocation, BaseVertexLocation_);
-	SERIALISE_ELEMENT(uint32_t, StartInstanceLocation, StartInstanceLocation_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, IndexCountPerInstance, IndexCountPerInstance_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, InstanceCount, InstanceCount_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, StartIndexLocation, StartIndexLocation_);
+	SERIALISE_ELEMENT_VARINT(int32_t, BaseVertexLocation, BaseVertexLocation_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, StartInstanceLocation, StartInstanceLocation_);
 
 	if(m_State <= EXECUTING)
 	{
@@ -3464,6 +3673,8 @@ void WrappedID3D11DeviceContext::DrawIndexedInstanced(UINT IndexCountPerInstance
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Draws++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
@@ -3486,10 +3697,10 @@ void WrappedID3D11DeviceContext::DrawIndexedInstanced(UINT IndexCountPerInstance
 
 bool WrappedID3D11DeviceContext::Serialise_DrawInstanced(UINT VertexCountPerInstance_, UINT InstanceCount_, UINT StartVertexLocation_, UINT StartInstanceLocation_)
 {
-	SERIALISE_ELEMENT(uint32_t, VertexCountPerInstance, VertexCountPerInstance_);
-	SERIALISE_ELEMENT(uint32_t, InstanceCount, InstanceCount_);
-	SERIALISE_ELEMENT(uint32_t, StartVertexLocation, StartVertexLocation_);
-	SERIALISE_ELEMENT(uint32_t, StartInstanceLocation, StartInstanceLocation_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, VertexCountPerInstance, VertexCountPerInstance_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, InstanceCount, InstanceCount_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, StartVertexLocation, StartVertexLocation_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, StartInstanceLocation, StartInstanceLocation_);
 
 	if(m_State <= EXECUTING)
 	{
@@ -3525,6 +3736,8 @@ void WrappedID3D11DeviceContext::DrawInstanced(UINT VertexCountPerInstance, UINT
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Draws++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->DrawInstanced(VertexCountPerInstance, InstanceCount, StartVertexLocation, StartInstanceLocation);
@@ -3547,9 +3760,9 @@ void WrappedID3D11DeviceContext::DrawInstanced(UINT VertexCountPerInstance, UINT
 
 bool WrappedID3D11DeviceContext::Serialise_DrawIndexed(UINT IndexCount_, UINT StartIndexLocation_, INT BaseVertexLocation_)
 {
-	SERIALISE_ELEMENT(uint32_t, IndexCount, IndexCount_);
-	SERIALISE_ELEMENT(uint32_t, StartIndexLocation, StartIndexLocation_);
-	SERIALISE_ELEMENT(int32_t, BaseVertexLocation, BaseVertexLocation_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, IndexCount, IndexCount_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, StartIndexLocation, StartIndexLocation_);
+	SERIALISE_ELEMENT_VARINT(int32_t, BaseVertexLocation, BaseVertexLocation_);
 
 	if(m_State <= EXECUTING)
 	{
@@ -3583,6 +3796,8 @@ void WrappedID3D11DeviceContext::DrawIndexed(UINT IndexCount, UINT StartIndexLoc
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Draws++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->DrawIndexed(IndexCount, StartIndexLocation, BaseVertexLocation);
@@ -3605,8 +3820,8 @@ void WrappedID3D11DeviceContext::DrawIndexed(UINT IndexCount, UINT StartIndexLoc
 
 bool WrappedID3D11DeviceContext::Serialise_Draw(UINT VertexCount_, UINT StartVertexLocation_)
 {
-	SERIALISE_ELEMENT(uint32_t, VertexCount, VertexCount_);
-	SERIALISE_ELEMENT(uint32_t, StartVertexLocation, StartVertexLocation_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, VertexCount, VertexCount_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, StartVertexLocation, StartVertexLocation_);
 
 	if(m_State <= EXECUTING)
 	{
@@ -3639,6 +3854,8 @@ void WrappedID3D11DeviceContext::Draw(UINT VertexCount, UINT StartVertexLocation
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Draws++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->Draw(VertexCount, StartVertexLocation);
@@ -3743,6 +3960,8 @@ void WrappedID3D11DeviceContext::DrawAuto()
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Draws++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->DrawAuto();
@@ -3816,6 +4035,8 @@ void WrappedID3D11DeviceContext::DrawIndexedInstancedIndirect(ID3D11Buffer *pBuf
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Draws++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->DrawIndexedInstancedIndirect(UNWRAP(WrappedID3D11Buffer, pBufferForArgs), AlignedByteOffsetForArgs);
@@ -3890,6 +4111,8 @@ void WrappedID3D11DeviceContext::DrawInstancedIndirect(ID3D11Buffer *pBufferForA
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Draws++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->DrawInstancedIndirect(UNWRAP(WrappedID3D11Buffer, pBufferForArgs), AlignedByteOffsetForArgs);
@@ -4069,7 +4292,10 @@ void WrappedID3D11DeviceContext::CSSetConstantBuffers(UINT StartSlot, UINT NumBu
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->CS.ConstantBuffers, ppConstantBuffers, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->CS.CBOffsets, NullCBOffsets, StartSlot, NumBuffers) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->CS.CBCounts, NullCBCounts, StartSlot, NumBuffers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_CS_CBUFFERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -4134,7 +4360,8 @@ void WrappedID3D11DeviceContext::CSSetShaderResources(UINT StartSlot, UINT NumVi
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->CS.SRVs, ppShaderResourceViews, StartSlot, NumViews)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_CS_RESOURCES);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -4277,7 +4504,8 @@ void WrappedID3D11DeviceContext::CSSetSamplers(UINT StartSlot, UINT NumSamplers,
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->CS.Samplers, ppSamplers, StartSlot, NumSamplers)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_CS_SAMPLERS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -4340,7 +4568,13 @@ void WrappedID3D11DeviceContext::CSSetShader(ID3D11ComputeShader *pComputeShader
 
 	m_EmptyCommandList = false;
 
-	if(m_State == WRITING_CAPFRAME)
+	if(RenderDoc::Inst().ProbeShaders())
+		RenderDoc::Inst().ProbeShader((uint64_t)(uintptr_t)pComputeShader);
+
+	if(m_State == WRITING_CAPFRAME && !(m_FilterRedundantSets &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->CS.Shader, (ID3D11DeviceChild *)pComputeShader) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->CS.NumInstances, NumClassInstances) &&
+		m_CurrentPipelineState->IsSame(m_CurrentPipelineState->CS.Instances, ppClassInstances, 0, NumClassInstances)))
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_CS);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
@@ -4447,9 +4681,9 @@ void WrappedID3D11DeviceContext::ExecuteCommandList(ID3D11CommandList *pCommandL
 		else
 		{
 			RDCDEBUG("Executed successful command list %llu", wrapped->GetResourceID());
-			ResourceId contextId = wrapped->GetResourceID();
 
-			D3D11ResourceRecord *cmdListRecord = m_pDevice->GetResourceManager()->GetResourceRecord(contextId);
+			D3D11ResourceRecord *cmdListRecord = wrapped->GetRecord();
+			RDCASSERT(cmdListRecord);
 
 			if(m_DeferredRecords.find(cmdListRecord) == m_DeferredRecords.end())
 			{
@@ -4465,6 +4699,9 @@ void WrappedID3D11DeviceContext::ExecuteCommandList(ID3D11CommandList *pCommandL
 	else if(m_State == WRITING_IDLE)
 	{
 		m_CurrentPipelineState->MarkDirty(m_pDevice->GetResourceManager());
+
+		// keep command lists that are executed again and again from being discarded
+		m_pDevice->HoldCommandList((WrappedID3D11CommandList *)pCommandList);
 	}
 
 	if(!RestoreContextState)
@@ -4475,9 +4712,9 @@ void WrappedID3D11DeviceContext::ExecuteCommandList(ID3D11CommandList *pCommandL
 
 bool WrappedID3D11DeviceContext::Serialise_Dispatch(UINT ThreadGroupCountX_, UINT ThreadGroupCountY_, UINT ThreadGroupCountZ_)
 {
-	SERIALISE_ELEMENT(uint32_t, ThreadGroupCountX, ThreadGroupCountX_);
-	SERIALISE_ELEMENT(uint32_t, ThreadGroupCountY, ThreadGroupCountY_);
-	SERIALISE_ELEMENT(uint32_t, ThreadGroupCountZ, ThreadGroupCountZ_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, ThreadGroupCountX, ThreadGroupCountX_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, ThreadGroupCountY, ThreadGroupCountY_);
+	SERIALISE_ELEMENT_VARINT(uint32_t, ThreadGroupCountZ, ThreadGroupCountZ_);
 	
 	if(m_State <= EXECUTING)
 	{
@@ -4510,13 +4747,15 @@ void WrappedID3D11DeviceContext::Dispatch(UINT ThreadGroupCountX, UINT ThreadGro
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Dispatches++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->Dispatch(ThreadGroupCountX, ThreadGroupCountY, ThreadGroupCountZ);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DISPATCH);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DISPATCH);
 		m_pSerialiser->Serialise("context", m_ResourceID);	
 		Serialise_Dispatch(ThreadGroupCountX, ThreadGroupCountY, ThreadGroupCountZ);
 		
@@ -4576,6 +4815,8 @@ void WrappedID3D11DeviceContext::DispatchIndirect(ID3D11Buffer *pBufferForArgs,
 {
 	DrainAnnotationQueue();
 
+	m_FrameStats.Dispatches++;
+
 	m_EmptyCommandList = false;
 
 	m_pRealContext->DispatchIndirect(UNWRAP(WrappedID3D11Buffer, pBufferForArgs), AlignedByteOffsetForArgs);
@@ -4623,6 +4864,7 @@ bool WrappedID3D11DeviceContext::Serialise_FinishCommandList(BOOL RestoreDeferre
 		if(ret)
 		{
 			m_pDevice->GetResourceManager()->AddLiveResource(cmdList, ret);
+			m_pDevice->GetImmediateContext()->FinishedCmdList(this, cmdList, ret, RestoreDeferredContextState != 0);
 		}
 	}
 
@@ -4671,6 +4913,8 @@ HRESULT WrappedID3D11DeviceContext::FinishCommandList(BOOL RestoreDeferredContex
 		D3D11ResourceRecord *record = m_pDevice->GetResourceManager()->AddResourceRecord(wrapped->GetResourceID());
 		record->Length = 0;
 		record->ignoreSerialise = true;
+
+		wrapped->SetRecord(record);
 	}
 
 	// if we got here and m_SuccessfulCapture is on, we have captured everything in this command list
@@ -4688,10 +4932,16 @@ HRESULT WrappedID3D11DeviceContext::FinishCommandList(BOOL RestoreDeferredContex
 		
 		m_ContextRecord->AddChunk(scope.Get());
 
-		D3D11ResourceRecord *r = m_pDevice->GetResourceManager()->GetResourceRecord(wrapped->GetResourceID());
+		// hand the whole chunk list over to the command list, leaving ours empty for
+		// whatever's recorded next
+		D3D11ResourceRecord *r = wrapped->GetRecord();
 		RDCASSERT(r);
 
 		m_ContextRecord->SwapChunks(r);
+
+		// recorded outside of a frame capture, only because of CaptureAllCmdLists
+		if(!m_pDevice->IsCapturingFrame())
+			m_pDevice->HoldCommandList(wrapped);
 	}
 	else if(m_State == WRITING_CAPFRAME && !m_SuccessfulCapture)
 	{
@@ -5617,6 +5867,36 @@ void WrappedID3D11DeviceContext::ClearState()
 	VerifyState();
 }
 
+// returns true if a view onto res with the given W range (only used for 3D textures) covers
+// every subresource, so a clear through it overwrites the whole of res. Only single-mip and
+// single-slice resources qualify, which is also what gets a fast-clear initial state on replay.
+static bool ViewCoversResource(ID3D11Resource *res, UINT firstWSlice, UINT wSize)
+{
+	D3D11_RESOURCE_DIMENSION dim;
+	res->GetType(&dim);
+
+	if(dim == D3D11_RESOURCE_DIMENSION_TEXTURE1D)
+	{
+		D3D11_TEXTURE1D_DESC desc;
+		((ID3D11Texture1D *)res)->GetDesc(&desc);
+		return desc.MipLevels == 1 && desc.ArraySize == 1;
+	}
+	else if(dim == D3D11_RESOURCE_DIMENSION_TEXTURE2D)
+	{
+		D3D11_TEXTURE2D_DESC desc;
+		((ID3D11Texture2D *)res)->GetDesc(&desc);
+		return desc.MipLevels == 1 && desc.ArraySize == 1;
+	}
+	else if(dim == D3D11_RESOURCE_DIMENSION_TEXTURE3D)
+	{
+		D3D11_TEXTURE3D_DESC desc;
+		((ID3D11Texture3D *)res)->GetDesc(&desc);
+		return desc.MipLevels == 1 && firstWSlice == 0 && wSize >= desc.Depth;
+	}
+
+	return false;
+}
+
 bool WrappedID3D11DeviceContext::Serialise_ClearRenderTargetView(ID3D11RenderTargetView *pRenderTargetView, const FLOAT ColorRGBA[4])
 {
 	SERIALISE_ELEMENT(ResourceId, View, GetIDForResource(pRenderTargetView));
@@ -5683,6 +5963,19 @@ void WrappedID3D11DeviceContext::ClearRenderTargetView(ID3D11RenderTargetView *p
 		m_MissingTracks.insert(GetIDForResource(res));
 		m_MissingTracks.insert(GetIDForResource(pRenderTargetView));
 
+		D3D11_RENDER_TARGET_VIEW_DESC desc;
+		pRenderTargetView->GetDesc(&desc);
+
+		bool whole = false;
+		if(desc.ViewDimension == D3D11_RTV_DIMENSION_TEXTURE3D)
+			whole = ViewCoversResource(res, desc.Texture3D.FirstWSlice, desc.Texture3D.WSize);
+		else if(desc.ViewDimension != D3D11_RTV_DIMENSION_BUFFER)
+			whole = ViewCoversResource(res, 0, 0);
+
+		// if nothing has read this target yet this frame, its initial contents aren't needed
+		if(whole)
+			MarkResourceReferenced(GetIDForResource(res), eFrameRef_CompleteWrite);
+
 		SAFE_RELEASE(res);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -6038,6 +6331,17 @@ void WrappedID3D11DeviceContext::ClearDepthStencilView(ID3D11DepthStencilView *p
 		m_MissingTracks.insert(GetIDForResource(res));
 		m_MissingTracks.insert(GetIDForResource(pDepthStencilView));
 
+		D3D11_DEPTH_STENCIL_VIEW_DESC desc;
+		pDepthStencilView->GetDesc(&desc);
+
+		bool hasStencil = desc.Format == DXGI_FORMAT_D24_UNORM_S8_UINT ||
+		                  desc.Format == DXGI_FORMAT_D32_FLOAT_S8X24_UINT;
+
+		// a depth-only clear of a depth-stencil target leaves stencil intact, so doesn't count
+		if((ClearFlags & D3D11_CLEAR_DEPTH) && ((ClearFlags & D3D11_CLEAR_STENCIL) || !hasStencil) &&
+			ViewCoversResource(res, 0, 0))
+			MarkResourceReferenced(GetIDForResource(res), eFrameRef_CompleteWrite);
+
 		SAFE_RELEASE(res);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -6581,7 +6885,12 @@ bool WrappedID3D11DeviceContext::Serialise_Map(ID3D11Resource *pResource, UINT S
 
 		if(appMem == NULL)
 		{
-			record->AllocShadowStorage(ctxMapID, mapLength);
+			if(RenderDoc::Inst().GetCaptureOptions().VerifyMapWrites)
+				record->AllocGuardedShadowStorage(ctxMapID, mapLength);
+			else if(RenderDoc::Inst().GetCaptureOptions().TrackPersistentMapWrites)
+				record->AllocWatchedShadowStorage(ctxMapID, mapLength);
+			else
+				record->AllocShadowStorage(ctxMapID, mapLength);
 			appMem = record->GetShadowPtr(ctxMapID, 0);
 
 			if(MapType != D3D11_MAP_WRITE_DISCARD)
@@ -6641,6 +6950,14 @@ bool WrappedID3D11DeviceContext::Serialise_Map(ID3D11Resource *pResource, UINT S
 		{
 			memset(appMem, 0xcc, mapLength);
 			memcpy(record->GetShadowPtr(ctxMapID, 1), appMem, mapLength);
+
+			// discard the pages written by the fill, so on unmap the watch only reports what
+			// the application wrote
+			if(record->IsShadowWatched(ctxMapID))
+			{
+				vector<size_t> fillPages;
+				record->GetWrittenShadowPages(ctxMapID, fillPages);
+			}
 		}
 
 		intercept = MapIntercept();
@@ -6687,7 +7004,7 @@ bool WrappedID3D11DeviceContext::Serialise_Map(ID3D11Resource *pResource, UINT S
 
 			if(appMem == NULL)
 			{
-				record->AllocShadowStorage(ctxMapID, mapLength);
+				record->AllocGuardedShadowStorage(ctxMapID, mapLength);
 				appMem = record->GetShadowPtr(ctxMapID, 0);
 			}
 
@@ -6736,6 +7053,14 @@ HRESULT WrappedID3D11DeviceContext::Map(ID3D11Resource *pResource, UINT Subresou
 	DrainAnnotationQueue();
 
 	m_EmptyCommandList = false;
+
+	m_FrameStats.Maps++;
+	if(WrappedID3D11Buffer::IsAlloc(pResource))
+	{
+		D3D11_BUFFER_DESC desc;
+		((ID3D11Buffer *)pResource)->GetDesc(&desc);
+		m_FrameStats.BytesMapped += desc.ByteWidth;
+	}
 	
 	ResourceId id = GetIDForResource(pResource);
 
@@ -6757,6 +7082,11 @@ HRESULT WrappedID3D11DeviceContext::Map(ID3D11Resource *pResource, UINT Subresou
 
 	if(directMap && m_State == WRITING_IDLE)
 	{
+		// keep the resource marked as written, so a previously prepared copy of its
+		// initial contents isn't reused.
+		if(MapType != D3D11_MAP_READ)
+			m_pDevice->GetResourceManager()->MarkDirtyResource(id);
+
 		return m_pRealContext->Map(m_pDevice->GetResourceManager()->UnwrapResource(pResource), Subresource,
 										MapType, MapFlags, pMappedResource);
 	}
@@ -6870,6 +7200,7 @@ bool WrappedID3D11DeviceContext::Serialise_Unmap(ID3D11Resource *pResource, UINT
 
 		if(intercept.verifyWrite && record)
 		{
+			// with guarded storage, overruns past the padding have already faulted at the write
 			if(!record->VerifyShadowStorage(ctxMapID))
 			{
 				int res = MessageBoxA(NULL,
@@ -6893,10 +7224,70 @@ bool WrappedID3D11DeviceContext::Serialise_Unmap(ID3D11Resource *pResource, UINT
 
 		size_t diffStart = 0;
 		size_t diffEnd = len;
+
+		// with a watched shadow, only pages written since the last unmap can differ from
+		// the second shadow copy. Always fetch them, even for discard maps, so that the
+		// watch is reset for the next map.
+		bool watched = (m_State == WRITING_CAPFRAME && record->IsShadowWatched(ctxMapID));
+		vector<size_t> writtenPages;
+
+		if(watched)
+			record->GetWrittenShadowPages(ctxMapID, writtenPages);
 		
-		if(m_State == WRITING_CAPFRAME && len > 512 && intercept.MapType != D3D11_MAP_WRITE_DISCARD)
+		// the previous contents of a discarded map are undefined, so only the range the
+		// application wrote needs to be serialised and the rest is left undefined on replay.
+		bool discard = (intercept.MapType == D3D11_MAP_WRITE_DISCARD);
+
+		if(m_State == WRITING_CAPFRAME && len > 512)
 		{
-			bool found = FindDiffRange(appWritePtr, record->GetShadowPtr(ctxMapID, 1), len, diffStart, diffEnd);
+			bool found = false;
+
+			if(watched)
+			{
+				size_t pageSize = WriteWatch::PageSize();
+
+				diffStart = len+1;
+				diffEnd = 0;
+
+				for(size_t i=0; i < writtenPages.size(); i++)
+				{
+					size_t offs = writtenPages[i];
+					if(offs >= len)
+						continue;
+
+					size_t pageLen = RDCMIN(pageSize, len - offs);
+					size_t pageStart = 0, pageEnd = 0;
+
+					// a written page of a discard map is needed entirely, since bytes that match
+					// the fill pattern may still have been written
+					if(discard)
+					{
+						diffStart = RDCMIN(diffStart, offs);
+						diffEnd = RDCMAX(diffEnd, offs + pageLen);
+						found = true;
+					}
+					else if(FindDiffRange(appWritePtr + offs, record->GetShadowPtr(ctxMapID, 1) + offs, pageLen, pageStart, pageEnd))
+					{
+						diffStart = RDCMIN(diffStart, offs + pageStart);
+						diffEnd = RDCMAX(diffEnd, offs + pageEnd);
+						found = true;
+					}
+				}
+			}
+			else
+			{
+				// for discard maps the second shadow copy holds the 0xcc fill from Map()
+				found = FindDiffRange(appWritePtr, record->GetShadowPtr(ctxMapID, 1), len, diffStart, diffEnd);
+
+				// data that happens to match the fill at the edges of the written range would
+				// be lost, so widen to 16 byte boundaries to make that vanishingly unlikely
+				if(found && discard)
+				{
+					diffStart &= ~size_t(0xf);
+					diffEnd = RDCMIN(len, (diffEnd + 0xf) & ~size_t(0xf));
+				}
+			}
+
 			if(found)
 			{
 				static size_t saved = 0;
@@ -6932,7 +7323,10 @@ bool WrappedID3D11DeviceContext::Serialise_Unmap(ID3D11Resource *pResource, UINT
 		if(m_State >= WRITING || m_pDevice->GetLogVersion() >= 0x000007)
 			m_pSerialiser->AlignNextBuffer(32);
 
-		m_pSerialiser->SerialiseBuffer("MapData", appWritePtr, len);
+		m_pSerialiser->SerialiseExternalBuffer("MapData", appWritePtr, len);
+
+		if(m_State == READING && m_pDevice->GetResourceManager()->HasLiveResource(mapIdx.resource))
+			m_UpdatedResources.insert(m_pDevice->GetResourceManager()->GetLiveID(mapIdx.resource));
 
 		if(m_State <= EXECUTING && m_pDevice->GetResourceManager()->HasLiveResource(mapIdx.resource))
 		{
@@ -27,189 +27,780 @@
 #include "d3d11_device.h"
 #include "d3d11_context.h"
 
+#include <algorithm>
+
 #if defined(ENABLE_NVIDIA_PERFKIT)
 #define NVPM_INITGUID
 #include STRINGIZE(CONCAT(NVIDIA_PERFKIT_DIR, inc\\NvPmApi.h))
 
-NvPmApi *nvAPI = NULL;
-
-int enumFunc(NVPMCounterID id, const char *name)
+// NVIDIA PerfKit counters through NvPmApi. Counter IDs are the PerfKit IDs offset from
+// eCounter_FirstNvidia, and objects in an experiment are our sample indices.
+class NVPerfKitCounters : public IHardwareCounters
 {
-	RDCLOG("(% 4d): %s", id, name);
+	public:
+		static NVPerfKitCounters *Create(ID3D11Device *device)
+		{
+			HMODULE module = LoadLibraryA(STRINGIZE(CONCAT(NVIDIA_PERFKIT_DIR, bin\\win7_x86\\NvPmApi.Core.dll)));
+			if(module == NULL)
+			{
+				RDCWARN("Couldn't load perfkit");
+				return NULL;
+			}
 
-	return NVPM_OK;
-}
+			NVPMGetExportTable_Pfn NVPMGetExportTable = (NVPMGetExportTable_Pfn)GetProcAddress(module, "NVPMGetExportTable");
+			NvPmApi *api = NULL;
+
+			if(NVPMGetExportTable == NULL || NVPMGetExportTable(&ETID_NvPmApi, (void **)&api) != NVPM_OK || api->Init() != NVPM_OK)
+			{
+				RDCERR("Couldn't initialise perfkit");
+				FreeLibrary(module);
+				return NULL;
+			}
+
+			NVPMContext context(0);
+			if(api->CreateContextFromD3D11Device(device, &context) != NVPM_OK)
+			{
+				RDCERR("Couldn't nvAPI->CreateContextFromD3D11Device");
+				api->Shutdown();
+				FreeLibrary(module);
+				return NULL;
+			}
+
+			NVPerfKitCounters *ret = new NVPerfKitCounters(module, api, context);
+
+			m_Enumerating = ret;
+			api->EnumCountersByContext(context, &EnumCounter);
+			m_Enumerating = NULL;
+
+			RDCLOG("PerfKit exposes %u counters", (uint32_t)ret->m_Names.size());
+
+			return ret;
+		}
+
+		~NVPerfKitCounters()
+		{
+			m_API->DestroyContext(m_Context);
+			m_API->Shutdown();
+			FreeLibrary(m_Module);
+		}
+
+		bool HasCounter(uint32_t counterID)
+		{
+			return counterID >= eCounter_FirstNvidia && m_Names.find(counterID) != m_Names.end();
+		}
+
+		vector<uint32_t> EnumerateCounters()
+		{
+			vector<uint32_t> ret;
+			for(auto it=m_Names.begin(); it != m_Names.end(); ++it)
+				ret.push_back(it->first);
+			return ret;
+		}
+
+		void DescribeCounter(uint32_t counterID, CounterDescription &desc)
+		{
+			desc.counterID = counterID;
+			desc.name = m_Names[counterID];
+			desc.description = "NVIDIA PerfKit counter";
+			desc.resultByteWidth = 8;
+
+			if(IsPercentage(counterID))
+			{
+				desc.resultCompType = eCompType_Double;
+				desc.units = eUnits_Percentage;
+			}
+			else
+			{
+				desc.resultCompType = eCompType_UInt;
+				desc.units = eUnits_Absolute;
+			}
+		}
+
+		uint32_t BeginSession(const vector<uint32_t> &counters)
+		{
+			m_API->RemoveAllCounters(m_Context);
+
+			m_Enabled.clear();
+			for(size_t i=0; i < counters.size(); i++)
+			{
+				if(m_API->AddCounter(m_Context, NVPMCounterID(counters[i] - eCounter_FirstNvidia)) == NVPM_OK)
+					m_Enabled.push_back(counters[i]);
+				else
+					RDCERR("Couldn't enable PerfKit counter %s", m_Names[counters[i]].c_str());
+			}
+
+			NVPMUINT numPasses = 0;
+			if(m_Enabled.empty() || m_API->BeginExperiment(m_Context, &numPasses) != NVPM_OK)
+				return 0;
+
+			return (uint32_t)numPasses;
+		}
+
+		void BeginPass(uint32_t pass) { m_API->BeginPass(m_Context, pass); }
+		void BeginSample(uint32_t sample) { m_API->BeginObject(m_Context, sample); }
+		void EndSample(uint32_t sample) { m_API->EndObject(m_Context, sample); }
+		void EndPass(uint32_t pass) { m_API->EndPass(m_Context, pass); }
+
+		vector<CounterResult> EndSession(const vector<uint32_t> &sampleEvents)
+		{
+			m_API->EndExperiment(m_Context);
+
+			vector<CounterResult> ret;
+			ret.reserve(sampleEvents.size()*m_Enabled.size());
+
+			for(size_t s=0; s < sampleEvents.size(); s++)
+			{
+				for(size_t c=0; c < m_Enabled.size(); c++)
+				{
+					NVPMUINT64 value = 0, cycles = 0;
+					if(m_API->GetCounterValue(m_Context, NVPMCounterID(m_Enabled[c] - eCounter_FirstNvidia), (NVPMUINT)s, &value, &cycles) != NVPM_OK)
+						value = cycles = 0;
+
+					if(IsPercentage(m_Enabled[c]))
+						ret.push_back(CounterResult(sampleEvents[s], m_Enabled[c], cycles ? 100.0*double(value)/double(cycles) : 0.0));
+					else
+						ret.push_back(CounterResult(sampleEvents[s], m_Enabled[c], (uint64_t)value));
+				}
+			}
+
+			m_API->RemoveAllCounters(m_Context);
+			m_Enabled.clear();
+
+			return ret;
+		}
+
+	private:
+		NVPerfKitCounters(HMODULE module, NvPmApi *api, NVPMContext context)
+			: m_Module(module), m_API(api), m_Context(context) {}
+
+		bool IsPercentage(uint32_t counterID)
+		{
+			NVPMUINT64 hint = 0;
+			m_API->GetCounterAttribute(NVPMCounterID(counterID - eCounter_FirstNvidia), NVPMA_COUNTER_DISPLAY_HINT, &hint);
+			return hint == NVPM_CDH_PERCENT;
+		}
+
+		// EnumCountersByContext takes a plain function, so it reports into whichever
+		// instance is being created
+		static NVPerfKitCounters *m_Enumerating;
+
+		static int EnumCounter(NVPMCounterID id, const char *name)
+		{
+			if(m_Enumerating)
+				m_Enumerating->m_Names[eCounter_FirstNvidia + (uint32_t)id] = name;
+
+			return NVPM_OK;
+		}
+
+		HMODULE m_Module;
+		NvPmApi *m_API;
+		NVPMContext m_Context;
+
+		map<uint32_t, string> m_Names;
+		vector<uint32_t> m_Enabled;
+};
+
+NVPerfKitCounters *NVPerfKitCounters::m_Enumerating = NULL;
 #endif
 
-void D3D11DebugManager::PreDeviceInitCounters()
-{
-}
+#if defined(ENABLE_AMD_PERFAPI)
+#include STRINGIZE(CONCAT(AMD_PERFAPI_DIR, Include\\GPUPerfAPI.h))
+#include STRINGIZE(CONCAT(AMD_PERFAPI_DIR, Include\\GPUPerfAPIFunctionTypes.h))
 
-void D3D11DebugManager::PostDeviceInitCounters()
+// AMD counters through GPUPerfAPI. Counter IDs are GPA counter indices offset from
+// eCounter_FirstAMD.
+class AMDPerfAPICounters : public IHardwareCounters
 {
-#if defined(ENABLE_NVIDIA_PERFKIT)
-	HMODULE nvapi = LoadLibraryA(STRINGIZE(CONCAT(NVIDIA_PERFKIT_DIR, bin\\win7_x86\\NvPmApi.Core.dll)));
-	if(nvapi == NULL)
-	{
-		RDCERR("Couldn't load perfkit");
-		return;
-	}
+	public:
+		static AMDPerfAPICounters *Create(ID3D11Device *device)
+		{
+#if defined(WIN64)
+			HMODULE module = LoadLibraryA(STRINGIZE(CONCAT(AMD_PERFAPI_DIR, Bin\\x64\\GPUPerfAPIDX11-x64.dll)));
+#else
+			HMODULE module = LoadLibraryA(STRINGIZE(CONCAT(AMD_PERFAPI_DIR, Bin\\x86\\GPUPerfAPIDX11.dll)));
+#endif
+			if(module == NULL)
+			{
+				RDCWARN("Couldn't load GPUPerfAPI");
+				return NULL;
+			}
 
-	NVPMGetExportTable_Pfn NVPMGetExportTable = (NVPMGetExportTable_Pfn)GetProcAddress(nvapi, "NVPMGetExportTable");
-	if(NVPMGetExportTable == NULL)
-	{
-		RDCERR("Couldn't Get Symbol 'NVPMGetExportTable'");
-		return;
-	}
+			AMDPerfAPICounters *ret = new AMDPerfAPICounters(module);
+
+			bool ok = true;
+
+#define GET_GPA_FUNC(func) ret->func = (CONCAT(func, PtrType))GetProcAddress(module, STRINGIZE(func)); ok = ok && (ret->func != NULL);
+			GET_GPA_FUNC(GPA_Initialize);
+			GET_GPA_FUNC(GPA_Destroy);
+			GET_GPA_FUNC(GPA_OpenContext);
+			GET_GPA_FUNC(GPA_CloseContext);
+			GET_GPA_FUNC(GPA_GetNumCounters);
+			GET_GPA_FUNC(GPA_GetCounterName);
+			GET_GPA_FUNC(GPA_GetCounterDescription);
+			GET_GPA_FUNC(GPA_GetCounterDataType);
+			GET_GPA_FUNC(GPA_GetCounterUsageType);
+			GET_GPA_FUNC(GPA_EnableCounter);
+			GET_GPA_FUNC(GPA_DisableAllCounters);
+			GET_GPA_FUNC(GPA_GetPassCount);
+			GET_GPA_FUNC(GPA_BeginSession);
+			GET_GPA_FUNC(GPA_EndSession);
+			GET_GPA_FUNC(GPA_BeginPass);
+			GET_GPA_FUNC(GPA_EndPass);
+			GET_GPA_FUNC(GPA_BeginSample);
+			GET_GPA_FUNC(GPA_EndSample);
+			GET_GPA_FUNC(GPA_IsSessionReady);
+			GET_GPA_FUNC(GPA_GetSampleUInt32);
+			GET_GPA_FUNC(GPA_GetSampleUInt64);
+			GET_GPA_FUNC(GPA_GetSampleFloat32);
+			GET_GPA_FUNC(GPA_GetSampleFloat64);
+#undef GET_GPA_FUNC
+
+			if(!ok || ret->GPA_Initialize() != GPA_STATUS_OK)
+			{
+				RDCERR("Couldn't initialise GPUPerfAPI");
+				delete ret;
+				return NULL;
+			}
 
-	NVPMRESULT nvResult = NVPMGetExportTable(&ETID_NvPmApi, (void **)&nvAPI);
-	if(nvResult != NVPM_OK)
-	{
-		RDCERR("Couldn't NVPMGetExportTable");
-		return;
-	}
+			ret->m_Initialised = true;
 
-	nvResult = nvAPI->Init();
+			if(ret->GPA_OpenContext(device) != GPA_STATUS_OK || ret->GPA_GetNumCounters(&ret->m_NumCounters) != GPA_STATUS_OK)
+			{
+				RDCERR("Couldn't open GPUPerfAPI context");
+				delete ret;
+				return NULL;
+			}
 
-	if(nvResult != NVPM_OK)
-	{
-		RDCERR("Couldn't nvAPI->Init");
-		return;
-	}
+			ret->m_ContextOpen = true;
 
-	NVPMContext context(0);
-	nvResult = nvAPI->CreateContextFromD3D11Device(m_pDevice, &context);
+			RDCLOG("GPUPerfAPI exposes %u counters", ret->m_NumCounters);
 
-	if(nvResult != NVPM_OK)
-	{
-		RDCERR("Couldn't nvAPI->CreateContextFromD3D11Device");
-		return;
-	}
+			return ret;
+		}
+
+		~AMDPerfAPICounters()
+		{
+			if(m_ContextOpen)
+				GPA_CloseContext();
+			if(m_Initialised)
+				GPA_Destroy();
+			FreeLibrary(m_Module);
+		}
+
+		bool HasCounter(uint32_t counterID)
+		{
+			return counterID >= eCounter_FirstAMD && counterID < eCounter_FirstAMD + m_NumCounters;
+		}
+
+		vector<uint32_t> EnumerateCounters()
+		{
+			vector<uint32_t> ret;
+			for(gpa_uint32 i=0; i < m_NumCounters; i++)
+				ret.push_back(eCounter_FirstAMD + i);
+			return ret;
+		}
+
+		void DescribeCounter(uint32_t counterID, CounterDescription &desc)
+		{
+			gpa_uint32 idx = counterID - eCounter_FirstAMD;
+
+			const char *name = NULL, *description = NULL;
+			GPA_GetCounterName(idx, &name);
+			GPA_GetCounterDescription(idx, &description);
+
+			desc.counterID = counterID;
+			desc.name = name ? name : "Unknown";
+			desc.description = description ? description : "";
+
+			// everything is reported as a 64-bit integer or double, see EndSession
+			GPA_Type type = GPA_TYPE_UINT64;
+			GPA_GetCounterDataType(idx, &type);
+
+			desc.resultByteWidth = 8;
+			desc.resultCompType = (type == GPA_TYPE_FLOAT32 || type == GPA_TYPE_FLOAT64) ? eCompType_Double : eCompType_UInt;
+
+			GPA_Usage_Type usage = GPA_USAGE_TYPE_ITEMS;
+			GPA_GetCounterUsageType(idx, &usage);
+
+			if(usage == GPA_USAGE_TYPE_PERCENTAGE)
+				desc.units = eUnits_Percentage;
+			else if(usage == GPA_USAGE_TYPE_MILLISECONDS)
+				desc.units = eUnits_Seconds;
+			else
+				desc.units = eUnits_Absolute;
+		}
 
-	nvAPI->EnumCountersByContext(context, &enumFunc);
+		uint32_t BeginSession(const vector<uint32_t> &counters)
+		{
+			GPA_DisableAllCounters();
 
-	nvAPI->DestroyContext(context);
-	nvAPI->Shutdown();
-	nvAPI = NULL;
-	FreeLibrary(nvapi);
+			m_Enabled.clear();
+			for(size_t i=0; i < counters.size(); i++)
+			{
+				if(GPA_EnableCounter(counters[i] - eCounter_FirstAMD) == GPA_STATUS_OK)
+					m_Enabled.push_back(counters[i]);
+				else
+					RDCERR("Couldn't enable GPUPerfAPI counter %u", counters[i] - eCounter_FirstAMD);
+			}
+
+			gpa_uint32 numPasses = 0;
+			if(m_Enabled.empty() || GPA_GetPassCount(&numPasses) != GPA_STATUS_OK ||
+				 GPA_BeginSession(&m_Session) != GPA_STATUS_OK)
+				return 0;
+
+			return numPasses;
+		}
+
+		void BeginPass(uint32_t pass) { GPA_BeginPass(); }
+		void BeginSample(uint32_t sample) { GPA_BeginSample(sample); }
+		void EndSample(uint32_t sample) { GPA_EndSample(); }
+		void EndPass(uint32_t pass) { GPA_EndPass(); }
+
+		vector<CounterResult> EndSession(const vector<uint32_t> &sampleEvents)
+		{
+			vector<CounterResult> ret;
+
+			if(GPA_EndSession() != GPA_STATUS_OK)
+			{
+				RDCERR("Couldn't end GPUPerfAPI session");
+				return ret;
+			}
+
+			bool ready = false;
+			while(!ready)
+			{
+				if(GPA_IsSessionReady(&ready, m_Session) != GPA_STATUS_OK)
+				{
+					RDCERR("Couldn't read GPUPerfAPI session");
+					return ret;
+				}
+			}
+
+			ret.reserve(sampleEvents.size()*m_Enabled.size());
+
+			for(size_t s=0; s < sampleEvents.size(); s++)
+			{
+				for(size_t c=0; c < m_Enabled.size(); c++)
+				{
+					gpa_uint32 idx = m_Enabled[c] - eCounter_FirstAMD;
+
+					GPA_Type type = GPA_TYPE_UINT64;
+					GPA_GetCounterDataType(idx, &type);
+					GPA_Usage_Type usage = GPA_USAGE_TYPE_ITEMS;
+					GPA_GetCounterUsageType(idx, &usage);
+
+					double scale = usage == GPA_USAGE_TYPE_MILLISECONDS ? 0.001 : 1.0;
+
+					if(type == GPA_TYPE_FLOAT32)
+					{
+						gpa_float32 val = 0.0f;
+						GPA_GetSampleFloat32(m_Session, (gpa_uint32)s, idx, &val);
+						ret.push_back(CounterResult(sampleEvents[s], m_Enabled[c], double(val)*scale));
+					}
+					else if(type == GPA_TYPE_FLOAT64)
+					{
+						gpa_float64 val = 0.0;
+						GPA_GetSampleFloat64(m_Session, (gpa_uint32)s, idx, &val);
+						ret.push_back(CounterResult(sampleEvents[s], m_Enabled[c], double(val)*scale));
+					}
+					else if(type == GPA_TYPE_UINT32)
+					{
+						gpa_uint32 val = 0;
+						GPA_GetSampleUInt32(m_Session, (gpa_uint32)s, idx, &val);
+						ret.push_back(CounterResult(sampleEvents[s], m_Enabled[c], (uint64_t)val));
+					}
+					else
+					{
+						gpa_uint64 val = 0;
+						GPA_GetSampleUInt64(m_Session, (gpa_uint32)s, idx, &val);
+						ret.push_back(CounterResult(sampleEvents[s], m_Enabled[c], (uint64_t)val));
+					}
+				}
+			}
+
+			GPA_DisableAllCounters();
+			m_Enabled.clear();
+
+			return ret;
+		}
+
+	private:
+		AMDPerfAPICounters(HMODULE module)
+			: m_Module(module), m_Initialised(false), m_ContextOpen(false), m_NumCounters(0), m_Session(0) {}
+
+		HMODULE m_Module;
+		bool m_Initialised, m_ContextOpen;
+		gpa_uint32 m_NumCounters;
+		gpa_uint32 m_Session;
+		vector<uint32_t> m_Enabled;
+
+		GPA_InitializePtrType GPA_Initialize;
+		GPA_DestroyPtrType GPA_Destroy;
+		GPA_OpenContextPtrType GPA_OpenContext;
+		GPA_CloseContextPtrType GPA_CloseContext;
+		GPA_GetNumCountersPtrType GPA_GetNumCounters;
+		GPA_GetCounterNamePtrType GPA_GetCounterName;
+		GPA_GetCounterDescriptionPtrType GPA_GetCounterDescription;
+		GPA_GetCounterDataTypePtrType GPA_GetCounterDataType;
+		GPA_GetCounterUsageTypePtrType GPA_GetCounterUsageType;
+		GPA_EnableCounterPtrType GPA_EnableCounter;
+		GPA_DisableAllCountersPtrType GPA_DisableAllCounters;
+		GPA_GetPassCountPtrType GPA_GetPassCount;
+		GPA_BeginSessionPtrType GPA_BeginSession;
+		GPA_EndSessionPtrType GPA_EndSession;
+		GPA_BeginPassPtrType GPA_BeginPass;
+		GPA_EndPassPtrType GPA_EndPass;
+		GPA_BeginSamplePtrType GPA_BeginSample;
+		GPA_EndSamplePtrType GPA_EndSample;
+		GPA_IsSessionReadyPtrType GPA_IsSessionReady;
+		GPA_GetSampleUInt32PtrType GPA_GetSampleUInt32;
+		GPA_GetSampleUInt64PtrType GPA_GetSampleUInt64;
+		GPA_GetSampleFloat32PtrType GPA_GetSampleFloat32;
+		GPA_GetSampleFloat64PtrType GPA_GetSampleFloat64;
+};
+#endif
+
+void D3D11DebugManager::PreDeviceInitCounters()
+{
+}
+
+void D3D11DebugManager::PostDeviceInitCounters()
+{
+	IHardwareCounters *hw = NULL;
+
+#if defined(ENABLE_NVIDIA_PERFKIT)
+	hw = NVPerfKitCounters::Create(m_pDevice);
+	if(hw)
+		m_HardwareCounters.push_back(hw);
+#endif
+
+#if defined(ENABLE_AMD_PERFAPI)
+	hw = AMDPerfAPICounters::Create(m_pDevice);
+	if(hw)
+		m_HardwareCounters.push_back(hw);
 #endif
+
+	(void)hw;
 }
 
 void D3D11DebugManager::PreDeviceShutdownCounters()
 {
+	for(size_t i=0; i < m_HardwareCounters.size(); i++)
+		delete m_HardwareCounters[i];
+	m_HardwareCounters.clear();
 }
 
 void D3D11DebugManager::PostDeviceShutdownCounters()
 {
 }
 
+IHardwareCounters *D3D11DebugManager::GetHardwareCounters(uint32_t counterID)
+{
+	for(size_t i=0; i < m_HardwareCounters.size(); i++)
+		if(m_HardwareCounters[i]->HasCounter(counterID))
+			return m_HardwareCounters[i];
+
+	return NULL;
+}
+
 vector<uint32_t> D3D11DebugManager::EnumerateCounters()
 {
 	vector<uint32_t> ret;
 
 	ret.push_back(eCounter_EventGPUDuration);
+	ret.push_back(eCounter_InputVerticesRead);
+	ret.push_back(eCounter_IAPrimitives);
+	ret.push_back(eCounter_VSInvocations);
+	ret.push_back(eCounter_GSPrimitives);
+	ret.push_back(eCounter_RasterizedPrimitives);
+	ret.push_back(eCounter_PSInvocations);
+	ret.push_back(eCounter_CSInvocations);
+	ret.push_back(eCounter_SamplesWritten);
+
+	for(size_t i=0; i < m_HardwareCounters.size(); i++)
+	{
+		vector<uint32_t> hw = m_HardwareCounters[i]->EnumerateCounters();
+		ret.insert(ret.end(), hw.begin(), hw.end());
+	}
 
 	return ret;
 }
 
 void D3D11DebugManager::DescribeCounter(uint32_t counterID, CounterDescription &desc)
 {
+	IHardwareCounters *hw = GetHardwareCounters(counterID);
+	if(hw)
+	{
+		hw->DescribeCounter(counterID, desc);
+		return;
+	}
+
 	desc.counterID = counterID;
 
-	if(counterID == eCounter_EventGPUDuration)
+	// all counters apart from the duration are 64-bit counts
+	desc.resultByteWidth = 8;
+	desc.resultCompType = eCompType_UInt;
+	desc.units = eUnits_Absolute;
+
+	switch(counterID)
 	{
-		desc.name = "GPU Duration";
-		desc.description = "Time taken for this event on the GPU, as measured by delta between two GPU timestamps.";
-		desc.resultByteWidth = 8;
-		desc.resultCompType = eCompType_Double;
-		desc.units = eUnits_Seconds;
+		case eCounter_EventGPUDuration:
+			desc.name = "GPU Duration";
+			desc.description = "Time taken for this event on the GPU, as measured by delta between two GPU timestamps.";
+			desc.resultCompType = eCompType_Double;
+			desc.units = eUnits_Seconds;
+			break;
+		case eCounter_InputVerticesRead:
+			desc.name = "Input Vertices Read";
+			desc.description = "Number of vertices read by input assembler.";
+			break;
+		case eCounter_IAPrimitives:
+			desc.name = "Input Primitives";
+			desc.description = "Number of primitives read by the input assembler.";
+			break;
+		case eCounter_VSInvocations:
+			desc.name = "VS Invocations";
+			desc.description = "Number of times a vertex shader was invoked.";
+			break;
+		case eCounter_GSPrimitives:
+			desc.name = "GS Primitives";
+			desc.description = "Number of primitives output by a geometry shader.";
+			break;
+		case eCounter_RasterizedPrimitives:
+			desc.name = "Rasterized Primitives";
+			desc.description = "Number of primitives that were sent to the rasterizer.";
+			break;
+		case eCounter_PSInvocations:
+			desc.name = "PS Invocations";
+			desc.description = "Number of times a pixel shader was invoked.";
+			break;
+		case eCounter_CSInvocations:
+			desc.name = "CS Invocations";
+			desc.description = "Number of times a compute shader was invoked.";
+			break;
+		case eCounter_SamplesWritten:
+			desc.name = "Samples Written";
+			desc.description = "Number of samples that passed depth/stencil test.";
+			break;
+		default:
+			desc.name = "Unknown";
+			desc.description = "Unknown counter ID";
+			desc.resultByteWidth = 0;
+			desc.resultCompType = eCompType_None;
+			break;
 	}
-	else
+}
+
+static bool IsPipelineStatistic(uint32_t counterID)
+{
+	switch(counterID)
 	{
-		desc.name = "Unknown";
-		desc.description = "Unknown counter ID";
-		desc.resultByteWidth = 0;
-		desc.resultCompType = eCompType_None;
-		desc.units = eUnits_Absolute;
+		case eCounter_InputVerticesRead:
+		case eCounter_IAPrimitives:
+		case eCounter_VSInvocations:
+		case eCounter_GSPrimitives:
+		case eCounter_RasterizedPrimitives:
+		case eCounter_PSInvocations:
+		case eCounter_CSInvocations:
+			return true;
+		default:
+			break;
 	}
+
+	return false;
 }
 
-struct GPUTimer
+struct GPUQueries
 {
 	ID3D11Query *before;
 	ID3D11Query *after;
+	ID3D11Query *stats;
+	ID3D11Query *occlusion;
 	uint32_t eventID;
+	// set once the queries have been issued around the event's draw
+	bool issued;
+
+	bool operator <(const GPUQueries &o) const { return eventID < o.eventID; }
 };
 
 struct CounterContext
 {
-	uint32_t frameID;
 	uint32_t minEID;
 	uint32_t maxEID;
-	uint32_t eventStart;
-	vector<GPUTimer> timers;
-	int reuseIdx;
+	// which queries are needed, for the counters requested
+	bool timing, stats, occlusion;
+	vector<GPUQueries> queries;
+};
+
+// wraps each draw in its queries as the frame is replayed in one go, so there's no flush
+// or partial replay between draws to distort the results.
+struct CounterCallback : public D3D11DrawcallCallback
+{
+	CounterCallback(ID3D11DeviceContext *context, vector<GPUQueries> &queries)
+		: m_pContext(context), m_Queries(queries), m_Next(0) {}
+
+	bool PreDraw(uint32_t eventID)
+	{
+		// events are replayed in order, and the queries are sorted by event
+		while(m_Next < m_Queries.size() && m_Queries[m_Next].eventID < eventID)
+			m_Next++;
+
+		if(m_Next >= m_Queries.size() || m_Queries[m_Next].eventID != eventID)
+			return false;
+
+		GPUQueries &q = m_Queries[m_Next];
+
+		if(q.stats) m_pContext->Begin(q.stats);
+		if(q.occlusion) m_pContext->Begin(q.occlusion);
+		// keep the timestamps innermost, so the duration only covers the draw itself
+		if(q.before) m_pContext->End(q.before);
+
+		return true;
+	}
+
+	void PostDraw(uint32_t eventID)
+	{
+		GPUQueries &q = m_Queries[m_Next++];
+
+		if(q.after) m_pContext->End(q.after);
+		if(q.occlusion) m_pContext->End(q.occlusion);
+		if(q.stats) m_pContext->End(q.stats);
+
+		q.issued = true;
+	}
+
+	ID3D11DeviceContext *m_pContext;
+	vector<GPUQueries> &m_Queries;
+	size_t m_Next;
 };
 
-void D3D11DebugManager::FillTimers(CounterContext &ctx, const DrawcallTreeNode &drawnode)
+void D3D11DebugManager::FillQueries(CounterContext &ctx, const DrawcallTreeNode &drawnode)
 {
-	const D3D11_QUERY_DESC qdesc = { D3D11_QUERY_TIMESTAMP, 0 };
+	const D3D11_QUERY_DESC timedesc = { D3D11_QUERY_TIMESTAMP, 0 };
+	const D3D11_QUERY_DESC statsdesc = { D3D11_QUERY_PIPELINE_STATISTICS, 0 };
+	const D3D11_QUERY_DESC occldesc = { D3D11_QUERY_OCCLUSION, 0 };
 
 	if(drawnode.children.empty()) return;
 
 	for(size_t i=0; i < drawnode.children.size(); i++)
 	{
 		const FetchDrawcall &d = drawnode.children[i].draw;
-		FillTimers(ctx, drawnode.children[i]);
+		FillQueries(ctx, drawnode.children[i]);
 
 		if(d.events.count == 0) continue;
-
-		GPUTimer *timer = NULL;
 		
+		if(d.eventID < ctx.minEID || d.eventID > ctx.maxEID) continue;
+
 		HRESULT hr = S_OK;
-		
-		bool includeEvent = (d.eventID >= ctx.minEID && d.eventID <= ctx.maxEID);
 
-		if(includeEvent)
-		{
-			if(ctx.reuseIdx == -1)
-			{
-				ctx.timers.push_back(GPUTimer());
+		ctx.queries.push_back(GPUQueries());
 
-				timer = &ctx.timers.back();
-				timer->eventID = d.eventID;
-				timer->before = timer->after = NULL;
+		GPUQueries &queries = ctx.queries.back();
+		queries.eventID = d.eventID;
+		queries.before = queries.after = queries.stats = queries.occlusion = NULL;
+		queries.issued = false;
 
-				hr = m_pDevice->CreateQuery(&qdesc, &timer->before);
-				RDCASSERT(SUCCEEDED(hr));
-				hr = m_pDevice->CreateQuery(&qdesc, &timer->after);
-				RDCASSERT(SUCCEEDED(hr));
-			}
-			else
+		if(ctx.timing)
+		{
+			hr = m_pDevice->CreateQuery(&timedesc, &queries.before);
+			RDCASSERT(SUCCEEDED(hr));
+			hr = m_pDevice->CreateQuery(&timedesc, &queries.after);
+			RDCASSERT(SUCCEEDED(hr));
+
+			// both or neither
+			if(queries.before == NULL || queries.after == NULL)
 			{
-				timer = &ctx.timers[ctx.reuseIdx++];
+				SAFE_RELEASE(queries.before);
+				SAFE_RELEASE(queries.after);
 			}
 		}
 
-		m_WrappedDevice->ReplayLog(ctx.frameID, ctx.eventStart, d.eventID, eReplay_WithoutDraw);
-
-		m_pImmediateContext->Flush();
-		
-		if(includeEvent && timer->before && timer->after)
+		if(ctx.stats)
 		{
-			m_pImmediateContext->End(timer->before);
-			m_WrappedDevice->ReplayLog(ctx.frameID, ctx.eventStart, d.eventID, eReplay_OnlyDraw);
-			m_pImmediateContext->End(timer->after);
+			hr = m_pDevice->CreateQuery(&statsdesc, &queries.stats);
+			RDCASSERT(SUCCEEDED(hr));
 		}
-		else
+
+		if(ctx.occlusion)
 		{
-			m_WrappedDevice->ReplayLog(ctx.frameID, ctx.eventStart, d.eventID, eReplay_OnlyDraw);
+			hr = m_pDevice->CreateQuery(&occldesc, &queries.occlusion);
+			RDCASSERT(SUCCEEDED(hr));
 		}
-		
-		ctx.eventStart = d.eventID+1;
 	}
 }
 
+// the same as CounterCallback, but wrapping each draw in a hardware counter sample
+struct HardwareCounterCallback : public D3D11DrawcallCallback
+{
+	HardwareCounterCallback(IHardwareCounters *hw, const vector<uint32_t> &events)
+		: m_HW(hw), m_Events(events), m_Next(0) {}
+
+	bool PreDraw(uint32_t eventID)
+	{
+		while(m_Next < m_Events.size() && m_Events[m_Next] < eventID)
+			m_Next++;
+
+		if(m_Next >= m_Events.size() || m_Events[m_Next] != eventID)
+			return false;
+
+		m_HW->BeginSample((uint32_t)m_Next);
+		return true;
+	}
+
+	void PostDraw(uint32_t eventID)
+	{
+		m_HW->EndSample((uint32_t)m_Next++);
+	}
+
+	IHardwareCounters *m_HW;
+	const vector<uint32_t> &m_Events;
+	size_t m_Next;
+};
+
+void D3D11DebugManager::FetchHardwareCounters(IHardwareCounters *hw, uint32_t frameID, uint32_t minEventID, uint32_t maxEventID,
+                                              const vector<uint32_t> &counters, vector<CounterResult> &results)
+{
+	// with no queries enabled this just lists the draws in range
+	CounterContext ctx;
+	ctx.minEID = minEventID;
+	ctx.maxEID = maxEventID;
+	ctx.timing = ctx.stats = ctx.occlusion = false;
+	FillQueries(ctx, m_WrappedContext->GetRootDraw());
+
+	vector<uint32_t> events;
+	events.reserve(ctx.queries.size());
+	for(size_t i=0; i < ctx.queries.size(); i++)
+		events.push_back(ctx.queries[i].eventID);
+	std::sort(events.begin(), events.end());
+
+	uint32_t numPasses = hw->BeginSession(counters);
+	if(numPasses == 0)
+	{
+		RDCERR("Couldn't begin hardware counter session");
+		return;
+	}
+
+	SCOPED_TIMER("Fetch %u hardware counters in %u passes", (uint32_t)counters.size(), numPasses);
+
+	// the library picks which counters go in which pass, all that's needed here is to
+	// replay the same draws in every pass
+	for(uint32_t p=0; p < numPasses; p++)
+	{
+		HardwareCounterCallback cb(hw, events);
+
+		hw->BeginPass(p);
+
+		m_WrappedContext->SetDrawcallCallback(&cb);
+		m_WrappedDevice->ReplayLog(frameID, 0, maxEventID, eReplay_Full);
+		m_WrappedContext->SetDrawcallCallback(NULL);
+
+		hw->EndPass(p);
+	}
+
+	vector<CounterResult> hwResults = hw->EndSession(events);
+	results.insert(results.end(), hwResults.begin(), hwResults.end());
+}
+
 vector<CounterResult> D3D11DebugManager::FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters)
 {
 	vector<CounterResult> ret;
@@ -220,18 +811,54 @@ vector<CounterResult> D3D11DebugManager::FetchCounters(uint32_t frameID, uint32_
 		return ret;
 	}
 
-	uint32_t counterID = counters[0];
-	RDCASSERT(counters.size() == 1);
-	RDCASSERT(counterID == eCounter_EventGPUDuration);
+	CounterContext ctx;
+	ctx.minEID = minEventID;
+	ctx.maxEID = maxEventID;
+	ctx.timing = ctx.stats = ctx.occlusion = false;
+
+	// skip any counters we don't know, so the rest can still be fetched
+	vector<uint32_t> fetch;
+	fetch.reserve(counters.size());
+
+	// hardware counters are gathered separately, per library
+	map<IHardwareCounters *, vector<uint32_t> > hwFetch;
+
+	for(size_t c=0; c < counters.size(); c++)
+	{
+		IHardwareCounters *hw = GetHardwareCounters(counters[c]);
+
+		if(hw)
+		{
+			hwFetch[hw].push_back(counters[c]);
+			continue;
+		}
+
+		if(counters[c] == eCounter_EventGPUDuration)
+			ctx.timing = true;
+		else if(counters[c] == eCounter_SamplesWritten)
+			ctx.occlusion = true;
+		else if(IsPipelineStatistic(counters[c]))
+			ctx.stats = true;
+		else
+		{
+			RDCERR("Unsupported counter %u requested", counters[c]);
+			continue;
+		}
+
+		fetch.push_back(counters[c]);
+	}
+
+	for(auto it=hwFetch.begin(); it != hwFetch.end(); ++it)
+		FetchHardwareCounters(it->first, frameID, minEventID, maxEventID, it->second, ret);
+
+	if(fetch.empty())
+		return ret;
 	
-	SCOPED_TIMER("Fetch Counters over %u-%u for %u", minEventID, maxEventID, counterID);
+	SCOPED_TIMER("Fetch %u Counters over %u-%u", (uint32_t)fetch.size(), minEventID, maxEventID);
 
 	D3D11_QUERY_DESC disjointdesc = { D3D11_QUERY_TIMESTAMP_DISJOINT, 0 };
 	ID3D11Query *disjoint = NULL;
 
-	D3D11_QUERY_DESC qdesc = { D3D11_QUERY_TIMESTAMP, 0 };
-	ID3D11Query *start = NULL;
-
 	HRESULT hr = S_OK;
 
 	hr = m_pDevice->CreateQuery(&disjointdesc, &disjoint);
@@ -241,80 +868,115 @@ vector<CounterResult> D3D11DebugManager::FetchCounters(uint32_t frameID, uint32_
 		return ret;
 	}
 
-	hr = m_pDevice->CreateQuery(&qdesc, &start);
-	if(FAILED(hr))
+	// create every query up front, so nothing is allocated while the frame replays
+	FillQueries(ctx, m_WrappedContext->GetRootDraw());
+	std::sort(ctx.queries.begin(), ctx.queries.end());
+
 	{
-		RDCERR("Failed to create start query %08x", hr);
-		return ret;
-	}
+		CounterCallback cb(m_pImmediateContext, ctx.queries);
 
-	CounterContext ctx;
-	ctx.frameID = frameID;
-	ctx.minEID = minEventID;
-	ctx.maxEID = maxEventID;
+		m_pImmediateContext->Begin(disjoint);
+
+		m_WrappedContext->SetDrawcallCallback(&cb);
+		m_WrappedDevice->ReplayLog(frameID, 0, maxEventID, eReplay_Full);
+		m_WrappedContext->SetDrawcallCallback(NULL);
+
+		m_pImmediateContext->End(disjoint);
+	}
 
-	for(int loop=0; loop < 1; loop++)
 	{
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
+		do
 		{
-			m_pImmediateContext->Begin(disjoint);
+			hr = m_pImmediateContext->GetData(disjoint, &disjointData, sizeof(D3D11_QUERY_DATA_TIMESTAMP_DISJOINT), 0);
+		} while(hr == S_FALSE);
+		RDCASSERT(hr == S_OK);
 
-			m_pImmediateContext->End(start);
-			
-			ctx.eventStart = 0;
-			ctx.reuseIdx = loop == 0 ? -1 : 0;
-			FillTimers(ctx, m_WrappedContext->GetRootDraw());
+		RDCASSERT(!disjointData.Disjoint);
 
-			m_pImmediateContext->End(disjoint);
-		}
+		double ticksToSecs = double(disjointData.Frequency);
 
+		ret.reserve(ret.size() + ctx.queries.size()*fetch.size());
+
+		for(size_t i=0; i < ctx.queries.size(); i++)
 		{
-			D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
-			do
+			const GPUQueries &q = ctx.queries[i];
+
+			// draws that weren't executed as their own event, like those inside command
+			// lists, have nothing to read back and their counters are reported as 0.
+			bool issued = q.issued;
+
+			double duration = 0.0;
+
+			if(issued && q.before && q.after)
 			{
-				hr = m_pImmediateContext->GetData(disjoint, &disjointData, sizeof(D3D11_QUERY_DATA_TIMESTAMP_DISJOINT), 0);
-			} while(hr == S_FALSE);
-			RDCASSERT(hr == S_OK);
+				UINT64 a=0;
+				hr = m_pImmediateContext->GetData(q.before, &a, sizeof(UINT64), 0);
+				RDCASSERT(hr == S_OK);
 
-			RDCASSERT(!disjointData.Disjoint);
+				UINT64 b=0;
+				hr = m_pImmediateContext->GetData(q.after, &b, sizeof(UINT64), 0);
+				RDCASSERT(hr == S_OK);
 
-			double ticksToSecs = double(disjointData.Frequency);
+				duration = (double(b-a)/ticksToSecs);
+			}
 
-			UINT64 a=0;
-			m_pImmediateContext->GetData(start, &a, sizeof(UINT64), 0);
+			D3D11_QUERY_DATA_PIPELINE_STATISTICS stats;
+			RDCEraseEl(stats);
 
-			for(size_t i=0; i < ctx.timers.size(); i++)
+			if(issued && q.stats)
 			{
-				if(ctx.timers[i].before && ctx.timers[i].after)
+				do
 				{
-					hr = m_pImmediateContext->GetData(ctx.timers[i].before, &a, sizeof(UINT64), 0);
-					RDCASSERT(hr == S_OK);
+					hr = m_pImmediateContext->GetData(q.stats, &stats, sizeof(D3D11_QUERY_DATA_PIPELINE_STATISTICS), 0);
+				} while(hr == S_FALSE);
+				RDCASSERT(hr == S_OK);
+			}
 
-					UINT64 b=0;
-					hr = m_pImmediateContext->GetData(ctx.timers[i].after, &b, sizeof(UINT64), 0);
-					RDCASSERT(hr == S_OK);
+			UINT64 samples = 0;
 
-					double duration = (double(b-a)/ticksToSecs);
+			if(issued && q.occlusion)
+			{
+				do
+				{
+					hr = m_pImmediateContext->GetData(q.occlusion, &samples, sizeof(UINT64), 0);
+				} while(hr == S_FALSE);
+				RDCASSERT(hr == S_OK);
+			}
 
-					ret.push_back(CounterResult(ctx.timers[i].eventID, counterID, duration));
+			for(size_t c=0; c < fetch.size(); c++)
+			{
+				uint64_t val = 0;
 
-					a = b;
-				}
-				else
+				switch(fetch[c])
 				{
-					ret.push_back(CounterResult(ctx.timers[i].eventID, counterID, 0.0));
+					case eCounter_EventGPUDuration:
+						ret.push_back(CounterResult(q.eventID, fetch[c], duration));
+						continue;
+					case eCounter_InputVerticesRead:     val = stats.IAVertices; break;
+					case eCounter_IAPrimitives:          val = stats.IAPrimitives; break;
+					case eCounter_VSInvocations:         val = stats.VSInvocations; break;
+					case eCounter_GSPrimitives:          val = stats.GSPrimitives; break;
+					case eCounter_RasterizedPrimitives:  val = stats.CPrimitives; break;
+					case eCounter_PSInvocations:         val = stats.PSInvocations; break;
+					case eCounter_CSInvocations:         val = stats.CSInvocations; break;
+					case eCounter_SamplesWritten:        val = samples; break;
 				}
+
+				ret.push_back(CounterResult(q.eventID, fetch[c], val));
 			}
 		}
 	}
 
-	for(size_t i=0; i < ctx.timers.size(); i++)
+	for(size_t i=0; i < ctx.queries.size(); i++)
 	{
-		SAFE_RELEASE(ctx.timers[i].before);
-		SAFE_RELEASE(ctx.timers[i].after);
+		SAFE_RELEASE(ctx.queries[i].before);
+		SAFE_RELEASE(ctx.queries[i].after);
+		SAFE_RELEASE(ctx.queries[i].stats);
+		SAFE_RELEASE(ctx.queries[i].occlusion);
 	}
 
 	SAFE_RELEASE(disjoint);
-	SAFE_RELEASE(start);
 	
 	return ret;
-}
\ No newline at end of file
+}
@@ -106,6 +106,14 @@ D3D11DebugManager::D3D11DebugManager(WrappedID3D11Device *wrapper)
 
 	m_OutputWindowID = 1;
 
+	m_TexturePoolCounter = 0;
+
+	m_PreviewGeneration = 0;
+
+	m_GlobalStateCache.valid = false;
+
+	m_PostVSUseCounter = 0;
+
 	m_supersamplingX = 1.0f;
 	m_supersamplingY = 1.0f;
 
@@ -266,19 +274,62 @@ D3D11DebugManager::D3D11DebugManager(WrappedID3D11Device *wrapper)
 		fclose(f);
 	}
 
-	m_CacheShaders = true;
+	m_CustomShaderTex = NULL;
+	m_CustomShaderRTV = NULL;
+	m_CustomShaderResourceId = ResourceId();
+	
+	m_OverlayRenderTex = NULL;
+	m_OverlayResourceId = ResourceId();
 
-	InitStreamOut();
-	InitDebugRendering();
-	InitFontRendering();
+	RDCEraseEl(m_QuadOverdraw);
 
-	m_CacheShaders = false;
+	m_OverlayCacheBytes = 0;
+
+	m_DebugRenderingInit = m_StreamOutInit = m_FontRenderingInit = false;
+
+	if(RenderDoc::Inst().IsHeadlessReplay())
+	{
+		RDCLOG("Headless replay, deferring debug rendering initialisation");
+	}
+	else
+	{
+		EnsureStreamOut();
+		EnsureDebugRendering();
+		EnsureFontRendering();
+	}
 
 	PostDeviceInitCounters();
 	
 	RenderDoc::Inst().SetProgress(DebugManagerInit, 1.0f);
 }
 
+static void ReleasePostVSData(PostVSData &data)
+{
+	SAFE_RELEASE(data.vsout.buf);
+	SAFE_RELEASE(data.vsout.idxBuf);
+	SAFE_RELEASE(data.gsout.buf);
+	SAFE_RELEASE(data.gsout.idxBuf);
+}
+
+static uint64_t PostVSDataSize(const PostVSData &data)
+{
+	ID3D11Buffer *bufs[] = { data.vsout.buf, data.vsout.idxBuf, data.gsout.buf, data.gsout.idxBuf };
+
+	uint64_t ret = 0;
+
+	for(size_t i=0; i < ARRAY_COUNT(bufs); i++)
+	{
+		if(bufs[i])
+		{
+			D3D11_BUFFER_DESC desc;
+			bufs[i]->GetDesc(&desc);
+			ret += desc.ByteWidth;
+		}
+	}
+
+	return ret;
+}
+
 D3D11DebugManager::~D3D11DebugManager()
 {
 	PreDeviceShutdownCounters();
@@ -324,6 +375,12 @@ D3D11DebugManager::~D3D11DebugManager()
 	if(m_OverlayResourceId != ResourceId())
 		SAFE_RELEASE(m_OverlayRenderTex);
 
+	SAFE_RELEASE(m_QuadOverdraw.tex);
+	SAFE_RELEASE(m_QuadOverdraw.srv);
+	SAFE_RELEASE(m_QuadOverdraw.uav);
+
+	ClearOverlayCache();
+
 	SAFE_RELEASE(m_CustomShaderRTV);
 	
 	if(m_CustomShaderResourceId != ResourceId())
@@ -338,15 +395,32 @@ D3D11DebugManager::~D3D11DebugManager()
 		m_ShaderItemCache.pop_back();
 	}
 
-	for(auto it=m_PostVSData.begin(); it != m_PostVSData.end(); ++it)
+	for(auto it=m_TexturePreviews.begin(); it != m_TexturePreviews.end(); ++it)
+		it->Release();
+	m_TexturePreviews.clear();
+
+	for(size_t i=0; i < m_TexturePool.size(); i++)
 	{
-		SAFE_RELEASE(it->second.vsout.buf);
-		SAFE_RELEASE(it->second.vsout.idxBuf);
-		SAFE_RELEASE(it->second.gsout.buf);
-		SAFE_RELEASE(it->second.gsout.idxBuf);
+		RDCASSERT(!m_TexturePool[i].inUse);
+		SAFE_RELEASE(m_TexturePool[i].tex);
 	}
+	m_TexturePool.clear();
+
+	for(auto it=m_PostVSData.begin(); it != m_PostVSData.end(); ++it)
+		ReleasePostVSData(it->second);
 
 	m_PostVSData.clear();
+
+	for(auto it=m_DebugSampleVS.begin(); it != m_DebugSampleVS.end(); ++it)
+		SAFE_RELEASE(it->second);
+	for(auto it=m_DebugSamplePS.begin(); it != m_DebugSamplePS.end(); ++it)
+		SAFE_RELEASE(it->second);
+	for(auto it=m_DebugSampleTargets.begin(); it != m_DebugSampleTargets.end(); ++it)
+	{
+		SAFE_RELEASE(it->second.tex);
+		SAFE_RELEASE(it->second.readback);
+		SAFE_RELEASE(it->second.rtv);
+	}
 	
 	SAFE_RELEASE(m_WrappedContext);
 	m_WrappedDevice->InternalRelease();
@@ -684,6 +758,96 @@ void D3D11DebugManager::BuildShader(string source, string entry, const uint32_t
 	*id = ResourceId();
 }
 
+ID3D11VertexShader *D3D11DebugManager::GetDebugSampleVS(const string &source)
+{
+	auto it = m_DebugSampleVS.find(source);
+	if(it != m_DebugSampleVS.end())
+		return it->second;
+
+	// failures are cached too, so a broken shader isn't recompiled for every sample
+	ID3D11VertexShader *vs = MakeVShader(source.c_str(), "main", "vs_5_0");
+	m_DebugSampleVS[source] = vs;
+	return vs;
+}
+
+ID3D11PixelShader *D3D11DebugManager::GetDebugSamplePS(const string &source)
+{
+	auto it = m_DebugSamplePS.find(source);
+	if(it != m_DebugSamplePS.end())
+		return it->second;
+
+	ID3D11PixelShader *ps = MakePShader(source.c_str(), "main", "ps_5_0");
+	m_DebugSamplePS[source] = ps;
+	return ps;
+}
+
+bool D3D11DebugManager::GetDebugSampleTarget(DXGI_FORMAT fmt, DebugSampleTarget &target)
+{
+	auto it = m_DebugSampleTargets.find(fmt);
+	if(it != m_DebugSampleTargets.end())
+	{
+		target = it->second;
+		return true;
+	}
+
+	D3D11_TEXTURE2D_DESC tdesc;
+
+	tdesc.ArraySize = 1;
+	tdesc.BindFlags = D3D11_BIND_RENDER_TARGET;
+	tdesc.CPUAccessFlags = 0;
+	tdesc.Format = fmt;
+	tdesc.Width = 1;
+	tdesc.Height = 1;
+	tdesc.MipLevels = 0;
+	tdesc.MiscFlags = 0;
+	tdesc.SampleDesc.Count = 1;
+	tdesc.SampleDesc.Quality = 0;
+	tdesc.Usage = D3D11_USAGE_DEFAULT;
+
+	DebugSampleTarget ret;
+
+	HRESULT hr = m_pDevice->CreateTexture2D(&tdesc, NULL, &ret.tex);
+
+	if(FAILED(hr))
+	{
+		RDCERR("Failed to create RT tex %08x", hr);
+		return false;
+	}
+
+	tdesc.BindFlags = 0;
+	tdesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+	tdesc.Usage = D3D11_USAGE_STAGING;
+
+	hr = m_pDevice->CreateTexture2D(&tdesc, NULL, &ret.readback);
+
+	if(FAILED(hr))
+	{
+		RDCERR("Failed to create copy tex %08x", hr);
+		SAFE_RELEASE(ret.tex);
+		return false;
+	}
+
+	D3D11_RENDER_TARGET_VIEW_DESC rtDesc;
+
+	rtDesc.Format = fmt;
+	rtDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
+	rtDesc.Texture2D.MipSlice = 0;
+
+	hr = m_pDevice->CreateRenderTargetView(ret.tex, &rtDesc, &ret.rtv);
+
+	if(FAILED(hr))
+	{
+		RDCERR("Failed to create rt rtv %08x", hr);
+		SAFE_RELEASE(ret.tex);
+		SAFE_RELEASE(ret.readback);
+		return false;
+	}
+
+	m_DebugSampleTargets[fmt] = ret;
+	target = ret;
+	return true;
+}
+
 ID3D11Buffer *D3D11DebugManager::MakeCBuffer(UINT size)
 {
 	D3D11_BUFFER_DESC bufDesc;
@@ -708,6 +872,163 @@ ID3D11Buffer *D3D11DebugManager::MakeCBuffer(UINT size)
 	return ret;
 }
 
+D3D11DebugManager::PooledTexture *D3D11DebugManager::FindPooledTexture(D3D11_RESOURCE_DIMENSION dim, const void *desc, size_t descSize)
+{
+	for(size_t i=0; i < m_TexturePool.size(); i++)
+	{
+		PooledTexture &p = m_TexturePool[i];
+
+		// descs are always fully filled out from GetDesc(), so comparing the bytes is safe
+		if(!p.inUse && p.dim == dim && !memcmp(&p.desc1D, desc, descSize))
+		{
+			p.inUse = true;
+			p.lastUse = ++m_TexturePoolCounter;
+			return &p;
+		}
+	}
+
+	return NULL;
+}
+
+void D3D11DebugManager::AddPooledTexture(ID3D11Resource *tex, D3D11_RESOURCE_DIMENSION dim, const void *desc, size_t descSize, uint64_t size)
+{
+	PooledTexture p;
+	RDCEraseEl(p);
+	p.tex = tex;
+	p.dim = dim;
+	memcpy(&p.desc1D, desc, descSize);
+	p.size = size;
+	p.lastUse = ++m_TexturePoolCounter;
+	p.inUse = true;
+
+	m_TexturePool.push_back(p);
+}
+
+HRESULT D3D11DebugManager::GetPooledTexture(const D3D11_TEXTURE1D_DESC &desc, ID3D11Texture1D **tex)
+{
+	PooledTexture *p = FindPooledTexture(D3D11_RESOURCE_DIMENSION_TEXTURE1D, &desc, sizeof(desc));
+	if(p)
+	{
+		*tex = (ID3D11Texture1D *)p->tex;
+		return S_OK;
+	}
+
+	HRESULT hr = m_pDevice->CreateTexture1D(&desc, NULL, tex);
+	if(FAILED(hr))
+	{
+		*tex = NULL;
+		return hr;
+	}
+
+	uint64_t size = 0;
+	for(UINT m=0; m < RDCMAX(1U, desc.MipLevels); m++)
+		size += GetByteSize(desc.Width, 1, 1, desc.Format, m);
+	size *= desc.ArraySize;
+
+	AddPooledTexture(*tex, D3D11_RESOURCE_DIMENSION_TEXTURE1D, &desc, sizeof(desc), size);
+
+	return hr;
+}
+
+HRESULT D3D11DebugManager::GetPooledTexture(const D3D11_TEXTURE2D_DESC &desc, ID3D11Texture2D **tex)
+{
+	PooledTexture *p = FindPooledTexture(D3D11_RESOURCE_DIMENSION_TEXTURE2D, &desc, sizeof(desc));
+	if(p)
+	{
+		*tex = (ID3D11Texture2D *)p->tex;
+		return S_OK;
+	}
+
+	HRESULT hr = m_pDevice->CreateTexture2D(&desc, NULL, tex);
+	if(FAILED(hr))
+	{
+		*tex = NULL;
+		return hr;
+	}
+
+	uint64_t size = 0;
+	for(UINT m=0; m < RDCMAX(1U, desc.MipLevels); m++)
+		size += GetByteSize(desc.Width, desc.Height, 1, desc.Format, m);
+	size *= desc.ArraySize*RDCMAX(1U, desc.SampleDesc.Count);
+
+	AddPooledTexture(*tex, D3D11_RESOURCE_DIMENSION_TEXTURE2D, &desc, sizeof(desc), size);
+
+	return hr;
+}
+
+HRESULT D3D11DebugManager::GetPooledTexture(const D3D11_TEXTURE3D_DESC &desc, ID3D11Texture3D **tex)
+{
+	PooledTexture *p = FindPooledTexture(D3D11_RESOURCE_DIMENSION_TEXTURE3D, &desc, sizeof(desc));
+	if(p)
+	{
+		*tex = (ID3D11Texture3D *)p->tex;
+		return S_OK;
+	}
+
+	HRESULT hr = m_pDevice->CreateTexture3D(&desc, NULL, tex);
+	if(FAILED(hr))
+	{
+		*tex = NULL;
+		return hr;
+	}
+
+	uint64_t size = 0;
+	for(UINT m=0; m < RDCMAX(1U, desc.MipLevels); m++)
+		size += GetByteSize(desc.Width, desc.Height, desc.Depth, desc.Format, m);
+
+	AddPooledTexture(*tex, D3D11_RESOURCE_DIMENSION_TEXTURE3D, &desc, sizeof(desc), size);
+
+	return hr;
+}
+
+void D3D11DebugManager::ReturnPooledTexture(ID3D11Resource *tex)
+{
+	if(tex == NULL)
+		return;
+
+	for(size_t i=0; i < m_TexturePool.size(); i++)
+	{
+		if(m_TexturePool[i].tex == tex)
+		{
+			RDCASSERT(m_TexturePool[i].inUse);
+			m_TexturePool[i].inUse = false;
+			TrimTexturePool(TexturePoolBudget);
+			return;
+		}
+	}
+
+	RDCERR("Returning texture %p that didn't come from the pool", tex);
+}
+
+void D3D11DebugManager::TrimTexturePool(uint64_t budget)
+{
+	uint64_t idleSize = 0;
+	for(size_t i=0; i < m_TexturePool.size(); i++)
+		if(!m_TexturePool[i].inUse)
+			idleSize += m_TexturePool[i].size;
+
+	// free the least recently used idle textures until we're under budget
+	while(idleSize > budget)
+	{
+		size_t oldest = m_TexturePool.size();
+		for(size_t i=0; i < m_TexturePool.size(); i++)
+		{
+			if(m_TexturePool[i].inUse)
+				continue;
+
+			if(oldest == m_TexturePool.size() || m_TexturePool[i].lastUse < m_TexturePool[oldest].lastUse)
+				oldest = i;
+		}
+
+		if(oldest == m_TexturePool.size())
+			break;
+
+		idleSize -= m_TexturePool[oldest].size;
+		SAFE_RELEASE(m_TexturePool[oldest].tex);
+		m_TexturePool.erase(m_TexturePool.begin()+oldest);
+	}
+}
+
 void D3D11DebugManager::FillCBuffer(ID3D11Buffer *buf, float *data, size_t size)
 {
 	D3D11_MAPPED_SUBRESOURCE mapped;
@@ -736,18 +1057,120 @@ ID3D11Buffer *D3D11DebugManager::MakeCBuffer(float *data, size_t size)
 	return m_DebugRender.PublicCBuffers[idx];
 }
 
+D3D11DebugManager::DebugCBuffer D3D11DebugManager::UploadCBuffer(ID3D11Buffer *fallback, const void *data, size_t size)
+{
+	DebugCBuffer ret;
+
+	// offsets and sizes are in constants, and must be multiples of 16 constants (256 bytes)
+	UINT alignedSize = AlignUp((UINT)size, 256U);
+
+	if(m_DebugRender.CBufferRing == NULL || alignedSize > D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT*16)
+	{
+		FillCBuffer(fallback, (float *)data, size);
+		ret.buf = fallback;
+		return ret;
+	}
+
+	D3D11_MAP mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+
+	if(m_DebugRender.cbufferRingOffset + alignedSize > m_DebugRender.CBufferRingSize)
+	{
+		mapType = D3D11_MAP_WRITE_DISCARD;
+		m_DebugRender.cbufferRingOffset = 0;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE mapped;
+	HRESULT hr = m_pImmediateContext->Map(m_DebugRender.CBufferRing, 0, mapType, 0, &mapped);
+
+	if(FAILED(hr))
+	{
+		RDCERR("Can't map cbuffer ring %08x", hr);
+		FillCBuffer(fallback, (float *)data, size);
+		ret.buf = fallback;
+		return ret;
+	}
+
+	memcpy((byte *)mapped.pData + m_DebugRender.cbufferRingOffset, data, size);
+	m_pImmediateContext->Unmap(m_DebugRender.CBufferRing, 0);
+
+	ret.buf = m_DebugRender.CBufferRing;
+	ret.firstConstant = m_DebugRender.cbufferRingOffset/16;
+	ret.numConstants = alignedSize/16;
+
+	m_DebugRender.cbufferRingOffset += alignedSize;
+
+	return ret;
+}
+
+void D3D11DebugManager::SetCBuffer(ShaderStageType stage, UINT slot, const DebugCBuffer &cb)
+{
+	if(cb.numConstants == 0)
+	{
+		switch(stage)
+		{
+			case eShaderStage_Vertex: m_pImmediateContext->VSSetConstantBuffers(slot, 1, &cb.buf); break;
+			case eShaderStage_Hull: m_pImmediateContext->HSSetConstantBuffers(slot, 1, &cb.buf); break;
+			case eShaderStage_Domain: m_pImmediateContext->DSSetConstantBuffers(slot, 1, &cb.buf); break;
+			case eShaderStage_Geometry: m_pImmediateContext->GSSetConstantBuffers(slot, 1, &cb.buf); break;
+			case eShaderStage_Pixel: m_pImmediateContext->PSSetConstantBuffers(slot, 1, &cb.buf); break;
+			case eShaderStage_Compute: m_pImmediateContext->CSSetConstantBuffers(slot, 1, &cb.buf); break;
+			default: RDCERR("Unexpected shader stage %d", stage); break;
+		}
+		return;
+	}
+
+	ID3D11DeviceContext1 *ctx = m_DebugRender.ImmediateContext1;
+
+	switch(stage)
+	{
+		case eShaderStage_Vertex: ctx->VSSetConstantBuffers1(slot, 1, &cb.buf, &cb.firstConstant, &cb.numConstants); break;
+		case eShaderStage_Hull: ctx->HSSetConstantBuffers1(slot, 1, &cb.buf, &cb.firstConstant, &cb.numConstants); break;
+		case eShaderStage_Domain: ctx->DSSetConstantBuffers1(slot, 1, &cb.buf, &cb.firstConstant, &cb.numConstants); break;
+		case eShaderStage_Geometry: ctx->GSSetConstantBuffers1(slot, 1, &cb.buf, &cb.firstConstant, &cb.numConstants); break;
+		case eShaderStage_Pixel: ctx->PSSetConstantBuffers1(slot, 1, &cb.buf, &cb.firstConstant, &cb.numConstants); break;
+		case eShaderStage_Compute: ctx->CSSetConstantBuffers1(slot, 1, &cb.buf, &cb.firstConstant, &cb.numConstants); break;
+		default: RDCERR("Unexpected shader stage %d", stage); break;
+	}
+}
+
 #include "data/hlsl/debugcbuffers.h"
 
+void D3D11DebugManager::EnsureDebugRendering()
+{
+	if(m_DebugRenderingInit) return;
+
+	m_DebugRenderingInit = true;
+
+	m_CacheShaders = true;
+	InitDebugRendering();
+	m_CacheShaders = false;
+}
+
+void D3D11DebugManager::EnsureStreamOut()
+{
+	if(m_StreamOutInit) return;
+
+	m_StreamOutInit = true;
+
+	m_CacheShaders = true;
+	InitStreamOut();
+	m_CacheShaders = false;
+}
+
+void D3D11DebugManager::EnsureFontRendering()
+{
+	if(m_FontRenderingInit) return;
+
+	m_FontRenderingInit = true;
+
+	m_CacheShaders = true;
+	InitFontRendering();
+	m_CacheShaders = false;
+}
+
 bool D3D11DebugManager::InitDebugRendering()
 {
 	HRESULT hr = S_OK;
-	
-	m_CustomShaderTex = NULL;
-	m_CustomShaderRTV = NULL;
-	m_CustomShaderResourceId = ResourceId();
-	
-	m_OverlayRenderTex = NULL;
-	m_OverlayResourceId = ResourceId();
 
 	m_DebugRender.GenericVSCBuffer = MakeCBuffer(sizeof(DebugVertexCBuffer));
 	m_DebugRender.GenericGSCBuffer = MakeCBuffer(sizeof(DebugGeometryCBuffer));
@@ -757,6 +1180,30 @@ bool D3D11DebugManager::InitDebugRendering()
 		m_DebugRender.PublicCBuffers[i] = MakeCBuffer(sizeof(float)*4 * 100);
 
 	m_DebugRender.publicCBufIdx = 0;
+
+	{
+		D3D11_FEATURE_DATA_D3D11_OPTIONS opts;
+		RDCEraseEl(opts);
+
+		hr = m_pDevice->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &opts, sizeof(opts));
+
+		if(SUCCEEDED(hr) && opts.ConstantBufferOffsetting && opts.MapNoOverwriteOnDynamicConstantBuffer)
+			m_pImmediateContext->QueryInterface(__uuidof(ID3D11DeviceContext1), (void **)&m_DebugRender.ImmediateContext1);
+
+		if(m_DebugRender.ImmediateContext1)
+		{
+			m_DebugRender.CBufferRing = MakeCBuffer(m_DebugRender.CBufferRingSize);
+
+			if(m_DebugRender.CBufferRing == NULL)
+				SAFE_RELEASE(m_DebugRender.ImmediateContext1);
+		}
+
+		// start 'full' so the first upload discards
+		m_DebugRender.cbufferRingOffset = m_DebugRender.CBufferRingSize;
+
+		if(m_DebugRender.CBufferRing == NULL)
+			RDCDEBUG("Constant buffer offsetting not available, using a buffer per debug draw");
+	}
 	
 	string multisamplehlsl = GetEmbeddedResource(multisample_hlsl);
 
@@ -766,6 +1213,8 @@ bool D3D11DebugManager::InitDebugRendering()
 	m_DebugRender.FloatCopyArrayToMSPS = MakePShader(multisamplehlsl.c_str(), "RENDERDOC_FloatCopyArrayToMS", "ps_5_0");
 	m_DebugRender.DepthCopyMSToArrayPS = MakePShader(multisamplehlsl.c_str(), "RENDERDOC_DepthCopyMSToArray", "ps_5_0");
 	m_DebugRender.DepthCopyArrayToMSPS = MakePShader(multisamplehlsl.c_str(), "RENDERDOC_DepthCopyArrayToMS", "ps_5_0");
+	m_DebugRender.CopyMSToArrayCS = MakeCShader(multisamplehlsl.c_str(), "RENDERDOC_CopyMSToArrayCS", "cs_5_0");
+	m_DebugRender.FloatCopyMSToArrayCS = MakeCShader(multisamplehlsl.c_str(), "RENDERDOC_FloatCopyMSToArrayCS", "cs_5_0");
 	
 	string displayhlsl = GetEmbeddedResource(debugcbuffers_h);
 	displayhlsl += GetEmbeddedResource(debugcommon_hlsl);
@@ -1243,6 +1692,9 @@ void D3D11DebugManager::ShutdownFontRendering()
 
 void D3D11DebugManager::ShutdownStreamOut()
 {
+	if(!m_StreamOutInit)
+		return;
+
 	SAFE_RELEASE(m_SOBuffer);
 	SAFE_RELEASE(m_SOStatsQuery);
 	SAFE_RELEASE(m_SOStagingBuffer);
@@ -1256,6 +1708,9 @@ void D3D11DebugManager::ShutdownStreamOut()
 	SAFE_RELEASE(m_MeshDisplayLayout);
 	SAFE_RELEASE(m_PostMeshDisplayLayout);
 
+	SAFE_RELEASE(m_SecondaryArenaVB);
+	SAFE_RELEASE(m_SecondaryArenaIB);
+
 	SAFE_RELEASE(m_FrustumHelper);
 	SAFE_RELEASE(m_AxisHelper);
 	SAFE_RELEASE(m_TriHighlightHelper);
@@ -1266,6 +1721,9 @@ bool D3D11DebugManager::InitStreamOut()
 	m_MeshDisplayLayout = NULL;
 	m_PostMeshDisplayLayout = NULL;
 
+	m_SecondaryArenaVB = NULL;
+	m_SecondaryArenaIB = NULL;
+
 	D3D11_BUFFER_DESC bufferDesc =
 	{
 		m_SOBufferSize,
@@ -1443,53 +1901,29 @@ bool D3D11DebugManager::InitFontRendering()
 	HRESULT hr = S_OK;
 
 	{
-		D3D11_SUBRESOURCE_DATA initialPos;
-
-		float *buf = new float[(2 + FONT_MAX_CHARS*4) *3];
-		
-		// tri strip with degenerates to split characters:
+		// a single glyph quad as a tri strip, instanced once per character
 		//
-		// 0--24--68--..
-		// | /|| /|| /
-		// |/ ||/ ||/
-		// 1--35--79--..
-
-		buf[0] = 0.0f;
-		buf[1] = 0.0f;
-		buf[2] = 0.0f;
-
-		buf[3] = 0.0f;
-		buf[4] = 1.0f;
-		buf[5] = 0.0f;
-
-		for(int i=1; i <= FONT_MAX_CHARS; i++)
-		{
-			buf[i*12 - 6 + 0] = 1.0f;
-			buf[i*12 - 6 + 1] = 0.0f;
-			buf[i*12 - 6 + 2] = float(i-1);
-
-			buf[i*12 - 6 + 3] = 1.0f;
-			buf[i*12 - 6 + 4] = 1.0f;
-			buf[i*12 - 6 + 5] = float(i-1);
-
-
-			buf[i*12 + 0 + 0] = 0.0f;
-			buf[i*12 + 0 + 1] = 0.0f;
-			buf[i*12 + 0 + 2] = float(i);
+		// 0--2
+		// | /|
+		// |/ |
+		// 1--3
+		float quad[] = {
+			0.0f, 0.0f,
+			0.0f, 1.0f,
+			1.0f, 0.0f,
+			1.0f, 1.0f,
+		};
 
-			buf[i*12 + 0 + 3] = 0.0f;
-			buf[i*12 + 0 + 4] = 1.0f;
-			buf[i*12 + 0 + 5] = float(i);
-		}
+		D3D11_SUBRESOURCE_DATA initialPos;
 
-		initialPos.pSysMem = buf;
+		initialPos.pSysMem = quad;
 		initialPos.SysMemPitch = initialPos.SysMemSlicePitch = 0;
 		
 		D3D11_BUFFER_DESC bufDesc;
 		
 		bufDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		bufDesc.Usage = D3D11_USAGE_DEFAULT;
-		bufDesc.ByteWidth = (2 + FONT_MAX_CHARS*4) *3*sizeof(float);
+		bufDesc.Usage = D3D11_USAGE_IMMUTABLE;
+		bufDesc.ByteWidth = sizeof(quad);
 		bufDesc.CPUAccessFlags = 0;
 		bufDesc.MiscFlags = 0;
 		
@@ -1499,8 +1933,6 @@ bool D3D11DebugManager::InitFontRendering()
 		{
 			RDCERR("Failed to create font pos buffer %08x", hr);
 		}
-
-		delete[] buf;
 	}
 	
 	D3D11_TEXTURE2D_DESC desc;
@@ -1592,7 +2024,7 @@ bool D3D11DebugManager::InitFontRendering()
 	bufDesc.MiscFlags = 0;
 	bufDesc.Usage = D3D11_USAGE_DYNAMIC;
 	bufDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-	bufDesc.ByteWidth = 2+FONT_MAX_CHARS*4*sizeof(uint32_t);
+	bufDesc.ByteWidth = FONT_MAX_BATCH_CHARS*sizeof(FontChar);
 	
 	hr = m_pDevice->CreateBuffer(&bufDesc, NULL, &m_Font.CharBuffer);
 
@@ -1607,25 +2039,33 @@ bool D3D11DebugManager::InitFontRendering()
 		fullhlsl = debugShaderCBuf + textShaderHLSL;
 	}
 
-	D3D11_INPUT_ELEMENT_DESC inputDescs[2];
+	D3D11_INPUT_ELEMENT_DESC inputDescs[3];
 
 	inputDescs[0].SemanticName = "POSITION";
 	inputDescs[0].SemanticIndex = 0;
-	inputDescs[0].Format = DXGI_FORMAT_R32G32B32_FLOAT;
+	inputDescs[0].Format = DXGI_FORMAT_R32G32_FLOAT;
 	inputDescs[0].InputSlot = 0;
 	inputDescs[0].InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
 	inputDescs[0].AlignedByteOffset = 0;
 	inputDescs[0].InstanceDataStepRate = 0;
 
-	inputDescs[1].SemanticName = "GLYPHIDX";
+	inputDescs[1].SemanticName = "CHARPOS";
 	inputDescs[1].SemanticIndex = 0;
-	inputDescs[1].Format = DXGI_FORMAT_R32_UINT;
+	inputDescs[1].Format = DXGI_FORMAT_R32G32_FLOAT;
 	inputDescs[1].InputSlot = 1;
-	inputDescs[1].InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
-	inputDescs[1].AlignedByteOffset = 0;
-	inputDescs[1].InstanceDataStepRate = 0;
-	
-	m_Font.VS = MakeVShader(fullhlsl.c_str(), "RENDERDOC_TextVS", "vs_4_0", 2, inputDescs, &m_Font.Layout);
+	inputDescs[1].InputSlotClass = D3D11_INPUT_PER_INSTANCE_DATA;
+	inputDescs[1].AlignedByteOffset = offsetof(FontChar, x);
+	inputDescs[1].InstanceDataStepRate = 1;
+
+	inputDescs[2].SemanticName = "GLYPHIDX";
+	inputDescs[2].SemanticIndex = 0;
+	inputDescs[2].Format = DXGI_FORMAT_R32_UINT;
+	inputDescs[2].InputSlot = 1;
+	inputDescs[2].InputSlotClass = D3D11_INPUT_PER_INSTANCE_DATA;
+	inputDescs[2].AlignedByteOffset = offsetof(FontChar, glyph);
+	inputDescs[2].InstanceDataStepRate = 1;
+	
+	m_Font.VS = MakeVShader(fullhlsl.c_str(), "RENDERDOC_TextVS", "vs_4_0", 3, inputDescs, &m_Font.Layout);
 	m_Font.PS = MakePShader(fullhlsl.c_str(), "RENDERDOC_TextPS", "ps_4_0");
 
 	return true;
@@ -1707,6 +2147,8 @@ void D3D11DebugManager::OutputWindow::MakeDSV()
 
 uint64_t D3D11DebugManager::MakeOutputWindow(void *w, bool depth)
 {
+	EnsureDebugRendering();
+
 	OutputWindow outw;
 	outw.wnd = (HWND)w;
 	outw.dev = m_WrappedDevice;
@@ -1868,6 +2310,8 @@ void D3D11DebugManager::FlipOutputWindow(uint64_t id)
 
 uint32_t D3D11DebugManager::GetStructCount(ID3D11UnorderedAccessView *uav)
 {
+	EnsureDebugRendering();
+
 	m_pImmediateContext->CopyStructureCount(m_DebugRender.StageBuffer, 0, UNWRAP(WrappedID3D11UnorderedAccessView, uav));
 
 	D3D11_MAPPED_SUBRESOURCE mapped;
@@ -1888,6 +2332,8 @@ uint32_t D3D11DebugManager::GetStructCount(ID3D11UnorderedAccessView *uav)
 
 bool D3D11DebugManager::GetHistogram(ResourceId texid, uint32_t sliceFace, uint32_t mip, uint32_t sample, float minval, float maxval, bool channels[4], vector<uint32_t> &histogram)
 {
+	EnsureDebugRendering();
+
 	if(minval >= maxval) return false;
 	
 	TextureShaderDetails details = GetShaderDetails(texid, true);
@@ -1984,6 +2430,8 @@ bool D3D11DebugManager::GetHistogram(ResourceId texid, uint32_t sliceFace, uint3
 		
 bool D3D11DebugManager::GetMinMax(ResourceId texid, uint32_t sliceFace, uint32_t mip, uint32_t sample, float *minval, float *maxval)
 {
+	EnsureDebugRendering();
+
 	TextureShaderDetails details = GetShaderDetails(texid, true);
 
 	if(details.texFmt == DXGI_FORMAT_UNKNOWN)
@@ -2100,6 +2548,8 @@ vector<byte> D3D11DebugManager::GetBufferData(ResourceId buff, uint32_t offset,
 
 vector<byte> D3D11DebugManager::GetBufferData(ID3D11Buffer *buffer, uint32_t offset, uint32_t len)
 {
+	EnsureDebugRendering();
+
 	D3D11_MAPPED_SUBRESOURCE mapped;
 
 	if(buffer == NULL)
@@ -2171,6 +2621,8 @@ vector<byte> D3D11DebugManager::GetBufferData(ID3D11Buffer *buffer, uint32_t off
 
 void D3D11DebugManager::CopyArrayToTex2DMS(ID3D11Texture2D *destMS, ID3D11Texture2D *srcArray)
 {
+	EnsureDebugRendering();
+
 	D3D11RenderStateTracker tracker(m_WrappedContext);
 	
 	// copy to textures with right bind flags for operation
@@ -2419,44 +2871,176 @@ void D3D11DebugManager::CopyArrayToTex2DMS(ID3D11Texture2D *destMS, ID3D11Textur
 		{
 			dsvDesc.Texture2DMSArray.FirstArraySlice = slice;
 
-			hr = m_pDevice->CreateDepthStencilView(rtvResource, &dsvDesc, &dsvMS);
-			if(FAILED(hr))
-			{
-				RDCERR("0x%08x", hr);
-				return;
-			}
+			hr = m_pDevice->CreateDepthStencilView(rtvResource, &dsvDesc, &dsvMS);
+			if(FAILED(hr))
+			{
+				RDCERR("0x%08x", hr);
+				return;
+			}
+
+			m_pImmediateContext->OMSetRenderTargetsAndUnorderedAccessViews(0, NULL, dsvMS, 0, 0, NULL, NULL);
+
+			// loop over every stencil value (zzzzzz, no shader stencil read/write)
+			for(UINT stencilval=0; stencilval < 256; stencilval++)
+			{
+				uint32_t cdata[4] = { descMS.SampleDesc.Count, stencilval, 0, slice};
+
+				ID3D11Buffer *cbuf = MakeCBuffer((float *)cdata, sizeof(cdata));
+
+				m_pImmediateContext->PSSetConstantBuffers(0, 1, &cbuf);
+
+				m_pImmediateContext->OMSetDepthStencilState(dsState, stencilval);
+
+				m_pImmediateContext->Draw(3, 0);
+			}
+
+			SAFE_RELEASE(dsvMS);
+		}
+
+		SAFE_RELEASE(dsState);
+	}
+
+	m_pImmediateContext->CopyResource(destMS, rtvResource);
+
+	SAFE_RELEASE(rtvResource);
+	SAFE_RELEASE(srvResource);
+}
+
+bool D3D11DebugManager::CopyTex2DMSToArrayCompute(ID3D11Texture2D *destArray, ID3D11Texture2D *srcMS)
+{
+	if(m_DebugRender.CopyMSToArrayCS == NULL || m_DebugRender.FloatCopyMSToArrayCS == NULL)
+		return false;
+
+	D3D11_TEXTURE2D_DESC descMS;
+	srcMS->GetDesc(&descMS);
+	
+	D3D11_TEXTURE2D_DESC descArr;
+	destArray->GetDesc(&descArr);
+
+	// depth can't be written through a UAV, and stencil can't be written from a shader at
+	// all, so depth formats always go through the graphics path.
+	if(IsDepthFormat(descMS.Format))
+		return false;
+
+	DXGI_FORMAT typelessFormat = GetTypelessFormat(descMS.Format);
+	DXGI_FORMAT viewFormat = GetTypedFormatUIntPreferred(typelessFormat);
+
+	// an sRGB view would convert on the way through, and not every format can be
+	// written as a typed UAV.
+	if(IsSRGBFormat(viewFormat))
+		return false;
+
+	UINT support = 0;
+	HRESULT hr = m_pDevice->CheckFormatSupport(viewFormat, &support);
+	if(FAILED(hr) || !(support & D3D11_FORMAT_SUPPORT_TYPED_UNORDERED_ACCESS_VIEW))
+		return false;
+
+	UINT numSlices = descMS.ArraySize*descMS.SampleDesc.Count;
+	if(numSlices > D3D11_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION)
+		return false;
+
+	D3D11_TEXTURE2D_DESC uavResDesc = descArr;
+	D3D11_TEXTURE2D_DESC srvResDesc = descMS;
+
+	uavResDesc.Format = srvResDesc.Format = typelessFormat;
+	uavResDesc.BindFlags = D3D11_BIND_UNORDERED_ACCESS;
+	srvResDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	uavResDesc.Usage = srvResDesc.Usage = D3D11_USAGE_DEFAULT;
+	uavResDesc.CPUAccessFlags = srvResDesc.CPUAccessFlags = 0;
+	uavResDesc.MiscFlags = srvResDesc.MiscFlags = 0;
+
+	ID3D11Texture2D *uavResource = NULL;
+	ID3D11Texture2D *srvResource = NULL;
+
+	hr = GetPooledTexture(uavResDesc, &uavResource);
+	if(FAILED(hr))
+	{
+		RDCERR("0x%08x", hr);
+		return false;
+	}
+
+	hr = GetPooledTexture(srvResDesc, &srvResource);
+	if(FAILED(hr))
+	{
+		RDCERR("0x%08x", hr);
+		ReturnPooledTexture(uavResource);
+		return false;
+	}
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DMSARRAY;
+	srvDesc.Format = viewFormat;
+	srvDesc.Texture2DMSArray.ArraySize = descMS.ArraySize;
+	srvDesc.Texture2DMSArray.FirstArraySlice = 0;
+
+	D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+	uavDesc.ViewDimension = D3D11_UAV_DIMENSION_TEXTURE2DARRAY;
+	uavDesc.Format = viewFormat;
+	uavDesc.Texture2DArray.ArraySize = numSlices;
+	uavDesc.Texture2DArray.FirstArraySlice = 0;
+	uavDesc.Texture2DArray.MipSlice = 0;
+
+	ID3D11ShaderResourceView *srvMS = NULL;
+	ID3D11UnorderedAccessView *uavArray = NULL;
+
+	hr = m_pDevice->CreateShaderResourceView(srvResource, &srvDesc, &srvMS);
+	if(SUCCEEDED(hr))
+		hr = m_pDevice->CreateUnorderedAccessView(uavResource, &uavDesc, &uavArray);
+
+	if(FAILED(hr))
+	{
+		RDCERR("0x%08x", hr);
+		SAFE_RELEASE(srvMS);
+		ReturnPooledTexture(uavResource);
+		ReturnPooledTexture(srvResource);
+		return false;
+	}
+
+	m_pImmediateContext->CopyResource(srvResource, srcMS);
 
-			m_pImmediateContext->OMSetRenderTargetsAndUnorderedAccessViews(0, NULL, dsvMS, 0, 0, NULL, NULL);
+	ID3D11ShaderResourceView *srvs[8] = { NULL };
 
-			// loop over every stencil value (zzzzzz, no shader stencil read/write)
-			for(UINT stencilval=0; stencilval < 256; stencilval++)
-			{
-				uint32_t cdata[4] = { descMS.SampleDesc.Count, stencilval, 0, slice};
+	for(int i=0; i < 8; i++)
+		if(descMS.SampleDesc.Count == UINT(1<<i))
+			srvs[i] = srvMS;
 
-				ID3D11Buffer *cbuf = MakeCBuffer((float *)cdata, sizeof(cdata));
+	uint32_t cdata[4] = { descMS.SampleDesc.Count, 0, 0, 0 };
+	ID3D11Buffer *cbuf = MakeCBuffer((float *)cdata, sizeof(cdata));
 
-				m_pImmediateContext->PSSetConstantBuffers(0, 1, &cbuf);
+	m_pImmediateContext->CSSetShader(IsUIntFormat(viewFormat) ? m_DebugRender.CopyMSToArrayCS : m_DebugRender.FloatCopyMSToArrayCS, NULL, 0);
+	m_pImmediateContext->CSSetConstantBuffers(0, 1, &cbuf);
+	m_pImmediateContext->CSSetShaderResources(0, 8, srvs);
+	m_pImmediateContext->CSSetUnorderedAccessViews(0, 1, &uavArray, NULL);
 
-				m_pImmediateContext->OMSetDepthStencilState(dsState, stencilval);
+	m_pImmediateContext->Dispatch((descArr.Width+7)/8, (descArr.Height+7)/8, numSlices);
 
-				m_pImmediateContext->Draw(3, 0);
-			}
+	// unbind so the copy below doesn't have the texture bound for write
+	ID3D11UnorderedAccessView *nullUAV = NULL;
+	m_pImmediateContext->CSSetUnorderedAccessViews(0, 1, &nullUAV, NULL);
+	RDCEraseEl(srvs);
+	m_pImmediateContext->CSSetShaderResources(0, 8, srvs);
 
-			SAFE_RELEASE(dsvMS);
-		}
+	m_pImmediateContext->CopyResource(destArray, uavResource);
 
-		SAFE_RELEASE(dsState);
-	}
+	SAFE_RELEASE(srvMS);
+	SAFE_RELEASE(uavArray);
 
-	m_pImmediateContext->CopyResource(destMS, rtvResource);
+	ReturnPooledTexture(uavResource);
+	ReturnPooledTexture(srvResource);
 
-	SAFE_RELEASE(rtvResource);
-	SAFE_RELEASE(srvResource);
+	return true;
 }
 
 void D3D11DebugManager::CopyTex2DMSToArray(ID3D11Texture2D *destArray, ID3D11Texture2D *srcMS)
 {
+	EnsureDebugRendering();
+
 	D3D11RenderStateTracker tracker(m_WrappedContext);
+
+	// colour formats can do the whole copy in one dispatch, instead of a draw per sample
+	// per slice below.
+	if(CopyTex2DMSToArrayCompute(destArray, srcMS))
+		return;
 	
 	// copy to textures with right bind flags for operation
 	D3D11_TEXTURE2D_DESC descMS;
@@ -2767,6 +3351,133 @@ D3D11DebugManager::CacheElem &D3D11DebugManager::GetCachedElem(ResourceId id, bo
 	return m_ShaderItemCache.front();
 }
 
+ID3D11ShaderResourceView *D3D11DebugManager::GetTexturePreview(ResourceId id, const TextureShaderDetails &details, UINT slice, UINT &levels)
+{
+	DXGI_FORMAT fmt = GetTypedFormat(details.texFmt);
+
+	UINT support = 0;
+	if(FAILED(m_pDevice->CheckFormatSupport(fmt, &support)) || (support & D3D11_FORMAT_SUPPORT_MIP_AUTOGEN) == 0)
+		return NULL;
+
+	slice = RDCMIN(slice, details.texArraySize-1);
+
+	auto it=m_TexturePreviews.begin();
+	for(; it != m_TexturePreviews.end(); ++it)
+		if(it->id == id && it->slice == slice)
+			break;
+
+	if(it != m_TexturePreviews.end())
+	{
+		m_TexturePreviews.splice(m_TexturePreviews.begin(), m_TexturePreviews, it);
+	}
+	else
+	{
+		if(m_TexturePreviews.size() >= NUM_CACHED_PREVIEWS)
+		{
+			m_TexturePreviews.back().Release();
+			m_TexturePreviews.pop_back();
+		}
+
+		TexturePreview p;
+		p.id = id;
+		p.slice = slice;
+		p.generation = m_PreviewGeneration-1;
+
+		D3D11_TEXTURE2D_DESC desc;
+		RDCEraseEl(desc);
+		desc.Width = RDCMAX(1U, details.texWidth>>1);
+		desc.Height = RDCMAX(1U, details.texHeight>>1);
+		desc.MipLevels = CalcNumMips(desc.Width, desc.Height, 1);
+		desc.ArraySize = 1;
+		desc.Format = fmt;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+		HRESULT hr = m_pDevice->CreateTexture2D(&desc, NULL, &p.tex);
+
+		if(FAILED(hr))
+		{
+			RDCERR("Failed to create preview texture %08x", hr);
+			return NULL;
+		}
+
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+		srvDesc.Format = fmt;
+		srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+		srvDesc.Texture2DArray.ArraySize = 1;
+		srvDesc.Texture2DArray.FirstArraySlice = 0;
+		srvDesc.Texture2DArray.MipLevels = desc.MipLevels;
+		srvDesc.Texture2DArray.MostDetailedMip = 0;
+
+		hr = m_pDevice->CreateShaderResourceView(p.tex, &srvDesc, &p.srv);
+
+		if(FAILED(hr))
+		{
+			RDCERR("Failed to create preview SRV %08x", hr);
+			p.Release();
+			return NULL;
+		}
+
+		p.levels = desc.MipLevels;
+
+		m_TexturePreviews.push_front(p);
+	}
+
+	TexturePreview &preview = m_TexturePreviews.front();
+
+	if(preview.generation != m_PreviewGeneration)
+	{
+		// GenerateMips needs the top mip too, so generate into a full size copy and keep
+		// everything below it.
+		D3D11_TEXTURE2D_DESC desc;
+		RDCEraseEl(desc);
+		desc.Width = details.texWidth;
+		desc.Height = details.texHeight;
+		desc.MipLevels = preview.levels+1;
+		desc.ArraySize = 1;
+		desc.Format = fmt;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE|D3D11_BIND_RENDER_TARGET;
+		desc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+
+		ID3D11Texture2D *full = NULL;
+		HRESULT hr = GetPooledTexture(desc, &full);
+
+		if(FAILED(hr))
+		{
+			RDCERR("Failed to create full size preview texture %08x", hr);
+			return NULL;
+		}
+
+		ID3D11ShaderResourceView *fullSRV = NULL;
+		hr = m_pDevice->CreateShaderResourceView(full, NULL, &fullSRV);
+
+		if(FAILED(hr))
+		{
+			RDCERR("Failed to create full size preview SRV %08x", hr);
+			ReturnPooledTexture(full);
+			return NULL;
+		}
+
+		m_pImmediateContext->CopySubresourceRegion(full, 0, 0, 0, 0, details.srvResource,
+		                                           D3D11CalcSubresource(0, slice, details.texMips), NULL);
+		m_pImmediateContext->GenerateMips(fullSRV);
+
+		for(UINT l=0; l < preview.levels; l++)
+			m_pImmediateContext->CopySubresourceRegion(preview.tex, l, 0, 0, 0, full, l+1, NULL);
+
+		SAFE_RELEASE(fullSRV);
+		ReturnPooledTexture(full);
+
+		preview.generation = m_PreviewGeneration;
+	}
+
+	levels = preview.levels;
+	return preview.srv;
+}
+
 D3D11DebugManager::TextureShaderDetails D3D11DebugManager::GetShaderDetails(ResourceId id, bool rawOutput)
 {
 	TextureShaderDetails details;
@@ -3160,24 +3871,41 @@ void D3D11DebugManager::RenderText(float x, float y, const char *textfmt, ...)
 
 void D3D11DebugManager::RenderTextInternal(float x, float y, const char *text)
 {
-	if(char *t = strchr((char *)text, '\n'))
+	float col = 0.0f;
+
+	for(const char *c = text; *c; c++)
 	{
-		*t = 0;
-		RenderTextInternal(x, y, text);
-		RenderTextInternal(x, y+1.0f, t+1);
-		*t = '\n';
-		return;
+		if(*c == '\n')
+		{
+			col = 0.0f;
+			y += 1.0f;
+			continue;
+		}
+
+		// spaces and anything outside the baked range have no glyph, they only advance
+		if(*c > ' ' && *c < 127)
+		{
+			FontChar ch = { x + col, y, uint32_t(*c - ' ') };
+			m_PendingText.push_back(ch);
+		}
+
+		col += 1.0f;
 	}
+}
 
-	if(strlen(text) == 0)
+void D3D11DebugManager::FlushText()
+{
+	if(m_PendingText.empty())
 		return;
 
-	RDCASSERT(strlen(text) < FONT_MAX_CHARS);
+	EnsureDebugRendering();
+	EnsureFontRendering();
 
 	FontCBuffer data;
 
-	data.TextPosition.x = x;
-	data.TextPosition.y = y;
+	// characters carry their own positions
+	data.TextPosition.x = 0.0f;
+	data.TextPosition.y = 0.0f;
 
 	data.FontScreenAspect.x = 1.0f/float(GetWidth());
 	data.FontScreenAspect.y = 1.0f/float(GetHeight());
@@ -3191,31 +3919,10 @@ void D3D11DebugManager::RenderTextInternal(float x, float y, const char *text)
 	data.CharacterSize.x = 1.0f/float(FONT_TEX_WIDTH);
 	data.CharacterSize.y = 1.0f/float(FONT_TEX_HEIGHT);
 
-	D3D11_MAPPED_SUBRESOURCE mapped;
-
 	FillCBuffer(m_Font.CBuffer, (float *)&data, sizeof(FontCBuffer));
 
-	HRESULT hr = m_pImmediateContext->Map(m_Font.CharBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
-
-	if(FAILED(hr))
-	{
-		RDCERR("Failed to map charbuffer %08x", hr);
-		return;
-	}
-
-	unsigned long *texs = (unsigned long *)mapped.pData;
-	
-	for(size_t i=0; i < strlen(text); i++)
-	{
-		texs[i*4 + 0] = text[i] - ' ';
-		texs[i*4 + 1] = text[i] - ' ';
-		texs[i*4 + 2] = text[i] - ' ';
-		texs[i*4 + 3] = text[i] - ' ';
-	}
-	m_pImmediateContext->Unmap(m_Font.CharBuffer, 0);
-
 	ID3D11Buffer *bufs[2] = { m_Font.PosBuffer, m_Font.CharBuffer };
-	UINT strides[2] = { 3*sizeof(float), sizeof(long) };
+	UINT strides[2] = { 2*sizeof(float), sizeof(FontChar) };
 	UINT offsets[2] = { 0, 0 };
 
 	// can't just clear state because we need to keep things like render targets.
@@ -3251,13 +3958,36 @@ void D3D11DebugManager::RenderTextInternal(float x, float y, const char *text)
 
 		float factor[4] = {1.0f, 1.0f, 1.0f, 1.0f};
 		m_pImmediateContext->OMSetBlendState(m_DebugRender.BlendState, factor, 0xffffffff);
+	}
+
+	// all the queued text goes in one instanced draw, unless there's more than fits in the buffer
+	for(size_t first=0; first < m_PendingText.size(); first += FONT_MAX_BATCH_CHARS)
+	{
+		UINT count = (UINT)RDCMIN(m_PendingText.size()-first, (size_t)FONT_MAX_BATCH_CHARS);
+
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		HRESULT hr = m_pImmediateContext->Map(m_Font.CharBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
+
+		if(FAILED(hr))
+		{
+			RDCERR("Failed to map charbuffer %08x", hr);
+			break;
+		}
+
+		memcpy(mapped.pData, &m_PendingText[first], count*sizeof(FontChar));
+
+		m_pImmediateContext->Unmap(m_Font.CharBuffer, 0);
 
-		m_pImmediateContext->Draw((uint32_t)strlen(text)*4, 0);
+		m_pImmediateContext->DrawInstanced(4, count, 0, 0);
 	}
+
+	m_PendingText.clear();
 }
 
 bool D3D11DebugManager::RenderTexture(TextureDisplay cfg, bool blendAlpha)
 {
+	EnsureDebugRendering();
+
 	DebugVertexCBuffer vertexData;
 	DebugPixelCBufferData pixelData;
 
@@ -3444,9 +4174,43 @@ bool D3D11DebugManager::RenderTexture(TextureDisplay cfg, bool blendAlpha)
 		}
 	}
 
+	// when a large texture is zoomed well out, sample from a downsampled copy rather than
+	// the full size top mip. previewMip is the mip of the texture we're showing instead.
+	UINT previewMip = 0;
+
+	if(cfg.mip == 0 && customPS == NULL && cfg.CustomShader == ResourceId() && cfg.texid != m_CustomShaderResourceId &&
+		 !cfg.rawoutput && details.texType == eTexType_2D &&
+		 !IsUIntFormat(details.texFmt) && !IsIntFormat(details.texFmt) &&
+		 RDCMAX(details.texWidth, details.texHeight) >= PreviewMinSize)
+	{
+		while(vertexData.Scale*float(1<<(previewMip+1)) <= 1.0f)
+			previewMip++;
+
+		if(previewMip > 0)
+		{
+			UINT previewLevels = 0;
+			ID3D11ShaderResourceView *previewSRV = GetTexturePreview(cfg.texid, details, cfg.sliceFace, previewLevels);
+
+			if(previewSRV)
+			{
+				previewMip = RDCMIN(previewMip, previewLevels);
+
+				details.srv[eTexType_2D] = previewSRV;
+
+				pixelData.TextureResolutionPS.x = float(RDCMAX(1U,details.texWidth>>previewMip));
+				pixelData.TextureResolutionPS.y = float(RDCMAX(1U,details.texHeight>>previewMip));
+				pixelData.TextureResolutionPS.z = 1.0f;
+			}
+			else
+			{
+				previewMip = 0;
+			}
+		}
+	}
+
 	vertexData.Scale *= 2.0f; // viewport is -1 -> 1
 
-	pixelData.MipLevel = (float)cfg.mip;
+	pixelData.MipLevel = (float)(previewMip > 0 ? previewMip-1 : cfg.mip);
 
 	UINT stride = 3*sizeof(float);
 	UINT offset = 0;
@@ -3454,6 +4218,10 @@ bool D3D11DebugManager::RenderTexture(TextureDisplay cfg, bool blendAlpha)
 	pixelData.OutputDisplayFormat = RESTYPE_TEX2D;
 	pixelData.Slice = float(RDCCLAMP(cfg.sliceFace, 0U, details.texArraySize-1));
 
+	// the preview only holds the selected slice
+	if(previewMip > 0)
+		pixelData.Slice = 0.0f;
+
 	if(details.texType == eTexType_3D)
 	{
 		pixelData.OutputDisplayFormat = RESTYPE_TEX3D;
@@ -3511,15 +4279,15 @@ bool D3D11DebugManager::RenderTexture(TextureDisplay cfg, bool blendAlpha)
 		pixelData.OutputDisplayFormat |= TEXDISPLAY_GAMMA_CURVE;
 	}
 
-	FillCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
-	FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+	DebugCBuffer vsCB = UploadCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+	DebugCBuffer psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
 
 	// can't just clear state because we need to keep things like render targets.
 	{
 		m_pImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 		m_pImmediateContext->VSSetShader(m_DebugRender.GenericVS, NULL, 0);
-		m_pImmediateContext->VSSetConstantBuffers(0, 1, &m_DebugRender.GenericVSCBuffer);
+		SetCBuffer(eShaderStage_Vertex, 0, vsCB);
 
 		m_pImmediateContext->HSSetShader(NULL, NULL, 0);
 		m_pImmediateContext->DSSetShader(NULL, NULL, 0);
@@ -3530,7 +4298,7 @@ bool D3D11DebugManager::RenderTexture(TextureDisplay cfg, bool blendAlpha)
 		if(customPS == NULL)
 		{
 			m_pImmediateContext->PSSetShader(m_DebugRender.TexDisplayPS, NULL, 0);
-			m_pImmediateContext->PSSetConstantBuffers(0, 1, &m_DebugRender.GenericPSCBuffer);
+			SetCBuffer(eShaderStage_Pixel, 0, psCB);
 		}
 		else
 		{
@@ -3562,6 +4330,8 @@ bool D3D11DebugManager::RenderTexture(TextureDisplay cfg, bool blendAlpha)
 
 void D3D11DebugManager::RenderHighlightBox(float w, float h, float scale)
 {
+	EnsureDebugRendering();
+
 	UINT stride = 3*sizeof(float);
 	UINT offs = 0;
 	
@@ -3629,6 +4399,8 @@ void D3D11DebugManager::RenderHighlightBox(float w, float h, float scale)
 
 void D3D11DebugManager::RenderCheckerboard(Vec3f light, Vec3f dark)
 {
+	EnsureDebugRendering();
+
 	DebugVertexCBuffer vertexData;
 	
 	D3D11RenderStateTracker tracker(m_WrappedContext);
@@ -3644,14 +4416,14 @@ void D3D11DebugManager::RenderCheckerboard(Vec3f light, Vec3f dark)
 
 	vertexData.LineStrip = 0;
 	
-	FillCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+	DebugCBuffer vsCB = UploadCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
 
 	DebugPixelCBufferData pixelData;
 
 	pixelData.Channels = Vec4f(light.x, light.y, light.z, 0.0f);
 	pixelData.WireframeColour = dark;
 	
-	FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+	DebugCBuffer psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
 
 	UINT stride = 3*sizeof(float);
 	UINT offset = 0;
@@ -3662,7 +4434,7 @@ void D3D11DebugManager::RenderCheckerboard(Vec3f light, Vec3f dark)
 		m_pImmediateContext->IASetInputLayout(NULL);
 
 		m_pImmediateContext->VSSetShader(m_DebugRender.GenericVS, NULL, 0);
-		m_pImmediateContext->VSSetConstantBuffers(0, 1, &m_DebugRender.GenericVSCBuffer);
+		SetCBuffer(eShaderStage_Vertex, 0, vsCB);
 
 		m_pImmediateContext->HSSetShader(NULL, NULL, 0);
 		m_pImmediateContext->DSSetShader(NULL, NULL, 0);
@@ -3671,7 +4443,7 @@ void D3D11DebugManager::RenderCheckerboard(Vec3f light, Vec3f dark)
 		m_pImmediateContext->RSSetState(m_DebugRender.RastState);
 
 		m_pImmediateContext->PSSetShader(m_DebugRender.CheckerboardPS, NULL, 0);
-		m_pImmediateContext->PSSetConstantBuffers(0, 1, &m_DebugRender.GenericPSCBuffer);
+		SetCBuffer(eShaderStage_Pixel, 0, psCB);
 
 		float factor[4] = {1.0f, 1.0f, 1.0f, 1.0f};
 		m_pImmediateContext->OMSetBlendState(NULL, factor, 0xffffffff);
@@ -3681,14 +4453,39 @@ void D3D11DebugManager::RenderCheckerboard(Vec3f light, Vec3f dark)
 	}
 }
 
+void D3D11DebugManager::TrimPostVSCache()
+{
+	uint64_t total = 0;
+
+	for(auto it=m_PostVSData.begin(); it != m_PostVSData.end(); ++it)
+		total += PostVSDataSize(it->second);
+
+	while(total > PostVSCacheBudget && !m_PostVSData.empty())
+	{
+		auto lru = m_PostVSData.begin();
+		for(auto it=m_PostVSData.begin(); it != m_PostVSData.end(); ++it)
+			if(it->second.lastUse < lru->second.lastUse)
+				lru = it;
+
+		total -= PostVSDataSize(lru->second);
+
+		ReleasePostVSData(lru->second);
+		m_PostVSData.erase(lru);
+	}
+}
+
 MeshFormat D3D11DebugManager::GetPostVSBuffers(uint32_t frameID, uint32_t eventID, uint32_t instID, MeshDataStage stage)
 {
 	PostVSData postvs;
 	RDCEraseEl(postvs);
 
 	auto idx = std::make_pair(frameID, eventID);
-	if(m_PostVSData.find(idx) != m_PostVSData.end())
-		postvs = m_PostVSData[idx];
+	auto it = m_PostVSData.find(idx);
+	if(it != m_PostVSData.end())
+	{
+		it->second.lastUse = ++m_PostVSUseCounter;
+		postvs = it->second;
+	}
 
 	PostVSData::StageData s = postvs.GetStage(stage);
 	
@@ -3727,6 +4524,28 @@ MeshFormat D3D11DebugManager::GetPostVSBuffers(uint32_t frameID, uint32_t eventI
 }
 
 void D3D11DebugManager::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
+{
+	EnsureDebugRendering();
+	EnsureStreamOut();
+
+	auto idx = std::make_pair(frameID, eventID);
+	auto it = m_PostVSData.find(idx);
+
+	if(it == m_PostVSData.end())
+	{
+		// make room before allocating any more
+		TrimPostVSCache();
+
+		CreatePostVSBuffers(frameID, eventID);
+
+		it = m_PostVSData.find(idx);
+	}
+
+	if(it != m_PostVSData.end())
+		it->second.lastUse = ++m_PostVSUseCounter;
+}
+
+void D3D11DebugManager::CreatePostVSBuffers(uint32_t frameID, uint32_t eventID)
 {
 	auto idx = std::make_pair(frameID, eventID);
 	if(m_PostVSData.find(idx) != m_PostVSData.end())
@@ -3877,13 +4696,17 @@ void D3D11DebugManager::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
 		UINT offset = 0;
 		m_pImmediateContext->SOSetTargets( 1, &m_SOBuffer, &offset );
 
-		m_pImmediateContext->Begin(m_SOStatsQuery);
-
 		ID3D11Buffer *idxBuf = NULL;
 		DXGI_FORMAT idxFmt = DXGI_FORMAT_UNKNOWN;
 
+		// every vertex is drawn as one point, so the number streamed out is known up front
+		// and there's no need to wait on an SO statistics query for it
+		UINT numVerts = 0;
+
 		if((drawcall->flags & eDraw_UseIBuffer) == 0)
 		{
+			numVerts = drawcall->numIndices;
+
 			m_pImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
 			if(drawcall->flags & eDraw_Instanced)
 				m_pImmediateContext->DrawInstanced(drawcall->numIndices, drawcall->numInstances, drawcall->vertexOffset, drawcall->instanceOffset);
@@ -3959,6 +4782,8 @@ void D3D11DebugManager::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
 			else
 				idxBuf = NULL;
 
+			numVerts = (UINT)indices.size();
+
 			m_pImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
 			m_pImmediateContext->IASetIndexBuffer(idxBuf, DXGI_FORMAT_R32_UINT, 0);
 			SAFE_RELEASE(idxBuf);
@@ -3994,40 +4819,31 @@ void D3D11DebugManager::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
 				idxBuf = NULL;
 		}
 
-		m_pImmediateContext->End(m_SOStatsQuery);
-
 		m_pImmediateContext->GSSetShader(NULL, NULL, 0);
 		m_pImmediateContext->SOSetTargets(0, NULL, NULL);
 
-		D3D11_QUERY_DATA_SO_STATISTICS numPrims;
-
-		m_pImmediateContext->CopyResource(m_SOStagingBuffer, m_SOBuffer);
-
-		do 
-		{
-			hr = m_pImmediateContext->GetData(m_SOStatsQuery, &numPrims, sizeof(D3D11_QUERY_DATA_SO_STATISTICS ), 0);
-		} while(hr == S_FALSE);
+		uint64_t numPrimsWritten = uint64_t(numVerts);
+		if(drawcall->flags & eDraw_Instanced)
+			numPrimsWritten *= drawcall->numInstances;
 
-		if(numPrims.NumPrimitivesWritten == 0)
+		if(numPrimsWritten == 0)
 		{
 			m_PostVSData[idx] = PostVSData();
 			SAFE_RELEASE(idxBuf);
 			return;
 		}
 
-		D3D11_MAPPED_SUBRESOURCE mapped;
-		hr = m_pImmediateContext->Map(m_SOStagingBuffer, 0, D3D11_MAP_READ, 0, &mapped);
-
-		if(FAILED(hr))
+		if(uint64_t(stride)*numPrimsWritten >= m_SOBufferSize)
 		{
-			RDCERR("Failed to map sobuffer %08x", hr);
+			RDCERR("Generated output data too large: %llu", uint64_t(stride)*numPrimsWritten);
+
 			SAFE_RELEASE(idxBuf);
 			return;
 		}
 
 		D3D11_BUFFER_DESC bufferDesc =
 		{
-			stride * (uint32_t)numPrims.NumPrimitivesWritten,
+			stride * (uint32_t)numPrimsWritten,
 			D3D11_USAGE_IMMUTABLE,
 			D3D11_BIND_VERTEX_BUFFER,
 			0,
@@ -4035,11 +4851,16 @@ void D3D11DebugManager::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
 			0
 		};
 
-		if(bufferDesc.ByteWidth >= m_SOBufferSize)
-		{
-			RDCERR("Generated output data too large: %08x", bufferDesc.ByteWidth);
+		// only copy back what was written, not the whole stream-out buffer
+		D3D11_BOX box = { 0, 0, 0, bufferDesc.ByteWidth, 1, 1 };
+		m_pImmediateContext->CopySubresourceRegion(m_SOStagingBuffer, 0, 0, 0, 0, m_SOBuffer, 0, &box);
 
-			m_pImmediateContext->Unmap(m_SOStagingBuffer, 0);
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		hr = m_pImmediateContext->Map(m_SOStagingBuffer, 0, D3D11_MAP_READ, 0, &mapped);
+
+		if(FAILED(hr))
+		{
+			RDCERR("Failed to map sobuffer %08x", hr);
 			SAFE_RELEASE(idxBuf);
 			return;
 		}
@@ -4071,7 +4892,7 @@ void D3D11DebugManager::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
 
 		Vec4f *pos0 = (Vec4f *)byteData;
 
-		for(UINT64 i=1; numPosComponents == 4 && i < numPrims.NumPrimitivesWritten; i++)
+		for(UINT64 i=1; numPosComponents == 4 && i < numPrimsWritten; i++)
 		{
 			//////////////////////////////////////////////////////////////////////////////////
 			// derive near/far, assuming a standard perspective matrix
@@ -4390,22 +5211,22 @@ void D3D11DebugManager::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
 		
 		if(lastShader == dxbcGS)
 		{
-			for(size_t i=0; i < dxbcGS->m_Declarations.size(); i++)
+			for(size_t i=0; i < dxbcGS->GetDeclarations().size(); i++)
 			{
-				if(dxbcGS->m_Declarations[i].declaration == DXBC::OPCODE_DCL_GS_OUTPUT_PRIMITIVE_TOPOLOGY)
+				if(dxbcGS->GetDeclarations()[i].declaration == DXBC::OPCODE_DCL_GS_OUTPUT_PRIMITIVE_TOPOLOGY)
 				{
-					topo = (D3D11_PRIMITIVE_TOPOLOGY)dxbcGS->m_Declarations[i].outTopology; // enums match
+					topo = (D3D11_PRIMITIVE_TOPOLOGY)dxbcGS->GetDeclarations()[i].outTopology; // enums match
 					break;
 				}
 			}
 		}
 		else if(lastShader == dxbcDS)
 		{
-			for(size_t i=0; i < dxbcDS->m_Declarations.size(); i++)
+			for(size_t i=0; i < dxbcDS->GetDeclarations().size(); i++)
 			{
-				if(dxbcDS->m_Declarations[i].declaration == DXBC::OPCODE_DCL_TESS_DOMAIN)
+				if(dxbcDS->GetDeclarations()[i].declaration == DXBC::OPCODE_DCL_TESS_DOMAIN)
 				{
-					if(dxbcDS->m_Declarations[i].domain == DXBC::DOMAIN_ISOLINE)
+					if(dxbcDS->GetDeclarations()[i].domain == DXBC::DOMAIN_ISOLINE)
 						topo = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
 					else
 						topo = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
@@ -4459,87 +5280,73 @@ FloatVector D3D11DebugManager::InterpretVertex(byte *data, uint32_t vert, MeshDi
 		vert = m_HighlightCache.indices[vert];
 	}
 
-	data += vert*cfg.position.stride;
+	if(!DecodeVertexStream(cfg.position, data, end, &vert, 1, &ret))
+		valid = false;
 
-	float *out = &ret.x;
+	return ret;
+}
 
-	ResourceFormat fmt;
-	fmt.compByteWidth = cfg.position.compByteWidth;
-	fmt.compCount = cfg.position.compCount;
-	fmt.compType = cfg.position.compType;
+void D3D11DebugManager::UpdateSecondaryArena(const vector<MeshFormat> &secondaryDraws)
+{
+	SAFE_RELEASE(m_SecondaryArenaVB);
+	SAFE_RELEASE(m_SecondaryArenaIB);
 
-	if(cfg.position.specialFormat == eSpecial_R10G10B10A2)
-	{
-		if(data+4 >= end)
-		{
-			valid = false;
-			return ret;
-		}
+	if(!m_SecondaryArena.Build(m_WrappedDevice->GetReplay(), secondaryDraws))
+		return;
 
-		Vec4f v = ConvertFromR10G10B10A2(*(uint32_t *)data);
-		ret.x = v.x;
-		ret.y = v.y;
-		ret.z = v.z;
-		ret.w = v.w;
-		return ret;
-	}
-	else if(cfg.position.specialFormat == eSpecial_R11G11B10)
-	{
-		if(data+4 >= end)
-		{
-			valid = false;
-			return ret;
-		}
+	D3D11_BUFFER_DESC bdesc;
+	bdesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	bdesc.CPUAccessFlags = 0;
+	bdesc.ByteWidth = UINT(m_SecondaryArena.positions.size()*sizeof(Vec4f));
+	bdesc.MiscFlags = 0;
+	bdesc.StructureByteStride = 0;
+	bdesc.Usage = D3D11_USAGE_IMMUTABLE;
 
-		Vec3f v = ConvertFromR11G11B10(*(uint32_t *)data);
-		ret.x = v.x;
-		ret.y = v.y;
-		ret.z = v.z;
-		return ret;
-	}
-	else if(cfg.position.specialFormat == eSpecial_B8G8R8A8)
-	{
-		if(data+4 >= end)
-		{
-			valid = false;
-			return ret;
-		}
+	D3D11_SUBRESOURCE_DATA data;
+	data.pSysMem = &m_SecondaryArena.positions[0];
+	data.SysMemPitch = data.SysMemSlicePitch = 0;
 
-		fmt.compByteWidth = 1;
-		fmt.compCount = 4;
-		fmt.compType = eCompType_UNorm;
-	}
-	
-	if(data + cfg.position.compCount*cfg.position.compByteWidth > end)
+	HRESULT hr = m_pDevice->CreateBuffer(&bdesc, &data, &m_SecondaryArenaVB);
+
+	if(FAILED(hr))
 	{
-		valid = false;
-		return ret;
+		RDCERR("Failed to create m_SecondaryArenaVB %08x", hr);
+		m_SecondaryArenaVB = NULL;
 	}
 
-	for(uint32_t i=0; i < cfg.position.compCount; i++)
-	{
-		*out = ConvertComponent(fmt, data);
+	bdesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+	bdesc.ByteWidth = UINT(m_SecondaryArena.indices.size()*sizeof(uint32_t));
+	data.pSysMem = &m_SecondaryArena.indices[0];
+
+	hr = m_pDevice->CreateBuffer(&bdesc, &data, &m_SecondaryArenaIB);
 
-		data += cfg.position.compByteWidth;
-		out++;
+	if(FAILED(hr))
+	{
+		RDCERR("Failed to create m_SecondaryArenaIB %08x", hr);
+		m_SecondaryArenaIB = NULL;
 	}
 
-	if(cfg.position.specialFormat == eSpecial_B8G8R8A8)
+	// if either buffer couldn't be created, fall back to drawing everything separately
+	if(m_SecondaryArenaVB == NULL || m_SecondaryArenaIB == NULL)
 	{
-		FloatVector reversed;
-		reversed.x = ret.x;
-		reversed.y = ret.y;
-		reversed.z = ret.z;
-		reversed.w = ret.w;
-		return reversed;
+		SAFE_RELEASE(m_SecondaryArenaVB);
+		SAFE_RELEASE(m_SecondaryArenaIB);
+
+		m_SecondaryArena.unpacked.clear();
+		for(size_t i=0; i < secondaryDraws.size(); i++)
+			m_SecondaryArena.unpacked.push_back(secondaryDraws[i]);
 	}
 
-	return ret;
+	m_SecondaryArena.FreeData();
 }
 
 void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vector<MeshFormat> &secondaryDraws, MeshDisplay cfg)
 {
+	EnsureDebugRendering();
+	EnsureStreamOut();
+
 	DebugVertexCBuffer vertexData;
+	DebugCBuffer vsCB, psCB, gsCB;
 	
 	D3D11RenderStateTracker tracker(m_WrappedContext);
 
@@ -4563,9 +5370,9 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 
 	pixelData.OutputDisplayFormat = MESHDISPLAY_SOLID;
 	pixelData.WireframeColour = Vec3f(0.0f, 0.0f, 0.0f);
-	FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+	psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
 
-	m_pImmediateContext->PSSetConstantBuffers(0, 1, &m_DebugRender.GenericPSCBuffer);
+	SetCBuffer(eShaderStage_Pixel, 0, psCB);
 	m_pImmediateContext->PSSetShader(m_DebugRender.WireframePS, NULL, 0);
 
 	m_pImmediateContext->HSSetShader(NULL, NULL, 0);
@@ -4675,10 +5482,10 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 			vertexData.ModelViewProj = projMat.Mul(camMat.Mul(guessProjInv));
 		}
 
-		FillCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+		vsCB = UploadCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
 	
-		m_pImmediateContext->VSSetConstantBuffers(0, 1, &m_DebugRender.GenericVSCBuffer);
-		m_pImmediateContext->PSSetConstantBuffers(0, 1, &m_DebugRender.GenericPSCBuffer);
+		SetCBuffer(eShaderStage_Vertex, 0, vsCB);
+		SetCBuffer(eShaderStage_Pixel, 0, psCB);
 			
 		if(cfg.position.unproject)
 			m_pImmediateContext->VSSetShader(m_DebugRender.WireframeHomogVS, NULL, 0);
@@ -4695,11 +5502,39 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 
 			pixelData.OutputDisplayFormat = MESHDISPLAY_SOLID;
 			pixelData.WireframeColour = Vec3f(cfg.prevMeshColour.x, cfg.prevMeshColour.y, cfg.prevMeshColour.z);
-			FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			SetCBuffer(eShaderStage_Pixel, 0, psCB);
 			
-			for(size_t i=0; i < secondaryDraws.size(); i++)
+			if(!m_SecondaryArena.Matches(secondaryDraws))
+				UpdateSecondaryArena(secondaryDraws);
+
+			if(m_SecondaryArenaVB && m_SecondaryArenaIB)
+			{
+				UINT stride = sizeof(Vec4f);
+				UINT offset = 0;
+				m_pImmediateContext->IASetVertexBuffers(0, 1, &m_SecondaryArenaVB, &stride, &offset);
+				m_pImmediateContext->IASetIndexBuffer(m_SecondaryArenaIB, DXGI_FORMAT_R32_UINT, 0);
+
+				D3D11_PRIMITIVE_TOPOLOGY arenaTopo[SecondaryMeshArena::eClass_Count] = {
+					D3D11_PRIMITIVE_TOPOLOGY_POINTLIST,
+					D3D11_PRIMITIVE_TOPOLOGY_LINELIST,
+					D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST,
+				};
+
+				for(int c=0; c < SecondaryMeshArena::eClass_Count; c++)
+				{
+					if(m_SecondaryArena.numIndices[c] == 0)
+						continue;
+
+					m_pImmediateContext->IASetPrimitiveTopology(arenaTopo[c]);
+					m_pImmediateContext->DrawIndexed(m_SecondaryArena.numIndices[c], m_SecondaryArena.firstIndex[c], 0);
+				}
+			}
+
+			// anything that couldn't be packed is drawn on its own
+			for(size_t i=0; i < m_SecondaryArena.unpacked.size(); i++)
 			{
-				const MeshFormat &fmt = secondaryDraws[i];
+				const MeshFormat &fmt = m_SecondaryArena.unpacked[i];
 
 				if(fmt.buf != ResourceId())
 				{
@@ -4778,9 +5613,9 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 			if(cfg.solidShadeMode == eShade_Secondary && cfg.second.showAlpha)
 				pixelData.OutputDisplayFormat = MESHDISPLAY_SECONDARY_ALPHA;
 			pixelData.WireframeColour = Vec3f(0.8f, 0.8f, 0.0f);
-			FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
 
-			m_pImmediateContext->PSSetConstantBuffers(0, 1, &m_DebugRender.GenericPSCBuffer);
+			SetCBuffer(eShaderStage_Pixel, 0, psCB);
 
 			if(cfg.solidShadeMode == eShade_Lit)
 			{
@@ -4788,8 +5623,8 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 
 				geomData.InvProj = projMat.Inverse();
 
-				FillCBuffer(m_DebugRender.GenericGSCBuffer, (float *)&geomData, sizeof(DebugGeometryCBuffer));
-				m_pImmediateContext->GSSetConstantBuffers(0, 1, &m_DebugRender.GenericGSCBuffer);
+				gsCB = UploadCBuffer(m_DebugRender.GenericGSCBuffer, (float *)&geomData, sizeof(DebugGeometryCBuffer));
+				SetCBuffer(eShaderStage_Geometry, 0, gsCB);
 				
 				m_pImmediateContext->GSSetShader(m_DebugRender.MeshGS, NULL, 0);
 			}
@@ -4815,9 +5650,9 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 				pixelData.WireframeColour = Vec3f(cfg.currentMeshColour.x, cfg.currentMeshColour.y, cfg.currentMeshColour.z);
 			else
 				pixelData.WireframeColour = Vec3f(0.0f, 0.0f, 0.0f);
-			FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
 
-			m_pImmediateContext->PSSetConstantBuffers(0, 1, &m_DebugRender.GenericPSCBuffer);
+			SetCBuffer(eShaderStage_Pixel, 0, psCB);
 
 			if(cfg.position.topo >= eTopology_PatchList_1CPs)
 				m_pImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
@@ -4836,22 +5671,22 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 	// set up state for drawing helpers
 	{
 		vertexData.ModelViewProj = projMat.Mul(camMat);
-		FillCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+		vsCB = UploadCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
 
 		m_pImmediateContext->RSSetState(m_SolidHelpersRS);
 
 		m_pImmediateContext->OMSetDepthStencilState(m_DebugRender.NoDepthState, 0);
 		
-		m_pImmediateContext->VSSetConstantBuffers(0, 1, &m_DebugRender.GenericVSCBuffer);
+		SetCBuffer(eShaderStage_Vertex, 0, vsCB);
 		m_pImmediateContext->VSSetShader(m_DebugRender.WireframeVS, NULL, 0);
-		m_pImmediateContext->PSSetConstantBuffers(0, 1, &m_DebugRender.GenericPSCBuffer);
+		SetCBuffer(eShaderStage_Pixel, 0, psCB);
 		m_pImmediateContext->PSSetShader(m_DebugRender.WireframePS, NULL, 0);
 	}
 	
 	// axis markers
 	if(!cfg.position.unproject)
 	{
-		m_pImmediateContext->PSSetConstantBuffers(0, 1, &m_DebugRender.GenericPSCBuffer);
+		SetCBuffer(eShaderStage_Pixel, 0, psCB);
 		
 		UINT strides[] = { sizeof(Vec3f) };
 		UINT offsets[] = { 0 };
@@ -4861,15 +5696,18 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 		m_pImmediateContext->IASetInputLayout(m_DebugRender.GenericLayout);
 		
 		pixelData.WireframeColour = Vec3f(1.0f, 0.0f, 0.0f);
-		FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+		psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+		SetCBuffer(eShaderStage_Pixel, 0, psCB);
 		m_pImmediateContext->Draw(2, 0);
 		
 		pixelData.WireframeColour = Vec3f(0.0f, 1.0f, 0.0f);
-		FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+		psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+		SetCBuffer(eShaderStage_Pixel, 0, psCB);
 		m_pImmediateContext->Draw(2, 2);
 		
 		pixelData.WireframeColour = Vec3f(0.0f, 0.0f, 1.0f);
-		FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+		psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+		SetCBuffer(eShaderStage_Pixel, 0, psCB);
 		m_pImmediateContext->Draw(2, 4);
 	}
 
@@ -5232,7 +6070,8 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 				m_pImmediateContext->IASetInputLayout(m_DebugRender.GenericLayout);
 			}
 
-			FillCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+			vsCB = UploadCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+			SetCBuffer(eShaderStage_Vertex, 0, vsCB);
 
 			D3D11_MAPPED_SUBRESOURCE mapped;
 			HRESULT hr = S_OK;
@@ -5247,7 +6086,8 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 
 			// Draw active primitive (red)
 			pixelData.WireframeColour = Vec3f(1.0f, 0.0f, 0.0f);
-			FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			SetCBuffer(eShaderStage_Pixel, 0, psCB);
 
 			if(activePrim.size() >= primSize)
 			{
@@ -5267,7 +6107,8 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 
 			// Draw adjacent primitives (green)
 			pixelData.WireframeColour = Vec3f(0.0f, 1.0f, 0.0f);
-			FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			SetCBuffer(eShaderStage_Pixel, 0, psCB);
 
 			if(adjacentPrimVertices.size() >= primSize && (adjacentPrimVertices.size() % primSize) == 0)
 			{
@@ -5291,11 +6132,13 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 			float asp = float(GetWidth())/float(GetHeight());
 
 			vertexData.SpriteSize = Vec2f(scale/asp, scale);
-			FillCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+			vsCB = UploadCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+			SetCBuffer(eShaderStage_Vertex, 0, vsCB);
 
 			// Draw active vertex (blue)
 			pixelData.WireframeColour = Vec3f(0.0f, 0.0f, 1.0f);
-			FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			SetCBuffer(eShaderStage_Pixel, 0, psCB);
 
 			m_pImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
@@ -5321,7 +6164,8 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 
 			// Draw inactive vertices (green)
 			pixelData.WireframeColour = Vec3f(0.0f, 1.0f, 0.0f);
-			FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+			SetCBuffer(eShaderStage_Pixel, 0, psCB);
 
 			for(size_t i=0; i < inactiveVertices.size(); i++)
 			{
@@ -5354,14 +6198,16 @@ void D3D11DebugManager::RenderMesh(uint32_t frameID, uint32_t eventID, const vec
 
 		vertexData.SpriteSize = Vec2f();
 		vertexData.ModelViewProj = projMat.Mul(camMat.Mul(guessProjInv));
-		FillCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+		vsCB = UploadCBuffer(m_DebugRender.GenericVSCBuffer, (float *)&vertexData, sizeof(DebugVertexCBuffer));
+		SetCBuffer(eShaderStage_Vertex, 0, vsCB);
 
 		m_pImmediateContext->IASetVertexBuffers(0, 1, &m_FrustumHelper, (UINT *)&strides, (UINT *)&offsets);
 		m_pImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
 		m_pImmediateContext->IASetInputLayout(m_DebugRender.GenericLayout);
 
 		pixelData.WireframeColour = Vec3f(1.0f, 1.0f, 1.0f);
-		FillCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+		psCB = UploadCBuffer(m_DebugRender.GenericPSCBuffer, (float *)&pixelData, sizeof(DebugPixelCBufferData));
+		SetCBuffer(eShaderStage_Pixel, 0, psCB);
 
 		m_pImmediateContext->Draw(24, 0);
 	}
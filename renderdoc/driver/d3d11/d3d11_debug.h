@@ -34,6 +34,7 @@ using std::map;
 using std::pair;
 
 #include "api/replay/renderdoc_replay.h"
+#include "replay/replay_driver.h"
 
 #include "driver/d3d11/shaders/dxbc_debug.h"
 
@@ -46,6 +47,7 @@ class WrappedID3D11DeviceContext;
 struct DrawcallTreeNode;
 
 struct CounterContext;
+class IHardwareCounters;
 
 class D3D11ResourceManager;
 
@@ -72,11 +74,15 @@ struct PostVSData
 		float farPlane;
 	} vsin, vsout, gsout;
 
+	// when this was last fetched, for evicting from the cache
+	uint64_t lastUse;
+
 	PostVSData()
 	{
 		RDCEraseEl(vsin);
 		RDCEraseEl(vsout);
 		RDCEraseEl(gsout);
+		lastUse = 0;
 	}
 
 	const StageData &GetStage(MeshDataStage type)
@@ -143,7 +149,10 @@ class D3D11DebugManager
 		void DescribeCounter(uint32_t counterID, CounterDescription &desc);
 		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters);
 
+		// queues text for the overlay, in character cells from the top left. Nothing is
+		// drawn until FlushText(), which draws everything queued in one go
 		void RenderText(float x, float y, const char *textfmt, ...);
+		void FlushText();
 		void RenderMesh(uint32_t frameID, uint32_t eventID, const vector<MeshFormat> &secondaryDraws, MeshDisplay cfg);
 
 		ID3D11Buffer *MakeCBuffer(float *data, size_t size);
@@ -160,8 +169,49 @@ class D3D11DebugManager
 
 		ID3D11Buffer *MakeCBuffer(UINT size);
 
+		// shaders emulating a texture sampling instruction while debugging. Their source only
+		// depends on the instruction, with parameters in a constant buffer, so each is compiled
+		// once per replay. The cache owns the returned shaders.
+		ID3D11VertexShader *GetDebugSampleVS(const string &source);
+		ID3D11PixelShader *GetDebugSamplePS(const string &source);
+
+		// 1x1 render target and readback copy for one sample result, cached per format
+		struct DebugSampleTarget
+		{
+			DebugSampleTarget() : tex(NULL), readback(NULL), rtv(NULL) {}
+
+			ID3D11Texture2D *tex;
+			ID3D11Texture2D *readback;
+			ID3D11RenderTargetView *rtv;
+		};
+
+		bool GetDebugSampleTarget(DXGI_FORMAT fmt, DebugSampleTarget &target);
+
+		// constant buffer data for a single debug draw. With D3D11.1 constant buffer offsetting
+		// this is a window into a shared ring buffer, so there's no Map/DISCARD on a dedicated
+		// buffer per draw. Otherwise it's just the fallback buffer, filled as before.
+		struct DebugCBuffer
+		{
+			DebugCBuffer() : buf(NULL), firstConstant(0), numConstants(0) {}
+
+			ID3D11Buffer *buf;
+			UINT firstConstant, numConstants; // numConstants is 0 for a whole-buffer binding
+		};
+
+		DebugCBuffer UploadCBuffer(ID3D11Buffer *fallback, const void *data, size_t size);
+		void SetCBuffer(ShaderStageType stage, UINT slot, const DebugCBuffer &cb);
+
 		bool RenderTexture(TextureDisplay cfg, bool blendAlpha);
 
+		// the contents of textures may have changed, so previews must be regenerated
+		void InvalidateTexturePreviews() { m_PreviewGeneration++; }
+
+		// resource replacements can change what a debugged shader reads, so the cached
+		// shader debugging readbacks can't be reused
+		void InvalidateShaderGlobalState() { m_GlobalStateCache.valid = false; }
+		void InvalidateQuadOverdraw() { m_QuadOverdraw.lastEvent = 0; }
+		void ClearOverlayCache();
+
 		void RenderCheckerboard(Vec3f light, Vec3f dark);
 
 		void RenderHighlightBox(float w, float h, float scale);
@@ -262,6 +312,69 @@ class D3D11DebugManager
 
 		CacheElem &GetCachedElem(ResourceId id, bool raw);
 
+		// downsampled copies of large textures, for displaying them zoomed out. Level N of a
+		// preview holds mip N+1 of one slice of the texture's top mip.
+		struct TexturePreview
+		{
+			TexturePreview() : id(), slice(0), levels(0), generation(0), tex(NULL), srv(NULL) {}
+
+			void Release()
+			{
+				SAFE_RELEASE(tex);
+				SAFE_RELEASE(srv);
+			}
+
+			ResourceId id;
+			UINT slice;
+			UINT levels;
+			uint32_t generation;
+			ID3D11Texture2D *tex;
+			ID3D11ShaderResourceView *srv;
+		};
+
+		static const UINT PreviewMinSize = 4096;
+		static const size_t NUM_CACHED_PREVIEWS = 4;
+
+		std::list<TexturePreview> m_TexturePreviews;
+		uint32_t m_PreviewGeneration;
+
+		ID3D11ShaderResourceView *GetTexturePreview(ResourceId id, const TextureShaderDetails &details, UINT slice, UINT &levels);
+
+		// staging and intermediate textures used when reading back texture data. Fetching
+		// every mip/slice of a texture would otherwise create and destroy the same textures
+		// over and over, so they're kept around and handed out again when the desc matches.
+		struct PooledTexture
+		{
+			ID3D11Resource *tex;
+			D3D11_RESOURCE_DIMENSION dim;
+			union
+			{
+				D3D11_TEXTURE1D_DESC desc1D;
+				D3D11_TEXTURE2D_DESC desc2D;
+				D3D11_TEXTURE3D_DESC desc3D;
+			};
+			uint64_t size;
+			uint64_t lastUse;
+			bool inUse;
+		};
+
+		// how much memory we're willing to keep in textures that aren't in use
+		static const uint64_t TexturePoolBudget = 256*1024*1024;
+
+		vector<PooledTexture> m_TexturePool;
+		uint64_t m_TexturePoolCounter;
+
+		HRESULT GetPooledTexture(const D3D11_TEXTURE1D_DESC &desc, ID3D11Texture1D **tex);
+		HRESULT GetPooledTexture(const D3D11_TEXTURE2D_DESC &desc, ID3D11Texture2D **tex);
+		HRESULT GetPooledTexture(const D3D11_TEXTURE3D_DESC &desc, ID3D11Texture3D **tex);
+		PooledTexture *FindPooledTexture(D3D11_RESOURCE_DIMENSION dim, const void *desc, size_t descSize);
+		void AddPooledTexture(ID3D11Resource *tex, D3D11_RESOURCE_DIMENSION dim, const void *desc, size_t descSize, uint64_t size);
+		void ReturnPooledTexture(ID3D11Resource *tex);
+		void TrimTexturePool(uint64_t budget);
+
+		// returns false if the copy needs the graphics path, e.g. for depth formats
+		bool CopyTex2DMSToArrayCompute(ID3D11Texture2D *destArray, ID3D11Texture2D *srcMS);
+
 		int m_width, m_height;
 		float m_supersamplingX, m_supersamplingY;
 
@@ -297,6 +410,10 @@ class D3D11DebugManager
 		bool m_ShaderCacheDirty, m_CacheShaders;
 		map<uint32_t, ID3DBlob*> m_ShaderCache;
 
+		map<string, ID3D11VertexShader*> m_DebugSampleVS;
+		map<string, ID3D11PixelShader*> m_DebugSamplePS;
+		map<DXGI_FORMAT, DebugSampleTarget> m_DebugSampleTargets;
+
 		static const int m_SOBufferSize = 32*1024*1024;
 		ID3D11Buffer *m_SOBuffer;
 		ID3D11Buffer *m_SOStagingBuffer;
@@ -304,6 +421,14 @@ class D3D11DebugManager
 		// <frame,event> -> data
 		map<pair<uint32_t,uint32_t>, PostVSData> m_PostVSData;
 
+		// once the post-transform buffers held in m_PostVSData add up to more than this,
+		// the least recently used events' are released
+		static const uint64_t PostVSCacheBudget = 256*1024*1024;
+		uint64_t m_PostVSUseCounter;
+
+		void CreatePostVSBuffers(uint32_t frameID, uint32_t eventID);
+		void TrimPostVSCache();
+
 		// simple cache for when we need buffer data for highlighting
 		// vertices, typical use will be lots of vertices in the same
 		// mesh, not jumping back and forth much between meshes.
@@ -323,6 +448,37 @@ class D3D11DebugManager
 		ID3D11Texture2D *m_OverlayRenderTex;
 		ResourceId m_OverlayResourceId;
 
+		// the quad overdraw pass overlay accumulates into this, and it's kept holding every
+		// draw in the pass from firstEvent up to lastEvent (0 if nothing is cached) so that
+		// stepping forward through a pass only needs to add the new draws
+		struct QuadOverdrawCache
+		{
+			ID3D11Texture2D *tex;
+			ID3D11ShaderResourceView *srv;
+			ID3D11UnorderedAccessView *uav;
+			uint32_t width, height;
+			uint32_t frameID, firstEvent, lastEvent;
+		} m_QuadOverdraw;
+
+		// copies of recently rendered overlays, most recent first, so that flipping back to a
+		// texture or event that was just viewed doesn't render the overlay again
+		struct CachedOverlay
+		{
+			ResourceId texid;
+			TextureDisplayOverlay overlay;
+			uint32_t frameID, eventID;
+			vector<uint32_t> passEvents;
+			ID3D11Texture2D *tex;
+			uint64_t bytes;
+		};
+
+		static const uint64_t OverlayCacheBudget = 128*1024*1024;
+
+		std::list<CachedOverlay> m_OverlayCache;
+		uint64_t m_OverlayCacheBytes;
+
+		void CacheOverlay(ResourceId texid, TextureDisplayOverlay overlay, uint32_t frameID, uint32_t eventID, const vector<uint32_t> &passEvents);
+
 		ID3D11Texture2D* m_CustomShaderTex;
 		ID3D11RenderTargetView* m_CustomShaderRTV;
 		ResourceId m_CustomShaderResourceId;
@@ -338,6 +494,13 @@ class D3D11DebugManager
 		// whenever these change
 		ResourceFormat m_PrevMeshFmt;
 		ResourceFormat m_PrevMeshFmt2;
+
+		// secondary draws packed into one vertex/index buffer, rebuilt when the draws change
+		SecondaryMeshArena m_SecondaryArena;
+		ID3D11Buffer *m_SecondaryArenaVB;
+		ID3D11Buffer *m_SecondaryArenaIB;
+
+		void UpdateSecondaryArena(const vector<MeshFormat> &secondaryDraws);
 		
 		ID3D11Buffer *m_AxisHelper;
 		ID3D11Buffer *m_FrustumHelper;
@@ -360,7 +523,7 @@ class D3D11DebugManager
 
 		static const int FONT_TEX_WIDTH = 256;
 		static const int FONT_TEX_HEIGHT = 128;
-		static const int FONT_MAX_CHARS = 256;
+		static const int FONT_MAX_BATCH_CHARS = 4096;
 
 		static const uint32_t STAGE_BUFFER_BYTE_SIZE = 4*1024*1024;
 
@@ -391,6 +554,15 @@ class D3D11DebugManager
 			float CharSize;
 		} m_Font;
 
+		// per-instance data for one character of queued text
+		struct FontChar
+		{
+			float x, y;
+			uint32_t glyph;
+		};
+
+		vector<FontChar> m_PendingText;
+
 		struct DebugRenderData
 		{
 			DebugRenderData() { RDCEraseMem(this, sizeof(DebugRenderData)); }
@@ -433,6 +605,8 @@ class D3D11DebugManager
 				SAFE_RELEASE(FloatCopyArrayToMSPS);
 				SAFE_RELEASE(DepthCopyMSToArrayPS);
 				SAFE_RELEASE(DepthCopyArrayToMSPS);
+				SAFE_RELEASE(CopyMSToArrayCS);
+				SAFE_RELEASE(FloatCopyMSToArrayCS);
 				SAFE_RELEASE(PixelHistoryUnusedCS);
 				SAFE_RELEASE(PixelHistoryCopyCS);
 				SAFE_RELEASE(PrimitiveIDPS);
@@ -478,6 +652,9 @@ class D3D11DebugManager
 				{
 					SAFE_RELEASE(PublicCBuffers[i]);
 				}
+
+				SAFE_RELEASE(CBufferRing);
+				SAFE_RELEASE(ImmediateContext1);
 			}
 
 			ID3D11Buffer *StageBuffer;
@@ -499,6 +676,7 @@ class D3D11DebugManager
 			ID3D11PixelShader *CopyMSToArrayPS, *CopyArrayToMSPS;
 			ID3D11PixelShader *FloatCopyMSToArrayPS, *FloatCopyArrayToMSPS;
 			ID3D11PixelShader *DepthCopyMSToArrayPS, *DepthCopyArrayToMSPS;
+			ID3D11ComputeShader *CopyMSToArrayCS, *FloatCopyMSToArrayCS;
 			ID3D11ComputeShader *PixelHistoryUnusedCS, *PixelHistoryCopyCS;
 			ID3D11PixelShader *PrimitiveIDPS;
 
@@ -521,14 +699,42 @@ class D3D11DebugManager
 
 			int publicCBufIdx;
 
+			// only created if the device supports constant buffer offsetting and
+			// NO_OVERWRITE maps on dynamic constant buffers
+			static const UINT CBufferRingSize = 1024*1024;
+			ID3D11DeviceContext1 *ImmediateContext1;
+			ID3D11Buffer *CBufferRing;
+			UINT cbufferRingOffset;
+
 			ID3D11RenderTargetView *PickPixelRT;
 			ID3D11Texture2D *PickPixelStageTex;
 		} m_DebugRender;
 
 		bool InitDebugRendering();
 
+		// in a headless replay the debug rendering, stream-out and font resources are each
+		// created by these the first time a function needs them, instead of at startup
+		bool m_DebugRenderingInit, m_StreamOutInit, m_FontRenderingInit;
+		void EnsureDebugRendering();
+		void EnsureStreamOut();
+		void EnsureFontRendering();
+
 		ShaderDebug::State CreateShaderDebugState(ShaderDebugTrace &trace, int quadIdx, DXBC::DXBCFile *dxbc, vector<byte> *cbufData);
-		void CreateShaderGlobalState(ShaderDebug::GlobalState &global, DXBC::DXBCFile *dxbc, uint32_t UAVStartSlot, ID3D11UnorderedAccessView **UAVs, ID3D11ShaderResourceView **SRVs);
+		void CreateShaderGlobalState(ShaderDebug::GlobalState &global, uint32_t frameID, uint32_t eventID, DXBC::DXBCFile *dxbc,
+		                             uint32_t UAVStartSlot, ID3D11UnorderedAccessView **UAVs, ID3D11ShaderResourceView **SRVs);
+
+		// the resource readbacks from the last shader debugged. Debugging another pixel,
+		// vertex or thread at the same event with the same bindings reuses them.
+		struct GlobalStateCache
+		{
+			bool valid;
+			uint32_t frameID, eventID;
+			DXBC::DXBCFile *dxbc;
+			uint32_t UAVStartSlot;
+			ID3D11UnorderedAccessView *UAVs[D3D11_PS_CS_UAV_REGISTER_COUNT];
+			ID3D11ShaderResourceView *SRVs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+			ShaderDebug::GlobalState global;
+		} m_GlobalStateCache;
 		void FillCBufferVariables(const string &prefix, size_t &offset, bool flatten,
 								  const vector<DXBC::CBufferVariable> &invars, vector<ShaderVariable> &outvars,
 								  const vector<byte> &data);
@@ -540,7 +746,14 @@ class D3D11DebugManager
 		// called before the device is shutdown, to shutdown any counters
 		void PreDeviceShutdownCounters();
 
-		void FillTimers(CounterContext &ctx, const DrawcallTreeNode &drawnode);
+		// vendor counter libraries that loaded and accepted the device
+		vector<IHardwareCounters *> m_HardwareCounters;
+
+		IHardwareCounters *GetHardwareCounters(uint32_t counterID);
+		void FetchHardwareCounters(IHardwareCounters *hw, uint32_t frameID, uint32_t minEventID, uint32_t maxEventID,
+		                           const vector<uint32_t> &counters, vector<CounterResult> &results);
+
+		void FillQueries(CounterContext &ctx, const DrawcallTreeNode &drawnode);
 		
 		void FillCBuffer(ID3D11Buffer *buf, float *data, size_t size);
 };
\ No newline at end of file
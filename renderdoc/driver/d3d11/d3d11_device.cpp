@@ -35,7 +35,6 @@
 #include "driver/d3d11/d3d11_renderstate.h"
 #include "driver/d3d11/d3d11_context.h"
 
-#include "jpeg-compressor/jpge.h"
 
 #if defined(INCLUDE_D3D_11_1)
 #include <d3d11shadertracing.h>
@@ -184,6 +183,8 @@ const char *D3D11ChunkNames[] =
 
 	"ContextBegin",
 	"ContextEnd",
+
+	"ShaderBytecode",
 };
 
 WRAPPED_POOL_INST(WrappedID3D11Device);
@@ -207,6 +208,11 @@ const uint32_t D3D11InitParams::D3D11_OLD_VERSIONS[D3D11InitParams::D3D11_NUM_SU
 	0x0000004, // from 0x4 to 0x5, we added the stream-out hidden counters in the context's Serialise_BeginCaptureFrame
 	0x0000005, // from 0x5 to 0x6, several new calls were made 'drawcalls', like Copy & GenerateMips, with serialised debug messages
 	0x0000006, // from 0x6 to 0x7, we added some more padding in some buffer & texture chunks to get larger alignment than 16-byte
+	0x0000007, // from 0x7 to 0x8, texture initial contents can be stored in separate chunks, possibly as deltas against earlier logs
+	0x0000008, // from 0x8 to 0x9, shader bytecode is stored once per unique blob and referenced from shader creation chunks
+	0x0000009, // from 0x9 to 0xA, draw and dispatch parameters and debug message counts are stored as varints
+	0x000000A, // from 0xA to 0xB, ResourceIds are stored as varints
+	0x000000B, // from 0xB to 0xC, events only store how many debug messages they raised, and the messages are stored at the end of the frame
 };
 
 ReplayCreateStatus D3D11InitParams::Serialise()
@@ -260,6 +266,10 @@ void WrappedID3D11Device::SetLogFile(const char *logfile)
 WrappedID3D11Device::WrappedID3D11Device(ID3D11Device* realDevice, D3D11InitParams *params)
 	: m_RefCounter(realDevice, false), m_SoftRefCounter(NULL, false), m_pDevice(realDevice)
 {
+	// first device/context in a bootstrapped process finishes initialising RenderDoc
+	RenderDoc::Inst().EnsureInitialised();
+	RenderDoc::Inst().EnsureCrashHandler();
+
 	if(RenderDoc::Inst().GetCrashHandler())
 		RenderDoc::Inst().GetCrashHandler()->RegisterMemoryRegion(this, sizeof(WrappedID3D11Device));
 
@@ -292,6 +302,19 @@ WrappedID3D11Device::WrappedID3D11Device(ID3D11Device* realDevice, D3D11InitPara
 	m_FrameTimer.Restart();
 
 	m_AppControlledCapture = false;
+	m_CaptureFramesLeft = 0;
+	m_RetroFrame = false;
+
+	m_HeldCmdListMemory = 0;
+
+	m_ReplayPos = eReplayPos_Unknown;
+	m_ReplayPosFrame = 0;
+	m_ReplayPosEvent = 0;
+
+	m_CheckpointMemory = 0;
+	m_CheckpointCounter = 0;
+	m_CheckpointsPrepared = false;
+	m_CheckpointsDisabled = false;
 
 	m_TotalTime = m_AvgFrametime = m_MinFrametime = m_MaxFrametime = 0.0;
 
@@ -310,6 +333,9 @@ WrappedID3D11Device::WrappedID3D11Device(ID3D11Device* realDevice, D3D11InitPara
 		m_pDebugSerialiser = NULL;
 
 		TrackedResource::SetReplayResourceIDs();
+
+		// the same shaders are parsed every time a log is replayed
+		DXBC::DXBCFile::LoadReflectionCache();
 	}
 	else
 	{
@@ -355,6 +381,8 @@ WrappedID3D11Device::WrappedID3D11Device(ID3D11Device* realDevice, D3D11InitPara
 	realDevice->QueryInterface(__uuidof(ID3D11InfoQueue), (void **)&m_pInfoQueue);
 	realDevice->QueryInterface(__uuidof(ID3D11Debug), (void **)&m_WrappedDebug.m_pDebug);
 
+	m_DebugMessagesCounted = 0;
+
 	if(m_pInfoQueue)
 	{
 		m_pInfoQueue->SetMuteDebugOutput(true);
@@ -424,6 +452,8 @@ WrappedID3D11Device::~WrappedID3D11Device()
 
 	m_CachedStateObjects.clear();
 
+	InvalidateReplayCheckpoints();
+
 #if defined(INCLUDE_D3D_11_1)
 	SAFE_RELEASE(m_pDevice1);
 	SAFE_RELEASE(m_pDevice2);
@@ -436,6 +466,10 @@ WrappedID3D11Device::~WrappedID3D11Device()
 	
 	SAFE_DELETE(m_DebugManager);
 	
+	for(auto it = m_ShaderBytecodeRecords.begin(); it != m_ShaderBytecodeRecords.end(); ++it)
+		it->second->Delete(GetResourceManager());
+	m_ShaderBytecodeRecords.clear();
+
 	if(m_DeviceRecord)
 	{
 		RDCASSERT(m_DeviceRecord->GetRefCount() == 1);
@@ -457,6 +491,9 @@ WrappedID3D11Device::~WrappedID3D11Device()
 		SAFE_DELETE(it->second);
 	m_LayoutDXBC.clear();
 	m_LayoutDescs.clear();
+
+	if(RenderDoc::Inst().IsReplayApp())
+		DXBC::DXBCFile::SaveReflectionCache();
 	
 	if(RenderDoc::Inst().GetCrashHandler())
 		RenderDoc::Inst().GetCrashHandler()->UnregisterMemoryRegion(this);
@@ -714,6 +751,30 @@ void WrappedID3D11Device::AddDebugMessage(DebugMessageCategory c, DebugMessageSe
 	}
 }
 
+uint32_t WrappedID3D11Device::CountNewDebugMessages()
+{
+	if(!m_pInfoQueue)
+		return 0;
+
+	UINT64 numMessages = m_pInfoQueue->GetNumStoredMessagesAllowedByRetrievalFilter();
+
+	uint32_t ret = (uint32_t)(numMessages - m_DebugMessagesCounted);
+	m_DebugMessagesCounted = numMessages;
+
+	return ret;
+}
+
+void WrappedID3D11Device::ClearInfoQueue()
+{
+	if(!m_pInfoQueue)
+		return;
+
+	m_pInfoQueue->ClearStoredMessages();
+	m_pInfoQueue->SetMessageCountLimit(m_State == WRITING_CAPFRAME ? (UINT64)-1 : D3D11_INFO_QUEUE_DEFAULT_MESSAGE_COUNT_LIMIT);
+
+	m_DebugMessagesCounted = 0;
+}
+
 vector<DebugMessage> WrappedID3D11Device::GetDebugMessages()
 {
 	vector<DebugMessage> ret;
@@ -729,13 +790,20 @@ vector<DebugMessage> WrappedID3D11Device::GetDebugMessages()
 
 	UINT64 numMessages = m_pInfoQueue->GetNumStoredMessagesAllowedByRetrievalFilter();
 
-	for(UINT64 i=0; i < m_pInfoQueue->GetNumStoredMessagesAllowedByRetrievalFilter(); i++)
+	ret.reserve((size_t)numMessages);
+
+	// one buffer for all the messages, only grown when one doesn't fit
+	vector<char> msgbuf;
+
+	for(UINT64 i=0; i < numMessages; i++)
 	{
 		SIZE_T len = 0;
 		m_pInfoQueue->GetMessage(i, NULL, &len);
 
-		char *msgbuf = new char[len];
-		D3D11_MESSAGE *message = (D3D11_MESSAGE *)msgbuf;
+		if(msgbuf.size() < len)
+			msgbuf.resize(len);
+
+		D3D11_MESSAGE *message = (D3D11_MESSAGE *)&msgbuf[0];
 
 		m_pInfoQueue->GetMessage(i, message, &len);
 
@@ -815,8 +883,6 @@ vector<DebugMessage> WrappedID3D11Device::GetDebugMessages()
 		msg.description = string(message->pDescription);
 
 		ret.push_back(msg);
-
-		SAFE_DELETE_ARRAY(msgbuf);
 	}
 
 	// Docs are fuzzy on the thread safety of the info queue, but I'm going to assume it should only
@@ -827,7 +893,7 @@ vector<DebugMessage> WrappedID3D11Device::GetDebugMessages()
 	// best way if its member functions are thread safe themselves (if the queue is protected internally).
 	RDCASSERT(numMessages == m_pInfoQueue->GetNumStoredMessagesAllowedByRetrievalFilter());
 
-	m_pInfoQueue->ClearStoredMessages();
+	ClearInfoQueue();
 
 	return ret;
 }
@@ -867,6 +933,9 @@ void WrappedID3D11Device::ProcessChunk(uint64_t offset, D3D11ChunkType context)
 	case CREATE_BUFFER:
 		Serialise_CreateBuffer(0x0, 0x0, 0x0);
 		break;
+	case SHADER_BYTECODE:
+		Serialise_ShaderBytecode(ResourceId(), 0x0, 0);
+		break;
 	case CREATE_VERTEX_SHADER:
 		Serialise_CreateVertexShader(0x0, 0, 0x0, 0x0);
 		break;
@@ -964,8 +1033,23 @@ void WrappedID3D11Device::ProcessChunk(uint64_t offset, D3D11ChunkType context)
 	default:
 		// ignore system chunks
 		if(context == INITIAL_CONTENTS)
-			Serialise_InitialState(NULL);
-		else if(context < FIRST_CHUNK_ID)
+		{
+			uint64_t start = m_pSerialiser->GetOffset();
+
+			// peek at the resource the chunk is for, to see if it can be deferred
+			ResourceType type = Resource_Unknown;
+			ResourceId Id = ResourceId();
+			m_pSerialiser->Serialise("type", type);
+			m_pSerialiser->Serialise("Id", Id);
+			m_pSerialiser->SetOffset(start);
+
+			if(GetResourceManager()->DeferInitialState(offset, Id) || !Serialise_InitialState(NULL))
+			{
+				m_pSerialiser->SetOffset(start);
+				m_pSerialiser->SkipCurrentChunk();
+			}
+		}
+		else if(context < FIRST_CHUNK_ID || context == INITIAL_CONTENTS_DATA)
 			m_pSerialiser->SkipCurrentChunk();
 		else
 			m_pImmediateContext->ProcessChunk(offset, context, true);
@@ -973,6 +1057,34 @@ void WrappedID3D11Device::ProcessChunk(uint64_t offset, D3D11ChunkType context)
 	}
 }
 
+void WrappedID3D11Device::CreateDeferredInitialContents()
+{
+	if(!GetResourceManager()->HasDeferredInitialStates())
+		return;
+
+	// the main serialiser only keeps the frame itself in memory, so read the deferred
+	// chunks through another one on the same log
+	Serialiser ser(m_pSerialiser->GetFilename(), Serialiser::READING, false);
+	ser.SetDebugText(false);
+
+	if(ser.HasError())
+	{
+		RDCERR("Couldn't reopen '%s' to create initial contents", m_pSerialiser->GetFilename());
+		GetResourceManager()->CreateDeferredInitialStates(NULL);
+		return;
+	}
+
+	SCOPED_TIMER("deferred initial contents");
+
+	// Serialise_InitialState reads through the device's serialiser
+	Serialiser *prevSer = m_pSerialiser;
+	m_pSerialiser = &ser;
+
+	GetResourceManager()->CreateDeferredInitialStates(&ser);
+
+	m_pSerialiser = prevSer;
+}
+
 void WrappedID3D11Device::Serialise_CaptureScope(uint64_t offset)
 {
 	SERIALISE_ELEMENT(uint32_t, FrameNumber, m_FrameCounter);
@@ -1001,7 +1113,14 @@ void WrappedID3D11Device::ReadLogInitialisation()
 
 	LazyInit();
 
-	m_pSerialiser->SetDebugText(true);
+	// the initialisation chunks are only ever read once, so there's no point
+	// generating debug text for them. It's only enabled below for the frame's
+	// events, where it provides the event descriptions.
+	m_pSerialiser->SetDebugText(false);
+
+	// initial contents are created on the first replay instead, so the frame's events and
+	// resources are available as soon as the chunks have been read
+	GetResourceManager()->SetDeferInitialStates(true);
 
 	m_pSerialiser->Rewind();
 
@@ -1016,13 +1135,28 @@ void WrappedID3D11Device::ReadLogInitialisation()
 			if(firstFrame == 0)
 				firstFrame = m_pSerialiser->GetOffset();
 
-			// skip this chunk
+			// skip this chunk, but note which resources it needs initial contents for
+			// so that we don't create any that would just be thrown away.
 			m_pSerialiser->PushContext(NULL, CAPTURE_SCOPE, false);
+
+			uint64_t scopeStart = m_pSerialiser->GetOffset();
+
+			uint32_t FrameNumber = 0;
+			m_pSerialiser->Serialise("FrameNumber", FrameNumber);
+			GetResourceManager()->PeekInitialContentsNeeded();
+
+			m_pSerialiser->SetOffset(scopeStart);
 			m_pSerialiser->SkipCurrentChunk();
 			m_pSerialiser->PopContext(NULL, CAPTURE_SCOPE);
 		}
 	}
 
+	// texture data may be stored apart from the initial contents, possibly in earlier logs
+	GetResourceManager()->LoadInitialContentsData();
+
+	// get the driver compiling shaders on other threads before we need them
+	PrecreateShaders();
+
 	m_pSerialiser->Rewind();
 
 	int chunkIdx = 0;
@@ -1057,9 +1191,13 @@ void WrappedID3D11Device::ReadLogInitialisation()
 
 		if(context == CAPTURE_SCOPE)
 		{
+			// this read builds the frame's events and drawcalls, which can read back buffers
+			// (e.g. indirect arguments), so apply everything but the deferred textures first.
 			GetResourceManager()->ApplyInitialContents();
 
+			m_pSerialiser->SetDebugText(true);
 			m_pImmediateContext->ReplayLog(READING, 0, 0, false);
+			m_pSerialiser->SetDebugText(false);
 		}
 
 		uint64_t offset2 = m_pSerialiser->GetOffset();
@@ -1080,6 +1218,10 @@ void WrappedID3D11Device::ReadLogInitialisation()
 		}
 	}
 
+	ReleasePrecreatedShaders();
+
+	GetResourceManager()->SetDeferInitialStates(false);
+
 	for(auto it=chunkInfos.begin(); it != chunkInfos.end(); ++it)
 	{
 		double dcount = double(it->second.count);
@@ -1158,7 +1300,7 @@ bool WrappedID3D11Device::Prepare_InitialState(ID3D11DeviceChild *res)
 			{
 				m_pImmediateContext->GetReal()->CopyStructureCount(stage, 0, UNWRAP(WrappedID3D11UnorderedAccessView, uav));
 
-				m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL));
+				m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL, desc.ByteWidth));
 			}
 		}
 	}
@@ -1186,7 +1328,7 @@ bool WrappedID3D11Device::Prepare_InitialState(ID3D11DeviceChild *res)
 		{
 			m_pImmediateContext->GetReal()->CopyResource(stage, UNWRAP(WrappedID3D11Buffer, buf));
 
-			m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL));
+			m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL, desc.ByteWidth));
 		}
 	}
 	else if(type == Resource_Texture1D)
@@ -1217,7 +1359,11 @@ bool WrappedID3D11Device::Prepare_InitialState(ID3D11DeviceChild *res)
 		{
 			m_pImmediateContext->GetReal()->CopyResource(stage, UNWRAP(WrappedID3D11Texture1D, tex1D));
 
-			m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL));
+			uint64_t size = 0;
+			for(UINT i=0; i < numSubresources; i++)
+				size += GetByteSize(stage, i);
+
+			m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL, size));
 		}
 	}
 	else if(type == Resource_Texture2D)
@@ -1295,7 +1441,12 @@ bool WrappedID3D11Device::Prepare_InitialState(ID3D11DeviceChild *res)
 				SAFE_RELEASE(mutex);
 			}
 
-			m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL));
+			// multisampled textures are staged with each sample in its own slice
+			uint64_t size = 0;
+			for(UINT i=0; i < stageDesc.MipLevels*stageDesc.ArraySize; i++)
+				size += GetByteSize(stage, i);
+
+			m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL, size));
 		}
 	}
 	else if(type == Resource_Texture3D)
@@ -1326,13 +1477,67 @@ bool WrappedID3D11Device::Prepare_InitialState(ID3D11DeviceChild *res)
 		{
 			m_pImmediateContext->GetReal()->CopyResource(stage, UNWRAP(WrappedID3D11Texture3D, tex3D));
 
-			m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL));
+			uint64_t size = 0;
+			for(UINT i=0; i < numSubresources; i++)
+				size += GetByteSize(stage, i);
+
+			m_ResourceManager->SetInitialContents(Id, D3D11ResourceManager::InitialContentData(stage, 0, NULL, size));
 		}
 	}
 
 	return true;
 }
 
+struct MappedRowCopy
+{
+	byte *dst;
+	const byte *src;
+	size_t rowLen;
+	size_t dstPitch, srcPitch;
+	size_t dstSlicePitch, srcSlicePitch;
+	size_t rowsPerSlice;
+};
+
+static void CopyMappedRowRange(void *userData, size_t begin, size_t end)
+{
+	MappedRowCopy *copy = (MappedRowCopy *)userData;
+
+	for(size_t i=begin; i < end; i++)
+	{
+		size_t slice = i / copy->rowsPerSlice;
+		size_t row = i % copy->rowsPerSlice;
+
+		memcpy(copy->dst + slice*copy->dstSlicePitch + row*copy->dstPitch,
+					copy->src + slice*copy->srcSlicePitch + row*copy->srcPitch, copy->rowLen);
+	}
+}
+
+// repack rows (of pixels or blocks) from a mapped staging subresource into tightly packed memory.
+// Large render targets are hundreds of MB at the end of a capture, so the copies are split
+// across threads - the map itself has to stay on this thread.
+static void CopyMappedRows(byte *dst, size_t dstPitch, size_t dstSlicePitch,
+																							 const byte *src, size_t srcPitch, size_t srcSlicePitch,
+																							 size_t rowsPerSlice, size_t numSlices)
+{
+	if(rowsPerSlice == 0 || numSlices == 0)
+		return;
+
+	MappedRowCopy copy;
+	copy.dst = dst;
+	copy.src = src;
+	copy.rowLen = dstPitch;
+	copy.dstPitch = dstPitch;
+	copy.srcPitch = srcPitch;
+	copy.dstSlicePitch = dstSlicePitch;
+	copy.srcSlicePitch = srcSlicePitch;
+	copy.rowsPerSlice = rowsPerSlice;
+
+	// don't bother with threads unless each gets about a megabyte to copy
+	size_t minRowsPerThread = RDCMAX((size_t)1, (size_t)(1024*1024)/RDCMAX((size_t)1, dstPitch));
+
+	Threading::ParallelFor(rowsPerSlice*numSlices, minRowsPerThread, &CopyMappedRowRange, &copy);
+}
+
 bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 {
 	ResourceType type = Resource_Unknown;
@@ -1353,6 +1558,10 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 	{
 		m_pSerialiser->Serialise("type", type);
 		m_pSerialiser->Serialise("Id", Id);
+
+		// no frame in the log uses these, don't bother creating them
+		if(!m_ResourceManager->IsInitialContentsNeeded(Id))
+			return false;
 	}
 	
 	{
@@ -1512,6 +1721,10 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 				
 				if(m_State >= WRITING)
 				{
+					// not prepared again since it was last written, no need to map it
+					if(GetResourceManager()->SerialiseUnchangedInitialData(Id, sub))
+						continue;
+
 					D3D11_MAPPED_SUBRESOURCE mapped;
 
 					HRESULT hr = m_pImmediateContext->GetReal()->Map(stage, sub, D3D11_MAP_READ, 0, &mapped);
@@ -1533,7 +1746,7 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 					}
 
 					size_t len = dstPitch;
-					m_pSerialiser->SerialiseBuffer("", inmemBuffer, len);
+					GetResourceManager()->SerialiseInitialData(Id, sub, inmemBuffer, len);
 
 					if(SUCCEEDED(hr))
 						m_pImmediateContext->GetReal()->Unmap(stage, 0);
@@ -1542,7 +1755,7 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 				{
 					byte *data = NULL;
 					size_t len = 0;
-					m_pSerialiser->SerialiseBuffer("", data, len);
+					GetResourceManager()->SerialiseInitialData(Id, sub, data, len);
 
 					if(tex1D)
 					{
@@ -1654,6 +1867,10 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 				
 				if(m_State >= WRITING)
 				{
+					// not prepared again since it was last written, no need to map it
+					if(GetResourceManager()->SerialiseUnchangedInitialData(Id, sub))
+						continue;
+
 					D3D11_MAPPED_SUBRESOURCE mapped;
 
 					HRESULT hr = m_pImmediateContext->GetReal()->Map(stage, sub, D3D11_MAP_READ, 0, &mapped);
@@ -1671,17 +1888,12 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 					}
 					else
 					{
-						byte *dst = inmemBuffer;
-						byte *src = (byte *)mapped.pData;
-						for(uint32_t row=0; row < desc.Height>>mip; row += rowsPerLine)
-						{
-							memcpy(dst, src, dstPitch);
-							dst += dstPitch;
-							src += mapped.RowPitch;
-						}
+						uint32_t numRows = ((desc.Height>>mip) + rowsPerLine - 1)/rowsPerLine;
+
+						CopyMappedRows(inmemBuffer, dstPitch, 0, (byte *)mapped.pData, mapped.RowPitch, 0, numRows, 1);
 					}
 
-					m_pSerialiser->SerialiseBuffer("", inmemBuffer, len);
+					GetResourceManager()->SerialiseInitialData(Id, sub, inmemBuffer, len);
 
 					m_pImmediateContext->GetReal()->Unmap(stage, sub);
 				}
@@ -1689,7 +1901,7 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 				{
 					byte *data = NULL;
 					size_t len = 0;
-					m_pSerialiser->SerialiseBuffer("", data, len);
+					GetResourceManager()->SerialiseInitialData(Id, sub, data, len);
 
 					if(tex2D)
 					{
@@ -1824,6 +2036,10 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 				
 				if(m_State >= WRITING)
 				{
+					// not prepared again since it was last written, no need to map it
+					if(GetResourceManager()->SerialiseUnchangedInitialData(Id, sub))
+						continue;
+
 					D3D11_MAPPED_SUBRESOURCE mapped;
 
 					HRESULT hr = m_pImmediateContext->GetReal()->Map(stage, sub, D3D11_MAP_READ, 0, &mapped);
@@ -1841,28 +2057,15 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 					}
 					else
 					{
-						byte *dst = inmemBuffer;
-						byte *src = (byte *)mapped.pData;
+						uint32_t numRows = (RDCMAX(1U,desc.Height>>mip) + rowsPerLine - 1)/rowsPerLine;
+						uint32_t numSlices = RDCMAX(1U,desc.Depth>>mip);
 
-						for(uint32_t slice=0; slice < RDCMAX(1U,desc.Depth>>mip); slice++)
-						{
-							byte *sliceDst = dst;
-							byte *sliceSrc = src;
-
-							for(uint32_t row=0; row < RDCMAX(1U,desc.Height>>mip); row += rowsPerLine)
-							{
-								memcpy(sliceDst, sliceSrc, dstPitch);
-								sliceDst += dstPitch;
-								sliceSrc += mapped.RowPitch;
-							}
-
-							dst += dstSlicePitch;
-							src += mapped.DepthPitch;
-						}
+						CopyMappedRows(inmemBuffer, dstPitch, dstSlicePitch, (byte *)mapped.pData, mapped.RowPitch, mapped.DepthPitch,
+											numRows, numSlices);
 					}
 
 					size_t len = dstSlicePitch*desc.Depth;
-					m_pSerialiser->SerialiseBuffer("", inmemBuffer, len);
+					GetResourceManager()->SerialiseInitialData(Id, sub, inmemBuffer, len);
 
 					m_pImmediateContext->GetReal()->Unmap(stage, 0);
 				}
@@ -1870,7 +2073,7 @@ bool WrappedID3D11Device::Serialise_InitialState(ID3D11DeviceChild *res)
 				{
 					byte *data = NULL;
 					size_t len = 0;
-					m_pSerialiser->SerialiseBuffer("", data, len);
+					GetResourceManager()->SerialiseInitialData(Id, sub, data, len);
 
 					if(tex3D)
 					{
@@ -2245,6 +2448,8 @@ void WrappedID3D11Device::SetContextFilter(ResourceId id, uint32_t firstDefEv, u
 	m_ReplayDefCtx = id;
 	m_FirstDefEv = firstDefEv;
 	m_LastDefEv = lastDefEv;
+
+	m_ReplayPos = eReplayPos_Unknown;
 }
 
 void WrappedID3D11Device::ReplayLog(uint32_t frameID, uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType)
@@ -2257,10 +2462,35 @@ void WrappedID3D11Device::ReplayLog(uint32_t frameID, uint32_t startEventID, uin
 
 	bool partial = true;
 
+	ReplayCheckpoint *checkpoint = NULL;
+
+	bool incremental = (replayType == eReplay_WithoutDrawIncremental);
+	if(incremental)
+		replayType = eReplay_WithoutDraw;
+
+	ReplayPosition prevPos = m_ReplayPos;
+	m_ReplayPos = eReplayPos_Unknown;
+
 	if(startEventID == 0 && (replayType == eReplay_WithoutDraw || replayType == eReplay_Full))
 	{
-		startEventID = m_FrameRecord[frameID].frameInfo.firstEvent;
-		partial = false;
+		// only replays for inspecting state start from a checkpoint. Full replays are used to time
+		// or count the whole range of events, so they always run it all.
+		if(m_ReplayDefCtx == ResourceId() && replayType == eReplay_WithoutDraw)
+			checkpoint = FindReplayCheckpoint(frameID, endEventID);
+
+		if(incremental && m_ReplayDefCtx == ResourceId() &&
+			 prevPos == eReplayPos_AfterDraw && m_ReplayPosFrame == frameID && m_ReplayPosEvent < endEventID &&
+			 (checkpoint == NULL || checkpoint->eventID <= m_ReplayPosEvent))
+		{
+			// the frame is already replayed up to an earlier event, so carry on from there.
+			startEventID = m_pImmediateContext->GetNextEventID(m_ReplayPosEvent);
+			checkpoint = NULL;
+		}
+		else
+		{
+			startEventID = m_FrameRecord[frameID].frameInfo.firstEvent;
+			partial = false;
+		}
 	}
 	
 	D3D11ChunkType header = (D3D11ChunkType)m_pSerialiser->PushContext(NULL, 1, false);
@@ -2271,8 +2501,18 @@ void WrappedID3D11Device::ReplayLog(uint32_t frameID, uint32_t startEventID, uin
 
 	m_pSerialiser->PopContext(NULL, header);
 	
-	if(!partial)
+	if(checkpoint)
 	{
+		// the checkpoint stands in for the initial contents, and the rest of the frame is
+		// replayed on top of its state like any other partial replay.
+		ApplyReplayCheckpoint(*checkpoint);
+		startEventID = checkpoint->eventID;
+		partial = true;
+	}
+	else if(!partial)
+	{
+		CreateDeferredInitialContents();
+
 		GetResourceManager()->ApplyInitialContents();
 		GetResourceManager()->ReleaseInFrameResources();
 	}
@@ -2289,6 +2529,24 @@ void WrappedID3D11Device::ReplayLog(uint32_t frameID, uint32_t startEventID, uin
 			m_pImmediateContext->ReplayLog(EXECUTING, endEventID, endEventID, partial);
 		else
 			RDCFATAL("Unexpected replay type");
+
+		// if this replayed a long way from the start of the frame or the last checkpoint,
+		// snapshot where it got to so the next replay near here is short.
+		if(replayType == eReplay_WithoutDraw && (!partial || checkpoint) &&
+			 endEventID >= startEventID + CheckpointInterval)
+			AddReplayCheckpoint(frameID, endEventID);
+
+		if(incremental)
+		{
+			m_ReplayPos = eReplayPos_BeforeDraw;
+			m_ReplayPosFrame = frameID;
+			m_ReplayPosEvent = endEventID;
+		}
+		else if(replayType == eReplay_OnlyDraw && prevPos == eReplayPos_BeforeDraw &&
+			m_ReplayPosFrame == frameID && m_ReplayPosEvent == endEventID)
+		{
+			m_ReplayPos = eReplayPos_AfterDraw;
+		}
 	}
 	else
 	{
@@ -2326,6 +2584,346 @@ void WrappedID3D11Device::ReplayLog(uint32_t frameID, uint32_t startEventID, uin
 	}
 }
 
+WrappedID3D11Device::ReplayCheckpoint *WrappedID3D11Device::FindReplayCheckpoint(uint32_t frameID, uint32_t eventID)
+{
+	ReplayCheckpoint *ret = NULL;
+
+	for(size_t i=0; i < m_ReplayCheckpoints.size(); i++)
+	{
+		ReplayCheckpoint &c = m_ReplayCheckpoints[i];
+
+		if(c.frameID == frameID && c.eventID <= eventID && (ret == NULL || c.eventID > ret->eventID))
+			ret = &c;
+	}
+
+	if(ret)
+		ret->lastUse = ++m_CheckpointCounter;
+
+	return ret;
+}
+
+void WrappedID3D11Device::AddReplayCheckpoint(uint32_t frameID, uint32_t eventID)
+{
+	if(!m_CheckpointsPrepared)
+	{
+		m_CheckpointsPrepared = true;
+
+		// the hidden counters on append/consume UAVs can't be read back or restored
+		// without a dispatch, so don't try to snapshot frames that use them.
+		if(m_pImmediateContext->UsedUAVCounters())
+		{
+			RDCDEBUG("Not creating replay checkpoints, log uses UAV counters");
+			m_CheckpointsDisabled = true;
+		}
+		else
+		{
+			set<ResourceId> written;
+			m_pImmediateContext->GetWrittenResources(written);
+			m_CheckpointResources.assign(written.begin(), written.end());
+		}
+	}
+
+	// resources created in the frame are released at the start of a replay, so a
+	// checkpoint can only be made before the first one is created.
+	if(m_CheckpointsDisabled || GetResourceManager()->HasInFrameResources())
+		return;
+
+	ReplayCheckpoint checkpoint;
+	checkpoint.frameID = frameID;
+	checkpoint.eventID = eventID;
+	checkpoint.state = new D3D11RenderState(*m_pImmediateContext->GetCurrentPipelineState());
+	checkpoint.size = 0;
+	checkpoint.lastUse = ++m_CheckpointCounter;
+
+	ID3D11DeviceContext *ctx = m_pImmediateContext->GetReal();
+
+	bool success = true;
+
+	for(size_t i=0; success && i < m_CheckpointResources.size(); i++)
+	{
+		ResourceId id = m_CheckpointResources[i];
+
+		CheckpointContents c = { NULL, NULL, NULL, 0 };
+
+		HRESULT hr = S_OK;
+
+		if(WrappedID3D11Buffer::m_BufferList.find(id) != WrappedID3D11Buffer::m_BufferList.end())
+		{
+			ID3D11Buffer *buf = UNWRAP(WrappedID3D11Buffer, WrappedID3D11Buffer::m_BufferList[id].m_Buffer);
+
+			D3D11_BUFFER_DESC desc;
+			buf->GetDesc(&desc);
+
+			bool dynamic = (desc.Usage == D3D11_USAGE_DYNAMIC);
+
+			desc.Usage = dynamic ? D3D11_USAGE_STAGING : D3D11_USAGE_DEFAULT;
+			desc.CPUAccessFlags = dynamic ? D3D11_CPU_ACCESS_READ : 0;
+			desc.BindFlags = 0;
+			desc.MiscFlags = 0;
+			desc.StructureByteStride = 0;
+
+			ID3D11Buffer *copy = NULL;
+			hr = m_pDevice->CreateBuffer(&desc, NULL, &copy);
+
+			if(SUCCEEDED(hr))
+			{
+				ctx->CopyResource(copy, buf);
+
+				c.live = buf;
+				c.length = desc.ByteWidth;
+
+				if(dynamic)
+				{
+					D3D11_MAPPED_SUBRESOURCE mapped;
+					hr = ctx->Map(copy, 0, D3D11_MAP_READ, 0, &mapped);
+
+					if(SUCCEEDED(hr))
+					{
+						c.data = new byte[c.length];
+						memcpy(c.data, mapped.pData, c.length);
+						ctx->Unmap(copy, 0);
+					}
+
+					SAFE_RELEASE(copy);
+				}
+				else
+				{
+					c.copy = copy;
+				}
+			}
+		}
+		else if(WrappedID3D11Texture1D::m_TextureList.find(id) != WrappedID3D11Texture1D::m_TextureList.end())
+		{
+			ID3D11Texture1D *tex = UNWRAP(WrappedID3D11Texture1D, WrappedID3D11Texture1D::m_TextureList[id].m_Texture);
+
+			D3D11_TEXTURE1D_DESC desc;
+			tex->GetDesc(&desc);
+
+			success = (desc.Usage != D3D11_USAGE_DYNAMIC);
+
+			desc.CPUAccessFlags = 0;
+			desc.Usage = D3D11_USAGE_DEFAULT;
+			desc.BindFlags = 0;
+			if(IsDepthFormat(desc.Format))
+				desc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+			desc.MiscFlags &= ~D3D11_RESOURCE_MISC_GENERATE_MIPS;
+
+			ID3D11Texture1D *copy = NULL;
+			if(success)
+				hr = m_pDevice->CreateTexture1D(&desc, NULL, &copy);
+
+			if(copy)
+			{
+				ctx->CopyResource(copy, tex);
+
+				c.live = tex;
+				c.copy = copy;
+				for(UINT m=0; m < desc.MipLevels; m++)
+					c.length += GetByteSize(desc.Width, 1, 1, desc.Format, m)*desc.ArraySize;
+			}
+		}
+		else if(WrappedID3D11Texture2D::m_TextureList.find(id) != WrappedID3D11Texture2D::m_TextureList.end())
+		{
+			ID3D11Texture2D *tex = UNWRAP(WrappedID3D11Texture2D, WrappedID3D11Texture2D::m_TextureList[id].m_Texture);
+
+			D3D11_TEXTURE2D_DESC desc;
+			tex->GetDesc(&desc);
+
+			bool isMS = (desc.SampleDesc.Count > 1 || desc.SampleDesc.Quality > 0);
+
+			success = (desc.Usage != D3D11_USAGE_DYNAMIC);
+
+			desc.CPUAccessFlags = 0;
+			desc.Usage = D3D11_USAGE_DEFAULT;
+			desc.BindFlags = isMS ? D3D11_BIND_SHADER_RESOURCE : 0;
+			if(IsDepthFormat(desc.Format))
+				desc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+			desc.MiscFlags &= ~D3D11_RESOURCE_MISC_GENERATE_MIPS;
+
+			ID3D11Texture2D *copy = NULL;
+			if(success)
+				hr = m_pDevice->CreateTexture2D(&desc, NULL, &copy);
+
+			if(copy)
+			{
+				ctx->CopyResource(copy, tex);
+
+				c.live = tex;
+				c.copy = copy;
+				for(UINT m=0; m < desc.MipLevels; m++)
+					c.length += GetByteSize(desc.Width, desc.Height, 1, desc.Format, m)*desc.ArraySize*desc.SampleDesc.Count;
+			}
+		}
+		else if(WrappedID3D11Texture3D::m_TextureList.find(id) != WrappedID3D11Texture3D::m_TextureList.end())
+		{
+			ID3D11Texture3D *tex = UNWRAP(WrappedID3D11Texture3D, WrappedID3D11Texture3D::m_TextureList[id].m_Texture);
+
+			D3D11_TEXTURE3D_DESC desc;
+			tex->GetDesc(&desc);
+
+			success = (desc.Usage != D3D11_USAGE_DYNAMIC);
+
+			desc.CPUAccessFlags = 0;
+			desc.Usage = D3D11_USAGE_DEFAULT;
+			desc.BindFlags = 0;
+			desc.MiscFlags &= ~D3D11_RESOURCE_MISC_GENERATE_MIPS;
+
+			ID3D11Texture3D *copy = NULL;
+			if(success)
+				hr = m_pDevice->CreateTexture3D(&desc, NULL, &copy);
+
+			if(copy)
+			{
+				ctx->CopyResource(copy, tex);
+
+				c.live = tex;
+				c.copy = copy;
+				for(UINT m=0; m < desc.MipLevels; m++)
+					c.length += GetByteSize(desc.Width, desc.Height, desc.Depth, desc.Format, m);
+			}
+		}
+		else
+		{
+			// not currently alive, so it's created later in the frame.
+			continue;
+		}
+
+		if(!success)
+		{
+			// dynamic textures would need a readback of every subresource, and are rare enough
+			// that it's not worth it.
+			RDCDEBUG("Not creating replay checkpoints, log writes to a dynamic texture");
+			m_CheckpointsDisabled = true;
+		}
+		else if(FAILED(hr) || (c.copy == NULL && c.data == NULL))
+		{
+			RDCERR("Failed to copy resource for replay checkpoint %08x", hr);
+			success = false;
+		}
+		else
+		{
+			checkpoint.contents.push_back(c);
+			checkpoint.size += c.length;
+		}
+	}
+
+	if(!success || checkpoint.size > CheckpointBudget)
+	{
+		ReleaseReplayCheckpoint(checkpoint);
+		return;
+	}
+
+	while(!m_ReplayCheckpoints.empty() && m_CheckpointMemory + checkpoint.size > CheckpointBudget)
+	{
+		size_t lru = 0;
+		for(size_t i=1; i < m_ReplayCheckpoints.size(); i++)
+			if(m_ReplayCheckpoints[i].lastUse < m_ReplayCheckpoints[lru].lastUse)
+				lru = i;
+
+		m_CheckpointMemory -= m_ReplayCheckpoints[lru].size;
+		ReleaseReplayCheckpoint(m_ReplayCheckpoints[lru]);
+		m_ReplayCheckpoints.erase(m_ReplayCheckpoints.begin()+lru);
+	}
+
+	m_CheckpointMemory += checkpoint.size;
+	m_ReplayCheckpoints.push_back(checkpoint);
+}
+
+void WrappedID3D11Device::ApplyReplayCheckpoint(ReplayCheckpoint &checkpoint)
+{
+	ID3D11DeviceContext *ctx = m_pImmediateContext->GetReal();
+
+	GetResourceManager()->ReleaseInFrameResources();
+
+	for(size_t i=0; i < checkpoint.contents.size(); i++)
+	{
+		CheckpointContents &c = checkpoint.contents[i];
+
+		if(c.copy)
+		{
+			ctx->CopyResource(c.live, c.copy);
+		}
+		else
+		{
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			HRESULT hr = ctx->Map(c.live, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
+
+			if(FAILED(hr))
+			{
+				RDCERR("Failed to map dynamic buffer restoring replay checkpoint %08x", hr);
+				continue;
+			}
+
+			memcpy(mapped.pData, c.data, c.length);
+			ctx->Unmap(c.live, 0);
+		}
+	}
+
+	checkpoint.state->ApplyState(m_pImmediateContext);
+}
+
+void WrappedID3D11Device::ReleaseReplayCheckpoint(ReplayCheckpoint &checkpoint)
+{
+	for(size_t i=0; i < checkpoint.contents.size(); i++)
+	{
+		SAFE_RELEASE(checkpoint.contents[i].copy);
+		SAFE_DELETE_ARRAY(checkpoint.contents[i].data);
+	}
+	checkpoint.contents.clear();
+
+	SAFE_DELETE(checkpoint.state);
+}
+
+void WrappedID3D11Device::InvalidateReplayCheckpoints()
+{
+	m_ReplayPos = eReplayPos_Unknown;
+
+	for(size_t i=0; i < m_ReplayCheckpoints.size(); i++)
+		ReleaseReplayCheckpoint(m_ReplayCheckpoints[i]);
+	m_ReplayCheckpoints.clear();
+
+	m_CheckpointMemory = 0;
+}
+
+void WrappedID3D11Device::InvalidateReplayCheckpoints(ResourceId changed)
+{
+	uint32_t firstUse = m_pImmediateContext->GetShaderFirstUse(changed);
+
+	// anything other than a shader executed on the immediate context could affect the replay
+	// anywhere, e.g. through a command list or a copy
+	if(firstUse == ~0U)
+	{
+		InvalidateReplayCheckpoints();
+		return;
+	}
+
+	m_ReplayPos = eReplayPos_Unknown;
+
+	for(size_t i=0; i < m_ReplayCheckpoints.size(); )
+	{
+		ReplayCheckpoint &c = m_ReplayCheckpoints[i];
+
+		// a checkpoint from before the shader's first use is still correct, unless its saved
+		// state has the shader bound already - restoring it would bring the old one back.
+		bool stale = (c.eventID > firstUse);
+
+		const D3D11RenderState::shader *shArr = &c.state->VS;
+		for(int s=0; !stale && s < 6; s++)
+			stale = (shArr[s].Shader && GetIDForResource(shArr[s].Shader) == changed);
+
+		if(stale)
+		{
+			m_CheckpointMemory -= c.size;
+			ReleaseReplayCheckpoint(c);
+			m_ReplayCheckpoints.erase(m_ReplayCheckpoints.begin()+i);
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
+
 void WrappedID3D11Device::ReleaseSwapchainResources(IDXGISwapChain *swap)
 {
 	if(swap)
@@ -2476,6 +3074,8 @@ void WrappedID3D11Device::StartFrameCapture(void *dev, void *wnd)
 {
 	if(m_State != WRITING_IDLE) return;
 
+	SCOPED_PROFILE("Capture begin");
+
 	SCOPED_LOCK(m_D3DLock);
 
 	RenderDoc::Inst().SetCurrentDriver(RDC_D3D11);
@@ -2518,16 +3118,64 @@ void WrappedID3D11Device::StartFrameCapture(void *dev, void *wnd)
 
 	GetResourceManager()->PrepareInitialContents();
 
-	if(m_pInfoQueue)
-		m_pInfoQueue->ClearStoredMessages();
+	ClearInfoQueue();
 
 	RDCLOG("Starting capture, frame %u", m_FrameCounter);
 }
 
+void WrappedID3D11Device::DiscardRetroFrame()
+{
+	SCOPED_LOCK(m_D3DLock);
+
+	m_FrameRecord.back().frameInfo.frameNumber = m_FrameCounter+1;
+	m_FrameRecord.back().frameInfo.captureTime = Timing::GetUnixTimestamp();
+
+	m_pImmediateContext->CleanupCapture();
+
+	for(auto it = m_DeferredContexts.begin(); it != m_DeferredContexts.end(); ++it)
+	{
+		WrappedID3D11DeviceContext *context = *it;
+
+		if(context)
+			context->CleanupCapture();
+		else
+			RDCERR("NULL deferred context in resource record!");
+	}
+
+	// the frame's writes were only in the chunks we just threw away, so they have to be
+	// picked up by the next frame's initial contents. Everything else keeps the copy it has.
+	GetResourceManager()->ClearReferencedResources(true);
+
+	GetResourceManager()->MarkResourceFrameReferenced(m_ResourceID, eFrameRef_Write);
+	GetResourceManager()->PrepareInitialContents();
+
+	m_pImmediateContext->AttemptCapture();
+	m_pImmediateContext->BeginCaptureFrame();
+
+	for(auto it = m_DeferredContexts.begin(); it != m_DeferredContexts.end(); ++it)
+	{
+		WrappedID3D11DeviceContext *context = *it;
+
+		if(context)
+			context->AttemptCapture();
+		else
+			RDCERR("NULL deferred context in resource record!");
+	}
+
+	ClearInfoQueue();
+}
+
+void WrappedID3D11Device::GetResourceMemoryUsage(vector<ResourceMemoryUsage> &usage)
+{
+	GetResourceManager()->GetResourceMemoryUsage(usage);
+}
+
 bool WrappedID3D11Device::EndFrameCapture(void *dev, void *wnd)
 {
 	if(m_State != WRITING_CAPFRAME) return true;
 
+	SCOPED_PROFILE("Capture end");
+
 	CaptureFailReason reason;
 
 	IDXGISwapChain *swap = NULL;
@@ -2580,11 +3228,10 @@ bool WrappedID3D11Device::EndFrameCapture(void *dev, void *wnd)
 			}
 		}
 
-		const uint32_t maxSize = 1024;
-
-		byte *thpixels = NULL;
-		uint32_t thwidth = 0;
-		uint32_t thheight = 0;
+		// the backbuffer is copied to a staging texture now, but it's not mapped until the rest
+		// of the capture has been serialised, by which time the GPU has finished the copy.
+		ID3D11Texture2D *thumbStaging = NULL;
+		D3D11_TEXTURE2D_DESC thumbDesc;
 
 		if(swap != NULL)
 		{
@@ -2650,134 +3297,17 @@ bool WrappedID3D11Device::EndFrameCapture(void *dev, void *wnd)
 
 				if(tex)
 				{
-					ResourceFormat fmt = MakeResourceFormat(desc.Format);
-
-					D3D11_MAPPED_SUBRESOURCE mapped;
-					hr = m_pImmediateContext->GetReal()->Map(stagingTex, 0, D3D11_MAP_READ, 0, &mapped);
-
-					if(FAILED(hr))
-					{
-						RDCERR("Couldn't map staging texture to create thumbnail. %08x", hr);
-					}
-					else
-					{
-						byte *data = (byte *)mapped.pData;
-
-						float aspect = float(desc.Width)/float(desc.Height);
-
-						thwidth = RDCMIN(maxSize, desc.Width);
-						thwidth &= ~0x7; // align down to multiple of 8
-						thheight = uint32_t(float(thwidth)/aspect);
-
-						thpixels = new byte[3*thwidth*thheight];
-
-						float widthf = float(desc.Width);
-						float heightf = float(desc.Height);
-
-						uint32_t stride = fmt.compByteWidth*fmt.compCount;
-
-						bool buf1010102 = false;
-						bool bufBGRA = false;
-
-						if(fmt.special && fmt.specialFormat == eSpecial_R10G10B10A2)
-						{
-							stride = 4;
-							buf1010102 = true;
-						}
-						if(fmt.special && fmt.specialFormat == eSpecial_B8G8R8A8)
-						{
-							stride = 4;
-							bufBGRA = true;
-						}
-
-						byte *dst = thpixels;
-
-						for(uint32_t y=0; y < thheight; y++)
-						{
-							for(uint32_t x=0; x < thwidth; x++)
-							{
-								float xf = float(x)/float(thwidth);
-								float yf = float(y)/float(thheight);
-
-								byte *src = &data[ stride*uint32_t(xf*widthf) + mapped.RowPitch*uint32_t(yf*heightf) ];
-
-								if(buf1010102)
-								{
-									uint32_t *src1010102 = (uint32_t *)src;
-									Vec4f unorm = ConvertFromR10G10B10A2(*src1010102);
-									dst[0] = (byte)(unorm.x*255.0f);
-									dst[1] = (byte)(unorm.y*255.0f);
-									dst[2] = (byte)(unorm.z*255.0f);
-								}
-								else if(bufBGRA)
-								{
-									dst[0] = src[2];
-									dst[1] = src[1];
-									dst[2] = src[0];
-								}
-								else if(fmt.compByteWidth == 2) // R16G16B16A16 backbuffer
-								{
-									uint16_t *src16 = (uint16_t *)src;
-
-									float linearR = RDCCLAMP(ConvertFromHalf(src16[0]), 0.0f, 1.0f);
-									float linearG = RDCCLAMP(ConvertFromHalf(src16[1]), 0.0f, 1.0f);
-									float linearB = RDCCLAMP(ConvertFromHalf(src16[2]), 0.0f, 1.0f);
-
-									if(linearR < 0.0031308f) dst[0] = byte(255.0f*(12.92f * linearR));
-									else                     dst[0] = byte(255.0f*(1.055f * powf(linearR, 1.0f/2.4f) - 0.055f));
-
-									if(linearG < 0.0031308f) dst[1] = byte(255.0f*(12.92f * linearG));
-									else                     dst[1] = byte(255.0f*(1.055f * powf(linearG, 1.0f/2.4f) - 0.055f));
-
-									if(linearB < 0.0031308f) dst[2] = byte(255.0f*(12.92f * linearB));
-									else                     dst[2] = byte(255.0f*(1.055f * powf(linearB, 1.0f/2.4f) - 0.055f));
-								}
-								else
-								{
-									dst[0] = src[0];
-									dst[1] = src[1];
-									dst[2] = src[2];
-								}
-
-								dst += 3;
-							}
-						}
-
-						m_pImmediateContext->GetReal()->Unmap(stagingTex, 0);
-					}
+					thumbStaging = stagingTex;
+					thumbDesc = desc;
+				}
+				else
+				{
+					stagingTex->Release();
 				}
-
-				stagingTex->Release();
-			}
-
-		}
-
-		byte *jpgbuf = NULL;
-		int len = thwidth*thheight;
-
-		if(wnd)
-		{
-			jpgbuf = new byte[len];
-
-			jpge::params p;
-
-			p.m_quality = 40;
-
-			bool success = jpge::compress_image_to_jpeg_file_in_memory(jpgbuf, len, thwidth, thheight, 3, thpixels, p);
-
-			if(!success)
-			{
-				RDCERR("Failed to compress to jpg");
-				SAFE_DELETE_ARRAY(jpgbuf);
-				thwidth = 0;
-				thheight = 0;
 			}
 		}
 
-		Serialiser *m_pFileSerialiser = RenderDoc::Inst().OpenWriteSerialiser(m_FrameCounter, &m_InitParams, jpgbuf, len, thwidth, thheight);
-
-		SAFE_DELETE_ARRAY(jpgbuf);
-		SAFE_DELETE(thpixels);
+		Serialiser *m_pFileSerialiser = RenderDoc::Inst().OpenWriteSerialiser(m_FrameCounter, &m_InitParams);
 
 		{
 			SCOPED_SERIALISE_CONTEXT(DEVICE_INIT);
@@ -2810,8 +3340,9 @@ bool WrappedID3D11Device::EndFrameCapture(void *dev, void *wnd)
 
 			RDCDEBUG("Accumulating context resource list");	
 
-			map<int32_t, Chunk *> recordlist;
+			ResourceRecord::ChunkList recordlist;
 			record->Insert(recordlist);
+			ResourceRecord::SortChunks(recordlist);
 
 			RDCDEBUG("Flushing %u records to file serialiser", (uint32_t)recordlist.size());	
 
@@ -2821,11 +3352,116 @@ bool WrappedID3D11Device::EndFrameCapture(void *dev, void *wnd)
 			RDCDEBUG("Done");	
 		}
 
-		m_CurFileSize += m_pFileSerialiser->FlushToDisk();
+		const uint32_t maxSize = 1024;
+
+		byte *thpixels = NULL;
+		uint32_t thwidth = 0;
+		uint32_t thheight = 0;
+
+		if(thumbStaging)
+		{
+			ResourceFormat fmt = MakeResourceFormat(thumbDesc.Format);
+
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			HRESULT hr = m_pImmediateContext->GetReal()->Map(thumbStaging, 0, D3D11_MAP_READ, 0, &mapped);
+
+			if(FAILED(hr))
+			{
+				RDCERR("Couldn't map staging texture to create thumbnail. %08x", hr);
+			}
+			else
+			{
+				byte *data = (byte *)mapped.pData;
+
+				float aspect = float(thumbDesc.Width)/float(thumbDesc.Height);
+
+				thwidth = RDCMIN(maxSize, thumbDesc.Width);
+				thwidth &= ~0x7; // align down to multiple of 8
+				thheight = uint32_t(float(thwidth)/aspect);
+
+				thpixels = new byte[3*thwidth*thheight];
+
+				float widthf = float(thumbDesc.Width);
+				float heightf = float(thumbDesc.Height);
+
+				uint32_t stride = fmt.compByteWidth*fmt.compCount;
+
+				bool buf1010102 = false;
+				bool bufBGRA = false;
+
+				if(fmt.special && fmt.specialFormat == eSpecial_R10G10B10A2)
+				{
+					stride = 4;
+					buf1010102 = true;
+				}
+				if(fmt.special && fmt.specialFormat == eSpecial_B8G8R8A8)
+				{
+					stride = 4;
+					bufBGRA = true;
+				}
+
+				byte *dst = thpixels;
+
+				for(uint32_t y=0; y < thheight; y++)
+				{
+					for(uint32_t x=0; x < thwidth; x++)
+					{
+						float xf = float(x)/float(thwidth);
+						float yf = float(y)/float(thheight);
+
+						byte *src = &data[ stride*uint32_t(xf*widthf) + mapped.RowPitch*uint32_t(yf*heightf) ];
+
+						if(buf1010102)
+						{
+							uint32_t *src1010102 = (uint32_t *)src;
+							Vec4f unorm = ConvertFromR10G10B10A2(*src1010102);
+							dst[0] = (byte)(unorm.x*255.0f);
+							dst[1] = (byte)(unorm.y*255.0f);
+							dst[2] = (byte)(unorm.z*255.0f);
+						}
+						else if(bufBGRA)
+						{
+							dst[0] = src[2];
+							dst[1] = src[1];
+							dst[2] = src[0];
+						}
+						else if(fmt.compByteWidth == 2) // R16G16B16A16 backbuffer
+						{
+							uint16_t *src16 = (uint16_t *)src;
+
+							float linearR = RDCCLAMP(ConvertFromHalf(src16[0]), 0.0f, 1.0f);
+							float linearG = RDCCLAMP(ConvertFromHalf(src16[1]), 0.0f, 1.0f);
+							float linearB = RDCCLAMP(ConvertFromHalf(src16[2]), 0.0f, 1.0f);
+
+							if(linearR < 0.0031308f) dst[0] = byte(255.0f*(12.92f * linearR));
+							else                     dst[0] = byte(255.0f*(1.055f * powf(linearR, 1.0f/2.4f) - 0.055f));
+
+							if(linearG < 0.0031308f) dst[1] = byte(255.0f*(12.92f * linearG));
+							else                     dst[1] = byte(255.0f*(1.055f * powf(linearG, 1.0f/2.4f) - 0.055f));
+
+							if(linearB < 0.0031308f) dst[2] = byte(255.0f*(12.92f * linearB));
+							else                     dst[2] = byte(255.0f*(1.055f * powf(linearB, 1.0f/2.4f) - 0.055f));
+						}
+						else
+						{
+							dst[0] = src[0];
+							dst[1] = src[1];
+							dst[2] = src[2];
+						}
+
+						dst += 3;
+					}
+				}
+
+				m_pImmediateContext->GetReal()->Unmap(thumbStaging, 0);
+			}
 
-		SAFE_DELETE(m_pFileSerialiser);
+			thumbStaging->Release();
+		}
+
+		m_CurFileSize += RenderDoc::Inst().WriteCapture(m_pFileSerialiser, NULL, thpixels, thwidth, thheight);
 
-		RenderDoc::Inst().SuccessfullyWrittenLog();
+		m_pFileSerialiser = NULL;
 
 		m_State = WRITING_IDLE;
 
@@ -2847,6 +3483,8 @@ bool WrappedID3D11Device::EndFrameCapture(void *dev, void *wnd)
 
 		GetResourceManager()->ClearReferencedResources();
 
+		ClearInfoQueue();
+
 		return true;
 	}
 	else
@@ -2882,6 +3520,7 @@ bool WrappedID3D11Device::EndFrameCapture(void *dev, void *wnd)
 				}
 
 				GetDebugManager()->RenderText(0.0f, 0.0f, "Failed to capture frame %u: %s", m_FrameCounter, reasonString);
+				GetDebugManager()->FlushText();
 			}
 
 			old.ApplyState(m_pImmediateContext);
@@ -2965,8 +3604,7 @@ bool WrappedID3D11Device::EndFrameCapture(void *dev, void *wnd)
 			}
 		}
 
-		if(m_pInfoQueue)
-			m_pInfoQueue->ClearStoredMessages();
+		ClearInfoQueue();
 
 		return false;
 	}
@@ -2979,7 +3617,7 @@ HRESULT WrappedID3D11Device::Present(IDXGISwapChain *swap, UINT SyncInterval, UI
 	
 	m_pCurrentWrappedDevice = this;
 	
-	if(m_State == WRITING_IDLE)
+	if(m_State == WRITING_IDLE || m_RetroFrame)
 		RenderDoc::Inst().Tick();
 	
 	m_pImmediateContext->EndFrame();
@@ -3000,6 +3638,15 @@ HRESULT WrappedID3D11Device::Present(IDXGISwapChain *swap, UINT SyncInterval, UI
 		m_TotalTime += m_FrameTimes.back();
 		m_FrameTimer.Restart();
 
+		// D3D11 has no single point every call goes through, so APICalls isn't counted. Only
+		// the immediate context's work is seen, deferred contexts' is in their command lists
+		FrameStatistics &stats = m_pImmediateContext->GetFrameStatistics();
+		stats.NumFrames = 1;
+		stats.LastFrameNumber = m_FrameCounter;
+		stats.TotalFrameTime = stats.MaxFrameTime = m_FrameTimes.back();
+		RenderDoc::Inst().AddFrameStatistics(stats);
+		RDCEraseEl(stats);
+
 		// update every second
 		if(m_TotalTime > 1000.0)
 		{
@@ -3133,6 +3780,8 @@ HRESULT WrappedID3D11Device::Present(IDXGISwapChain *swap, UINT SyncInterval, UI
 				GetDebugManager()->RenderText(0.0f, 0.0f, str.c_str());
 			}
 
+			GetDebugManager()->FlushText();
+
 			old.ApplyState(m_pImmediateContext);
 		}
 	}
@@ -3142,15 +3791,63 @@ HRESULT WrappedID3D11Device::Present(IDXGISwapChain *swap, UINT SyncInterval, UI
 	
 	RenderDoc::Inst().SetCurrentDriver(RDC_D3D11);
 
+	uint32_t numFrames = RenderDoc::Inst().ShouldTriggerCapture(m_FrameCounter);
+
+	// without a frame recorded already, the best we can do is capture the next one
+	if(!m_RetroFrame && RenderDoc::Inst().ShouldSavePreviousFrame())
+		numFrames = RDCMAX(numFrames, 1U);
+
+	if(m_State == WRITING_CAPFRAME && m_RetroFrame)
+	{
+		if(RenderDoc::Inst().ShouldSavePreviousFrame())
+		{
+			m_RetroFrame = false;
+			m_FrameRecord.back().frameInfo.frameNumber = m_FrameCounter;
+			EndFrameCapture(this, swapdesc.OutputWindow);
+		}
+		else
+		{
+			DiscardRetroFrame();
+
+			// a normal capture takes over the recording that's just been restarted
+			if(numFrames > 0)
+			{
+				m_RetroFrame = false;
+				m_CaptureFramesLeft = numFrames;
+				numFrames = 0;
+			}
+		}
+	}
 	// kill any current capture that isn't application defined
-	if(m_State == WRITING_CAPFRAME && !m_AppControlledCapture)
-		EndFrameCapture(this, swapdesc.OutputWindow);
+	else if(m_State == WRITING_CAPFRAME && !m_AppControlledCapture)
+	{
+		// a multi-frame capture just marks the end of this frame in the same chunk stream
+		// and carries on, so all the frames share the initial contents
+		if(m_CaptureFramesLeft > 1)
+		{
+			m_CaptureFramesLeft--;
+			m_pImmediateContext->EndCaptureFrame();
+		}
+		else
+		{
+			EndFrameCapture(this, swapdesc.OutputWindow);
+		}
+	}
 
-	if(RenderDoc::Inst().ShouldTriggerCapture(m_FrameCounter) && m_State == WRITING_IDLE)
+	if(numFrames > 0 && m_State == WRITING_IDLE)
 	{
 		StartFrameCapture(this, swapdesc.OutputWindow);
 
 		m_AppControlledCapture = false;
+		m_CaptureFramesLeft = numFrames;
+	}
+	else if(RenderDoc::Inst().GetCaptureOptions().RetroCapture && m_State == WRITING_IDLE)
+	{
+		StartFrameCapture(this, swapdesc.OutputWindow);
+
+		m_AppControlledCapture = false;
+		m_CaptureFramesLeft = 1;
+		m_RetroFrame = true;
 	}
 
 	return S_OK;
@@ -3201,6 +3898,61 @@ void WrappedID3D11Device::RemoveDeferredContext(WrappedID3D11DeviceContext *defc
 	m_DeferredContexts.erase(defctx);
 }
 
+void WrappedID3D11Device::HoldCommandList(WrappedID3D11CommandList *cmdList)
+{
+	uint64_t limit = uint64_t(RenderDoc::Inst().GetCaptureOptions().CmdListMemoryLimit)*1024*1024;
+
+	if(limit == 0 || !cmdList->IsCaptured() || cmdList->GetRecord() == NULL)
+		return;
+
+	SCOPED_LOCK(m_HeldCmdListLock);
+
+	// move it to the back if it's already held, so it's the last to be discarded
+	for(auto it=m_HeldCmdLists.begin(); it != m_HeldCmdLists.end(); ++it)
+	{
+		if(it->first == cmdList)
+		{
+			m_HeldCmdLists.splice(m_HeldCmdLists.end(), m_HeldCmdLists, it);
+			return;
+		}
+	}
+
+	uint32_t numChunks = 0;
+	uint64_t size = cmdList->GetRecord()->GetChunkMemory(numChunks);
+
+	m_HeldCmdLists.push_back(std::make_pair(cmdList, size));
+	m_HeldCmdListMemory += size;
+
+	// never discard anything while a frame is being captured, as it might be executed in it
+	while(m_HeldCmdListMemory > limit && m_HeldCmdLists.size() > 1 && !IsCapturingFrame())
+	{
+		WrappedID3D11CommandList *oldest = m_HeldCmdLists.front().first;
+		m_HeldCmdListMemory -= m_HeldCmdLists.front().second;
+		m_HeldCmdLists.pop_front();
+
+		RDCDEBUG("Discarding chunks for command list %llu to stay under command list memory limit", oldest->GetResourceID());
+
+		oldest->GetRecord()->DeleteChunks();
+		oldest->GetRecord()->FreeParents(GetResourceManager());
+		oldest->MarkUncaptured();
+	}
+}
+
+void WrappedID3D11Device::ReleaseHeldCommandList(WrappedID3D11CommandList *cmdList)
+{
+	SCOPED_LOCK(m_HeldCmdListLock);
+
+	for(auto it=m_HeldCmdLists.begin(); it != m_HeldCmdLists.end(); ++it)
+	{
+		if(it->first == cmdList)
+		{
+			m_HeldCmdListMemory -= it->second;
+			m_HeldCmdLists.erase(it);
+			return;
+		}
+	}
+}
+
 bool WrappedID3D11Device::Serialise_SetResourceName(ID3D11DeviceChild *res, const char *nm)
 {
 	SERIALISE_ELEMENT(ResourceId, resource, GetIDForResource(res));
@@ -3390,6 +4142,9 @@ void WrappedID3D11Device::ReleaseResource(ID3D11DeviceChild *res)
 	bool serialiseRelease = true;
 
 	WrappedID3D11CommandList *cmdList = (WrappedID3D11CommandList *)res;
+
+	if(type == Resource_CommandList)
+		ReleaseHeldCommandList(cmdList);
 	
 	// don't serialise releases of counters or queries since we ignore them.
 	// Also don't serialise releases of command lists that weren't captured,
@@ -38,6 +38,7 @@
 #if defined(INCLUDE_D3D_11_1)
 #include <d3d11_1.h>
 #include <d3d11_2.h>
+#include <d3d11shader.h>
 #endif
 
 #include "d3d11_manager.h"
@@ -45,6 +46,7 @@
 #include "d3d11_debug.h"
 
 #include <map>
+#include <list>
 using std::map;
 
 enum TextureDisplayType
@@ -66,10 +68,10 @@ struct D3D11InitParams : public RDCInitParams
 	UINT NumFeatureLevels;
 	D3D_FEATURE_LEVEL FeatureLevels[16];
 	
-	static const uint32_t D3D11_SERIALISE_VERSION = 0x0000007;
+	static const uint32_t D3D11_SERIALISE_VERSION = 0x000000C;
 
 	// backwards compatibility for old logs described at the declaration of this array
-	static const uint32_t D3D11_NUM_SUPPORTED_OLD_VERSIONS = 3;
+	static const uint32_t D3D11_NUM_SUPPORTED_OLD_VERSIONS = 8;
 	static const uint32_t D3D11_OLD_VERSIONS[D3D11_NUM_SUPPORTED_OLD_VERSIONS];
 
 	// version number internal to d3d11 stream
@@ -171,6 +173,7 @@ struct DummyID3D11InfoQueue : public ID3D11InfoQueue
 };
 
 class WrappedID3D11ClassLinkage;
+class WrappedID3D11CommandList;
 enum CaptureFailReason;
 
 #if defined(INCLUDE_D3D_11_1)
@@ -213,6 +216,8 @@ private:
 	ID3D11Device2* m_pDevice2;
 #endif
 	ID3D11InfoQueue *m_pInfoQueue;
+	// how many of the info queue's stored messages have been counted against an event
+	UINT64 m_DebugMessagesCounted;
 	WrappedID3D11DeviceContext* m_pImmediateContext;
 
 	// ensure all calls in via the D3D wrapped interface are thread safe
@@ -226,6 +231,12 @@ private:
 	Serialiser *m_pDebugSerialiser;
 	LogState m_State;
 	bool m_AppControlledCapture;
+	// frames still to capture into the current log, including the one in progress
+	uint32_t m_CaptureFramesLeft;
+	// with the RetroCapture option, the frame in progress is being recorded in case it's
+	// saved once presented. Otherwise it's thrown away and the next frame recorded instead.
+	bool m_RetroFrame;
+	void DiscardRetroFrame();
 	
 	set<ID3D11DeviceChild *> m_CachedStateObjects;
 
@@ -245,13 +256,105 @@ private:
 	void CachedObjectsGarbageCollect();
 
 	set<WrappedID3D11DeviceContext *> m_DeferredContexts;
+
+	// with CaptureAllCmdLists, the command lists recorded outside of a frame capture that
+	// are holding on to their chunks, least recently executed first, and the total length
+	// of those chunks. Only used if CmdListMemoryLimit is set.
+	Threading::CriticalSection m_HeldCmdListLock;
+	std::list< std::pair<WrappedID3D11CommandList *, uint64_t> > m_HeldCmdLists;
+	uint64_t m_HeldCmdListMemory;
 	map<ID3D11InputLayout *, vector<D3D11_INPUT_ELEMENT_DESC> > m_LayoutDescs;
 	map<ID3D11InputLayout *, ShaderReflection *> m_LayoutDXBC;
 
+	// each unique shader bytecode blob is serialised once into a record of its own,
+	// which shader records are parented to, and creation chunks refer to it by ID.
+	map<ShaderBytecodeKey, D3D11ResourceRecord *> m_ShaderBytecodeRecords;
+	map<ResourceId, vector<byte> > m_ShaderBytecodes;
+
+	// must be called while m_D3DLock is held.
+	D3D11ResourceRecord *GetShaderBytecodeRecord(const void *bytecode, size_t length);
+	bool Serialise_ShaderBytecode(ResourceId id, const void *bytecode, size_t length);
+
+	// used in place of serialising the bytecode inline in creation chunks. On reading
+	// returns a copy of the bytecode that the caller must delete[], and the ID of the
+	// bytecode it came from (or ResourceId() for older logs).
+	byte *SerialiseShaderBytecodeRef(const void *bytecode, size_t length, ResourceId &bytecodeID);
+
+	// on replay, the real shader for each unique bytecode blob is created up front across
+	// several threads, since the driver's compile is most of the cost of creating it. The
+	// creation chunks then take these instead of creating their own. Only shaders with no
+	// class linkage can be taken, and each one only once.
+	struct PrecreatedShader
+	{
+		PrecreatedShader() : type(D3D11_SHVER_PIXEL_SHADER), shader(NULL) {}
+		ResourceId bytecodeID;
+		D3D11_SHADER_VERSION_TYPE type;
+		ID3D11DeviceChild *shader;
+	};
+	map<ResourceId, PrecreatedShader> m_PrecreatedShaders;
+
+	struct PrecreateShadersData;
+	static void PrecreateShaderRange(void *userData, size_t begin, size_t end);
+
+	void PrecreateShaders();
+	void ReleasePrecreatedShaders();
+	ID3D11DeviceChild *TakePrecreatedShader(ResourceId bytecodeID, D3D11_SHADER_VERSION_TYPE type, ID3D11ClassLinkage *linkage);
+
 	ResourceId m_ReplayDefCtx;
 	uint32_t m_FirstDefEv;
 	uint32_t m_LastDefEv;
 
+	// how far through the frame the last incremental replay got. Any other replay loses track
+	// of it, since it might have been done with modified state.
+	enum ReplayPosition
+	{
+		eReplayPos_Unknown,
+		eReplayPos_BeforeDraw, // replayed up to but not including m_ReplayPosEvent
+		eReplayPos_AfterDraw,  // replayed up to and including m_ReplayPosEvent
+	};
+	ReplayPosition m_ReplayPos;
+	uint32_t m_ReplayPosFrame;
+	uint32_t m_ReplayPosEvent;
+
+	// on replay, snapshots of the frame part-way through, so that replaying up to an event
+	// can start from the nearest snapshot before it instead of from the start of the frame.
+	// Each holds a copy of every resource the frame writes to, and the pipeline state.
+	struct CheckpointContents
+	{
+		ID3D11Resource *live; // real resource, not ref'd as only persistent resources are copied
+		ID3D11Resource *copy;
+		// dynamic buffers can't be copied into, so they're restored from CPU memory
+		byte *data;
+		UINT length;
+	};
+
+	struct ReplayCheckpoint
+	{
+		uint32_t frameID;
+		uint32_t eventID; // contents and state are as they were just before this event
+		D3D11RenderState *state;
+		vector<CheckpointContents> contents;
+		uint64_t size;
+		uint64_t lastUse;
+	};
+
+	// a checkpoint is added whenever a replay runs this many events past the last one, and
+	// the least recently used are discarded to keep the copies under the budget.
+	static const uint32_t CheckpointInterval = 256;
+	static const uint64_t CheckpointBudget = 512*1024*1024ULL;
+
+	vector<ReplayCheckpoint> m_ReplayCheckpoints;
+	vector<ResourceId> m_CheckpointResources;
+	uint64_t m_CheckpointMemory;
+	uint64_t m_CheckpointCounter;
+	bool m_CheckpointsPrepared;
+	bool m_CheckpointsDisabled;
+
+	ReplayCheckpoint *FindReplayCheckpoint(uint32_t frameID, uint32_t eventID);
+	void AddReplayCheckpoint(uint32_t frameID, uint32_t eventID);
+	void ApplyReplayCheckpoint(ReplayCheckpoint &checkpoint);
+	void ReleaseReplayCheckpoint(ReplayCheckpoint &checkpoint);
+
 	static WrappedID3D11Device *m_pCurrentWrappedDevice;
 
 	map<IDXGISwapChain*, ID3D11RenderTargetView*> m_SwapChains;
@@ -277,7 +380,13 @@ public:
 
 	WrappedID3D11Device(ID3D11Device* realDevice, D3D11InitParams *params);
 	void SetLogFile(const char *logfile);
-	void SetLogVersion(uint32_t fileversion) { LazyInit(); m_InitParams.SerialiseVersion = fileversion; }
+	void SetLogVersion(uint32_t fileversion)
+	{
+		LazyInit();
+		m_InitParams.SerialiseVersion = fileversion;
+		if(m_pSerialiser)
+			m_pSerialiser->SetVarintEncoding(fileversion >= 0x00000A, fileversion >= 0x00000B);
+	}
 	uint32_t GetLogVersion() { return m_InitParams.SerialiseVersion; }
 	virtual ~WrappedID3D11Device();
 
@@ -297,6 +406,12 @@ public:
 	void RemoveDeferredContext(WrappedID3D11DeviceContext *defctx);
 	WrappedID3D11DeviceContext *GetDeferredContext(size_t idx);
 
+	// track a command list that was finished or executed outside of a frame capture, and
+	// discard the least recently executed ones if they're over the memory limit.
+	void HoldCommandList(WrappedID3D11CommandList *cmdList);
+	void ReleaseHeldCommandList(WrappedID3D11CommandList *cmdList);
+	bool IsCapturingFrame() { return m_State == WRITING_CAPFRAME; }
+
 	Serialiser *GetSerialiser() { return m_pSerialiser; }
 
 	ResourceId GetResourceID() { return m_ResourceID; }
@@ -306,6 +421,11 @@ public:
 	const FetchDrawcall *GetDrawcall(uint32_t frameID, uint32_t eventID);
 
 	vector<DebugMessage> GetDebugMessages();
+	// the number of messages raised since the last call, without fetching them
+	uint32_t CountNewDebugMessages();
+	// clears the info queue. While capturing it also lifts the queue's message limit, since
+	// messages are only fetched from it at the end of the frame
+	void ClearInfoQueue();
 	void AddDebugMessage(DebugMessage msg) { if(m_State < WRITING) m_DebugMessages.push_back(msg); }
 	void AddDebugMessage(DebugMessageCategory c, DebugMessageSeverity sv, DebugMessageSource src, std::string d);
 	const vector<D3D11_INPUT_ELEMENT_DESC> &GetLayoutDesc(ID3D11InputLayout *layout) { return m_LayoutDescs[layout]; }
@@ -318,6 +438,8 @@ public:
 	void StartFrameCapture(void *dev, void *wnd);
 	bool EndFrameCapture(void *dev, void *wnd);
 
+	void GetResourceMemoryUsage(vector<ResourceMemoryUsage> &usage);
+
 	////////////////////////////////////////////////////////////////
 	// log replaying
 	
@@ -328,8 +450,16 @@ public:
 
 	void ReadLogInitialisation();
 	void ProcessChunk(uint64_t offset, D3D11ChunkType context);
+	void CreateDeferredInitialContents();
 	void SetContextFilter(ResourceId id, uint32_t firstDefEv, uint32_t lastDefEv);
 	void ReplayLog(uint32_t frameID, uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType);
+
+	// must be called whenever something changes what replaying the frame produces, such as
+	// a resource being replaced.
+	void InvalidateReplayCheckpoints();
+	// as above, for when only the given resource changed. If it's a shader only checkpoints
+	// that could have seen it are dropped, otherwise this drops everything
+	void InvalidateReplayCheckpoints(ResourceId changed);
 	
 	////////////////////////////////////////////////////////////////
 	// 'fake' interfaces
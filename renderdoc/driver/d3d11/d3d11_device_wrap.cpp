@@ -1178,6 +1178,203 @@ HRESULT WrappedID3D11Device::CreateInputLayout(
 	return ret;
 }
 
+bool WrappedID3D11Device::Serialise_ShaderBytecode(ResourceId id, const void *bytecode, size_t length)
+{
+	SERIALISE_ELEMENT(ResourceId, BytecodeID, id);
+	SERIALISE_ELEMENT(uint32_t, BytecodeLen, (uint32_t)length);
+	SERIALISE_ELEMENT_BUF(byte *, Bytecode, bytecode, length);
+
+	if(m_State == READING)
+	{
+		// may already have been read when precreating shaders
+		vector<byte> &stored = m_ShaderBytecodes[BytecodeID];
+		if(stored.empty())
+			stored.assign(Bytecode, Bytecode+BytecodeLen);
+
+		SAFE_DELETE_ARRAY(Bytecode);
+	}
+
+	return true;
+}
+
+struct WrappedID3D11Device::PrecreateShadersData
+{
+	ID3D11Device *device;
+	vector<const vector<byte> *> bytecodes;
+	vector<PrecreatedShader> shaders;
+};
+
+void WrappedID3D11Device::PrecreateShaderRange(void *userData, size_t begin, size_t end)
+{
+	PrecreateShadersData *data = (PrecreateShadersData *)userData;
+
+	for(size_t i=begin; i < end; i++)
+	{
+		const vector<byte> &bytecode = *data->bytecodes[i];
+		PrecreatedShader &out = data->shaders[i];
+
+		if(!DXBC::DXBCFile::GetProgramType(&bytecode[0], bytecode.size(), out.type))
+			continue;
+
+		HRESULT hr = E_INVALIDARG;
+
+		switch(out.type)
+		{
+			case D3D11_SHVER_VERTEX_SHADER:
+				hr = data->device->CreateVertexShader(&bytecode[0], bytecode.size(), NULL, (ID3D11VertexShader **)&out.shader);
+				break;
+			case D3D11_SHVER_HULL_SHADER:
+				hr = data->device->CreateHullShader(&bytecode[0], bytecode.size(), NULL, (ID3D11HullShader **)&out.shader);
+				break;
+			case D3D11_SHVER_DOMAIN_SHADER:
+				hr = data->device->CreateDomainShader(&bytecode[0], bytecode.size(), NULL, (ID3D11DomainShader **)&out.shader);
+				break;
+			case D3D11_SHVER_GEOMETRY_SHADER:
+				hr = data->device->CreateGeometryShader(&bytecode[0], bytecode.size(), NULL, (ID3D11GeometryShader **)&out.shader);
+				break;
+			case D3D11_SHVER_PIXEL_SHADER:
+				hr = data->device->CreatePixelShader(&bytecode[0], bytecode.size(), NULL, (ID3D11PixelShader **)&out.shader);
+				break;
+			case D3D11_SHVER_COMPUTE_SHADER:
+				hr = data->device->CreateComputeShader(&bytecode[0], bytecode.size(), NULL, (ID3D11ComputeShader **)&out.shader);
+				break;
+			default:
+				break;
+		}
+
+		// not fatal, the creation chunk will try again and report the error
+		if(FAILED(hr))
+			out.shader = NULL;
+	}
+}
+
+void WrappedID3D11Device::PrecreateShaders()
+{
+	// older logs have the bytecode inline, so there's nothing to find up front
+	if(GetLogVersion() < 0x000009)
+		return;
+
+	// the device can't be used from other threads
+	if(m_pDevice->GetCreationFlags() & D3D11_CREATE_DEVICE_SINGLETHREADED)
+		return;
+
+	SCOPED_TIMER("shader precreation");
+
+	m_pSerialiser->Rewind();
+
+	while(!m_pSerialiser->AtEnd())
+	{
+		m_pSerialiser->SkipToChunk(SHADER_BYTECODE);
+
+		if(!m_pSerialiser->AtEnd())
+		{
+			m_pSerialiser->PushContext(NULL, SHADER_BYTECODE, false);
+			Serialise_ShaderBytecode(ResourceId(), 0x0, 0);
+			m_pSerialiser->PopContext(NULL, SHADER_BYTECODE);
+		}
+	}
+
+	PrecreateShadersData data;
+	data.device = m_pDevice;
+
+	for(auto it=m_ShaderBytecodes.begin(); it != m_ShaderBytecodes.end(); ++it)
+	{
+		if(it->second.empty())
+			continue;
+
+		data.bytecodes.push_back(&it->second);
+		data.shaders.push_back(PrecreatedShader());
+		data.shaders.back().bytecodeID = it->first;
+	}
+
+	// the driver's shader compile can be slow, so it's worth a thread for even a few
+	Threading::ParallelFor(data.bytecodes.size(), 4, &PrecreateShaderRange, &data);
+
+	for(size_t i=0; i < data.shaders.size(); i++)
+		if(data.shaders[i].shader)
+			m_PrecreatedShaders[data.shaders[i].bytecodeID] = data.shaders[i];
+}
+
+void WrappedID3D11Device::ReleasePrecreatedShaders()
+{
+	// anything left wasn't needed, e.g. geometry shaders only used with stream-out
+	for(auto it=m_PrecreatedShaders.begin(); it != m_PrecreatedShaders.end(); ++it)
+		SAFE_RELEASE(it->second.shader);
+
+	m_PrecreatedShaders.clear();
+}
+
+ID3D11DeviceChild *WrappedID3D11Device::TakePrecreatedShader(ResourceId bytecodeID, D3D11_SHADER_VERSION_TYPE type, ID3D11ClassLinkage *linkage)
+{
+	if(linkage != NULL)
+		return NULL;
+
+	auto it = m_PrecreatedShaders.find(bytecodeID);
+	if(it == m_PrecreatedShaders.end() || it->second.type != type)
+		return NULL;
+
+	ID3D11DeviceChild *ret = it->second.shader;
+	m_PrecreatedShaders.erase(it);
+	return ret;
+}
+
+D3D11ResourceRecord *WrappedID3D11Device::GetShaderBytecodeRecord(const void *bytecode, size_t length)
+{
+	ShaderBytecodeKey key = GetShaderBytecodeKey(bytecode, length);
+
+	auto it = m_ShaderBytecodeRecords.find(key);
+	if(it != m_ShaderBytecodeRecords.end())
+		return it->second;
+
+	// this record is kept until the device is destroyed, so that bytecode which is
+	// released and created again (e.g. when streaming) is still only stored once.
+	ResourceId id = TrackedResource::GetNewUniqueID();
+
+	D3D11ResourceRecord *record = GetResourceManager()->AddResourceRecord(id);
+	record->Length = 0;
+
+	{
+		SCOPED_SERIALISE_CONTEXT(SHADER_BYTECODE);
+		Serialise_ShaderBytecode(id, bytecode, length);
+
+		record->AddChunk(scope.Get());
+	}
+
+	m_ShaderBytecodeRecords[key] = record;
+
+	return record;
+}
+
+byte *WrappedID3D11Device::SerialiseShaderBytecodeRef(const void *bytecode, size_t length, ResourceId &bytecodeID)
+{
+	bytecodeID = ResourceId();
+
+	// older logs have the bytecode inline in every creation chunk
+	if(m_State < WRITING && GetLogVersion() < 0x000009)
+	{
+		SERIALISE_ELEMENT_BUF(byte *, ShaderBytecode, bytecode, length);
+		return ShaderBytecode;
+	}
+
+	SERIALISE_ELEMENT(ResourceId, BytecodeID, GetShaderBytecodeRecord(bytecode, length)->GetResourceID());
+
+	bytecodeID = BytecodeID;
+
+	if(m_State >= WRITING)
+		return NULL;
+
+	auto it = m_ShaderBytecodes.find(BytecodeID);
+	if(it == m_ShaderBytecodes.end() || it->second.empty())
+	{
+		RDCERR("Missing shader bytecode %llu", BytecodeID);
+		return NULL;
+	}
+
+	byte *ret = new byte[it->second.size()];
+	memcpy(ret, &it->second[0], it->second.size());
+	return ret;
+}
+
 bool WrappedID3D11Device::Serialise_CreateVertexShader( 
 	const void *pShaderBytecode,
 	SIZE_T BytecodeLength,
@@ -1185,7 +1382,8 @@ bool WrappedID3D11Device::Serialise_CreateVertexShader(
 	ID3D11VertexShader **ppVertexShader)
 {
 	SERIALISE_ELEMENT(uint32_t, BytecodeLen, (uint32_t)BytecodeLength);
-	SERIALISE_ELEMENT_BUF(byte *, ShaderBytecode, (void *&)pShaderBytecode, BytecodeLength);
+	ResourceId BytecodeID;
+	byte *ShaderBytecode = SerialiseShaderBytecodeRef(pShaderBytecode, BytecodeLength, BytecodeID);
 	SERIALISE_ELEMENT(ResourceId, pLinkage, GetIDForResource(pClassLinkage));
 	SERIALISE_ELEMENT(ResourceId, pShader, GetIDForResource(*ppVertexShader));
 	
@@ -1195,8 +1393,10 @@ bool WrappedID3D11Device::Serialise_CreateVertexShader(
 		if(GetResourceManager()->HasLiveResource(pLinkage))
 			linkage = UNWRAP(WrappedID3D11ClassLinkage, (ID3D11ClassLinkage *)GetResourceManager()->GetLiveResource(pLinkage));
 
-		ID3D11VertexShader *ret;
-		HRESULT hr = m_pDevice->CreateVertexShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
+		HRESULT hr = S_OK;
+		ID3D11VertexShader *ret = (ID3D11VertexShader *)TakePrecreatedShader(BytecodeID, D3D11_SHVER_VERTEX_SHADER, linkage);
+		if(ret == NULL)
+			hr = m_pDevice->CreateVertexShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
 
 		if(FAILED(hr))
 		{
@@ -1204,7 +1404,7 @@ bool WrappedID3D11Device::Serialise_CreateVertexShader(
 		}
 		else
 		{
-			ret = new WrappedID3D11Shader<ID3D11VertexShader>(ret, new DXBC::DXBCFile(ShaderBytecode, (size_t)BytecodeLen), this);
+			ret = new WrappedID3D11Shader<ID3D11VertexShader>(ret, ShaderBytecode, (size_t)BytecodeLen, this);
 
 			GetResourceManager()->AddLiveResource(pShader, ret);
 		}
@@ -1232,10 +1432,12 @@ HRESULT WrappedID3D11Device::CreateVertexShader(
 	{
 		SCOPED_LOCK(m_D3DLock);
 
-		wrapped = new WrappedID3D11Shader<ID3D11VertexShader>(real, new DXBC::DXBCFile(pShaderBytecode, BytecodeLength), this);
+		wrapped = new WrappedID3D11Shader<ID3D11VertexShader>(real, pShaderBytecode, BytecodeLength, this);
 
 		if(m_State >= WRITING)
 		{
+			D3D11ResourceRecord *bytecodeRecord = GetShaderBytecodeRecord(pShaderBytecode, BytecodeLength);
+
 			SCOPED_SERIALISE_CONTEXT(CREATE_VERTEX_SHADER);
 			Serialise_CreateVertexShader(pShaderBytecode, BytecodeLength, pClassLinkage, &wrapped);
 
@@ -1246,6 +1448,7 @@ HRESULT WrappedID3D11Device::CreateVertexShader(
 
 			D3D11ResourceRecord *record = GetResourceManager()->AddResourceRecord(id);
 			record->Length = 0;
+			record->AddParent(bytecodeRecord);
 
 			record->AddChunk(scope.Get());
 		}
@@ -1269,7 +1472,8 @@ bool WrappedID3D11Device::Serialise_CreateGeometryShader(
 	ID3D11GeometryShader **ppGeometryShader)
 {
 	SERIALISE_ELEMENT(uint32_t, BytecodeLen, (uint32_t)BytecodeLength);
-	SERIALISE_ELEMENT_BUF(byte *, ShaderBytecode, pShaderBytecode, BytecodeLength);
+	ResourceId BytecodeID;
+	byte *ShaderBytecode = SerialiseShaderBytecodeRef(pShaderBytecode, BytecodeLength, BytecodeID);
 	SERIALISE_ELEMENT(ResourceId, pLinkage, GetIDForResource(pClassLinkage));
 	SERIALISE_ELEMENT(ResourceId, pShader, GetIDForResource(*ppGeometryShader));
 	
@@ -1279,8 +1483,10 @@ bool WrappedID3D11Device::Serialise_CreateGeometryShader(
 		if(GetResourceManager()->HasLiveResource(pLinkage))
 			linkage = UNWRAP(WrappedID3D11ClassLinkage, (ID3D11ClassLinkage *)GetResourceManager()->GetLiveResource(pLinkage));
 
-		ID3D11GeometryShader *ret;
-		HRESULT hr = m_pDevice->CreateGeometryShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
+		HRESULT hr = S_OK;
+		ID3D11GeometryShader *ret = (ID3D11GeometryShader *)TakePrecreatedShader(BytecodeID, D3D11_SHVER_GEOMETRY_SHADER, linkage);
+		if(ret == NULL)
+			hr = m_pDevice->CreateGeometryShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
 
 		if(FAILED(hr))
 		{
@@ -1288,7 +1494,7 @@ bool WrappedID3D11Device::Serialise_CreateGeometryShader(
 		}
 		else
 		{		
-			ret = new WrappedID3D11Shader<ID3D11GeometryShader>(ret, new DXBC::DXBCFile(ShaderBytecode, (size_t)BytecodeLen), this);
+			ret = new WrappedID3D11Shader<ID3D11GeometryShader>(ret, ShaderBytecode, (size_t)BytecodeLen, this);
 
 			GetResourceManager()->AddLiveResource(pShader, ret);
 		}
@@ -1316,10 +1522,12 @@ HRESULT WrappedID3D11Device::CreateGeometryShader(
 	{
 		SCOPED_LOCK(m_D3DLock);
 
-		wrapped = new WrappedID3D11Shader<ID3D11GeometryShader>(real, new DXBC::DXBCFile(pShaderBytecode, BytecodeLength), this);
+		wrapped = new WrappedID3D11Shader<ID3D11GeometryShader>(real, pShaderBytecode, BytecodeLength, this);
 		
 		if(m_State >= WRITING)
 		{
+			D3D11ResourceRecord *bytecodeRecord = GetShaderBytecodeRecord(pShaderBytecode, BytecodeLength);
+
 			SCOPED_SERIALISE_CONTEXT(CREATE_GEOMETRY_SHADER);
 			Serialise_CreateGeometryShader(pShaderBytecode, BytecodeLength, pClassLinkage, &wrapped);
 
@@ -1330,6 +1538,7 @@ HRESULT WrappedID3D11Device::CreateGeometryShader(
 
 			D3D11ResourceRecord *record = GetResourceManager()->AddResourceRecord(id);
 			record->Length = 0;
+			record->AddParent(bytecodeRecord);
 
 			record->AddChunk(scope.Get());
 		}
@@ -1359,7 +1568,8 @@ bool WrappedID3D11Device::Serialise_CreateGeometryShaderWithStreamOutput(
 	ID3D11GeometryShader **ppGeometryShader)
 {
 	SERIALISE_ELEMENT(uint32_t, BytecodeLen, (uint32_t)BytecodeLength);
-	SERIALISE_ELEMENT_BUF(byte *, ShaderBytecode, pShaderBytecode, BytecodeLength);
+	ResourceId BytecodeID;
+	byte *ShaderBytecode = SerialiseShaderBytecodeRef(pShaderBytecode, BytecodeLength, BytecodeID);
 	
 	SERIALISE_ELEMENT(uint32_t, numEntries, NumEntries);
 	SERIALISE_ELEMENT_ARR(D3D11_SO_DECLARATION_ENTRY, SODecl, pSODeclaration, numEntries);
@@ -1388,7 +1598,7 @@ bool WrappedID3D11Device::Serialise_CreateGeometryShaderWithStreamOutput(
 		}
 		else
 		{		
-			ret = new WrappedID3D11Shader<ID3D11GeometryShader>(ret, new DXBC::DXBCFile(ShaderBytecode, (size_t)BytecodeLen), this);
+			ret = new WrappedID3D11Shader<ID3D11GeometryShader>(ret, ShaderBytecode, (size_t)BytecodeLen, this);
 
 			GetResourceManager()->AddLiveResource(pShader, ret);
 		}
@@ -1428,10 +1638,12 @@ HRESULT WrappedID3D11Device::CreateGeometryShaderWithStreamOutput(
 	{
 		SCOPED_LOCK(m_D3DLock);
 
-		wrapped = new WrappedID3D11Shader<ID3D11GeometryShader>(real, new DXBC::DXBCFile(pShaderBytecode, BytecodeLength), this);
+		wrapped = new WrappedID3D11Shader<ID3D11GeometryShader>(real, pShaderBytecode, BytecodeLength, this);
 		
 		if(m_State >= WRITING)
 		{
+			D3D11ResourceRecord *bytecodeRecord = GetShaderBytecodeRecord(pShaderBytecode, BytecodeLength);
+
 			SCOPED_SERIALISE_CONTEXT(CREATE_GEOMETRY_SHADER_WITH_SO);
 			Serialise_CreateGeometryShaderWithStreamOutput(pShaderBytecode, BytecodeLength, pSODeclaration, NumEntries,
 															pBufferStrides, NumStrides, RasterizedStream, pClassLinkage, &wrapped);
@@ -1443,6 +1655,7 @@ HRESULT WrappedID3D11Device::CreateGeometryShaderWithStreamOutput(
 
 			D3D11ResourceRecord *record = GetResourceManager()->AddResourceRecord(id);
 			record->Length = 0;
+			record->AddParent(bytecodeRecord);
 
 			record->AddChunk(scope.Get());
 		}
@@ -1466,7 +1679,8 @@ bool WrappedID3D11Device::Serialise_CreatePixelShader(
 	ID3D11PixelShader **ppPixelShader)
 {
 	SERIALISE_ELEMENT(uint32_t, BytecodeLen, (uint32_t)BytecodeLength);
-	SERIALISE_ELEMENT_BUF(byte *, ShaderBytecode, pShaderBytecode, BytecodeLength);
+	ResourceId BytecodeID;
+	byte *ShaderBytecode = SerialiseShaderBytecodeRef(pShaderBytecode, BytecodeLength, BytecodeID);
 	SERIALISE_ELEMENT(ResourceId, pLinkage, GetIDForResource(pClassLinkage));
 	SERIALISE_ELEMENT(ResourceId, pShader, GetIDForResource(*ppPixelShader));
 	
@@ -1476,8 +1690,10 @@ bool WrappedID3D11Device::Serialise_CreatePixelShader(
 		if(GetResourceManager()->HasLiveResource(pLinkage))
 			linkage = UNWRAP(WrappedID3D11ClassLinkage, (ID3D11ClassLinkage *)GetResourceManager()->GetLiveResource(pLinkage));
 
-		ID3D11PixelShader *ret;
-		HRESULT hr = m_pDevice->CreatePixelShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
+		HRESULT hr = S_OK;
+		ID3D11PixelShader *ret = (ID3D11PixelShader *)TakePrecreatedShader(BytecodeID, D3D11_SHVER_PIXEL_SHADER, linkage);
+		if(ret == NULL)
+			hr = m_pDevice->CreatePixelShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
 
 		if(FAILED(hr))
 		{
@@ -1485,7 +1701,7 @@ bool WrappedID3D11Device::Serialise_CreatePixelShader(
 		}
 		else
 		{		
-			ret = new WrappedID3D11Shader<ID3D11PixelShader>(ret, new DXBC::DXBCFile(ShaderBytecode, (size_t)BytecodeLen), this);
+			ret = new WrappedID3D11Shader<ID3D11PixelShader>(ret, ShaderBytecode, (size_t)BytecodeLen, this);
 
 			GetResourceManager()->AddLiveResource(pShader, ret);
 		}
@@ -1513,10 +1729,12 @@ HRESULT WrappedID3D11Device::CreatePixelShader(
 	{
 		SCOPED_LOCK(m_D3DLock);
 
-		wrapped = new WrappedID3D11Shader<ID3D11PixelShader>(real, new DXBC::DXBCFile(pShaderBytecode, BytecodeLength), this);
+		wrapped = new WrappedID3D11Shader<ID3D11PixelShader>(real, pShaderBytecode, BytecodeLength, this);
 
 		if(m_State >= WRITING)
 		{
+			D3D11ResourceRecord *bytecodeRecord = GetShaderBytecodeRecord(pShaderBytecode, BytecodeLength);
+
 			SCOPED_SERIALISE_CONTEXT(CREATE_PIXEL_SHADER);
 			Serialise_CreatePixelShader(pShaderBytecode, BytecodeLength, pClassLinkage, &wrapped);
 
@@ -1527,6 +1745,7 @@ HRESULT WrappedID3D11Device::CreatePixelShader(
 
 			D3D11ResourceRecord *record = GetResourceManager()->AddResourceRecord(id);
 			record->Length = 0;
+			record->AddParent(bytecodeRecord);
 
 			record->AddChunk(scope.Get());
 		}
@@ -1550,7 +1769,8 @@ bool WrappedID3D11Device::Serialise_CreateHullShader(
 	ID3D11HullShader **ppHullShader)
 {
 	SERIALISE_ELEMENT(uint32_t, BytecodeLen, (uint32_t)BytecodeLength);
-	SERIALISE_ELEMENT_BUF(byte *, ShaderBytecode, pShaderBytecode, BytecodeLength);
+	ResourceId BytecodeID;
+	byte *ShaderBytecode = SerialiseShaderBytecodeRef(pShaderBytecode, BytecodeLength, BytecodeID);
 	SERIALISE_ELEMENT(ResourceId, pLinkage, GetIDForResource(pClassLinkage));
 	SERIALISE_ELEMENT(ResourceId, pShader, GetIDForResource(*ppHullShader));
 	
@@ -1560,8 +1780,10 @@ bool WrappedID3D11Device::Serialise_CreateHullShader(
 		if(GetResourceManager()->HasLiveResource(pLinkage))
 			linkage = UNWRAP(WrappedID3D11ClassLinkage, (ID3D11ClassLinkage *)GetResourceManager()->GetLiveResource(pLinkage));
 
-		ID3D11HullShader *ret;
-		HRESULT hr = m_pDevice->CreateHullShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
+		HRESULT hr = S_OK;
+		ID3D11HullShader *ret = (ID3D11HullShader *)TakePrecreatedShader(BytecodeID, D3D11_SHVER_HULL_SHADER, linkage);
+		if(ret == NULL)
+			hr = m_pDevice->CreateHullShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
 
 		if(FAILED(hr))
 		{
@@ -1569,7 +1791,7 @@ bool WrappedID3D11Device::Serialise_CreateHullShader(
 		}
 		else
 		{		
-			ret = new WrappedID3D11Shader<ID3D11HullShader>(ret, new DXBC::DXBCFile(ShaderBytecode, (size_t)BytecodeLen), this);
+			ret = new WrappedID3D11Shader<ID3D11HullShader>(ret, ShaderBytecode, (size_t)BytecodeLen, this);
 
 			GetResourceManager()->AddLiveResource(pShader, ret);
 		}
@@ -1597,10 +1819,12 @@ HRESULT WrappedID3D11Device::CreateHullShader(
 	{
 		SCOPED_LOCK(m_D3DLock);
 
-		wrapped = new WrappedID3D11Shader<ID3D11HullShader>(real, new DXBC::DXBCFile(pShaderBytecode, BytecodeLength), this);
+		wrapped = new WrappedID3D11Shader<ID3D11HullShader>(real, pShaderBytecode, BytecodeLength, this);
 		
 		if(m_State >= WRITING)
 		{
+			D3D11ResourceRecord *bytecodeRecord = GetShaderBytecodeRecord(pShaderBytecode, BytecodeLength);
+
 			SCOPED_SERIALISE_CONTEXT(CREATE_HULL_SHADER);
 			Serialise_CreateHullShader(pShaderBytecode, BytecodeLength, pClassLinkage, &wrapped);
 
@@ -1611,6 +1835,7 @@ HRESULT WrappedID3D11Device::CreateHullShader(
 
 			D3D11ResourceRecord *record = GetResourceManager()->AddResourceRecord(id);
 			record->Length = 0;
+			record->AddParent(bytecodeRecord);
 
 			record->AddChunk(scope.Get());
 		}
@@ -1634,7 +1859,8 @@ bool WrappedID3D11Device::Serialise_CreateDomainShader(
 	ID3D11DomainShader **ppDomainShader)
 {
 	SERIALISE_ELEMENT(uint32_t, BytecodeLen, (uint32_t)BytecodeLength);
-	SERIALISE_ELEMENT_BUF(byte *, ShaderBytecode, pShaderBytecode, BytecodeLength);
+	ResourceId BytecodeID;
+	byte *ShaderBytecode = SerialiseShaderBytecodeRef(pShaderBytecode, BytecodeLength, BytecodeID);
 	SERIALISE_ELEMENT(ResourceId, pLinkage, GetIDForResource(pClassLinkage));
 	SERIALISE_ELEMENT(ResourceId, pShader, GetIDForResource(*ppDomainShader));
 	
@@ -1644,8 +1870,10 @@ bool WrappedID3D11Device::Serialise_CreateDomainShader(
 		if(GetResourceManager()->HasLiveResource(pLinkage))
 			linkage = UNWRAP(WrappedID3D11ClassLinkage, (ID3D11ClassLinkage *)GetResourceManager()->GetLiveResource(pLinkage));
 
-		ID3D11DomainShader *ret;
-		HRESULT hr = m_pDevice->CreateDomainShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
+		HRESULT hr = S_OK;
+		ID3D11DomainShader *ret = (ID3D11DomainShader *)TakePrecreatedShader(BytecodeID, D3D11_SHVER_DOMAIN_SHADER, linkage);
+		if(ret == NULL)
+			hr = m_pDevice->CreateDomainShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
 
 		if(FAILED(hr))
 		{
@@ -1653,7 +1881,7 @@ bool WrappedID3D11Device::Serialise_CreateDomainShader(
 		}
 		else
 		{		
-			ret = new WrappedID3D11Shader<ID3D11DomainShader>(ret, new DXBC::DXBCFile(ShaderBytecode, (size_t)BytecodeLen), this);
+			ret = new WrappedID3D11Shader<ID3D11DomainShader>(ret, ShaderBytecode, (size_t)BytecodeLen, this);
 
 			GetResourceManager()->AddLiveResource(pShader, ret);
 		}
@@ -1681,10 +1909,12 @@ HRESULT WrappedID3D11Device::CreateDomainShader(
 	{
 		SCOPED_LOCK(m_D3DLock);
 
-		wrapped = new WrappedID3D11Shader<ID3D11DomainShader>(real, new DXBC::DXBCFile(pShaderBytecode, BytecodeLength), this);
+		wrapped = new WrappedID3D11Shader<ID3D11DomainShader>(real, pShaderBytecode, BytecodeLength, this);
 		
 		if(m_State >= WRITING)
 		{
+			D3D11ResourceRecord *bytecodeRecord = GetShaderBytecodeRecord(pShaderBytecode, BytecodeLength);
+
 			SCOPED_SERIALISE_CONTEXT(CREATE_DOMAIN_SHADER);
 			Serialise_CreateDomainShader(pShaderBytecode, BytecodeLength, pClassLinkage, &wrapped);
 
@@ -1695,6 +1925,7 @@ HRESULT WrappedID3D11Device::CreateDomainShader(
 
 			D3D11ResourceRecord *record = GetResourceManager()->AddResourceRecord(id);
 			record->Length = 0;
+			record->AddParent(bytecodeRecord);
 
 			record->AddChunk(scope.Get());
 		}
@@ -1718,7 +1949,8 @@ bool WrappedID3D11Device::Serialise_CreateComputeShader(
 	ID3D11ComputeShader **ppComputeShader)
 {
 	SERIALISE_ELEMENT(uint32_t, BytecodeLen, (uint32_t)BytecodeLength);
-	SERIALISE_ELEMENT_BUF(byte *, ShaderBytecode, pShaderBytecode, BytecodeLength);
+	ResourceId BytecodeID;
+	byte *ShaderBytecode = SerialiseShaderBytecodeRef(pShaderBytecode, BytecodeLength, BytecodeID);
 	SERIALISE_ELEMENT(ResourceId, pLinkage, GetIDForResource(pClassLinkage));
 	SERIALISE_ELEMENT(ResourceId, pShader, GetIDForResource(*ppComputeShader));
 
@@ -1728,8 +1960,10 @@ bool WrappedID3D11Device::Serialise_CreateComputeShader(
 		if(GetResourceManager()->HasLiveResource(pLinkage))
 			linkage = UNWRAP(WrappedID3D11ClassLinkage, (ID3D11ClassLinkage *)GetResourceManager()->GetLiveResource(pLinkage));
 
-		ID3D11ComputeShader *ret;
-		HRESULT hr = m_pDevice->CreateComputeShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
+		HRESULT hr = S_OK;
+		ID3D11ComputeShader *ret = (ID3D11ComputeShader *)TakePrecreatedShader(BytecodeID, D3D11_SHVER_COMPUTE_SHADER, linkage);
+		if(ret == NULL)
+			hr = m_pDevice->CreateComputeShader(ShaderBytecode, (size_t)BytecodeLen, linkage, &ret);
 
 		if(FAILED(hr))
 		{
@@ -1737,7 +1971,7 @@ bool WrappedID3D11Device::Serialise_CreateComputeShader(
 		}
 		else
 		{		
-			ret = new WrappedID3D11Shader<ID3D11ComputeShader>(ret, new DXBC::DXBCFile(ShaderBytecode, (size_t)BytecodeLen), this);
+			ret = new WrappedID3D11Shader<ID3D11ComputeShader>(ret, ShaderBytecode, (size_t)BytecodeLen, this);
 
 			GetResourceManager()->AddLiveResource(pShader, ret);
 		}
@@ -1765,10 +1999,12 @@ HRESULT WrappedID3D11Device::CreateComputeShader(
 	{
 		SCOPED_LOCK(m_D3DLock);
 
-		wrapped = new WrappedID3D11Shader<ID3D11ComputeShader>(real, new DXBC::DXBCFile(pShaderBytecode, BytecodeLength), this);
+		wrapped = new WrappedID3D11Shader<ID3D11ComputeShader>(real, pShaderBytecode, BytecodeLength, this);
 		
 		if(m_State >= WRITING)
 		{
+			D3D11ResourceRecord *bytecodeRecord = GetShaderBytecodeRecord(pShaderBytecode, BytecodeLength);
+
 			SCOPED_SERIALISE_CONTEXT(CREATE_COMPUTE_SHADER);
 			Serialise_CreateComputeShader(pShaderBytecode, BytecodeLength, pClassLinkage, &wrapped);
 
@@ -1779,6 +2015,7 @@ HRESULT WrappedID3D11Device::CreateComputeShader(
 
 			D3D11ResourceRecord *record = GetResourceManager()->AddResourceRecord(id);
 			record->Length = 0;
+			record->AddParent(bytecodeRecord);
 
 			record->AddChunk(scope.Get());
 		}
@@ -101,6 +101,24 @@ bool D3D11ResourceManager::Need_InitialStateChunk(ID3D11DeviceChild *res)
 	return IdentifyTypeByPtr(res) != Resource_Buffer;
 }
 
+bool D3D11ResourceManager::Defer_InitialState(ID3D11DeviceChild *live)
+{
+	// the first read of the frame reads back buffers (and copies structure counts into
+	// them from UAVs), never textures
+	ResourceType type = IdentifyTypeByPtr(live);
+	return type == Resource_Texture1D || type == Resource_Texture2D || type == Resource_Texture3D;
+}
+
+bool D3D11ResourceManager::Reuse_InitialState(ID3D11DeviceChild *res)
+{
+	// buffers and textures are marked dirty on every write outside of a captured frame,
+	// so their staging copy stays valid until then. UAV hidden counters are changed by
+	// any dispatch or draw with the UAV bound, which isn't tracked.
+	ResourceType type = IdentifyTypeByPtr(res);
+	return type == Resource_Buffer || type == Resource_Texture1D ||
+			type == Resource_Texture2D || type == Resource_Texture3D;
+}
+
 bool D3D11ResourceManager::Prepare_InitialState(ID3D11DeviceChild *res)
 {
 	return m_Device->Prepare_InitialState(res);
@@ -49,6 +49,9 @@ struct D3D11ResourceRecord : public ResourceRecord
 		: ResourceRecord(id, true)
 	{
 		RDCEraseEl(ShadowPtr);
+		RDCEraseEl(ShadowWatched);
+		RDCEraseEl(ShadowGuarded);
+		RDCEraseEl(ShadowLarge);
 		RDCEraseEl(contexts);
 		ignoreSerialise = false;
 	}
@@ -62,18 +65,87 @@ struct D3D11ResourceRecord : public ResourceRecord
 	{
 		if(ShadowPtr[ctx][0] == NULL)
 		{
-			ShadowPtr[ctx][0] = Serialiser::AllocAlignedBuffer(size + sizeof(markerValue), 32);
+			// both copies are compared in full, so big ones go in large pages where possible
+			ShadowPtr[ctx][0] = (byte *)LargePage::Alloc(size + sizeof(markerValue));
+			if(ShadowPtr[ctx][0])
+				ShadowPtr[ctx][1] = (byte *)LargePage::Alloc(size + sizeof(markerValue));
+
+			if(ShadowPtr[ctx][1])
+			{
+				ShadowLarge[ctx] = true;
+			}
+			else
+			{
+				LargePage::Free(ShadowPtr[ctx][0], size + sizeof(markerValue));
+
+				ShadowPtr[ctx][0] = Serialiser::AllocAlignedBuffer(size + sizeof(markerValue), 32);
+				ShadowPtr[ctx][1] = Serialiser::AllocAlignedBuffer(size + sizeof(markerValue), 32);
+			}
+
+			memcpy(ShadowPtr[ctx][0] + size, markerValue, sizeof(markerValue));
+			memcpy(ShadowPtr[ctx][1] + size, markerValue, sizeof(markerValue));
+
+			ShadowSize[ctx] = size;
+		}
+	}
+
+	// as AllocShadowStorage, but writes to the first shadow copy are watched so that changes
+	// can be found with GetWrittenShadowPages instead of comparing the whole buffer. Falls
+	// back to normal storage if the memory can't be watched.
+	void AllocWatchedShadowStorage(int ctx, size_t size)
+	{
+		if(ShadowPtr[ctx][0] == NULL)
+		{
+			ShadowPtr[ctx][0] = (byte *)WriteWatch::Alloc(size + sizeof(markerValue));
+
+			if(ShadowPtr[ctx][0] == NULL)
+			{
+				AllocShadowStorage(ctx, size);
+				return;
+			}
+
 			ShadowPtr[ctx][1] = Serialiser::AllocAlignedBuffer(size + sizeof(markerValue), 32);
 
 			memcpy(ShadowPtr[ctx][0] + size, markerValue, sizeof(markerValue));
 			memcpy(ShadowPtr[ctx][1] + size, markerValue, sizeof(markerValue));
 
 			ShadowSize[ctx] = size;
+			ShadowWatched[ctx] = true;
+		}
+	}
+
+	// as AllocShadowStorage, but the first shadow copy - the one the application writes to - is
+	// followed by a guard page, so writing past the end faults straight away. Only the few
+	// bytes of padding up to the 16-byte aligned end aren't guarded, and are checked with the
+	// marker as before. Falls back to normal storage if the memory can't be guarded.
+	void AllocGuardedShadowStorage(int ctx, size_t size)
+	{
+		if(ShadowPtr[ctx][0] == NULL)
+		{
+			ShadowPtr[ctx][0] = (byte *)GuardPage::Alloc(size);
+
+			if(ShadowPtr[ctx][0] == NULL)
+			{
+				AllocShadowStorage(ctx, size);
+				return;
+			}
+
+			ShadowPtr[ctx][1] = Serialiser::AllocAlignedBuffer(size + sizeof(markerValue), 32);
+
+			memcpy(ShadowPtr[ctx][0] + size, markerValue, AlignUp16(size) - size);
+			memcpy(ShadowPtr[ctx][1] + size, markerValue, sizeof(markerValue));
+
+			ShadowSize[ctx] = size;
+			ShadowGuarded[ctx] = true;
 		}
 	}
 
 	bool VerifyShadowStorage(int ctx)
 	{
+		// the second copy is only written by us, and overruns of the first have already faulted
+		if(ShadowGuarded[ctx])
+			return memcmp(ShadowPtr[ctx][0] + ShadowSize[ctx], markerValue, AlignUp16(ShadowSize[ctx]) - ShadowSize[ctx]) == 0;
+
 		if(ShadowPtr[ctx][0] && memcmp(ShadowPtr[ctx][0] + ShadowSize[ctx], markerValue, sizeof(markerValue)))
 			return false;
 
@@ -89,18 +161,55 @@ struct D3D11ResourceRecord : public ResourceRecord
 		{
 			if(ShadowPtr[i][0] != NULL)
 			{
-				Serialiser::FreeAlignedBuffer(ShadowPtr[i][0]);
-				Serialiser::FreeAlignedBuffer(ShadowPtr[i][1]);
+				if(ShadowLarge[i])
+				{
+					LargePage::Free(ShadowPtr[i][0], ShadowSize[i] + sizeof(markerValue));
+					LargePage::Free(ShadowPtr[i][1], ShadowSize[i] + sizeof(markerValue));
+				}
+				else
+				{
+					if(ShadowWatched[i])
+						WriteWatch::Free(ShadowPtr[i][0], ShadowSize[i] + sizeof(markerValue));
+					else if(ShadowGuarded[i])
+						GuardPage::Free(ShadowPtr[i][0], ShadowSize[i]);
+					else
+						Serialiser::FreeAlignedBuffer(ShadowPtr[i][0]);
+					Serialiser::FreeAlignedBuffer(ShadowPtr[i][1]);
+				}
 			}
 			ShadowPtr[i][0] = ShadowPtr[i][1] = NULL;
+			ShadowWatched[i] = false;
+			ShadowGuarded[i] = false;
+			ShadowLarge[i] = false;
 		}
 	}
 
+	bool IsShadowWatched(int ctx)
+	{
+		return ShadowWatched[ctx];
+	}
+
+	// appends the offsets of pages of the first shadow copy written since the last call,
+	// only valid if IsShadowWatched(ctx)
+	void GetWrittenShadowPages(int ctx, vector<size_t> &pageOffsets)
+	{
+		WriteWatch::GetWrittenPages(ShadowPtr[ctx][0], ShadowSize[ctx], pageOffsets);
+	}
+
 	byte *GetShadowPtr(int ctx, int p)
 	{
 		return ShadowPtr[ctx][p];
 	}
 
+	uint64_t GetShadowMemory()
+	{
+		uint64_t ret = 0;
+		for(int i=0; i < 32; i++)
+			if(ShadowPtr[i][0] != NULL)
+				ret += 2*(ShadowSize[i] + sizeof(markerValue));
+		return ret;
+	}
+
 	int GetContextID()
 	{
 		// 0 is reserved for the immediate context
@@ -128,6 +237,9 @@ struct D3D11ResourceRecord : public ResourceRecord
 private:
 	byte *ShadowPtr[32][2];
 	size_t ShadowSize[32];
+	bool ShadowWatched[32];
+	bool ShadowGuarded[32];
+	bool ShadowLarge[32];
 
 	bool contexts[32];
 };
@@ -152,10 +264,12 @@ class D3D11ResourceManager : public ResourceManager<ID3D11DeviceChild*, D3D11Res
 		
 		bool Force_InitialState(ID3D11DeviceChild *res);
 		bool Need_InitialStateChunk(ID3D11DeviceChild *res);
+		bool Reuse_InitialState(ID3D11DeviceChild *res);
 		bool Prepare_InitialState(ID3D11DeviceChild *res);
 		bool Serialise_InitialState(ID3D11DeviceChild *res);
 		void Create_InitialState(ResourceId id, ID3D11DeviceChild *live, bool hasData);
 		void Apply_InitialState(ID3D11DeviceChild *live, InitialContentData data);
+		bool Defer_InitialState(ID3D11DeviceChild *live);
 
 		WrappedID3D11Device *m_Device;
 };
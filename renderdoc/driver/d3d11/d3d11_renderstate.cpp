@@ -30,6 +30,8 @@
 
 D3D11RenderState::D3D11RenderState(Serialiser *ser)
 {
+	m_Tracker = NULL;
+
 	RDCEraseEl(IA);
 	RDCEraseEl(VS);
 	RDCEraseEl(HS);
@@ -49,6 +51,8 @@ D3D11RenderState::D3D11RenderState(Serialiser *ser)
 
 D3D11RenderState::D3D11RenderState(const D3D11RenderState &other)
 {
+	m_Tracker = NULL;
+
 	RDCEraseEl(IA);
 	RDCEraseEl(VS);
 	RDCEraseEl(HS);
@@ -95,6 +99,13 @@ D3D11RenderState::~D3D11RenderState()
 
 void D3D11RenderState::ReleaseRefs()
 {
+	// everything is about to be released, so an active tracker needs to save all of it
+	if(m_Tracker)
+	{
+		for(int s=0; s < eStage_Count; s++)
+			TouchStage(s);
+	}
+
 	ReleaseRef(IA.IndexBuffer);
 	ReleaseRef(IA.Layout);
 	
@@ -390,15 +401,24 @@ void D3D11RenderState::MarkReferenced(WrappedID3D11DeviceContext *ctx, bool init
 
 void D3D11RenderState::AddRefs()
 {
-	TakeRef(IA.IndexBuffer);
-	TakeRef(IA.Layout);
-	
-	for(UINT i=0; i < D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT; i++)
-		TakeRef(IA.VBs[i]);
+	for(int s=0; s < eStage_Count; s++)
+		TakeStageRefs(s);
+}
 
-	shader *sh = &VS;
-	for(int s=0; s < 6; s++)
+void D3D11RenderState::TakeStageRefs(int stage)
+{
+	if(stage == eStage_IA)
 	{
+		TakeRef(IA.IndexBuffer);
+		TakeRef(IA.Layout);
+
+		for(UINT i=0; i < D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT; i++)
+			TakeRef(IA.VBs[i]);
+	}
+	else if(stage >= eStage_VS && stage <= eStage_CS)
+	{
+		shader *sh = &VS + (stage - eStage_VS);
+
 		TakeRef(sh->Shader);
 
 		for(UINT i=0; i < D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT; i++)
@@ -415,25 +435,74 @@ void D3D11RenderState::AddRefs()
 		
 		for(UINT i=0; i < D3D11_SHADER_MAX_INTERFACES; i++)
 			TakeRef(sh->Instances[i]);
-		
-		sh++;
 	}
-		
-	for(UINT i=0; i < D3D11_SO_BUFFER_SLOT_COUNT; i++)
-		TakeRef(SO.Buffers[i]);
+	else if(stage == eStage_SO)
+	{
+		for(UINT i=0; i < D3D11_SO_BUFFER_SLOT_COUNT; i++)
+			TakeRef(SO.Buffers[i]);
+	}
+	else if(stage == eStage_RS)
+	{
+		TakeRef(RS.State);
+	}
+	else if(stage == eStage_OM)
+	{
+		TakeRef(OM.BlendState);
+		TakeRef(OM.DepthStencilState);
 
-	TakeRef(RS.State);
+		for(UINT i=0; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i++)
+			TakeRef(OM.RenderTargets[i]);
 
-	TakeRef(OM.BlendState);
-	TakeRef(OM.DepthStencilState);
+		for(UINT i=0; i < D3D11_PS_CS_UAV_REGISTER_COUNT; i++)
+			TakeRef(OM.UAVs[i]);
 
-	for(UINT i=0; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i++)
-		TakeRef(OM.RenderTargets[i]);
+		TakeRef(OM.DepthView);
+	}
+}
 
-	for(UINT i=0; i < D3D11_PS_CS_UAV_REGISTER_COUNT; i++)
-		TakeRef(OM.UAVs[i]);
+int D3D11RenderState::GetStage(const void *member) const
+{
+	const byte *p = (const byte *)member;
+
+	if(p >= (const byte *)&IA && p < (const byte *)(&IA + 1))
+		return eStage_IA;
+
+	// the shader stages are laid out contiguously, in the same order as the Stage enum
+	if(p >= (const byte *)&VS && p < (const byte *)(&CS + 1))
+		return eStage_VS + int((p - (const byte *)&VS) / sizeof(shader));
+
+	if(p >= (const byte *)&SO && p < (const byte *)(&SO + 1))
+		return eStage_SO;
+
+	if(p >= (const byte *)&RS && p < (const byte *)(&RS + 1))
+		return eStage_RS;
+
+	if(p >= (const byte *)&OM && p < (const byte *)(&OM + 1))
+		return eStage_OM;
+
+	return eStage_Count;
+}
 
-	TakeRef(OM.DepthView);
+void D3D11RenderState::TouchStage(int stage)
+{
+	if(m_Tracker && stage < eStage_Count)
+		m_Tracker->Save(stage);
+}
+
+void D3D11RenderState::CopyStage(const D3D11RenderState &other, int stage)
+{
+	if(stage == eStage_IA)
+		memcpy(&IA, &other.IA, sizeof(IA));
+	else if(stage >= eStage_VS && stage <= eStage_CS)
+		memcpy(&VS + (stage - eStage_VS), &other.VS + (stage - eStage_VS), sizeof(shader));
+	else if(stage == eStage_SO)
+		memcpy(&SO, &other.SO, sizeof(SO));
+	else if(stage == eStage_RS)
+		memcpy(&RS, &other.RS, sizeof(RS));
+	else if(stage == eStage_OM)
+		memcpy(&OM, &other.OM, sizeof(OM));
+
+	TakeStageRefs(stage);
 }
 
 void D3D11RenderState::Serialise(LogState m_State, WrappedID3D11Device *device)
@@ -778,75 +847,120 @@ void D3D11RenderState::ApplyState(WrappedID3D11DeviceContext *context)
 {
 	context->ClearState();
 
+	ApplyStages(context, (1U << eStage_Count) - 1);
+}
+
+void D3D11RenderState::ApplyStages(WrappedID3D11DeviceContext *context, uint32_t stageMask)
+{
 	// IA
-	context->IASetInputLayout(IA.Layout);
-	context->IASetPrimitiveTopology(IA.Topo);
-	context->IASetIndexBuffer(IA.IndexBuffer, IA.IndexFormat, IA.IndexOffset);
-	context->IASetVertexBuffers(0, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT, IA.VBs, IA.Strides, IA.Offsets);
+	if(stageMask & (1U << eStage_IA))
+	{
+		context->IASetInputLayout(IA.Layout);
+		context->IASetPrimitiveTopology(IA.Topo);
+		context->IASetIndexBuffer(IA.IndexBuffer, IA.IndexFormat, IA.IndexOffset);
+		context->IASetVertexBuffers(0, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT, IA.VBs, IA.Strides, IA.Offsets);
+	}
 
 	// VS
-	context->VSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, VS.SRVs);
-	context->VSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, VS.Samplers);
-	context->VSSetShader((ID3D11VertexShader *)VS.Shader, VS.Instances, VS.NumInstances);
+	if(stageMask & (1U << eStage_VS))
+	{
+		context->VSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, VS.SRVs);
+		context->VSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, VS.Samplers);
+		context->VSSetShader((ID3D11VertexShader *)VS.Shader, VS.Instances, VS.NumInstances);
+	}
 
 	// DS
-	context->DSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, DS.SRVs);
-	context->DSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, DS.Samplers);
-	context->DSSetShader((ID3D11DomainShader *)DS.Shader, DS.Instances, DS.NumInstances);
+	if(stageMask & (1U << eStage_DS))
+	{
+		context->DSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, DS.SRVs);
+		context->DSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, DS.Samplers);
+		context->DSSetShader((ID3D11DomainShader *)DS.Shader, DS.Instances, DS.NumInstances);
+	}
 
 	// HS
-	context->HSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, HS.SRVs);
-	context->HSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, HS.Samplers);
-	context->HSSetShader((ID3D11HullShader *)HS.Shader, HS.Instances, HS.NumInstances);
+	if(stageMask & (1U << eStage_HS))
+	{
+		context->HSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, HS.SRVs);
+		context->HSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, HS.Samplers);
+		context->HSSetShader((ID3D11HullShader *)HS.Shader, HS.Instances, HS.NumInstances);
+	}
 
 	// GS
-	context->GSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, GS.SRVs);
-	context->GSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, GS.Samplers);
-	context->GSSetShader((ID3D11GeometryShader *)GS.Shader, GS.Instances, GS.NumInstances);
+	if(stageMask & (1U << eStage_GS))
+	{
+		context->GSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, GS.SRVs);
+		context->GSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, GS.Samplers);
+		context->GSSetShader((ID3D11GeometryShader *)GS.Shader, GS.Instances, GS.NumInstances);
+	}
 
-	context->SOSetTargets(D3D11_SO_BUFFER_SLOT_COUNT, SO.Buffers, SO.Offsets);
+	if(stageMask & (1U << eStage_SO))
+		context->SOSetTargets(D3D11_SO_BUFFER_SLOT_COUNT, SO.Buffers, SO.Offsets);
 
 	// RS
-	context->RSSetState(RS.State);
-	context->RSSetViewports(RS.NumViews, RS.Viewports);
-	context->RSSetScissorRects(RS.NumScissors, RS.Scissors);
+	if(stageMask & (1U << eStage_RS))
+	{
+		context->RSSetState(RS.State);
+		context->RSSetViewports(RS.NumViews, RS.Viewports);
+		context->RSSetScissorRects(RS.NumScissors, RS.Scissors);
+	}
 
 	UINT UAV_keepcounts[D3D11_PS_CS_UAV_REGISTER_COUNT] = { (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1 };
 
 	// CS
-	context->CSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, CS.SRVs);
-	context->CSSetUnorderedAccessViews(0, D3D11_PS_CS_UAV_REGISTER_COUNT, CS.UAVs, UAV_keepcounts);
-	context->CSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, CS.Samplers);
-	context->CSSetShader((ID3D11ComputeShader *)CS.Shader, CS.Instances, CS.NumInstances);
+	if(stageMask & (1U << eStage_CS))
+	{
+		context->CSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, CS.SRVs);
+		context->CSSetUnorderedAccessViews(0, D3D11_PS_CS_UAV_REGISTER_COUNT, CS.UAVs, UAV_keepcounts);
+		context->CSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, CS.Samplers);
+		context->CSSetShader((ID3D11ComputeShader *)CS.Shader, CS.Instances, CS.NumInstances);
+	}
 
 	// PS
-	context->PSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, PS.SRVs);
-	context->PSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, PS.Samplers);
-	context->PSSetShader((ID3D11PixelShader *)PS.Shader, PS.Instances, PS.NumInstances);
+	if(stageMask & (1U << eStage_PS))
+	{
+		context->PSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, PS.SRVs);
+		context->PSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, PS.Samplers);
+		context->PSSetShader((ID3D11PixelShader *)PS.Shader, PS.Instances, PS.NumInstances);
+	}
 	
 #if defined(INCLUDE_D3D_11_1)
-	context->VSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, VS.ConstantBuffers, VS.CBOffsets, VS.CBCounts);
-	context->DSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, DS.ConstantBuffers, DS.CBOffsets, DS.CBCounts);
-	context->HSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, HS.ConstantBuffers, HS.CBOffsets, HS.CBCounts);
-	context->GSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, GS.ConstantBuffers, GS.CBOffsets, GS.CBCounts);
-	context->CSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, CS.ConstantBuffers, CS.CBOffsets, CS.CBCounts);
-	context->PSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, PS.ConstantBuffers, PS.CBOffsets, PS.CBCounts);
+	if(stageMask & (1U << eStage_VS))
+		context->VSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, VS.ConstantBuffers, VS.CBOffsets, VS.CBCounts);
+	if(stageMask & (1U << eStage_DS))
+		context->DSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, DS.ConstantBuffers, DS.CBOffsets, DS.CBCounts);
+	if(stageMask & (1U << eStage_HS))
+		context->HSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, HS.ConstantBuffers, HS.CBOffsets, HS.CBCounts);
+	if(stageMask & (1U << eStage_GS))
+		context->GSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, GS.ConstantBuffers, GS.CBOffsets, GS.CBCounts);
+	if(stageMask & (1U << eStage_CS))
+		context->CSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, CS.ConstantBuffers, CS.CBOffsets, CS.CBCounts);
+	if(stageMask & (1U << eStage_PS))
+		context->PSSetConstantBuffers1(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, PS.ConstantBuffers, PS.CBOffsets, PS.CBCounts);
 #else
-	context->VSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, VS.ConstantBuffers);
-	context->DSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, DS.ConstantBuffers);
-	context->HSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, HS.ConstantBuffers);
-	context->GSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, GS.ConstantBuffers);
-	context->CSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, CS.ConstantBuffers);
-	context->PSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, PS.ConstantBuffers);
+	if(stageMask & (1U << eStage_VS))
+		context->VSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, VS.ConstantBuffers);
+	if(stageMask & (1U << eStage_DS))
+		context->DSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, DS.ConstantBuffers);
+	if(stageMask & (1U << eStage_HS))
+		context->HSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, HS.ConstantBuffers);
+	if(stageMask & (1U << eStage_GS))
+		context->GSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, GS.ConstantBuffers);
+	if(stageMask & (1U << eStage_CS))
+		context->CSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, CS.ConstantBuffers);
+	if(stageMask & (1U << eStage_PS))
+		context->PSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, PS.ConstantBuffers);
 #endif
 
 	// OM
-	context->OMSetBlendState(OM.BlendState, OM.BlendFactor, OM.SampleMask);
-	context->OMSetDepthStencilState(OM.DepthStencilState, OM.StencRef);
+	if(stageMask & (1U << eStage_OM))
+	{
+		context->OMSetBlendState(OM.BlendState, OM.BlendFactor, OM.SampleMask);
+		context->OMSetDepthStencilState(OM.DepthStencilState, OM.StencRef);
 
-	context->OMSetRenderTargetsAndUnorderedAccessViews(OM.UAVStartSlot, OM.RenderTargets,
-														OM.DepthView,
-														OM.UAVStartSlot, D3D11_PS_CS_UAV_REGISTER_COUNT-OM.UAVStartSlot, OM.UAVs, UAV_keepcounts);
+		context->OMSetRenderTargetsAndUnorderedAccessViews(OM.UAVStartSlot, OM.RenderTargets,
+															OM.DepthView,
+															OM.UAVStartSlot, D3D11_PS_CS_UAV_REGISTER_COUNT-OM.UAVStartSlot, OM.UAVs, UAV_keepcounts);
+	}
 }
 
 void D3D11RenderState::TakeRef(IUnknown *p)
@@ -1028,6 +1142,7 @@ void D3D11RenderState::UnbindIUnknownForWrite(IUnknown *resource)
 			
 			if(found || resource == (IUnknown *)sh->UAVs[i])
 			{
+				Touch(&sh->UAVs[i]);
 				ReleaseRef(sh->UAVs[i]);
 				sh->UAVs[i] = NULL;
 			}
@@ -1040,6 +1155,7 @@ void D3D11RenderState::UnbindIUnknownForWrite(IUnknown *resource)
 	{
 		if(resource == (IUnknown *)SO.Buffers[i])
 		{
+			Touch(&SO.Buffers[i]);
 			ReleaseRef(SO.Buffers[i]);
 			SO.Buffers[i] = NULL;
 		}
@@ -1060,6 +1176,7 @@ void D3D11RenderState::UnbindIUnknownForWrite(IUnknown *resource)
 
 		if(found || resource == (IUnknown *)OM.RenderTargets[i])
 		{
+			Touch(&OM.RenderTargets[i]);
 			ReleaseRef(OM.RenderTargets[i]);
 			OM.RenderTargets[i] = NULL;
 		}
@@ -1080,6 +1197,7 @@ void D3D11RenderState::UnbindIUnknownForWrite(IUnknown *resource)
 
 		if(found || resource == (IUnknown *)OM.UAVs[i])
 		{
+			Touch(&OM.UAVs[i]);
 			ReleaseRef(OM.UAVs[i]);
 			OM.UAVs[i] = NULL;
 		}
@@ -1106,6 +1224,7 @@ void D3D11RenderState::UnbindIUnknownForWrite(IUnknown *resource)
 
 		if(found || resource == (IUnknown *)OM.DepthView)
 		{
+			Touch(&OM.DepthView);
 			ReleaseRef(OM.DepthView);
 			OM.DepthView = NULL;
 		}
@@ -1119,6 +1238,7 @@ void D3D11RenderState::UnbindIUnknownForRead(IUnknown *resource, bool allowDepth
 		if(resource == (IUnknown *)IA.VBs[i])
 		{
 			//RDCDEBUG("Resource was bound on IA VB %u", i);
+			Touch(&IA.VBs[i]);
 			ReleaseRef(IA.VBs[i]);
 			IA.VBs[i] = NULL;
 		}
@@ -1127,6 +1247,7 @@ void D3D11RenderState::UnbindIUnknownForRead(IUnknown *resource, bool allowDepth
 	if(resource == (IUnknown *)IA.IndexBuffer)
 	{
 		//RDCDEBUG("Resource was bound on IA IB");
+		Touch(&IA.IndexBuffer);
 		ReleaseRef(IA.IndexBuffer);
 		IA.IndexBuffer = NULL;
 	}
@@ -1140,6 +1261,7 @@ void D3D11RenderState::UnbindIUnknownForRead(IUnknown *resource, bool allowDepth
 			if(resource == (IUnknown *)sh->ConstantBuffers[i])
 			{
 				//RDCDEBUG("Resource was bound on %s CB %u", names[s], i);
+				Touch(&sh->ConstantBuffers[i]);
 				ReleaseRef(sh->ConstantBuffers[i]);
 				sh->ConstantBuffers[i] = NULL;
 			}
@@ -1216,6 +1338,7 @@ void D3D11RenderState::UnbindIUnknownForRead(IUnknown *resource, bool allowDepth
 				else
 				{
 					//RDCDEBUG("Unbinding.");
+					Touch(&sh->SRVs[i]);
 					ReleaseRef(sh->SRVs[i]);
 					sh->SRVs[i] = NULL;
 				}
@@ -1574,12 +1697,47 @@ bool D3D11RenderState::shader::Used_UAV(uint32_t slot) const
 }
 
 D3D11RenderStateTracker::D3D11RenderStateTracker(WrappedID3D11DeviceContext *ctx)
-	: m_RS(*ctx->GetCurrentPipelineState())
+	: m_RS((Serialiser *)NULL)
 {
 	m_pContext = ctx;
+	m_pState = ctx->GetCurrentPipelineState();
+	m_SavedStages = 0;
+
+	m_pPrev = m_pState->m_Tracker;
+	m_pState->m_Tracker = this;
 }
 
 D3D11RenderStateTracker::~D3D11RenderStateTracker()
 {
-	m_RS.ApplyState(m_pContext);
+	m_pState->m_Tracker = m_pPrev;
+
+	if(m_SavedStages == 0)
+		return;
+
+	// unbind any outputs that were changed first, so that restoring the original read bindings
+	// isn't blocked by a hazard against something the debug operation bound for write.
+	ID3D11UnorderedAccessView *nullUAVs[D3D11_PS_CS_UAV_REGISTER_COUNT] = { 0 };
+	UINT UAV_keepcounts[D3D11_PS_CS_UAV_REGISTER_COUNT] = { (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1, (UINT)-1 };
+
+	if(m_SavedStages & (1U << D3D11RenderState::eStage_OM))
+		m_pContext->OMSetRenderTargetsAndUnorderedAccessViews(0, NULL, NULL, 0, D3D11_PS_CS_UAV_REGISTER_COUNT, nullUAVs, UAV_keepcounts);
+	if(m_SavedStages & (1U << D3D11RenderState::eStage_CS))
+		m_pContext->CSSetUnorderedAccessViews(0, D3D11_PS_CS_UAV_REGISTER_COUNT, nullUAVs, UAV_keepcounts);
+	if(m_SavedStages & (1U << D3D11RenderState::eStage_SO))
+		m_pContext->SOSetTargets(0, NULL, NULL);
+
+	m_RS.ApplyStages(m_pContext, m_SavedStages);
+}
+
+void D3D11RenderStateTracker::Save(int stage)
+{
+	if((m_SavedStages & (1U << stage)) == 0)
+	{
+		m_SavedStages |= (1U << stage);
+		m_RS.CopyStage(*m_pState, stage);
+	}
+
+	// an outer tracker needs to see the change too
+	if(m_pPrev)
+		m_pPrev->Save(stage);
 }
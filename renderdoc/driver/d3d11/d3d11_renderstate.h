@@ -35,6 +35,7 @@ class Serialiser;
 class WrappedID3D11Device;
 class WrappedID3D11DeviceContext;
 class D3D11ResourceManager;
+struct D3D11RenderStateTracker;
 
 struct D3D11RenderState
 {
@@ -48,6 +49,34 @@ struct D3D11RenderState
 	void ApplyState(WrappedID3D11DeviceContext *context);
 	void Clear();
 
+	// the parts of the pipeline that can be saved and restored independently
+	enum Stage
+	{
+		eStage_IA,
+		eStage_VS,
+		eStage_HS,
+		eStage_DS,
+		eStage_GS,
+		eStage_PS,
+		eStage_CS,
+		eStage_SO,
+		eStage_RS,
+		eStage_OM,
+		eStage_Count,
+	};
+
+	// applies only the given stages (a mask of 1<<Stage) on top of the current state
+	void ApplyStages(WrappedID3D11DeviceContext *context, uint32_t stageMask);
+
+	// copies one stage from other, taking refs on its objects. This stage must be empty.
+	void CopyStage(const D3D11RenderState &other, int stage);
+
+	// which stage a pointer into this state belongs to, or eStage_Count
+	int GetStage(const void *member) const;
+
+	// must be called before modifying any member, so that an active tracker can save the stage
+	void Touch(const void *member) { if(m_Tracker) TouchStage(GetStage(member)); }
+
 	///////////////////////////////////////////////////////////////////////////////
 	// pipeline-auto NULL. When binding a resource for write, it will be
 	// unbound anywhere that it is bound for read.
@@ -261,6 +290,8 @@ struct D3D11RenderState
 	template<typename T>
 	void ChangeRefRead(T **stateArray, T *const*newArray, size_t offset, size_t num)
 	{
+		if(num > 0) Touch(stateArray+offset);
+
 		for(size_t i=0; i < num; i++)
 		{
 			T *old = stateArray[offset+i];
@@ -289,6 +320,8 @@ struct D3D11RenderState
 	template<typename T>
 	void ChangeRefWrite(T **stateArray, T *const*newArray, size_t offset, size_t num)
 	{
+		if(num > 0) Touch(stateArray+offset);
+
 		for(size_t i=0; i < num; i++)
 		{
 			T *old = stateArray[offset+i];
@@ -303,6 +336,7 @@ struct D3D11RenderState
 	template<typename T>
 	void ChangeRefRead(T *&stateItem, T *newItem)
 	{
+		Touch(&stateItem);
 		ReleaseRef(stateItem);
 		stateItem = newItem;
 
@@ -329,6 +363,7 @@ struct D3D11RenderState
 	template<typename T>
 	void ChangeRefWrite(T *&stateItem, T *newItem)
 	{
+		Touch(&stateItem);
 		ReleaseRef(stateItem);
 		stateItem = newItem;
 		if(newItem) UnbindForRead(newItem);
@@ -338,6 +373,8 @@ struct D3D11RenderState
 	template<typename T>
 	void Change(T *stateArray, const T *newArray, size_t offset, size_t num)
 	{
+		if(num > 0) Touch(stateArray+offset);
+
 		for(size_t i=0; i < num; i++)
 			stateArray[i+offset] = newArray[i];
 	}
@@ -345,9 +382,27 @@ struct D3D11RenderState
 	template<typename T>
 	void Change(T &stateItem, const T &newItem)
 	{
+		Touch(&stateItem);
 		stateItem = newItem;
 	}
 
+	// whether the corresponding Change() would leave the state as it is
+	template<typename T>
+	bool IsSame(const T *stateArray, const T *newArray, size_t offset, size_t num) const
+	{
+		if(num == 0)
+			return true;
+		if(newArray == NULL)
+			return false;
+		return memcmp(stateArray+offset, newArray, sizeof(T)*num) == 0;
+	}
+
+	template<typename T>
+	bool IsSame(const T &stateItem, const T &newItem) const
+	{
+		return stateItem == newItem;
+	}
+
 	/////////////////////////////////////////////////////////////////////////
 	// Implement any checks that D3D does that will change the state in ways
 	// that might not be obvious/intended.
@@ -426,20 +481,37 @@ struct D3D11RenderState
 	void MarkReferenced(WrappedID3D11DeviceContext *ctx, bool initial) const;
 	void MarkDirty(D3D11ResourceManager *manager) const;
 private:
+	friend struct D3D11RenderStateTracker;
+
 	void AddRefs();
+	void TakeStageRefs(int stage);
 	void ReleaseRefs();
 
+	void TouchStage(int stage);
+
 	Serialiser *m_pSerialiser;
 	bool m_ImmediatePipeline;
 	WrappedID3D11Device *m_pDevice;
+
+	// the innermost tracker recording changes to this state, if any
+	D3D11RenderStateTracker *m_Tracker;
 };
 
+// saves each stage of a context's pipeline the first time it's modified, and restores only
+// those stages when it goes out of scope. Trackers can be nested.
 struct D3D11RenderStateTracker
 {
 	public:
 		D3D11RenderStateTracker(WrappedID3D11DeviceContext *ctx);
 		~D3D11RenderStateTracker();
+
+		void Save(int stage);
 	private:
+		// only the saved stages are filled out
 		D3D11RenderState m_RS;
+		uint32_t m_SavedStages;
+
+		D3D11RenderState *m_pState;
+		D3D11RenderStateTracker *m_pPrev;
 		WrappedID3D11DeviceContext *m_pContext;
 };
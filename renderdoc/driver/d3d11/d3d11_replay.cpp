@@ -347,6 +347,55 @@ APIProperties D3D11Replay::GetAPIProperties()
 	return ret;
 }
 
+uint64_t D3D11Replay::GetReplayDeviceHash()
+{
+	IDXGIDevice *dxgiDevice = NULL;
+	IDXGIAdapter *adapter = NULL;
+
+	HRESULT hr = m_pDevice->GetReal()->QueryInterface(__uuidof(IDXGIDevice), (void **)&dxgiDevice);
+
+	if(SUCCEEDED(hr))
+		hr = dxgiDevice->GetAdapter(&adapter);
+
+	SAFE_RELEASE(dxgiDevice);
+
+	if(FAILED(hr) || adapter == NULL)
+	{
+		RDCERR("Couldn't get DXGI adapter to identify replay device");
+		return 0;
+	}
+
+	DXGI_ADAPTER_DESC desc;
+	RDCEraseEl(desc);
+	adapter->GetDesc(&desc);
+
+	// the user mode driver version, so a driver update doesn't match earlier results
+	LARGE_INTEGER umdVersion;
+	umdVersion.QuadPart = 0;
+	adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &umdVersion);
+
+	SAFE_RELEASE(adapter);
+
+	uint32_t ids[] = { desc.VendorId, desc.DeviceId, desc.SubSysId, desc.Revision, (uint32_t)m_WARP };
+
+	// FNV-1a over the identifying parts. The LUID is left out as it changes between boots
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	const byte *bytes = (const byte *)ids;
+	for(size_t i=0; i < sizeof(ids); i++)
+		hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+
+	bytes = (const byte *)&umdVersion.QuadPart;
+	for(size_t i=0; i < sizeof(umdVersion.QuadPart); i++)
+		hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+
+	bytes = (const byte *)desc.Description;
+	for(size_t i=0; i < sizeof(desc.Description); i++)
+		hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+
+	return hash;
+}
+
 vector<ResourceId> D3D11Replay::GetBuffers()
 {
 	vector<ResourceId> ret;
@@ -1189,6 +1238,8 @@ D3D11PipelineState D3D11Replay::MakePipelineState()
 
 void D3D11Replay::ReadLogInitialisation()
 {
+	SCOPED_PROFILE("ReadLogInitialisation");
+
 	m_pDevice->ReadLogInitialisation();
 }
 
@@ -1199,7 +1250,11 @@ void D3D11Replay::SetContextFilter(ResourceId id, uint32_t firstDefEv, uint32_t
 
 void D3D11Replay::ReplayLog(uint32_t frameID, uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType)
 {
+	SCOPED_PROFILE("ReplayLog");
+
 	m_pDevice->ReplayLog(frameID, startEventID, endEventID, replayType);
+
+	m_pDevice->GetDebugManager()->InvalidateTexturePreviews();
 }
 
 
@@ -1278,19 +1333,39 @@ vector<byte> D3D11Replay::GetBufferData(ResourceId buff, uint32_t offset, uint32
 	return m_pDevice->GetDebugManager()->GetBufferData(buff, offset, len);
 }
 
+vector<byte> D3D11Replay::GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows)
+{
+	return FetchStridedBufferData(this, buff, offset, stride, rowSize, numRows);
+}
+
 byte *D3D11Replay::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip, bool resolve, bool forceRGBA8unorm, float blackPoint, float whitePoint, size_t &dataSize)
 {
 	return m_pDevice->GetDebugManager()->GetTextureData(tex, arrayIdx, mip, resolve, forceRGBA8unorm, blackPoint, whitePoint, dataSize);
 }
 
+byte *D3D11Replay::GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize)
+{
+	return FetchTextureRegion(this, tex, arrayIdx, mip, x, y, width, height, dataSize);
+}
+
 void D3D11Replay::ReplaceResource(ResourceId from, ResourceId to)
 {
 	m_pDevice->GetResourceManager()->ReplaceResource(from, to);
+	m_pDevice->InvalidateReplayCheckpoints(from);
+	m_pDevice->GetDebugManager()->InvalidateShaderGlobalState();
+	m_pDevice->GetDebugManager()->InvalidateQuadOverdraw();
+	m_pDevice->GetDebugManager()->ClearOverlayCache();
+	m_pDevice->GetImmediateContext()->ClearDecodedChunks();
 }
 
 void D3D11Replay::RemoveReplacement(ResourceId id)
 {
 	m_pDevice->GetResourceManager()->RemoveReplacement(id);
+	m_pDevice->InvalidateReplayCheckpoints(id);
+	m_pDevice->GetDebugManager()->InvalidateShaderGlobalState();
+	m_pDevice->GetDebugManager()->InvalidateQuadOverdraw();
+	m_pDevice->GetDebugManager()->ClearOverlayCache();
+	m_pDevice->GetImmediateContext()->ClearDecodedChunks();
 }
 
 vector<uint32_t> D3D11Replay::EnumerateCounters()
@@ -1303,8 +1378,11 @@ void D3D11Replay::DescribeCounter(uint32_t counterID, CounterDescription &desc)
 	m_pDevice->GetDebugManager()->DescribeCounter(counterID, desc);
 }
 
-vector<CounterResult> D3D11Replay::FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters)
+vector<CounterResult> D3D11Replay::FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters, uint32_t numRuns)
 {
+	if(numRuns > 1)
+		return FetchCounterRuns(this, frameID, minEventID, maxEventID, counters, numRuns);
+
 	return m_pDevice->GetDebugManager()->FetchCounters(frameID, minEventID, maxEventID, counters);
 }
 
@@ -1545,6 +1623,76 @@ ResourceId D3D11Replay::CreateProxyTexture(FetchTexture templateTex)
 	return ret;
 }
 
+void D3D11Replay::SetProxyTextureRegion(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, byte *data, size_t dataSize)
+{
+	if(texid == ResourceId()) return;
+
+	ID3D11DeviceContext *ctx = m_pDevice->GetImmediateContext()->GetReal();
+
+	D3D11_BOX box = { x, y, 0, x+width, y+height, 1 };
+
+	if(WrappedID3D11Texture1D::m_TextureList.find(texid) != WrappedID3D11Texture1D::m_TextureList.end())
+	{
+		WrappedID3D11Texture1D *tex = (WrappedID3D11Texture1D *)WrappedID3D11Texture1D::m_TextureList[texid].m_Texture;
+
+		D3D11_TEXTURE1D_DESC desc;
+		tex->GetDesc(&desc);
+		
+		uint32_t mips = desc.MipLevels ? desc.MipLevels : CalcNumMips(desc.Width, 1, 1);
+		
+		if(mip >= mips || arrayIdx >= desc.ArraySize)
+		{
+			RDCERR("arrayIdx %d and mip %d invalid for tex", arrayIdx, mip);
+			return;
+		}
+
+		uint32_t pitch = GetByteSize(width, 1, 1, desc.Format, 0);
+
+		if(dataSize < pitch)
+		{
+			RDCERR("Insufficient data provided to SetProxyTextureRegion");
+			return;
+		}
+
+		box.top = 0;
+		box.bottom = 1;
+
+		ctx->UpdateSubresource(tex->GetReal(), arrayIdx*mips + mip, &box, data, pitch, pitch);
+	}
+	else if(WrappedID3D11Texture2D::m_TextureList.find(texid) != WrappedID3D11Texture2D::m_TextureList.end())
+	{
+		WrappedID3D11Texture2D *tex = (WrappedID3D11Texture2D *)WrappedID3D11Texture2D::m_TextureList[texid].m_Texture;
+
+		D3D11_TEXTURE2D_DESC desc;
+		tex->GetDesc(&desc);
+		
+		uint32_t mips = desc.MipLevels ? desc.MipLevels : CalcNumMips(desc.Width, desc.Height, 1);
+		
+		if(mip >= mips || arrayIdx >= desc.ArraySize || IsBlockFormat(desc.Format))
+		{
+			RDCERR("arrayIdx %d and mip %d invalid for tex", arrayIdx, mip);
+			return;
+		}
+
+		uint32_t pitch = GetByteSize(width, 1, 1, desc.Format, 0);
+
+		if(dataSize < size_t(pitch)*height)
+		{
+			RDCERR("Insufficient data provided to SetProxyTextureRegion");
+			return;
+		}
+
+		ctx->UpdateSubresource(tex->GetReal(), arrayIdx*mips + mip, &box, data, pitch, pitch*height);
+	}
+	else
+	{
+		RDCERR("Invalid texture id passed to SetProxyTextureRegion");
+	}
+
+	// any downsampled preview was made before this part was filled in
+	m_pDevice->GetDebugManager()->InvalidateTexturePreviews();
+}
+
 void D3D11Replay::SetProxyTextureData(ResourceId texid, uint32_t arrayIdx, uint32_t mip, byte *data, size_t dataSize)
 {
 	if(texid == ResourceId()) return;
@@ -1745,6 +1893,38 @@ ReplayCreateStatus D3D11_CreateReplayDevice(const char *logfile, IReplayDriver *
 		return eReplayCreate_APIInitFailed;
 	}
 
+	// NULL uses the default adapter
+	IDXGIAdapter *adapter = NULL;
+
+	uint32_t adapterIndex = RenderDoc::Inst().GetReplayAdapter();
+	if(adapterIndex != ~0U)
+	{
+		typedef HRESULT (WINAPI *PFN_CREATE_DXGI_FACTORY1)(REFIID, void **);
+		PFN_CREATE_DXGI_FACTORY1 createFactory = (PFN_CREATE_DXGI_FACTORY1)GetProcAddress(lib, "CreateDXGIFactory1");
+
+		IDXGIFactory1 *factory = NULL;
+		if(createFactory && SUCCEEDED(createFactory(__uuidof(IDXGIFactory1), (void **)&factory)))
+		{
+			if(FAILED(factory->EnumAdapters(adapterIndex, &adapter)))
+			{
+				RDCWARN("No adapter %u to replay on, using the default adapter", adapterIndex);
+				adapter = NULL;
+			}
+			else
+			{
+				DXGI_ADAPTER_DESC desc;
+				adapter->GetDesc(&desc);
+				RDCLOG("Replaying on adapter %u: %ls", adapterIndex, desc.Description);
+			}
+
+			SAFE_RELEASE(factory);
+		}
+		else
+		{
+			RDCWARN("Couldn't create DXGI factory to find adapter %u, using the default adapter", adapterIndex);
+		}
+	}
+
 	if(GetD3DCompiler() == NULL)
 	{
 		RDCERR("Failed to load d3dcompiler_??.dll");
@@ -1811,7 +1991,7 @@ ReplayCreateStatus D3D11_CreateReplayDevice(const char *logfile, IReplayDriver *
 	D3D_FEATURE_LEVEL maxFeatureLevel = D3D_FEATURE_LEVEL_9_1;
 	
 	// check for feature level 11 support - passing NULL feature level array implicitly checks for 11_0 before others
-	hr = createDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, 0, NULL, 0, D3D11_SDK_VERSION, NULL, NULL, NULL, &maxFeatureLevel, NULL);
+	hr = createDevice(adapter, adapter ? D3D_DRIVER_TYPE_UNKNOWN : D3D_DRIVER_TYPE_HARDWARE, NULL, 0, NULL, 0, D3D11_SDK_VERSION, NULL, NULL, NULL, &maxFeatureLevel, NULL);
 
 	bool warpFallback = false;
 
@@ -1820,6 +2000,7 @@ ReplayCreateStatus D3D11_CreateReplayDevice(const char *logfile, IReplayDriver *
 		RDCWARN("Couldn't create FEATURE_LEVEL_11_0 device - RenderDoc requires FEATURE_LEVEL_11_0 availability - falling back to WARP rasterizer");
 		driverTypes[0] = driverType = D3D_DRIVER_TYPE_WARP;
 		warpFallback = true;
+		SAFE_RELEASE(adapter);
 	}
 
 	D3D11DebugManager::PreDeviceInitCounters();
@@ -1827,13 +2008,16 @@ ReplayCreateStatus D3D11_CreateReplayDevice(const char *logfile, IReplayDriver *
 	hr = E_FAIL;
 	while(1)
 	{
+		// an explicit adapter requires the unknown driver type
 		hr = createDevice(
-			/*pAdapter=*/NULL, driverType, /*Software=*/NULL, flags,
+			/*pAdapter=*/adapter, adapter ? D3D_DRIVER_TYPE_UNKNOWN : driverType, /*Software=*/NULL, flags,
 			/*pFeatureLevels=*/featureLevelArray, /*nFeatureLevels=*/numFeatureLevels, D3D11_SDK_VERSION,
 			/*pSwapChainDesc=*/NULL, (IDXGISwapChain **)NULL, (ID3D11Device **)&device, (D3D_FEATURE_LEVEL*)NULL, (ID3D11DeviceContext **)NULL);
 
 		if(SUCCEEDED(hr))
 		{
+			SAFE_RELEASE(adapter);
+
 			WrappedID3D11Device *wrappedDev = (WrappedID3D11Device *)device;
 			if(logfile)	wrappedDev->SetLogFile(logfile);
 			wrappedDev->SetLogVersion(initParams.SerialiseVersion);
@@ -1862,6 +2046,10 @@ ReplayCreateStatus D3D11_CreateReplayDevice(const char *logfile, IReplayDriver *
 
 		i++;
 
+		// only fall back to other driver types on the default adapter
+		if(i >= 0)
+			SAFE_RELEASE(adapter);
+
 		if(i >= numDrivers*2)
 			break;
 
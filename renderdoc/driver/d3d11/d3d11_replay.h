@@ -38,6 +38,7 @@ class D3D11Replay : public IReplayDriver
 
 		void SetProxy(bool p, bool warp) { m_Proxy = p; m_WARP = warp; }
 		bool IsRemoteProxy() { return m_Proxy; }
+		uint64_t GetReplayDeviceHash();
 
 		void Shutdown();
 
@@ -90,7 +91,9 @@ class D3D11Replay : public IReplayDriver
 		MeshFormat GetPostVSBuffers(uint32_t frameID, uint32_t eventID, uint32_t instID, MeshDataStage stage);
 		
 		vector<byte> GetBufferData(ResourceId buff, uint32_t offset, uint32_t len);
+		vector<byte> GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows);
 		byte *GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip, bool resolve, bool forceRGBA8unorm, float blackPoint, float whitePoint, size_t &dataSize);
+		byte *GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize);
 		
 		void BuildTargetShader(string source, string entry, const uint32_t compileFlags, ShaderStageType type, ResourceId *id, string *errors);
 		void ReplaceResource(ResourceId from, ResourceId to);
@@ -98,10 +101,11 @@ class D3D11Replay : public IReplayDriver
 		
 		vector<uint32_t> EnumerateCounters();
 		void DescribeCounter(uint32_t counterID, CounterDescription &desc);
-		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters);
+		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters, uint32_t numRuns);
 
 		ResourceId CreateProxyTexture(FetchTexture templateTex);
 		void SetProxyTextureData(ResourceId texid, uint32_t arrayIdx, uint32_t mip, byte *data, size_t dataSize);
+		void SetProxyTextureRegion(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, byte *data, size_t dataSize);
 		
 		ResourceId CreateProxyBuffer(FetchBuffer templateBuf);
 		void SetProxyBufferData(ResourceId bufid, byte *data, size_t dataSize);
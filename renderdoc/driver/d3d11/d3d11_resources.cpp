@@ -56,13 +56,58 @@ WRAPPED_POOL_INST(WrappedID3D11RasterizerState1);
 WRAPPED_POOL_INST(WrappedID3D11BlendState1);
 #endif
 
-volatile LONGLONG TrackedResource::globalIDCounter = 1;
+Threading::BlockIDAllocator TrackedResource::globalIDs(1);
 
 map<ResourceId,WrappedID3D11Texture1D::TextureEntry> WrappedTexture<ID3D11Texture1D, D3D11_TEXTURE1D_DESC>::m_TextureList;
 map<ResourceId,WrappedID3D11Texture2D::TextureEntry> WrappedTexture<ID3D11Texture2D, D3D11_TEXTURE2D_DESC>::m_TextureList;
 map<ResourceId,WrappedID3D11Texture3D::TextureEntry> WrappedTexture<ID3D11Texture3D, D3D11_TEXTURE3D_DESC>::m_TextureList;
 map<ResourceId,WrappedID3D11Buffer::BufferEntry> WrappedID3D11Buffer::m_BufferList;
 map<ResourceId,WrappedShader::ShaderEntry*> WrappedShader::m_ShaderList;
+map<ShaderBytecodeKey,WrappedShader::ShaderEntry*> WrappedShader::m_SharedEntries;
+Threading::CriticalSection WrappedShader::m_ShaderListLock;
+
+WrappedShader::WrappedShader(ResourceId id, const void *bytecode, size_t length)
+	: m_ID(id), m_Entry(NULL)
+{
+	ShaderBytecodeKey key = GetShaderBytecodeKey(bytecode, length);
+
+	SCOPED_LOCK(m_ShaderListLock);
+
+	auto it = m_SharedEntries.find(key);
+	if(it != m_SharedEntries.end() && it->second->Matches(bytecode, length))
+	{
+		m_Entry = it->second;
+		m_Entry->m_RefCount++;
+	}
+	else
+	{
+		m_Entry = new ShaderEntry(bytecode, length);
+
+		// on the off chance of a key collision, this entry just isn't shared
+		if(it == m_SharedEntries.end())
+			m_SharedEntries[key] = m_Entry;
+	}
+
+	RDCASSERT(m_ShaderList.find(m_ID) == m_ShaderList.end());
+	m_ShaderList[m_ID] = m_Entry;
+}
+
+WrappedShader::~WrappedShader()
+{
+	SCOPED_LOCK(m_ShaderListLock);
+
+	m_ShaderList.erase(m_ID);
+
+	if(--m_Entry->m_RefCount == 0)
+	{
+		const vector<byte> &blob = m_Entry->GetDXBC()->m_ShaderBlob;
+		auto it = m_SharedEntries.find(GetShaderBytecodeKey(&blob[0], blob.size()));
+		if(it != m_SharedEntries.end() && it->second == m_Entry)
+			m_SharedEntries.erase(it);
+
+		delete m_Entry;
+	}
+}
 
 UINT GetMipForSubresource(ID3D11Resource *res, int Subresource)
 {
@@ -100,23 +100,22 @@ class TrackedResource
 
 		ResourceId GetResourceID() { return m_ID; }
 
+		// for things that are tracked like a resource but have no object
+		static ResourceId GetNewUniqueID()
+		{
+			return ResourceId(globalIDs.Next(), true); // bool to make explicit
+		}
+
 		static void SetReplayResourceIDs()
 		{
-			globalIDCounter = RDCMAX(uint64_t(globalIDCounter), uint64_t(globalIDCounter|0x1000000000000000ULL));
+			globalIDs.AdvancePast(globalIDs.GetLastID()|0x1000000000000000ULL);
 		}
 		
 	private:
 		TrackedResource(const TrackedResource &);
 		TrackedResource &operator =(const TrackedResource &);
-
-		ResourceId GetNewUniqueID()
-		{
-			uint64_t newID = (uint64_t)InterlockedIncrement64(&globalIDCounter);
-
-			return ResourceId(newID, true); // bool to make explicit
-		}
 		
-		static volatile LONGLONG globalIDCounter;
+		static Threading::BlockIDAllocator globalIDs;
 		ResourceId m_ID;
 };
 
@@ -1076,15 +1075,12 @@ public:
 class WrappedShader
 {
 public:
+	// shaders created from identical bytecode share an entry
 	class ShaderEntry
 	{
 		public:
-			ShaderEntry() : m_DXBCFile(NULL), m_Details(NULL) {}
-			ShaderEntry(DXBC::DXBCFile *file)
-			{
-				m_DXBCFile = file;
-				m_Details = MakeShaderReflection(m_DXBCFile);
-			}
+			ShaderEntry(const void *bytecode, size_t length)
+				: m_DXBCFile(new DXBC::DXBCFile(bytecode, length)), m_Details(NULL), m_RefCount(1) {}
 			~ShaderEntry()
 			{
 				SAFE_DELETE(m_DXBCFile);
@@ -1092,36 +1088,43 @@ public:
 			}
 
 			DXBC::DXBCFile *GetDXBC() { return m_DXBCFile; }
-			ShaderReflection *GetDetails() { return m_Details; }
+			ShaderReflection *GetDetails()
+			{
+				// built on first request, since it includes the full disassembly
+				if(m_Details == NULL)
+					m_Details = MakeShaderReflection(m_DXBCFile);
+				return m_Details;
+			}
+
+			bool Matches(const void *bytecode, size_t length)
+			{
+				const vector<byte> &blob = m_DXBCFile->m_ShaderBlob;
+				return blob.size() == length && !memcmp(&blob[0], bytecode, length);
+			}
 		private:
 			ShaderEntry(const ShaderEntry &e);
 			ShaderEntry &operator =(const ShaderEntry &e);
 
+			friend class WrappedShader;
+
 			DXBC::DXBCFile *m_DXBCFile;
 			ShaderReflection *m_Details;
+			int m_RefCount;
 	};
 
 	static map<ResourceId, ShaderEntry*> m_ShaderList;
 
-	WrappedShader(ResourceId id, DXBC::DXBCFile *file) : m_ID(id)
-	{
-		RDCASSERT(m_ShaderList.find(m_ID) == m_ShaderList.end());
-		m_ShaderList[m_ID] = new ShaderEntry(file);
-	}
-	virtual ~WrappedShader()
-	{
-		auto it = m_ShaderList.find(m_ID);
-		if(it != m_ShaderList.end())
-		{
-			delete it->second;
-			m_ShaderList.erase(it);
-		}
-	}
+	WrappedShader(ResourceId id, const void *bytecode, size_t length);
+	virtual ~WrappedShader();
 
-	DXBC::DXBCFile *GetDXBC() { return m_ShaderList[m_ID]->GetDXBC(); }
-	ShaderReflection *GetDetails() { return m_ShaderList[m_ID]->GetDetails(); }
+	DXBC::DXBCFile *GetDXBC() { return m_Entry->GetDXBC(); }
+	ShaderReflection *GetDetails() { return m_Entry->GetDetails(); }
 private:
 	ResourceId m_ID;
+	ShaderEntry *m_Entry;
+
+	static map<ShaderBytecodeKey, ShaderEntry*> m_SharedEntries;
+	static Threading::CriticalSection m_ShaderListLock;
 };
 
 template<class RealShaderType>
@@ -1132,8 +1135,8 @@ public:
 	static const int AllocPoolMaxByteSize = 3*1024*1024;
 	ALLOCATE_WITH_WRAPPED_POOL(WrappedID3D11Shader<RealShaderType>, AllocPoolCount, AllocPoolMaxByteSize);
 
-	WrappedID3D11Shader(RealShaderType* real, DXBC::DXBCFile *file, WrappedID3D11Device* device)
-		: WrappedDeviceChild<RealShaderType>(real, device), WrappedShader(GetResourceID(), file) {}
+	WrappedID3D11Shader(RealShaderType* real, const void *bytecode, size_t length, WrappedID3D11Device* device)
+		: WrappedDeviceChild<RealShaderType>(real, device), WrappedShader(GetResourceID(), bytecode, length) {}
 	virtual ~WrappedID3D11Shader() { Shutdown(); }
 };
 
@@ -1368,12 +1371,13 @@ class WrappedID3D11CommandList : public WrappedDeviceChild<ID3D11CommandList>
 {
 	WrappedID3D11DeviceContext* m_pContext;
 	bool m_Successful; // indicates whether we have all of the commands serialised for this command list
+	D3D11ResourceRecord *m_pRecord;
 public:
 	ALLOCATE_WITH_WRAPPED_POOL(WrappedID3D11CommandList);
 
 	WrappedID3D11CommandList(ID3D11CommandList* real, WrappedID3D11Device* device,
 							 WrappedID3D11DeviceContext* context, bool success)
-		: WrappedDeviceChild(real, device), m_pContext(context), m_Successful(success)
+		: WrappedDeviceChild(real, device), m_pContext(context), m_Successful(success), m_pRecord(NULL)
 	{
 		// context isn't defined type at this point.
 	}
@@ -1385,6 +1389,12 @@ public:
 
 	WrappedID3D11DeviceContext *GetContext() { return m_pContext; }
 	bool IsCaptured() { return m_Successful; }
+	void MarkUncaptured() { m_Successful = false; }
+
+	// the record holding this command list's chunks while capturing. It's kept here so that
+	// executing the list doesn't need to look it up under the resource manager's lock.
+	D3D11ResourceRecord *GetRecord() { return m_pRecord; }
+	void SetRecord(D3D11ResourceRecord *record) { m_pRecord = record; }
 	
 	//////////////////////////////
 	// implement ID3D11CommandList
@@ -51,7 +51,7 @@ static float round_ne(float x)
 	return x < 0 ? x + 0.5f : x;
 }
 	
-VarType State::OperationType(const OpcodeType &op) const
+VarType State::OperationType(const OpcodeType &op)
 {
 	switch(op)
 	{
@@ -511,17 +511,30 @@ ShaderVariable sub(const ShaderVariable &a, const ShaderVariable &b, const VarTy
 	return add(a, neg(b, type), type);
 }
 
+void GlobalState::Decode(DXBCFile *dxbc)
+{
+	const vector<ASMOperation> &instructions = dxbc->GetInstructions();
+
+	decoded.resize(instructions.size());
+
+	for(size_t i=0; i < instructions.size(); i++)
+	{
+		decoded[i].optype = State::OperationType(instructions[i].operation);
+		decoded[i].numOperands = dxbc->NumOperands(instructions[i].operation);
+	}
+}
+
 void State::Init()
 {
 	vector<uint32_t> indexTempSizes;
 
-	for(size_t i=0; i < dxbc->m_Declarations.size(); i++)
+	for(size_t i=0; i < dxbc->GetDeclarations().size(); i++)
 	{
-		if(dxbc->m_Declarations[i].declaration == OPCODE_DCL_TEMPS)
+		if(dxbc->GetDeclarations()[i].declaration == OPCODE_DCL_TEMPS)
 		{
-			create_array_uninit(registers, dxbc->m_Declarations[i].numTemps);
+			create_array_uninit(registers, dxbc->GetDeclarations()[i].numTemps);
 
-			for(uint32_t t=0; t < dxbc->m_Declarations[i].numTemps; t++)
+			for(uint32_t t=0; t < dxbc->GetDeclarations()[i].numTemps; t++)
 			{
 				char buf[64] = {0};
 
@@ -530,10 +543,10 @@ void State::Init()
 				registers[t] = ShaderVariable(buf, 0l, 0l, 0l, 0l);
 			}
 		}
-		if(dxbc->m_Declarations[i].declaration == OPCODE_DCL_INDEXABLE_TEMP)
+		if(dxbc->GetDeclarations()[i].declaration == OPCODE_DCL_INDEXABLE_TEMP)
 		{
-			uint32_t reg = dxbc->m_Declarations[i].tempReg;
-			uint32_t size = dxbc->m_Declarations[i].numTemps;
+			uint32_t reg = dxbc->GetDeclarations()[i].tempReg;
+			uint32_t size = dxbc->GetDeclarations()[i].numTemps;
 			if(reg >= indexTempSizes.size())
 				indexTempSizes.resize(reg+1);
 
@@ -565,7 +578,18 @@ void State::Init()
 
 bool State::Finished() const
 {
-	return dxbc && (done || nextInstruction >= (int)dxbc->m_Instructions.size());
+	return dxbc && (done || nextInstruction >= (int)dxbc->GetInstructions().size());
+}
+
+bool State::IsGroupSync(const ASMOperation &op)
+{
+	// the thread group flag of sync (Sync_Threads in the disassembler), after its shift
+	return op.operation == OPCODE_SYNC && (op.syncFlags & 0x1);
+}
+
+bool State::AtGroupSync() const
+{
+	return !Finished() && IsGroupSync(dxbc->GetInstructions()[nextInstruction]);
 }
 
 void State::SetDst(const ASMOperand &dstoper, const ASMOperation &op, const ShaderVariable &val)
@@ -749,6 +773,10 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 {
 	ShaderVariable v, s;
 
+	// for operands that read straight from a register this points at it, so it's only
+	// copied once below instead of into both v and s
+	const ShaderVariable *src = NULL;
+
 	uint32_t indices[4] = {0};
 
 	RDCASSERT(oper.indices.size() <= 4);
@@ -776,7 +804,7 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 			RDCASSERT(indices[0] < (uint32_t)registers.count);
 
 			if(indices[0] < (uint32_t)registers.count)
-				v = s = registers[indices[0]];
+				src = &registers[indices[0]];
 			else
 				v = s = ShaderVariable("", indices[0], indices[0], indices[0], indices[0]);
 
@@ -794,7 +822,7 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 					RDCASSERT(indices[1] < (uint32_t)indexableTemps[ indices[0] ].count);
 					if(indices[1] < (uint32_t)indexableTemps[ indices[0] ].count)
 					{
-						v = s = indexableTemps[ indices[0] ][ indices[1] ];
+						src = &indexableTemps[ indices[0] ][ indices[1] ];
 					}
 				}
 			}
@@ -805,7 +833,7 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 			RDCASSERT(indices[0] < (uint32_t)trace->inputs.count);
 			
 			if(indices[0] < (uint32_t)trace->inputs.count)
-				v = s = trace->inputs[indices[0]];
+				src = &trace->inputs[indices[0]];
 			else
 				v = s = ShaderVariable("", indices[0], indices[0], indices[0], indices[0]);
 
@@ -816,7 +844,7 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 			RDCASSERT(indices[0] < (uint32_t)outputs.count);
 
 			if(indices[0] < (uint32_t)outputs.count)
-				v = s = outputs[indices[0]];
+				src = &outputs[indices[0]];
 			else
 				v = s = ShaderVariable("", indices[0], indices[0], indices[0], indices[0]);
 
@@ -872,7 +900,7 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 			RDCASSERT(indices[0] < (uint32_t)trace->cbuffers.count && indices[1] < (uint32_t)trace->cbuffers[indices[0]].count);
 
 			if(indices[0] < (uint32_t)trace->cbuffers.count && indices[1] < (uint32_t)trace->cbuffers[indices[0]].count)
-				v = s = trace->cbuffers[indices[0]][indices[1]];
+				src = &trace->cbuffers[indices[0]][indices[1]];
 			else
 				v = s = ShaderVariable("", indices[0], indices[0], indices[0], indices[0]);
 
@@ -880,12 +908,12 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 		}
 		case TYPE_IMMEDIATE_CONSTANT_BUFFER:
 		{
-			RDCASSERT(indices[0]*4 + 4 < dxbc->m_Immediate.size());
+			RDCASSERT(indices[0]*4 + 4 < dxbc->GetImmediate().size());
 
 			v = s = ShaderVariable("", 0, 0, 0, 0);
 
-			if(indices[0]*4 + 4 < dxbc->m_Immediate.size())
-				memcpy(s.value.uv, &dxbc->m_Immediate[indices[0]*4], 16);
+			if(indices[0]*4 + 4 < dxbc->GetImmediate().size())
+				memcpy(s.value.uv, &dxbc->GetImmediate()[indices[0]*4], 16);
 
 			break;
 		}
@@ -899,9 +927,9 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 		{
 			uint32_t numthreads[3] = {0, 0, 0};
 
-			for(size_t i=0; i < dxbc->m_Declarations.size(); i++)
+			for(size_t i=0; i < dxbc->GetDeclarations().size(); i++)
 			{
-				ASMDecl &decl = dxbc->m_Declarations[i];
+				ASMDecl &decl = dxbc->GetDeclarations()[i];
 
 				if(decl.declaration == OPCODE_DCL_THREAD_GROUP)
 				{
@@ -932,9 +960,9 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 		{
 			uint32_t numthreads[3] = {0, 0, 0};
 
-			for(size_t i=0; i < dxbc->m_Declarations.size(); i++)
+			for(size_t i=0; i < dxbc->GetDeclarations().size(); i++)
 			{
-				ASMDecl &decl = dxbc->m_Declarations[i];
+				ASMDecl &decl = dxbc->GetDeclarations()[i];
 
 				if(decl.declaration == OPCODE_DCL_THREAD_GROUP)
 				{
@@ -976,11 +1004,16 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 		}
 	}
 
+	if(src)
+		v = *src;
+	else
+		src = &s;
+
 	// perform swizzling
-	v.value.uv[0] = s.value.uv[ oper.comps[0] == 0xff ? 0 : oper.comps[0] ];
-	v.value.uv[1] = s.value.uv[ oper.comps[1] == 0xff ? 1 : oper.comps[1] ];
-	v.value.uv[2] = s.value.uv[ oper.comps[2] == 0xff ? 2 : oper.comps[2] ];
-	v.value.uv[3] = s.value.uv[ oper.comps[3] == 0xff ? 3 : oper.comps[3] ];
+	v.value.uv[0] = src->value.uv[ oper.comps[0] == 0xff ? 0 : oper.comps[0] ];
+	v.value.uv[1] = src->value.uv[ oper.comps[1] == 0xff ? 1 : oper.comps[1] ];
+	v.value.uv[2] = src->value.uv[ oper.comps[2] == 0xff ? 2 : oper.comps[2] ];
+	v.value.uv[3] = src->value.uv[ oper.comps[3] == 0xff ? 3 : oper.comps[3] ];
 
 	if(oper.comps[0] != 0xff && oper.comps[1] == 0xff && oper.comps[2] == 0xff && oper.comps[3] == 0xff)
 		v.columns = 1;
@@ -1002,23 +1035,41 @@ ShaderVariable State::GetSrc(const ASMOperand &oper, const ASMOperation &op) con
 
 State State::GetNext(GlobalState &global, State quad[4]) const
 {
-	State s = *this;
+	State s;
+	StepInto(global, quad, s);
+	return s;
+}
 
-	if(s.nextInstruction >= s.dxbc->m_Instructions.size())
-		return s;
+void State::StepInto(GlobalState &global, State quad[4], State &s) const
+{
+	s = *this;
 
-	ASMOperation &op = s.dxbc->m_Instructions[s.nextInstruction];
+	if(s.nextInstruction >= s.dxbc->GetInstructions().size())
+		return;
 
-	s.nextInstruction++;
+	ASMOperation &op = s.dxbc->GetInstructions()[s.nextInstruction];
 
-	vector<ShaderVariable> srcOpers;
+	size_t numOperands = 0;
+	VarType optype = eVar_Float;
 
-	size_t numOperands = s.dxbc->NumOperands(op.operation);
+	if(s.nextInstruction < global.decoded.size())
+	{
+		numOperands = global.decoded[s.nextInstruction].numOperands;
+		optype = global.decoded[s.nextInstruction].optype;
+	}
+	else
+	{
+		numOperands = s.dxbc->NumOperands(op.operation);
+		optype = OperationType(op.operation);
+	}
 
-	VarType optype = OperationType(op.operation);
+	s.nextInstruction++;
 
 	RDCASSERT(op.operands.size() == numOperands);
 
+	vector<ShaderVariable> srcOpers;
+	srcOpers.reserve(numOperands);
+
 	for(size_t i=1; i < numOperands; i++)
 		srcOpers.push_back(GetSrc(op.operands[i], op));
 
@@ -1957,9 +2008,9 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				numElems = global.uavs[resIndex].numElements;
 				data = &global.uavs[resIndex].data[0];
 
-				for(size_t i=0; i < s.dxbc->m_Declarations.size(); i++)
+				for(size_t i=0; i < s.dxbc->GetDeclarations().size(); i++)
 				{
-					ASMDecl &decl = s.dxbc->m_Declarations[i];
+					ASMDecl &decl = s.dxbc->GetDeclarations()[i];
 
 					if(decl.operand.type == TYPE_UNORDERED_ACCESS_VIEW &&
 						 decl.operand.indices[0].index == resIndex)
@@ -2118,9 +2169,9 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 					}
 					else if(!gsm)
 					{
-						for(size_t i=0; i < s.dxbc->m_Declarations.size(); i++)
+						for(size_t i=0; i < s.dxbc->GetDeclarations().size(); i++)
 						{
-							ASMDecl &decl = s.dxbc->m_Declarations[i];
+							ASMDecl &decl = s.dxbc->GetDeclarations()[i];
 
 							if(decl.operand.type == TYPE_UNORDERED_ACCESS_VIEW && !srv &&
 								decl.operand.indices[0].index == resIndex &&
@@ -3039,9 +3090,9 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				// search for the declaration
 				if(dim == 0)
 				{
-					for(size_t i=0; i < s.dxbc->m_Declarations.size(); i++)
+					for(size_t i=0; i < s.dxbc->GetDeclarations().size(); i++)
 					{
-						ASMDecl &decl = s.dxbc->m_Declarations[i];
+						ASMDecl &decl = s.dxbc->GetDeclarations()[i];
 
 						if(decl.declaration == OPCODE_DCL_RESOURCE && decl.operand.type == TYPE_RESOURCE &&
 							decl.operand.indices.size() == 1 && decl.operand.indices[0] == op.operands[2].indices[0])
@@ -3172,9 +3223,9 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 
 			DXBC::ResourceDimension resourceDim = DXBC::RESOURCE_DIMENSION_UNKNOWN;
 			
-			for(size_t i=0; i < s.dxbc->m_Declarations.size(); i++)
+			for(size_t i=0; i < s.dxbc->GetDeclarations().size(); i++)
 			{
-				ASMDecl &decl = s.dxbc->m_Declarations[i];
+				ASMDecl &decl = s.dxbc->GetDeclarations()[i];
 
 				if(decl.declaration == OPCODE_DCL_SAMPLER && decl.operand.indices == op.operands[3].indices)
 				{
@@ -3364,7 +3415,7 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 
 					s.SetDst(op.operands[0], op, fetch);
 
-					return s;
+					return;
 				}
 				if(decl.declaration == OPCODE_DCL_RESOURCE &&
 					decl.operand.type == TYPE_RESOURCE &&
@@ -3515,8 +3566,6 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			string sampleProgram;
 
 			char buf[256] = {0};
-			char buf2[256] = {0};
-			char buf3[256] = {0};
 
 			ShaderVariable ddxCalc;
 			ShaderVariable ddyCalc;
@@ -3543,18 +3592,33 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				ddyCalc = srcOpers[4];
 			}
 
-			// serious printf abuse below!
-
-			char *formats[4][2] = {
-				{ "float(%f)", "int(%d)" },
-				{ "float2(%f, %f)", "int2(%d, %d)" },
-				{ "float3(%f, %f, %f)", "int3(%d, %d, %d)" },
-				{ "float4(%f, %f, %f, %f)", "int4(%d, %d, %d, %d)" },
-			};
+			// the generated shaders only depend on the instruction - everything that varies per
+			// lane or per iteration comes in through this constant buffer, so the shaders can be
+			// compiled once and reused for every sample this instruction does.
+			struct DebugSampleParams
+			{
+				uint32_t uv[4]; // float or int texcoords, the shader reinterprets as needed
+				float ddx[4];
+				float ddy[4];
+				float vertUV[3][4];
+				float scalar[4];
+				int32_t sampleIdx[4];
+			} params;
+
+			RDCEraseEl(params);
+
+			const char *cbufferDecl =
+				"cbuffer debugsample : register(b0)\n{\n"
+				"float4 texcoord;\n"
+				"float4 texcoordDDX;\nfloat4 texcoordDDY;\n"
+				"float4 vertUV[3];\n"
+				"float4 scalar;\n"
+				"int4 sampleIdx;\n"
+				"};\n\n";
+
+			const char *dimSwizzle[] = { ".x", ".xy", ".xyz", ".xyzw" };
 
 			int texcoordType = 0;
-			int ddxType = 0;
-			int ddyType = 0;
 
 			int texdimOffs = 0;
 			
@@ -3571,7 +3635,7 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				op.operation == OPCODE_LOD)
 			{
 				// all floats
-				texcoordType = ddxType = ddyType = 0;
+				texcoordType = 0;
 			}
 			else if(op.operation == OPCODE_LD)
 			{
@@ -3624,35 +3688,20 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				}
 			}
 
-			// because of unions in .value we can pass the float versions and printf will interpret it as the right type according to formats
-			if(texcoordType == 0)
-				StringFormat::snprintf(buf, 255, formats[texdim+texdimOffs-1][texcoordType], uv.value.f.x, uv.value.f.y, uv.value.f.z, uv.value.f.w);
-			else
-				StringFormat::snprintf(buf, 255, formats[texdim+texdimOffs-1][texcoordType], uv.value.i.x, uv.value.i.y, uv.value.i.z, uv.value.i.w);
-
-			if(ddxType == 0)
-				StringFormat::snprintf(buf2, 255, formats[offsdim+texdimOffs-1][ddxType], ddxCalc.value.f.x, ddxCalc.value.f.y, ddxCalc.value.f.z, ddxCalc.value.f.w);
-			else
-				StringFormat::snprintf(buf2, 255, formats[offsdim+texdimOffs-1][ddxType], ddxCalc.value.i.x, ddxCalc.value.i.y, ddxCalc.value.i.z, ddxCalc.value.i.w);
-
-			if(ddyType == 0)
-				StringFormat::snprintf(buf3, 255, formats[offsdim+texdimOffs-1][ddyType], ddyCalc.value.f.x, ddyCalc.value.f.y, ddyCalc.value.f.z, ddyCalc.value.f.w);
-			else
-				StringFormat::snprintf(buf3, 255, formats[offsdim+texdimOffs-1][ddyType], ddyCalc.value.i.x, ddyCalc.value.i.y, ddyCalc.value.i.z, ddyCalc.value.i.w);
+			memcpy(params.uv, uv.value.uv, sizeof(params.uv));
+			memcpy(params.ddx, ddxCalc.value.fv, sizeof(params.ddx));
+			memcpy(params.ddy, ddyCalc.value.fv, sizeof(params.ddy));
 
-			string texcoords = buf;
-			string ddx = buf2;
-			string ddy = buf3;
+			string texcoords = string(texcoordType == 0 ? "texcoord" : "asint(texcoord)") + dimSwizzle[texdim+texdimOffs-1];
+			string ddx = string("texcoordDDX") + dimSwizzle[offsdim+texdimOffs-1];
+			string ddy = string("texcoordDDY") + dimSwizzle[offsdim+texdimOffs-1];
 
 			if(op.operation == OPCODE_LD_MS)
-			{
-				StringFormat::snprintf(buf, 255, formats[0][1], srcOpers[2].value.i.x);
-			}
-			
-			string sampleIdx = buf;
+				params.sampleIdx[0] = srcOpers[2].value.i.x;
 
 			string offsets = "";
 
+			// offsets must be immediates in HLSL, but they're fixed for the instruction anyway
 			if(useOffsets)
 			{
 				if(offsdim == 1)
@@ -3710,12 +3759,16 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			
 			if(op.operands.size() >= 4 && !op.operands[3].indices.empty())
 				sampSlot = (UINT)op.operands[3].indices[0].index;
+
+			sampleProgram = cbufferDecl + texture + " : register(t0);\n";
+			if(!sampler.empty())
+				sampleProgram += sampler + " : register(s0);\n";
+			sampleProgram += "\n";
 			
 			if(op.operation == OPCODE_SAMPLE ||
 				op.operation == OPCODE_SAMPLE_B ||
 				op.operation == OPCODE_SAMPLE_D)
 			{
-				sampleProgram = texture + " : register(t0);\n" + sampler + " : register(s0);\n\n";
 				sampleProgram += funcRet + " main() : SV_Target0\n{\nreturn ";
 				sampleProgram += "t.SampleGrad(s, " + texcoords + ", " + ddx + ", " + ddy + offsets + ")" + swizzle + ";";
 				sampleProgram += "\n}\n";
@@ -3723,11 +3776,10 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			else if(op.operation == OPCODE_SAMPLE_L)
 			{
 				// lod selection
-				StringFormat::snprintf(buf, 255, "%f", srcOpers[1].value.f.x);
+				params.scalar[0] = srcOpers[1].value.f.x;
 
-				sampleProgram = texture + " : register(t0);\n" + sampler + " : register(s0);\n\n";
 				sampleProgram += funcRet + " main() : SV_Target0\n{\nreturn ";
-				sampleProgram += "t.SampleLevel(s, " + texcoords + ", " + buf + offsets + ")" + swizzle + ";";
+				sampleProgram += "t.SampleLevel(s, " + texcoords + ", scalar.x" + offsets + ")" + swizzle + ";";
 				sampleProgram += "\n}\n";
 			}
 			else if(op.operation == OPCODE_SAMPLE_C || op.operation == OPCODE_LOD)
@@ -3737,44 +3789,30 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				string uvDim = "1";
 				uvDim[0] += char(texdim+texdimOffs-1);
 
-				vsProgram = "void main(uint id : SV_VertexID, out float4 pos : SV_Position, out float" + uvDim + " uv : uvs) {\n";
-				
-				StringFormat::snprintf(buf, 255, formats[texdim+texdimOffs-1][texcoordType],
-									 uv.value.f.x + ddyCalc.value.f.x*2.0f,
-									 uv.value.f.y + ddyCalc.value.f.y*2.0f,
-									 uv.value.f.z + ddyCalc.value.f.z*2.0f,
-									 uv.value.f.w + ddyCalc.value.f.w*2.0f);
-
-				vsProgram += "if(id == 0) uv = " + string(buf) + ";\n";
-				
-				StringFormat::snprintf(buf, 255, formats[texdim+texdimOffs-1][texcoordType], uv.value.f.x, uv.value.f.y, uv.value.f.z, uv.value.f.w);
-				
-				vsProgram += "if(id == 1) uv = " + string(buf) + ";\n";
-				
-				StringFormat::snprintf(buf, 255, formats[texdim+texdimOffs-1][texcoordType],
-									 uv.value.f.x + ddxCalc.value.f.x*2.0f,
-									 uv.value.f.y + ddxCalc.value.f.y*2.0f,
-									 uv.value.f.z + ddxCalc.value.f.z*2.0f,
-									 uv.value.f.w + ddxCalc.value.f.w*2.0f);
-
-				vsProgram += "if(id == 2) uv = " + string(buf) + ";\n";
+				for(int c=0; c < 4; c++)
+				{
+					params.vertUV[0][c] = uv.value.fv[c] + ddyCalc.value.fv[c]*2.0f;
+					params.vertUV[1][c] = uv.value.fv[c];
+					params.vertUV[2][c] = uv.value.fv[c] + ddxCalc.value.fv[c]*2.0f;
+				}
 
+				vsProgram = cbufferDecl;
+				vsProgram += "void main(uint id : SV_VertexID, out float4 pos : SV_Position, out float" + uvDim + " uv : uvs) {\n";
+				vsProgram += "uv = vertUV[id]" + string(dimSwizzle[texdim+texdimOffs-1]) + ";\n";
 				vsProgram += "pos = float4((id == 2) ? 3.0f : -1.0f, (id == 0) ? -3.0f : 1.0f, 0.5, 1.0);\n";
 				vsProgram += "}";
 			
 				if(op.operation == OPCODE_SAMPLE_C)
 				{
 					// comparison value
-					StringFormat::snprintf(buf, 255, "%f", srcOpers[3].value.f.x);
+					params.scalar[0] = srcOpers[3].value.f.x;
 
-					sampleProgram = texture + " : register(t0);\n" + sampler + " : register(s0);\n\n";
 					sampleProgram += funcRet + " main(float4 pos : SV_Position, float" + uvDim + " uv : uvs) : SV_Target0\n{\n";
-					sampleProgram += "return t.SampleCmpLevelZero(s, uv, " + string(buf) + offsets + ").xxxx;";
+					sampleProgram += "return t.SampleCmpLevelZero(s, uv, scalar.x" + offsets + ").xxxx;";
 					sampleProgram += "\n}\n";
 				}
 				else if(op.operation == OPCODE_LOD)
 				{
-					sampleProgram = texture + " : register(t0);\n" + sampler + " : register(s0);\n\n";
 					sampleProgram += funcRet + " main(float4 pos : SV_Position, float" + uvDim + " uv : uvs) : SV_Target0\n{\n";
 					sampleProgram += "return float4(t.CalculateLevelOfDetail(s, uv), t.CalculateLevelOfDetailUnclamped(s, uv), 0.0f, 0.0f);";
 					sampleProgram += "\n}\n";
@@ -3783,31 +3821,27 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			else if(op.operation == OPCODE_SAMPLE_C_LZ)
 			{
 				// comparison value
-				StringFormat::snprintf(buf, 255, "%f", srcOpers[3].value.f.x);
+				params.scalar[0] = srcOpers[3].value.f.x;
 
-				sampleProgram = texture + " : register(t0);\n" + sampler + " : register(s0);\n\n";
 				sampleProgram += funcRet + " main() : SV_Target0\n{\nreturn ";
-				sampleProgram += "t.SampleCmpLevelZero(s, " + texcoords + ", " + buf + offsets + ")" + swizzle + ";";
+				sampleProgram += "t.SampleCmpLevelZero(s, " + texcoords + ", scalar.x" + offsets + ")" + swizzle + ";";
 				sampleProgram += "\n}\n";
 			}
 			else if(op.operation == OPCODE_LD)
 			{
-				sampleProgram = texture + " : register(t0);\n\n";
 				sampleProgram += funcRet + " main() : SV_Target0\n{\nreturn ";
 				sampleProgram += "t.Load(" + texcoords + offsets + ")" + swizzle + ";";
 				sampleProgram += "\n}\n";
 			}
 			else if(op.operation == OPCODE_LD_MS)
 			{
-				sampleProgram = texture + " : register(t0);\n\n";
 				sampleProgram += funcRet + " main() : SV_Target0\n{\nreturn ";
-				sampleProgram += "t.Load(" + texcoords + ", " + sampleIdx + offsets + ")" + swizzle + ";";
+				sampleProgram += "t.Load(" + texcoords + ", sampleIdx.x" + offsets + ")" + swizzle + ";";
 				sampleProgram += "\n}\n";
 			}
 			else if (op.operation == OPCODE_GATHER4 ||
 				op.operation == OPCODE_GATHER4_PO)
 			{
-				sampleProgram = texture + " : register(t0);\n" + sampler + " : register(s0);\n\n";
 				sampleProgram += funcRet + " main() : SV_Target0\n{\nreturn ";
 				sampleProgram += "t.Gather" + string(channel) + "(s, " + texcoords + offsets + ")" + swizzle + ";";
 				sampleProgram += "\n}\n";
@@ -3816,28 +3850,32 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				op.operation == OPCODE_GATHER4_PO_C)
 			{
 				// comparison value
-				StringFormat::snprintf(buf, 255, ", %f", srcOpers[3].value.f.x);
+				params.scalar[0] = srcOpers[3].value.f.x;
 
-				sampleProgram = texture + " : register(t0);\n" + sampler + " : register(s0);\n\n";
 				sampleProgram += funcRet + " main() : SV_Target0\n{\nreturn ";
-				sampleProgram += "t.GatherCmp" + string(channel) + "(s, " + texcoords + buf + offsets + ")" + swizzle + ";";
+				sampleProgram += "t.GatherCmp" + string(channel) + "(s, " + texcoords + ", scalar.x" + offsets + ")" + swizzle + ";";
 				sampleProgram += "\n}\n";
 			}
 
-			ID3D11VertexShader *vs = device->GetDebugManager()->MakeVShader(vsProgram.c_str(), "main", "vs_5_0");
-			ID3D11PixelShader *ps = device->GetDebugManager()->MakePShader(sampleProgram.c_str(), "main", "ps_5_0");
+			// owned by the debug manager's cache, not released here
+			ID3D11VertexShader *vs = device->GetDebugManager()->GetDebugSampleVS(vsProgram);
+			ID3D11PixelShader *ps = device->GetDebugManager()->GetDebugSamplePS(sampleProgram);
 
 			ID3D11DeviceContext *context = NULL;
 
 			device->GetReal()->GetImmediateContext(&context);
 
-			// back up SRV/sampler on PS slot 0
+			// back up SRV/sampler on PS slot 0, and the constant buffers we put our parameters in
 
 			ID3D11ShaderResourceView *prevSRV = NULL;
 			ID3D11SamplerState *prevSamp = NULL;
+			ID3D11Buffer *prevVSCB = NULL;
+			ID3D11Buffer *prevPSCB = NULL;
 
 			context->PSGetShaderResources(0, 1, &prevSRV);
 			context->PSGetSamplers(0, 1, &prevSamp);
+			context->VSGetConstantBuffers(0, 1, &prevVSCB);
+			context->PSGetConstantBuffers(0, 1, &prevPSCB);
 
 			ID3D11ShaderResourceView *usedSRV = NULL;
 			ID3D11SamplerState *usedSamp = NULL;
@@ -3881,6 +3919,10 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			context->VSSetShader(vs, NULL, 0);
 			context->PSSetShader(ps, NULL, 0);
 
+			ID3D11Buffer *paramsBuf = device->GetDebugManager()->MakeCBuffer((float *)&params, sizeof(params));
+			context->VSSetConstantBuffers(0, 1, &paramsBuf);
+			context->PSSetConstantBuffers(0, 1, &paramsBuf);
+
 			// for bias instruction we can't do a SampleGradBias, so add the bias into the sampler state.
 			if(op.operation == OPCODE_SAMPLE_B)
 			{
@@ -3928,98 +3970,46 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			context->OMSetBlendState(NULL, NULL, (UINT)~0);
 			context->OMSetDepthStencilState(NULL, 0);
 
-			ID3D11RenderTargetView *rtv = NULL;
-
-			ID3D11Texture2D *rtTex = NULL;
-			ID3D11Texture2D *copyTex = NULL;
-
-			D3D11_TEXTURE2D_DESC tdesc;
+			D3D11DebugManager::DebugSampleTarget target;
 
 			RDCASSERT(retFmt != DXGI_FORMAT_UNKNOWN);
 
-			tdesc.ArraySize = 1;
-			tdesc.BindFlags = D3D11_BIND_RENDER_TARGET;
-			tdesc.CPUAccessFlags = 0;
-			tdesc.Format = retFmt;
-			tdesc.Width = 1;
-			tdesc.Height = 1;
-			tdesc.MipLevels = 0;
-			tdesc.MiscFlags = 0;
-			tdesc.SampleDesc.Count = 1;
-			tdesc.SampleDesc.Quality = 0;
-			tdesc.Usage = D3D11_USAGE_DEFAULT;
-
-			HRESULT hr = S_OK;
-			
-			hr = device->GetReal()->CreateTexture2D(&tdesc, NULL, &rtTex);
-			
-			if(FAILED(hr))
-			{
-				RDCERR("Failed to create RT tex %08x", hr);
-				return s;
-			}
-
-			tdesc.BindFlags = 0;
-			tdesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-			tdesc.Usage = D3D11_USAGE_STAGING;
-
-			hr = device->GetReal()->CreateTexture2D(&tdesc, NULL, &copyTex);
-			
-			if(FAILED(hr))
-			{
-				RDCERR("Failed to create copy tex %08x", hr);
-				return s;
-			}
-
-			D3D11_RENDER_TARGET_VIEW_DESC rtDesc;
+			if(!device->GetDebugManager()->GetDebugSampleTarget(retFmt, target))
+				return;
 
-			rtDesc.Format = retFmt;
-			rtDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
-			rtDesc.Texture2D.MipSlice = 0;
-
-			hr = device->GetReal()->CreateRenderTargetView(rtTex, &rtDesc, &rtv);
-			
-			if(FAILED(hr))
-			{
-				RDCERR("Failed to create rt rtv %08x", hr);
-				return s;
-			}
-
-			context->OMSetRenderTargetsAndUnorderedAccessViews(1, &rtv, NULL, 0, 0, NULL, NULL);
+			context->OMSetRenderTargetsAndUnorderedAccessViews(1, &target.rtv, NULL, 0, 0, NULL, NULL);
 			context->Draw(3, 0);
 
-			context->CopyResource(copyTex, rtTex);
+			context->CopyResource(target.readback, target.tex);
 
 			D3D11_MAPPED_SUBRESOURCE mapped;
-			hr = context->Map(copyTex, 0, D3D11_MAP_READ, 0, &mapped);
+			HRESULT hr = context->Map(target.readback, 0, D3D11_MAP_READ, 0, &mapped);
 			
 			if(FAILED(hr))
 			{
 				RDCERR("Failed to map results %08x", hr);
-				return s;
+				return;
 			}
 
 			ShaderVariable lookupResult("tex", 0.0f, 0.0f, 0.0f, 0.0f);
 
 			memcpy(lookupResult.value.iv, mapped.pData, sizeof(uint32_t)*4);
 			
-			context->Unmap(copyTex, 0);
-
-			SAFE_RELEASE(rtTex);
-			SAFE_RELEASE(copyTex);
-			SAFE_RELEASE(rtv);
-			SAFE_RELEASE(vs);
-			SAFE_RELEASE(ps);
+			context->Unmap(target.readback, 0);
 
-			// restore whatever was on PS slot 0 before we messed with it
+			// restore whatever was on slot 0 before we messed with it
 			
 			context->PSSetShaderResources(0, 1, &prevSRV);
 			context->PSSetSamplers(0, 1, &prevSamp);
+			context->VSSetConstantBuffers(0, 1, &prevVSCB);
+			context->PSSetConstantBuffers(0, 1, &prevPSCB);
 			
 			SAFE_RELEASE(context);
 
 			SAFE_RELEASE(prevSRV);
 			SAFE_RELEASE(prevSamp);
+			SAFE_RELEASE(prevVSCB);
+			SAFE_RELEASE(prevPSCB);
 
 			SAFE_RELEASE(usedSRV);
 			SAFE_RELEASE(usedSamp);
@@ -4045,9 +4035,9 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 
 			uint32_t search = s.nextInstruction;
 
-			for(; search < (int)dxbc->m_Instructions.size(); search++)
+			for(; search < (int)dxbc->GetInstructions().size(); search++)
 			{
-				const ASMOperation &nextOp = s.dxbc->m_Instructions[search];
+				const ASMOperation &nextOp = s.dxbc->GetInstructions()[search];
 
 				// track nested switch statements to ensure we don't accidentally pick the case from a different switch
 				if(nextOp.operation == OPCODE_SWITCH)
@@ -4094,9 +4084,9 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			{
 				// skip straight past any case or default labels as we don't want to step to them, we want next instruction to point
 				// at the next excutable instruction (which might be a break if we're doing nothing)
-				for(; jumpLocation < (int)dxbc->m_Instructions.size(); jumpLocation++)
+				for(; jumpLocation < (int)dxbc->GetInstructions().size(); jumpLocation++)
 				{
-					const ASMOperation &nextOp = s.dxbc->m_Instructions[jumpLocation];
+					const ASMOperation &nextOp = s.dxbc->GetInstructions()[jumpLocation];
 
 					if(nextOp.operation != OPCODE_CASE && nextOp.operation != OPCODE_DEFAULT)
 						break;
@@ -4136,9 +4126,9 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 
 				for(; s.nextInstruction >= 0; s.nextInstruction--)
 				{
-					if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDLOOP)
+					if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDLOOP)
 						depth++;
-					if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_LOOP)
+					if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_LOOP)
 						depth--;
 
 					if(depth == 0)
@@ -4166,13 +4156,13 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				// break out (jump to next endloop/endswitch)
 				int depth = 1;
 				
-				for(; s.nextInstruction < (int)dxbc->m_Instructions.size(); s.nextInstruction++)
+				for(; s.nextInstruction < (int)dxbc->GetInstructions().size(); s.nextInstruction++)
 				{
-					if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_LOOP ||
-						s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_SWITCH)
+					if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_LOOP ||
+						s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_SWITCH)
 						depth++;
-					if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDLOOP ||
-						s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDSWITCH)
+					if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDLOOP ||
+						s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDSWITCH)
 						depth--;
 
 					if(depth == 0)
@@ -4181,8 +4171,8 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 					}
 				}
 
-				RDCASSERT(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDLOOP ||
-									s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDSWITCH);
+				RDCASSERT(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDLOOP ||
+									s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDSWITCH);
 
 				// don't want to process the endloop and jump again!
 				s.nextInstruction++;
@@ -4209,13 +4199,13 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				// skip back one to the if that we're processing
 				s.nextInstruction--;
 
-				for(; s.nextInstruction < (int)dxbc->m_Instructions.size(); s.nextInstruction++)
+				for(; s.nextInstruction < (int)dxbc->GetInstructions().size(); s.nextInstruction++)
 				{
-					if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_IF)
+					if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_IF)
 						depth++;
-					if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ELSE)
+					if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ELSE)
 						depth--;
-					if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDIF)
+					if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDIF)
 						depth--;
 
 					if(depth == 0)
@@ -4224,8 +4214,8 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 					}
 				}
 
-				RDCASSERT(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ELSE ||
-						 s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDIF);
+				RDCASSERT(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ELSE ||
+						 s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDIF);
 
 				// step to next instruction after the else/endif (processing an else would skip that block)
 				s.nextInstruction++;
@@ -4238,11 +4228,11 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			// if we hit an else then we've just processed the if() bracket and need to break out (jump to next endif)
 			int depth = 1;
 
-			for(; s.nextInstruction < (int)dxbc->m_Instructions.size(); s.nextInstruction++)
+			for(; s.nextInstruction < (int)dxbc->GetInstructions().size(); s.nextInstruction++)
 			{
-				if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_IF)
+				if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_IF)
 					depth++;
-				if(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDIF)
+				if(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDIF)
 					depth--;
 
 				if(depth == 0)
@@ -4251,7 +4241,7 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 				}
 			}
 
-			RDCASSERT(s.dxbc->m_Instructions[s.nextInstruction].operation == OPCODE_ENDIF);
+			RDCASSERT(s.dxbc->GetInstructions()[s.nextInstruction].operation == OPCODE_ENDIF);
 
 			break;
 		}
@@ -4297,8 +4287,6 @@ State State::GetNext(GlobalState &global, State quad[4]) const
 			break;
 		}
 	}
-
-	return s;
 }
 
 }; // namespace ShaderDebug
\ No newline at end of file
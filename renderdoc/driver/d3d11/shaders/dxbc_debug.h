@@ -35,6 +35,14 @@ class WrappedID3D11Device;
 namespace ShaderDebug
 {
 
+// the parts of an instruction that don't depend on the register state, worked out once
+// for the whole program so that stepping doesn't re-derive them every time
+struct DecodedOperation
+{
+	VarType optype;
+	size_t numOperands;
+};
+
 struct GlobalState
 {
 	public:
@@ -101,6 +109,11 @@ struct GlobalState
 		};
 
 		vector<groupsharedMem> groupshared;
+
+		// indexed the same as the program's instructions
+		vector<DecodedOperation> decoded;
+
+		void Decode(DXBC::DXBCFile *dxbc);
 };
 
 class State : public ShaderDebugState
@@ -145,9 +158,19 @@ class State : public ShaderDebugState
 
 		void Init();
 		bool Finished() const;
+
+		// true if the next instruction is a sync that every thread in the group must reach
+		// before any continue
+		bool AtGroupSync() const;
+		static bool IsGroupSync(const DXBC::ASMOperation &op);
 		
 		State GetNext(GlobalState &global, State quad[4]) const;
 
+		// as GetNext, but writes the next state into an existing State. Stepping in a
+		// loop can then ping-pong between two states rather than copying each result.
+		// next must not be this state or one of quad.
+		void StepInto(GlobalState &global, State quad[4], State &next) const;
+
 	private:
 		// index in the pixel quad
 		int quadIndex;
@@ -166,7 +189,10 @@ class State : public ShaderDebugState
 		ShaderVariable DDX(State quad[4], const DXBC::ASMOperand &oper, const DXBC::ASMOperation &op) const;
 		ShaderVariable DDY(State quad[4], const DXBC::ASMOperand &oper, const DXBC::ASMOperation &op) const;
 
-		VarType OperationType(const DXBC::OpcodeType &op) const;
+	public:
+		static VarType OperationType(const DXBC::OpcodeType &op);
+
+	private:
 
 		DXBC::DXBCFile *dxbc;
 		const ShaderDebugTrace *trace;
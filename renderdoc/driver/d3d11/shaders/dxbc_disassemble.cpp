@@ -273,8 +273,23 @@ bool ASMOperand::operator ==(const ASMOperand &o) const
 	return true;
 }
 
+void DXBCFile::FetchTypeVersion()
+{
+	if(m_HexDump.empty())
+		return;
+
+	m_Type = VersionToken::ProgramType.Get(m_HexDump[0]);
+	m_Version.Major = VersionToken::MajorVersion.Get(m_HexDump[0]);
+	m_Version.Minor = VersionToken::MinorVersion.Get(m_HexDump[0]);
+}
+
 void DXBCFile::DisassembleHexDump()
 {
+	if(m_Decoded)
+		return;
+
+	m_Decoded = true;
+
 	if(m_HexDump.empty())
 		return;
 
@@ -282,10 +297,6 @@ void DXBCFile::DisassembleHexDump()
 	uint32_t *cur = begin;
 	uint32_t *end = &m_HexDump.back();
 
-	m_Type = VersionToken::ProgramType.Get(cur[0]);
-	m_Version.Major = VersionToken::MajorVersion.Get(cur[0]);
-	m_Version.Minor = VersionToken::MinorVersion.Get(cur[0]);
-
 	// check supported types
 	if(	!(m_Version.Major == 0x5 && m_Version.Minor == 0x0) &&
 		!(m_Version.Major == 0x4 && m_Version.Minor == 0x1) &&
@@ -339,6 +350,13 @@ void DXBCFile::DisassembleHexDump()
 
 void DXBCFile::MakeDisassembly()
 {
+	if(m_Disassembled)
+		return;
+
+	m_Disassembled = true;
+
+	DisassembleHexDump();
+
 	uint32_t *hash = (uint32_t *)&m_ShaderBlob[4]; // hash is 4 uints, starting after the FOURCC of 'DXBC'
 
 	m_Disassembly = StringFormat::Fmt("Shader hash %08x-%08x-%08x-%08x\n\n",
@@ -26,6 +26,7 @@
 #include "common/common.h"
 #include "serialise/serialiser.h"
 #include "serialise/string_utils.h"
+#include "common/threading.h"
 #include "dxbc_inspect.h"
 #include "dxbc_sdbg.h"
 #include "dxbc_spdb.h"
@@ -456,10 +457,471 @@ CBufferVariableType DXBCFile::ParseRDEFType(RDEFHeader *h, char *chunkContents,
 	return ret;
 }
 
+bool DXBCFile::GetProgramType(const void *ByteCode, size_t ByteCodeLength, D3D11_SHADER_VERSION_TYPE &type)
+{
+	if(ByteCode == NULL || ByteCodeLength < sizeof(FileHeader))
+		return false;
+
+	const char *data = (const char *)ByteCode;
+	const FileHeader *header = (const FileHeader *)ByteCode;
+
+	if(header->fourcc != FOURCC_DXBC || header->fileLength != (uint32_t)ByteCodeLength ||
+		 sizeof(FileHeader) + header->numChunks*sizeof(uint32_t) > ByteCodeLength)
+		return false;
+
+	const uint32_t *chunkOffsets = (const uint32_t *)(header+1); // right after the header
+
+	for(uint32_t chunkIdx = 0; chunkIdx < header->numChunks; chunkIdx++)
+	{
+		if(chunkOffsets[chunkIdx] + sizeof(uint32_t)*3 > ByteCodeLength)
+			continue;
+
+		const uint32_t *fourcc = (const uint32_t *)(data + chunkOffsets[chunkIdx]);
+
+		if(*fourcc == FOURCC_SHEX || *fourcc == FOURCC_SHDR)
+		{
+			// the first token of the program is the version token, with the type in the top 16 bits
+			const uint32_t *versionToken = fourcc + 2;
+			type = (D3D11_SHADER_VERSION_TYPE)(*versionToken >> 16);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Reflection cache
+//
+// Parsing the RDEF and signature chunks (or guessing resources from the declarations when
+// the reflection is stripped) is most of the cost of creating a DXBCFile, and the same
+// shaders are loaded every time a log is replayed. The parsed results are kept in a cache
+// file keyed by the checksum fxc stores in the container header, which covers the rest of
+// the blob. The file is mapped on load and each entry is only deserialised when a shader
+// with that checksum is created.
+//////////////////////////////////////////////////////////////////////////
+
+struct ReflectionCacheKey
+{
+	uint32_t hashValue[4];
+	uint32_t fileLength;
+
+	bool operator <(const ReflectionCacheKey &o) const
+	{
+		return memcmp(this, &o, sizeof(ReflectionCacheKey)) < 0;
+	}
+};
+
+struct ReflectionCacheEntry
+{
+	ReflectionCacheEntry() : data(NULL), size(0) {}
+
+	// points either into the mapped cache file, or at owned for entries added since it was loaded
+	const byte *data;
+	size_t size;
+	vector<byte> owned;
+};
+
+static const uint32_t ReflectionCacheVersion = 1;
+static const char *ReflectionCacheFilename = "dxbcreflection.cache";
+
+static Threading::CriticalSection reflectionCacheLock;
+static bool reflectionCacheEnabled = false;
+static bool reflectionCacheDirty = false;
+static void *reflectionCacheMapping = NULL;
+static uint64_t reflectionCacheMappingSize = 0;
+static map<ReflectionCacheKey, ReflectionCacheEntry> reflectionCache;
+
+// none of these types can be serialised as POD, and the serialiser specialisation for
+// SigParameter lives with the replay proxy, so each is written out member by member here.
+// the DXBC enums have no string conversion for the serialiser, so they go through a uint32
+template<typename T>
+static void SerialiseCacheEnum(Serialiser &ser, const char *name, T &el)
+{
+	uint32_t val = (uint32_t)el;
+	ser.Serialise(name, val);
+	el = (T)val;
+}
+
+static bool SerialiseCacheCount(Serialiser &ser, uint32_t &count)
+{
+	ser.Serialise("count", count);
+
+	// every element takes at least one byte, anything bigger can only come from a corrupt entry
+	return !ser.HasError() && count <= ser.GetSize();
+}
+
+static bool SerialiseCacheVariable(Serialiser &ser, CBufferVariable &v);
+
+static bool SerialiseCacheType(Serialiser &ser, CBufferVariableType &t)
+{
+	SerialiseCacheEnum(ser, "varClass", t.descriptor.varClass);
+	SerialiseCacheEnum(ser, "type", t.descriptor.type);
+	ser.Serialise("rows", t.descriptor.rows);
+	ser.Serialise("cols", t.descriptor.cols);
+	ser.Serialise("elements", t.descriptor.elements);
+	ser.Serialise("members", t.descriptor.members);
+	ser.Serialise("bytesize", t.descriptor.bytesize);
+	ser.Serialise("name", t.descriptor.name);
+
+	uint32_t count = (uint32_t)t.members.size();
+	if(!SerialiseCacheCount(ser, count))
+		return false;
+
+	t.members.resize(count);
+	for(uint32_t i=0; i < count; i++)
+		if(!SerialiseCacheVariable(ser, t.members[i]))
+			return false;
+
+	return true;
+}
+
+static bool SerialiseCacheVariable(Serialiser &ser, CBufferVariable &v)
+{
+	ser.Serialise("name", v.name);
+	ser.Serialise("descName", v.descriptor.name);
+	ser.Serialise("offset", v.descriptor.offset);
+	ser.Serialise("flags", v.descriptor.flags);
+	ser.Serialise("defaultValue", v.descriptor.defaultValue);
+	ser.Serialise("startTexture", v.descriptor.startTexture);
+	ser.Serialise("numTextures", v.descriptor.numTextures);
+	ser.Serialise("startSampler", v.descriptor.startSampler);
+	ser.Serialise("numSamplers", v.descriptor.numSamplers);
+
+	return SerialiseCacheType(ser, v.type);
+}
+
+static bool SerialiseCacheCBuffer(Serialiser &ser, CBuffer &cb)
+{
+	ser.Serialise("name", cb.name);
+	ser.Serialise("descName", cb.descriptor.name);
+	SerialiseCacheEnum(ser, "type", cb.descriptor.type);
+	ser.Serialise("numVars", cb.descriptor.numVars);
+	ser.Serialise("byteSize", cb.descriptor.byteSize);
+	ser.Serialise("flags", cb.descriptor.flags);
+
+	uint32_t count = (uint32_t)cb.variables.size();
+	if(!SerialiseCacheCount(ser, count))
+		return false;
+
+	cb.variables.resize(count);
+	for(uint32_t i=0; i < count; i++)
+		if(!SerialiseCacheVariable(ser, cb.variables[i]))
+			return false;
+
+	return true;
+}
+
+static bool SerialiseCacheSignature(Serialiser &ser, vector<SigParameter> &sig)
+{
+	uint32_t count = (uint32_t)sig.size();
+	if(!SerialiseCacheCount(ser, count))
+		return false;
+
+	sig.resize(count);
+	for(uint32_t i=0; i < count; i++)
+	{
+		SigParameter &el = sig[i];
+
+		ser.Serialise("varName", el.varName);
+		ser.Serialise("semanticName", el.semanticName);
+		ser.Serialise("semanticIndex", el.semanticIndex);
+		ser.Serialise("semanticIdxName", el.semanticIdxName);
+		ser.Serialise("needSemanticIndex", el.needSemanticIndex);
+		ser.Serialise("regIndex", el.regIndex);
+		ser.Serialise("systemValue", el.systemValue);
+		ser.Serialise("compType", el.compType);
+		ser.Serialise("regChannelMask", el.regChannelMask);
+		ser.Serialise("channelUsedMask", el.channelUsedMask);
+		ser.Serialise("compCount", el.compCount);
+		ser.Serialise("stream", el.stream);
+	}
+
+	return !ser.HasError();
+}
+
+static bool SerialiseCachedReflection(Serialiser &ser, bool writing, DXBCFile &dxbc)
+{
+	SerialiseCacheEnum(ser, "type", dxbc.m_Type);
+	ser.Serialise("major", dxbc.m_Version.Major);
+	ser.Serialise("minor", dxbc.m_Version.Minor);
+
+	// the statistics are just the STAT chunk's fixed numbers, plus the version enum
+	ser.Serialise<sizeof(ShaderStatistics)/sizeof(uint32_t)>("stats", (uint32_t *)&dxbc.m_ShaderStats);
+
+	uint32_t count = (uint32_t)dxbc.m_Resources.size();
+	if(!SerialiseCacheCount(ser, count))
+		return false;
+
+	dxbc.m_Resources.resize(count);
+	for(uint32_t i=0; i < count; i++)
+	{
+		ShaderInputBind &bind = dxbc.m_Resources[i];
+
+		ser.Serialise("name", bind.name);
+		SerialiseCacheEnum(ser, "type", bind.type);
+		ser.Serialise("bindPoint", bind.bindPoint);
+		ser.Serialise("bindCount", bind.bindCount);
+		ser.Serialise("flags", bind.flags);
+		SerialiseCacheEnum(ser, "retType", bind.retType);
+		SerialiseCacheEnum(ser, "dimension", bind.dimension);
+		ser.Serialise("numSamples", bind.numSamples);
+	}
+
+	count = (uint32_t)dxbc.m_CBuffers.size();
+	if(!SerialiseCacheCount(ser, count))
+		return false;
+
+	dxbc.m_CBuffers.resize(count);
+	for(uint32_t i=0; i < count; i++)
+		if(!SerialiseCacheCBuffer(ser, dxbc.m_CBuffers[i]))
+			return false;
+
+	if(!SerialiseCacheCBuffer(ser, dxbc.m_Interfaces))
+		return false;
+
+	count = (uint32_t)dxbc.m_ResourceBinds.size();
+	if(!SerialiseCacheCount(ser, count))
+		return false;
+
+	if(writing)
+	{
+		for(auto it=dxbc.m_ResourceBinds.begin(); it != dxbc.m_ResourceBinds.end(); ++it)
+		{
+			string name = it->first;
+			ser.Serialise("name", name);
+			SerialiseCacheType(ser, it->second);
+		}
+	}
+	else
+	{
+		for(uint32_t i=0; i < count; i++)
+		{
+			string name;
+			ser.Serialise("name", name);
+			if(!SerialiseCacheType(ser, dxbc.m_ResourceBinds[name]))
+				return false;
+		}
+	}
+
+	return SerialiseCacheSignature(ser, dxbc.m_InputSig) &&
+	       SerialiseCacheSignature(ser, dxbc.m_OutputSig) &&
+	       SerialiseCacheSignature(ser, dxbc.m_PatchConstantSig);
+}
+
+static bool GetReflectionCacheKey(const FileHeader *header, ReflectionCacheKey &key)
+{
+	memcpy(key.hashValue, header->hashValue, sizeof(key.hashValue));
+	key.fileLength = header->fileLength;
+
+	// blobs with no checksum (e.g. built by hand, or with validation skipped) can't be told apart
+	return key.hashValue[0] || key.hashValue[1] || key.hashValue[2] || key.hashValue[3];
+}
+
+static bool FetchCachedReflection(const FileHeader *header, DXBCFile &dxbc)
+{
+	ReflectionCacheKey key;
+	if(!GetReflectionCacheKey(header, key))
+		return false;
+
+	SCOPED_LOCK(reflectionCacheLock);
+
+	if(!reflectionCacheEnabled)
+		return false;
+
+	auto it = reflectionCache.find(key);
+	if(it == reflectionCache.end())
+		return false;
+
+	Serialiser ser(it->second.size, it->second.data, false);
+
+	if(SerialiseCachedReflection(ser, false, dxbc) && !ser.HasError())
+		return true;
+
+	RDCWARN("Invalid entry in DXBC reflection cache, re-parsing shader");
+
+	// drop whatever was partially read, and the entry so it gets replaced
+	dxbc.m_Resources.clear();
+	dxbc.m_CBuffers.clear();
+	dxbc.m_Interfaces = CBuffer();
+	dxbc.m_ResourceBinds.clear();
+	dxbc.m_InputSig.clear();
+	dxbc.m_OutputSig.clear();
+	dxbc.m_PatchConstantSig.clear();
+
+	reflectionCache.erase(it);
+	reflectionCacheDirty = true;
+
+	return false;
+}
+
+static void StoreCachedReflection(const FileHeader *header, DXBCFile &dxbc)
+{
+	ReflectionCacheKey key;
+	if(!GetReflectionCacheKey(header, key))
+		return;
+
+	SCOPED_LOCK(reflectionCacheLock);
+
+	if(!reflectionCacheEnabled || reflectionCache.find(key) != reflectionCache.end())
+		return;
+
+	Serialiser ser(NULL, Serialiser::WRITING, false);
+	SerialiseCachedReflection(ser, true, dxbc);
+
+	ReflectionCacheEntry &entry = reflectionCache[key];
+	entry.owned.assign(ser.GetRawPtr(0), ser.GetRawPtr(0) + (size_t)ser.GetOffset());
+	entry.data = entry.owned.empty() ? NULL : &entry.owned[0];
+	entry.size = entry.owned.size();
+
+	reflectionCacheDirty = true;
+}
+
+static void CloseReflectionCache()
+{
+	reflectionCache.clear();
+
+	if(reflectionCacheMapping)
+		FileIO::UnmapFile(reflectionCacheMapping, reflectionCacheMappingSize);
+
+	reflectionCacheMapping = NULL;
+	reflectionCacheMappingSize = 0;
+}
+
+// the file is a version and count, then for each entry the key, the entry's length and that
+// many bytes of serialised reflection.
+void DXBCFile::LoadReflectionCache()
+{
+	SCOPED_LOCK(reflectionCacheLock);
+
+	if(reflectionCacheEnabled)
+		return;
+
+	reflectionCacheEnabled = true;
+	reflectionCacheDirty = false;
+
+	string cachefile = FileIO::GetAppFolderFilename(ReflectionCacheFilename);
+
+	uint64_t cachelen = 0;
+	byte *base = (byte *)FileIO::MapFile(cachefile.c_str(), cachelen);
+
+	if(base == NULL)
+		return;
+
+	reflectionCacheMapping = base;
+	reflectionCacheMappingSize = cachelen;
+
+	const byte *ptr = base;
+	const byte *end = base + (size_t)cachelen;
+
+	uint32_t version = 0, numentries = 0;
+
+	if(cachelen >= sizeof(uint32_t)*2)
+	{
+		memcpy(&version, ptr, sizeof(uint32_t)); ptr += sizeof(uint32_t);
+		memcpy(&numentries, ptr, sizeof(uint32_t)); ptr += sizeof(uint32_t);
+	}
+
+	if(version != ReflectionCacheVersion)
+	{
+		RDCDEBUG("Out of date or invalid DXBC reflection cache version: %d", version);
+		CloseReflectionCache();
+		reflectionCacheDirty = true;
+		return;
+	}
+
+	for(uint32_t i=0; i < numentries; i++)
+	{
+		ReflectionCacheKey key;
+		uint32_t len = 0;
+
+		if(size_t(end - ptr) < sizeof(key) + sizeof(len))
+			break;
+
+		memcpy(&key, ptr, sizeof(key)); ptr += sizeof(key);
+		memcpy(&len, ptr, sizeof(len)); ptr += sizeof(len);
+
+		if(size_t(end - ptr) < len)
+			break;
+
+		ReflectionCacheEntry &entry = reflectionCache[key];
+		entry.data = ptr;
+		entry.size = len;
+
+		ptr += len;
+	}
+
+	if(reflectionCache.size() != numentries)
+	{
+		RDCERR("Invalid DXBC reflection cache");
+		CloseReflectionCache();
+		reflectionCacheDirty = true;
+		return;
+	}
+
+	RDCDEBUG("Mapped %d shaders from DXBC reflection cache", numentries);
+}
+
+void DXBCFile::SaveReflectionCache()
+{
+	SCOPED_LOCK(reflectionCacheLock);
+
+	if(!reflectionCacheEnabled)
+		return;
+
+	if(reflectionCacheDirty)
+	{
+		// don't let the cache grow without bound if many different logs are opened, just start again.
+		const size_t maxEntries = 64*1024;
+
+		uint32_t version = ReflectionCacheVersion;
+		uint32_t numentries = (uint32_t)RDCMIN(reflectionCache.size(), maxEntries);
+
+		// build the whole file in memory first, since existing entries point into the mapping
+		// of the file that's about to be overwritten.
+		vector<byte> contents;
+		contents.insert(contents.end(), (byte *)&version, (byte *)(&version+1));
+		contents.insert(contents.end(), (byte *)&numentries, (byte *)(&numentries+1));
+
+		auto it = reflectionCache.begin();
+		for(uint32_t i=0; i < numentries; i++, ++it)
+		{
+			uint32_t len = (uint32_t)it->second.size;
+			contents.insert(contents.end(), (const byte *)&it->first, (const byte *)(&it->first+1));
+			contents.insert(contents.end(), (byte *)&len, (byte *)(&len+1));
+			contents.insert(contents.end(), it->second.data, it->second.data + len);
+		}
+
+		CloseReflectionCache();
+
+		string cachefile = FileIO::GetAppFolderFilename(ReflectionCacheFilename);
+
+		FILE *f = FileIO::fopen(cachefile.c_str(), "wb");
+		if(f)
+		{
+			FileIO::fwrite(&contents[0], 1, contents.size(), f);
+			FileIO::fclose(f);
+
+			RDCDEBUG("Wrote %d shaders to DXBC reflection cache", numentries);
+		}
+		else
+		{
+			RDCERR("Error opening DXBC reflection cache %s for write", cachefile.c_str());
+		}
+	}
+
+	CloseReflectionCache();
+
+	reflectionCacheEnabled = false;
+	reflectionCacheDirty = false;
+}
+
 DXBCFile::DXBCFile(const void *ByteCode, size_t ByteCodeLength)
 {
 	m_DebugInfo = NULL;
 
+	m_Decoded = m_Disassembled = false;
+
 	RDCASSERT(ByteCodeLength < UINT32_MAX);
 
 	m_ShaderBlob.resize(ByteCodeLength);
@@ -481,6 +943,9 @@ DXBCFile::DXBCFile(const void *ByteCode, size_t ByteCodeLength)
 
 	bool rdefFound = false;
 
+	// if this shader has been seen before, only the bytecode and debug chunks need to be read
+	bool cached = FetchCachedReflection(header, *this);
+
 	uint32_t *chunkOffsets = (uint32_t *)(header+1); // right after the header
 
 	for(uint32_t chunkIdx = 0; chunkIdx < header->numChunks; chunkIdx++)
@@ -490,7 +955,7 @@ DXBCFile::DXBCFile(const void *ByteCode, size_t ByteCodeLength)
 
 		char *chunkContents = (char *)(data + chunkOffsets[chunkIdx] + sizeof(uint32_t)*2);
 
-		if(*fourcc == FOURCC_RDEF)
+		if(*fourcc == FOURCC_RDEF && !cached)
 		{
 			RDEFHeader *h = (RDEFHeader *)fourcc;
 
@@ -654,7 +1119,7 @@ DXBCFile::DXBCFile(const void *ByteCode, size_t ByteCodeLength)
 				}
 			}
 		}
-		else if(*fourcc == FOURCC_STAT)
+		else if(*fourcc == FOURCC_STAT && !cached)
 		{
 			if( *chunkSize == STATSizeDX10 )
 			{
@@ -678,11 +1143,11 @@ DXBCFile::DXBCFile(const void *ByteCode, size_t ByteCodeLength)
 		}
 	}
 	
-	DisassembleHexDump();
+	FetchTypeVersion();
 
 	// didn't find an rdef means reflection information was stripped.
 	// Attempt to reverse engineer basic info from declarations
-	if(!rdefFound)
+	if(!rdefFound && !cached)
 		GuessResources();
 	
 	for(uint32_t chunkIdx = 0; chunkIdx < header->numChunks; chunkIdx++)
@@ -692,7 +1157,7 @@ DXBCFile::DXBCFile(const void *ByteCode, size_t ByteCodeLength)
 
 		char *chunkContents = (char *)(data + chunkOffsets[chunkIdx] + sizeof(uint32_t)*2);
 
-		if(*fourcc == FOURCC_ISGN || *fourcc == FOURCC_OSGN || *fourcc == FOURCC_OSG5 || *fourcc == FOURCC_PCSG)
+		if((*fourcc == FOURCC_ISGN || *fourcc == FOURCC_OSGN || *fourcc == FOURCC_OSG5 || *fourcc == FOURCC_PCSG) && !cached)
 		{
 			SIGNHeader *sign = (SIGNHeader *)fourcc;
 
@@ -855,17 +1320,20 @@ DXBCFile::DXBCFile(const void *ByteCode, size_t ByteCodeLength)
 		}
 		else if(*fourcc == FOURCC_SPDB)
 		{
-			m_DebugInfo = new SPDBChunk(fourcc, (uint32_t)m_Instructions[0].offset);
+			m_DebugInfo = new SPDBChunk(fourcc, (uint32_t)GetInstructions()[0].offset);
 		}
 	}
 
-	MakeDisassembly();
+	if(!cached)
+		StoreCachedReflection(header, *this);
 }
 
 void DXBCFile::GuessResources()
 {
 	char buf[64] = {0};
 
+	DisassembleHexDump();
+
 	for(size_t i=0; i < m_Declarations.size(); i++)
 	{
 		ASMDecl &dcl = m_Declarations[i];
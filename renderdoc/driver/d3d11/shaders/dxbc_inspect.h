@@ -320,13 +320,28 @@ class DXBCFile
 		DXBCFile(const void *ByteCode, size_t ByteCodeLength);
 		~DXBCFile() { SAFE_DELETE(m_DebugInfo); }
 
+		// reads just the program type from the bytecode's SHDR/SHEX chunk, without parsing
+		// anything else. Returns false if there isn't one.
+		static bool GetProgramType(const void *ByteCode, size_t ByteCodeLength, D3D11_SHADER_VERSION_TYPE &type);
+
+		// between these calls the parsed reflection of each shader is looked up in, and added
+		// to, an on-disk cache keyed by the bytecode checksum. Outside of them shaders are
+		// always parsed in full.
+		static void LoadReflectionCache();
+		static void SaveReflectionCache();
+
+		// the bytecode is only decoded into declarations and instructions, and the disassembly
+		// string generated, on first use. Most shaders only ever need the reflection data.
+		vector<ASMDecl> &GetDeclarations() { DisassembleHexDump(); return m_Declarations; } // declarations of inputs, outputs, constant buffers, temp registers etc.
+		vector<ASMOperation> &GetInstructions() { DisassembleHexDump(); return m_Instructions; }
+		vector<uint32_t> &GetImmediate() { DisassembleHexDump(); return m_Immediate; }
+		const string &GetDisassembly() { MakeDisassembly(); return m_Disassembly; }
+
 		D3D11_SHADER_VERSION_TYPE m_Type;
 		struct { uint32_t Major, Minor; } m_Version;
 
 		ShaderStatistics m_ShaderStats;
 		DXBCDebugChunk *m_DebugInfo;
-		
-		vector<uint32_t> m_Immediate;
 
 		vector<ShaderInputBind> m_Resources;
 
@@ -339,10 +354,6 @@ class DXBCFile
 		vector<SigParameter> m_InputSig;
 		vector<SigParameter> m_OutputSig;
 		vector<SigParameter> m_PatchConstantSig;
-		
-		vector<ASMDecl> m_Declarations;							// declarations of inputs, outputs, constant buffers, temp registers etc.
-		vector<ASMOperation> m_Instructions;
-		string m_Disassembly;
 
 		vector<uint32_t> m_HexDump;
 		
@@ -353,6 +364,14 @@ class DXBCFile
 		DXBCFile(const DXBCFile &o);
 		DXBCFile &operator =(const DXBCFile &o);
 
+		bool m_Decoded, m_Disassembled;
+
+		vector<uint32_t> m_Immediate;
+		vector<ASMDecl> m_Declarations;
+		vector<ASMOperation> m_Instructions;
+		string m_Disassembly;
+
+		void FetchTypeVersion();
 		void DisassembleHexDump();
 		void MakeDisassembly();
 		void GuessResources();
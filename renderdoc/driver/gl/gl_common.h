@@ -98,6 +98,10 @@ GLenum MakeGLPrimitiveTopology(PrimitiveTopology Topo);
 const char *BlendString(GLenum blendenum);
 const char *SamplerString(GLenum smpenum);
 
+// static name string of the enum, e.g. "GL_TEXTURE_2D", or NULL if it's not a known value.
+// ToStr::Get(GLenum) is the same but allocates, and formats unknown values.
+const char *GLEnumName(GLenum e);
+
 GLuint GetBoundVertexBuffer(const GLHookSet &gl, GLuint idx);
 
 void GetBindpointMapping(const GLHookSet &gl, GLuint curProg, int shadIdx, ShaderReflection *refl, ShaderBindpointMapping &mapping);
@@ -114,6 +118,10 @@ enum ExtensionCheckEnum
 	ExtensionSupported_KHR_blend_equation_advanced_coherent,
 	ExtensionSupported_EXT_raster_multisample,
 	ExtensionSupported_ARB_indirect_parameters,
+	ExtensionSupported_ARB_pipeline_statistics_query,
+	ExtensionSupported_ARB_multi_bind,
+	ExtensionSupported_NVX_gpu_memory_info,
+	ExtensionSupported_ATI_meminfo,
 	ExtensionSupported_Count,
 };
 extern bool ExtensionSupported[ExtensionSupported_Count];
@@ -27,6 +27,8 @@
 #include "gl_driver.h"
 #include "gl_resources.h"
 
+#include <algorithm>
+
 void GLReplay::PreContextInitCounters()
 {
 }
@@ -43,11 +45,53 @@ void GLReplay::PostContextShutdownCounters()
 {
 }
 
+// the query target that gathers each counter, or eGL_NONE if it isn't available
+static GLenum CounterTarget(uint32_t counterID)
+{
+	switch(counterID)
+	{
+		case eCounter_EventGPUDuration:    return eGL_TIME_ELAPSED;
+		case eCounter_GSPrimitives:        return eGL_PRIMITIVES_GENERATED;
+		case eCounter_SamplesWritten:      return eGL_SAMPLES_PASSED;
+		default: break;
+	}
+
+	if(!ExtensionSupported[ExtensionSupported_ARB_pipeline_statistics_query])
+		return eGL_NONE;
+
+	switch(counterID)
+	{
+		case eCounter_InputVerticesRead:   return eGL_VERTICES_SUBMITTED_ARB;
+		case eCounter_IAPrimitives:        return eGL_PRIMITIVES_SUBMITTED_ARB;
+		case eCounter_VSInvocations:       return eGL_VERTEX_SHADER_INVOCATIONS_ARB;
+		case eCounter_RasterizedPrimitives: return eGL_CLIPPING_OUTPUT_PRIMITIVES_ARB;
+		case eCounter_PSInvocations:       return eGL_FRAGMENT_SHADER_INVOCATIONS_ARB;
+		case eCounter_CSInvocations:       return eGL_COMPUTE_SHADER_INVOCATIONS_ARB;
+		default: break;
+	}
+
+	return eGL_NONE;
+}
+
 vector<uint32_t> GLReplay::EnumerateCounters()
 {
 	vector<uint32_t> ret;
 
-	ret.push_back(eCounter_EventGPUDuration);
+	const uint32_t counters[] = {
+		eCounter_EventGPUDuration,
+		eCounter_InputVerticesRead,
+		eCounter_IAPrimitives,
+		eCounter_VSInvocations,
+		eCounter_GSPrimitives,
+		eCounter_RasterizedPrimitives,
+		eCounter_PSInvocations,
+		eCounter_CSInvocations,
+		eCounter_SamplesWritten,
+	};
+
+	for(size_t i=0; i < ARRAY_COUNT(counters); i++)
+		if(CounterTarget(counters[i]) != eGL_NONE)
+			ret.push_back(counters[i]);
 
 	return ret;
 }
@@ -56,27 +100,64 @@ void GLReplay::DescribeCounter(uint32_t counterID, CounterDescription &desc)
 {
 	desc.counterID = counterID;
 
-	if(counterID == eCounter_EventGPUDuration)
-	{
-		desc.name = "GPU Duration";
-		desc.description = "Time taken for this event on the GPU, as measured by delta between two GPU timestamps.";
-		desc.resultByteWidth = 8;
-		desc.resultCompType = eCompType_Double;
-		desc.units = eUnits_Seconds;
-	}
-	else
+	// all counters apart from the duration are 64-bit counts
+	desc.resultByteWidth = 8;
+	desc.resultCompType = eCompType_UInt;
+	desc.units = eUnits_Absolute;
+
+	switch(counterID)
 	{
-		desc.name = "Unknown";
-		desc.description = "Unknown counter ID";
-		desc.resultByteWidth = 0;
-		desc.resultCompType = eCompType_None;
-		desc.units = eUnits_Absolute;
+		case eCounter_EventGPUDuration:
+			desc.name = "GPU Duration";
+			desc.description = "Time taken for this event on the GPU, as measured by delta between two GPU timestamps.";
+			desc.resultCompType = eCompType_Double;
+			desc.units = eUnits_Seconds;
+			break;
+		case eCounter_InputVerticesRead:
+			desc.name = "Input Vertices Read";
+			desc.description = "Number of vertices submitted to the GL.";
+			break;
+		case eCounter_IAPrimitives:
+			desc.name = "Input Primitives";
+			desc.description = "Number of primitives submitted to the GL.";
+			break;
+		case eCounter_VSInvocations:
+			desc.name = "VS Invocations";
+			desc.description = "Number of times a vertex shader was invoked.";
+			break;
+		case eCounter_GSPrimitives:
+			desc.name = "GS Primitives";
+			desc.description = "Number of primitives output by the geometry shader, or the vertex shader if there is no geometry shader.";
+			break;
+		case eCounter_RasterizedPrimitives:
+			desc.name = "Rasterized Primitives";
+			desc.description = "Number of primitives output by clipping, that were sent to the rasterizer.";
+			break;
+		case eCounter_PSInvocations:
+			desc.name = "PS Invocations";
+			desc.description = "Number of times a fragment shader was invoked.";
+			break;
+		case eCounter_CSInvocations:
+			desc.name = "CS Invocations";
+			desc.description = "Number of times a compute shader was invoked.";
+			break;
+		case eCounter_SamplesWritten:
+			desc.name = "Samples Written";
+			desc.description = "Number of samples that passed depth/stencil test.";
+			break;
+		default:
+			desc.name = "Unknown";
+			desc.description = "Unknown counter ID";
+			desc.resultByteWidth = 0;
+			desc.resultCompType = eCompType_None;
+			break;
 	}
 }
 
-struct GPUTimer
+struct GPUQueries
 {
-	GLuint obj;
+	// one query per counter being fetched, in the same order
+	vector<GLuint> obj;
 	uint32_t eventID;
 };
 
@@ -86,50 +167,50 @@ struct CounterContext
 	uint32_t minEID;
 	uint32_t maxEID;
 	uint32_t eventStart;
-	vector<GPUTimer> timers;
-	int reuseIdx;
+	// every target is different, so all of them can be active around the same draw
+	vector<GLenum> targets;
+	vector<GPUQueries> queries;
 };
 
-void GLReplay::FillTimers(CounterContext &ctx, const DrawcallTreeNode &drawnode)
+void GLReplay::FillQueries(CounterContext &ctx, const DrawcallTreeNode &drawnode)
 {
 	if(drawnode.children.empty()) return;
 
 	for(size_t i=0; i < drawnode.children.size(); i++)
 	{
 		const FetchDrawcall &d = drawnode.children[i].draw;
-		FillTimers(ctx, drawnode.children[i]);
+		FillQueries(ctx, drawnode.children[i]);
 
 		if(d.events.count == 0) continue;
 
-		GPUTimer *timer = NULL;
+		GPUQueries *queries = NULL;
 		
 		bool includeEvent = (d.eventID >= ctx.minEID && d.eventID <= ctx.maxEID);
 
 		if(includeEvent)
 		{
-			if(ctx.reuseIdx == -1)
-			{
-				ctx.timers.push_back(GPUTimer());
+			ctx.queries.push_back(GPUQueries());
 
-				timer = &ctx.timers.back();
-				timer->eventID = d.eventID;
-				timer->obj = 0;
+			queries = &ctx.queries.back();
+			queries->eventID = d.eventID;
+			queries->obj.resize(ctx.targets.size(), 0);
 
-				m_pDriver->glGenQueries(1, &timer->obj);
-			}
-			else
-			{
-				timer = &ctx.timers[ctx.reuseIdx++];
-			}
+			m_pDriver->glGenQueries((GLsizei)queries->obj.size(), &queries->obj[0]);
 		}
 
 		m_pDriver->ReplayLog(ctx.frameID, ctx.eventStart, d.eventID, eReplay_WithoutDraw);
 		
-		if(includeEvent && timer->obj)
+		if(includeEvent)
 		{
-			m_pDriver->glBeginQuery(eGL_TIME_ELAPSED, timer->obj);
+			for(size_t q=0; q < ctx.targets.size(); q++)
+				if(queries->obj[q])
+					m_pDriver->glBeginQuery(ctx.targets[q], queries->obj[q]);
+
 			m_pDriver->ReplayLog(ctx.frameID, ctx.eventStart, d.eventID, eReplay_OnlyDraw);
-			m_pDriver->glEndQuery(eGL_TIME_ELAPSED);
+
+			for(size_t q=0; q < ctx.targets.size(); q++)
+				if(queries->obj[q])
+					m_pDriver->glEndQuery(ctx.targets[q]);
 		}
 		else
 		{
@@ -140,7 +221,7 @@ void GLReplay::FillTimers(CounterContext &ctx, const DrawcallTreeNode &drawnode)
 	}
 }
 
-vector<CounterResult> GLReplay::FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters)
+vector<CounterResult> GLReplay::FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters, uint32_t numRuns)
 {
 	vector<CounterResult> ret;
 
@@ -149,54 +230,73 @@ vector<CounterResult> GLReplay::FetchCounters(uint32_t frameID, uint32_t minEven
 		RDCERR("No counters specified to FetchCounters");
 		return ret;
 	}
+
+	if(numRuns > 1)
+		return FetchCounterRuns(this, frameID, minEventID, maxEventID, counters, numRuns);
 	
 	MakeCurrentReplayContext(&m_ReplayCtx);
-	
-	uint32_t counterID = counters[0];
-	RDCASSERT(counters.size() == 1);
-	RDCASSERT(counterID == eCounter_EventGPUDuration);
-	
-	SCOPED_TIMER("Fetch Counters over %u-%u for %u", minEventID, maxEventID, counterID);
 
 	CounterContext ctx;
 	ctx.frameID = frameID;
 	ctx.minEID = minEventID;
 	ctx.maxEID = maxEventID;
 
-	for(int loop=0; loop < 1; loop++)
+	// skip any counters we can't gather, so the rest can still be fetched
+	vector<uint32_t> fetch;
+
+	for(size_t c=0; c < counters.size(); c++)
 	{
-		ctx.eventStart = 0;
-		ctx.reuseIdx = loop == 0 ? -1 : 0;
-		FillTimers(ctx, m_pDriver->GetRootDraw());
+		GLenum target = CounterTarget(counters[c]);
+
+		if(target == eGL_NONE)
+		{
+			RDCERR("Unsupported counter %u requested", counters[c]);
+			continue;
+		}
+
+		if(std::find(ctx.targets.begin(), ctx.targets.end(), target) != ctx.targets.end())
+			continue;
+
+		fetch.push_back(counters[c]);
+		ctx.targets.push_back(target);
+	}
+
+	if(fetch.empty())
+		return ret;
+	
+	SCOPED_TIMER("Fetch %u Counters over %u-%u", (uint32_t)fetch.size(), minEventID, maxEventID);
+
+	ctx.eventStart = 0;
+	FillQueries(ctx, m_pDriver->GetRootDraw());
 
-		double nanosToSecs = 1.0/1000000000.0;
+	double nanosToSecs = 1.0/1000000000.0;
 
-		GLuint prevbind = 0;
-		m_pDriver->glGetIntegerv(eGL_QUERY_BUFFER_BINDING, (GLint *)&prevbind);
-		m_pDriver->glBindBuffer(eGL_QUERY_BUFFER, 0);
+	GLuint prevbind = 0;
+	m_pDriver->glGetIntegerv(eGL_QUERY_BUFFER_BINDING, (GLint *)&prevbind);
+	m_pDriver->glBindBuffer(eGL_QUERY_BUFFER, 0);
 
-		for(size_t i=0; i < ctx.timers.size(); i++)
+	ret.reserve(ctx.queries.size()*fetch.size());
+
+	for(size_t i=0; i < ctx.queries.size(); i++)
+	{
+		for(size_t c=0; c < fetch.size(); c++)
 		{
-			if(ctx.timers[i].obj)
-			{
-				GLuint elapsed = 0;
-				m_pDriver->glGetQueryObjectuiv(ctx.timers[i].obj, eGL_QUERY_RESULT, &elapsed);
+			GLuint64 val = 0;
 
-				double duration = double(elapsed)*nanosToSecs;
+			if(ctx.queries[i].obj[c])
+				m_pDriver->glGetQueryObjectui64v(ctx.queries[i].obj[c], eGL_QUERY_RESULT, &val);
 
-				ret.push_back(CounterResult(ctx.timers[i].eventID, counterID, duration));
-			}
+			if(fetch[c] == eCounter_EventGPUDuration)
+				ret.push_back(CounterResult(ctx.queries[i].eventID, fetch[c], double(val)*nanosToSecs));
 			else
-			{
-				ret.push_back(CounterResult(ctx.timers[i].eventID, counterID, 0.0));
-			}
+				ret.push_back(CounterResult(ctx.queries[i].eventID, fetch[c], (uint64_t)val));
 		}
-
-		m_pDriver->glBindBuffer(eGL_QUERY_BUFFER, prevbind);
 	}
 
-	for(size_t i=0; i < ctx.timers.size(); i++)
-		m_pDriver->glDeleteQueries(1, &ctx.timers[i].obj);
+	m_pDriver->glBindBuffer(eGL_QUERY_BUFFER, prevbind);
+
+	for(size_t i=0; i < ctx.queries.size(); i++)
+		m_pDriver->glDeleteQueries((GLsizei)ctx.queries[i].obj.size(), &ctx.queries[i].obj[0]);
 	
 	return ret;
 }
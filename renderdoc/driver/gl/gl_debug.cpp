@@ -43,6 +43,14 @@ GLuint GLReplay::CreateCShaderProgram(const char *csSrc)
 	
 	WrappedOpenGL &gl = *m_pDriver;
 
+	GLenum stage = eGL_COMPUTE_SHADER;
+	uint64_t hash = m_pDriver->GetProgramCacheHash(1, &stage, &csSrc);
+
+	GLuint ret = gl.glCreateProgram();
+
+	if(m_pDriver->LoadCachedProgramBinary(hash, ret))
+		return ret;
+
 	GLuint cs = gl.glCreateShader(eGL_COMPUTE_SHADER);
 
 	gl.glShaderSource(cs, 1, &csSrc, NULL);
@@ -59,8 +67,6 @@ GLuint GLReplay::CreateCShaderProgram(const char *csSrc)
 		RDCERR("Shader error: %s", buffer);
 	}
 
-	GLuint ret = gl.glCreateProgram();
-
 	gl.glAttachShader(ret, cs);
 
 	gl.glLinkProgram(ret);
@@ -76,6 +82,8 @@ GLuint GLReplay::CreateCShaderProgram(const char *csSrc)
 
 	gl.glDeleteShader(cs);
 
+	m_pDriver->StoreCachedProgramBinary(hash, ret);
+
 	return ret;
 }
 
@@ -87,6 +95,23 @@ GLuint GLReplay::CreateShaderProgram(const char *vsSrc, const char *fsSrc, const
 	
 	WrappedOpenGL &gl = *m_pDriver;
 
+	GLenum stages[3];
+	const char *sources[3];
+	size_t numStages = 0;
+
+	if(vsSrc) { stages[numStages] = eGL_VERTEX_SHADER; sources[numStages++] = vsSrc; }
+	if(fsSrc) { stages[numStages] = eGL_FRAGMENT_SHADER; sources[numStages++] = fsSrc; }
+	if(gsSrc) { stages[numStages] = eGL_GEOMETRY_SHADER; sources[numStages++] = gsSrc; }
+
+	uint64_t hash = m_pDriver->GetProgramCacheHash(numStages, stages, sources);
+
+	GLuint ret = gl.glCreateProgram();
+	
+	gl.glProgramParameteri(ret, eGL_PROGRAM_SEPARABLE, GL_TRUE);
+
+	if(m_pDriver->LoadCachedProgramBinary(hash, ret))
+		return ret;
+
 	GLuint vs = 0;
 	GLuint fs = 0;
 	GLuint gs = 0;
@@ -139,13 +164,9 @@ GLuint GLReplay::CreateShaderProgram(const char *vsSrc, const char *fsSrc, const
 		}
 	}
 
-	GLuint ret = gl.glCreateProgram();
-
 	if(vs) gl.glAttachShader(ret, vs);
 	if(fs) gl.glAttachShader(ret, fs);
 	if(gs) gl.glAttachShader(ret, gs);
-	
-	gl.glProgramParameteri(ret, eGL_PROGRAM_SEPARABLE, GL_TRUE);
 
 	gl.glLinkProgram(ret);
 
@@ -164,6 +185,8 @@ GLuint GLReplay::CreateShaderProgram(const char *vsSrc, const char *fsSrc, const
 	if(fs) gl.glDeleteShader(fs);
 	if(gs) gl.glDeleteShader(gs);
 
+	m_pDriver->StoreCachedProgramBinary(hash, ret);
+
 	return ret;
 }
 
@@ -180,9 +203,27 @@ void GLReplay::InitDebugData()
 		MakeCurrentReplayContext(m_DebugCtx);
 	}
 
+	DebugData.outWidth = 0.0f; DebugData.outHeight = 0.0f;
+
+	if(RenderDoc::Inst().IsHeadlessReplay())
+	{
+		RDCLOG("Headless replay, deferring debug data creation");
+		return;
+	}
+
+	CreateDebugData();
+}
+
+void GLReplay::CreateDebugData()
+{
 	WrappedOpenGL &gl = *m_pDriver;
 
-	DebugData.outWidth = 0.0f; DebugData.outHeight = 0.0f;
+	m_DebugDataCreated = true;
+
+	MakeCurrentReplayContext(m_DebugCtx);
+
+	// the debug programs are looked up in the program binary cache before compiling
+	m_pDriver->LoadShaderCaches();
 	
 	string blitvsSource = GetEmbeddedResource(blit_vert);
 	string blitfsSource = GetEmbeddedResource(blit_frag);
@@ -326,6 +367,11 @@ void GLReplay::InitDebugData()
 
 	DebugData.overlayTexWidth = DebugData.overlayTexHeight = 0;
 	DebugData.overlayTex = DebugData.overlayFBO = 0;
+
+	DebugData.quadFBO = 0;
+	DebugData.quadTexs[0] = DebugData.quadTexs[1] = DebugData.quadTexs[2] = 0;
+	DebugData.quadTexWidth = DebugData.quadTexHeight = 0;
+	DebugData.quadFrameID = DebugData.quadFirstEvent = DebugData.quadLastEvent = 0;
 	
 	gl.glGenFramebuffers(1, &DebugData.customFBO);
 	gl.glBindFramebuffer(eGL_FRAMEBUFFER, DebugData.customFBO);
@@ -507,21 +553,39 @@ void GLReplay::InitDebugData()
 	gl.glGenBuffers(1, &DebugData.feedbackBuffer);
 	gl.glGenQueries(1, &DebugData.feedbackQuery);
 
+	// in a headless replay this can happen part way through the frame, so leave the replay
+	// context's bindings as they were
+	GLuint prevFeedback = 0, prevFeedbackBuffer = 0;
+	gl.glGetIntegerv(eGL_TRANSFORM_FEEDBACK_BINDING, (GLint *)&prevFeedback);
+	gl.glGetIntegerv(eGL_TRANSFORM_FEEDBACK_BUFFER_BINDING, (GLint *)&prevFeedbackBuffer);
+
 	gl.glBindTransformFeedback(eGL_TRANSFORM_FEEDBACK, DebugData.feedbackObj);
 	gl.glBindBuffer(eGL_TRANSFORM_FEEDBACK_BUFFER, DebugData.feedbackBuffer);
 	gl.glNamedBufferStorageEXT(DebugData.feedbackBuffer, 32*1024*1024, NULL, GL_MAP_READ_BIT);
 	gl.glBindBufferBase(eGL_TRANSFORM_FEEDBACK_BUFFER, 0, DebugData.feedbackBuffer);
-	gl.glBindTransformFeedback(eGL_TRANSFORM_FEEDBACK, 0);
+	gl.glBindTransformFeedback(eGL_TRANSFORM_FEEDBACK, prevFeedback);
+	gl.glBindBuffer(eGL_TRANSFORM_FEEDBACK_BUFFER, prevFeedbackBuffer);
+
+	m_pDriver->SaveShaderCaches();
 }
 
 void GLReplay::DeleteDebugData()
 {
+	if(!m_DebugDataCreated)
+		return;
+
 	WrappedOpenGL &gl = *m_pDriver;
 
 	MakeCurrentReplayContext(&m_ReplayCtx);
 	
 	gl.glDeleteProgramPipelines(1, &DebugData.overlayPipe);
 
+	if(DebugData.quadFBO)
+	{
+		gl.glDeleteFramebuffers(1, &DebugData.quadFBO);
+		gl.glDeleteTextures(3, DebugData.quadTexs);
+	}
+
 	gl.glDeleteTransformFeedbacks(1, &DebugData.feedbackObj);
 	gl.glDeleteBuffers(1, &DebugData.feedbackBuffer);
 	gl.glDeleteQueries(1, &DebugData.feedbackQuery);
@@ -537,6 +601,13 @@ void GLReplay::DeleteDebugData()
 	}
 
 	m_PostVSData.clear();
+
+	for(auto it=m_TexturePreviews.begin(); it != m_TexturePreviews.end(); ++it)
+		gl.glDeleteTextures(1, &it->tex);
+
+	m_TexturePreviews.clear();
+
+	ClearOverlayCache();
 	
 	if(DebugData.overlayFBO)
 	{
@@ -612,11 +683,17 @@ void GLReplay::DeleteDebugData()
 	gl.glDeleteBuffers(1, &DebugData.axisFrustumBuffer);
 	gl.glDeleteBuffers(1, &DebugData.triHighlightBuffer);
 
+	gl.glDeleteBuffers(1, &m_SecondaryArenaVB);
+	gl.glDeleteBuffers(1, &m_SecondaryArenaIB);
+	m_SecondaryArenaVB = m_SecondaryArenaIB = 0;
+
 	gl.glDeleteProgram(DebugData.replayQuadProg);
 }
 
 bool GLReplay::GetMinMax(ResourceId texid, uint32_t sliceFace, uint32_t mip, uint32_t sample, float *minval, float *maxval)
 {
+	EnsureDebugData();
+
 	if(m_pDriver->m_Textures.find(texid) == m_pDriver->m_Textures.end())
 		return false;
 	
@@ -799,6 +876,8 @@ bool GLReplay::GetMinMax(ResourceId texid, uint32_t sliceFace, uint32_t mip, uin
 
 bool GLReplay::GetHistogram(ResourceId texid, uint32_t sliceFace, uint32_t mip, uint32_t sample, float minval, float maxval, bool channels[4], vector<uint32_t> &histogram)
 {
+	EnsureDebugData();
+
 	if(minval >= maxval) return false;
 
 	if(m_pDriver->m_Textures.find(texid) == m_pDriver->m_Textures.end())
@@ -975,6 +1054,8 @@ bool GLReplay::GetHistogram(ResourceId texid, uint32_t sliceFace, uint32_t mip,
 
 void GLReplay::PickPixel(ResourceId texture, uint32_t x, uint32_t y, uint32_t sliceFace, uint32_t mip, uint32_t sample, float pixel[4])
 {
+	EnsureDebugData();
+
 	WrappedOpenGL &gl = *m_pDriver;
 	
 	MakeCurrentReplayContext(m_DebugCtx);
@@ -1081,6 +1162,8 @@ void GLReplay::CopyTex2DMSToArray(GLuint destArray, GLuint srcMS, GLint width, G
 
 bool GLReplay::RenderTexture(TextureDisplay cfg)
 {
+	EnsureDebugData();
+
 	return RenderTextureInternal(cfg, true);
 }
 
@@ -1211,6 +1294,39 @@ bool GLReplay::RenderTextureInternal(TextureDisplay cfg, bool blendAlpha)
 		if(IsSIntFormat(texDetails.internalFormat))
 				intIdx = 2;
 	}
+
+	float displayScale = cfg.scale;
+	if(displayScale <= 0.0f)
+		displayScale = RDCMIN(DebugData.outWidth/float(texDetails.width), DebugData.outHeight/float(texDetails.height));
+
+	// when a large texture is zoomed well out, sample from a downsampled copy rather than
+	// the full size top mip. previewMip is the mip of the texture we're showing instead.
+	GLint previewMip = 0;
+	GLint previewLevels = 0;
+
+	if(cfg.mip == 0 && cfg.CustomShader == ResourceId() && cfg.texid != DebugData.CustomShaderTexID &&
+		 !cfg.rawoutput && !renderbuffer && resType == RESTYPE_TEX2D && dsTexMode == eGL_NONE && intIdx == 0 &&
+		 !IsCompressedFormat(texDetails.internalFormat) &&
+		 RDCMAX(texDetails.width, texDetails.height) >= PreviewMinSize)
+	{
+		while(displayScale*float(1<<(previewMip+1)) <= 1.0f)
+			previewMip++;
+
+		if(previewMip > 0)
+		{
+			GLuint preview = GetTexturePreview(cfg.texid, texname, previewLevels);
+
+			if(preview)
+			{
+				previewMip = RDCMIN(previewMip, previewLevels);
+				texname = preview;
+			}
+			else
+			{
+				previewMip = 0;
+			}
+		}
+	}
 	
 	gl.glUseProgram(0);
 	gl.glUseProgramStages(DebugData.texDisplayPipe, eGL_VERTEX_SHADER_BIT, DebugData.texDisplayVSProg);
@@ -1250,7 +1366,9 @@ bool GLReplay::RenderTextureInternal(TextureDisplay cfg, bool blendAlpha)
 	int maxlevel = -1;
 
 	int clampmaxlevel = 0;
-	if(cfg.texid != DebugData.CustomShaderTexID)
+	if(previewMip > 0)
+		clampmaxlevel = previewLevels - 1;
+	else if(cfg.texid != DebugData.CustomShaderTexID)
 		clampmaxlevel = m_CachedTextures[cfg.texid].mips - 1;
 	
 	gl.glGetTextureParameterivEXT(texname, target, eGL_TEXTURE_MAX_LEVEL, (GLint *)&maxlevel);
@@ -1265,7 +1383,12 @@ bool GLReplay::RenderTextureInternal(TextureDisplay cfg, bool blendAlpha)
 		maxlevel = -1;
 	}
 
-	if(cfg.mip == 0 && cfg.scale < 1.0f && dsTexMode == eGL_NONE && resType != RESTYPE_TEXBUFFER && resType != RESTYPE_TEXRECT)
+	if(previewMip > 0)
+	{
+		// the linear sampler doesn't filter between mips, so can only be used on the top level
+		gl.glBindSampler(resType, previewMip == 1 ? DebugData.linearSampler : DebugData.pointSampler);
+	}
+	else if(cfg.mip == 0 && cfg.scale < 1.0f && dsTexMode == eGL_NONE && resType != RESTYPE_TEXBUFFER && resType != RESTYPE_TEXRECT)
 	{
 		gl.glBindSampler(resType, DebugData.linearSampler);
 	}
@@ -1334,7 +1457,7 @@ bool GLReplay::RenderTextureInternal(TextureDisplay cfg, bool blendAlpha)
 	ubo->RangeMinimum = cfg.rangemin;
 	ubo->InverseRangeSize = 1.0f/(cfg.rangemax-cfg.rangemin);
 	
-	ubo->MipLevel = (float)cfg.mip;
+	ubo->MipLevel = (float)(previewMip > 0 ? previewMip-1 : cfg.mip);
 	if(texDetails.curType != eGL_TEXTURE_3D)
 		ubo->Slice = (float)cfg.sliceFace;
 	else
@@ -1357,7 +1480,7 @@ bool GLReplay::RenderTextureInternal(TextureDisplay cfg, bool blendAlpha)
 	ubo->TextureResolutionPS.y = float(tex_y);
 	ubo->TextureResolutionPS.z = float(tex_z);
 
-	float mipScale = float(1<<cfg.mip);
+	float mipScale = float(1<<(previewMip > 0 ? previewMip : cfg.mip));
 
 	ubo->Scale *= mipScale;
 	ubo->TextureResolutionPS.x /= mipScale;
@@ -1403,8 +1526,78 @@ bool GLReplay::RenderTextureInternal(TextureDisplay cfg, bool blendAlpha)
 	return true;
 }
 
+GLuint GLReplay::GetTexturePreview(ResourceId id, GLuint texname, GLint &levels)
+{
+	WrappedOpenGL &gl = *m_pDriver;
+	
+	auto &texDetails = m_pDriver->m_Textures[id];
+
+	std::list<TexturePreview>::iterator it = m_TexturePreviews.begin();
+	for(; it != m_TexturePreviews.end(); ++it)
+		if(it->id == id)
+			break;
+
+	if(it != m_TexturePreviews.end())
+	{
+		m_TexturePreviews.splice(m_TexturePreviews.begin(), m_TexturePreviews, it);
+	}
+	else
+	{
+		if(m_TexturePreviews.size() >= NumCachedPreviews)
+		{
+			gl.glDeleteTextures(1, &m_TexturePreviews.back().tex);
+			m_TexturePreviews.pop_back();
+		}
+
+		TexturePreview p;
+		p.id = id;
+		p.levels = (GLint)CalcNumMips(RDCMAX(1, texDetails.width>>1), RDCMAX(1, texDetails.height>>1), 1);
+		p.generation = m_PreviewGeneration-1;
+
+		gl.glGenTextures(1, &p.tex);
+		gl.glBindTexture(eGL_TEXTURE_2D, p.tex);
+		gl.glTextureStorage2DEXT(p.tex, eGL_TEXTURE_2D, p.levels, texDetails.internalFormat,
+		                         RDCMAX(1, texDetails.width>>1), RDCMAX(1, texDetails.height>>1));
+
+		m_TexturePreviews.push_front(p);
+	}
+
+	TexturePreview &preview = m_TexturePreviews.front();
+
+	if(preview.generation != m_PreviewGeneration)
+	{
+		// mipmap a full size copy so the filtering matches the driver's own mip generation,
+		// then keep everything but the top level.
+		GLuint full = 0;
+		gl.glGenTextures(1, &full);
+		gl.glBindTexture(eGL_TEXTURE_2D, full);
+		gl.glTextureStorage2DEXT(full, eGL_TEXTURE_2D, preview.levels+1, texDetails.internalFormat, texDetails.width, texDetails.height);
+
+		gl.glCopyImageSubData(texname, eGL_TEXTURE_2D, 0, 0, 0, 0,
+		                      full, eGL_TEXTURE_2D, 0, 0, 0, 0,
+		                      texDetails.width, texDetails.height, 1);
+		gl.glGenerateTextureMipmapEXT(full, eGL_TEXTURE_2D);
+
+		for(GLint l=0; l < preview.levels; l++)
+		{
+			gl.glCopyImageSubData(full, eGL_TEXTURE_2D, l+1, 0, 0, 0,
+			                      preview.tex, eGL_TEXTURE_2D, l, 0, 0, 0,
+			                      RDCMAX(1, texDetails.width>>(l+1)), RDCMAX(1, texDetails.height>>(l+1)), 1);
+		}
+		
+		gl.glDeleteTextures(1, &full);
+
+		preview.generation = m_PreviewGeneration;
+	}
+
+	levels = preview.levels;
+	return preview.tex;
+}
+
 void GLReplay::RenderCheckerboard(Vec3f light, Vec3f dark)
 {
+	EnsureDebugData();
+
 	MakeCurrentReplayContext(m_DebugCtx);
 	
 	WrappedOpenGL &gl = *m_pDriver;
@@ -1430,6 +1623,8 @@ void GLReplay::RenderCheckerboard(Vec3f light, Vec3f dark)
 
 void GLReplay::RenderHighlightBox(float w, float h, float scale)
 {
+	EnsureDebugData();
+
 	MakeCurrentReplayContext(m_DebugCtx);
 	
 	const float xpixdim = 2.0f/w;
@@ -1529,13 +1724,80 @@ void GLReplay::SetupOverlayPipeline(GLuint Program, GLuint Pipeline, GLuint frag
 	gl.glUseProgramStages(DebugData.overlayPipe, eGL_FRAGMENT_SHADER_BIT, fragProgram);
 }
 
+void GLReplay::CacheOverlay(ResourceId texid, TextureDisplayOverlay overlay, uint32_t frameID, uint32_t eventID, const vector<uint32_t> &passEvents)
+{
+	WrappedOpenGL &gl = *m_pDriver;
+
+	CachedOverlay c;
+	c.texid = texid;
+	c.overlay = overlay;
+	c.frameID = frameID;
+	c.eventID = eventID;
+	c.passEvents = passEvents;
+	c.bytes = uint64_t(DebugData.overlayTexWidth)*uint64_t(DebugData.overlayTexHeight)*8;
+
+	if(c.bytes > OverlayCacheBudget)
+		return;
+
+	while(!m_OverlayCache.empty() && m_OverlayCacheBytes + c.bytes > OverlayCacheBudget)
+	{
+		m_OverlayCacheBytes -= m_OverlayCache.back().bytes;
+		gl.glDeleteTextures(1, &m_OverlayCache.back().tex);
+		m_OverlayCache.pop_back();
+	}
+
+	GLuint curTex = 0;
+	gl.glGetIntegerv(eGL_TEXTURE_BINDING_2D, (GLint*)&curTex);
+
+	gl.glGenTextures(1, &c.tex);
+	gl.glBindTexture(eGL_TEXTURE_2D, c.tex);
+	gl.glTextureStorage2DEXT(c.tex, eGL_TEXTURE_2D, 1, eGL_RGBA16, DebugData.overlayTexWidth, DebugData.overlayTexHeight);
+	gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MIN_FILTER, eGL_NEAREST);
+	gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MAG_FILTER, eGL_NEAREST);
+	gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_S, eGL_CLAMP_TO_EDGE);
+	gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_T, eGL_CLAMP_TO_EDGE);
+
+	gl.glBindTexture(eGL_TEXTURE_2D, curTex);
+
+	gl.glCopyImageSubData(DebugData.overlayTex, eGL_TEXTURE_2D, 0, 0, 0, 0,
+	                      c.tex, eGL_TEXTURE_2D, 0, 0, 0, 0,
+	                      DebugData.overlayTexWidth, DebugData.overlayTexHeight, 1);
+
+	m_OverlayCacheBytes += c.bytes;
+	m_OverlayCache.push_front(c);
+}
+
+void GLReplay::ClearOverlayCache()
+{
+	WrappedOpenGL &gl = *m_pDriver;
+
+	for(auto it=m_OverlayCache.begin(); it != m_OverlayCache.end(); ++it)
+		gl.glDeleteTextures(1, &it->tex);
+
+	m_OverlayCache.clear();
+	m_OverlayCacheBytes = 0;
+}
+
 ResourceId GLReplay::RenderOverlay(ResourceId texid, TextureDisplayOverlay overlay, uint32_t frameID, uint32_t eventID, const vector<uint32_t> &passEvents)
 {
+	EnsureDebugData();
+
 	WrappedOpenGL &gl = *m_pDriver;
 	
 	MakeCurrentReplayContext(&m_ReplayCtx);
 
 	void *ctx = m_ReplayCtx.ctx;
+
+	// flipping back to a recently rendered overlay doesn't need to render it again
+	for(auto it=m_OverlayCache.begin(); it != m_OverlayCache.end(); ++it)
+	{
+		if(it->texid == texid && it->overlay == overlay && it->frameID == frameID &&
+		   it->eventID == eventID && it->passEvents == passEvents)
+		{
+			m_OverlayCache.splice(m_OverlayCache.begin(), m_OverlayCache, it);
+			return m_pDriver->GetResourceManager()->GetID(TextureRes(ctx, m_OverlayCache.front().tex));
+		}
+	}
 	
 	GLRenderState rs(&gl.GetHookset(), NULL, READING);
 	rs.FetchState(ctx, &gl);
@@ -1814,50 +2076,90 @@ ResourceId GLReplay::RenderOverlay(ResourceId texid, TextureDisplayOverlay overl
 
 			events.push_back(eventID);
 
-			if(!events.empty())
+			// the quad usage image from the last pass overlay is kept. If this is the same pass
+			// at the same or a later event, it already holds every draw up to the last event, so
+			// only the draws since then need to be added.
+			bool resize = (DebugData.quadTexWidth != texDetails.width || DebugData.quadTexHeight != texDetails.height);
+			bool incremental = (overlay == eTexOverlay_QuadOverdrawPass && !resize && DebugData.quadLastEvent != 0 &&
+			                    DebugData.quadFrameID == frameID && DebugData.quadFirstEvent == events[0] &&
+			                    DebugData.quadLastEvent <= eventID);
+
+			uint32_t firstEvent = events[0];
+
+			if(incremental)
+			{
+				size_t skip = 0;
+				while(skip < events.size() && events[skip] <= DebugData.quadLastEvent)
+					skip++;
+				events.erase(events.begin(), events.begin()+skip);
+			}
+
 			{
-				GLuint replacefbo = 0;
-				GLuint quadtexs[3] = { 0 };
-				gl.glGenFramebuffers(1, &replacefbo);
+				if(resize && DebugData.quadFBO)
+				{
+					gl.glDeleteFramebuffers(1, &DebugData.quadFBO);
+					gl.glDeleteTextures(3, DebugData.quadTexs);
+					DebugData.quadFBO = 0;
+				}
+
+				if(DebugData.quadFBO == 0)
+				{
+					GLuint *quadtexs = DebugData.quadTexs;
+
+					gl.glGenFramebuffers(1, &DebugData.quadFBO);
+					gl.glGenTextures(3, quadtexs);
+
+					// image for quad usage
+					gl.glBindTexture(eGL_TEXTURE_2D_ARRAY, quadtexs[2]);
+					gl.glTextureStorage3DEXT(quadtexs[2], eGL_TEXTURE_2D_ARRAY, 1, eGL_R32UI, texDetails.width>>1, texDetails.height>>1, 4);
+
+					gl.glBindTexture(eGL_TEXTURE_2D, quadtexs[0]);
+					gl.glTextureStorage2DEXT(quadtexs[0], eGL_TEXTURE_2D, 1, eGL_RGBA8, texDetails.width, texDetails.height);
+					gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MIN_FILTER, eGL_NEAREST);
+					gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MAG_FILTER, eGL_NEAREST);
+					gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_S, eGL_CLAMP_TO_EDGE);
+					gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_T, eGL_CLAMP_TO_EDGE);
+
+					gl.glBindTexture(eGL_TEXTURE_2D, quadtexs[1]);
+					gl.glTextureStorage2DEXT(quadtexs[1], eGL_TEXTURE_2D, 1, eGL_DEPTH32F_STENCIL8, texDetails.width, texDetails.height);
+					gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MIN_FILTER, eGL_NEAREST);
+					gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MAG_FILTER, eGL_NEAREST);
+					gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_S, eGL_CLAMP_TO_EDGE);
+					gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_T, eGL_CLAMP_TO_EDGE);
+
+					DebugData.quadTexWidth = texDetails.width;
+					DebugData.quadTexHeight = texDetails.height;
+				}
+
+				GLuint replacefbo = DebugData.quadFBO;
+				GLuint *quadtexs = DebugData.quadTexs;
 				gl.glBindFramebuffer(eGL_FRAMEBUFFER, replacefbo);
 
-				gl.glGenTextures(3, quadtexs);
-				
-				// image for quad usage
-				gl.glBindTexture(eGL_TEXTURE_2D_ARRAY, quadtexs[2]);
-				gl.glTextureStorage3DEXT(quadtexs[2], eGL_TEXTURE_2D_ARRAY, 1, eGL_R32UI, texDetails.width>>1, texDetails.height>>1, 4);
-
-				// temporarily attach to FBO to clear it
-				GLint zero = 0;
-				gl.glFramebufferTextureLayer(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[2], 0, 0);
-				gl.glClearBufferiv(eGL_COLOR, 0, &zero);
-				gl.glFramebufferTextureLayer(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[2], 0, 1);
-				gl.glClearBufferiv(eGL_COLOR, 0, &zero);
-				gl.glFramebufferTextureLayer(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[2], 0, 2);
-				gl.glClearBufferiv(eGL_COLOR, 0, &zero);
-				gl.glFramebufferTextureLayer(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[2], 0, 3);
-				gl.glClearBufferiv(eGL_COLOR, 0, &zero);
-				
-				gl.glBindTexture(eGL_TEXTURE_2D, quadtexs[0]);
-				gl.glTextureStorage2DEXT(quadtexs[0], eGL_TEXTURE_2D, 1, eGL_RGBA8, texDetails.width, texDetails.height);
-				gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MIN_FILTER, eGL_NEAREST);
-				gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MAG_FILTER, eGL_NEAREST);
-				gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_S, eGL_CLAMP_TO_EDGE);
-				gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_T, eGL_CLAMP_TO_EDGE);
-				gl.glFramebufferTexture(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[0], 0);
+				if(!incremental)
+				{
+					// temporarily attach to FBO to clear it
+					GLint zero = 0;
+					gl.glFramebufferTextureLayer(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[2], 0, 0);
+					gl.glClearBufferiv(eGL_COLOR, 0, &zero);
+					gl.glFramebufferTextureLayer(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[2], 0, 1);
+					gl.glClearBufferiv(eGL_COLOR, 0, &zero);
+					gl.glFramebufferTextureLayer(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[2], 0, 2);
+					gl.glClearBufferiv(eGL_COLOR, 0, &zero);
+					gl.glFramebufferTextureLayer(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[2], 0, 3);
+					gl.glClearBufferiv(eGL_COLOR, 0, &zero);
+				}
 
-				gl.glBindTexture(eGL_TEXTURE_2D, quadtexs[1]);
-				gl.glTextureStorage2DEXT(quadtexs[1], eGL_TEXTURE_2D, 1, eGL_DEPTH32F_STENCIL8, texDetails.width, texDetails.height);
-				gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MIN_FILTER, eGL_NEAREST);
-				gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_MAG_FILTER, eGL_NEAREST);
-				gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_S, eGL_CLAMP_TO_EDGE);
-				gl.glTexParameteri(eGL_TEXTURE_2D, eGL_TEXTURE_WRAP_T, eGL_CLAMP_TO_EDGE);
+				gl.glFramebufferTexture(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[0], 0);
 				gl.glFramebufferTexture(eGL_FRAMEBUFFER, eGL_DEPTH_STENCIL_ATTACHMENT, quadtexs[1], 0);
 
-				if(overlay == eTexOverlay_QuadOverdrawPass)
-					ReplayLog(frameID, 0, events[0], eReplay_WithoutDraw);
-				else
-					rs.ApplyState(m_pDriver->GetCtx(), m_pDriver);
+				// if there's nothing new to add, the cached image is just resolved again
+				if(!events.empty())
+				{
+					if(overlay == eTexOverlay_QuadOverdrawPass)
+						ReplayLog(frameID, 0, events[0], eReplay_WithoutDraw);
+					else
+						rs.ApplyState(m_pDriver->GetCtx(), m_pDriver);
+				}
 				
 				GLuint lastProg = 0, lastPipe = 0;
 				for(size_t i=0; i < events.size(); i++)
@@ -1985,12 +2287,21 @@ ResourceId GLReplay::RenderOverlay(ResourceId texid, TextureDisplayOverlay overl
 					
 					gl.glFramebufferTexture(eGL_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, quadtexs[0], 0);
 				}
-				
-				gl.glDeleteFramebuffers(1, &replacefbo);
-				gl.glDeleteTextures(3, quadtexs);
 
 				if(overlay == eTexOverlay_QuadOverdrawPass)
-					ReplayLog(frameID, 0, eventID, eReplay_WithoutDraw);
+				{
+					if(!events.empty())
+						ReplayLog(frameID, 0, eventID, eReplay_WithoutDraw);
+
+					DebugData.quadFrameID = frameID;
+					DebugData.quadFirstEvent = firstEvent;
+					DebugData.quadLastEvent = eventID;
+				}
+				else
+				{
+					// the image now only holds this draw
+					DebugData.quadLastEvent = 0;
+				}
 			}
 		}
 	}
@@ -2001,10 +2312,78 @@ ResourceId GLReplay::RenderOverlay(ResourceId texid, TextureDisplayOverlay overl
 
 	rs.ApplyState(m_pDriver->GetCtx(), m_pDriver);
 
+	CacheOverlay(texid, overlay, frameID, eventID, passEvents);
+
 	return m_pDriver->GetResourceManager()->GetID(TextureRes(ctx, DebugData.overlayTex));
 }
 
 void GLReplay::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
+{
+	EnsureDebugData();
+
+	auto idx = std::make_pair(frameID, eventID);
+	auto it = m_PostVSData.find(idx);
+
+	if(it == m_PostVSData.end())
+	{
+		// make room before allocating any more
+		TrimPostVSCache();
+
+		CreatePostVSBuffers(frameID, eventID);
+
+		it = m_PostVSData.find(idx);
+	}
+
+	if(it != m_PostVSData.end())
+		it->second.lastUse = ++m_PostVSUseCounter;
+}
+
+void GLReplay::TrimPostVSCache()
+{
+	WrappedOpenGL &gl = *m_pDriver;
+
+	MakeCurrentReplayContext(&m_ReplayCtx);
+
+	uint64_t total = 0;
+
+	for(auto it=m_PostVSData.begin(); it != m_PostVSData.end(); ++it)
+	{
+		GLuint bufs[] = { it->second.vsout.buf, it->second.vsout.idxBuf, it->second.gsout.buf, it->second.gsout.idxBuf };
+
+		for(size_t i=0; i < ARRAY_COUNT(bufs); i++)
+		{
+			GLint size = 0;
+			if(bufs[i])
+				gl.glGetNamedBufferParameterivEXT(bufs[i], eGL_BUFFER_SIZE, &size);
+			total += (uint64_t)size;
+		}
+	}
+
+	while(total > PostVSCacheBudget && !m_PostVSData.empty())
+	{
+		auto lru = m_PostVSData.begin();
+		for(auto it=m_PostVSData.begin(); it != m_PostVSData.end(); ++it)
+			if(it->second.lastUse < lru->second.lastUse)
+				lru = it;
+
+		GLuint bufs[] = { lru->second.vsout.buf, lru->second.vsout.idxBuf, lru->second.gsout.buf, lru->second.gsout.idxBuf };
+
+		for(size_t i=0; i < ARRAY_COUNT(bufs); i++)
+		{
+			GLint size = 0;
+			if(bufs[i])
+			{
+				gl.glGetNamedBufferParameterivEXT(bufs[i], eGL_BUFFER_SIZE, &size);
+				gl.glDeleteBuffers(1, &bufs[i]);
+			}
+			total -= RDCMIN(total, (uint64_t)size);
+		}
+
+		m_PostVSData.erase(lru);
+	}
+}
+
+void GLReplay::CreatePostVSBuffers(uint32_t frameID, uint32_t eventID)
 {
 	auto idx = std::make_pair(frameID, eventID);
 	if(m_PostVSData.find(idx) != m_PostVSData.end())
@@ -2114,6 +2493,11 @@ void GLReplay::InitPostVSBuffers(uint32_t frameID, uint32_t eventID)
 		return;
 	}
 
+	// we relink these programs below, so they need their shaders attached
+	m_pDriver->MakeSeparableProgramRelinkable(vsProg);
+	if(tesProg) m_pDriver->MakeSeparableProgramRelinkable(tesProg);
+	if(gsProg) m_pDriver->MakeSeparableProgramRelinkable(gsProg);
+
 	const FetchDrawcall *drawcall = m_pDriver->GetDrawcall(frameID, eventID);
 
 	if(drawcall->numIndices == 0)
@@ -2973,8 +3357,12 @@ MeshFormat GLReplay::GetPostVSBuffers(uint32_t frameID, uint32_t eventID, uint32
 	RDCEraseEl(postvs);
 
 	auto idx = std::make_pair(frameID, eventID);
-	if(m_PostVSData.find(idx) != m_PostVSData.end())
-		postvs = m_PostVSData[idx];
+	auto it = m_PostVSData.find(idx);
+	if(it != m_PostVSData.end())
+	{
+		it->second.lastUse = ++m_PostVSUseCounter;
+		postvs = it->second;
+	}
 
 	GLPostVSData::StageData s = postvs.GetStage(stage);
 	
@@ -3027,86 +3415,38 @@ FloatVector GLReplay::InterpretVertex(byte *data, uint32_t vert, MeshDisplay cfg
 		vert = m_HighlightCache.indices[vert];
 	}
 
-	data += vert*cfg.position.stride;
-
-	float *out = &ret.x;
-
-	ResourceFormat fmt;
-	fmt.compByteWidth = cfg.position.compByteWidth;
-	fmt.compCount = cfg.position.compCount;
-	fmt.compType = cfg.position.compType;
-
-	if(cfg.position.specialFormat == eSpecial_R10G10B10A2)
-	{
-		if(data+4 >= end)
-		{
-			valid = false;
-			return ret;
-		}
+	if(!DecodeVertexStream(cfg.position, data, end, &vert, 1, &ret))
+		valid = false;
 
-		Vec4f v = ConvertFromR10G10B10A2(*(uint32_t *)data);
-		ret.x = v.x;
-		ret.y = v.y;
-		ret.z = v.z;
-		ret.w = v.w;
-		return ret;
-	}
-	else if(cfg.position.specialFormat == eSpecial_R11G11B10)
-	{
-		if(data+4 >= end)
-		{
-			valid = false;
-			return ret;
-		}
+	return ret;
+}
 
-		Vec3f v = ConvertFromR11G11B10(*(uint32_t *)data);
-		ret.x = v.x;
-		ret.y = v.y;
-		ret.z = v.z;
-		return ret;
-	}
-	else if(cfg.position.specialFormat == eSpecial_B8G8R8A8)
-	{
-		if(data+4 >= end)
-		{
-			valid = false;
-			return ret;
-		}
+void GLReplay::UpdateSecondaryArena(const vector<MeshFormat> &secondaryDraws)
+{
+	WrappedOpenGL &gl = *m_pDriver;
 
-		fmt.compByteWidth = 1;
-		fmt.compCount = 4;
-		fmt.compType = eCompType_UNorm;
-	}
-	
-	if(data + cfg.position.compCount*cfg.position.compByteWidth > end)
-	{
-		valid = false;
-		return ret;
-	}
+	gl.glDeleteBuffers(1, &m_SecondaryArenaVB);
+	gl.glDeleteBuffers(1, &m_SecondaryArenaIB);
+	m_SecondaryArenaVB = m_SecondaryArenaIB = 0;
 
-	for(uint32_t i=0; i < cfg.position.compCount; i++)
-	{
-		*out = ConvertComponent(fmt, data);
+	if(!m_SecondaryArena.Build(this, secondaryDraws))
+		return;
 
-		data += cfg.position.compByteWidth;
-		out++;
-	}
+	gl.glGenBuffers(1, &m_SecondaryArenaVB);
+	gl.glBindBuffer(eGL_ARRAY_BUFFER, m_SecondaryArenaVB);
+	gl.glNamedBufferStorageEXT(m_SecondaryArenaVB, (GLsizeiptr)(m_SecondaryArena.positions.size()*sizeof(Vec4f)), &m_SecondaryArena.positions[0], 0);
 
-	if(cfg.position.specialFormat == eSpecial_B8G8R8A8)
-	{
-		FloatVector reversed;
-		reversed.x = ret.x;
-		reversed.y = ret.y;
-		reversed.z = ret.z;
-		reversed.w = ret.w;
-		return reversed;
-	}
+	gl.glGenBuffers(1, &m_SecondaryArenaIB);
+	gl.glBindBuffer(eGL_ELEMENT_ARRAY_BUFFER, m_SecondaryArenaIB);
+	gl.glNamedBufferStorageEXT(m_SecondaryArenaIB, (GLsizeiptr)(m_SecondaryArena.indices.size()*sizeof(uint32_t)), &m_SecondaryArena.indices[0], 0);
 
-	return ret;
+	m_SecondaryArena.FreeData();
 }
 
 void GLReplay::RenderMesh(uint32_t frameID, uint32_t eventID, const vector<MeshFormat> &secondaryDraws, MeshDisplay cfg)
 {
+	EnsureDebugData();
+
 	WrappedOpenGL &gl = *m_pDriver;
 
 	if(cfg.position.buf == ResourceId())
@@ -3178,9 +3518,30 @@ void GLReplay::RenderMesh(uint32_t frameID, uint32_t eventID, const vector<MeshF
 		gl.glEnableVertexAttribArray(0);
 		gl.glDisableVertexAttribArray(1);
 
-		for(size_t i=0; i < secondaryDraws.size(); i++)
+		if(!m_SecondaryArena.Matches(secondaryDraws))
+			UpdateSecondaryArena(secondaryDraws);
+
+		if(m_SecondaryArenaVB && m_SecondaryArenaIB)
+		{
+			gl.glBindVertexBuffer(0, m_SecondaryArenaVB, 0, sizeof(Vec4f));
+			gl.glBindBuffer(eGL_ELEMENT_ARRAY_BUFFER, m_SecondaryArenaIB);
+
+			GLenum arenaTopo[SecondaryMeshArena::eClass_Count] = { eGL_POINTS, eGL_LINES, eGL_TRIANGLES };
+
+			for(int c=0; c < SecondaryMeshArena::eClass_Count; c++)
+			{
+				if(m_SecondaryArena.numIndices[c] == 0)
+					continue;
+
+				gl.glDrawElements(arenaTopo[c], m_SecondaryArena.numIndices[c], eGL_UNSIGNED_INT,
+				                  (const void *)uintptr_t(m_SecondaryArena.firstIndex[c]*sizeof(uint32_t)));
+			}
+		}
+
+		// anything that couldn't be packed is drawn on its own
+		for(size_t i=0; i < m_SecondaryArena.unpacked.size(); i++)
 		{
-			const MeshFormat &fmt = secondaryDraws[i];
+			const MeshFormat &fmt = m_SecondaryArena.unpacked[i];
 
 			if(fmt.buf != ResourceId())
 			{
@@ -32,7 +32,6 @@
 
 #include "maths/vec.h"
 
-#include "jpeg-compressor/jpge.h"
 #include "stb/stb_truetype.h"
 
 #include "data/glsl/debuguniforms.h"
@@ -357,6 +356,10 @@ ReplayCreateStatus GLInitParams::Serialise()
 WrappedOpenGL::WrappedOpenGL(const char *logfile, const GLHookSet &funcs)
 	: m_Real(funcs)
 {
+	// first device/context in a bootstrapped process finishes initialising RenderDoc
+	RenderDoc::Inst().EnsureInitialised();
+	RenderDoc::Inst().EnsureCrashHandler();
+
 	if(RenderDoc::Inst().GetCrashHandler())
 		RenderDoc::Inst().GetCrashHandler()->RegisterMemoryRegion(this, sizeof(WrappedOpenGL));
 
@@ -677,9 +680,24 @@ WrappedOpenGL::WrappedOpenGL(const char *logfile, const GLHookSet &funcs)
 
 	m_FrameCounter = 0;
 
+	RDCEraseEl(m_FrameStats);
+
+	m_ReplayPos = eReplayPos_Unknown;
+	m_ReplayPosFrame = 0;
+	m_ReplayPosEvent = 0;
+
 	m_FrameTimer.Restart();
 
 	m_AppControlledCapture = false;
+	m_CaptureFramesLeft = 0;
+
+	m_MarkerDepth = 0;
+	m_RegionCaptureDepth = -1;
+
+	m_SpillWriter = NULL;
+
+	m_CurrentContextSlot = Threading::AllocateTLSSlot();
+	m_ContextDataGeneration = 0;
 
 	m_TotalTime = m_AvgFrametime = m_MinFrametime = m_MaxFrametime = 0.0;
 
@@ -776,9 +794,14 @@ WrappedOpenGL::WrappedOpenGL(const char *logfile, const GLHookSet &funcs)
 	m_FakeVAO = 0;
 	m_FakeIdxBuf = 0;
 	m_FakeIdxSize = 0;
-		
-	RDCDEBUG("Debug Text enabled - for development! remove before release!");
-	m_pSerialiser->SetDebugText(true);
+
+	m_IndirectArena = 0;
+	m_IndirectArenaSize = m_IndirectArenaUsed = 0;
+
+	m_ShaderCacheDriverHash = 0;
+	m_ReflectionCacheDirty = false;
+	m_ShaderCachesLoaded = false;
+	m_ProgramBinaryCacheEnabled = m_ProgramBinaryCacheDirty = false;
 	
 	m_pSerialiser->SetChunkNameLookup(&GetChunkName);
 
@@ -904,6 +927,7 @@ const char * WrappedOpenGL::GetChunkName(uint32_t idx)
 WrappedOpenGL::~WrappedOpenGL()
 {
 	if(m_FakeIdxBuf) m_Real.glDeleteBuffers(1, &m_FakeIdxBuf);
+	if(m_IndirectArena) m_Real.glDeleteBuffers(1, &m_IndirectArena);
 	if(m_FakeVAO) m_Real.glDeleteVertexArrays(1, &m_FakeVAO);
 	if(m_FakeBB_FBO) m_Real.glDeleteFramebuffers(1, &m_FakeBB_FBO);
 	if(m_FakeBB_Color) m_Real.glDeleteTextures(1, &m_FakeBB_Color);
@@ -913,6 +937,10 @@ WrappedOpenGL::~WrappedOpenGL()
 
 	SAFE_DELETE(m_pSerialiser);
 
+	if(m_ContextRecord)
+		m_ContextRecord->SetSpillWriter(NULL);
+	SAFE_DELETE(m_SpillWriter);
+
 	GetResourceManager()->ReleaseCurrentResource(m_DeviceResourceID);
 	GetResourceManager()->ReleaseCurrentResource(m_ContextResourceID);
 	
@@ -936,14 +964,40 @@ WrappedOpenGL::~WrappedOpenGL()
 		RenderDoc::Inst().GetCrashHandler()->UnregisterMemoryRegion(this);
 }
 
+WrappedOpenGL::CurrentContext *WrappedOpenGL::GetCurrentContext()
+{
+	CurrentContext *cur = (CurrentContext *)Threading::GetTLSValue(m_CurrentContextSlot);
+
+	// like the ID allocator's blocks, these are never freed when a thread exits
+	if(cur == NULL)
+	{
+		cur = new CurrentContext();
+		cur->ctx = NULL;
+		cur->data = NULL;
+		cur->generation = 0;
+		Threading::SetTLSValue(m_CurrentContextSlot, cur);
+	}
+
+	return cur;
+}
+
 void *WrappedOpenGL::GetCtx()
 {
-	return (void *)m_ActiveContexts[Threading::GetCurrentID()].ctx;
+	CurrentContext *cur = (CurrentContext *)Threading::GetTLSValue(m_CurrentContextSlot);
+	return cur ? cur->ctx : NULL;
 }
 
 WrappedOpenGL::ContextData &WrappedOpenGL::GetCtxData()
 {
-	return m_ContextData[GetCtx()];
+	CurrentContext *cur = GetCurrentContext();
+
+	if(cur->data == NULL || cur->generation != m_ContextDataGeneration)
+	{
+		cur->data = &m_ContextData[cur->ctx];
+		cur->generation = m_ContextDataGeneration;
+	}
+
+	return *cur->data;
 }
 
 // defined in gl_<platform>_hooks.cpp
@@ -977,6 +1031,9 @@ void WrappedOpenGL::DeleteContext(void *contextHandle)
 	}
 
 	m_ContextData.erase(contextHandle);
+
+	// any thread could have a pointer to the erased data cached
+	m_ContextDataGeneration++;
 }
 
 void WrappedOpenGL::ContextData::UnassociateWindow(void *wndHandle)
@@ -1020,6 +1077,11 @@ void WrappedOpenGL::RegisterContext(GLWindowingData winData, void *shareContext,
 void WrappedOpenGL::ActivateContext(GLWindowingData winData)
 {
 	m_ActiveContexts[Threading::GetCurrentID()] = winData;
+
+	CurrentContext *cur = GetCurrentContext();
+	cur->ctx = winData.ctx;
+	cur->data = NULL;
+
 	if(winData.ctx)
 		m_DefaultContexts[Threading::GetCurrentID()] = winData;
 
@@ -1910,6 +1972,8 @@ void WrappedOpenGL::ReplaceResource(ResourceId from, ResourceId to)
 
 void WrappedOpenGL::RemoveReplacement(ResourceId id)
 {
+	m_ReplayPos = eReplayPos_Unknown;
+
 	// do actual removal
 	GetResourceManager()->RemoveReplacement(id);
 
@@ -2019,6 +2083,12 @@ void WrappedOpenGL::SwapBuffers(void *windowHandle)
 		m_TotalTime += m_FrameTimes.back();
 		m_FrameTimer.Restart();
 
+		m_FrameStats.NumFrames = 1;
+		m_FrameStats.LastFrameNumber = m_FrameCounter;
+		m_FrameStats.TotalFrameTime = m_FrameStats.MaxFrameTime = m_FrameTimes.back();
+		RenderDoc::Inst().AddFrameStatistics(m_FrameStats);
+		RDCEraseEl(m_FrameStats);
+
 		// update every second
 		if(m_TotalTime > 1000.0)
 		{
@@ -2186,22 +2256,44 @@ void WrappedOpenGL::SwapBuffers(void *windowHandle)
 
 	// kill any current capture that isn't application defined
 	if(m_State == WRITING_CAPFRAME && !m_AppControlledCapture)
-		EndFrameCapture(this, windowHandle);
+	{
+		// a multi-frame capture just marks the end of this frame in the same chunk stream
+		// and carries on, so all the frames share the initial contents
+		if(m_CaptureFramesLeft > 1)
+		{
+			m_CaptureFramesLeft--;
+			ContextEndFrame();
+		}
+		else
+		{
+			EndFrameCapture(this, windowHandle);
+		}
+	}
 	
 	// for now, only allow one captured frame at all
 	if(!m_FrameRecord.empty())
 		return;
 	
-	if(RenderDoc::Inst().ShouldTriggerCapture(m_FrameCounter) && m_State == WRITING_IDLE)
+	uint32_t numFrames = RenderDoc::Inst().ShouldTriggerCapture(m_FrameCounter);
+
+	// frames aren't recorded ahead of time for retro capture on GL, so the best we can do is
+	// capture the next one
+	if(RenderDoc::Inst().ShouldSavePreviousFrame())
+		numFrames = RDCMAX(numFrames, 1U);
+
+	if(numFrames > 0 && m_State == WRITING_IDLE)
 	{
 		StartFrameCapture(this, windowHandle);
 
 		m_AppControlledCapture = false;
+		m_CaptureFramesLeft = numFrames;
 	}
 }
 
 void WrappedOpenGL::StartFrameCapture(void *dev, void *wnd)
 {
+	SCOPED_PROFILE("Capture begin");
+
 	m_State = WRITING_CAPFRAME;
 
 	m_AppControlledCapture = true;
@@ -2228,114 +2320,191 @@ void WrappedOpenGL::StartFrameCapture(void *dev, void *wnd)
 	AttemptCapture();
 	BeginCaptureFrame();
 
+	// the capture header is kept in the record, everything after it can be
+	// spilled since the context's chunks are written out contiguously.
+	m_SpillWriter = RenderDoc::Inst().OpenSpillWriter(m_FrameCounter);
+	if(m_SpillWriter)
+		m_ContextRecord->SetSpillWriter(m_SpillWriter);
+
 	if(switchedContext)
 		MakeContextCurrent(prevctx);
 
 	RDCLOG("Starting capture, frame %u", m_FrameCounter);
 }
 
-bool WrappedOpenGL::EndFrameCapture(void *dev, void *wnd)
+void WrappedOpenGL::GetResourceMemoryUsage(vector<ResourceMemoryUsage> &usage)
 {
-	if(m_State != WRITING_CAPFRAME) return true;
-	
-	CaptureFailReason reason = CaptureSucceeded;
+	GetResourceManager()->GetResourceMemoryUsage(usage);
+}
 
-	//if(HasSuccessfulCapture(reason))
+void WrappedOpenGL::BeginThumbnailReadback(ThumbnailReadback &th)
+{
+	if(!m_Real.glGetIntegerv || !m_Real.glReadBuffer || !m_Real.glBindFramebuffer || !m_Real.glBindBuffer ||
+		!m_Real.glReadPixels || !m_Real.glBlitFramebuffer || !m_Real.glGenRenderbuffers || !m_Real.glMapBufferRange)
+		return;
+
+	const uint32_t maxSize = 1024;
+
+	uint32_t width = m_InitParams.width;
+	uint32_t height = m_InitParams.height;
+
+	if(width == 0 || height == 0)
+		return;
+
+	float aspect = float(width)/float(height);
+
+	th.width = RDCMIN(maxSize, width);
+	th.width &= ~0x7; // align down to multiple of 8
+	th.height = uint32_t(float(th.width)/aspect);
+
+	if(th.width == 0 || th.height == 0)
+		return;
+
+	RDCGLenum prevReadBuf = eGL_BACK;
+	GLint prevReadFBO = 0;
+	GLint prevDrawFBO = 0;
+	GLint prevRB = 0;
+	GLint packBufBind = 0;
+	GLint prevPackRowLen = 0;
+	GLint prevPackSkipRows = 0;
+	GLint prevPackSkipPixels = 0;
+	GLint prevPackAlignment = 0;
+	m_Real.glGetIntegerv(eGL_READ_BUFFER, (GLint *)&prevReadBuf);
+	m_Real.glGetIntegerv(eGL_READ_FRAMEBUFFER_BINDING, &prevReadFBO);
+	m_Real.glGetIntegerv(eGL_DRAW_FRAMEBUFFER_BINDING, &prevDrawFBO);
+	m_Real.glGetIntegerv(eGL_RENDERBUFFER_BINDING, &prevRB);
+	m_Real.glGetIntegerv(eGL_PIXEL_PACK_BUFFER_BINDING, &packBufBind);
+	m_Real.glGetIntegerv(eGL_PACK_ROW_LENGTH, &prevPackRowLen);
+	m_Real.glGetIntegerv(eGL_PACK_SKIP_ROWS, &prevPackSkipRows);
+	m_Real.glGetIntegerv(eGL_PACK_SKIP_PIXELS, &prevPackSkipPixels);
+	m_Real.glGetIntegerv(eGL_PACK_ALIGNMENT, &prevPackAlignment);
+
+	// the scissor test applies to blits
+	GLboolean scissor = m_Real.glIsEnabled(eGL_SCISSOR_TEST);
+	m_Real.glDisable(eGL_SCISSOR_TEST);
+
+	m_Real.glGenFramebuffers(2, th.fbo);
+	m_Real.glGenRenderbuffers(2, th.rb);
+	m_Real.glGenBuffers(1, &th.pbo);
+
+	GLuint srcFBO = 0;
+
+	m_Real.glBindFramebuffer(eGL_READ_FRAMEBUFFER, 0);
+	m_Real.glReadBuffer(eGL_BACK);
+
+	// a multisampled framebuffer can't be blitted with scaling, so resolve it at full size first
+	if(m_InitParams.multiSamples > 1)
 	{
-		RDCLOG("Finished capture, Frame %u", m_FrameCounter);
+		m_Real.glBindRenderbuffer(eGL_RENDERBUFFER, th.rb[1]);
+		m_Real.glRenderbufferStorage(eGL_RENDERBUFFER, eGL_RGBA8, width, height);
 
-		ContextEndFrame();
-		FinishCapture();
+		m_Real.glBindFramebuffer(eGL_DRAW_FRAMEBUFFER, th.fbo[1]);
+		m_Real.glFramebufferRenderbuffer(eGL_DRAW_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, eGL_RENDERBUFFER, th.rb[1]);
 
-		const uint32_t maxSize = 1024;
+		m_Real.glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, eGL_NEAREST);
 
-		byte *thpixels = NULL;
-		uint32_t thwidth = 0;
-		uint32_t thheight = 0;
+		srcFBO = th.fbo[1];
 
-		if(m_Real.glGetIntegerv && m_Real.glReadBuffer && m_Real.glBindFramebuffer && m_Real.glBindBuffer && m_Real.glReadPixels)
-		{
-			RDCGLenum prevReadBuf = eGL_BACK;
-			GLint prevBuf = 0;
-			GLint packBufBind = 0;
-			GLint prevPackRowLen = 0;
-			GLint prevPackSkipRows = 0;
-			GLint prevPackSkipPixels = 0;
-			GLint prevPackAlignment = 0;
-			m_Real.glGetIntegerv(eGL_READ_BUFFER, (GLint *)&prevReadBuf);
-			m_Real.glGetIntegerv(eGL_READ_FRAMEBUFFER_BINDING, &prevBuf);
-			m_Real.glGetIntegerv(eGL_PIXEL_PACK_BUFFER_BINDING, &packBufBind);
-			m_Real.glGetIntegerv(eGL_PACK_ROW_LENGTH, &prevPackRowLen);
-			m_Real.glGetIntegerv(eGL_PACK_SKIP_ROWS, &prevPackSkipRows);
-			m_Real.glGetIntegerv(eGL_PACK_SKIP_PIXELS, &prevPackSkipPixels);
-			m_Real.glGetIntegerv(eGL_PACK_ALIGNMENT, &prevPackAlignment);
-
-			m_Real.glBindFramebuffer(eGL_READ_FRAMEBUFFER, 0);
-			m_Real.glReadBuffer(eGL_BACK);
-			m_Real.glBindBuffer(eGL_PIXEL_PACK_BUFFER, 0);
-			m_Real.glPixelStorei(eGL_PACK_ROW_LENGTH, 0);
-			m_Real.glPixelStorei(eGL_PACK_SKIP_ROWS, 0);
-			m_Real.glPixelStorei(eGL_PACK_SKIP_PIXELS, 0);
-			m_Real.glPixelStorei(eGL_PACK_ALIGNMENT, 1);
-
-			thwidth = m_InitParams.width;
-			thheight = m_InitParams.height;
-
-			thpixels = new byte[thwidth*thheight*3];
-
-			m_Real.glReadPixels(0, 0, thwidth, thheight, eGL_RGB, eGL_UNSIGNED_BYTE, thpixels);
-
-			for(uint32_t y=0; y <= thheight/2; y++)
-			{
-				for(uint32_t x=0; x < thwidth; x++)
-				{
-					byte save[3];
-					save[0] = thpixels[y*(thwidth*3) + x*3 + 0];
-					save[1] = thpixels[y*(thwidth*3) + x*3 + 1];
-					save[2] = thpixels[y*(thwidth*3) + x*3 + 2];
-
-					thpixels[y*(thwidth*3) + x*3 + 0] = thpixels[(thheight-1-y)*(thwidth*3) + x*3 + 0];
-					thpixels[y*(thwidth*3) + x*3 + 1] = thpixels[(thheight-1-y)*(thwidth*3) + x*3 + 1];
-					thpixels[y*(thwidth*3) + x*3 + 2] = thpixels[(thheight-1-y)*(thwidth*3) + x*3 + 2];
-
-					thpixels[(thheight-1-y)*(thwidth*3) + x*3 + 0] = save[0];
-					thpixels[(thheight-1-y)*(thwidth*3) + x*3 + 1] = save[1];
-					thpixels[(thheight-1-y)*(thwidth*3) + x*3 + 2] = save[2];
-				}
-			}
+		m_Real.glBindFramebuffer(eGL_READ_FRAMEBUFFER, srcFBO);
+		m_Real.glReadBuffer(eGL_COLOR_ATTACHMENT0);
+	}
 
-			m_Real.glBindBuffer(eGL_PIXEL_PACK_BUFFER, packBufBind);
-			m_Real.glBindFramebuffer(eGL_READ_FRAMEBUFFER, prevBuf);
-			m_Real.glReadBuffer(prevReadBuf);
-			m_Real.glPixelStorei(eGL_PACK_ROW_LENGTH, prevPackRowLen);
-			m_Real.glPixelStorei(eGL_PACK_SKIP_ROWS, prevPackSkipRows);
-			m_Real.glPixelStorei(eGL_PACK_SKIP_PIXELS, prevPackSkipPixels);
-			m_Real.glPixelStorei(eGL_PACK_ALIGNMENT, prevPackAlignment);
-		}
+	m_Real.glBindRenderbuffer(eGL_RENDERBUFFER, th.rb[0]);
+	m_Real.glRenderbufferStorage(eGL_RENDERBUFFER, eGL_RGBA8, th.width, th.height);
 
-		byte *jpgbuf = NULL;
-		int len = thwidth*thheight;
+	m_Real.glBindFramebuffer(eGL_DRAW_FRAMEBUFFER, th.fbo[0]);
+	m_Real.glFramebufferRenderbuffer(eGL_DRAW_FRAMEBUFFER, eGL_COLOR_ATTACHMENT0, eGL_RENDERBUFFER, th.rb[0]);
 
-		if(len > 0)
-		{
-			jpgbuf = new byte[len];
+	// flip in the blit, so that the rows are read back top first as the jpg wants them
+	m_Real.glBlitFramebuffer(0, 0, width, height, 0, th.height, th.width, 0, GL_COLOR_BUFFER_BIT, eGL_LINEAR);
 
-			jpge::params p;
+	m_Real.glBindFramebuffer(eGL_READ_FRAMEBUFFER, th.fbo[0]);
+	m_Real.glReadBuffer(eGL_COLOR_ATTACHMENT0);
 
-			p.m_quality = 40;
+	m_Real.glBindBuffer(eGL_PIXEL_PACK_BUFFER, th.pbo);
+	m_Real.glBufferData(eGL_PIXEL_PACK_BUFFER, th.width*th.height*3, NULL, eGL_STREAM_READ);
+	m_Real.glPixelStorei(eGL_PACK_ROW_LENGTH, 0);
+	m_Real.glPixelStorei(eGL_PACK_SKIP_ROWS, 0);
+	m_Real.glPixelStorei(eGL_PACK_SKIP_PIXELS, 0);
+	m_Real.glPixelStorei(eGL_PACK_ALIGNMENT, 1);
 
-			bool success = jpge::compress_image_to_jpeg_file_in_memory(jpgbuf, len, thwidth, thheight, 3, thpixels, p);
+	// into the pack buffer, so this doesn't wait for the GPU
+	m_Real.glReadPixels(0, 0, th.width, th.height, eGL_RGB, eGL_UNSIGNED_BYTE, NULL);
 
-			if(!success)
-			{
-				RDCERR("Failed to compress to jpg");
-				SAFE_DELETE_ARRAY(jpgbuf);
-				thwidth = 0;
-				thheight = 0;
-			}
-		}
+	if(scissor)
+		m_Real.glEnable(eGL_SCISSOR_TEST);
+
+	m_Real.glBindRenderbuffer(eGL_RENDERBUFFER, prevRB);
+	m_Real.glBindBuffer(eGL_PIXEL_PACK_BUFFER, packBufBind);
+	m_Real.glBindFramebuffer(eGL_DRAW_FRAMEBUFFER, prevDrawFBO);
+	m_Real.glBindFramebuffer(eGL_READ_FRAMEBUFFER, prevReadFBO);
+	m_Real.glReadBuffer(prevReadBuf);
+	m_Real.glPixelStorei(eGL_PACK_ROW_LENGTH, prevPackRowLen);
+	m_Real.glPixelStorei(eGL_PACK_SKIP_ROWS, prevPackSkipRows);
+	m_Real.glPixelStorei(eGL_PACK_SKIP_PIXELS, prevPackSkipPixels);
+	m_Real.glPixelStorei(eGL_PACK_ALIGNMENT, prevPackAlignment);
+}
+
+byte *WrappedOpenGL::EndThumbnailReadback(ThumbnailReadback &th)
+{
+	if(th.pbo == 0)
+		return NULL;
+
+	size_t size = th.width*th.height*3;
+
+	byte *ret = NULL;
+
+	GLint packBufBind = 0;
+	m_Real.glGetIntegerv(eGL_PIXEL_PACK_BUFFER_BINDING, &packBufBind);
+
+	m_Real.glBindBuffer(eGL_PIXEL_PACK_BUFFER, th.pbo);
 
-		Serialiser *m_pFileSerialiser = RenderDoc::Inst().OpenWriteSerialiser(m_FrameCounter, &m_InitParams, jpgbuf, len, thwidth, thheight);
+	byte *mapped = (byte *)m_Real.glMapBufferRange(eGL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)size, GL_MAP_READ_BIT);
+
+	if(mapped)
+	{
+		ret = new byte[size];
+		memcpy(ret, mapped, size);
+
+		m_Real.glUnmapBuffer(eGL_PIXEL_PACK_BUFFER);
+	}
+	else
+	{
+		RDCERR("Couldn't map thumbnail readback buffer");
+	}
+
+	m_Real.glBindBuffer(eGL_PIXEL_PACK_BUFFER, packBufBind);
+
+	m_Real.glDeleteBuffers(1, &th.pbo);
+	m_Real.glDeleteRenderbuffers(2, th.rb);
+	m_Real.glDeleteFramebuffers(2, th.fbo);
+
+	th.pbo = 0;
+
+	return ret;
+}
+
+bool WrappedOpenGL::EndFrameCapture(void *dev, void *wnd)
+{
+	if(m_State != WRITING_CAPFRAME) return true;
+
+	SCOPED_PROFILE("Capture end");
+	
+	CaptureFailReason reason = CaptureSucceeded;
+
+	//if(HasSuccessfulCapture(reason))
+	{
+		RDCLOG("Finished capture, Frame %u", m_FrameCounter);
+
+		ContextEndFrame();
+		FinishCapture();
+
+		m_ContextRecord->SetSpillWriter(NULL);
+
+		ThumbnailReadback thumb;
+		BeginThumbnailReadback(thumb);
+
+		Serialiser *m_pFileSerialiser = RenderDoc::Inst().OpenWriteSerialiser(m_FrameCounter, &m_InitParams);
 
 		{
 			SCOPED_SERIALISE_CONTEXT(DEVICE_INIT);
@@ -2352,6 +2521,8 @@ bool WrappedOpenGL::EndFrameCapture(void *dev, void *wnd)
 
 		GetResourceManager()->InsertInitialContentsChunks(m_pFileSerialiser);
 
+		GetResourceManager()->ReleaseTextureReadbacks();
+
 		RDCDEBUG("Creating Capture Scope");	
 
 		{
@@ -2369,8 +2540,9 @@ bool WrappedOpenGL::EndFrameCapture(void *dev, void *wnd)
 
 			RDCDEBUG("Accumulating context resource list");	
 
-			map<int32_t, Chunk *> recordlist;
+			ResourceRecord::ChunkList recordlist;
 			record->Insert(recordlist);
+			ResourceRecord::SortChunks(recordlist);
 
 			RDCDEBUG("Flushing %u records to file serialiser", (uint32_t)recordlist.size());	
 
@@ -2380,11 +2552,12 @@ bool WrappedOpenGL::EndFrameCapture(void *dev, void *wnd)
 			RDCDEBUG("Done");	
 		}
 
-		m_CurFileSize += m_pFileSerialiser->FlushToDisk();
+		byte *thpixels = EndThumbnailReadback(thumb);
 
-		RenderDoc::Inst().SuccessfullyWrittenLog();
+		m_CurFileSize += RenderDoc::Inst().WriteCapture(m_pFileSerialiser, m_SpillWriter, thpixels, thumb.width, thumb.height);
 
-		SAFE_DELETE(m_pFileSerialiser);
+		m_pFileSerialiser = NULL;
+		m_SpillWriter = NULL;
 
 		m_State = WRITING_IDLE;
 
@@ -2429,18 +2602,7 @@ void WrappedOpenGL::ContextEndFrame()
 	m_pSerialiser->Serialise("HasCallstack", HasCallstack);	
 
 	if(HasCallstack)
-	{
-		Callstack::Stackwalk *call = Callstack::Collect();
-
-		RDCASSERT(call->NumLevels() < 0xff);
-
-		size_t numLevels = call->NumLevels();
-		uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-		m_pSerialiser->Serialise("callstack", stack, numLevels);
-
-		delete call;
-	}
+		m_pSerialiser->SerialiseCallstack();
 
 	m_ContextRecord->AddChunk(scope.Get());
 }
@@ -2459,8 +2621,12 @@ void WrappedOpenGL::AttemptCapture()
 {
 	m_State = WRITING_CAPFRAME;
 
+	m_pSerialiser->SetChunkArena(true);
+
 	m_DebugMessages.clear();
 
+	m_PendingSubData.data.clear();
+
 	{
 		RDCDEBUG("GL Context %llu Attempting capture", GetContextResourceID());
 
@@ -2512,6 +2678,8 @@ void WrappedOpenGL::FinishCapture()
 {
 	m_State = WRITING_IDLE;
 
+	m_pSerialiser->SetChunkArena(false);
+
 	m_DebugMessages.clear();
 
 	//m_SuccessfulCapture = false;
@@ -2551,37 +2719,13 @@ void WrappedOpenGL::Serialise_DebugMessages()
 		m_DebugMessages.clear();
 	}
 
-	SERIALISE_ELEMENT(bool, HasCallstack, RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws != 0);
+	SERIALISE_ELEMENT(bool, HasCallstack, RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws != 0 &&
+		RenderDoc::Inst().ShouldCollectCallstack(m_pSerialiser->GetChunkName()));
 
 	if(HasCallstack)
-	{
-		if(m_State >= WRITING)
-		{
-			Callstack::Stackwalk *call = Callstack::Collect();
-
-			RDCASSERT(call->NumLevels() < 0xff);
-
-			size_t numLevels = call->NumLevels();
-			uint64_t *stack = (uint64_t *)call->GetAddrs();
+		m_pSerialiser->SerialiseCallstack();
 
-			m_pSerialiser->Serialise("callstack", stack, numLevels);
-
-			delete call;
-		}
-		else
-		{
-			size_t numLevels = 0;
-			uint64_t *stack = NULL;
-
-			m_pSerialiser->Serialise("callstack", stack, numLevels);
-
-			m_pSerialiser->SetCallstack(stack, numLevels);
-
-			SAFE_DELETE_ARRAY(stack);
-		}
-	}
-
-	SERIALISE_ELEMENT(uint32_t, NumMessages, (uint32_t)debugMessages.size());
+	SERIALISE_ELEMENT_VARINT(uint32_t, NumMessages, (uint32_t)debugMessages.size());
 
 	for(uint32_t i=0; i < NumMessages; i++)
 	{
@@ -2611,6 +2755,37 @@ void WrappedOpenGL::Serialise_DebugMessages()
 	}
 }
 
+GLuint WrappedOpenGL::GetUnpackBuffer()
+{
+	if(m_State >= WRITING)
+	{
+		GLResourceRecord *record = GetCtxData().m_BufferRecord[BufferIdx(eGL_PIXEL_UNPACK_BUFFER)];
+		return record ? record->Resource.name : 0;
+	}
+
+	GLuint unpackbuf = 0;
+	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, (GLint *)&unpackbuf);
+	return unpackbuf;
+}
+
+void WrappedOpenGL::MarkHighTraffic(GLResourceRecord *record)
+{
+	// chunks that only update the contents of an existing texture or buffer
+	static const uint32_t contentsUpdates[] = {
+		TEXSUBIMAGE1D, TEXSUBIMAGE2D, TEXSUBIMAGE3D,
+		TEXSUBIMAGE1D_COMPRESSED, TEXSUBIMAGE2D_COMPRESSED, TEXSUBIMAGE3D_COMPRESSED,
+		BUFFERSUBDATA, COPYBUFFERSUBDATA,
+	};
+
+	m_HighTrafficResources.insert(record->GetResourceID());
+	GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+
+	size_t numDeleted = record->DeleteChunksOfTypes(contentsUpdates, ARRAY_COUNT(contentsUpdates));
+
+	if(numDeleted > 0)
+		RDCDEBUG("Dropped %u contents updates for high traffic resource %llu", (uint32_t)numDeleted, record->GetResourceID());
+}
+
 bool WrappedOpenGL::RecordUpdateCheck(GLResourceRecord *record)
 {
 	// if nothing is bound, don't serialise chunk
@@ -2704,7 +2879,16 @@ void WrappedOpenGL::ReadLogInitialisation()
 	uint64_t lastFrame = 0;
 	uint64_t firstFrame = 0;
 
-	m_pSerialiser->SetDebugText(true);
+	// the initialisation chunks are only ever read once, so there's no point
+	// generating debug text for them. It's only enabled below for the frame's
+	// events, where it provides the event descriptions.
+	m_pSerialiser->SetDebugText(false);
+
+	// initial contents are created on the first replay instead, so the frame's events and
+	// resources are available as soon as the chunks have been read
+	GetResourceManager()->SetDeferInitialStates(true);
+
+	LoadShaderCaches();
 
 	m_pSerialiser->Rewind();
 
@@ -2719,13 +2903,25 @@ void WrappedOpenGL::ReadLogInitialisation()
 			if(firstFrame == 0)
 				firstFrame = m_pSerialiser->GetOffset();
 
-			// skip this chunk
+			// skip this chunk, but note which resources it needs initial contents for
+			// so that we don't create any that would just be thrown away.
 			m_pSerialiser->PushContext(NULL, CAPTURE_SCOPE, false);
+
+			uint64_t scopeStart = m_pSerialiser->GetOffset();
+
+			uint32_t FrameNumber = 0;
+			m_pSerialiser->Serialise("FrameNumber", FrameNumber);
+			GetResourceManager()->PeekInitialContentsNeeded();
+
+			m_pSerialiser->SetOffset(scopeStart);
 			m_pSerialiser->SkipCurrentChunk();
 			m_pSerialiser->PopContext(NULL, CAPTURE_SCOPE);
 		}
 	}
 
+	// texture data may be stored apart from the initial contents, possibly in earlier logs
+	GetResourceManager()->LoadInitialContentsData();
+
 	m_pSerialiser->Rewind();
 
 	int chunkIdx = 0;
@@ -2760,9 +2956,13 @@ void WrappedOpenGL::ReadLogInitialisation()
 
 		if(context == CAPTURE_SCOPE)
 		{
+			// this read builds the frame's events and drawcalls, which can read back buffers
+			// (e.g. indirect arguments), so apply everything but the deferred textures first.
 			GetResourceManager()->ApplyInitialContents();
 
+			m_pSerialiser->SetDebugText(true);
 			ContextReplayLog(READING, 0, 0, false);
+			m_pSerialiser->SetDebugText(false);
 		}
 
 		uint64_t offset2 = m_pSerialiser->GetOffset();
@@ -2796,6 +2996,10 @@ void WrappedOpenGL::ReadLogInitialisation()
 				);
 	}
 
+	GetResourceManager()->SetDeferInitialStates(false);
+
+	SaveShaderCaches();
+
 	RDCDEBUG("Allocating %llu persistant bytes of memory for the log.", m_pSerialiser->GetSize() - firstFrame);
 	
 	m_pSerialiser->SetDebugText(false);
@@ -3598,16 +3802,7 @@ void WrappedOpenGL::ProcessChunk(uint64_t offset, GLChunkType context)
 			m_pSerialiser->Serialise("HasCallstack", HasCallstack);	
 
 			if(HasCallstack)
-			{
-				size_t numLevels = 0;
-				uint64_t *stack = NULL;
-
-				m_pSerialiser->Serialise("callstack", stack, numLevels);
-
-				m_pSerialiser->SetCallstack(stack, numLevels);
-
-				SAFE_DELETE_ARRAY(stack);
-			}
+				m_pSerialiser->SerialiseCallstack();
 
 			if(m_State == READING)
 			{
@@ -3624,8 +3819,22 @@ void WrappedOpenGL::ProcessChunk(uint64_t offset, GLChunkType context)
 	default:
 		// ignore system chunks
 		if((int)context == (int)INITIAL_CONTENTS)
-			GetResourceManager()->Serialise_InitialState(GLResource(MakeNullResource));
-		else if((int)context < (int)FIRST_CHUNK_ID)
+		{
+			uint64_t start = m_pSerialiser->GetOffset();
+
+			// peek at the resource the chunk is for, to see if it can be deferred
+			ResourceId Id = ResourceId();
+			m_pSerialiser->Serialise("Id", Id);
+			m_pSerialiser->SetOffset(start);
+
+			if(GetResourceManager()->DeferInitialState(offset, Id) ||
+			   !GetResourceManager()->Serialise_InitialState(GLResource(MakeNullResource)))
+			{
+				m_pSerialiser->SetOffset(start);
+				m_pSerialiser->SkipCurrentChunk();
+			}
+		}
+		else if((int)context < (int)FIRST_CHUNK_ID || (int)context == (int)INITIAL_CONTENTS_DATA)
 			m_pSerialiser->SkipCurrentChunk();
 		else
 			RDCERR("Unrecognised Chunk type %d", context);
@@ -3633,6 +3842,28 @@ void WrappedOpenGL::ProcessChunk(uint64_t offset, GLChunkType context)
 	}
 }
 
+void WrappedOpenGL::CreateDeferredInitialContents()
+{
+	if(!GetResourceManager()->HasDeferredInitialStates())
+		return;
+
+	// the main serialiser only keeps the frame itself in memory, so read the deferred
+	// chunks through another one on the same log
+	Serialiser ser(m_pSerialiser->GetFilename(), Serialiser::READING, false);
+	ser.SetDebugText(false);
+
+	if(ser.HasError())
+	{
+		RDCERR("Couldn't reopen '%s' to create initial contents", m_pSerialiser->GetFilename());
+		GetResourceManager()->CreateDeferredInitialStates(NULL);
+		return;
+	}
+
+	SCOPED_TIMER("deferred initial contents");
+
+	GetResourceManager()->CreateDeferredInitialStates(&ser);
+}
+
 void WrappedOpenGL::ContextReplayLog(LogState readType, uint32_t startEventID, uint32_t endEventID, bool partial)
 {
 	m_State = readType;
@@ -3646,7 +3877,7 @@ void WrappedOpenGL::ContextReplayLog(LogState readType, uint32_t startEventID, u
 	
 	if(m_State == EXECUTING && !partial)
 	{
-		for(size_t i=0; i < 8; i++)
+		for(size_t i=0; i < ARRAY_COUNT(m_ActiveQueries); i++)
 		{
 			GLenum q = QueryEnum(i);
 			if(q == eGL_NONE) break;
@@ -3714,16 +3945,22 @@ void WrappedOpenGL::ContextReplayLog(LogState readType, uint32_t startEventID, u
 		
 		RenderDoc::Inst().SetProgress(FileInitialRead, float(offset)/float(m_pSerialiser->GetSize()));
 		
-		// for now just abort after capture scope. Really we'd need to support multiple frames
-		// but for now this will do.
-		if(chunktype == CONTEXT_CAPTURE_FOOTER)
+		// a capture of several frames has a footer after each one, with the frames following
+		// on in the same stream. Only the last footer ends the context's chunks.
+		if(m_pSerialiser->AtEnd())
+		{
+			if(chunktype != CONTEXT_CAPTURE_FOOTER)
+				RDCERR("Chunk stream ended without a frame footer, at event %u", m_CurEventID);
 			break;
+		}
 		
 		m_CurEventID++;
 	}
 
 	if(m_State == READING)
 	{
+		ApplyIndirectFixups();
+
 		GetFrameRecord().back().drawcallList = m_ParentDrawcall.Bake();
 		GetFrameRecord().back().frameInfo.debugMessages = GetDebugMessages();
 		
@@ -4131,6 +4368,138 @@ void WrappedOpenGL::AddDrawcall(FetchDrawcall d, bool hasEvents)
 		RDCERR("Somehow lost drawcall stack!");
 }
 
+void WrappedOpenGL::QueueIndirectFixup(IndirectFixupType type, GLintptr offset, const string &namePrefix)
+{
+	GLsizeiptr size = (type == eIndirectFixup_Arrays || type == eIndirectFixup_MultiArrays)
+	                  ? sizeof(DrawArraysIndirectCommand)
+	                  : sizeof(DrawElementsIndirectCommand);
+
+	if(m_IndirectArenaUsed + size > m_IndirectArenaSize)
+	{
+		GLsizeiptr newSize = RDCMAX(m_IndirectArenaSize*2, (GLsizeiptr)64*1024);
+
+		GLuint newArena = 0;
+		m_Real.glGenBuffers(1, &newArena);
+		m_Real.glNamedBufferDataEXT(newArena, newSize, NULL, eGL_STREAM_READ);
+
+		if(m_IndirectArena)
+		{
+			m_Real.glNamedCopyBufferSubDataEXT(m_IndirectArena, newArena, 0, 0, m_IndirectArenaUsed);
+			m_Real.glDeleteBuffers(1, &m_IndirectArena);
+		}
+
+		m_IndirectArena = newArena;
+		m_IndirectArenaSize = newSize;
+	}
+
+	GLuint indirectBuf = 0;
+	m_Real.glGetIntegerv(eGL_DRAW_INDIRECT_BUFFER_BINDING, (GLint *)&indirectBuf);
+
+	IndirectDrawFixup fixup;
+	fixup.eventID = m_CurEventID;
+	fixup.type = type;
+	fixup.arenaOffset = m_IndirectArenaUsed;
+	fixup.namePrefix = namePrefix;
+
+	if(indirectBuf)
+		m_Real.glNamedCopyBufferSubDataEXT(indirectBuf, m_IndirectArena, offset, m_IndirectArenaUsed, size);
+	else
+		fixup.arenaOffset = -1;
+
+	m_IndirectArenaUsed += size;
+
+	m_IndirectFixups.push_back(fixup);
+}
+
+void WrappedOpenGL::ApplyIndirectFixups()
+{
+	if(m_IndirectFixups.empty())
+		return;
+
+	// one readback for the whole frame
+	vector<byte> data((size_t)m_IndirectArenaUsed);
+	m_Real.glGetNamedBufferSubDataEXT(m_IndirectArena, 0, m_IndirectArenaUsed, &data[0]);
+
+	// queued in event order already, but the lookup relies on it
+	std::sort(m_IndirectFixups.begin(), m_IndirectFixups.end());
+
+	ApplyIndirectFixups(m_ParentDrawcall, &data[0]);
+
+	m_IndirectFixups.clear();
+
+	m_Real.glDeleteBuffers(1, &m_IndirectArena);
+	m_IndirectArena = 0;
+	m_IndirectArenaSize = m_IndirectArenaUsed = 0;
+}
+
+void WrappedOpenGL::ApplyIndirectFixups(DrawcallTreeNode &node, const byte *data)
+{
+	for(size_t c=0; c < node.children.size(); c++)
+	{
+		FetchDrawcall &draw = node.children[c].draw;
+
+		IndirectDrawFixup search;
+		search.eventID = draw.eventID;
+
+		auto it = std::lower_bound(m_IndirectFixups.begin(), m_IndirectFixups.end(), search);
+
+		if(it != m_IndirectFixups.end() && it->eventID == draw.eventID)
+		{
+			// no indirect buffer was bound, the draw had no valid parameters
+			DrawElementsIndirectCommand empty = {0};
+			const void *params = it->arenaOffset >= 0 ? (const void *)(data + it->arenaOffset) : (const void *)&empty;
+
+			if(it->type == eIndirectFixup_Arrays || it->type == eIndirectFixup_MultiArrays)
+			{
+				const DrawArraysIndirectCommand *p = (const DrawArraysIndirectCommand *)params;
+
+				draw.numIndices = p->count;
+				draw.numInstances = p->instanceCount;
+				draw.vertexOffset = p->first;
+				draw.instanceOffset = p->baseInstance;
+
+				if(it->type == eIndirectFixup_Arrays)
+					draw.name = it->namePrefix +
+								ToStr::Get(p->first) + ", " +
+								ToStr::Get(p->count) + ", " +
+								ToStr::Get(p->instanceCount) + ", " +
+								ToStr::Get(p->baseInstance) + ">)";
+				else
+					draw.name = it->namePrefix +
+								ToStr::Get(p->count) + ", " +
+								ToStr::Get(p->instanceCount) + ", " +
+								ToStr::Get(p->first) + ", " +
+								ToStr::Get(p->baseInstance) + ">)";
+			}
+			else
+			{
+				const DrawElementsIndirectCommand *p = (const DrawElementsIndirectCommand *)params;
+
+				draw.numIndices = p->count;
+				draw.numInstances = p->instanceCount;
+				draw.indexOffset = p->firstIndex;
+				draw.vertexOffset = p->baseVertex;
+				draw.instanceOffset = p->baseInstance;
+
+				if(it->type == eIndirectFixup_Elements)
+					draw.name = it->namePrefix +
+								ToStr::Get(p->count) + ", " +
+								ToStr::Get(p->instanceCount) + ", " +
+								ToStr::Get(p->baseVertex) + ", " +
+								ToStr::Get(p->baseInstance) + ">)";
+				else
+					draw.name = it->namePrefix +
+								ToStr::Get(p->count) + ", " +
+								ToStr::Get(p->instanceCount) + ", " +
+								ToStr::Get(p->firstIndex) + ", " +
+								ToStr::Get(p->baseInstance) + ">)";
+			}
+		}
+
+		ApplyIndirectFixups(node.children[c], data);
+	}
+}
+
 void WrappedOpenGL::AddEvent(GLChunkType type, string description, ResourceId ctx)
 {
 	if(ctx == ResourceId()) ctx = GetResourceManager()->GetOriginalID(m_ContextResourceID);
@@ -4167,6 +4536,17 @@ FetchAPIEvent WrappedOpenGL::GetEvent(uint32_t eventID)
 	return m_Events[0];
 }
 
+uint32_t WrappedOpenGL::GetNextEventID(uint32_t eventID)
+{
+	for(size_t i=0; i < m_Events.size(); i++)
+	{
+		if(m_Events[i].eventID > eventID)
+			return m_Events[i].eventID;
+	}
+
+	return eventID+1;
+}
+
 const FetchDrawcall *WrappedOpenGL::GetDrawcall(const FetchDrawcall *draw, uint32_t eventID)
 {
 	if(draw == NULL) return NULL;
@@ -4223,10 +4603,26 @@ void WrappedOpenGL::ReplayLog(uint32_t frameID, uint32_t startEventID, uint32_t
 
 	bool partial = true;
 
+	bool incremental = (replayType == eReplay_WithoutDrawIncremental);
+	if(incremental)
+		replayType = eReplay_WithoutDraw;
+
+	ReplayPosition prevPos = m_ReplayPos;
+	m_ReplayPos = eReplayPos_Unknown;
+
 	if(startEventID == 0 && (replayType == eReplay_WithoutDraw || replayType == eReplay_Full))
 	{
-		startEventID = m_FrameRecord[frameID].frameInfo.firstEvent;
-		partial = false;
+		if(incremental && prevPos == eReplayPos_AfterDraw &&
+			 m_ReplayPosFrame == frameID && m_ReplayPosEvent < endEventID)
+		{
+			// the frame is already replayed up to an earlier event, so carry on from there.
+			startEventID = GetNextEventID(m_ReplayPosEvent);
+		}
+		else
+		{
+			startEventID = m_FrameRecord[frameID].frameInfo.firstEvent;
+			partial = false;
+		}
 	}
 	
 	GLChunkType header = (GLChunkType)m_pSerialiser->PushContext(NULL, 1, false);
@@ -4239,6 +4635,8 @@ void WrappedOpenGL::ReplayLog(uint32_t frameID, uint32_t startEventID, uint32_t
 	
 	if(!partial)
 	{
+		CreateDeferredInitialContents();
+
 		GetResourceManager()->ApplyInitialContents();
 		GetResourceManager()->ReleaseInFrameResources();
 	}
@@ -4253,4 +4651,16 @@ void WrappedOpenGL::ReplayLog(uint32_t frameID, uint32_t startEventID, uint32_t
 		else
 			RDCFATAL("Unexpected replay type");
 	}
+
+	if(incremental)
+	{
+		m_ReplayPos = eReplayPos_BeforeDraw;
+		m_ReplayPosFrame = frameID;
+		m_ReplayPosEvent = endEventID;
+	}
+	else if(replayType == eReplay_OnlyDraw && prevPos == eReplayPos_BeforeDraw &&
+		m_ReplayPosFrame == frameID && m_ReplayPosEvent == endEventID)
+	{
+		m_ReplayPos = eReplayPos_AfterDraw;
+	}
 }
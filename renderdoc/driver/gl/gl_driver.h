@@ -31,6 +31,7 @@
 #include "core/core.h"
 
 #include "replay/replay_driver.h"
+#include "replay/type_helpers.h"
 
 #include "gl_common.h"
 #include "gl_hookset.h"
@@ -55,7 +56,7 @@ struct GLInitParams : public RDCInitParams
 	uint32_t width;
 	uint32_t height;
 	
-	static const uint32_t GL_SERIALISE_VERSION = 0x000000D;
+	static const uint32_t GL_SERIALISE_VERSION = 0x0000012;
 
 	// version number internal to opengl stream
 	uint32_t SerialiseVersion;
@@ -85,11 +86,23 @@ struct DrawcallTreeNode
 		for(size_t i=0; i < children.size(); i++)
 		{
 			ret[i] = children[i].draw;
-			ret[i].children = children[i].Bake();
+			children[i].BakeChildren(ret[i].children);
 		}
 
 		return ret;
 	}
+
+	// bakes straight into the final array, so each drawcall is only copied once no matter
+	// how deeply it's nested (rather than once per level going via a vector)
+	void BakeChildren(rdctype::array<FetchDrawcall> &ret)
+	{
+		create_array_uninit(ret, children.size());
+		for(int32_t i=0; i < ret.count; i++)
+		{
+			new (ret.elems+i) FetchDrawcall(children[i].draw);
+			children[i].BakeChildren(ret[i].children);
+		}
+	}
 };
 
 struct Replacement
@@ -127,10 +140,30 @@ class WrappedOpenGL : public IFrameCapturer
 		// start, then track changes while frame capturing
 		bool RecordUpdateCheck(GLResourceRecord *record);
 
+		// stop tracking updates to a resource that's updated too often and mark it dirty instead.
+		// Its contents now come from its initial state at capture time, so any contents
+		// updates it has accumulated are deleted rather than held onto forever.
+		void MarkHighTraffic(GLResourceRecord *record);
+
+		// the pixel unpack buffer bound on the current context, which texture uploads source
+		// from with pixels as an offset. While capturing this comes from the binding tracked
+		// in glBindBuffer, as a glGet on every upload can stall a threaded driver.
+		GLuint GetUnpackBuffer();
+
 		// internals
 		Serialiser *m_pSerialiser;
 		LogState m_State;
 		bool m_AppControlledCapture;
+
+		// how deeply the application has nested marker regions, and while capturing a marker
+		// region the depth its pop returns to (-1 otherwise)
+		int32_t m_MarkerDepth;
+		int32_t m_RegionCaptureDepth;
+
+		void PushMarkerRegion(GLsizei length, const GLchar *marker);
+		void PopMarkerRegion();
+		// frames still to capture into the current log, including the one in progress
+		uint32_t m_CaptureFramesLeft;
 		
 		GLReplay m_Replay;
 
@@ -142,7 +175,7 @@ class WrappedOpenGL : public IFrameCapturer
 		// if no context is current
 		map<uint64_t, GLWindowingData> m_DefaultContexts;
 
-		bool m_ActiveQueries[8][8]; // first index type, second index (for some, always 0)
+		bool m_ActiveQueries[17][8]; // first index type, second index (for some, always 0)
 		bool m_ActiveConditional;
 		bool m_ActiveFeedback;
 
@@ -152,6 +185,9 @@ class WrappedOpenGL : public IFrameCapturer
 		ResourceId m_ContextResourceID;
 		GLResourceRecord *m_ContextRecord;
 
+		// if set, the context record's chunks are spilled here during the captured frame
+		ChunkSpillWriter *m_SpillWriter;
+
 		GLResourceRecord *m_DisplayListRecord;
 
 		GLResourceManager *m_ResourceManager;
@@ -163,9 +199,36 @@ class WrappedOpenGL : public IFrameCapturer
 		PerformanceTimer m_FrameTimer;
 		vector<double> m_FrameTimes;
 		double m_TotalTime, m_AvgFrametime, m_MinFrametime, m_MaxFrametime;
+
+		// counted through the frame, and handed to RenderDoc at each SwapBuffers
+		FrameStatistics m_FrameStats;
 		
 		set<ResourceId> m_HighTrafficResources;
 
+		// while capturing a frame, glBufferSubData updates are held here while consecutive
+		// calls touch the same buffer in contiguous or overlapping ranges, then written out
+		// as one update. Any other chunk being serialised flushes it, so the merged update
+		// stays in the same place in the frame relative to everything else.
+		struct PendingBufferSubData
+		{
+			PendingBufferSubData() : ctx(NULL), offset(0) {}
+
+			ResourceId id;
+			void *ctx;
+			uint64_t offset;
+			vector<byte> data;
+		} m_PendingSubData;
+
+		// returns true if the update is now held in m_PendingSubData, otherwise the caller
+		// should serialise it as normal - which will flush anything that's pending first.
+		bool MergeBufferSubData(GLResourceRecord *record, GLintptr offset, GLsizeiptr size, const void *data);
+		void FlushPendingBufferSubData()
+		{
+			if(!m_PendingSubData.data.empty())
+				SerialisePendingBufferSubData();
+		}
+		void SerialisePendingBufferSubData();
+
 		// we store two separate sets of maps, since for an explicit glMemoryBarrier
 		// we need to flush both types of maps, but for implicit sync points we only
 		// want to consider coherent maps, and since that happens often we want it to
@@ -199,6 +262,18 @@ class WrappedOpenGL : public IFrameCapturer
 		uint32_t m_CurEventID, m_CurDrawcallID;
 		uint32_t m_FirstEventID;
 		uint32_t m_LastEventID;
+
+		// how far through the frame the last incremental replay got. Any other replay loses
+		// track of it, since it might have been done with modified state.
+		enum ReplayPosition
+		{
+			eReplayPos_Unknown,
+			eReplayPos_BeforeDraw, // replayed up to but not including m_ReplayPosEvent
+			eReplayPos_AfterDraw,  // replayed up to and including m_ReplayPosEvent
+		};
+		ReplayPosition m_ReplayPos;
+		uint32_t m_ReplayPosFrame;
+		uint32_t m_ReplayPosEvent;
 		
 		DrawcallTreeNode m_ParentDrawcall;
 
@@ -286,6 +361,42 @@ class WrappedOpenGL : public IFrameCapturer
 		};
 
 		map<ResourceId, ShaderData> m_Shaders;
+
+		// on-disk caches of shader reflection and of the separable programs made for each
+		// shader, keyed by a hash of the shader's sources and the driver, so that reopening
+		// a log doesn't compile and query every shader again.
+		uint64_t m_ShaderCacheDriverHash;
+
+		static const uint32_t m_ReflectionCacheVersion = 1;
+		bool m_ReflectionCacheDirty;
+		map<uint64_t, ShaderReflection> m_ReflectionCache;
+
+		struct ProgramBinary
+		{
+			GLenum format;
+			vector<byte> data;
+		};
+
+		static const uint32_t m_ProgramBinaryCacheVersion = 1;
+		bool m_ShaderCachesLoaded;
+		bool m_ProgramBinaryCacheEnabled, m_ProgramBinaryCacheDirty;
+		map<uint64_t, ProgramBinary> m_ProgramBinaryCache;
+
+		// separable programs loaded from a binary have no shaders attached, so can't be
+		// relinked (e.g. to add transform feedback varyings) until one is compiled. Maps
+		// program to the shader it was made from.
+		map<GLuint, ResourceId> m_BinarySeparablePrograms;
+
+		void LoadShaderCaches();
+		void SaveShaderCaches();
+		void GetShaderReflection(GLenum shadType, const vector<string> &sources, GLuint sepProg, ShaderReflection &refl, bool pointSizeUsed, bool clipDistanceUsed);
+		GLuint MakeCachedSeparableProgram(ResourceId shader, GLenum shadType, const vector<string> &sources);
+		void MakeSeparableProgramRelinkable(GLuint prog);
+
+		// used for the replay's own debug programs as well as the log's shaders
+		uint64_t GetProgramCacheHash(size_t numStages, const GLenum *shadTypes, const char *const *sources);
+		bool LoadCachedProgramBinary(uint64_t hash, GLuint prog);
+		void StoreCachedProgramBinary(uint64_t hash, GLuint prog);
 		map<ResourceId, ProgramData> m_Programs;
 		map<ResourceId, PipelineData> m_Pipelines;
 		vector< pair<ResourceId, Replacement> > m_DependentReplacements;
@@ -297,6 +408,35 @@ class WrappedOpenGL : public IFrameCapturer
 		GLuint m_FakeIdxBuf;
 		GLsizeiptr m_FakeIdxSize;
 
+		// while reading the log, indirect draw parameters are copied on the GPU into this arena
+		// and read back once the whole frame has been read, then patched into the drawcalls -
+		// rather than stalling on a readback for every indirect draw.
+		enum IndirectFixupType
+		{
+			eIndirectFixup_Arrays,
+			eIndirectFixup_Elements,
+			eIndirectFixup_MultiArrays,
+			eIndirectFixup_MultiElements,
+		};
+
+		struct IndirectDrawFixup
+		{
+			uint32_t eventID;
+			IndirectFixupType type;
+			GLsizeiptr arenaOffset;
+			string namePrefix;
+
+			bool operator <(const IndirectDrawFixup &o) const { return eventID < o.eventID; }
+		};
+
+		GLuint m_IndirectArena;
+		GLsizeiptr m_IndirectArenaSize, m_IndirectArenaUsed;
+		vector<IndirectDrawFixup> m_IndirectFixups;
+
+		void QueueIndirectFixup(IndirectFixupType type, GLintptr offset, const string &namePrefix);
+		void ApplyIndirectFixups();
+		void ApplyIndirectFixups(DrawcallTreeNode &node, const byte *data);
+
 		ResourceId m_FakeVAOID;
 		
 		bool m_DoStateVerify;
@@ -305,6 +445,7 @@ class WrappedOpenGL : public IFrameCapturer
 		Serialiser *GetSerialiser() { return m_pSerialiser; }
 
 		void ProcessChunk(uint64_t offset, GLChunkType context);
+		void CreateDeferredInitialContents();
 		void ContextReplayLog(LogState readType, uint32_t startEventID, uint32_t endEventID, bool partial);
 		void ContextProcessChunk(uint64_t offset, GLChunkType chunk, bool forceExecute);
 		void AddUsage(FetchDrawcall draw);
@@ -319,6 +460,20 @@ class WrappedOpenGL : public IFrameCapturer
 		void FinishCapture();
 		void ContextEndFrame();
 
+		// the thumbnail is downscaled from the backbuffer on the GPU and read into a pixel pack
+		// buffer when a capture ends, then only mapped once the capture has been serialised.
+		struct ThumbnailReadback
+		{
+			ThumbnailReadback() : pbo(0), width(0), height(0)
+			{ fbo[0] = fbo[1] = rb[0] = rb[1] = 0; }
+
+			GLuint fbo[2], rb[2], pbo;
+			uint32_t width, height;
+		};
+
+		void BeginThumbnailReadback(ThumbnailReadback &th);
+		byte *EndThumbnailReadback(ThumbnailReadback &th);
+
 		struct ContextData
 		{
 			ContextData()
@@ -337,6 +492,7 @@ class WrappedOpenGL : public IFrameCapturer
 				m_Renderbuffer = ResourceId();
 				m_TextureUnit = 0;
 				m_ProgramPipeline = m_Program = 0;
+				m_DirtyUniformProgram = 0;
 			}
 
 			void *ctx;
@@ -387,13 +543,33 @@ class WrappedOpenGL : public IFrameCapturer
 			GLuint m_ProgramPipeline;
 			GLuint m_Program;
 
+			// the last program glUniform* marked dirty while idle. Programs only become clean
+			// again when deleted, so further updates to it don't need to mark it again.
+			GLuint m_DirtyUniformProgram;
+
 			GLResourceRecord *GetActiveTexRecord() { return m_TextureRecord[m_TextureUnit]; }
 		};
 
 		map<void*, ContextData> m_ContextData;
+
+		// the context current on each thread and its ContextData, kept in thread-local storage
+		// since nearly every call looks them up. data is refetched whenever m_ContextDataGeneration
+		// changes, i.e. a context has been deleted and its ContextData freed.
+		struct CurrentContext
+		{
+			void *ctx;
+			ContextData *data;
+			uint32_t generation;
+		};
+
+		uint64_t m_CurrentContextSlot;
+		uint32_t m_ContextDataGeneration;
+
+		CurrentContext *GetCurrentContext();
 		
 		ContextData &GetCtxData();
 		GLuint GetUniformProgram();
+		void MarkUniformProgramDirty(GLuint program);
 		
 		void ReplaceResource(ResourceId from, ResourceId to);
 		void RemoveReplacement(ResourceId id);
@@ -452,14 +628,25 @@ class WrappedOpenGL : public IFrameCapturer
 		GLuint GetFakeBBFBO() { return m_FakeBB_FBO; }
 		GLuint GetFakeVAO() { return m_FakeVAO; }
 
+		// hash of the vendor, renderer and version strings, valid once the shader caches are loaded
+		uint64_t GetDriverHash() { return m_ShaderCacheDriverHash; }
+
 		vector<FetchFrameRecord> &GetFrameRecord() { return m_FrameRecord; }
 		FetchAPIEvent GetEvent(uint32_t eventID);
+		// returns the first event after eventID, to continue a replay from
+		uint32_t GetNextEventID(uint32_t eventID);
 
 		const DrawcallTreeNode &GetRootDraw() { return m_ParentDrawcall; }
 
 		const FetchDrawcall *GetDrawcall(uint32_t frameID, uint32_t eventID);
 
-		vector<EventUsage> GetUsage(ResourceId id) { return m_ResourceUses[id]; }
+		vector<EventUsage> GetUsage(ResourceId id)
+		{
+			auto it = m_ResourceUses.find(id);
+			if(it == m_ResourceUses.end())
+				return vector<EventUsage>();
+			return it->second;
+		}
 
 		void CreateContext(GLWindowingData winData, void *shareContext, GLInitParams initParams, bool core, bool attribsCreate);
 		void RegisterContext(GLWindowingData winData, void *shareContext, bool core, bool attribsCreate);
@@ -468,6 +655,9 @@ class WrappedOpenGL : public IFrameCapturer
 		void WindowSize(void *windowHandle, uint32_t w, uint32_t h);
 		void SwapBuffers(void *windowHandle);
 
+		// called by the hooks for every entry point, to count them for the frame statistics
+		WrappedOpenGL *CountCall() { m_FrameStats.APICalls++; return this; }
+
 		void StartFrameCapture();
 
 		void EndFrameCapture();
@@ -476,6 +666,8 @@ class WrappedOpenGL : public IFrameCapturer
 		void StartFrameCapture(void *dev, void *wnd);
 		bool EndFrameCapture(void *dev, void *wnd);
 
+		void GetResourceMemoryUsage(vector<ResourceMemoryUsage> &usage);
+
 		IMPLEMENT_FUNCTION_SERIALISED(void, glBindTexture(GLenum target, GLuint texture));
 		IMPLEMENT_FUNCTION_SERIALISED(void, glBindTextures(GLuint first, GLsizei count, const GLuint *textures));
 		IMPLEMENT_FUNCTION_SERIALISED(void, glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format));
@@ -1417,6 +1609,19 @@ class WrappedOpenGL : public IFrameCapturer
 
 };
 
+// chunks are serialised strictly in order, so any pending merged buffer update must be
+// written out before a new chunk is started.
+#undef SCOPED_SERIALISE_CONTEXT
+#undef SCOPED_SERIALISE_SMALL_CONTEXT
+
+#ifdef DEBUG_TEXT_SERIALISER
+#define SCOPED_SERIALISE_CONTEXT(n) FlushPendingBufferSubData(); ScopedContext scope(m_pSerialiser, m_pDebugSerialiser, GetChunkName(n), n, false);
+#define SCOPED_SERIALISE_SMALL_CONTEXT(n) FlushPendingBufferSubData(); ScopedContext scope(m_pSerialiser, m_pDebugSerialiser, GetChunkName(n), n, true);
+#else
+#define SCOPED_SERIALISE_CONTEXT(n) FlushPendingBufferSubData(); ScopedContext scope(m_pSerialiser, NULL, GetChunkName(n), n, false);
+#define SCOPED_SERIALISE_SMALL_CONTEXT(n) FlushPendingBufferSubData(); ScopedContext scope(m_pSerialiser, NULL, GetChunkName(n), n, true);
+#endif
+
 class ScopedDebugContext
 {
 	public:
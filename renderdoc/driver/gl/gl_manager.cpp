@@ -130,6 +130,8 @@ struct TextureStateInitialData
 	ResourceId texBuffer;
 	uint32_t texBufOffs;
 	uint32_t texBufSize;
+	// contents weren't copied, they come from the creation chunks
+	int32_t stateOnly;
 };
 
 template<>
@@ -154,6 +156,7 @@ void Serialiser::Serialise(const char *name, TextureStateInitialData &el)
 	Serialise("texBuffer", el.texBuffer);
 	Serialise("texBufOffs", el.texBufOffs);
 	Serialise("texBufSize", el.texBufSize);
+	Serialise("stateOnly", el.stateOnly);
 }
 
 bool GLResourceManager::SerialisableResource(ResourceId id, GLResourceRecord *record)
@@ -329,6 +332,14 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 				gl.glGetTextureParameterfvEXT(res.name, details.curType, eGL_TEXTURE_LOD_BIAS, &state->lodBias);
 			}
 
+			// only the parameters changed, skip copying and reading back the contents
+			if(IsTextureStateOnly(Id))
+			{
+				state->stateOnly = 1;
+				SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, (byte *)state, sizeof(TextureStateInitialData)));
+				return true;
+			}
+
 			GLuint tex = 0;
 
 			{
@@ -441,6 +452,9 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 				gl.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, 0);
 			}
 
+			// only tracked to report capture overhead. Compressed textures just count their state
+			uint64_t size = sizeof(TextureStateInitialData);
+
 			// copy over mips
 			for(int i=0; i < mips; i++)
 			{
@@ -455,6 +469,9 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 					details.curType == eGL_TEXTURE_2D_ARRAY)
 					d = details.depth;
 
+				if(!iscomp)
+					size += GetByteSize(w, h, d, GetBaseFormat(details.internalFormat), GetDataType(details.internalFormat))*(uint64_t)RDCMAX(details.samples, 1);
+
 				// AMD throws an error copying mips that are smaller than the block size in one dimension, so do copy via
 				// CPU instead (will be slow, potentially we could optimise this if there's a different GPU-side image copy
 				// routine that works on these dimensions. Hopefully there'll only be a couple of such mips).
@@ -550,7 +567,11 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 
 			gl.glTextureParameterivEXT(res.name, details.curType, eGL_TEXTURE_MAX_LEVEL, (GLint *)&state->maxLevel);
 		
-			SetInitialContents(Id, InitialContentData(TextureRes(res.Context, tex), 0, (byte *)state));
+			SetInitialContents(Id, InitialContentData(TextureRes(res.Context, tex), 0, (byte *)state, size));
+
+			// multisampled textures aren't read back at all
+			if(!ms)
+				QueueTextureReadback(Id, tex);
 		}
 		else
 		{
@@ -563,7 +584,7 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 			gl.glGetTextureLevelParameterivEXT(res.name, details.curType, 0, eGL_TEXTURE_BUFFER_OFFSET, (GLint *)&state->texBufOffs);
 			gl.glGetTextureLevelParameterivEXT(res.name, details.curType, 0, eGL_TEXTURE_BUFFER_SIZE, (GLint *)&state->texBufSize);
 
-			SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, (byte *)state));
+			SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, (byte *)state, sizeof(TextureStateInitialData)));
 		}
 	}
 	else if(res.Namespace == eResFramebuffer)
@@ -574,7 +595,7 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 		byte *data = Serialiser::AllocAlignedBuffer(sizeof(FramebufferInitialData));
 		RDCEraseMem(data, sizeof(FramebufferInitialData));
 		
-		SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, data));
+		SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, data, sizeof(FramebufferInitialData)));
 
 		// if FBOs aren't shared we need to fetch the data for this FBO on the right context. It's
 		// not safe for us to go changing contexts ourselves (the context could be active on another
@@ -605,7 +626,7 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 		byte *data = Serialiser::AllocAlignedBuffer(sizeof(FeedbackInitialData));
 		RDCEraseMem(data, sizeof(FeedbackInitialData));
 		
-		SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, data));
+		SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, data, sizeof(FeedbackInitialData)));
 
 		// queue initial state fetching if we're not on the right context, see above in FBOs for more
 		// explanation of this.
@@ -623,7 +644,7 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 		byte *data = Serialiser::AllocAlignedBuffer(sizeof(VAOInitialData));
 		RDCEraseMem(data, sizeof(VAOInitialData));
 
-		SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, data));
+		SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, data, sizeof(VAOInitialData)));
 
 		// queue initial state fetching if we're not on the right context, see above in FBOs for more
 		// explanation of this.
@@ -649,6 +670,201 @@ bool GLResourceManager::Force_InitialState(GLResource res)
 	return false;
 }
 
+void GLResourceManager::QueueTextureReadback(ResourceId id, GLuint tex)
+{
+	const GLHookSet &gl = m_GL->m_Real;
+
+	auto prev = m_TextureReadbacks.find(id);
+	if(prev != m_TextureReadbacks.end())
+	{
+		ReleaseTextureReadback(prev->second);
+		m_TextureReadbacks.erase(prev);
+	}
+
+	if(gl.glFenceSync == NULL || gl.glClientWaitSync == NULL || gl.glMapNamedBufferRangeEXT == NULL)
+		return;
+
+	WrappedOpenGL::TextureData &details = m_GL->m_Textures[id];
+
+	GLenum t = details.curType;
+	GLenum fmt = GetBaseFormat(details.internalFormat);
+	GLenum type = GetDataType(details.internalFormat);
+
+	bool compressed = IsCompressedFormat(details.internalFormat);
+
+	if(compressed && gl.glGetCompressedTexImage == NULL)
+		return;
+
+	int mips = GetNumMips(gl, t, tex, details.width, details.height, details.depth);
+
+	GLenum targets[] = {
+		eGL_TEXTURE_CUBE_MAP_POSITIVE_X,
+		eGL_TEXTURE_CUBE_MAP_NEGATIVE_X,
+		eGL_TEXTURE_CUBE_MAP_POSITIVE_Y,
+		eGL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
+		eGL_TEXTURE_CUBE_MAP_POSITIVE_Z,
+		eGL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
+	};
+
+	int count = ARRAY_COUNT(targets);
+
+	if(t != eGL_TEXTURE_CUBE_MAP)
+	{
+		targets[0] = t;
+		count = 1;
+	}
+
+	// lay out each image in the same order as Serialise_InitialState reads them
+	TextureReadback readback;
+	size_t total = 0;
+
+	for(int i=0; i < mips; i++)
+	{
+		int w = RDCMAX(details.width>>i, 1);
+		int h = RDCMAX(details.height>>i, 1);
+		int d = RDCMAX(details.depth>>i, 1);
+
+		if(t == eGL_TEXTURE_CUBE_MAP_ARRAY ||
+			 t == eGL_TEXTURE_1D_ARRAY ||
+			 t == eGL_TEXTURE_2D_ARRAY)
+			d = details.depth;
+
+		size_t size = GetByteSize(w, h, d, fmt, type);
+
+		for(int trg=0; trg < count; trg++)
+		{
+			if(compressed)
+			{
+				GLint compSize = 0;
+				gl.glGetTextureLevelParameterivEXT(tex, targets[trg], i, eGL_TEXTURE_COMPRESSED_IMAGE_SIZE, &compSize);
+
+				size = (size_t)compSize;
+
+				// same as in Serialise_InitialState, some drivers return the size of the whole cubemap
+				if(VendorCheck[VendorCheck_EXT_compressed_cube_size] && t == eGL_TEXTURE_CUBE_MAP)
+					size /= 6;
+			}
+
+			readback.images.push_back(std::make_pair(total, size));
+			total = AlignUp16(total + size);
+		}
+	}
+
+	if(total == 0 || m_TextureReadbackBytes + total > MaxTextureReadbackBytes)
+		return;
+
+	GLuint ppb = 0;
+	gl.glGetIntegerv(eGL_PIXEL_PACK_BUFFER_BINDING, (GLint *)&ppb);
+
+	GLint packParams[8];
+	gl.glGetIntegerv(eGL_PACK_SWAP_BYTES, &packParams[0]);
+	gl.glGetIntegerv(eGL_PACK_LSB_FIRST, &packParams[1]);
+	gl.glGetIntegerv(eGL_PACK_ROW_LENGTH, &packParams[2]);
+	gl.glGetIntegerv(eGL_PACK_IMAGE_HEIGHT, &packParams[3]);
+	gl.glGetIntegerv(eGL_PACK_SKIP_PIXELS, &packParams[4]);
+	gl.glGetIntegerv(eGL_PACK_SKIP_ROWS, &packParams[5]);
+	gl.glGetIntegerv(eGL_PACK_SKIP_IMAGES, &packParams[6]);
+	gl.glGetIntegerv(eGL_PACK_ALIGNMENT, &packParams[7]);
+
+	gl.glPixelStorei(eGL_PACK_SWAP_BYTES, 0);
+	gl.glPixelStorei(eGL_PACK_LSB_FIRST, 0);
+	gl.glPixelStorei(eGL_PACK_ROW_LENGTH, 0);
+	gl.glPixelStorei(eGL_PACK_IMAGE_HEIGHT, 0);
+	gl.glPixelStorei(eGL_PACK_SKIP_PIXELS, 0);
+	gl.glPixelStorei(eGL_PACK_SKIP_ROWS, 0);
+	gl.glPixelStorei(eGL_PACK_SKIP_IMAGES, 0);
+	gl.glPixelStorei(eGL_PACK_ALIGNMENT, 1);
+
+	gl.glGenBuffers(1, &readback.buffer);
+	gl.glBindBuffer(eGL_PIXEL_PACK_BUFFER, readback.buffer);
+	gl.glNamedBufferDataEXT(readback.buffer, (GLsizeiptr)total, NULL, eGL_STREAM_READ);
+
+	GLenum binding = TextureBinding(t);
+
+	GLuint prevtex = 0;
+	gl.glGetIntegerv(binding, (GLint *)&prevtex);
+
+	gl.glBindTexture(t, tex);
+
+	size_t img = 0;
+	for(int i=0; i < mips; i++)
+	{
+		for(int trg=0; trg < count; trg++)
+		{
+			// as in Serialise_InitialState, avoid glGetTextureImageEXT for cubemap faces
+			if(compressed)
+				gl.glGetCompressedTexImage(targets[trg], i, (void *)readback.images[img].first);
+			else
+				gl.glGetTexImage(targets[trg], i, fmt, type, (void *)readback.images[img].first);
+			img++;
+		}
+	}
+
+	gl.glBindTexture(t, prevtex);
+
+	readback.sync = gl.glFenceSync(eGL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	gl.glBindBuffer(eGL_PIXEL_PACK_BUFFER, ppb);
+
+	gl.glPixelStorei(eGL_PACK_SWAP_BYTES, packParams[0]);
+	gl.glPixelStorei(eGL_PACK_LSB_FIRST, packParams[1]);
+	gl.glPixelStorei(eGL_PACK_ROW_LENGTH, packParams[2]);
+	gl.glPixelStorei(eGL_PACK_IMAGE_HEIGHT, packParams[3]);
+	gl.glPixelStorei(eGL_PACK_SKIP_PIXELS, packParams[4]);
+	gl.glPixelStorei(eGL_PACK_SKIP_ROWS, packParams[5]);
+	gl.glPixelStorei(eGL_PACK_SKIP_IMAGES, packParams[6]);
+	gl.glPixelStorei(eGL_PACK_ALIGNMENT, packParams[7]);
+
+	m_TextureReadbackBytes += total;
+	m_TextureReadbacks[id] = readback;
+}
+
+void GLResourceManager::ReleaseTextureReadback(TextureReadback &readback)
+{
+	const GLHookSet &gl = m_GL->m_Real;
+
+	if(readback.sync)
+		gl.glDeleteSync(readback.sync);
+	if(readback.buffer)
+		gl.glDeleteBuffers(1, &readback.buffer);
+
+	if(!readback.images.empty())
+	{
+		size_t total = AlignUp16(readback.images.back().first + readback.images.back().second);
+		m_TextureReadbackBytes -= RDCMIN((uint64_t)total, m_TextureReadbackBytes);
+	}
+
+	readback.sync = NULL;
+	readback.buffer = 0;
+	readback.images.clear();
+}
+
+byte *GLResourceManager::MapTextureReadback(ResourceId id, TextureReadback &readback)
+{
+	const GLHookSet &gl = m_GL->m_Real;
+
+	auto it = m_TextureReadbacks.find(id);
+	if(it == m_TextureReadbacks.end())
+		return NULL;
+
+	readback = it->second;
+	m_TextureReadbacks.erase(it);
+
+	gl.glClientWaitSync(readback.sync, eGL_SYNC_FLUSH_COMMANDS_BIT, ~0ULL);
+
+	size_t total = readback.images.back().first + readback.images.back().second;
+	return (byte *)gl.glMapNamedBufferRangeEXT(readback.buffer, 0, (GLsizeiptr)total, eGL_MAP_READ_BIT);
+}
+
+void GLResourceManager::ReleaseTextureReadbacks()
+{
+	for(auto it=m_TextureReadbacks.begin(); it != m_TextureReadbacks.end(); ++it)
+		ReleaseTextureReadback(it->second);
+
+	m_TextureReadbacks.clear();
+	m_TextureReadbackBytes = 0;
+}
+
 bool GLResourceManager::Serialise_InitialState(GLResource res)
 {
 	ResourceId Id = ResourceId();
@@ -663,6 +879,10 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 	else
 	{
 		m_pSerialiser->Serialise("Id", Id);
+
+		// no frame in the log uses these, don't bother creating them
+		if(!IsInitialContentsNeeded(Id))
+			return false;
 	}
 	
 	if(m_State < WRITING)
@@ -796,12 +1016,19 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 			
 			SERIALISE_ELEMENT(bool, isCompressed, isComp != 0);
 
-			if(details.curType == eGL_TEXTURE_BUFFER)
+			if(details.curType == eGL_TEXTURE_BUFFER || stateData.stateOnly)
 			{
-				// no contents to copy for texture buffer (it's copied under the buffer)
+				// no contents to copy for texture buffer (it's copied under the buffer), or
+				// for textures that still have their creation contents
 			}
 			else if(isCompressed)
 			{
+				// as below, use the readback queued at capture start if there is one
+				TextureReadback readback;
+				byte *readbackData = MapTextureReadback(Id, readback);
+
+				size_t img = 0;
+
 				for(int i=0; i < mips; i++)
 				{
 					GLenum targets[] = {
@@ -833,15 +1060,29 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 						if(VendorCheck[VendorCheck_EXT_compressed_cube_size] && t == eGL_TEXTURE_CUBE_MAP)
 							size /= 6;
 
-						byte *buf = new byte[size];
+						if(readbackData && img < readback.images.size() && readback.images[img].second == size)
+						{
+							byte *src = readbackData + readback.images[img].first;
+							SerialiseInitialData(Id, uint32_t(i*ARRAY_COUNT(targets) + trg), src, size);
+						}
+						else
+						{
+							byte *buf = new byte[size];
 
-						gl.glGetCompressedTextureImageEXT(tex, targets[trg], i, buf);
+							gl.glGetCompressedTextureImageEXT(tex, targets[trg], i, buf);
 
-						m_pSerialiser->SerialiseBuffer("image", buf, size);
+							SerialiseInitialData(Id, uint32_t(i*ARRAY_COUNT(targets) + trg), buf, size);
 
-						delete[] buf;
+							delete[] buf;
+						}
+
+						img++;
 					}
 				}
+
+				if(readbackData)
+					gl.glUnmapNamedBufferEXT(readback.buffer);
+				ReleaseTextureReadback(readback);
 			}
 			else if(samples > 1)
 			{
@@ -863,6 +1104,13 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 
 				gl.glBindTexture(t, tex);
 
+				// if the contents were read back at capture start, they should be long since
+				// ready. Otherwise fall back to reading each image here
+				TextureReadback readback;
+				byte *readbackData = MapTextureReadback(Id, readback);
+
+				size_t img = 0;
+
 				for(int i=0; i < mips; i++)
 				{
 					int w = RDCMAX(details.width>>i, 1);
@@ -895,12 +1143,26 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 
 					for(int trg=0; trg < count; trg++)
 					{
-						// we avoid glGetTextureImageEXT as it seems buggy for cubemap faces
-						gl.glGetTexImage(targets[trg], i, fmt, type, buf);
-
-						m_pSerialiser->SerialiseBuffer("image", buf, size);
+						if(readbackData && img < readback.images.size() && readback.images[img].second == size)
+						{
+							byte *src = readbackData + readback.images[img].first;
+							SerialiseInitialData(Id, uint32_t(i*ARRAY_COUNT(targets) + trg), src, size);
+						}
+						else
+						{
+							// we avoid glGetTextureImageEXT as it seems buggy for cubemap faces
+							gl.glGetTexImage(targets[trg], i, fmt, type, buf);
+
+							SerialiseInitialData(Id, uint32_t(i*ARRAY_COUNT(targets) + trg), buf, size);
+						}
+
+						img++;
 					}
 				}
+
+				if(readbackData)
+					gl.glUnmapNamedBufferEXT(readback.buffer);
+				ReleaseTextureReadback(readback);
 				
 				gl.glBindTexture(t, prevtex);
 
@@ -957,60 +1219,27 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 			SERIALISE_ELEMENT(GLenum, internalformat, eGL_NONE);
 			SERIALISE_ELEMENT(int, mips, 0);
 			SERIALISE_ELEMENT(bool, isCompressed, false);
-			
-			GLuint tex = 0;
-			
-			if(textype != eGL_TEXTURE_BUFFER)
-			{
-				GLuint prevtex = 0;
-				gl.glGetIntegerv(TextureBinding(textype), (GLint *)&prevtex);
-				
-				gl.glGenTextures(1, &tex);
-				gl.glBindTexture(textype, tex);
-				
-				gl.glBindTexture(textype, prevtex);
-			}
 
-			// create texture of identical format/size to store initial contents
-			if(textype == eGL_TEXTURE_BUFFER)
-			{
-				// no 'contents' texture to create
-			}
-			else if(textype == eGL_TEXTURE_2D_MULTISAMPLE)
-			{
-				gl.glTextureStorage2DMultisampleEXT(tex, textype, samples, internalformat, width, height, GL_TRUE);
-				mips = 1;
-			}
-			else if(textype == eGL_TEXTURE_2D_MULTISAMPLE_ARRAY)
-			{
-				gl.glTextureStorage3DMultisampleEXT(tex, textype, samples, internalformat, width, height, depth, GL_TRUE);
-				mips = 1;
-			}
-			else if(dim == 1)
-			{
-				gl.glTextureStorage1DEXT(tex, textype, mips, internalformat, width);
-			}
-			else if(dim == 2)
-			{
-				gl.glTextureStorage2DEXT(tex, textype, mips, internalformat, width, height);
-			}
-			else if(dim == 3)
-			{
-				gl.glTextureStorage3DEXT(tex, textype, mips, internalformat, width, height, depth);
-			}
+			// read all of the data up front, so we know whether the copy fits in video memory
+			InitialTextureData data;
+			data.dim = dim;
+			data.internalformat = internalformat;
+			data.compressed = isCompressed;
 
-			if(textype == eGL_TEXTURE_BUFFER)
+			uint64_t dataSize = 0;
+
+			if(textype == eGL_TEXTURE_BUFFER || state->stateOnly)
 			{
 				// no contents to serialise
 			}
-			else if(isCompressed)
+			else if(isCompressed || samples <= 1)
 			{
 				for(int i=0; i < mips; i++)
 				{
 					uint32_t w = RDCMAX(width>>i, 1U);
 					uint32_t h = RDCMAX(height>>i, 1U);
 					uint32_t d = RDCMAX(depth>>i, 1U);
-						
+
 					if(textype == eGL_TEXTURE_CUBE_MAP_ARRAY ||
 						 textype == eGL_TEXTURE_1D_ARRAY ||
 						 textype == eGL_TEXTURE_2D_ARRAY)
@@ -1026,7 +1255,7 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 					};
 
 					int count = ARRAY_COUNT(targets);
-						
+
 					if(textype != eGL_TEXTURE_CUBE_MAP)
 					{
 						targets[0] = textype;
@@ -1035,81 +1264,73 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 
 					for(int trg=0; trg < count; trg++)
 					{
-						size_t size = 0;
-						byte *buf = NULL;
-
-						m_pSerialiser->SerialiseBuffer("image", buf, size);
-
-						if(dim == 1)
-							gl.glCompressedTextureSubImage1DEXT(tex, targets[trg], i, 0, w, internalformat, (GLsizei)size, buf);
-						else if(dim == 2)
-							gl.glCompressedTextureSubImage2DEXT(tex, targets[trg], i, 0, 0, w, h, internalformat, (GLsizei)size, buf);
-						else if(dim == 3)
-							gl.glCompressedTextureSubImage3DEXT(tex, targets[trg], i, 0, 0, 0, w, h, d, internalformat, (GLsizei)size, buf);
-
-						delete[] buf;
+						InitialTextureImage img;
+						img.target = targets[trg];
+						img.mip = i;
+						img.w = w;
+						img.h = h;
+						img.d = d;
+						img.size = 0;
+						img.data = NULL;
+
+						SerialiseInitialData(Id, uint32_t(i*ARRAY_COUNT(targets) + trg), img.data, img.size);
+
+						dataSize += img.size;
+						data.images.push_back(img);
 					}
 				}
 			}
-			else if(samples > 1)
+			else
 			{
 				GLNOTIMP("Not implemented - initial states of multisampled textures");
 			}
+
+			ResourceId liveId = GetLiveID(Id);
+
+			FreeInitialTextureData(liveId);
+
+			if(textype == eGL_TEXTURE_BUFFER || state->stateOnly)
+			{
+				// no 'contents' texture to create
+				SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, (byte *)state));
+			}
+			else if(!ReserveInitialContentsMemory(liveId, dataSize))
+			{
+				// past the budget, keep the data in system memory and upload it straight into the
+				// live texture each time the initial contents are applied
+				m_SysMemInitialTextures[liveId] = data;
+				SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, (byte *)state));
+			}
 			else
 			{
-				GLenum fmt = GetBaseFormat(internalformat);
-				GLenum type = GetDataType(internalformat);
+				GLuint prevtex = 0;
+				gl.glGetIntegerv(TextureBinding(textype), (GLint *)&prevtex);
 
-				for(int i=0; i < mips; i++)
-				{
-					uint32_t w = RDCMAX(width>>i, 1U);
-					uint32_t h = RDCMAX(height>>i, 1U);
-					uint32_t d = RDCMAX(depth>>i, 1U);
-					
-					if(textype == eGL_TEXTURE_CUBE_MAP_ARRAY ||
-						 textype == eGL_TEXTURE_1D_ARRAY ||
-						 textype == eGL_TEXTURE_2D_ARRAY)
-						d = depth;
-					
-					GLenum targets[] = {
-						eGL_TEXTURE_CUBE_MAP_POSITIVE_X,
-						eGL_TEXTURE_CUBE_MAP_NEGATIVE_X,
-						eGL_TEXTURE_CUBE_MAP_POSITIVE_Y,
-						eGL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
-						eGL_TEXTURE_CUBE_MAP_POSITIVE_Z,
-						eGL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
-					};
+				GLuint tex = 0;
+				gl.glGenTextures(1, &tex);
+				gl.glBindTexture(textype, tex);
 
-					int count = ARRAY_COUNT(targets);
-						
-					if(textype != eGL_TEXTURE_CUBE_MAP)
-					{
-						targets[0] = textype;
-						count = 1;
-					}
-					
-					for(int trg=0; trg < count; trg++)
-					{
-						size_t size = 0;
-						byte *buf = NULL;
-						m_pSerialiser->SerialiseBuffer("image", buf, size);
+				gl.glBindTexture(textype, prevtex);
 
-						if(dim == 1)
-							gl.glTextureSubImage1DEXT(tex, targets[trg], i, 0, w, fmt, type, buf);
-						else if(dim == 2)
-							gl.glTextureSubImage2DEXT(tex, targets[trg], i, 0, 0, w, h, fmt, type, buf);
-						else if(dim == 3)
-							gl.glTextureSubImage3DEXT(tex, targets[trg], i, 0, 0, 0, w, h, d, fmt, type, buf);
+				// create texture of identical format/size to store initial contents
+				if(textype == eGL_TEXTURE_2D_MULTISAMPLE)
+					gl.glTextureStorage2DMultisampleEXT(tex, textype, samples, internalformat, width, height, GL_TRUE);
+				else if(textype == eGL_TEXTURE_2D_MULTISAMPLE_ARRAY)
+					gl.glTextureStorage3DMultisampleEXT(tex, textype, samples, internalformat, width, height, depth, GL_TRUE);
+				else if(dim == 1)
+					gl.glTextureStorage1DEXT(tex, textype, mips, internalformat, width);
+				else if(dim == 2)
+					gl.glTextureStorage2DEXT(tex, textype, mips, internalformat, width, height);
+				else if(dim == 3)
+					gl.glTextureStorage3DEXT(tex, textype, mips, internalformat, width, height, depth);
+
+				UploadInitialTexture(tex, data);
+
+				for(size_t i=0; i < data.images.size(); i++)
+					delete[] data.images[i].data;
 
-						delete[] buf;
-					}
-				}
-			}
-			
-			if(textype != eGL_TEXTURE_BUFFER)
 				SetInitialContents(Id, InitialContentData(TextureRes(m_GL->GetCtx(), tex), 0, (byte *)state));
-			else
-				SetInitialContents(Id, InitialContentData(GLResource(MakeNullResource), 0, (byte *)state));
+			}
 
 			gl.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, pub);
 
@@ -1197,6 +1418,129 @@ bool GLResourceManager::Serialise_InitialState(GLResource res)
 	return true;
 }
 
+bool GLResourceManager::ReserveInitialContentsMemory(ResourceId liveId, uint64_t size)
+{
+	if(m_InitialContentsBudget == 0)
+	{
+		const GLHookSet &gl = m_GL->m_Real;
+
+		// both report in kilobytes
+		GLint freeKB[4] = { 0, 0, 0, 0 };
+		if(ExtensionSupported[ExtensionSupported_NVX_gpu_memory_info])
+			gl.glGetIntegerv(eGL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, freeKB);
+		else if(ExtensionSupported[ExtensionSupported_ATI_meminfo])
+			gl.glGetIntegerv(eGL_TEXTURE_FREE_MEMORY_ATI, freeKB);
+
+		// leave a quarter free for everything replay creates later - debug textures, overlays,
+		// post-transform data and so on. With no way to tell, there's no budget.
+		if(freeKB[0] > 0)
+		{
+			m_InitialContentsBudget = uint64_t(freeKB[0])*1024*3/4;
+			RDCLOG("%llu MB video memory free, keeping up to %llu MB of initial contents resident",
+			       uint64_t(freeKB[0])/1024, m_InitialContentsBudget/(1024*1024));
+		}
+		else
+		{
+			m_InitialContentsBudget = ~0ULL;
+		}
+	}
+
+	if(m_InitialContentsBytes + size > m_InitialContentsBudget)
+	{
+		RDCDEBUG("Keeping initial contents of %llu (%llu bytes) in system memory", liveId, size);
+		return false;
+	}
+
+	m_InitialContentsBytes += size;
+	m_ResidentInitialBytes[liveId] = size;
+
+	return true;
+}
+
+void GLResourceManager::FreeInitialTextureData(ResourceId liveId)
+{
+	auto resident = m_ResidentInitialBytes.find(liveId);
+	if(resident != m_ResidentInitialBytes.end())
+	{
+		m_InitialContentsBytes -= resident->second;
+		m_ResidentInitialBytes.erase(resident);
+	}
+
+	auto it = m_SysMemInitialTextures.find(liveId);
+	if(it != m_SysMemInitialTextures.end())
+	{
+		for(size_t i=0; i < it->second.images.size(); i++)
+			delete[] it->second.images[i].data;
+		m_SysMemInitialTextures.erase(it);
+	}
+}
+
+void GLResourceManager::UploadInitialTexture(GLuint tex, const InitialTextureData &data)
+{
+	const GLHookSet &gl = m_GL->m_Real;
+
+	GLuint pub = 0;
+	gl.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, (GLint *)&pub);
+	gl.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, 0);
+
+	GLint unpackParams[8];
+	gl.glGetIntegerv(eGL_UNPACK_SWAP_BYTES, &unpackParams[0]);
+	gl.glGetIntegerv(eGL_UNPACK_LSB_FIRST, &unpackParams[1]);
+	gl.glGetIntegerv(eGL_UNPACK_ROW_LENGTH, &unpackParams[2]);
+	gl.glGetIntegerv(eGL_UNPACK_IMAGE_HEIGHT, &unpackParams[3]);
+	gl.glGetIntegerv(eGL_UNPACK_SKIP_PIXELS, &unpackParams[4]);
+	gl.glGetIntegerv(eGL_UNPACK_SKIP_ROWS, &unpackParams[5]);
+	gl.glGetIntegerv(eGL_UNPACK_SKIP_IMAGES, &unpackParams[6]);
+	gl.glGetIntegerv(eGL_UNPACK_ALIGNMENT, &unpackParams[7]);
+
+	gl.glPixelStorei(eGL_UNPACK_SWAP_BYTES, 0);
+	gl.glPixelStorei(eGL_UNPACK_LSB_FIRST, 0);
+	gl.glPixelStorei(eGL_UNPACK_ROW_LENGTH, 0);
+	gl.glPixelStorei(eGL_UNPACK_IMAGE_HEIGHT, 0);
+	gl.glPixelStorei(eGL_UNPACK_SKIP_PIXELS, 0);
+	gl.glPixelStorei(eGL_UNPACK_SKIP_ROWS, 0);
+	gl.glPixelStorei(eGL_UNPACK_SKIP_IMAGES, 0);
+	gl.glPixelStorei(eGL_UNPACK_ALIGNMENT, 1);
+
+	GLenum fmt = GetBaseFormat(data.internalformat);
+	GLenum type = GetDataType(data.internalformat);
+
+	for(size_t i=0; i < data.images.size(); i++)
+	{
+		const InitialTextureImage &img = data.images[i];
+
+		if(data.compressed)
+		{
+			if(data.dim == 1)
+				gl.glCompressedTextureSubImage1DEXT(tex, img.target, img.mip, 0, img.w, data.internalformat, (GLsizei)img.size, img.data);
+			else if(data.dim == 2)
+				gl.glCompressedTextureSubImage2DEXT(tex, img.target, img.mip, 0, 0, img.w, img.h, data.internalformat, (GLsizei)img.size, img.data);
+			else if(data.dim == 3)
+				gl.glCompressedTextureSubImage3DEXT(tex, img.target, img.mip, 0, 0, 0, img.w, img.h, img.d, data.internalformat, (GLsizei)img.size, img.data);
+		}
+		else
+		{
+			if(data.dim == 1)
+				gl.glTextureSubImage1DEXT(tex, img.target, img.mip, 0, img.w, fmt, type, img.data);
+			else if(data.dim == 2)
+				gl.glTextureSubImage2DEXT(tex, img.target, img.mip, 0, 0, img.w, img.h, fmt, type, img.data);
+			else if(data.dim == 3)
+				gl.glTextureSubImage3DEXT(tex, img.target, img.mip, 0, 0, 0, img.w, img.h, img.d, fmt, type, img.data);
+		}
+	}
+
+	gl.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, pub);
+
+	gl.glPixelStorei(eGL_UNPACK_SWAP_BYTES, unpackParams[0]);
+	gl.glPixelStorei(eGL_UNPACK_LSB_FIRST, unpackParams[1]);
+	gl.glPixelStorei(eGL_UNPACK_ROW_LENGTH, unpackParams[2]);
+	gl.glPixelStorei(eGL_UNPACK_IMAGE_HEIGHT, unpackParams[3]);
+	gl.glPixelStorei(eGL_UNPACK_SKIP_PIXELS, unpackParams[4]);
+	gl.glPixelStorei(eGL_UNPACK_SKIP_ROWS, unpackParams[5]);
+	gl.glPixelStorei(eGL_UNPACK_SKIP_IMAGES, unpackParams[6]);
+	gl.glPixelStorei(eGL_UNPACK_ALIGNMENT, unpackParams[7]);
+}
+
 void GLResourceManager::Create_InitialState(ResourceId id, GLResource live, bool hasData)
 {
 	if(live.Namespace == eResTexture)
@@ -1224,174 +1568,188 @@ void GLResourceManager::Apply_InitialState(GLResource live, InitialContentData i
 
 		TextureStateInitialData *state = (TextureStateInitialData *)initial.blob;
 
+		auto sysmem = m_SysMemInitialTextures.find(Id);
+
 		if(details.curType != eGL_TEXTURE_BUFFER)
 		{
-			GLuint tex = initial.resource.name;
-
-			int mips = GetNumMips(gl, details.curType, tex, details.width, details.height, details.depth);
-
-			// we need to set maxlevel appropriately for number of mips to force the texture to be complete.
-			// This can happen if e.g. a texture is initialised just by default with glTexImage for level 0 and
-			// used as a framebuffer attachment, then the implementation is fine with it. Unfortunately glCopyImageSubData
-			// requires completeness across all mips, a stricter requirement :(.
-			// We set max_level to mips - 1 (so mips=1 means MAX_LEVEL=0). Then below where we set the texture state, the
-			// correct MAX_LEVEL is set to whatever the program had.
-			int maxlevel = mips-1;
-			gl.glTextureParameterivEXT(live.name, details.curType, eGL_TEXTURE_MAX_LEVEL, (GLint *)&maxlevel);
-
-			bool iscomp = IsCompressedFormat(details.internalFormat);
-
-			bool avoidCopySubImage = false;
-			if(iscomp && VendorCheck[VendorCheck_AMD_copy_compressed_tinymips])
-				avoidCopySubImage = true;
-			if(iscomp && details.curType == eGL_TEXTURE_CUBE_MAP && VendorCheck[VendorCheck_AMD_copy_compressed_cubemaps])
-				avoidCopySubImage = true;
-
-			GLint packParams[8];
-			GLint unpackParams[8];
-			if(avoidCopySubImage)
+			if(state->stateOnly)
 			{
-				gl.glGetIntegerv(eGL_PACK_SWAP_BYTES, &packParams[0]);
-				gl.glGetIntegerv(eGL_PACK_LSB_FIRST, &packParams[1]);
-				gl.glGetIntegerv(eGL_PACK_ROW_LENGTH, &packParams[2]);
-				gl.glGetIntegerv(eGL_PACK_IMAGE_HEIGHT, &packParams[3]);
-				gl.glGetIntegerv(eGL_PACK_SKIP_PIXELS, &packParams[4]);
-				gl.glGetIntegerv(eGL_PACK_SKIP_ROWS, &packParams[5]);
-				gl.glGetIntegerv(eGL_PACK_SKIP_IMAGES, &packParams[6]);
-				gl.glGetIntegerv(eGL_PACK_ALIGNMENT, &packParams[7]);
-
-				gl.glPixelStorei(eGL_PACK_SWAP_BYTES, 0);
-				gl.glPixelStorei(eGL_PACK_LSB_FIRST, 0);
-				gl.glPixelStorei(eGL_PACK_ROW_LENGTH, 0);
-				gl.glPixelStorei(eGL_PACK_IMAGE_HEIGHT, 0);
-				gl.glPixelStorei(eGL_PACK_SKIP_PIXELS, 0);
-				gl.glPixelStorei(eGL_PACK_SKIP_ROWS, 0);
-				gl.glPixelStorei(eGL_PACK_SKIP_IMAGES, 0);
-				gl.glPixelStorei(eGL_PACK_ALIGNMENT, 1);
-
-				gl.glGetIntegerv(eGL_UNPACK_SWAP_BYTES, &unpackParams[0]);
-				gl.glGetIntegerv(eGL_UNPACK_LSB_FIRST, &unpackParams[1]);
-				gl.glGetIntegerv(eGL_UNPACK_ROW_LENGTH, &unpackParams[2]);
-				gl.glGetIntegerv(eGL_UNPACK_IMAGE_HEIGHT, &unpackParams[3]);
-				gl.glGetIntegerv(eGL_UNPACK_SKIP_PIXELS, &unpackParams[4]);
-				gl.glGetIntegerv(eGL_UNPACK_SKIP_ROWS, &unpackParams[5]);
-				gl.glGetIntegerv(eGL_UNPACK_SKIP_IMAGES, &unpackParams[6]);
-				gl.glGetIntegerv(eGL_UNPACK_ALIGNMENT, &unpackParams[7]);
-
-				gl.glPixelStorei(eGL_UNPACK_SWAP_BYTES, 0);
-				gl.glPixelStorei(eGL_UNPACK_LSB_FIRST, 0);
-				gl.glPixelStorei(eGL_UNPACK_ROW_LENGTH, 0);
-				gl.glPixelStorei(eGL_UNPACK_IMAGE_HEIGHT, 0);
-				gl.glPixelStorei(eGL_UNPACK_SKIP_PIXELS, 0);
-				gl.glPixelStorei(eGL_UNPACK_SKIP_ROWS, 0);
-				gl.glPixelStorei(eGL_UNPACK_SKIP_IMAGES, 0);
-				gl.glPixelStorei(eGL_UNPACK_ALIGNMENT, 1);
+				// contents are unchanged from what the creation chunks uploaded
 			}
-
-			// copy over mips
-			for(int i=0; i < mips; i++)
+			else if(sysmem != m_SysMemInitialTextures.end())
 			{
-				int w = RDCMAX(details.width>>i, 1);
-				int h = RDCMAX(details.height>>i, 1);
-				int d = RDCMAX(details.depth>>i, 1);
-
-				if(details.curType == eGL_TEXTURE_CUBE_MAP)
-					d *= 6;
-				else if(details.curType == eGL_TEXTURE_CUBE_MAP_ARRAY ||
-					details.curType == eGL_TEXTURE_1D_ARRAY ||
-					details.curType == eGL_TEXTURE_2D_ARRAY)
-					d = details.depth;
+				// uploading doesn't need the texture to be complete like glCopyImageSubData does
+				UploadInitialTexture(live.name, sysmem->second);
+			}
+			else
+			{
+				GLuint tex = initial.resource.name;
+
+				int mips = GetNumMips(gl, details.curType, tex, details.width, details.height, details.depth);
+
+				// we need to set maxlevel appropriately for number of mips to force the texture to be complete.
+				// This can happen if e.g. a texture is initialised just by default with glTexImage for level 0 and
+				// used as a framebuffer attachment, then the implementation is fine with it. Unfortunately glCopyImageSubData
+				// requires completeness across all mips, a stricter requirement :(.
+				// We set max_level to mips - 1 (so mips=1 means MAX_LEVEL=0). Then below where we set the texture state, the
+				// correct MAX_LEVEL is set to whatever the program had.
+				int maxlevel = mips-1;
+				gl.glTextureParameterivEXT(live.name, details.curType, eGL_TEXTURE_MAX_LEVEL, (GLint *)&maxlevel);
+
+				bool iscomp = IsCompressedFormat(details.internalFormat);
+
+				bool avoidCopySubImage = false;
+				if(iscomp && VendorCheck[VendorCheck_AMD_copy_compressed_tinymips])
+					avoidCopySubImage = true;
+				if(iscomp && details.curType == eGL_TEXTURE_CUBE_MAP && VendorCheck[VendorCheck_AMD_copy_compressed_cubemaps])
+					avoidCopySubImage = true;
+
+				GLint packParams[8];
+				GLint unpackParams[8];
+				if(avoidCopySubImage)
+				{
+					gl.glGetIntegerv(eGL_PACK_SWAP_BYTES, &packParams[0]);
+					gl.glGetIntegerv(eGL_PACK_LSB_FIRST, &packParams[1]);
+					gl.glGetIntegerv(eGL_PACK_ROW_LENGTH, &packParams[2]);
+					gl.glGetIntegerv(eGL_PACK_IMAGE_HEIGHT, &packParams[3]);
+					gl.glGetIntegerv(eGL_PACK_SKIP_PIXELS, &packParams[4]);
+					gl.glGetIntegerv(eGL_PACK_SKIP_ROWS, &packParams[5]);
+					gl.glGetIntegerv(eGL_PACK_SKIP_IMAGES, &packParams[6]);
+					gl.glGetIntegerv(eGL_PACK_ALIGNMENT, &packParams[7]);
+
+					gl.glPixelStorei(eGL_PACK_SWAP_BYTES, 0);
+					gl.glPixelStorei(eGL_PACK_LSB_FIRST, 0);
+					gl.glPixelStorei(eGL_PACK_ROW_LENGTH, 0);
+					gl.glPixelStorei(eGL_PACK_IMAGE_HEIGHT, 0);
+					gl.glPixelStorei(eGL_PACK_SKIP_PIXELS, 0);
+					gl.glPixelStorei(eGL_PACK_SKIP_ROWS, 0);
+					gl.glPixelStorei(eGL_PACK_SKIP_IMAGES, 0);
+					gl.glPixelStorei(eGL_PACK_ALIGNMENT, 1);
+
+					gl.glGetIntegerv(eGL_UNPACK_SWAP_BYTES, &unpackParams[0]);
+					gl.glGetIntegerv(eGL_UNPACK_LSB_FIRST, &unpackParams[1]);
+					gl.glGetIntegerv(eGL_UNPACK_ROW_LENGTH, &unpackParams[2]);
+					gl.glGetIntegerv(eGL_UNPACK_IMAGE_HEIGHT, &unpackParams[3]);
+					gl.glGetIntegerv(eGL_UNPACK_SKIP_PIXELS, &unpackParams[4]);
+					gl.glGetIntegerv(eGL_UNPACK_SKIP_ROWS, &unpackParams[5]);
+					gl.glGetIntegerv(eGL_UNPACK_SKIP_IMAGES, &unpackParams[6]);
+					gl.glGetIntegerv(eGL_UNPACK_ALIGNMENT, &unpackParams[7]);
+
+					gl.glPixelStorei(eGL_UNPACK_SWAP_BYTES, 0);
+					gl.glPixelStorei(eGL_UNPACK_LSB_FIRST, 0);
+					gl.glPixelStorei(eGL_UNPACK_ROW_LENGTH, 0);
+					gl.glPixelStorei(eGL_UNPACK_IMAGE_HEIGHT, 0);
+					gl.glPixelStorei(eGL_UNPACK_SKIP_PIXELS, 0);
+					gl.glPixelStorei(eGL_UNPACK_SKIP_ROWS, 0);
+					gl.glPixelStorei(eGL_UNPACK_SKIP_IMAGES, 0);
+					gl.glPixelStorei(eGL_UNPACK_ALIGNMENT, 1);
+				}
 
-				// AMD throws an error copying mips that are smaller than the block size in one dimension, so do copy via
-				// CPU instead (will be slow, potentially we could optimise this if there's a different GPU-side image copy
-				// routine that works on these dimensions. Hopefully there'll only be a couple of such mips).
-				//
-				// AMD also has issues copying cubemaps
-				if(
-					 (iscomp && VendorCheck[VendorCheck_AMD_copy_compressed_tinymips] && (w < 4 || h < 4)) ||
-					 (iscomp && VendorCheck[VendorCheck_AMD_copy_compressed_cubemaps] && details.curType == eGL_TEXTURE_CUBE_MAP)
-					 )
+				// copy over mips
+				for(int i=0; i < mips; i++)
 				{
-					GLenum targets[] = {
-						eGL_TEXTURE_CUBE_MAP_POSITIVE_X,
-						eGL_TEXTURE_CUBE_MAP_NEGATIVE_X,
-						eGL_TEXTURE_CUBE_MAP_POSITIVE_Y,
-						eGL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
-						eGL_TEXTURE_CUBE_MAP_POSITIVE_Z,
-						eGL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
-					};
+					int w = RDCMAX(details.width>>i, 1);
+					int h = RDCMAX(details.height>>i, 1);
+					int d = RDCMAX(details.depth>>i, 1);
 
-					int count = ARRAY_COUNT(targets);
+					if(details.curType == eGL_TEXTURE_CUBE_MAP)
+						d *= 6;
+					else if(details.curType == eGL_TEXTURE_CUBE_MAP_ARRAY ||
+						details.curType == eGL_TEXTURE_1D_ARRAY ||
+						details.curType == eGL_TEXTURE_2D_ARRAY)
+						d = details.depth;
 
-					if(details.curType != eGL_TEXTURE_CUBE_MAP)
+					// AMD throws an error copying mips that are smaller than the block size in one dimension, so do copy via
+					// CPU instead (will be slow, potentially we could optimise this if there's a different GPU-side image copy
+					// routine that works on these dimensions. Hopefully there'll only be a couple of such mips).
+					//
+					// AMD also has issues copying cubemaps
+					if(
+						 (iscomp && VendorCheck[VendorCheck_AMD_copy_compressed_tinymips] && (w < 4 || h < 4)) ||
+						 (iscomp && VendorCheck[VendorCheck_AMD_copy_compressed_cubemaps] && details.curType == eGL_TEXTURE_CUBE_MAP)
+						 )
 					{
-						targets[0] = details.curType;
-						count = 1;
+						GLenum targets[] = {
+							eGL_TEXTURE_CUBE_MAP_POSITIVE_X,
+							eGL_TEXTURE_CUBE_MAP_NEGATIVE_X,
+							eGL_TEXTURE_CUBE_MAP_POSITIVE_Y,
+							eGL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
+							eGL_TEXTURE_CUBE_MAP_POSITIVE_Z,
+							eGL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
+						};
+
+						int count = ARRAY_COUNT(targets);
+
+						if(details.curType != eGL_TEXTURE_CUBE_MAP)
+						{
+							targets[0] = details.curType;
+							count = 1;
+						}
+
+						for(int trg=0; trg < count; trg++)
+						{
+							GLint compSize;
+							gl.glGetTextureLevelParameterivEXT(tex, targets[trg], i, eGL_TEXTURE_COMPRESSED_IMAGE_SIZE, &compSize);
+
+							size_t size = compSize;
+
+							// sometimes cubemaps return the compressed image size for the whole texture, but we read it
+							// face by face
+							if(VendorCheck[VendorCheck_EXT_compressed_cube_size] && details.curType == eGL_TEXTURE_CUBE_MAP)
+								size /= 6;
+
+							byte *buf = new byte[size];
+
+							// read to CPU
+							gl.glGetCompressedTextureImageEXT(tex, targets[trg], i, buf);
+
+							// write to GPU
+							if(details.dimension == 1)
+								gl.glCompressedTextureSubImage1DEXT(live.name, targets[trg], i, 0, w, details.internalFormat, (GLsizei)size, buf);
+							else if(details.dimension == 2)
+								gl.glCompressedTextureSubImage2DEXT(live.name, targets[trg], i, 0, 0, w, h, details.internalFormat, (GLsizei)size, buf);
+							else if(details.dimension == 3)
+								gl.glCompressedTextureSubImage3DEXT(live.name, targets[trg], i, 0, 0, 0, w, h, d, details.internalFormat, (GLsizei)size, buf);
+
+							delete[] buf;
+						}
 					}
-
-					for(int trg=0; trg < count; trg++)
+					else
 					{
-						GLint compSize;
-						gl.glGetTextureLevelParameterivEXT(tex, targets[trg], i, eGL_TEXTURE_COMPRESSED_IMAGE_SIZE, &compSize);
-
-						size_t size = compSize;
-
-						// sometimes cubemaps return the compressed image size for the whole texture, but we read it
-						// face by face
-						if(VendorCheck[VendorCheck_EXT_compressed_cube_size] && details.curType == eGL_TEXTURE_CUBE_MAP)
-							size /= 6;
-
-						byte *buf = new byte[size];
-
-						// read to CPU
-						gl.glGetCompressedTextureImageEXT(tex, targets[trg], i, buf);
-
-						// write to GPU
-						if(details.dimension == 1)
-							gl.glCompressedTextureSubImage1DEXT(live.name, targets[trg], i, 0, w, details.internalFormat, (GLsizei)size, buf);
-						else if(details.dimension == 2)
-							gl.glCompressedTextureSubImage2DEXT(live.name, targets[trg], i, 0, 0, w, h, details.internalFormat, (GLsizei)size, buf);
-						else if(details.dimension == 3)
-							gl.glCompressedTextureSubImage3DEXT(live.name, targets[trg], i, 0, 0, 0, w, h, d, details.internalFormat, (GLsizei)size, buf);
-
-						delete[] buf;
+						// it seems like everything explodes if I do glCopyImageSubData on a D32F_S8 texture - on replay loads of things
+						// get heavily corrupted - probably the same as the problems we get in-program, but magnified. It seems like a driver bug,
+						// nvidia specific.
+						// In most cases a program isn't going to rely on the contents of a depth-stencil buffer (shadow maps that it might
+						// require would be depth-only formatted).
+						if(details.internalFormat == eGL_DEPTH32F_STENCIL8 && VendorCheck[VendorCheck_NV_avoid_D32S8_copy])
+							RDCDEBUG("Not fetching initial contents of D32F_S8 texture");
+						else
+							gl.glCopyImageSubData(tex, details.curType, i, 0, 0, 0, live.name, details.curType, i, 0, 0, 0, w, h, d);
 					}
 				}
-				else
+
+				if(avoidCopySubImage)
 				{
-					// it seems like everything explodes if I do glCopyImageSubData on a D32F_S8 texture - on replay loads of things
-					// get heavily corrupted - probably the same as the problems we get in-program, but magnified. It seems like a driver bug,
-					// nvidia specific.
-					// In most cases a program isn't going to rely on the contents of a depth-stencil buffer (shadow maps that it might
-					// require would be depth-only formatted).
-					if(details.internalFormat == eGL_DEPTH32F_STENCIL8 && VendorCheck[VendorCheck_NV_avoid_D32S8_copy])
-						RDCDEBUG("Not fetching initial contents of D32F_S8 texture");
-					else
-						gl.glCopyImageSubData(tex, details.curType, i, 0, 0, 0, live.name, details.curType, i, 0, 0, 0, w, h, d);
+					gl.glPixelStorei(eGL_PACK_SWAP_BYTES, packParams[0]);
+					gl.glPixelStorei(eGL_PACK_LSB_FIRST, packParams[1]);
+					gl.glPixelStorei(eGL_PACK_ROW_LENGTH, packParams[2]);
+					gl.glPixelStorei(eGL_PACK_IMAGE_HEIGHT, packParams[3]);
+					gl.glPixelStorei(eGL_PACK_SKIP_PIXELS, packParams[4]);
+					gl.glPixelStorei(eGL_PACK_SKIP_ROWS, packParams[5]);
+					gl.glPixelStorei(eGL_PACK_SKIP_IMAGES, packParams[6]);
+					gl.glPixelStorei(eGL_PACK_ALIGNMENT, packParams[7]);
+
+					gl.glPixelStorei(eGL_UNPACK_SWAP_BYTES, unpackParams[0]);
+					gl.glPixelStorei(eGL_UNPACK_LSB_FIRST, unpackParams[1]);
+					gl.glPixelStorei(eGL_UNPACK_ROW_LENGTH, unpackParams[2]);
+					gl.glPixelStorei(eGL_UNPACK_IMAGE_HEIGHT, unpackParams[3]);
+					gl.glPixelStorei(eGL_UNPACK_SKIP_PIXELS, unpackParams[4]);
+					gl.glPixelStorei(eGL_UNPACK_SKIP_ROWS, unpackParams[5]);
+					gl.glPixelStorei(eGL_UNPACK_SKIP_IMAGES, unpackParams[6]);
+					gl.glPixelStorei(eGL_UNPACK_ALIGNMENT, unpackParams[7]);
 				}
 			}
 
-			if(avoidCopySubImage)
-			{
-				gl.glPixelStorei(eGL_PACK_SWAP_BYTES, packParams[0]);
-				gl.glPixelStorei(eGL_PACK_LSB_FIRST, packParams[1]);
-				gl.glPixelStorei(eGL_PACK_ROW_LENGTH, packParams[2]);
-				gl.glPixelStorei(eGL_PACK_IMAGE_HEIGHT, packParams[3]);
-				gl.glPixelStorei(eGL_PACK_SKIP_PIXELS, packParams[4]);
-				gl.glPixelStorei(eGL_PACK_SKIP_ROWS, packParams[5]);
-				gl.glPixelStorei(eGL_PACK_SKIP_IMAGES, packParams[6]);
-				gl.glPixelStorei(eGL_PACK_ALIGNMENT, packParams[7]);
-
-				gl.glPixelStorei(eGL_UNPACK_SWAP_BYTES, unpackParams[0]);
-				gl.glPixelStorei(eGL_UNPACK_LSB_FIRST, unpackParams[1]);
-				gl.glPixelStorei(eGL_UNPACK_ROW_LENGTH, unpackParams[2]);
-				gl.glPixelStorei(eGL_UNPACK_IMAGE_HEIGHT, unpackParams[3]);
-				gl.glPixelStorei(eGL_UNPACK_SKIP_PIXELS, unpackParams[4]);
-				gl.glPixelStorei(eGL_UNPACK_SKIP_ROWS, unpackParams[5]);
-				gl.glPixelStorei(eGL_UNPACK_SKIP_IMAGES, unpackParams[6]);
-				gl.glPixelStorei(eGL_UNPACK_ALIGNMENT, unpackParams[7]);
-			}
-
 			bool ms = (details.curType == eGL_TEXTURE_2D_MULTISAMPLE || details.curType == eGL_TEXTURE_2D_MULTISAMPLE_ARRAY);
 
 			if(state->depthMode == eGL_DEPTH_COMPONENT || state->depthMode == eGL_STENCIL_INDEX)
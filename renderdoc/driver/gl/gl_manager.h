@@ -28,6 +28,7 @@
 #include "core/resource_manager.h"
 
 #include "driver/gl/gl_resources.h"
+#include "driver/gl/gl_resource_map.h"
 
 class WrappedOpenGL;
 
@@ -35,7 +36,8 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 {
 	public: 
 		GLResourceManager(LogState state, Serialiser *ser, WrappedOpenGL *gl)
-			: ResourceManager(state, ser), m_GL(gl), m_SyncName(1)
+			: ResourceManager(state, ser), m_GL(gl), m_SyncName(1), m_TextureReadbackBytes(0),
+			  m_InitialContentsBytes(0), m_InitialContentsBudget(0)
 		{
 		}
 		~GLResourceManager() {}
@@ -51,55 +53,53 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 			// before deleting them.
 
 			// special care is taken since the act of freeing parents will by design potentially modify the
-			// container. Since this is shutdown, we take the simple & naive approach of simply restarting the
-			// loop whenever we detect the size changing. FreeParents() is a safe operation to perform on records
-			// that have already freed their parents.
+			// container. Since this is shutdown, we take the simple & naive approach of taking a list of
+			// everything up front and looking each one up again as we go, skipping any that have gone.
+			// FreeParents() is a safe operation to perform on records that have already freed their parents.
+			vector<GLResource> resources;
+			m_GLResourceRecords.keys(resources);
+
+			for(size_t i=0; i < resources.size(); i++)
 			{
-				auto it = m_GLResourceRecords.begin();
-				
-				for(size_t i=0; it != m_GLResourceRecords.end();)
-				{
-					size_t prevSize = m_GLResourceRecords.size();
-					it->second->FreeParents(this);
-
-					// collection modified, restart loop
-					if(prevSize != m_GLResourceRecords.size())
-					{
-						i = 0;
-						it = m_GLResourceRecords.begin();
-						continue;
-					}
-
-					// collection not modified, continue
-					i++;
-					it++;
-				}
+				GLResourceRecord **record = m_GLResourceRecords.find(resources[i]);
+				if(record)
+					(*record)->FreeParents(this);
 			}
 
-			while(!m_GLResourceRecords.empty())
+			for(size_t i=0; i < resources.size(); i++)
 			{
-				auto it = m_GLResourceRecords.begin();
-				ResourceId id = it->second->GetResourceID();
-				it->second->Delete(this);
+				GLResourceRecord **record = m_GLResourceRecords.find(resources[i]);
+				if(record == NULL)
+					continue;
+
+				ResourceId id = (*record)->GetResourceID();
+				(*record)->Delete(this);
 
-				if(!m_GLResourceRecords.empty() && m_GLResourceRecords.begin()->second->GetResourceID() == id)
-					m_GLResourceRecords.erase(m_GLResourceRecords.begin());
+				record = m_GLResourceRecords.find(resources[i]);
+				if(record && (*record)->GetResourceID() == id)
+					m_GLResourceRecords.erase(resources[i]);
 			}
 
+			m_GLResourceRecords.clear();
+
 			m_CurrentResourceIds.clear();
 
+			while(!m_SysMemInitialTextures.empty())
+				FreeInitialTextureData(m_SysMemInitialTextures.begin()->first);
+
 			ResourceManager::Shutdown();
 		}
 		
 		inline void RemoveResourceRecord(ResourceId id)
 		{
-			for(auto it = m_GLResourceRecords.begin(); it != m_GLResourceRecords.end(); it++)
+			// the record knows which resource it's stored under, unless that's since been
+			// taken over by a newer record for a recycled name
+			GLResourceRecord *record = ResourceManager::GetResourceRecord(id);
+			if(record)
 			{
-				if(it->second->GetResourceID() == id)
-				{
-					m_GLResourceRecords.erase(it);
-					break;
-				}
+				GLResourceRecord **stored = m_GLResourceRecords.find(record->Resource);
+				if(stored && *stored == record)
+					m_GLResourceRecords.erase(record->Resource);
 			}
 			
 			ResourceManager::RemoveResourceRecord(id);
@@ -108,7 +108,7 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 		ResourceId RegisterResource(GLResource res)
 		{
 			ResourceId id = TrackedResource::GetNewUniqueID();
-			m_CurrentResourceIds[res] = id;
+			m_CurrentResourceIds.insert(res, id);
 			AddCurrentResource(id, res);
 			return id;
 		}
@@ -117,28 +117,24 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 
 		bool HasCurrentResource(GLResource res)
 		{
-			auto it = m_CurrentResourceIds.find(res);
-			if(it != m_CurrentResourceIds.end())
-				return true;
-
-			return false;
+			return m_CurrentResourceIds.find(res) != NULL;
 		}
 
 		void UnregisterResource(GLResource res)
 		{
-			auto it = m_CurrentResourceIds.find(res);
-			if(it != m_CurrentResourceIds.end())
+			ResourceId *id = m_CurrentResourceIds.find(res);
+			if(id)
 			{
-				ReleaseCurrentResource(it->second);
+				ReleaseCurrentResource(*id);
 				m_CurrentResourceIds.erase(res);
 			}
 		}
 
 		ResourceId GetID(GLResource res)
 		{
-			auto it = m_CurrentResourceIds.find(res);
-			if(it != m_CurrentResourceIds.end())
-				return it->second;
+			ResourceId *id = m_CurrentResourceIds.find(res);
+			if(id)
+				return *id;
 			return ResourceId();
 		}
 
@@ -147,7 +143,7 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 			GLResourceRecord *ret = ResourceManager::AddResourceRecord(id);
 			GLResource res = GetCurrentResource(id);
 
-			m_GLResourceRecords[res] = ret;
+			m_GLResourceRecords.insert(res, ret);
 			ret->Resource = res;
 
 			return ret;
@@ -164,24 +160,53 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 
 		GLResourceRecord *GetResourceRecord(GLResource res)
 		{
-			auto it = m_GLResourceRecords.find(res);
-			if(it != m_GLResourceRecords.end())
-				return it->second;
+			GLResourceRecord **record = m_GLResourceRecords.find(res);
+			if(record)
+				return *record;
 
 			return ResourceManager::GetResourceRecord(GetID(res));
 		}
 
-		using ResourceManager::MarkDirtyResource;
+		void MarkDirtyResource(ResourceId id)
+		{
+			{
+				SCOPED_LOCK(m_StateOnlyLock);
+				m_StateOnlyTextures.erase(id);
+			}
+
+			return ResourceManager::MarkDirtyResource(id);
+		}
 
 		void MarkDirtyResource(GLResource res)
 		{
-			return ResourceManager::MarkDirtyResource(GetID(res));
+			return MarkDirtyResource(GetID(res));
+		}
+
+		// marks a texture dirty only for its parameters. If nothing has written its contents
+		// since they were created, the initial state skips the copy and readback and replay
+		// rebuilds the contents from the creation chunks like any clean texture.
+		void MarkTextureStateDirty(ResourceId id)
+		{
+			if(id == ResourceId() || IsResourceDirty(id))
+				return;
+
+			{
+				SCOPED_LOCK(m_StateOnlyLock);
+				m_StateOnlyTextures.insert(id);
+			}
+
+			ResourceManager::MarkDirtyResource(id);
 		}
 
 		using ResourceManager::MarkCleanResource;
 		
 		void MarkCleanResource(GLResource res)
 		{
+			{
+				SCOPED_LOCK(m_StateOnlyLock);
+				m_StateOnlyTextures.erase(GetID(res));
+			}
+
 			return ResourceManager::MarkCleanResource(GetID(res));
 		}
 
@@ -207,6 +232,9 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 		bool Prepare_InitialState(GLResource res, byte *blob);
 		bool Serialise_InitialState(GLResource res);
 
+		// frees any texture readbacks that weren't used when serialising initial states
+		void ReleaseTextureReadbacks();
+
 	private:
 		bool SerialisableResource(ResourceId id, GLResourceRecord *record);
 		
@@ -214,13 +242,17 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 
 		bool Force_InitialState(GLResource res);
 		bool Need_InitialStateChunk(GLResource res);
+		// rendering to an attached texture doesn't re-mark it dirty, so always take a fresh copy
+		bool Reuse_InitialState(GLResource res) { return false; }
 		bool Prepare_InitialState(GLResource res);
 		void Create_InitialState(ResourceId id, GLResource live, bool hasData);
 		void Apply_InitialState(GLResource live, InitialContentData initial);
+		// the first read of the frame reads back buffers, never textures
+		bool Defer_InitialState(GLResource live) { return live.Namespace == eResTexture; }
 
-		map<GLResource, GLResourceRecord*> m_GLResourceRecords;
+		GLResourceMap<GLResourceRecord*> m_GLResourceRecords;
 
-		map<GLResource, ResourceId> m_CurrentResourceIds;
+		GLResourceMap<ResourceId> m_CurrentResourceIds;
 
 		// sync objects must be treated differently as they're not GLuint names, but pointer sized.
 		// We manually give them GLuint names so they're otherwise namespaced as (eResSync, GLuint)
@@ -228,6 +260,74 @@ class GLResourceManager : public ResourceManager<GLResource, GLResourceRecord>
 		map<GLuint, GLsync> m_CurrentSyncs;
 		volatile int64_t m_SyncName;
 
+		// texture initial states are read back into a pixel pack buffer as soon as they're
+		// copied at capture start, so the GPU does the transfer while the frame is captured,
+		// and it doesn't stall on each glGetTexImage when the initial states are serialised.
+		// Compressed textures are read back the same way, as their compressed blocks.
+		struct TextureReadback
+		{
+			TextureReadback() : buffer(0), sync(NULL) {}
+			GLuint buffer;
+			GLsync sync;
+			// offset and size of each mip/face, in the order they're serialised
+			vector< pair<size_t, size_t> > images;
+		};
+
+		map<ResourceId, TextureReadback> m_TextureReadbacks;
+		uint64_t m_TextureReadbackBytes;
+
+		// past this, textures are read back synchronously instead to bound the memory used
+		static const uint64_t MaxTextureReadbackBytes = 256*1024*1024;
+
+		void QueueTextureReadback(ResourceId id, GLuint tex);
+		void ReleaseTextureReadback(TextureReadback &readback);
+
+		// if id has a queued readback, removes it into readback and waits for and maps its data
+		byte *MapTextureReadback(ResourceId id, TextureReadback &readback);
+
+		// on replay, texture initial contents are normally copies in video memory. Once those
+		// would take more than the budget (a share of the free video memory when the first copy
+		// is made) the rest are kept in system memory instead, and uploaded straight into the
+		// live texture whenever initial contents are applied. Slower to apply, but large logs
+		// can still be opened on cards with less memory than the original.
+		struct InitialTextureImage
+		{
+			GLenum target;
+			int mip;
+			uint32_t w, h, d;
+			size_t size;
+			byte *data;
+		};
+
+		struct InitialTextureData
+		{
+			uint32_t dim;
+			GLenum internalformat;
+			bool compressed;
+			vector<InitialTextureImage> images;
+		};
+
+		// keyed by live ID
+		map<ResourceId, InitialTextureData> m_SysMemInitialTextures;
+		map<ResourceId, uint64_t> m_ResidentInitialBytes;
+		uint64_t m_InitialContentsBytes;
+		uint64_t m_InitialContentsBudget;
+
+		// returns false if a video memory copy of size bytes would go over the budget
+		bool ReserveInitialContentsMemory(ResourceId liveId, uint64_t size);
+		void FreeInitialTextureData(ResourceId liveId);
+		void UploadInitialTexture(GLuint tex, const InitialTextureData &data);
+
+		// dirty textures whose contents are still exactly what their creation chunks produce
+		set<ResourceId> m_StateOnlyTextures;
+		Threading::CriticalSection m_StateOnlyLock;
+
+		bool IsTextureStateOnly(ResourceId id)
+		{
+			SCOPED_LOCK(m_StateOnlyLock);
+			return m_StateOnlyTextures.find(id) != m_StateOnlyTextures.end();
+		}
+
 		WrappedOpenGL *m_GL;
 };
 
@@ -363,7 +363,14 @@ void GLRenderState::FetchState(void *ctx, WrappedOpenGL *gl)
 
 	m_Real->glGetIntegerv(eGL_ACTIVE_TEXTURE, (GLint *)&ActiveTexture);
 	
-	for(GLuint i=0; i < (GLuint)ARRAY_COUNT(Tex2D); i++)
+	// units past the implementation's limit can't be bound, so they're left cleared
+	GLuint numUnits = (GLuint)ARRAY_COUNT(Tex2D);
+	GLint maxUnits = 0;
+	m_Real->glGetIntegerv(eGL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &maxUnits);
+	if(maxUnits > 0)
+		numUnits = RDCMIN(numUnits, (GLuint)maxUnits);
+	
+	for(GLuint i=0; i < numUnits; i++)
 	{
 		m_Real->glActiveTexture(GLenum(eGL_TEXTURE0 + i));
 		m_Real->glGetIntegerv(eGL_TEXTURE_BINDING_1D, (GLint*)&Tex1D[i]);
@@ -627,6 +634,8 @@ void GLRenderState::ApplyState(void *ctx, WrappedOpenGL *gl)
 	if(!ContextPresent || ctx == NULL)
 		return;
 
+	bool multiBind = (GLCoreVersion >= 44 || ExtensionSupported[ExtensionSupported_ARB_multi_bind]);
+
 	{
 		GLenum pnames[] =
 		{
@@ -680,21 +689,86 @@ void GLRenderState::ApplyState(void *ctx, WrappedOpenGL *gl)
 		}
 	}
 
-	for(GLuint i=0; i < (GLuint)ARRAY_COUNT(Tex2D); i++)
 	{
-		m_Real->glActiveTexture(GLenum(eGL_TEXTURE0 + i));
-		m_Real->glBindTexture(eGL_TEXTURE_1D, Tex1D[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_2D, Tex2D[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_3D, Tex3D[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_1D_ARRAY, Tex1DArray[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_2D_ARRAY, Tex2DArray[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_CUBE_MAP_ARRAY, TexCubeArray[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_RECTANGLE, TexRect[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_BUFFER, TexBuffer[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_CUBE_MAP, TexCube[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_2D_MULTISAMPLE, Tex2DMS[i]);
-		m_Real->glBindTexture(eGL_TEXTURE_2D_MULTISAMPLE_ARRAY, Tex2DMSArray[i]);
-		m_Real->glBindSampler(i, Samplers[i]);
+		struct { GLenum target; uint32_t *names; } texBinds[] =
+		{
+			{ eGL_TEXTURE_1D,                   Tex1D },
+			{ eGL_TEXTURE_2D,                   Tex2D },
+			{ eGL_TEXTURE_3D,                   Tex3D },
+			{ eGL_TEXTURE_1D_ARRAY,             Tex1DArray },
+			{ eGL_TEXTURE_2D_ARRAY,             Tex2DArray },
+			{ eGL_TEXTURE_CUBE_MAP_ARRAY,       TexCubeArray },
+			{ eGL_TEXTURE_RECTANGLE,            TexRect },
+			{ eGL_TEXTURE_BUFFER,               TexBuffer },
+			{ eGL_TEXTURE_CUBE_MAP,             TexCube },
+			{ eGL_TEXTURE_2D_MULTISAMPLE,       Tex2DMS },
+			{ eGL_TEXTURE_2D_MULTISAMPLE_ARRAY, Tex2DMSArray },
+		};
+
+		GLuint numUnits = (GLuint)ARRAY_COUNT(Tex2D);
+		GLint maxUnits = 0;
+		m_Real->glGetIntegerv(eGL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &maxUnits);
+		if(maxUnits > 0)
+			numUnits = RDCMIN(numUnits, (GLuint)maxUnits);
+
+		// with multi-bind a run of empty units can be cleared in one call, and a unit with only
+		// one texture bound can be set in two calls without switching the active texture.
+		GLuint emptyStart = 0, emptyCount = 0;
+
+		for(GLuint i=0; i < numUnits; i++)
+		{
+			uint32_t single = 0;
+			uint32_t numBound = 0;
+
+			for(size_t t=0; t < ARRAY_COUNT(texBinds); t++)
+			{
+				if(texBinds[t].names[i])
+				{
+					single = texBinds[t].names[i];
+					numBound++;
+				}
+			}
+
+			if(multiBind && numBound == 0)
+			{
+				if(emptyCount == 0)
+					emptyStart = i;
+				emptyCount++;
+				continue;
+			}
+
+			if(emptyCount > 0)
+			{
+				m_Real->glBindTextures(emptyStart, emptyCount, NULL);
+				emptyCount = 0;
+			}
+
+			// binding a texture with multi-bind leaves the unit's other targets alone, so they
+			// are cleared first
+			if(multiBind && numBound == 1)
+			{
+				m_Real->glBindTextures(i, 1, NULL);
+				m_Real->glBindTextures(i, 1, &single);
+				continue;
+			}
+
+			m_Real->glActiveTexture(GLenum(eGL_TEXTURE0 + i));
+			for(size_t t=0; t < ARRAY_COUNT(texBinds); t++)
+				m_Real->glBindTexture(texBinds[t].target, texBinds[t].names[i]);
+		}
+
+		if(emptyCount > 0)
+			m_Real->glBindTextures(emptyStart, emptyCount, NULL);
+
+		if(multiBind)
+		{
+			m_Real->glBindSamplers(0, numUnits, Samplers);
+		}
+		else
+		{
+			for(GLuint i=0; i < numUnits; i++)
+				m_Real->glBindSampler(i, Samplers[i]);
+		}
 	}
 	
 	for(GLuint i=0; i < (GLuint)ARRAY_COUNT(Images); i++)
@@ -709,6 +783,7 @@ void GLRenderState::ApplyState(void *ctx, WrappedOpenGL *gl)
 				Images[i].access, Images[i].format);
 	}
 	
+	// the texture binds above may have changed the active texture
 	m_Real->glActiveTexture(ActiveTexture);
 
 	m_Real->glBindVertexArray(VAO);
@@ -999,6 +1074,20 @@ void GLRenderState::Clear()
 	RDCEraseEl(Unpack);
 }
 
+// the binding arrays are mostly empty, so only the occupied slots are serialised after a
+// mask of which those are. Slots not in the mask are left as Clear() set them on reading.
+// This only makes the capture smaller - ApplyState still has to set every slot, as the
+// replay can't know what was left bound in the ones that should be empty.
+struct BindingMask
+{
+	uint64_t bits[2];
+
+	BindingMask() { bits[0] = bits[1] = 0; }
+
+	void Set(size_t i) { bits[i/64] |= 1ULL << (i%64); }
+	bool IsSet(size_t i) const { return (bits[i/64] & (1ULL << (i%64))) != 0; }
+};
+
 void GLRenderState::Serialise(LogState state, void *ctx, WrappedOpenGL *gl)
 {
 	GLResourceManager *rm = gl->GetResourceManager();
@@ -1011,8 +1100,6 @@ void GLRenderState::Serialise(LogState state, void *ctx, WrappedOpenGL *gl)
 
 	m_pSerialiser->Serialise<eEnabled_Count>("GL_ENABLED", Enabled);
 
-	ResourceId ids[128];
-
 	GLuint *texArrays[] = {
 		Tex1D,
 		Tex2D,
@@ -1041,30 +1128,59 @@ void GLRenderState::Serialise(LogState state, void *ctx, WrappedOpenGL *gl)
 		"GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY",
 	};
 
+	RDCCOMPILE_ASSERT(ARRAY_COUNT(Tex2D) <= 128 && ARRAY_COUNT(Samplers) <= 128, "Binding mask is too small");
+
 	for(size_t t=0; t < ARRAY_COUNT(texArrays); t++)
 	{
-		RDCEraseEl(ids);
+		BindingMask mask;
 		if(state >= WRITING)
 			for(size_t i=0; i < ARRAY_COUNT(Tex2D); i++)
-				if(texArrays[t][i]) ids[i] = rm->GetID(TextureRes(ctx, texArrays[t][i]));
+				if(texArrays[t][i]) mask.Set(i);
 
-		m_pSerialiser->Serialise<ARRAY_COUNT(Tex2D)>(names[t], ids);
+		m_pSerialiser->Serialise<2>(names[t], mask.bits);
 
-		if(state < WRITING)
-			for(size_t i=0; i < ARRAY_COUNT(Tex2D); i++)
-				if(ids[i] != ResourceId()) texArrays[t][i] = rm->GetLiveResource(ids[i]).name;
+		for(size_t i=0; i < ARRAY_COUNT(Tex2D); i++)
+		{
+			if(!mask.IsSet(i)) continue;
+
+			ResourceId ID = ResourceId();
+			if(state >= WRITING) ID = rm->GetID(TextureRes(ctx, texArrays[t][i]));
+			m_pSerialiser->Serialise(names[t], ID);
+			if(state < WRITING && ID != ResourceId()) texArrays[t][i] = rm->GetLiveResource(ID).name;
+		}
 	}
 	
-	for(size_t i=0; i < ARRAY_COUNT(Samplers); i++)
 	{
-		ResourceId ID = ResourceId();
-		if(state >= WRITING) ID = rm->GetID(SamplerRes(ctx, Samplers[i]));
-		m_pSerialiser->Serialise("GL_SAMPLER_BINDING", ID);
-		if(state < WRITING && ID != ResourceId()) Samplers[i] = rm->GetLiveResource(ID).name;
+		BindingMask mask;
+		if(state >= WRITING)
+			for(size_t i=0; i < ARRAY_COUNT(Samplers); i++)
+				if(Samplers[i]) mask.Set(i);
+
+		m_pSerialiser->Serialise<2>("GL_SAMPLER_BINDING", mask.bits);
+
+		for(size_t i=0; i < ARRAY_COUNT(Samplers); i++)
+		{
+			if(!mask.IsSet(i)) continue;
+
+			ResourceId ID = ResourceId();
+			if(state >= WRITING) ID = rm->GetID(SamplerRes(ctx, Samplers[i]));
+			m_pSerialiser->Serialise("GL_SAMPLER_BINDING", ID);
+			if(state < WRITING && ID != ResourceId()) Samplers[i] = rm->GetLiveResource(ID).name;
+		}
 	}
 	
+	BindingMask imageMask;
+	if(state >= WRITING)
+		for(size_t i=0; i < ARRAY_COUNT(Images); i++)
+			if(Images[i].name || Images[i].level || Images[i].layered || Images[i].layer || Images[i].access || Images[i].format)
+				imageMask.Set(i);
+
+	m_pSerialiser->Serialise<2>("GL_IMAGE_BINDING", imageMask.bits);
+
 	for(size_t i=0; i < ARRAY_COUNT(Images); i++)
 	{
+		if(!imageMask.IsSet(i)) continue;
+
 		ResourceId ID = ResourceId();
 		if(state >= WRITING) ID = rm->GetID(TextureRes(ctx, Images[i].name));
 		m_pSerialiser->Serialise("GL_IMAGE_BINDING_NAME", ID);
@@ -1133,7 +1249,13 @@ void GLRenderState::Serialise(LogState state, void *ctx, WrappedOpenGL *gl)
 	for(size_t s=0; s < ARRAY_COUNT(Subroutines); s++)
 	{
 		m_pSerialiser->Serialise("GL_ACTIVE_SUBROUTINE_UNIFORM_LOCATIONS", Subroutines[s].numSubroutines);
-		m_pSerialiser->Serialise<128>("GL_SUBROUTINE_UNIFORMS", Subroutines[s].Values);
+
+		// only the active uniforms are used
+		Subroutines[s].numSubroutines = RDCCLAMP(Subroutines[s].numSubroutines, 0, (GLint)ARRAY_COUNT(Subroutines[s].Values));
+
+		GLuint *values = Subroutines[s].Values;
+		size_t numValues = (size_t)Subroutines[s].numSubroutines;
+		m_pSerialiser->Serialise("GL_SUBROUTINE_UNIFORMS", values, numValues);
 	}
 
 	{
@@ -1163,8 +1285,20 @@ void GLRenderState::Serialise(LogState state, void *ctx, WrappedOpenGL *gl)
 
 	for(size_t b=0; b < ARRAY_COUNT(idxBufs); b++)
 	{
+		RDCASSERT(idxBufs[b].count <= 128);
+
+		BindingMask mask;
+		if(state >= WRITING)
+			for(int i=0; i < idxBufs[b].count; i++)
+				if(idxBufs[b].bufs[i].name || idxBufs[b].bufs[i].start || idxBufs[b].bufs[i].size)
+					mask.Set(i);
+
+		m_pSerialiser->Serialise<2>("BUFFER_BINDINGS", mask.bits);
+
 		for(int i=0; i < idxBufs[b].count; i++)
 		{
+			if(!mask.IsSet(i)) continue;
+
 			ResourceId ID = ResourceId();
 			if(state >= WRITING) ID = rm->GetID(BufferRes(ctx, idxBufs[b].bufs[i].name));
 			m_pSerialiser->Serialise("BUFFER_BINDING", ID);
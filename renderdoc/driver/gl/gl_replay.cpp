@@ -38,8 +38,17 @@ GLReplay::GLReplay()
 
 	RDCEraseEl(m_ReplayCtx);
 	m_DebugCtx = NULL;
+	m_DebugDataCreated = false;
 
 	m_OutputWindowID = 1;
+
+	m_PreviewGeneration = 0;
+
+	m_OverlayCacheBytes = 0;
+
+	m_PostVSUseCounter = 0;
+
+	m_SecondaryArenaVB = m_SecondaryArenaIB = 0;
 }
 
 void GLReplay::Shutdown()
@@ -61,14 +70,20 @@ void GLReplay::Shutdown()
 
 void GLReplay::ReadLogInitialisation()
 {
+	SCOPED_PROFILE("ReadLogInitialisation");
+
 	MakeCurrentReplayContext(&m_ReplayCtx);
 	m_pDriver->ReadLogInitialisation();
 }
 
 void GLReplay::ReplayLog(uint32_t frameID, uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType)
 {
+	SCOPED_PROFILE("ReplayLog");
+
 	MakeCurrentReplayContext(&m_ReplayCtx);
 	m_pDriver->ReplayLog(frameID, startEventID, endEventID, replayType);
+
+	m_PreviewGeneration++;
 }
 
 vector<FetchFrameRecord> GLReplay::GetFrameRecord()
@@ -91,6 +106,11 @@ APIProperties GLReplay::GetAPIProperties()
 	return ret;
 }
 
+uint64_t GLReplay::GetReplayDeviceHash()
+{
+	return m_pDriver->GetDriverHash();
+}
+
 vector<ResourceId> GLReplay::GetBuffers()
 {
 	vector<ResourceId> ret;
@@ -358,6 +378,16 @@ vector<byte> GLReplay::GetBufferData(ResourceId buff, uint32_t offset, uint32_t
 	return ret;
 }
 
+byte *GLReplay::GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize)
+{
+	return FetchTextureRegion(this, tex, arrayIdx, mip, x, y, width, height, dataSize);
+}
+
+vector<byte> GLReplay::GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows)
+{
+	return FetchStridedBufferData(this, buff, offset, stride, rowSize, numRows);
+}
+
 bool GLReplay::IsRenderOutput(ResourceId id)
 {
 	for(int32_t i=0; i < m_CurPipelineState.m_FB.m_DrawFBO.Color.count; i++)
@@ -797,6 +827,13 @@ ShaderReflection *GLReplay::GetShader(ResourceId id)
 	return &shaderDetails.reflection;
 }
 
+// enum names in the pipeline state don't have the GL_ prefix
+static const char *PipelineEnumString(GLenum e)
+{
+	const char *name = GLEnumName(e);
+	return name ? name + 3 : "Unknown"; // 3 == strlen("GL_")
+}
+
 void GLReplay::SavePipelineState()
 {
 	GLPipelineState &pipe = m_CurPipelineState;
@@ -1352,7 +1389,7 @@ void GLReplay::SavePipelineState()
 						gl.glGetSamplerParameteriv(samp, eGL_TEXTURE_COMPARE_FUNC, &v);
 					else
 						gl.glGetTexParameteriv(target, eGL_TEXTURE_COMPARE_FUNC, &v);
-					pipe.Samplers[unit].Comparison = ToStr::Get((GLenum)v).substr(3).c_str();
+					pipe.Samplers[unit].Comparison = PipelineEnumString((GLenum)v);
 
 					v=0;
 					if(samp != 0)
@@ -1591,7 +1628,7 @@ void GLReplay::SavePipelineState()
 
 	pipe.m_DepthState.DepthEnable = rs.Enabled[GLRenderState::eEnabled_DepthTest];
 	pipe.m_DepthState.DepthWrites = rs.DepthWriteMask != 0;
-	pipe.m_DepthState.DepthFunc = ToStr::Get(rs.DepthFunc).substr(3);
+	pipe.m_DepthState.DepthFunc = PipelineEnumString(rs.DepthFunc);
 
 	pipe.m_DepthState.DepthBounds = rs.Enabled[GLRenderState::eEnabled_DepthBoundsEXT];
 	pipe.m_DepthState.NearBound = rs.DepthBounds.nearZ;
@@ -1601,17 +1638,17 @@ void GLReplay::SavePipelineState()
 	pipe.m_StencilState.m_FrontFace.ValueMask = rs.StencilFront.valuemask;
 	pipe.m_StencilState.m_FrontFace.WriteMask = rs.StencilFront.writemask;
 	pipe.m_StencilState.m_FrontFace.Ref = rs.StencilFront.ref;
-	pipe.m_StencilState.m_FrontFace.Func = ToStr::Get(rs.StencilFront.func).substr(3);
-	pipe.m_StencilState.m_FrontFace.PassOp = ToStr::Get(rs.StencilFront.pass).substr(3);
-	pipe.m_StencilState.m_FrontFace.FailOp = ToStr::Get(rs.StencilFront.stencilFail).substr(3);
-	pipe.m_StencilState.m_FrontFace.DepthFailOp = ToStr::Get(rs.StencilFront.depthFail).substr(3);
+	pipe.m_StencilState.m_FrontFace.Func = PipelineEnumString(rs.StencilFront.func);
+	pipe.m_StencilState.m_FrontFace.PassOp = PipelineEnumString(rs.StencilFront.pass);
+	pipe.m_StencilState.m_FrontFace.FailOp = PipelineEnumString(rs.StencilFront.stencilFail);
+	pipe.m_StencilState.m_FrontFace.DepthFailOp = PipelineEnumString(rs.StencilFront.depthFail);
 	pipe.m_StencilState.m_BackFace.ValueMask = rs.StencilBack.valuemask;
 	pipe.m_StencilState.m_BackFace.WriteMask = rs.StencilBack.writemask;
 	pipe.m_StencilState.m_BackFace.Ref = rs.StencilBack.ref;
-	pipe.m_StencilState.m_BackFace.Func = ToStr::Get(rs.StencilBack.func).substr(3);
-	pipe.m_StencilState.m_BackFace.PassOp = ToStr::Get(rs.StencilBack.pass).substr(3);
-	pipe.m_StencilState.m_BackFace.FailOp = ToStr::Get(rs.StencilBack.stencilFail).substr(3);
-	pipe.m_StencilState.m_BackFace.DepthFailOp = ToStr::Get(rs.StencilBack.depthFail).substr(3);
+	pipe.m_StencilState.m_BackFace.Func = PipelineEnumString(rs.StencilBack.func);
+	pipe.m_StencilState.m_BackFace.PassOp = PipelineEnumString(rs.StencilBack.pass);
+	pipe.m_StencilState.m_BackFace.FailOp = PipelineEnumString(rs.StencilBack.stencilFail);
+	pipe.m_StencilState.m_BackFace.DepthFailOp = PipelineEnumString(rs.StencilBack.depthFail);
 
 	// Frame buffer
 
@@ -1722,7 +1759,7 @@ void GLReplay::SavePipelineState()
 		pipe.m_FB.m_Blending.Blends[i].Enabled = rs.Blends[i].Enabled;
 		pipe.m_FB.m_Blending.Blends[i].LogicOp = "";
 		if(rs.LogicOp != eGL_NONE && rs.LogicOp != eGL_COPY && rs.Enabled[GLRenderState::eEnabled_ColorLogicOp])
-			pipe.m_FB.m_Blending.Blends[i].LogicOp = ToStr::Get(rs.LogicOp).substr(3); // 3 == strlen("GL_")
+			pipe.m_FB.m_Blending.Blends[i].LogicOp = PipelineEnumString(rs.LogicOp);
 
 		pipe.m_FB.m_Blending.Blends[i].m_Blend.Source = BlendString(rs.Blends[i].SourceRGB);
 		pipe.m_FB.m_Blending.Blends[i].m_Blend.Destination = BlendString(rs.Blends[i].DestinationRGB);
@@ -2004,6 +2041,8 @@ void GLReplay::FillCBufferVariables(ResourceId shader, uint32_t cbufSlot, vector
 
 byte *GLReplay::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip, bool resolve, bool forceRGBA8unorm, float blackPoint, float whitePoint, size_t &dataSize)
 {
+	EnsureDebugData();
+
 	WrappedOpenGL &gl = *m_pDriver;
 	
 	auto &texDetails = m_pDriver->m_Textures[tex];
@@ -2021,6 +2060,9 @@ byte *GLReplay::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip,
 	GLsizei arraysize = 1;
 	GLint samples = texDetails.samples;
 
+	// set if the rows were already put in conventional order while rendering a conversion
+	bool rowsFlipped = false;
+
 	if(texType == eGL_TEXTURE_BUFFER)
 	{
 		GLuint bufName = 0;
@@ -2098,7 +2140,9 @@ byte *GLReplay::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip,
 			texDisplay.HDRMul = -1.0f;
 			texDisplay.linearDisplayAsGamma = false;
 			texDisplay.overlay = eTexOverlay_None;
-			texDisplay.FlipY = false;
+			// flipped relative to a normal display, so the rows come out in conventional order
+			// without flipping them on the CPU afterwards
+			texDisplay.FlipY = true;
 			texDisplay.mip = mip;
 			texDisplay.sampleIdx = ~0U;
 			texDisplay.CustomShader = ResourceId();
@@ -2129,6 +2173,7 @@ byte *GLReplay::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip,
 		if(newtarget == eGL_TEXTURE_2D) depth = 1;
 		arraysize = 1;
 		samples = 1;
+		rowsFlipped = true;
 
 		gl.glDeleteFramebuffers(1, &fbo);
 	}
@@ -2259,7 +2304,7 @@ byte *GLReplay::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip,
 
 			// need to vertically flip the image now to get conventional row ordering
 			// we either do this when copying out the slice of interest, or just
-			// on its own
+			// on its own. A converted texture was rendered flipped and is already done.
 			size_t rowSize = GetByteSize(width, 1, 1, fmt, type);
 			byte *src, *dst;
 
@@ -2290,7 +2335,7 @@ byte *GLReplay::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip,
 
 				ret = slice;
 			}
-			else
+			else if(!rowsFlipped)
 			{
 				byte *row = new byte[rowSize];
 				
@@ -2376,6 +2421,8 @@ void GLReplay::BuildCustomShader(string source, string entry, const uint32_t com
 
 ResourceId GLReplay::ApplyCustomShader(ResourceId shader, ResourceId texid, uint32_t mip)
 {
+	EnsureDebugData();
+
 	if(shader == ResourceId() || texid == ResourceId()) return ResourceId();
 
 	auto &texDetails = m_pDriver->m_Textures[texid];
@@ -2505,12 +2552,19 @@ void GLReplay::ReplaceResource(ResourceId from, ResourceId to)
 {
 	MakeCurrentReplayContext(&m_ReplayCtx);
 	m_pDriver->ReplaceResource(from, to);
+
+	// draws may render differently now
+	DebugData.quadLastEvent = 0;
+	ClearOverlayCache();
 }
 
 void GLReplay::RemoveReplacement(ResourceId id)
 {
 	MakeCurrentReplayContext(&m_ReplayCtx);
 	m_pDriver->RemoveReplacement(id);
+
+	DebugData.quadLastEvent = 0;
+	ClearOverlayCache();
 }
 
 void GLReplay::FreeTargetResource(ResourceId id)
@@ -2719,6 +2773,82 @@ void GLReplay::SetProxyTextureData(ResourceId texid, uint32_t arrayIdx, uint32_t
 
 }
 
+void GLReplay::SetProxyTextureRegion(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, byte *data, size_t dataSize)
+{
+	WrappedOpenGL &gl = *m_pDriver;
+	
+	GLuint tex = m_pDriver->GetResourceManager()->GetCurrentResource(texid).name;
+
+	auto &texdetails = m_pDriver->m_Textures[texid];
+	
+	GLenum fmt = texdetails.internalFormat;
+	GLenum target = texdetails.curType;
+
+	if(IsCompressedFormat(fmt))
+	{
+		RDCERR("Compressed proxy textures can't be updated by region");
+		return;
+	}
+
+	GLenum baseformat = GetBaseFormat(fmt);
+	GLenum datatype = GetDataType(fmt);
+
+	if(dataSize < GetByteSize(width, height, 1, baseformat, datatype))
+	{
+		RDCERR("Insufficient data provided to SetProxyTextureRegion");
+		return;
+	}
+
+	PixelUnpackState unpack;
+	unpack.Fetch(&gl.GetHookset(), false);
+
+	PixelUnpackState identity = {0};
+	identity.alignment = 1;
+	identity.Apply(&gl.GetHookset(), false);
+
+	if(target == eGL_TEXTURE_1D)
+	{
+		gl.glTextureSubImage1DEXT(tex, target, (GLint)mip, x, width, baseformat, datatype, data);
+	}
+	else if(target == eGL_TEXTURE_1D_ARRAY)
+	{
+		gl.glTextureSubImage2DEXT(tex, target, (GLint)mip, x, (GLint)arrayIdx, width, 1, baseformat, datatype, data);
+	}
+	else if(target == eGL_TEXTURE_2D)
+	{
+		gl.glTextureSubImage2DEXT(tex, target, (GLint)mip, x, y, width, height, baseformat, datatype, data);
+	}
+	else if(target == eGL_TEXTURE_2D_ARRAY || target == eGL_TEXTURE_CUBE_MAP_ARRAY)
+	{
+		gl.glTextureSubImage3DEXT(tex, target, (GLint)mip, x, y, (GLint)arrayIdx, width, height, 1, baseformat, datatype, data);
+	}
+	else if(target == eGL_TEXTURE_CUBE_MAP)
+	{
+		GLenum targets[] = {
+			eGL_TEXTURE_CUBE_MAP_POSITIVE_X,
+			eGL_TEXTURE_CUBE_MAP_NEGATIVE_X,
+			eGL_TEXTURE_CUBE_MAP_POSITIVE_Y,
+			eGL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
+			eGL_TEXTURE_CUBE_MAP_POSITIVE_Z,
+			eGL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
+		};
+		
+		RDCASSERT(arrayIdx < ARRAY_COUNT(targets));
+		target = targets[arrayIdx];
+
+		gl.glTextureSubImage2DEXT(tex, target, (GLint)mip, x, y, width, height, baseformat, datatype, data);
+	}
+	else
+	{
+		RDCERR("Unsupported texture type for SetProxyTextureRegion");
+	}
+
+	unpack.Apply(&gl.GetHookset(), false);
+
+	// any downsampled preview was made before this part was filled in
+	m_PreviewGeneration++;
+}
+
 ResourceId GLReplay::CreateProxyBuffer(FetchBuffer templateBuf)
 {
 	WrappedOpenGL &gl = *m_pDriver;
@@ -30,6 +30,8 @@
 #include "replay/replay_driver.h"
 #include "core/core.h"
 
+#include <list>
+
 using std::pair;
 using std::map;
 
@@ -58,11 +60,15 @@ struct GLPostVSData
 		float farPlane;
 	} vsin, vsout, gsout;
 
+	// when this was last fetched, for evicting from the cache
+	uint64_t lastUse;
+
 	GLPostVSData()
 	{
 		RDCEraseEl(vsin);
 		RDCEraseEl(vsout);
 		RDCEraseEl(gsout);
+		lastUse = 0;
 	}
 
 	const StageData &GetStage(MeshDataStage type)
@@ -85,6 +91,7 @@ class GLReplay : public IReplayDriver
 
 		void SetProxy(bool p) { m_Proxy = p; }
 		bool IsRemoteProxy() { return m_Proxy; }
+		uint64_t GetReplayDeviceHash();
 
 		void Shutdown();
 
@@ -136,14 +143,16 @@ class GLReplay : public IReplayDriver
 		MeshFormat GetPostVSBuffers(uint32_t frameID, uint32_t eventID, uint32_t instID, MeshDataStage stage);
 		
 		vector<byte> GetBufferData(ResourceId buff, uint32_t offset, uint32_t len);
+		vector<byte> GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows);
 		byte *GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip, bool resolve, bool forceRGBA8unorm, float blackPoint, float whitePoint, size_t &dataSize);
+		byte *GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize);
 		
 		void ReplaceResource(ResourceId from, ResourceId to);
 		void RemoveReplacement(ResourceId id);
 		
 		vector<uint32_t> EnumerateCounters();
 		void DescribeCounter(uint32_t counterID, CounterDescription &desc);
-		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters);
+		vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters, uint32_t numRuns);
 
 		void RenderMesh(uint32_t frameID, uint32_t eventID, const vector<MeshFormat> &secondaryDraws, MeshDisplay cfg);
 		
@@ -171,6 +180,7 @@ class GLReplay : public IReplayDriver
 			
 		ResourceId CreateProxyTexture(FetchTexture templateTex);
 		void SetProxyTextureData(ResourceId texid, uint32_t arrayIdx, uint32_t mip, byte *data, size_t dataSize);
+		void SetProxyTextureRegion(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, byte *data, size_t dataSize);
 		
 		ResourceId CreateProxyBuffer(FetchBuffer templateBuf);
 		void SetProxyBufferData(ResourceId bufid, byte *data, size_t dataSize);
@@ -297,6 +307,14 @@ class GLReplay : public IReplayDriver
 			GLuint overlayPipe;
 			GLint overlayTexWidth, overlayTexHeight;
 
+			// quad overdraw targets. For the pass overlay these hold every draw in the pass from
+			// quadFirstEvent up to quadLastEvent (0 if nothing is cached), so that stepping forward
+			// through a pass only needs to add the new draws
+			GLuint quadFBO;
+			GLuint quadTexs[3];
+			GLint quadTexWidth, quadTexHeight;
+			uint32_t quadFrameID, quadFirstEvent, quadLastEvent;
+
 			GLuint UBOs[2];
 
 			GLuint emptyVAO;
@@ -323,15 +341,36 @@ class GLReplay : public IReplayDriver
 		// <frame,instance> -> data
 		map< pair<uint32_t,uint32_t>, GLPostVSData > m_PostVSData;
 
+		// once the buffers held in m_PostVSData add up to more than this, the least
+		// recently used events' are deleted
+		static const uint64_t PostVSCacheBudget = 256*1024*1024;
+		uint64_t m_PostVSUseCounter;
+
+		void CreatePostVSBuffers(uint32_t frameID, uint32_t eventID);
+		void TrimPostVSCache();
+
+		// secondary draws packed into one vertex/index buffer, rebuilt when the draws change
+		SecondaryMeshArena m_SecondaryArena;
+		GLuint m_SecondaryArenaVB;
+		GLuint m_SecondaryArenaIB;
+
+		void UpdateSecondaryArena(const vector<MeshFormat> &secondaryDraws);
+
+		// creates the debug context, and the shaders and resources DebugData holds unless this
+		// is a headless replay. Then they're created by EnsureDebugData() the first time a
+		// function needs them, which leaves the debug context current.
 		void InitDebugData();
+		void CreateDebugData();
+		void EnsureDebugData() { if(!m_DebugDataCreated && m_DebugCtx) { CreateDebugData(); MakeCurrentReplayContext(m_DebugCtx); } }
 		void DeleteDebugData();
+		bool m_DebugDataCreated;
 		
 		// called after the context is created, to init any counters
 		void PostContextInitCounters();
 		// called before the context is destroyed, to shutdown any counters
 		void PreContextShutdownCounters();
 		
-		void FillTimers(CounterContext &ctx, const DrawcallTreeNode &drawnode);
+		void FillQueries(CounterContext &ctx, const DrawcallTreeNode &drawnode);
 
 		GLuint CreateShaderProgram(const char *vs, const char *fs, const char *gs = NULL);
 		GLuint CreateCShaderProgram(const char *cs);
@@ -354,6 +393,44 @@ class GLReplay : public IReplayDriver
 		
 		void CacheTexture(ResourceId id);
 
+		// downsampled copies of large textures, for displaying them zoomed out. Level N of a
+		// preview holds mip N+1 of the texture's top mip, regenerated when the replay moves.
+		struct TexturePreview
+		{
+			ResourceId id;
+			GLuint tex;
+			GLint levels;
+			uint32_t generation;
+		};
+
+		static const GLint PreviewMinSize = 4096;
+		static const size_t NumCachedPreviews = 4;
+
+		std::list<TexturePreview> m_TexturePreviews;
+		uint32_t m_PreviewGeneration;
+
+		GLuint GetTexturePreview(ResourceId id, GLuint texname, GLint &levels);
+
+		// copies of recently rendered overlays, most recent first, so that flipping back to a
+		// texture or event that was just viewed doesn't render the overlay again
+		struct CachedOverlay
+		{
+			ResourceId texid;
+			TextureDisplayOverlay overlay;
+			uint32_t frameID, eventID;
+			vector<uint32_t> passEvents;
+			GLuint tex;
+			uint64_t bytes;
+		};
+
+		static const uint64_t OverlayCacheBudget = 128*1024*1024;
+
+		std::list<CachedOverlay> m_OverlayCache;
+		uint64_t m_OverlayCacheBytes;
+
+		void CacheOverlay(ResourceId texid, TextureDisplayOverlay overlay, uint32_t frameID, uint32_t eventID, const vector<uint32_t> &passEvents);
+		void ClearOverlayCache();
+
 		map<ResourceId, FetchTexture> m_CachedTextures;
 
 		WrappedOpenGL *m_pDriver;
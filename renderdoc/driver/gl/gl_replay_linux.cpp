@@ -32,6 +32,7 @@
 typedef Bool (*PFNGLXMAKECURRENTPROC)(Display *dpy, GLXDrawable drawable, GLXContext ctx);
 typedef void (*PFNGLXDESTROYCONTEXTPROC)(Display *dpy, GLXContext ctx);
 typedef void (*PFNGLXSWAPBUFFERSPROC)(Display *dpy, GLXDrawable drawable);
+typedef const char *(*PFNGLXQUERYEXTENSIONSSTRINGPROC)(Display *dpy, int screen);
 
 PFNGLXCHOOSEFBCONFIGPROC glXChooseFBConfigProc = NULL;
 PFNGLXCREATEPBUFFERPROC glXCreatePbufferProc = NULL;
@@ -42,6 +43,8 @@ PFNGLXMAKECONTEXTCURRENTPROC glXMakeContextCurrentProc = NULL;
 PFNGLXQUERYDRAWABLEPROC glXQueryDrawableProc = NULL;
 PFNGLXDESTROYCONTEXTPROC glXDestroyCtxProc = NULL;
 PFNGLXSWAPBUFFERSPROC glXSwapProc = NULL;
+PFNGLXQUERYEXTENSIONSSTRINGPROC glXQueryExtStringProc = NULL;
+PFNGLXSWAPINTERVALEXTPROC glXSwapIntervalProc = NULL;
 
 void GLReplay::MakeCurrentReplayContext(GLWindowingData *ctx)
 {
@@ -71,6 +74,8 @@ void GLReplay::CloseReplayContext()
 
 uint64_t GLReplay::MakeOutputWindow(void *wn, bool depth)
 {
+	EnsureDebugData();
+
 	void **displayAndDrawable = (void **)wn;
 
 	Display *dpy = NULL;
@@ -153,6 +158,14 @@ uint64_t GLReplay::MakeOutputWindow(void *wn, bool depth)
 
 	MakeCurrentReplayContext(&win);
 
+	// don't wait for vsync on output windows, or each one displayed waits in turn
+	if(wn && glXSwapIntervalProc && glXQueryExtStringProc)
+	{
+		const char *exts = glXQueryExtStringProc(dpy, DefaultScreen(dpy));
+		if(exts && strstr(exts, "GLX_EXT_swap_control"))
+			glXSwapIntervalProc(dpy, wnd, 0);
+	}
+
 	InitOutputWindow(win);
 	CreateOutputWindowBackbuffer(win, depth);
 
@@ -226,6 +239,10 @@ ReplayCreateStatus GL_CreateReplayDevice(const char *logfile, IReplayDriver **dr
 		glXCreateContextAttribsProc = (PFNGLXCREATECONTEXTATTRIBSARBPROC)glXGetFuncProc((const GLubyte*)"glXCreateContextAttribsARB");
 		glXMakeContextCurrentProc = (PFNGLXMAKECONTEXTCURRENTPROC)glXGetFuncProc((const GLubyte*)"glXMakeContextCurrent");
 
+		// optional, only used if GLX_EXT_swap_control is supported
+		glXQueryExtStringProc = (PFNGLXQUERYEXTENSIONSSTRINGPROC)dlsym(RTLD_NEXT, "glXQueryExtensionsString");
+		glXSwapIntervalProc = (PFNGLXSWAPINTERVALEXTPROC)glXGetFuncProc((const GLubyte*)"glXSwapIntervalEXT");
+
 		if(glXCreateContextAttribsProc == NULL || glXMakeContextCurrentProc == NULL)
 		{
 			RDCERR("Couldn't get glx function addresses, glXCreateContextAttribsARB glXMakeContextCurrent");
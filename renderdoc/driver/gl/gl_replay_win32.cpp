@@ -29,6 +29,7 @@
 
 PFNWGLCREATECONTEXTATTRIBSARBPROC createContextAttribs = NULL;
 PFNWGLGETPIXELFORMATATTRIBIVARBPROC getPixelFormatAttrib = NULL;
+PFNWGLSWAPINTERVALEXTPROC swapInterval = NULL;
 
 typedef PROC (WINAPI *WGLGETPROCADDRESSPROC)(const char*);
 typedef HGLRC (WINAPI *WGLCREATECONTEXTPROC)(HDC);
@@ -70,6 +71,8 @@ void GLReplay::CloseReplayContext()
 
 uint64_t GLReplay::MakeOutputWindow(void *wn, bool depth)
 {
+	EnsureDebugData();
+
 	HWND w = (HWND)wn;
 
 	if(w == NULL)
@@ -184,6 +187,13 @@ uint64_t GLReplay::MakeOutputWindow(void *wn, bool depth)
 
 	m_pDriver->RegisterContext(win, m_ReplayCtx.ctx, true, true);
 
+	// don't wait for vsync on output windows, or each one displayed waits in turn
+	if(swapInterval)
+	{
+		MakeCurrentReplayContext(&win);
+		swapInterval(0);
+	}
+
 	InitOutputWindow(win);
 	CreateOutputWindowBackbuffer(win, depth);
 
@@ -334,6 +344,8 @@ ReplayCreateStatus GL_CreateReplayDevice(const char *logfile, IReplayDriver **dr
 
 	createContextAttribs = (PFNWGLCREATECONTEXTATTRIBSARBPROC)wglGetProc("wglCreateContextAttribsARB");
 	getPixelFormatAttrib = (PFNWGLGETPIXELFORMATATTRIBIVARBPROC)wglGetProc("wglGetPixelFormatAttribivARB");
+	// optional, WGL_EXT_swap_control
+	swapInterval = (PFNWGLSWAPINTERVALEXTPROC)wglGetProc("wglSwapIntervalEXT");
 
 	if(createContextAttribs == NULL || getPixelFormatAttrib == NULL)
 	{
@@ -0,0 +1,182 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Crytek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include "driver/gl/gl_resources.h"
+
+#include <map>
+#include <vector>
+#include <utility>
+
+// a map from GLResource to V, for the name lookups that happen on nearly every wrapped
+// call. Names handed out by glGen* are small and dense within each namespace, so for each
+// context and namespace they index straight into an array. Anything else (names beyond
+// DenseNameLimit, unknown namespaces) falls back to a std::map.
+//
+// A value of V() means "not present", so V must be something like a pointer or ResourceId
+// where the default value is never a valid entry.
+template<typename V>
+class GLResourceMap
+{
+	public:
+		GLResourceMap() : m_Size(0) {}
+		~GLResourceMap() { clear(); }
+
+		// returns NULL if res isn't in the map
+		V *find(const GLResource &res)
+		{
+			std::vector<V> *slots = GetSlots(res, false);
+
+			if(slots)
+			{
+				if(res.name < slots->size() && (*slots)[res.name] != V())
+					return &(*slots)[res.name];
+				return NULL;
+			}
+
+			typename std::map<GLResource, V>::iterator it = m_Sparse.find(res);
+			if(it != m_Sparse.end())
+				return &it->second;
+
+			return NULL;
+		}
+
+		void insert(const GLResource &res, V value)
+		{
+			RDCASSERT(value != V());
+
+			std::vector<V> *slots = GetSlots(res, true);
+
+			V *slot = NULL;
+
+			if(slots)
+			{
+				if(res.name >= slots->size())
+					slots->resize(RDCMIN(RDCMAX((size_t)res.name+1, slots->size()*2), (size_t)DenseNameLimit), V());
+				slot = &(*slots)[res.name];
+			}
+			else
+			{
+				slot = &m_Sparse[res];
+			}
+
+			if(*slot == V())
+				m_Size++;
+			*slot = value;
+		}
+
+		void erase(const GLResource &res)
+		{
+			V *slot = find(res);
+			if(slot == NULL)
+				return;
+
+			if(GetSlots(res, false))
+				*slot = V();
+			else
+				m_Sparse.erase(res);
+
+			m_Size--;
+		}
+
+		// fills out every resource in the map, in no particular order
+		void keys(std::vector<GLResource> &out) const
+		{
+			for(size_t t=0; t < m_Tables.size(); t++)
+			{
+				for(int n=0; n < NumNamespaces; n++)
+				{
+					const std::vector<V> &slots = m_Tables[t]->slots[n];
+					for(size_t i=0; i < slots.size(); i++)
+						if(slots[i] != V())
+							out.push_back(GLResource(m_Tables[t]->ctx, (GLNamespace)n, (GLuint)i));
+				}
+			}
+
+			for(typename std::map<GLResource, V>::const_iterator it=m_Sparse.begin(); it != m_Sparse.end(); ++it)
+				out.push_back(it->first);
+		}
+
+		size_t size() const { return m_Size; }
+		bool empty() const { return m_Size == 0; }
+
+		void clear()
+		{
+			for(size_t t=0; t < m_Tables.size(); t++)
+				delete m_Tables[t];
+			m_Tables.clear();
+			m_Sparse.clear();
+			m_Size = 0;
+		}
+
+	private:
+		// no copy semantics
+		GLResourceMap(const GLResourceMap &);
+		GLResourceMap &operator =(const GLResourceMap &);
+
+		static const int NumNamespaces = eResSync+1;
+
+		// well above what glGen* hands out in practice, but stops a stray large name
+		// allocating a huge array
+		static const GLuint DenseNameLimit = 256*1024;
+
+		struct ContextTable
+		{
+			void *ctx;
+			std::vector<V> slots[NumNamespaces];
+		};
+
+		// most namespaces are shared and use a NULL context, so there are only ever a few
+		// of these and a linear search is fine.
+		std::vector<ContextTable *> m_Tables;
+		std::map<GLResource, V> m_Sparse;
+		size_t m_Size;
+
+		std::vector<V> *GetSlots(const GLResource &res, bool create)
+		{
+			if(res.Namespace <= eResUnknown || res.Namespace >= NumNamespaces || res.name >= DenseNameLimit)
+				return NULL;
+
+			for(size_t t=0; t < m_Tables.size(); t++)
+				if(m_Tables[t]->ctx == res.Context)
+					return &m_Tables[t]->slots[res.Namespace];
+
+			if(!create)
+			{
+				// this resource would be in a table that doesn't exist yet, so it's not present.
+				// Report empty dense storage rather than falling back to the sparse map
+				return &m_EmptySlots;
+			}
+
+			ContextTable *table = new ContextTable();
+			table->ctx = res.Context;
+			m_Tables.push_back(table);
+
+			return &table->slots[res.Namespace];
+		}
+
+		std::vector<V> m_EmptySlots;
+};
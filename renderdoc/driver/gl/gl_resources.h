@@ -134,6 +134,9 @@ struct GLResourceRecord : public ResourceRecord
 	{
 		RDCEraseEl(ShadowPtr);
 		RDCEraseEl(Map);
+		ShadowSize = 0;
+		ShadowWatched = false;
+		ShadowLarge = false;
 	}
 
 	~GLResourceRecord()
@@ -187,8 +190,45 @@ struct GLResourceRecord : public ResourceRecord
 	{
 		if(ShadowPtr[0] == NULL)
 		{
-			ShadowPtr[0] = Serialiser::AllocAlignedBuffer(size, alignment);
-			ShadowPtr[1] = Serialiser::AllocAlignedBuffer(size, alignment);
+			// both copies are compared in full, so big ones go in large pages where possible.
+			// Those are page aligned, which covers any alignment asked for.
+			ShadowPtr[0] = (byte *)LargePage::Alloc(size);
+			if(ShadowPtr[0])
+				ShadowPtr[1] = (byte *)LargePage::Alloc(size);
+
+			if(ShadowPtr[1])
+			{
+				ShadowLarge = true;
+			}
+			else
+			{
+				LargePage::Free(ShadowPtr[0], size);
+
+				ShadowPtr[0] = Serialiser::AllocAlignedBuffer(size, alignment);
+				ShadowPtr[1] = Serialiser::AllocAlignedBuffer(size, alignment);
+			}
+			ShadowSize = size;
+		}
+	}
+
+	// as AllocShadowStorage, but writes to the first shadow copy are watched so that changes
+	// can be found with GetWrittenShadowPages instead of comparing the whole buffer. Falls
+	// back to normal storage if the memory can't be watched.
+	void AllocWatchedShadowStorage(size_t size)
+	{
+		if(ShadowPtr[0] == NULL)
+		{
+			ShadowPtr[0] = (byte *)WriteWatch::Alloc(size);
+
+			if(ShadowPtr[0] == NULL)
+			{
+				AllocShadowStorage(size, 64);
+				return;
+			}
+
+			ShadowPtr[1] = Serialiser::AllocAlignedBuffer(size, 64);
+			ShadowSize = size;
+			ShadowWatched = true;
 		}
 	}
 
@@ -196,10 +236,36 @@ struct GLResourceRecord : public ResourceRecord
 	{
 		if(ShadowPtr[0] != NULL)
 		{
-			Serialiser::FreeAlignedBuffer(ShadowPtr[0]);
-			Serialiser::FreeAlignedBuffer(ShadowPtr[1]);
+			if(ShadowLarge)
+			{
+				LargePage::Free(ShadowPtr[0], ShadowSize);
+				LargePage::Free(ShadowPtr[1], ShadowSize);
+			}
+			else
+			{
+				if(ShadowWatched)
+					WriteWatch::Free(ShadowPtr[0], ShadowSize);
+				else
+					Serialiser::FreeAlignedBuffer(ShadowPtr[0]);
+				Serialiser::FreeAlignedBuffer(ShadowPtr[1]);
+			}
 		}
 		ShadowPtr[0] = ShadowPtr[1] = NULL;
+		ShadowLarge = false;
+		ShadowSize = 0;
+		ShadowWatched = false;
+	}
+
+	bool IsShadowWatched()
+	{
+		return ShadowWatched;
+	}
+
+	// appends the offsets of pages of the first shadow copy written since the last call,
+	// only valid if IsShadowWatched()
+	void GetWrittenShadowPages(vector<size_t> &pageOffsets)
+	{
+		WriteWatch::GetWrittenPages(ShadowPtr[0], ShadowSize, pageOffsets);
 	}
 	
 	byte *GetShadowPtr(int p)
@@ -207,8 +273,16 @@ struct GLResourceRecord : public ResourceRecord
 		return ShadowPtr[p];
 	}
 
+	uint64_t GetShadowMemory()
+	{
+		return ShadowPtr[0] ? 2*ShadowSize : 0;
+	}
+
 private:
 	byte *ShadowPtr[2];
+	size_t ShadowSize;
+	bool ShadowWatched;
+	bool ShadowLarge;
 };
 
 namespace TrackedResource
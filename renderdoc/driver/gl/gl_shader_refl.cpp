@@ -181,6 +181,9 @@ static GLuint CreateSepProgram(const GLHookSet &gl, GLenum type, GLsizei numSour
 			gl.glGetShaderiv(shader, eGL_COMPILE_STATUS, &compiled);
 			gl.glProgramParameteri(program, eGL_PROGRAM_SEPARABLE, GL_TRUE);
 
+			// some drivers only keep a binary around to give to the program binary cache with this
+			gl.glProgramParameteri(program, eGL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 			if(compiled)
 			{
 				gl.glAttachShader(program, shader);
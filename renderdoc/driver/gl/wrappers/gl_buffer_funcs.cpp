@@ -368,7 +368,10 @@ void WrappedOpenGL::Common_glNamedBufferStorageEXT(ResourceId id, GLsizeiptr siz
 			RDCASSERT(record->Map.persistentPtr);
 
 			// persistent maps always need both sets of shadow storage, so allocate up front.
-			record->AllocShadowStorage(size, 64);
+			if(RenderDoc::Inst().GetCaptureOptions().TrackPersistentMapWrites)
+				record->AllocWatchedShadowStorage(size);
+			else
+				record->AllocShadowStorage(size, 64);
 		}
 	}
 	else
@@ -708,7 +711,7 @@ bool WrappedOpenGL::Serialise_glNamedBufferSubDataEXT(GLuint buffer, GLintptr of
 	SERIALISE_ELEMENT(ResourceId, id, GetResourceManager()->GetID(BufferRes(GetCtx(), buffer)));
 	SERIALISE_ELEMENT(uint64_t, Offset, (uint64_t)offset);
 	SERIALISE_ELEMENT(uint64_t, Bytesize, (uint64_t)size);
-	SERIALISE_ELEMENT_BUF(byte *, bytes, data, (size_t)Bytesize);
+	SERIALISE_ELEMENT_BUF_EXTERNAL(byte *, bytes, data, (size_t)Bytesize);
 
 	if(m_State < WRITING)
 	{
@@ -721,6 +724,76 @@ bool WrappedOpenGL::Serialise_glNamedBufferSubDataEXT(GLuint buffer, GLintptr of
 	return true;
 }
 
+bool WrappedOpenGL::MergeBufferSubData(GLResourceRecord *record, GLintptr offset, GLsizeiptr size, const void *data)
+{
+	if(m_State != WRITING_CAPFRAME || data == NULL || size <= 0 || offset < 0)
+		return false;
+
+	PendingBufferSubData &pending = m_PendingSubData;
+
+	uint64_t start = (uint64_t)offset;
+	uint64_t end = start + (uint64_t)size;
+
+	uint64_t pendStart = pending.offset;
+	uint64_t pendEnd = pendStart + pending.data.size();
+
+	// only merge when there will be no gap. Anything that lands between or over the
+	// existing bytes is later in the frame, so it overwrites them. Otherwise write out
+	// what we have and start again with this update.
+	if(!pending.data.empty() &&
+	   (pending.id != record->GetResourceID() || pending.ctx != GetCtx() || start > pendEnd || end < pendStart))
+	{
+		SerialisePendingBufferSubData();
+	}
+
+	if(!pending.data.empty())
+	{
+		if(start < pendStart)
+		{
+			pending.data.insert(pending.data.begin(), (size_t)(pendStart - start), 0);
+			pending.offset = start;
+		}
+
+		if(end > pendEnd)
+			pending.data.resize((size_t)(end - pending.offset));
+
+		memcpy(&pending.data[(size_t)(start - pending.offset)], data, (size_t)size);
+
+		return true;
+	}
+
+	pending.id = record->GetResourceID();
+	pending.ctx = GetCtx();
+	pending.offset = start;
+	pending.data.assign((const byte *)data, (const byte *)data + size);
+
+	return true;
+}
+
+void WrappedOpenGL::SerialisePendingBufferSubData()
+{
+	// take the data out first, so serialising doesn't come back in here
+	vector<byte> data;
+	data.swap(m_PendingSubData.data);
+
+	{
+		SCOPED_SERIALISE_CONTEXT(BUFFERSUBDATA);
+
+		// must match Serialise_glNamedBufferSubDataEXT. The ID was stored rather than the
+		// name, since the current context might have changed since.
+		SERIALISE_ELEMENT(ResourceId, id, m_PendingSubData.id);
+		SERIALISE_ELEMENT(uint64_t, Offset, m_PendingSubData.offset);
+		SERIALISE_ELEMENT(uint64_t, Bytesize, (uint64_t)data.size());
+		SERIALISE_ELEMENT_BUF_EXTERNAL(byte *, bytes, &data[0], (size_t)Bytesize);
+
+		m_ContextRecord->AddChunk(scope.Get());
+	}
+
+	// keep the allocation around for the next batch
+	data.clear();
+	data.swap(m_PendingSubData.data);
+}
+
 void WrappedOpenGL::glNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
 {
 	m_Real.glNamedBufferSubDataEXT(buffer, offset, size, data);
@@ -733,6 +806,9 @@ void WrappedOpenGL::glNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsi
 		if(m_HighTrafficResources.find(record->GetResourceID()) != m_HighTrafficResources.end() && m_State != WRITING_CAPFRAME)
 			return;
 
+		if(MergeBufferSubData(record, offset, size, data))
+			return;
+
 		SCOPED_SERIALISE_CONTEXT(BUFFERSUBDATA);
 		Serialise_glNamedBufferSubDataEXT(buffer, offset, size, data);
 
@@ -749,8 +825,7 @@ void WrappedOpenGL::glNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsi
 				
 			if(record->UpdateCount > 10)
 			{
-				m_HighTrafficResources.insert(record->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+				MarkHighTraffic(record);
 			}
 		}
 	}
@@ -776,6 +851,9 @@ void WrappedOpenGL::glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr s
 		if(m_HighTrafficResources.find(record->GetResourceID()) != m_HighTrafficResources.end() && m_State != WRITING_CAPFRAME)
 			return;
 
+		if(MergeBufferSubData(record, offset, size, data))
+			return;
+
 		SCOPED_SERIALISE_CONTEXT(BUFFERSUBDATA);
 		Serialise_glNamedBufferSubDataEXT(res.name, offset, size, data);
 
@@ -790,8 +868,7 @@ void WrappedOpenGL::glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr s
 				
 			if(record->UpdateCount > 10)
 			{
-				m_HighTrafficResources.insert(record->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+				MarkHighTraffic(record);
 			}
 		}
 	}
@@ -866,8 +943,7 @@ void WrappedOpenGL::glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, G
 
 		if(GetResourceManager()->IsResourceDirty(readrecord->GetResourceID()) && m_State != WRITING_CAPFRAME)
 		{
-			m_HighTrafficResources.insert(writerecord->GetResourceID());
-			GetResourceManager()->MarkDirtyResource(writerecord->GetResourceID());
+			MarkHighTraffic(writerecord);
 			return;
 		}
 	
@@ -890,8 +966,7 @@ void WrappedOpenGL::glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, G
 
 			if(writerecord->UpdateCount > 60)
 			{
-				m_HighTrafficResources.insert(writerecord->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(writerecord->GetResourceID());
+				MarkHighTraffic(writerecord);
 			}
 		}
 	}
@@ -1590,6 +1665,9 @@ void *WrappedOpenGL::glMapNamedBufferRangeEXT(GLuint buffer, GLintptr offset, GL
 {
 	// see above for high-level explanation of how mapping is handled
 
+	m_FrameStats.Maps++;
+	m_FrameStats.BytesMapped += (uint64_t)length;
+
 	if(m_State >= WRITING)
 	{
 		GLResourceRecord *record = GetResourceManager()->GetResourceRecord(BufferRes(GetCtx(), buffer));
@@ -2185,23 +2263,66 @@ void WrappedOpenGL::PersistentMapMemoryBarrier(const set<GLResourceRecord *> &ma
 	// this function iterates over all the maps, checking for any changes between
 	// the shadow pointers, and propogates that to 'real' GL
 
+	vector<size_t> writtenPages;
+	vector< pair<size_t, size_t> > ranges;
+
 	for(set<GLResourceRecord *>::const_iterator it = maps.begin(); it != maps.end(); ++it)
 	{
 		GLResourceRecord *record = *it;
 
 		RDCASSERT(record && record->Map.persistentPtr);
-		
-		size_t diffStart = 0, diffEnd = 0;
-		bool found = FindDiffRange(record->GetShadowPtr(0), record->GetShadowPtr(1), (size_t)record->Length, diffStart, diffEnd);
-		if(found)
+
+		size_t length = (size_t)record->Length;
+
+		// ranges to compare, as (offset, length). If writes to the shadow pointer are watched
+		// only the runs of pages written to since last time can have changed.
+		ranges.clear();
+
+		if(record->IsShadowWatched())
 		{
-			// update the modified region in the 'comparison' shadow buffer for next check
-			memcpy(record->GetShadowPtr(1) + diffStart, record->GetShadowPtr(0) + diffStart, diffEnd - diffStart);
+			size_t pageSize = WriteWatch::PageSize();
 
-			// we use our own flush function so it will serialise chunks when necessary, and it
-			// also handles copying into the persistent mapped pointer and flushing the real GL
-			// buffer
-			glFlushMappedNamedBufferRangeEXT(record->Resource.name, GLintptr(diffStart), GLsizeiptr(diffEnd - diffStart));
+			writtenPages.clear();
+			record->GetWrittenShadowPages(writtenPages);
+
+			for(size_t p=0; p < writtenPages.size(); p++)
+			{
+				size_t offs = writtenPages[p];
+
+				if(offs >= length)
+					break;
+
+				if(!ranges.empty() && ranges.back().first + ranges.back().second == offs)
+					ranges.back().second += pageSize;
+				else
+					ranges.push_back(std::make_pair(offs, pageSize));
+			}
+
+			if(!ranges.empty())
+				ranges.back().second = RDCMIN(ranges.back().second, length - ranges.back().first);
+		}
+		else
+		{
+			ranges.push_back(std::make_pair((size_t)0, length));
+		}
+
+		for(size_t r=0; r < ranges.size(); r++)
+		{
+			byte *shadow0 = record->GetShadowPtr(0) + ranges[r].first;
+			byte *shadow1 = record->GetShadowPtr(1) + ranges[r].first;
+
+			size_t diffStart = 0, diffEnd = 0;
+			bool found = FindDiffRange(shadow0, shadow1, ranges[r].second, diffStart, diffEnd);
+			if(found)
+			{
+				// update the modified region in the 'comparison' shadow buffer for next check
+				memcpy(shadow1 + diffStart, shadow0 + diffStart, diffEnd - diffStart);
+
+				// we use our own flush function so it will serialise chunks when necessary, and it
+				// also handles copying into the persistent mapped pointer and flushing the real GL
+				// buffer
+				glFlushMappedNamedBufferRangeEXT(record->Resource.name, GLintptr(ranges[r].first + diffStart), GLsizeiptr(diffEnd - diffStart));
+			}
 		}
 	}
 }
@@ -3876,6 +3997,12 @@ void WrappedOpenGL::glDeleteBuffers(GLsizei n, const GLuint *buffers)
 
 				// free any shadow storage
 				record->FreeShadowStorage();
+
+				// deleting a buffer unbinds it from the current context
+				ContextData &cd = GetCtxData();
+				for(size_t b=0; b < ARRAY_COUNT(cd.m_BufferRecord); b++)
+					if(cd.m_BufferRecord[b] == record)
+						cd.m_BufferRecord[b] = NULL;
 			}
 
 			GetResourceManager()->MarkCleanResource(res);
@@ -3953,6 +4080,8 @@ bool WrappedOpenGL::Serialise_glVertexAttrib(GLuint index, int count, GLenum typ
 	else if(m_State <= EXECUTING)
 	{
 		value = m_pSerialiser->RawReadBytes(valueSize);
+		if(value == NULL)
+			return false;
 
 		if(Type == Attrib_packed)
 		{
@@ -154,8 +154,44 @@ bool WrappedOpenGL::Serialise_glDebugMessageInsert(GLenum source, GLenum type, G
 	return true;
 }
 
+// markers can be NULL terminated with a length of 0 (EXT) or negative (KHR)
+static void ProbeMarker(GLsizei length, const GLchar *marker)
+{
+	if(marker && RenderDoc::Inst().ProbeMarkers())
+		RenderDoc::Inst().ProbeMarker(marker, length > 0 ? (size_t)length : strlen(marker));
+}
+
+// called before a push is recorded, so a marker region capture begins with its push
+void WrappedOpenGL::PushMarkerRegion(GLsizei length, const GLchar *marker)
+{
+	if(marker && RenderDoc::Inst().ProbeRegionMarkers() && m_State == WRITING_IDLE &&
+		 RenderDoc::Inst().MatchRegionMarker(marker, length > 0 ? (size_t)length : strlen(marker)))
+	{
+		StartFrameCapture(this, NULL);
+		m_RegionCaptureDepth = m_MarkerDepth;
+	}
+
+	m_MarkerDepth++;
+}
+
+// called after a pop is recorded
+void WrappedOpenGL::PopMarkerRegion()
+{
+	if(m_MarkerDepth > 0)
+		m_MarkerDepth--;
+
+	if(m_RegionCaptureDepth >= 0 && m_MarkerDepth <= m_RegionCaptureDepth)
+	{
+		m_RegionCaptureDepth = -1;
+		EndFrameCapture(this, NULL);
+	}
+}
+
 void WrappedOpenGL::glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
 {
+	if(type == eGL_DEBUG_TYPE_MARKER)
+		ProbeMarker(length, buf);
+
 	if(m_State == WRITING_CAPFRAME && type == eGL_DEBUG_TYPE_MARKER)
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_MARKER);
@@ -169,6 +205,9 @@ void WrappedOpenGL::glDebugMessageInsert(GLenum source, GLenum type, GLuint id,
 
 void WrappedOpenGL::glPushGroupMarkerEXT(GLsizei length, const GLchar *marker)
 {
+	ProbeMarker(length, marker);
+	PushMarkerRegion(length, marker);
+
 	if(m_State == WRITING_CAPFRAME)
 	{
 		SCOPED_SERIALISE_CONTEXT(BEGIN_EVENT);
@@ -187,10 +226,14 @@ void WrappedOpenGL::glPopGroupMarkerEXT()
 
 		m_ContextRecord->AddChunk(scope.Get());
 	}
+
+	PopMarkerRegion();
 }
 
 void WrappedOpenGL::glInsertEventMarkerEXT(GLsizei length, const GLchar *marker)
 {
+	ProbeMarker(length, marker);
+
 	if(m_State == WRITING_CAPFRAME)
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_MARKER);
@@ -207,6 +250,8 @@ void WrappedOpenGL::glFrameTerminatorGREMEDY()
 
 void WrappedOpenGL::glStringMarkerGREMEDY(GLsizei len, const void *string)
 {
+	ProbeMarker(len, (const GLchar *)string);
+
 	if(m_State == WRITING_CAPFRAME)
 	{
 		SCOPED_SERIALISE_CONTEXT(SET_MARKER);
@@ -236,6 +281,9 @@ bool WrappedOpenGL::Serialise_glPushDebugGroup(GLenum source, GLuint id, GLsizei
 
 void WrappedOpenGL::glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message)
 {
+	ProbeMarker(length, message);
+	PushMarkerRegion(length, message);
+
 	if(m_State == WRITING_CAPFRAME)
 	{
 		SCOPED_SERIALISE_CONTEXT(BEGIN_EVENT);
@@ -271,4 +319,6 @@ void WrappedOpenGL::glPopDebugGroup()
 	}
 	
 	m_Real.glPopDebugGroup();
+
+	PopMarkerRegion();
 }
@@ -61,6 +61,8 @@ bool WrappedOpenGL::Serialise_glDispatchCompute(GLuint num_groups_x, GLuint num_
 
 void WrappedOpenGL::glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
 {
+	m_FrameStats.Dispatches++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
@@ -115,6 +117,8 @@ bool WrappedOpenGL::Serialise_glDispatchComputeGroupSizeARB(GLuint num_groups_x,
 
 void WrappedOpenGL::glDispatchComputeGroupSizeARB(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z)
 {
+	m_FrameStats.Dispatches++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDispatchComputeGroupSizeARB(num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
@@ -164,6 +168,8 @@ bool WrappedOpenGL::Serialise_glDispatchComputeIndirect(GLintptr indirect)
 
 void WrappedOpenGL::glDispatchComputeIndirect(GLintptr indirect)
 {
+	m_FrameStats.Dispatches++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDispatchComputeIndirect(indirect);
@@ -308,6 +314,8 @@ bool WrappedOpenGL::Serialise_glDrawTransformFeedback(GLenum mode, GLuint id)
 
 void WrappedOpenGL::glDrawTransformFeedback(GLenum mode, GLuint id)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawTransformFeedback(mode, id);
@@ -364,6 +372,8 @@ bool WrappedOpenGL::Serialise_glDrawTransformFeedbackInstanced(GLenum mode, GLui
 
 void WrappedOpenGL::glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawTransformFeedbackInstanced(mode, id, instancecount);
@@ -420,6 +430,8 @@ bool WrappedOpenGL::Serialise_glDrawTransformFeedbackStream(GLenum mode, GLuint
 
 void WrappedOpenGL::glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawTransformFeedbackStream(mode, id, stream);
@@ -477,6 +489,8 @@ bool WrappedOpenGL::Serialise_glDrawTransformFeedbackStreamInstanced(GLenum mode
 
 void WrappedOpenGL::glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
@@ -493,9 +507,9 @@ void WrappedOpenGL::glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint i
 
 bool WrappedOpenGL::Serialise_glDrawArrays(GLenum mode, GLint first, GLsizei count)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(int32_t, First, first);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(int32_t, First, first);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
 
 	if(m_State <= EXECUTING)
 	{
@@ -534,13 +548,15 @@ bool WrappedOpenGL::Serialise_glDrawArrays(GLenum mode, GLint first, GLsizei cou
 
 void WrappedOpenGL::glDrawArrays(GLenum mode, GLint first, GLsizei count)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawArrays(mode, first, count);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWARRAYS);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWARRAYS);
 		Serialise_glDrawArrays(mode, first, count);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -563,23 +579,15 @@ bool WrappedOpenGL::Serialise_glDrawArraysIndirect(GLenum mode, const void *indi
 
 	if(m_State == READING)
 	{
-		DrawArraysIndirectCommand params;
-		m_Real.glGetBufferSubData(eGL_DRAW_INDIRECT_BUFFER, (GLintptr)Offset, sizeof(params), &params);
-		
 		AddEvent(DRAWARRAYS_INDIRECT, desc);
 		string name = "glDrawArraysIndirect(" +
-						( Mode == eGL_POINTS ? "GL_POINTS" : ToStr::Get(Mode) ) + ", <" +
-						ToStr::Get(params.first) + ", " +
-						ToStr::Get(params.count) + ", " +
-						ToStr::Get(params.instanceCount) + ", " +
-						ToStr::Get(params.baseInstance) + ">)";
+						( Mode == eGL_POINTS ? "GL_POINTS" : ToStr::Get(Mode) ) + ", <";
+
+		// parameters and the rest of the name are filled in once the frame is read
+		QueueIndirectFixup(eIndirectFixup_Arrays, (GLintptr)Offset, name);
 		
 		FetchDrawcall draw;
 		draw.name = name;
-		draw.numIndices = params.count;
-		draw.numInstances = params.instanceCount;
-		draw.vertexOffset = params.first;
-		draw.instanceOffset = params.baseInstance;
 
 		draw.flags |= eDraw_Drawcall|eDraw_Instanced|eDraw_Indirect;
 
@@ -593,6 +601,8 @@ bool WrappedOpenGL::Serialise_glDrawArraysIndirect(GLenum mode, const void *indi
 
 void WrappedOpenGL::glDrawArraysIndirect(GLenum mode, const void *indirect)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawArraysIndirect(mode, indirect);
@@ -608,10 +618,10 @@ void WrappedOpenGL::glDrawArraysIndirect(GLenum mode, const void *indirect)
 
 bool WrappedOpenGL::Serialise_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(int32_t, First, first);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(uint32_t, InstanceCount, instancecount);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(int32_t, First, first);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(uint32_t, InstanceCount, instancecount);
 
 	if(m_State <= EXECUTING)
 	{
@@ -651,13 +661,15 @@ bool WrappedOpenGL::Serialise_glDrawArraysInstanced(GLenum mode, GLint first, GL
 
 void WrappedOpenGL::glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawArraysInstanced(mode, first, count, instancecount);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWARRAYS_INSTANCED);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWARRAYS_INSTANCED);
 		Serialise_glDrawArraysInstanced(mode, first, count, instancecount);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -666,11 +678,11 @@ void WrappedOpenGL::glDrawArraysInstanced(GLenum mode, GLint first, GLsizei coun
 
 bool WrappedOpenGL::Serialise_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(int32_t, First, first);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(uint32_t, InstanceCount, instancecount);
-	SERIALISE_ELEMENT(uint32_t, BaseInstance, baseinstance);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(int32_t, First, first);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(uint32_t, InstanceCount, instancecount);
+	SERIALISE_ELEMENT_VARINT(uint32_t, BaseInstance, baseinstance);
 
 	if(m_State <= EXECUTING)
 	{
@@ -711,13 +723,15 @@ bool WrappedOpenGL::Serialise_glDrawArraysInstancedBaseInstance(GLenum mode, GLi
 
 void WrappedOpenGL::glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWARRAYS_INSTANCEDBASEINSTANCE);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWARRAYS_INSTANCEDBASEINSTANCE);
 		Serialise_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -797,10 +811,10 @@ void WrappedOpenGL::Common_postElements(byte *idxDelete)
 
 bool WrappedOpenGL::Serialise_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(GLenum, Type, type);
-	SERIALISE_ELEMENT(uint64_t, IdxOffset, (uint64_t)indices);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Type, type);
+	SERIALISE_ELEMENT_VARINT(uint64_t, IdxOffset, (uint64_t)indices);
 	
 	byte *idxDelete = Common_preElements(Count, Type, IdxOffset);
 
@@ -850,13 +864,15 @@ bool WrappedOpenGL::Serialise_glDrawElements(GLenum mode, GLsizei count, GLenum
 
 void WrappedOpenGL::glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawElements(mode, count, type, indices);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWELEMENTS);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWELEMENTS);
 		Serialise_glDrawElements(mode, count, type, indices);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -880,17 +896,13 @@ bool WrappedOpenGL::Serialise_glDrawElementsIndirect(GLenum mode, GLenum type, c
 
 	if(m_State == READING)
 	{
-		DrawElementsIndirectCommand params;
-		m_Real.glGetBufferSubData(eGL_DRAW_INDIRECT_BUFFER, (GLintptr)Offset, sizeof(params), &params);
-
 		AddEvent(DRAWELEMENTS_INDIRECT, desc);
 		string name = "glDrawElementsIndirect(" +
 						( Mode == eGL_POINTS ? "GL_POINTS" : ToStr::Get(Mode) ) + ", " +
-						ToStr::Get(Type) + ", <" +
-						ToStr::Get(params.count) + ", " +
-						ToStr::Get(params.instanceCount) + ", " + 
-						ToStr::Get(params.baseVertex) + ", " +
-						ToStr::Get(params.baseInstance) + ">)";
+						ToStr::Get(Type) + ", <";
+
+		// parameters and the rest of the name are filled in once the frame is read
+		QueueIndirectFixup(eIndirectFixup_Elements, (GLintptr)Offset, name);
 		
 		uint32_t IdxSize =
 		    Type == eGL_UNSIGNED_BYTE  ? 1
@@ -899,11 +911,6 @@ bool WrappedOpenGL::Serialise_glDrawElementsIndirect(GLenum mode, GLenum type, c
 
 		FetchDrawcall draw;
 		draw.name = name;
-		draw.numIndices = params.count;
-		draw.numInstances = params.instanceCount;
-		draw.indexOffset = params.firstIndex;
-		draw.vertexOffset = params.baseVertex;
-		draw.instanceOffset = params.baseInstance;
 
 		draw.flags |= eDraw_Drawcall|eDraw_UseIBuffer|eDraw_Instanced|eDraw_Indirect;
 
@@ -918,6 +925,8 @@ bool WrappedOpenGL::Serialise_glDrawElementsIndirect(GLenum mode, GLenum type, c
 
 void WrappedOpenGL::glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawElementsIndirect(mode, type, indirect);
@@ -933,12 +942,12 @@ void WrappedOpenGL::glDrawElementsIndirect(GLenum mode, GLenum type, const void
 
 bool WrappedOpenGL::Serialise_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(uint32_t, Start, start);
-	SERIALISE_ELEMENT(uint32_t, End, end);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(GLenum, Type, type);
-	SERIALISE_ELEMENT(uint64_t, IdxOffset, (uint64_t)indices);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Start, start);
+	SERIALISE_ELEMENT_VARINT(uint32_t, End, end);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Type, type);
+	SERIALISE_ELEMENT_VARINT(uint64_t, IdxOffset, (uint64_t)indices);
 	
 	byte *idxDelete = Common_preElements(Count, Type, IdxOffset);
 
@@ -988,13 +997,15 @@ bool WrappedOpenGL::Serialise_glDrawRangeElements(GLenum mode, GLuint start, GLu
 
 void WrappedOpenGL::glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawRangeElements(mode, start, end, count, type, indices);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWRANGEELEMENTS);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWRANGEELEMENTS);
 		Serialise_glDrawRangeElements(mode, start, end, count, type, indices);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -1003,13 +1014,13 @@ void WrappedOpenGL::glDrawRangeElements(GLenum mode, GLuint start, GLuint end, G
 
 bool WrappedOpenGL::Serialise_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(uint32_t, Start, start);
-	SERIALISE_ELEMENT(uint32_t, End, end);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(GLenum, Type, type);
-	SERIALISE_ELEMENT(uint64_t, IdxOffset, (uint64_t)indices);
-	SERIALISE_ELEMENT(uint32_t, BaseVtx, basevertex);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Start, start);
+	SERIALISE_ELEMENT_VARINT(uint32_t, End, end);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Type, type);
+	SERIALISE_ELEMENT_VARINT(uint64_t, IdxOffset, (uint64_t)indices);
+	SERIALISE_ELEMENT_VARINT(uint32_t, BaseVtx, basevertex);
 
 	byte *idxDelete = Common_preElements(Count, Type, IdxOffset);
 
@@ -1060,13 +1071,15 @@ bool WrappedOpenGL::Serialise_glDrawRangeElementsBaseVertex(GLenum mode, GLuint
 
 void WrappedOpenGL::glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWRANGEELEMENTSBASEVERTEX);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWRANGEELEMENTSBASEVERTEX);
 		Serialise_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -1075,11 +1088,11 @@ void WrappedOpenGL::glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLu
 
 bool WrappedOpenGL::Serialise_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(GLenum, Type, type);
-	SERIALISE_ELEMENT(uint64_t, IdxOffset, (uint64_t)indices);
-	SERIALISE_ELEMENT(int32_t, BaseVtx, basevertex);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Type, type);
+	SERIALISE_ELEMENT_VARINT(uint64_t, IdxOffset, (uint64_t)indices);
+	SERIALISE_ELEMENT_VARINT(int32_t, BaseVtx, basevertex);
 	
 	byte *idxDelete = Common_preElements(Count, Type, IdxOffset);
 
@@ -1130,13 +1143,15 @@ bool WrappedOpenGL::Serialise_glDrawElementsBaseVertex(GLenum mode, GLsizei coun
 
 void WrappedOpenGL::glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWELEMENTS_BASEVERTEX);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWELEMENTS_BASEVERTEX);
 		Serialise_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -1145,11 +1160,11 @@ void WrappedOpenGL::glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum
 
 bool WrappedOpenGL::Serialise_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(GLenum, Type, type);
-	SERIALISE_ELEMENT(uint64_t, IdxOffset, (uint64_t)indices);
-	SERIALISE_ELEMENT(uint32_t, InstCount, instancecount);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Type, type);
+	SERIALISE_ELEMENT_VARINT(uint64_t, IdxOffset, (uint64_t)indices);
+	SERIALISE_ELEMENT_VARINT(uint32_t, InstCount, instancecount);
 
 	byte *idxDelete = Common_preElements(Count, Type, IdxOffset);
 
@@ -1200,13 +1215,15 @@ bool WrappedOpenGL::Serialise_glDrawElementsInstanced(GLenum mode, GLsizei count
 
 void WrappedOpenGL::glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawElementsInstanced(mode, count, type, indices, instancecount);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWELEMENTS_INSTANCED);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWELEMENTS_INSTANCED);
 		Serialise_glDrawElementsInstanced(mode, count, type, indices, instancecount);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -1215,12 +1232,12 @@ void WrappedOpenGL::glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum t
 
 bool WrappedOpenGL::Serialise_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(GLenum, Type, type);
-	SERIALISE_ELEMENT(uint64_t, IdxOffset, (uint64_t)indices);
-	SERIALISE_ELEMENT(uint32_t, InstCount, instancecount);
-	SERIALISE_ELEMENT(uint32_t, BaseInstance, baseinstance);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Type, type);
+	SERIALISE_ELEMENT_VARINT(uint64_t, IdxOffset, (uint64_t)indices);
+	SERIALISE_ELEMENT_VARINT(uint32_t, InstCount, instancecount);
+	SERIALISE_ELEMENT_VARINT(uint32_t, BaseInstance, baseinstance);
 	
 	byte *idxDelete = Common_preElements(Count, Type, IdxOffset);
 
@@ -1272,13 +1289,15 @@ bool WrappedOpenGL::Serialise_glDrawElementsInstancedBaseInstance(GLenum mode, G
 
 void WrappedOpenGL::glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWELEMENTS_INSTANCEDBASEINSTANCE);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWELEMENTS_INSTANCEDBASEINSTANCE);
 		Serialise_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -1287,12 +1306,12 @@ void WrappedOpenGL::glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei cou
 
 bool WrappedOpenGL::Serialise_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(GLenum, Type, type);
-	SERIALISE_ELEMENT(uint64_t, IdxOffset, (uint64_t)indices);
-	SERIALISE_ELEMENT(uint32_t, InstCount, instancecount);
-	SERIALISE_ELEMENT(int32_t, BaseVertex, basevertex);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Type, type);
+	SERIALISE_ELEMENT_VARINT(uint64_t, IdxOffset, (uint64_t)indices);
+	SERIALISE_ELEMENT_VARINT(uint32_t, InstCount, instancecount);
+	SERIALISE_ELEMENT_VARINT(int32_t, BaseVertex, basevertex);
 
 	byte *idxDelete = Common_preElements(Count, Type, IdxOffset);
 
@@ -1344,13 +1363,15 @@ bool WrappedOpenGL::Serialise_glDrawElementsInstancedBaseVertex(GLenum mode, GLs
 
 void WrappedOpenGL::glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWELEMENTS_INSTANCEDBASEVERTEX);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWELEMENTS_INSTANCEDBASEVERTEX);
 		Serialise_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -1359,13 +1380,13 @@ void WrappedOpenGL::glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count
 
 bool WrappedOpenGL::Serialise_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
 {
-	SERIALISE_ELEMENT(GLenum, Mode, mode);
-	SERIALISE_ELEMENT(uint32_t, Count, count);
-	SERIALISE_ELEMENT(GLenum, Type, type);
-	SERIALISE_ELEMENT(uint64_t, IdxOffset, (uint64_t)indices);
-	SERIALISE_ELEMENT(uint32_t, InstCount, instancecount);
-	SERIALISE_ELEMENT(int32_t, BaseVertex, basevertex);
-	SERIALISE_ELEMENT(uint32_t, BaseInstance, baseinstance);
+	SERIALISE_ELEMENT_VARINT(GLenum, Mode, mode);
+	SERIALISE_ELEMENT_VARINT(uint32_t, Count, count);
+	SERIALISE_ELEMENT_VARINT(GLenum, Type, type);
+	SERIALISE_ELEMENT_VARINT(uint64_t, IdxOffset, (uint64_t)indices);
+	SERIALISE_ELEMENT_VARINT(uint32_t, InstCount, instancecount);
+	SERIALISE_ELEMENT_VARINT(int32_t, BaseVertex, basevertex);
+	SERIALISE_ELEMENT_VARINT(uint32_t, BaseInstance, baseinstance);
 	
 	byte *idxDelete = Common_preElements(Count, Type, IdxOffset);
 
@@ -1418,13 +1439,15 @@ bool WrappedOpenGL::Serialise_glDrawElementsInstancedBaseVertexBaseInstance(GLen
 
 void WrappedOpenGL::glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
 
 	if(m_State == WRITING_CAPFRAME)
 	{
-		SCOPED_SERIALISE_CONTEXT(DRAWELEMENTS_INSTANCEDBASEVERTEXBASEINSTANCE);
+		SCOPED_SERIALISE_SMALL_CONTEXT(DRAWELEMENTS_INSTANCEDBASEVERTEXBASEINSTANCE);
 		Serialise_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
 
 		m_ContextRecord->AddChunk(scope.Get());
@@ -1540,6 +1563,8 @@ bool WrappedOpenGL::Serialise_glMultiDrawArrays(GLenum mode, const GLint *first,
 
 void WrappedOpenGL::glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glMultiDrawArrays(mode, first, count, drawcount);
@@ -1686,6 +1711,8 @@ bool WrappedOpenGL::Serialise_glMultiDrawElements(GLenum mode, const GLsizei *co
 
 void WrappedOpenGL::glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glMultiDrawElements(mode, count, type, indices, drawcount);
@@ -1843,6 +1870,8 @@ bool WrappedOpenGL::Serialise_glMultiDrawElementsBaseVertex(GLenum mode, const G
 
 void WrappedOpenGL::glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
@@ -1945,26 +1974,18 @@ bool WrappedOpenGL::Serialise_glMultiDrawArraysIndirect(GLenum mode, const void
 
 		for(uint32_t i=0; i < Count; i++)
 		{
-			DrawArraysIndirectCommand params;
+			// parameters and the rest of the name are filled in once the frame is read
+			string drawName = "glMultiDrawArraysIndirect[" + ToStr::Get(i) + "](<";
 
-			m_Real.glGetBufferSubData(eGL_DRAW_INDIRECT_BUFFER, offs, sizeof(params), &params);
+			QueueIndirectFixup(eIndirectFixup_MultiArrays, offs, drawName);
+
+			FetchDrawcall multidraw;
+			multidraw.name = drawName;
 
 			if(Stride)
 				offs += Stride;
 			else
-				offs += sizeof(params);
-
-			FetchDrawcall multidraw;
-			multidraw.numIndices = params.count;
-			multidraw.numInstances = params.instanceCount;
-			multidraw.vertexOffset = params.first;
-			multidraw.instanceOffset = params.baseInstance;
-		
-			multidraw.name = "glMultiDrawArraysIndirect[" + ToStr::Get(i) + "](<" +
-						ToStr::Get(multidraw.numIndices) + ", " +
-						ToStr::Get(multidraw.numInstances) + ", " +
-						ToStr::Get(multidraw.vertexOffset) + ", " +
-						ToStr::Get(multidraw.instanceOffset) + ">)";
+				offs += sizeof(DrawArraysIndirectCommand);
 
 			multidraw.flags |= eDraw_Drawcall|eDraw_Instanced|eDraw_Indirect;
 
@@ -1988,6 +2009,8 @@ bool WrappedOpenGL::Serialise_glMultiDrawArraysIndirect(GLenum mode, const void
 
 void WrappedOpenGL::glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
@@ -2098,27 +2121,18 @@ bool WrappedOpenGL::Serialise_glMultiDrawElementsIndirect(GLenum mode, GLenum ty
 
 		for(uint32_t i=0; i < Count; i++)
 		{
-			DrawElementsIndirectCommand params;
+			// parameters and the rest of the name are filled in once the frame is read
+			string drawName = "glMultiDrawElementsIndirect[" + ToStr::Get(i) + "](<";
 
-			m_Real.glGetBufferSubData(eGL_DRAW_INDIRECT_BUFFER, offs, sizeof(params), &params);
+			QueueIndirectFixup(eIndirectFixup_MultiElements, offs, drawName);
+
+			FetchDrawcall multidraw;
+			multidraw.name = drawName;
 
 			if(Stride)
 				offs += Stride;
 			else
-				offs += sizeof(params);
-
-			FetchDrawcall multidraw;
-			multidraw.numIndices = params.count;
-			multidraw.numInstances = params.instanceCount;
-			multidraw.indexOffset = params.firstIndex;
-			multidraw.vertexOffset = params.baseVertex;
-			multidraw.instanceOffset = params.baseInstance;
-		
-			multidraw.name = "glMultiDrawElementsIndirect[" + ToStr::Get(i) + "](<" +
-						ToStr::Get(multidraw.numIndices) + ", " +
-						ToStr::Get(multidraw.numInstances) + ", " +
-						ToStr::Get(multidraw.indexOffset) + ", " +
-						ToStr::Get(multidraw.instanceOffset) + ">)";
+				offs += sizeof(DrawElementsIndirectCommand);
 
 			multidraw.flags |= eDraw_Drawcall|eDraw_UseIBuffer|eDraw_Instanced|eDraw_Indirect;
 
@@ -2143,6 +2157,8 @@ bool WrappedOpenGL::Serialise_glMultiDrawElementsIndirect(GLenum mode, GLenum ty
 
 void WrappedOpenGL::glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
@@ -2256,26 +2272,18 @@ bool WrappedOpenGL::Serialise_glMultiDrawArraysIndirectCountARB(GLenum mode, GLi
 
 		for(uint32_t i=0; i < realdrawcount; i++)
 		{
-			DrawArraysIndirectCommand params;
+			// parameters and the rest of the name are filled in once the frame is read
+			string drawName = "glMultiDrawArraysIndirect[" + ToStr::Get(i) + "](<";
 
-			m_Real.glGetBufferSubData(eGL_DRAW_INDIRECT_BUFFER, offs, sizeof(params), &params);
+			QueueIndirectFixup(eIndirectFixup_MultiArrays, offs, drawName);
+
+			FetchDrawcall multidraw;
+			multidraw.name = drawName;
 
 			if(Stride)
 				offs += Stride;
 			else
-				offs += sizeof(params);
-
-			FetchDrawcall multidraw;
-			multidraw.numIndices = params.count;
-			multidraw.numInstances = params.instanceCount;
-			multidraw.vertexOffset = params.first;
-			multidraw.instanceOffset = params.baseInstance;
-		
-			multidraw.name = "glMultiDrawArraysIndirect[" + ToStr::Get(i) + "](<" +
-						ToStr::Get(multidraw.numIndices) + ", " +
-						ToStr::Get(multidraw.numInstances) + ", " +
-						ToStr::Get(multidraw.vertexOffset) + ", " +
-						ToStr::Get(multidraw.instanceOffset) + ">)";
+				offs += sizeof(DrawArraysIndirectCommand);
 
 			multidraw.flags |= eDraw_Drawcall|eDraw_Instanced|eDraw_Indirect;
 
@@ -2300,6 +2308,8 @@ bool WrappedOpenGL::Serialise_glMultiDrawArraysIndirectCountARB(GLenum mode, GLi
 
 void WrappedOpenGL::glMultiDrawArraysIndirectCountARB(GLenum mode, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glMultiDrawArraysIndirectCountARB(mode, indirect, drawcount, maxdrawcount, stride);
@@ -2421,27 +2431,18 @@ bool WrappedOpenGL::Serialise_glMultiDrawElementsIndirectCountARB(GLenum mode, G
 
 		for(uint32_t i=0; i < realdrawcount; i++)
 		{
-			DrawElementsIndirectCommand params;
+			// parameters and the rest of the name are filled in once the frame is read
+			string drawName = "glMultiDrawElementsIndirect[" + ToStr::Get(i) + "](<";
 
-			m_Real.glGetBufferSubData(eGL_DRAW_INDIRECT_BUFFER, offs, sizeof(params), &params);
+			QueueIndirectFixup(eIndirectFixup_MultiElements, offs, drawName);
+
+			FetchDrawcall multidraw;
+			multidraw.name = drawName;
 
 			if(Stride)
 				offs += Stride;
 			else
-				offs += sizeof(params);
-
-			FetchDrawcall multidraw;
-			multidraw.numIndices = params.count;
-			multidraw.numInstances = params.instanceCount;
-			multidraw.indexOffset = params.firstIndex;
-			multidraw.vertexOffset = params.baseVertex;
-			multidraw.instanceOffset = params.baseInstance;
-		
-			multidraw.name = "glMultiDrawElementsIndirect[" + ToStr::Get(i) + "](" +
-						ToStr::Get(multidraw.numIndices) + ", " +
-						ToStr::Get(multidraw.numInstances) + ", " +
-						ToStr::Get(multidraw.indexOffset) + ", " +
-						ToStr::Get(multidraw.instanceOffset) + ")";
+				offs += sizeof(DrawElementsIndirectCommand);
 
 			multidraw.flags |= eDraw_Drawcall|eDraw_UseIBuffer|eDraw_Instanced|eDraw_Indirect;
 
@@ -2466,6 +2467,8 @@ bool WrappedOpenGL::Serialise_glMultiDrawElementsIndirectCountARB(GLenum mode, G
 
 void WrappedOpenGL::glMultiDrawElementsIndirectCountARB(GLenum mode, GLenum type, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
 {
+	m_FrameStats.Draws++;
+
 	CoherentMapImplicitBarrier();
 
 	m_Real.glMultiDrawElementsIndirectCountARB(mode, type, indirect, drawcount, maxdrawcount, stride);
@@ -28,6 +28,9 @@
 #include "../gl_driver.h"
 #include "../gl_shader_refl.h"
 
+// defined with the other replay type serialisation in the replay proxy
+template<> void Serialiser::Serialise(const char *name, ShaderReflection &el);
+
 #pragma region Shaders
 
 bool WrappedOpenGL::Serialise_glCreateShader(GLuint shader, GLenum type)
@@ -142,6 +145,375 @@ void WrappedOpenGL::glShaderSource(GLuint shader, GLsizei count, const GLchar* c
 	}
 }
 
+static uint64_t ShaderCacheHash(const char *str, size_t len, uint64_t hash)
+{
+	// FNV-1a
+	for(size_t i=0; i < len; i++)
+		hash = (hash ^ (byte)str[i]) * 0x100000001b3ULL;
+
+	return hash;
+}
+
+static uint64_t ShaderCacheHash(const string &str, uint64_t hash)
+{
+	// include the length, so that splitting the same text differently between
+	// sources doesn't give the same hash
+	uint64_t len = str.length();
+	hash = ShaderCacheHash((const char *)&len, sizeof(len), hash);
+	return ShaderCacheHash(str.c_str(), str.length(), hash);
+}
+
+static uint64_t ShaderCacheHash(GLenum shadType, const vector<string> &sources, uint64_t hash)
+{
+	hash = ShaderCacheHash((const char *)&shadType, sizeof(shadType), hash);
+
+	for(size_t i=0; i < sources.size(); i++)
+		hash = ShaderCacheHash(sources[i], hash);
+
+	return hash;
+}
+
+// both caches are a version and count, then that many hash/value pairs
+static Serialiser *OpenShaderCache(const char *filename, uint32_t expectedVersion, uint32_t &numentries)
+{
+	string cachefile = FileIO::GetAppFolderFilename(filename);
+
+	FILE *f = FileIO::fopen(cachefile.c_str(), "rb");
+	if(!f)
+		return NULL;
+
+	FileIO::fseek64(f, 0, SEEK_END);
+	uint64_t cachelen = FileIO::ftell64(f);
+	FileIO::fseek64(f, 0, SEEK_SET);
+
+	if(cachelen < sizeof(uint32_t)*2)
+	{
+		RDCERR("Invalid shader cache %s", filename);
+		FileIO::fclose(f);
+		return NULL;
+	}
+
+	vector<byte> cache((size_t)cachelen);
+	FileIO::fread(&cache[0], 1, (size_t)cachelen, f);
+
+	FileIO::fclose(f);
+
+	Serialiser *ser = new Serialiser((size_t)cachelen, &cache[0], false);
+
+	uint32_t version = 0;
+	ser->Serialise("version", version);
+
+	if(version != expectedVersion)
+	{
+		RDCDEBUG("Out of date or invalid shader cache version in %s: %d", filename, version);
+		SAFE_DELETE(ser);
+		return NULL;
+	}
+
+	ser->Serialise("numentries", numentries);
+
+	return ser;
+}
+
+static void WriteShaderCache(const char *filename, Serialiser &ser)
+{
+	string cachefile = FileIO::GetAppFolderFilename(filename);
+
+	FILE *f = FileIO::fopen(cachefile.c_str(), "wb");
+	if(f)
+	{
+		FileIO::fwrite(ser.GetRawPtr(0), 1, (size_t)ser.GetOffset(), f);
+		FileIO::fclose(f);
+	}
+	else
+	{
+		RDCERR("Error opening shader cache %s for write", filename);
+	}
+}
+
+void WrappedOpenGL::LoadShaderCaches()
+{
+	// the debug programs are created before the log is read, and load the caches first
+	if(m_ShaderCachesLoaded)
+		return;
+
+	m_ShaderCachesLoaded = true;
+
+	m_ReflectionCache.clear();
+	m_ReflectionCacheDirty = false;
+
+	m_ProgramBinaryCache.clear();
+	m_ProgramBinaryCacheDirty = false;
+
+	// a different driver could compile the same source differently, so it's part of every key
+	m_ShaderCacheDriverHash = 0xcbf29ce484222325ULL;
+
+	const GLenum driverStrings[] = { eGL_VENDOR, eGL_RENDERER, eGL_VERSION };
+	for(size_t i=0; i < ARRAY_COUNT(driverStrings); i++)
+	{
+		const char *str = (const char *)m_Real.glGetString(driverStrings[i]);
+		m_ShaderCacheDriverHash = ShaderCacheHash(string(str ? str : ""), m_ShaderCacheDriverHash);
+	}
+
+	uint32_t numentries = 0;
+	Serialiser *ser = OpenShaderCache("glreflection.cache", m_ReflectionCacheVersion, numentries);
+
+	if(ser)
+	{
+		for(uint32_t i=0; i < numentries && !ser->HasError() && !ser->AtEnd(); i++)
+		{
+			uint64_t hash = 0;
+			ser->Serialise("hash", hash);
+			ser->Serialise("reflection", m_ReflectionCache[hash]);
+		}
+
+		if(ser->HasError() || m_ReflectionCache.size() != numentries)
+		{
+			RDCERR("Invalid GL reflection cache");
+			m_ReflectionCache.clear();
+		}
+		else
+		{
+			RDCDEBUG("Successfully loaded %d shaders from GL reflection cache", m_ReflectionCache.size());
+		}
+
+		SAFE_DELETE(ser);
+	}
+
+	// program binaries are only available with GL 4.1 or ARB_get_program_binary
+	GLint numFormats = 0;
+	if(m_Real.glGetProgramBinary && m_Real.glProgramBinary)
+		m_Real.glGetIntegerv(eGL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+
+	m_ProgramBinaryCacheEnabled = (numFormats > 0);
+
+	if(!m_ProgramBinaryCacheEnabled)
+		return;
+
+	ser = OpenShaderCache("glprograms.cache", m_ProgramBinaryCacheVersion, numentries);
+
+	if(ser)
+	{
+		for(uint32_t i=0; i < numentries && !ser->HasError() && !ser->AtEnd(); i++)
+		{
+			uint64_t hash = 0;
+			ser->Serialise("hash", hash);
+			ProgramBinary &bin = m_ProgramBinaryCache[hash];
+			ser->Serialise("format", bin.format);
+			ser->Serialise("data", bin.data);
+		}
+
+		if(ser->HasError() || m_ProgramBinaryCache.size() != numentries)
+		{
+			RDCERR("Invalid GL program binary cache");
+			m_ProgramBinaryCache.clear();
+		}
+		else
+		{
+			RDCDEBUG("Successfully loaded %d programs from GL program binary cache", m_ProgramBinaryCache.size());
+		}
+
+		SAFE_DELETE(ser);
+	}
+}
+
+void WrappedOpenGL::SaveShaderCaches()
+{
+	// don't let the caches grow without bound if many different programs are opened,
+	// just start again.
+	const size_t maxEntries = 64*1024;
+
+	if(m_ReflectionCacheDirty)
+	{
+		Serialiser ser(NULL, Serialiser::WRITING, false);
+
+		uint32_t version = m_ReflectionCacheVersion;
+		uint32_t numentries = (uint32_t)RDCMIN(m_ReflectionCache.size(), maxEntries);
+		ser.Serialise("version", version);
+		ser.Serialise("numentries", numentries);
+
+		auto it = m_ReflectionCache.begin();
+		for(uint32_t i=0; i < numentries; i++, ++it)
+		{
+			uint64_t hash = it->first;
+			ser.Serialise("hash", hash);
+			ser.Serialise("reflection", it->second);
+		}
+
+		WriteShaderCache("glreflection.cache", ser);
+
+		RDCDEBUG("Wrote %d shaders to GL reflection cache", numentries);
+
+		m_ReflectionCacheDirty = false;
+	}
+
+	if(m_ProgramBinaryCacheDirty)
+	{
+		Serialiser ser(NULL, Serialiser::WRITING, false);
+
+		uint32_t version = m_ProgramBinaryCacheVersion;
+		uint32_t numentries = (uint32_t)RDCMIN(m_ProgramBinaryCache.size(), maxEntries);
+		ser.Serialise("version", version);
+		ser.Serialise("numentries", numentries);
+
+		auto it = m_ProgramBinaryCache.begin();
+		for(uint32_t i=0; i < numentries; i++, ++it)
+		{
+			uint64_t hash = it->first;
+			ser.Serialise("hash", hash);
+			ser.Serialise("format", it->second.format);
+			ser.Serialise("data", it->second.data);
+		}
+
+		WriteShaderCache("glprograms.cache", ser);
+
+		RDCDEBUG("Wrote %d programs to GL program binary cache", numentries);
+
+		m_ProgramBinaryCacheDirty = false;
+	}
+}
+
+void WrappedOpenGL::GetShaderReflection(GLenum shadType, const vector<string> &sources, GLuint sepProg, ShaderReflection &refl, bool pointSizeUsed, bool clipDistanceUsed)
+{
+	// reflection only depends on the source (the program is freshly linked, so
+	// nothing has been changed from its defaults) and how the driver compiled it.
+	uint64_t hash = ShaderCacheHash(shadType, sources, m_ShaderCacheDriverHash);
+
+	hash = ShaderCacheHash((const char *)&pointSizeUsed, sizeof(pointSizeUsed), hash);
+	hash = ShaderCacheHash((const char *)&clipDistanceUsed, sizeof(clipDistanceUsed), hash);
+
+	auto it = m_ReflectionCache.find(hash);
+	if(it != m_ReflectionCache.end())
+	{
+		refl = it->second;
+		return;
+	}
+
+	MakeShaderReflection(m_Real, shadType, sepProg, refl, pointSizeUsed, clipDistanceUsed);
+
+	m_ReflectionCache[hash] = refl;
+	m_ReflectionCacheDirty = true;
+}
+
+GLuint WrappedOpenGL::MakeCachedSeparableProgram(ResourceId shader, GLenum shadType, const vector<string> &sources)
+{
+	if(!m_ProgramBinaryCacheEnabled)
+		return MakeSeparableShaderProgram(m_Real, shadType, sources, NULL);
+
+	uint64_t hash = ShaderCacheHash(shadType, sources, m_ShaderCacheDriverHash);
+
+	if(m_ProgramBinaryCache.find(hash) != m_ProgramBinaryCache.end())
+	{
+		GLuint prog = m_Real.glCreateProgram();
+		m_Real.glProgramParameteri(prog, eGL_PROGRAM_SEPARABLE, GL_TRUE);
+
+		if(LoadCachedProgramBinary(hash, prog))
+		{
+			m_BinarySeparablePrograms[prog] = shader;
+			return prog;
+		}
+
+		m_Real.glDeleteProgram(prog);
+	}
+
+	GLuint prog = MakeSeparableShaderProgram(m_Real, shadType, sources, NULL);
+
+	if(prog)
+		StoreCachedProgramBinary(hash, prog);
+
+	return prog;
+}
+
+uint64_t WrappedOpenGL::GetProgramCacheHash(size_t numStages, const GLenum *shadTypes, const char *const *sources)
+{
+	uint64_t hash = m_ShaderCacheDriverHash;
+
+	for(size_t i=0; i < numStages; i++)
+	{
+		vector<string> src(1, string(sources[i]));
+		hash = ShaderCacheHash(shadTypes[i], src, hash);
+	}
+
+	return hash;
+}
+
+bool WrappedOpenGL::LoadCachedProgramBinary(uint64_t hash, GLuint prog)
+{
+	if(!m_ProgramBinaryCacheEnabled)
+		return false;
+
+	auto it = m_ProgramBinaryCache.find(hash);
+	if(it == m_ProgramBinaryCache.end() || it->second.data.empty())
+		return false;
+
+	m_Real.glProgramBinary(prog, it->second.format, &it->second.data[0], (GLsizei)it->second.data.size());
+
+	GLint status = 0;
+	m_Real.glGetProgramiv(prog, eGL_LINK_STATUS, &status);
+
+	if(status)
+		return true;
+
+	// the driver can reject binaries at any time (e.g. after an update that didn't
+	// change the version string), so the caller falls back to compiling and the entry
+	// is replaced.
+	m_ProgramBinaryCache.erase(it);
+	m_ProgramBinaryCacheDirty = true;
+
+	return false;
+}
+
+void WrappedOpenGL::StoreCachedProgramBinary(uint64_t hash, GLuint prog)
+{
+	if(!m_ProgramBinaryCacheEnabled)
+		return;
+
+	GLint status = 0;
+	m_Real.glGetProgramiv(prog, eGL_LINK_STATUS, &status);
+
+	GLint len = 0;
+	if(status)
+		m_Real.glGetProgramiv(prog, eGL_PROGRAM_BINARY_LENGTH, &len);
+
+	if(len > 0)
+	{
+		ProgramBinary &bin = m_ProgramBinaryCache[hash];
+		bin.data.resize((size_t)len);
+		m_Real.glGetProgramBinary(prog, len, NULL, &bin.format, &bin.data[0]);
+		m_ProgramBinaryCacheDirty = true;
+	}
+}
+
+void WrappedOpenGL::MakeSeparableProgramRelinkable(GLuint prog)
+{
+	auto it = m_BinarySeparablePrograms.find(prog);
+	if(it == m_BinarySeparablePrograms.end())
+		return;
+
+	ShaderData &shadDetails = m_Shaders[it->second];
+
+	m_BinarySeparablePrograms.erase(it);
+
+	// compile the program for real, and steal its shader. The shader is already flagged
+	// for deletion, so it will go away along with our program.
+	GLuint compiled = MakeSeparableShaderProgram(m_Real, shadDetails.type, shadDetails.sources, NULL);
+
+	if(compiled == 0)
+	{
+		RDCERR("Couldn't compile separable program to relink cached binary");
+		return;
+	}
+
+	GLuint shader = 0;
+	GLsizei count = 0;
+	m_Real.glGetAttachedShaders(compiled, 1, &count, &shader);
+
+	if(count > 0)
+		m_Real.glAttachShader(prog, shader);
+
+	m_Real.glDeleteProgram(compiled);
+}
+
 bool WrappedOpenGL::Serialise_glCompileShader(GLuint shader)
 {
 	SERIALISE_ELEMENT(ResourceId, id, GetResourceManager()->GetID(ShaderRes(GetCtx(), shader)));
@@ -155,7 +527,7 @@ bool WrappedOpenGL::Serialise_glCompileShader(GLuint shader)
 		bool pointSizeUsed = false, clipDistanceUsed = false;
 		if(shadDetails.type == eGL_VERTEX_SHADER) CheckVertexOutputUses(shadDetails.sources, pointSizeUsed, clipDistanceUsed);
 
-		GLuint sepProg = MakeSeparableShaderProgram(m_Real, shadDetails.type, shadDetails.sources, NULL);
+		GLuint sepProg = MakeCachedSeparableProgram(liveId, shadDetails.type, shadDetails.sources);
 
 		if(sepProg == 0)
 		{
@@ -164,7 +536,7 @@ bool WrappedOpenGL::Serialise_glCompileShader(GLuint shader)
 		else
 		{
 			shadDetails.prog = sepProg;
-			MakeShaderReflection(m_Real, shadDetails.type, sepProg, shadDetails.reflection, pointSizeUsed, clipDistanceUsed);
+			GetShaderReflection(shadDetails.type, shadDetails.sources, sepProg, shadDetails.reflection, pointSizeUsed, clipDistanceUsed);
 			
 			create_array_uninit(shadDetails.reflection.DebugInfo.files, shadDetails.sources.size());
 			for(size_t i=0; i < shadDetails.sources.size(); i++)
@@ -330,15 +702,16 @@ bool WrappedOpenGL::Serialise_glCreateShaderProgramv(GLuint program, GLenum type
 			sources[i] = &src[i][0];
 
 		GLuint real = m_Real.glCreateShaderProgramv(Type, Count, sources);
-		// we want a separate program that we can mess about with for making overlays
-		// and relink without having to worry about restoring the 'real' program state.
-		GLuint sepprog = MakeSeparableShaderProgram(m_Real, Type, src, NULL);
 
 		delete[] sources;
 		
 		GLResource res = ProgramRes(GetCtx(), real);
 
 		ResourceId liveId = m_ResourceManager->RegisterResource(res);
+
+		// we want a separate program that we can mess about with for making overlays
+		// and relink without having to worry about restoring the 'real' program state.
+		GLuint sepprog = MakeCachedSeparableProgram(liveId, Type, src);
 	
 		auto &progDetails = m_Programs[liveId];
 	
@@ -354,7 +727,7 @@ bool WrappedOpenGL::Serialise_glCreateShaderProgramv(GLuint program, GLenum type
 		shadDetails.type = Type;
 		shadDetails.sources.swap(src);
 		shadDetails.prog = sepprog;
-		MakeShaderReflection(m_Real, Type, real, shadDetails.reflection, pointSizeUsed, clipDistanceUsed);
+		GetShaderReflection(Type, shadDetails.sources, real, shadDetails.reflection, pointSizeUsed, clipDistanceUsed);
 
 		create_array_uninit(shadDetails.reflection.DebugInfo.files, shadDetails.sources.size());
 		for(size_t i=0; i < shadDetails.sources.size(); i++)
@@ -770,6 +1143,11 @@ void WrappedOpenGL::glProgramParameteri(GLuint program, GLenum pname, GLint valu
 void WrappedOpenGL::glDeleteProgram(GLuint program)
 {
 	m_Real.glDeleteProgram(program);
+
+	// the name can be reused for a new program that isn't dirty yet
+	for(auto it=m_ContextData.begin(); it != m_ContextData.end(); ++it)
+		if(it->second.m_DirtyUniformProgram == program)
+			it->second.m_DirtyUniformProgram = 0;
 	
 	GLResource res = ProgramRes(GetCtx(), program);
 	if(GetResourceManager()->HasCurrentResource(res))
@@ -802,6 +1180,9 @@ void WrappedOpenGL::glUseProgram(GLuint program)
 
 	GetCtxData().m_Program = program;
 
+	if(RenderDoc::Inst().ProbeShaders())
+		RenderDoc::Inst().ProbeShader(program);
+
 	if(m_State == WRITING_CAPFRAME)
 	{
 		SCOPED_SERIALISE_CONTEXT(USEPROGRAM);
@@ -906,6 +1287,9 @@ void WrappedOpenGL::glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuin
 {
 	m_Real.glUseProgramStages(pipeline, stages, program);
 
+	if(RenderDoc::Inst().ProbeShaders())
+		RenderDoc::Inst().ProbeShader(program);
+
 	if(m_State > WRITING)
 	{
 		SCOPED_SERIALISE_CONTEXT(USE_PROGRAMSTAGES);
@@ -1091,6 +1475,17 @@ GLuint WrappedOpenGL::GetUniformProgram()
 	return 0;
 }
 
+void WrappedOpenGL::MarkUniformProgramDirty(GLuint program)
+{
+	ContextData &cd = GetCtxData();
+
+	if(program == 0 || program == cd.m_DirtyUniformProgram)
+		return;
+
+	GetResourceManager()->MarkDirtyResource(ProgramRes(GetCtx(), program));
+	cd.m_DirtyUniformProgram = program;
+}
+
 void WrappedOpenGL::glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
 {
 	for(GLsizei i=0; i < n; i++)
@@ -513,6 +513,11 @@ void WrappedOpenGL::glBindImageTexture(GLuint unit, GLuint texture, GLint level,
 		
 		m_ContextRecord->AddChunk(chunk);
 	}
+	else if(m_State == WRITING_IDLE && access != eGL_READ_ONLY)
+	{
+		// shaders can write to it from here on without us seeing
+		GetResourceManager()->MarkDirtyResource(TextureRes(GetCtx(), texture));
+	}
 }
 
 bool WrappedOpenGL::Serialise_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures)
@@ -563,6 +568,13 @@ void WrappedOpenGL::glBindImageTextures(GLuint first, GLsizei count, const GLuin
 		
 		m_ContextRecord->AddChunk(scope.Get());
 	}
+	else if(m_State == WRITING_IDLE && textures)
+	{
+		// textures bound this way are always bound read-write
+		for(GLsizei i=0; i < count; i++)
+			if(textures[i])
+				GetResourceManager()->MarkDirtyResource(TextureRes(GetCtx(), textures[i]));
+	}
 }
 
 bool WrappedOpenGL::Serialise_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
@@ -1079,7 +1091,7 @@ void WrappedOpenGL::Common_glTextureParameteriEXT(GLResourceRecord *record, GLen
 		if(record->UpdateCount > 12)
 		{
 			m_HighTrafficResources.insert(record->GetResourceID());
-			GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+			GetResourceManager()->MarkTextureStateDirty(record->GetResourceID());
 		}
 	}
 }
@@ -1159,7 +1171,7 @@ void WrappedOpenGL::Common_glTextureParameterivEXT(GLResourceRecord *record, GLe
 		if(record->UpdateCount > 12)
 		{
 			m_HighTrafficResources.insert(record->GetResourceID());
-			GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+			GetResourceManager()->MarkTextureStateDirty(record->GetResourceID());
 		}
 	}
 }
@@ -1239,7 +1251,7 @@ void WrappedOpenGL::Common_glTextureParameterIivEXT(GLResourceRecord *record, GL
 		if(record->UpdateCount > 12)
 		{
 			m_HighTrafficResources.insert(record->GetResourceID());
-			GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+			GetResourceManager()->MarkTextureStateDirty(record->GetResourceID());
 		}
 	}
 }
@@ -1319,7 +1331,7 @@ void WrappedOpenGL::Common_glTextureParameterIuivEXT(GLResourceRecord *record, G
 		if(record->UpdateCount > 12)
 		{
 			m_HighTrafficResources.insert(record->GetResourceID());
-			GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+			GetResourceManager()->MarkTextureStateDirty(record->GetResourceID());
 		}
 	}
 }
@@ -1396,7 +1408,7 @@ void WrappedOpenGL::Common_glTextureParameterfEXT(GLResourceRecord *record, GLen
 		if(record->UpdateCount > 12)
 		{
 			m_HighTrafficResources.insert(record->GetResourceID());
-			GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+			GetResourceManager()->MarkTextureStateDirty(record->GetResourceID());
 		}
 	}
 }
@@ -1476,7 +1488,7 @@ void WrappedOpenGL::Common_glTextureParameterfvEXT(GLResourceRecord *record, GLe
 		if(record->UpdateCount > 12)
 		{
 			m_HighTrafficResources.insert(record->GetResourceID());
-			GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+			GetResourceManager()->MarkTextureStateDirty(record->GetResourceID());
 		}
 	}
 }
@@ -1636,7 +1648,7 @@ bool WrappedOpenGL::Serialise_glTextureImage1DEXT(GLuint texture, GLenum target,
 		// didn't track and set them up, so unbind it and either we provide data (in buf)
 		// or just size the texture to be filled with data later (buf=NULL)
 		GLuint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, (GLint *)&unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		m_Real.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, 0);
 
 		m_Real.glTextureImage1DEXT(GetResourceManager()->GetLiveResource(id).name, Target, Level, IntFormat, Width, Border, Format, Type, buf);
@@ -1663,7 +1675,7 @@ void WrappedOpenGL::Common_glTextureImage1DEXT(ResourceId texId, GLenum target,
 	bool fromunpackbuf = false;
 	{
 		GLint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		fromunpackbuf = (unpackbuf != 0);
 	}
 	
@@ -1786,7 +1798,7 @@ bool WrappedOpenGL::Serialise_glTextureImage2DEXT(GLuint texture, GLenum target,
 		// didn't track and set them up, so unbind it and either we provide data (in buf)
 		// or just size the texture to be filled with data later (buf=NULL)
 		GLuint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, (GLint *)&unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		m_Real.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, 0);
 		
 		if(TextureBinding(Target) != eGL_TEXTURE_BINDING_CUBE_MAP)
@@ -1835,7 +1847,7 @@ void WrappedOpenGL::Common_glTextureImage2DEXT(ResourceId texId, GLenum target,
 	bool fromunpackbuf = false;
 	{
 		GLint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		fromunpackbuf = (unpackbuf != 0);
 	}
 	
@@ -1963,7 +1975,7 @@ bool WrappedOpenGL::Serialise_glTextureImage3DEXT(GLuint texture, GLenum target,
 		// didn't track and set them up, so unbind it and either we provide data (in buf)
 		// or just size the texture to be filled with data later (buf=NULL)
 		GLuint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, (GLint *)&unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		m_Real.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, 0);
 
 		m_Real.glTextureImage3DEXT(GetResourceManager()->GetLiveResource(id).name, Target, Level, IntFormat, Width, Height, Depth, Border, Format, Type, buf);
@@ -1990,7 +2002,7 @@ void WrappedOpenGL::Common_glTextureImage3DEXT(ResourceId texId, GLenum target,
 	bool fromunpackbuf = false;
 	{
 		GLint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		fromunpackbuf = (unpackbuf != 0);
 	}
 	
@@ -2124,7 +2136,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureImage1DEXT(GLuint texture, GLen
 		// didn't track and set them up, so unbind it and either we provide data (in buf)
 		// or just size the texture to be filled with data later (buf=NULL)
 		GLuint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, (GLint *)&unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		m_Real.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, 0);
 
 		m_Real.glCompressedTextureImage1DEXT(GetResourceManager()->GetLiveResource(id).name, Target, Level, fmt, Width, Border, byteSize, databuf);
@@ -2151,7 +2163,7 @@ void WrappedOpenGL::Common_glCompressedTextureImage1DEXT(ResourceId texId, GLenu
 	bool fromunpackbuf = false;
 	{
 		GLint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		fromunpackbuf = (unpackbuf != 0);
 	}
 	
@@ -2284,7 +2296,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureImage2DEXT(GLuint texture, GLen
 		// didn't track and set them up, so unbind it and either we provide data (in buf)
 		// or just size the texture to be filled with data later (buf=NULL)
 		GLuint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, (GLint *)&unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		m_Real.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, 0);
 		
 		if(TextureBinding(Target) != eGL_TEXTURE_BINDING_CUBE_MAP)
@@ -2333,7 +2345,7 @@ void WrappedOpenGL::Common_glCompressedTextureImage2DEXT(ResourceId texId, GLenu
 	bool fromunpackbuf = false;
 	{
 		GLint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		fromunpackbuf = (unpackbuf != 0);
 	}
 	
@@ -2468,7 +2480,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureImage3DEXT(GLuint texture, GLen
 		// didn't track and set them up, so unbind it and either we provide data (in buf)
 		// or just size the texture to be filled with data later (buf=NULL)
 		GLuint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, (GLint *)&unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		m_Real.glBindBuffer(eGL_PIXEL_UNPACK_BUFFER, 0);
 
 		m_Real.glCompressedTextureImage3DEXT(GetResourceManager()->GetLiveResource(id).name, Target, Level, fmt, Width, Height, Depth, Border, byteSize, databuf);
@@ -2495,7 +2507,7 @@ void WrappedOpenGL::Common_glCompressedTextureImage3DEXT(ResourceId texId, GLenu
 	bool fromunpackbuf = false;
 	{
 		GLint unpackbuf = 0;
-		m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+		unpackbuf = GetUnpackBuffer();
 		fromunpackbuf = (unpackbuf != 0);
 	}
 
@@ -3285,7 +3297,7 @@ bool WrappedOpenGL::Serialise_glTextureSubImage1DEXT(GLuint texture, GLenum targ
 	SERIALISE_ELEMENT(ResourceId, id, GetResourceManager()->GetID(TextureRes(GetCtx(), texture)));
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 	
 	SERIALISE_ELEMENT(bool, UnpackBufBound, unpackbuf != 0);
 
@@ -3304,7 +3316,7 @@ bool WrappedOpenGL::Serialise_glTextureSubImage1DEXT(GLuint texture, GLenum targ
 
 	size_t subimageSize = GetByteSize(Width, 1, 1, Format, Type);
 
-	SERIALISE_ELEMENT_BUF_OPT(byte *, buf, srcPixels, subimageSize, !UnpackBufBound);
+	SERIALISE_ELEMENT_BUF_OPT_EXTERNAL(byte *, buf, srcPixels, subimageSize, !UnpackBufBound);
 	SERIALISE_ELEMENT(uint64_t, bufoffs, (uint64_t)pixels);
 
 	SAFE_DELETE_ARRAY(unpackedPixels);
@@ -3354,7 +3366,7 @@ void WrappedOpenGL::Common_glTextureSubImage1DEXT(GLResourceRecord *record, GLen
 	if(IsProxyTarget(format)) return;
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 
 	if(m_State == WRITING_IDLE && unpackbuf != 0)
 	{
@@ -3379,8 +3391,7 @@ void WrappedOpenGL::Common_glTextureSubImage1DEXT(GLResourceRecord *record, GLen
 
 			if(record->UpdateCount > 60)
 			{
-				m_HighTrafficResources.insert(record->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+				MarkHighTraffic(record);
 			}
 		}
 	}
@@ -3431,7 +3442,7 @@ bool WrappedOpenGL::Serialise_glTextureSubImage2DEXT(GLuint texture, GLenum targ
 	SERIALISE_ELEMENT(ResourceId, id, GetResourceManager()->GetID(TextureRes(GetCtx(), texture)));
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 	
 	SERIALISE_ELEMENT(bool, UnpackBufBound, unpackbuf != 0);
 
@@ -3450,7 +3461,7 @@ bool WrappedOpenGL::Serialise_glTextureSubImage2DEXT(GLuint texture, GLenum targ
 
 	size_t subimageSize = GetByteSize(Width, Height, 1, Format, Type);
 
-	SERIALISE_ELEMENT_BUF_OPT(byte *, buf, srcPixels, subimageSize, !UnpackBufBound);
+	SERIALISE_ELEMENT_BUF_OPT_EXTERNAL(byte *, buf, srcPixels, subimageSize, !UnpackBufBound);
 	SERIALISE_ELEMENT(uint64_t, bufoffs, (uint64_t)pixels);
 
 	SAFE_DELETE_ARRAY(unpackedPixels);
@@ -3500,7 +3511,7 @@ void WrappedOpenGL::Common_glTextureSubImage2DEXT(GLResourceRecord *record, GLen
 	if(IsProxyTarget(format)) return;
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 
 	if(m_State == WRITING_IDLE && unpackbuf != 0)
 	{
@@ -3525,8 +3536,7 @@ void WrappedOpenGL::Common_glTextureSubImage2DEXT(GLResourceRecord *record, GLen
 
 			if(record->UpdateCount > 60)
 			{
-				m_HighTrafficResources.insert(record->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+				MarkHighTraffic(record);
 			}
 		}
 	}
@@ -3579,7 +3589,7 @@ bool WrappedOpenGL::Serialise_glTextureSubImage3DEXT(GLuint texture, GLenum targ
 	SERIALISE_ELEMENT(ResourceId, id, GetResourceManager()->GetID(TextureRes(GetCtx(), texture)));
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 	
 	SERIALISE_ELEMENT(bool, UnpackBufBound, unpackbuf != 0);
 
@@ -3598,7 +3608,7 @@ bool WrappedOpenGL::Serialise_glTextureSubImage3DEXT(GLuint texture, GLenum targ
 
 	size_t subimageSize = GetByteSize(Width, Height, Depth, Format, Type);
 
-	SERIALISE_ELEMENT_BUF_OPT(byte *, buf, srcPixels, subimageSize, !UnpackBufBound);
+	SERIALISE_ELEMENT_BUF_OPT_EXTERNAL(byte *, buf, srcPixels, subimageSize, !UnpackBufBound);
 	SERIALISE_ELEMENT(uint64_t, bufoffs, (uint64_t)pixels);
 
 	SAFE_DELETE_ARRAY(unpackedPixels);
@@ -3648,7 +3658,7 @@ void WrappedOpenGL::Common_glTextureSubImage3DEXT(GLResourceRecord *record, GLen
 	if(IsProxyTarget(format)) return;
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 
 	if(m_State == WRITING_IDLE && unpackbuf != 0)
 	{
@@ -3673,8 +3683,7 @@ void WrappedOpenGL::Common_glTextureSubImage3DEXT(GLResourceRecord *record, GLen
 
 			if(record->UpdateCount > 60)
 			{
-				m_HighTrafficResources.insert(record->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+				MarkHighTraffic(record);
 			}
 		}
 	}
@@ -3722,7 +3731,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureSubImage1DEXT(GLuint texture, G
 	SERIALISE_ELEMENT(ResourceId, id, GetResourceManager()->GetID(TextureRes(GetCtx(), texture)));
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 	
 	SERIALISE_ELEMENT(bool, UnpackBufBound, unpackbuf != 0);
 
@@ -3740,7 +3749,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureSubImage1DEXT(GLuint texture, G
 	}
 	
 	SERIALISE_ELEMENT(uint32_t, byteSize, imageSize);
-	SERIALISE_ELEMENT_BUF_OPT(byte *, buf, srcPixels, byteSize, !UnpackBufBound);
+	SERIALISE_ELEMENT_BUF_OPT_EXTERNAL(byte *, buf, srcPixels, byteSize, !UnpackBufBound);
 	SERIALISE_ELEMENT(uint64_t, bufoffs, (uint64_t)pixels);
 
 	SAFE_DELETE_ARRAY(unpackedPixels);
@@ -3774,7 +3783,7 @@ void WrappedOpenGL::Common_glCompressedTextureSubImage1DEXT(GLResourceRecord *re
 	if(IsProxyTarget(format)) return;
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 
 	if(m_State == WRITING_IDLE && unpackbuf != 0)
 	{
@@ -3799,8 +3808,7 @@ void WrappedOpenGL::Common_glCompressedTextureSubImage1DEXT(GLResourceRecord *re
 
 			if(record->UpdateCount > 60)
 			{
-				m_HighTrafficResources.insert(record->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+				MarkHighTraffic(record);
 			}
 		}
 	}
@@ -3850,7 +3858,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureSubImage2DEXT(GLuint texture, G
 	SERIALISE_ELEMENT(ResourceId, id, GetResourceManager()->GetID(TextureRes(GetCtx(), texture)));
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 	
 	SERIALISE_ELEMENT(bool, UnpackBufBound, unpackbuf != 0);
 
@@ -3868,7 +3876,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureSubImage2DEXT(GLuint texture, G
 	}
 	
 	SERIALISE_ELEMENT(uint32_t, byteSize, imageSize);
-	SERIALISE_ELEMENT_BUF_OPT(byte *, buf, srcPixels, byteSize, !UnpackBufBound);
+	SERIALISE_ELEMENT_BUF_OPT_EXTERNAL(byte *, buf, srcPixels, byteSize, !UnpackBufBound);
 	SERIALISE_ELEMENT(uint64_t, bufoffs, (uint64_t)pixels);
 
 	SAFE_DELETE_ARRAY(unpackedPixels);
@@ -3902,7 +3910,7 @@ void WrappedOpenGL::Common_glCompressedTextureSubImage2DEXT(GLResourceRecord *re
 	if(IsProxyTarget(format)) return;
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 
 	if(m_State == WRITING_IDLE && unpackbuf != 0)
 	{
@@ -3927,8 +3935,7 @@ void WrappedOpenGL::Common_glCompressedTextureSubImage2DEXT(GLResourceRecord *re
 
 			if(record->UpdateCount > 60)
 			{
-				m_HighTrafficResources.insert(record->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+				MarkHighTraffic(record);
 			}
 		}
 	}
@@ -3980,7 +3987,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureSubImage3DEXT(GLuint texture, G
 	SERIALISE_ELEMENT(ResourceId, id, GetResourceManager()->GetID(TextureRes(GetCtx(), texture)));
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 	
 	SERIALISE_ELEMENT(bool, UnpackBufBound, unpackbuf != 0);
 
@@ -3998,7 +4005,7 @@ bool WrappedOpenGL::Serialise_glCompressedTextureSubImage3DEXT(GLuint texture, G
 	}
 	
 	SERIALISE_ELEMENT(uint32_t, byteSize, imageSize);
-	SERIALISE_ELEMENT_BUF_OPT(byte *, buf, srcPixels, byteSize, !UnpackBufBound);
+	SERIALISE_ELEMENT_BUF_OPT_EXTERNAL(byte *, buf, srcPixels, byteSize, !UnpackBufBound);
 	SERIALISE_ELEMENT(uint64_t, bufoffs, (uint64_t)pixels);
 
 	SAFE_DELETE_ARRAY(unpackedPixels);
@@ -4032,7 +4039,7 @@ void WrappedOpenGL::Common_glCompressedTextureSubImage3DEXT(GLResourceRecord *re
 	if(IsProxyTarget(format)) return;
 	
 	GLint unpackbuf = 0;
-	m_Real.glGetIntegerv(eGL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuf);
+	unpackbuf = GetUnpackBuffer();
 
 	if(m_State == WRITING_IDLE && unpackbuf != 0)
 	{
@@ -4057,8 +4064,7 @@ void WrappedOpenGL::Common_glCompressedTextureSubImage3DEXT(GLResourceRecord *re
 
 			if(record->UpdateCount > 60)
 			{
-				m_HighTrafficResources.insert(record->GetResourceID());
-				GetResourceManager()->MarkDirtyResource(record->GetResourceID());
+				MarkHighTraffic(record);
 			}
 		}
 	}
@@ -76,6 +76,8 @@ bool WrappedOpenGL::Serialise_glProgramUniformVector(GLuint program, GLint locat
 	else if(m_State <= EXECUTING)
 	{
 		value = m_pSerialiser->RawReadBytes(elemSize*elemsPerVec*Count);
+		if(value == NULL)
+			return false;
 		
 		ResourceId liveProgId = GetResourceManager()->GetLiveID(id);
 		GLuint live = GetResourceManager()->GetLiveResource(id).name;
@@ -222,6 +224,8 @@ bool WrappedOpenGL::Serialise_glProgramUniformMatrix(GLuint program, GLint locat
 	else if(m_State <= EXECUTING)
 	{
 		value = m_pSerialiser->RawReadBytes(elemSize*elemsPerMat*Count);
+		if(value == NULL)
+			return false;
 		
 		ResourceId liveProgId = GetResourceManager()->GetLiveID(id);
 		GLuint live = GetResourceManager()->GetLiveResource(id).name;
@@ -293,7 +297,7 @@ void WrappedOpenGL::CONCAT(CONCAT(FUNCNAME, count), suffix)(FUNCPARAMS, __VA_ARG
 	} \
 	else if(m_State == WRITING_IDLE) \
 	{ \
-		GetResourceManager()->MarkDirtyResource(ProgramRes(GetCtx(), PROGRAM)); \
+		MarkUniformProgramDirty(PROGRAM); \
 	} \
 }
 
@@ -390,7 +394,7 @@ void WrappedOpenGL::CONCAT(CONCAT(FUNCNAME, unicount), CONCAT(suffix, v))(FUNCPA
 	} \
 	else if(m_State == WRITING_IDLE) \
 	{ \
-		GetResourceManager()->MarkDirtyResource(ProgramRes(GetCtx(), PROGRAM)); \
+		MarkUniformProgramDirty(PROGRAM); \
 	} \
 }
 
@@ -466,7 +470,7 @@ void WrappedOpenGL::CONCAT(CONCAT(FUNCNAME, dim), suffix)(FUNCPARAMS, GLsizei co
 	} \
 	else if(m_State == WRITING_IDLE) \
 	{ \
-		GetResourceManager()->MarkDirtyResource(ProgramRes(GetCtx(), PROGRAM)); \
+		MarkUniformProgramDirty(PROGRAM); \
 	} \
 }
 
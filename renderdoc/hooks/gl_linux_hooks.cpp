@@ -110,7 +110,7 @@ void *libGLdlsymHandle = RTLD_NEXT; // default to RTLD_NEXT, but overwritten if
             for I in `seq 1 $N`; do echo -n "t$I p$I"; if [ $I -ne $N ]; then echo -n ", "; fi; done;
         echo ") \\";
  
-        echo -en "\t{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(";
+        echo -en "\t{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(";
             for I in `seq 1 $N`; do echo -n "p$I"; if [ $I -ne $N ]; then echo -n ", "; fi; done;
         echo "); } \\";
 
@@ -118,7 +118,7 @@ void *libGLdlsymHandle = RTLD_NEXT; // default to RTLD_NEXT, but overwritten if
             for I in `seq 1 $N`; do echo -n "t$I p$I"; if [ $I -ne $N ]; then echo -n ", "; fi; done;
         echo ") \\";
  
-        echo -en "\t{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(";
+        echo -en "\t{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(";
             for I in `seq 1 $N`; do echo -n "p$I"; if [ $I -ne $N ]; then echo -n ", "; fi; done;
         echo -n "); }";
     }
@@ -146,114 +146,114 @@ void *libGLdlsymHandle = RTLD_NEXT; // default to RTLD_NEXT, but overwritten if
 	typedef ret (*CONCAT(function, _hooktype)) (); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function() \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(); } \
 	ret CONCAT(function,_renderdoc_hooked)() \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(); }
 #define HookWrapper1(ret, function, t1, p1) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1); }
 #define HookWrapper2(ret, function, t1, p1, t2, p2) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2); }
 #define HookWrapper3(ret, function, t1, p1, t2, p2, t3, p3) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3); }
 #define HookWrapper4(ret, function, t1, p1, t2, p2, t3, p3, t4, p4) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4); }
 #define HookWrapper5(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5); }
 #define HookWrapper6(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6); }
 #define HookWrapper7(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7); }
 #define HookWrapper8(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8); }
 #define HookWrapper9(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9); }
 #define HookWrapper10(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); }
 #define HookWrapper11(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); }
 #define HookWrapper12(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); }
 #define HookWrapper13(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); }
 #define HookWrapper14(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13, t14, p14) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13, t14 p14) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13, t14 p14) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); }
 #define HookWrapper15(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13, t14, p14, t15, p15) \
 	typedef ret (*CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15); \
 	extern "C" __attribute__ ((visibility ("default"))) \
 	ret function(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13, t14 p14, t15 p15) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); } \
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); } \
 	ret CONCAT(function,_renderdoc_hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13, t14 p14, t15 p15) \
-	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); }
+	{ SCOPED_LOCK(glLock); return OpenGLHook::glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); }
 
 Threading::CriticalSection glLock;
 
@@ -566,6 +566,230 @@ DefineGLExtensionHooks();
 
 DefineUnsupportedDummies();
 
+// The real GL entry points aren't looked up until they're first called. PopulateHooks points
+// every entry in the hookset at a _renderdoc_resolve trampoline, which fetches the real
+// function, writes it back into the hookset so later calls go straight through, and then
+// forwards the call. Startup then only costs a pointer store per function, instead of a
+// lookup in libGL (and a walk of every name in glXGetProcAddress) for ~2000 functions that
+// the application mostly never uses.
+
+static void *ResolveRealFunction(const char *name)
+{
+	void *ret = NULL;
+
+	if(OpenGLHook::glhooks.glXGetProcAddress_real)
+		ret = (void *)OpenGLHook::glhooks.glXGetProcAddress_real((const GLubyte *)name);
+
+	if(ret == NULL)
+		ret = dlsym(libGLdlsymHandle, name);
+
+	return ret;
+}
+
+template<typename funcPtrType>
+static void SetRealFunction(funcPtrType &slot, void *realFunc)
+{
+	slot = (funcPtrType)realFunc;
+}
+
+template<typename T>
+static T DefaultReturn()
+{
+	return T();
+}
+
+/*
+	in bash:
+
+    function HookWrapper()
+    {
+        N=$1;
+        echo "#undef HookWrapper$N";
+        echo -n "#define HookWrapper$N(ret, function";
+            for I in `seq 1 $N`; do echo -n ", t$I, p$I"; done;
+        echo ") \\";
+
+        echo -en "  ret CONCAT(function,_renderdoc_resolve)(";
+            for I in `seq 1 $N`; do echo -n "t$I p$I"; if [ $I -ne $N ]; then echo -n ", "; fi; done;
+        echo ") \\";
+ 
+        echo -e "  { \\";
+        echo -e "  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \\";
+        echo -e "  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR(\"Couldn't resolve \" STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \\";
+        echo -e "  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \\";
+        echo -en "  return real(";
+            for I in `seq 1 $N`; do echo -n "p$I"; if [ $I -ne $N ]; then echo -n ", "; fi; done;
+        echo -e "); \\";
+        echo -e "  }";
+    }
+
+  for I in `seq 0 15`; do HookWrapper $I; echo; done
+
+	*/
+
+#undef HookWrapper0
+#define HookWrapper0(ret, function) \
+  ret CONCAT(function,_renderdoc_resolve)() \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(); \
+  }
+
+#undef HookWrapper1
+#define HookWrapper1(ret, function, t1, p1) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1); \
+  }
+
+#undef HookWrapper2
+#define HookWrapper2(ret, function, t1, p1, t2, p2) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2); \
+  }
+
+#undef HookWrapper3
+#define HookWrapper3(ret, function, t1, p1, t2, p2, t3, p3) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3); \
+  }
+
+#undef HookWrapper4
+#define HookWrapper4(ret, function, t1, p1, t2, p2, t3, p3, t4, p4) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4); \
+  }
+
+#undef HookWrapper5
+#define HookWrapper5(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5); \
+  }
+
+#undef HookWrapper6
+#define HookWrapper6(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6); \
+  }
+
+#undef HookWrapper7
+#define HookWrapper7(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7); \
+  }
+
+#undef HookWrapper8
+#define HookWrapper8(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7, p8); \
+  }
+
+#undef HookWrapper9
+#define HookWrapper9(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7, p8, p9); \
+  }
+
+#undef HookWrapper10
+#define HookWrapper10(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); \
+  }
+
+#undef HookWrapper11
+#define HookWrapper11(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); \
+  }
+
+#undef HookWrapper12
+#define HookWrapper12(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); \
+  }
+
+#undef HookWrapper13
+#define HookWrapper13(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); \
+  }
+
+#undef HookWrapper14
+#define HookWrapper14(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13, t14, p14) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13, t14 p14) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); \
+  }
+
+#undef HookWrapper15
+#define HookWrapper15(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13, t14, p14, t15, p15) \
+  ret CONCAT(function,_renderdoc_resolve)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13, t14 p14, t15 p15) \
+  { \
+  CONCAT(function, _hooktype) real = (CONCAT(function, _hooktype))ResolveRealFunction(STRINGIZE(function)); \
+  if(real == NULL) { static bool hit = false; if(hit == false) { RDCERR("Couldn't resolve " STRINGIZE(function)); hit = true; } return DefaultReturn<ret>(); } \
+  SetRealFunction(OpenGLHook::glhooks.GL.function, (void *)real); \
+  return real(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); \
+  }
+
+DefineDLLExportHooks();
+DefineGLExtensionHooks();
+
 __attribute__ ((visibility ("default")))
 GLXContext glXCreateContext(Display *dpy, XVisualInfo *vis, GLXContext shareList, Bool direct)
 {
@@ -838,19 +1062,51 @@ bool OpenGLHook::PopulateHooks()
 		glXGetProcAddress_real = (PFNGLXGETPROCADDRESSPROC)dlsym(libGLdlsymHandle, "glXGetProcAddress");
 
 	glXGetProcAddress_real((const GLubyte *)"glXCreateContextAttribsARB");
+
+	// when replaying we want the real functions up front, so that the emulation below can
+	// see what's genuinely missing. When capturing, functions are resolved on first call.
+	bool lazy = !RenderDoc::Inst().IsReplayApp();
 	
 #undef HookInit
-#define HookInit(function) if(GL.function == NULL) { GL.function = (CONCAT(function, _hooktype))dlsym(libGLdlsymHandle, STRINGIZE(function)); glXGetProcAddress((const GLubyte *)STRINGIZE(function)); }
-	
-	// cheeky
+#define HookInit(function) \
+	if(GL.function == NULL) \
+	{ \
+		if(lazy) SetRealFunction(GL.function, (void *)&CONCAT(function, _renderdoc_resolve)); \
+		else     SetRealFunction(GL.function, ResolveRealFunction(STRINGIZE(function))); \
+	}
 #undef HookExtension
-#define HookExtension(funcPtrType, function) glXGetProcAddress((const GLubyte *)STRINGIZE(function))
+#define HookExtension(funcPtrType, function) HookInit(function)
 #undef HookExtensionAlias
 #define HookExtensionAlias(funcPtrType, function, alias)
 
 	DLLExportHooks();
 	HookCheckGLExtensions();
 
+	// a few optional functions are checked against NULL before they're used, so they
+	// need their real value rather than a trampoline.
+	if(lazy)
+	{
+#define ResolveNow(function) SetRealFunction(GL.function, ResolveRealFunction(STRINGIZE(function)))
+		ResolveNow(glClipControl);
+		ResolveNow(glDepthBoundsEXT);
+		ResolveNow(glDebugMessageCallback);
+		ResolveNow(glFenceSync);
+		ResolveNow(glClientWaitSync);
+		ResolveNow(glMapNamedBufferRangeEXT);
+		ResolveNow(glVertexArrayVertexAttribDivisorEXT);
+		ResolveNow(glTextureStorage2DEXT);
+		ResolveNow(glGetTextureLevelParameterivEXT);
+		ResolveNow(glGetProgramBinary);
+		ResolveNow(glProgramBinary);
+		ResolveNow(glGetInternalformativ);
+		ResolveNow(glBindProgramPipeline);
+		ResolveNow(glGetStringi);
+		ResolveNow(glGetIntegeri_v);
+		ResolveNow(glGenVertexArrays);
+		ResolveNow(glBindVertexArray);
+#undef ResolveNow
+	}
+
 	// see gl_emulated.cpp
 	if(RenderDoc::Inst().IsReplayApp()) glEmulate::EmulateUnsupportedFunctions(&GL);
 
@@ -97,7 +97,7 @@ namespace glEmulate { void EmulateUnsupportedFunctions(GLHookSet *hooks); }
             for I in `seq 1 $N`; do echo -n "t$I p$I"; if [ $I -ne $N ]; then echo -n ", "; fi; done;
         echo ") \\";
         
-        echo -en "\t{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(";
+        echo -en "\t{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(";
             for I in `seq 1 $N`; do echo -n "p$I"; if [ $I -ne $N ]; then echo -n ", "; fi; done;
         echo -n "); }";
     }
@@ -119,97 +119,97 @@ namespace glEmulate { void EmulateUnsupportedFunctions(GLHookSet *hooks); }
 	Hook<ret (WINAPI *) ()> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (); \
 	static ret WINAPI CONCAT(function, _hooked)() \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(); }
 
 #define HookWrapper1(ret, function, t1, p1) \
 	Hook<ret (WINAPI *) (t1)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1); }
 
 #define HookWrapper2(ret, function, t1, p1, t2, p2) \
 	Hook<ret (WINAPI *) (t1, t2)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2); }
 
 #define HookWrapper3(ret, function, t1, p1, t2, p2, t3, p3) \
 	Hook<ret (WINAPI *) (t1, t2, t3)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3); }
 
 #define HookWrapper4(ret, function, t1, p1, t2, p2, t3, p3, t4, p4) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4); }
 
 #define HookWrapper5(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5); }
 
 #define HookWrapper6(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6); }
 
 #define HookWrapper7(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7); }
 
 #define HookWrapper8(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7, t8)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8); }
 
 #define HookWrapper9(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7, t8, t9)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9); }
 
 #define HookWrapper10(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); }
 
 #define HookWrapper11(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); }
 
 #define HookWrapper12(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); }
 
 #define HookWrapper13(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); }
 
 #define HookWrapper14(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13, t14, p14) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13, t14 p14) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); }
 
 #define HookWrapper15(ret, function, t1, p1, t2, p2, t3, p3, t4, p4, t5, p5, t6, p6, t7, p7, t8, p8, t9, p9, t10, p10, t11, p11, t12, p12, t13, p13, t14, p14, t15, p15) \
 	Hook<ret (WINAPI *) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15)> CONCAT(function, _hook); \
 	typedef ret (WINAPI *CONCAT(function, _hooktype)) (t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15); \
 	static ret WINAPI CONCAT(function, _hooked)(t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8, t9 p9, t10 p10, t11 p11, t12 p12, t13 p13, t14 p14, t15 p15) \
-	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); }
+	{ SCOPED_LOCK(glLock); return glhooks.GetDriver()->CountCall()->function(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); }
 
 Threading::CriticalSection glLock;
 
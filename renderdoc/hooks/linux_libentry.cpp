@@ -46,8 +46,16 @@ void library_loaded()
 	}
 	else
 	{
+		// set for processes that we've been inherited into from a parent that's being captured
+		RenderDoc::Inst().SetBootstrap(getenv("RENDERDOC_BOOTSTRAP") != NULL);
+		RenderDoc::Inst().SetLazyCrashHandler(getenv("RENDERDOC_LAZY_CRASH_HANDLER") != NULL);
+
 		RenderDoc::Inst().Initialise();
 
+		// LD_PRELOAD is inherited by any children, so they should only do the minimum
+		// until (if ever) they start rendering
+		setenv("RENDERDOC_BOOTSTRAP", "1", 1);
+
 		char *logfile = getenv("RENDERDOC_LOGFILE");
 		char *opts = getenv("RENDERDOC_CAPTUREOPTS");
 
@@ -67,9 +67,19 @@ BOOL add_hooks()
 
 		return true;
 	}
+
+	// set by the global hook shim and when injecting into child processes, see
+	// RenderDoc::SetBootstrap
+	RenderDoc::Inst().SetBootstrap(GetEnvironmentVariableA("RENDERDOC_BOOTSTRAP", NULL, 0) > 0);
+	// see RenderDoc::SetLazyCrashHandler
+	RenderDoc::Inst().SetLazyCrashHandler(GetEnvironmentVariableA("RENDERDOC_LAZY_CRASH_HANDLER", NULL, 0) > 0);
 	
 	RenderDoc::Inst().Initialise();
 
+	// any child processes we get injected into with HookIntoChildren inherit this, so they
+	// only do the minimum until (if ever) they start rendering
+	SetEnvironmentVariableA("RENDERDOC_BOOTSTRAP", "1");
+
 	RDCLOG("Loading into %ls", curFile);
 
 	LibraryHooks::GetInstance().CreateHooks();
@@ -0,0 +1,473 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Crytek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "common/common.h"
+#include "maths/formatpacking.h"
+
+#include <string.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+// x86 SIMD conversion kernels, F16C selected at runtime
+#define FORMAT_CONVERT_X86
+#endif
+
+#if defined(FORMAT_CONVERT_X86)
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define FORMAT_CONVERT_F16C_FUNC
+#else
+#include <cpuid.h>
+#define FORMAT_CONVERT_F16C_FUNC __attribute__((target("f16c")))
+#endif
+
+#endif
+
+// The batch conversions below are all branch-free and IEEE correct, so unlike the scalar
+// ConvertFromHalf they keep the sign of zero and distinguish infinities from NaNs. Every
+// path (F16C, SSE2 and the portable fallback) produces the same values for non-NaN input.
+
+#if defined(FORMAT_CONVERT_X86)
+
+// converts four halfs, zero-extended in 32-bit lanes, to floats. Denormal halfs are
+// renormalised with a float subtract so this is still correct with denormals-are-zero set.
+static inline __m128 HalfToFloat_SSE2(__m128i h)
+{
+	const __m128i shiftedExp = _mm_set1_epi32(0x7c00 << 13);
+	const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+
+	__m128i o = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+	__m128i exp = _mm_and_si128(o, shiftedExp);
+
+	// rebias the exponent, and again for inf/nan so the exponent ends up as 0xff
+	o = _mm_add_epi32(o, _mm_set1_epi32((127 - 15) << 23));
+	o = _mm_add_epi32(o, _mm_and_si128(_mm_cmpeq_epi32(exp, shiftedExp), _mm_set1_epi32((128 - 16) << 23)));
+
+	// denormals come out as 2^-14 * (1 + mantissa), subtract the implicit 1 back off
+	__m128i denorm = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+	__m128 renorm = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(1 << 23))), magic);
+
+	__m128 ret = _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(denorm), renorm),
+	                       _mm_andnot_ps(_mm_castsi128_ps(denorm), _mm_castsi128_ps(o)));
+
+	__m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+
+	return _mm_or_ps(ret, _mm_castsi128_ps(sign));
+}
+
+// converts four floats to halfs in the low 16 bits of each 32-bit lane, rounding to
+// nearest even. NaNs become a quiet NaN, overflow becomes infinity.
+static inline __m128i FloatToHalf_SSE2(__m128 f)
+{
+	const __m128 denormMagic = _mm_castsi128_ps(_mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23));
+
+	__m128i u = _mm_castps_si128(f);
+	__m128i sign = _mm_and_si128(u, _mm_set1_epi32(0x80000000));
+	u = _mm_xor_si128(u, sign);
+
+	// with the sign removed the signed integer compares order the floats correctly
+	__m128i infnan = _mm_cmpgt_epi32(u, _mm_set1_epi32(((127 + 16) << 23) - 1));
+	__m128i nan = _mm_cmpgt_epi32(u, _mm_set1_epi32(255 << 23));
+	__m128i denorm = _mm_cmpgt_epi32(_mm_set1_epi32(113 << 23), u);
+
+	__m128i infnanResult = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(nan, _mm_set1_epi32(0x0200)));
+
+	// let the FPU round the mantissa into place for values that will be denormal halfs
+	__m128i denormResult = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), denormMagic)),
+	                                     _mm_castps_si128(denormMagic));
+
+	// rebias the exponent ((15-127) << 23) and round to nearest even
+	__m128i mantOdd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+	__m128i normResult = _mm_add_epi32(u, _mm_set1_epi32((int)0xC8000FFF));
+	normResult = _mm_srli_epi32(_mm_add_epi32(normResult, mantOdd), 13);
+
+	__m128i ret = _mm_or_si128(_mm_and_si128(denorm, denormResult), _mm_andnot_si128(denorm, normResult));
+	ret = _mm_or_si128(_mm_and_si128(infnan, infnanResult), _mm_andnot_si128(infnan, ret));
+
+	return _mm_or_si128(ret, _mm_srli_epi32(sign, 16));
+}
+
+// writes four RGB vectors out as Vec4fs with a given alpha
+static inline void StoreRGBA_SSE2(Vec4f *dst, __m128 r, __m128 g, __m128 b, __m128 a)
+{
+	_MM_TRANSPOSE4_PS(r, g, b, a);
+
+	_mm_storeu_ps(&dst[0].x, r);
+	_mm_storeu_ps(&dst[1].x, g);
+	_mm_storeu_ps(&dst[2].x, b);
+	_mm_storeu_ps(&dst[3].x, a);
+}
+
+static void FromHalf_SSE2(const uint16_t *src, float *dst, size_t count)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	size_t i=0;
+	for(; i+8 <= count; i += 8)
+	{
+		__m128i h = _mm_loadu_si128((const __m128i *)(src+i));
+
+		_mm_storeu_ps(dst+i+0, HalfToFloat_SSE2(_mm_unpacklo_epi16(h, zero)));
+		_mm_storeu_ps(dst+i+4, HalfToFloat_SSE2(_mm_unpackhi_epi16(h, zero)));
+	}
+
+	if(i < count)
+	{
+		uint16_t h[8] = {0};
+		float f[8];
+		memcpy(h, src+i, (count-i)*sizeof(uint16_t));
+
+		__m128i v = _mm_loadu_si128((const __m128i *)h);
+		_mm_storeu_ps(f+0, HalfToFloat_SSE2(_mm_unpacklo_epi16(v, zero)));
+		_mm_storeu_ps(f+4, HalfToFloat_SSE2(_mm_unpackhi_epi16(v, zero)));
+
+		memcpy(dst+i, f, (count-i)*sizeof(float));
+	}
+}
+
+static inline __m128i PackHalfs_SSE2(__m128i lo, __m128i hi)
+{
+	// sign extend the low 16 bits so the signed saturating pack keeps them intact
+	lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+	hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+	return _mm_packs_epi32(lo, hi);
+}
+
+static void ToHalf_SSE2(const float *src, uint16_t *dst, size_t count)
+{
+	size_t i=0;
+	for(; i+8 <= count; i += 8)
+	{
+		__m128i lo = FloatToHalf_SSE2(_mm_loadu_ps(src+i+0));
+		__m128i hi = FloatToHalf_SSE2(_mm_loadu_ps(src+i+4));
+		_mm_storeu_si128((__m128i *)(dst+i), PackHalfs_SSE2(lo, hi));
+	}
+
+	if(i < count)
+	{
+		float f[8] = {0};
+		uint16_t h[8];
+		memcpy(f, src+i, (count-i)*sizeof(float));
+
+		__m128i lo = FloatToHalf_SSE2(_mm_loadu_ps(f+0));
+		__m128i hi = FloatToHalf_SSE2(_mm_loadu_ps(f+4));
+		_mm_storeu_si128((__m128i *)h, PackHalfs_SSE2(lo, hi));
+
+		memcpy(dst+i, h, (count-i)*sizeof(uint16_t));
+	}
+}
+
+FORMAT_CONVERT_F16C_FUNC
+static void FromHalf_F16C(const uint16_t *src, float *dst, size_t count)
+{
+	size_t i=0;
+	for(; i+8 <= count; i += 8)
+	{
+		__m128i h = _mm_loadu_si128((const __m128i *)(src+i));
+
+		_mm_storeu_ps(dst+i+0, _mm_cvtph_ps(h));
+		_mm_storeu_ps(dst+i+4, _mm_cvtph_ps(_mm_unpackhi_epi64(h, h)));
+	}
+
+	if(i < count)
+	{
+		uint16_t h[8] = {0};
+		float f[8];
+		memcpy(h, src+i, (count-i)*sizeof(uint16_t));
+
+		__m128i v = _mm_loadu_si128((const __m128i *)h);
+		_mm_storeu_ps(f+0, _mm_cvtph_ps(v));
+		_mm_storeu_ps(f+4, _mm_cvtph_ps(_mm_unpackhi_epi64(v, v)));
+
+		memcpy(dst+i, f, (count-i)*sizeof(float));
+	}
+}
+
+FORMAT_CONVERT_F16C_FUNC
+static void ToHalf_F16C(const float *src, uint16_t *dst, size_t count)
+{
+	// rounding mode 0 is round to nearest even, same as the other paths
+	size_t i=0;
+	for(; i+8 <= count; i += 8)
+	{
+		__m128i lo = _mm_cvtps_ph(_mm_loadu_ps(src+i+0), 0);
+		__m128i hi = _mm_cvtps_ph(_mm_loadu_ps(src+i+4), 0);
+		_mm_storeu_si128((__m128i *)(dst+i), _mm_unpacklo_epi64(lo, hi));
+	}
+
+	if(i < count)
+	{
+		float f[8] = {0};
+		uint16_t h[8];
+		memcpy(f, src+i, (count-i)*sizeof(float));
+
+		__m128i lo = _mm_cvtps_ph(_mm_loadu_ps(f+0), 0);
+		__m128i hi = _mm_cvtps_ph(_mm_loadu_ps(f+4), 0);
+		_mm_storeu_si128((__m128i *)h, _mm_unpacklo_epi64(lo, hi));
+
+		memcpy(dst+i, h, (count-i)*sizeof(uint16_t));
+	}
+}
+
+static bool CPUHasF16C()
+{
+	uint32_t ecx = 0;
+
+#if defined(_MSC_VER)
+	int info[4] = {0};
+	__cpuid(info, 1);
+	ecx = (uint32_t)info[2];
+#else
+	uint32_t eax = 0, ebx = 0, edx = 0;
+	if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return false;
+#endif
+
+	// F16C is VEX encoded, so like AVX it needs OSXSAVE and the OS saving the YMM state
+	if(!(ecx & (1<<29)) || !(ecx & (1<<27)) || !(ecx & (1<<28)))
+		return false;
+
+#if defined(_MSC_VER)
+	uint64_t xcr0 = _xgetbv(0);
+#else
+	uint32_t lo = 0, hi = 0;
+	__asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	uint64_t xcr0 = ((uint64_t)hi<<32) | lo;
+#endif
+
+	return (xcr0 & 0x6) == 0x6;
+}
+
+#else // !defined(FORMAT_CONVERT_X86)
+
+// portable versions of the same bit tricks, one value at a time
+static inline float HalfToFloat_Bits(uint16_t h)
+{
+	const uint32_t shiftedExp = 0x7c00 << 13;
+
+	uint32_t o = uint32_t(h & 0x7fff) << 13;
+	uint32_t exp = o & shiftedExp;
+	o += (127 - 15) << 23;
+
+	float ret;
+
+	if(exp == shiftedExp)
+	{
+		o += (128 - 16) << 23;
+		memcpy(&ret, &o, sizeof(ret));
+	}
+	else if(exp == 0)
+	{
+		const uint32_t magicBits = 113 << 23;
+		float magic;
+		memcpy(&magic, &magicBits, sizeof(magic));
+
+		o += 1 << 23;
+		memcpy(&ret, &o, sizeof(ret));
+		ret -= magic;
+	}
+	else
+	{
+		memcpy(&ret, &o, sizeof(ret));
+	}
+
+	uint32_t bits;
+	memcpy(&bits, &ret, sizeof(bits));
+	bits |= uint32_t(h & 0x8000) << 16;
+	memcpy(&ret, &bits, sizeof(ret));
+
+	return ret;
+}
+
+static inline uint16_t FloatToHalf_Bits(float f)
+{
+	const uint32_t denormMagicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+	float denormMagic;
+	memcpy(&denormMagic, &denormMagicBits, sizeof(denormMagic));
+
+	uint32_t u;
+	memcpy(&u, &f, sizeof(u));
+
+	uint32_t sign = u & 0x80000000;
+	u ^= sign;
+
+	uint32_t ret = 0;
+
+	if(u >= (127 + 16) << 23)
+	{
+		ret = (u > (255 << 23)) ? 0x7e00 : 0x7c00;
+	}
+	else if(u < (113 << 23))
+	{
+		memcpy(&f, &u, sizeof(f));
+		f += denormMagic;
+		memcpy(&ret, &f, sizeof(ret));
+		ret -= denormMagicBits;
+	}
+	else
+	{
+		uint32_t mantOdd = (u >> 13) & 1;
+		u += 0xC8000FFF; // (15-127) << 23, plus rounding
+		u += mantOdd;
+		ret = u >> 13;
+	}
+
+	return uint16_t(ret | (sign >> 16));
+}
+
+static void FromHalf_Portable(const uint16_t *src, float *dst, size_t count)
+{
+	for(size_t i=0; i < count; i++)
+		dst[i] = HalfToFloat_Bits(src[i]);
+}
+
+static void ToHalf_Portable(const float *src, uint16_t *dst, size_t count)
+{
+	for(size_t i=0; i < count; i++)
+		dst[i] = FloatToHalf_Bits(src[i]);
+}
+
+#endif
+
+struct HalfConverter
+{
+	void (*FromHalf)(const uint16_t *src, float *dst, size_t count);
+	void (*ToHalf)(const float *src, uint16_t *dst, size_t count);
+};
+
+static HalfConverter ChooseHalfConverter()
+{
+#if defined(FORMAT_CONVERT_X86)
+	HalfConverter ret = { &FromHalf_SSE2, &ToHalf_SSE2 };
+
+	if(CPUHasF16C())
+	{
+		ret.FromHalf = &FromHalf_F16C;
+		ret.ToHalf = &ToHalf_F16C;
+	}
+#else
+	HalfConverter ret = { &FromHalf_Portable, &ToHalf_Portable };
+#endif
+
+	return ret;
+}
+
+static HalfConverter halfConverter = ChooseHalfConverter();
+
+void ConvertFromHalf(const uint16_t *src, float *dst, size_t count)
+{
+	halfConverter.FromHalf(src, dst, count);
+}
+
+void ConvertToHalf(const float *src, uint16_t *dst, size_t count)
+{
+	halfConverter.ToHalf(src, dst, count);
+}
+
+void ConvertFromR10G10B10A2(const uint32_t *src, Vec4f *dst, size_t count)
+{
+#if defined(FORMAT_CONVERT_X86)
+	// the components are masked in place without shifting down, and divided by a max value
+	// scaled by the same power of two, so the results are exactly float(c)/1023.0f. Alpha
+	// is shifted down by two first so that it doesn't set the sign bit.
+	const __m128i rgbMask = _mm_set_epi32(0, 0x3ff << 20, 0x3ff << 10, 0x3ff);
+	const __m128i alphaMask = _mm_set_epi32(0x3 << 28, 0, 0, 0);
+	const __m128 divisor = _mm_set_ps(3.0f*float(1<<28), 1023.0f*float(1<<20), 1023.0f*float(1<<10), 1023.0f);
+
+	for(size_t i=0; i < count; i++)
+	{
+		__m128i p = _mm_set1_epi32((int)src[i]);
+		__m128i comps = _mm_or_si128(_mm_and_si128(p, rgbMask), _mm_and_si128(_mm_srli_epi32(p, 2), alphaMask));
+
+		_mm_storeu_ps(&dst[i].x, _mm_div_ps(_mm_cvtepi32_ps(comps), divisor));
+	}
+#else
+	for(size_t i=0; i < count; i++)
+		dst[i] = ConvertFromR10G10B10A2(src[i]);
+#endif
+}
+
+void ConvertFromR11G11B10(const uint32_t *src, Vec4f *dst, size_t count)
+{
+	size_t i=0;
+
+#if defined(FORMAT_CONVERT_X86)
+	// each component is a half without a sign bit and with a truncated mantissa, so shift
+	// them into half layout and reuse the half conversion
+	const __m128i mask11 = _mm_set1_epi32(0x7ff << 4);
+	const __m128i mask10 = _mm_set1_epi32(0x3ff << 5);
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	for(; i+4 <= count; i += 4)
+	{
+		__m128i p = _mm_loadu_si128((const __m128i *)(src+i));
+
+		__m128 r = HalfToFloat_SSE2(_mm_and_si128(_mm_slli_epi32(p, 4), mask11));
+		__m128 g = HalfToFloat_SSE2(_mm_and_si128(_mm_srli_epi32(p, 7), mask11));
+		__m128 b = HalfToFloat_SSE2(_mm_and_si128(_mm_srli_epi32(p, 17), mask10));
+
+		StoreRGBA_SSE2(dst+i, r, g, b, one);
+	}
+#endif
+
+	for(; i < count; i++)
+	{
+		Vec3f v = ConvertFromR11G11B10(src[i]);
+		dst[i] = Vec4f(v.x, v.y, v.z, 1.0f);
+	}
+}
+
+void ConvertFromR9G9B9E5(const uint32_t *src, Vec4f *dst, size_t count)
+{
+	size_t i=0;
+
+#if defined(FORMAT_CONVERT_X86)
+	const __m128i mask9 = _mm_set1_epi32(0x1ff);
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	for(; i+4 <= count; i += 4)
+	{
+		__m128i p = _mm_loadu_si128((const __m128i *)(src+i));
+
+		// build 2^(exponent - 15 - 9) directly. It's always a normal float
+		__m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_srli_epi32(p, 27), _mm_set1_epi32(127 - 15 - 9)), 23));
+
+		__m128 r = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(p, mask9)), scale);
+		__m128 g = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 9), mask9)), scale);
+		__m128 b = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 18), mask9)), scale);
+
+		StoreRGBA_SSE2(dst+i, r, g, b, one);
+	}
+#endif
+
+	for(; i < count; i++)
+	{
+		Vec3f v = ConvertFromR9G9B9E5(src[i]);
+		dst[i] = Vec4f(v.x, v.y, v.z, 1.0f);
+	}
+}
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include "vec.h"
 
@@ -71,6 +72,7 @@ inline Vec3f ConvertFromR11G11B10(uint32_t data)
 	// R11G11B10 has 6/6/5 bit mantissas, 5bit exponents
 
 	const int mantissaShift[] = { 23-6, 23-6, 23-5 };
+	const uint32_t hiddenBit[] = { 0x40, 0x40, 0x20 };
 
 	for(int i=0; i < 3; i++)
 	{
@@ -97,14 +99,14 @@ inline Vec3f ConvertFromR11G11B10(uint32_t data)
 				exponents[i] = 1;
 
 				// shift until hidden bit is set
-				while((mantissas[i] & 0x40) == 0)
+				while((mantissas[i] & hiddenBit[i]) == 0)
 				{
 					mantissas[i] <<= 1;
 					exponents[i]--;
 				}
 
 				// remove the hidden bit
-				mantissas[i] &= ~0x40;
+				mantissas[i] &= ~hiddenBit[i];
 
 				retu[i] = (exponents[i] + (127-15)) << 23 | mantissas[i] << mantissaShift[i];
 			}
@@ -114,6 +116,18 @@ inline Vec3f ConvertFromR11G11B10(uint32_t data)
 	return ret;
 }
 
+inline Vec3f ConvertFromR9G9B9E5(uint32_t data)
+{
+	// three 9-bit mantissas with no implicit leading 1, sharing a 5-bit exponent biased by 15
+	float scale = 0.0f;
+	uint32_t *alias = (uint32_t *)&scale;
+	*alias = ((data >> 27) + (127 - 15 - 9)) << 23;
+
+	return Vec3f( float((data>> 0) & 0x1ff) * scale,
+				  float((data>> 9) & 0x1ff) * scale,
+				  float((data>>18) & 0x1ff) * scale );
+}
+
 /*
 inline uint32_t ConvertToR11G11B10(Vec3f data)
 {
@@ -155,3 +169,13 @@ struct ResourceFormat;
 float ConvertComponent(ResourceFormat fmt, byte *data);
 
 #include "half_convert.h"
+
+// batch conversions for converting whole rows or images at a time. These use SIMD where
+// available (F16C for halfs if the CPU supports it) and don't branch per value. The packed
+// RGB formats are written out with alpha set to 1.
+void ConvertFromHalf(const uint16_t *src, float *dst, size_t count);
+void ConvertToHalf(const float *src, uint16_t *dst, size_t count);
+
+void ConvertFromR10G10B10A2(const uint32_t *src, Vec4f *dst, size_t count);
+void ConvertFromR11G11B10(const uint32_t *src, Vec4f *dst, size_t count);
+void ConvertFromR9G9B9E5(const uint32_t *src, Vec4f *dst, size_t count);
@@ -32,6 +32,13 @@
 #include "matrix.h"
 #include "quat.h"
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+// SSE versions of multiply and batch transform. Matrix4f stays unaligned since it's copied
+// directly into constant buffers, so these use unaligned loads.
+#define MATRIX_SSE
+#include <xmmintrin.h>
+#endif
+
 // colour ramp from http://www.ncl.ucar.edu/Document/Graphics/ColorTables/GMT_wysiwyg.shtml
 const Vec4f overdrawRamp[128] =
 {
@@ -170,6 +177,25 @@ static inline size_t matIdx(const size_t x, const size_t y) { return x+y*4; }
 Matrix4f Matrix4f::Mul(const Matrix4f &o) const
 {
 	Matrix4f m;
+
+#if defined(MATRIX_SSE)
+	// each column of the result is a sum of this matrix's columns, added in the same order as
+	// the scalar version so the results are identical
+	__m128 c0 = _mm_loadu_ps(&f[0]);
+	__m128 c1 = _mm_loadu_ps(&f[4]);
+	__m128 c2 = _mm_loadu_ps(&f[8]);
+	__m128 c3 = _mm_loadu_ps(&f[12]);
+
+	for(size_t y=0; y < 4; y++)
+	{
+		__m128 col = _mm_mul_ps(c0, _mm_set1_ps(o[matIdx(0,y)]));
+		col = _mm_add_ps(col, _mm_mul_ps(c1, _mm_set1_ps(o[matIdx(1,y)])));
+		col = _mm_add_ps(col, _mm_mul_ps(c2, _mm_set1_ps(o[matIdx(2,y)])));
+		col = _mm_add_ps(col, _mm_mul_ps(c3, _mm_set1_ps(o[matIdx(3,y)])));
+
+		_mm_storeu_ps(&m.f[matIdx(0,y)], col);
+	}
+#else
 	for(size_t x=0; x < 4; x++)
 	{
 		for(size_t y=0; y < 4; y++)
@@ -180,6 +206,7 @@ Matrix4f Matrix4f::Mul(const Matrix4f &o) const
 							 (*this)[matIdx(x,3)] * o[matIdx(3,y)];
 		}
 	}
+#endif
 	
 	return m;
 }
@@ -255,6 +282,36 @@ Vec3f Matrix4f::Transform(const Vec3f &v, const float w) const
 	return vout*(1.0f/wout);
 }
 
+void Matrix4f::Transform(const Vec3f *in, Vec4f *out, size_t count, const float w) const
+{
+#if defined(MATRIX_SSE)
+	__m128 c0 = _mm_loadu_ps(&f[0]);
+	__m128 c1 = _mm_loadu_ps(&f[4]);
+	__m128 c2 = _mm_loadu_ps(&f[8]);
+	__m128 c3w = _mm_mul_ps(_mm_loadu_ps(&f[12]), _mm_set1_ps(w));
+
+	for(size_t i=0; i < count; i++)
+	{
+		__m128 v = _mm_mul_ps(c0, _mm_set1_ps(in[i].x));
+		v = _mm_add_ps(v, _mm_mul_ps(c1, _mm_set1_ps(in[i].y)));
+		v = _mm_add_ps(v, _mm_mul_ps(c2, _mm_set1_ps(in[i].z)));
+		v = _mm_add_ps(v, c3w);
+
+		_mm_storeu_ps(&out[i].x, v);
+	}
+#else
+	for(size_t i=0; i < count; i++)
+	{
+		const Vec3f &v = in[i];
+
+		out[i] = Vec4f(f[matIdx(0,0)] * v.x + f[matIdx(0,1)] * v.y + f[matIdx(0,2)] * v.z + f[matIdx(0,3)] * w,
+		               f[matIdx(1,0)] * v.x + f[matIdx(1,1)] * v.y + f[matIdx(1,2)] * v.z + f[matIdx(1,3)] * w,
+		               f[matIdx(2,0)] * v.x + f[matIdx(2,1)] * v.y + f[matIdx(2,2)] * v.z + f[matIdx(2,3)] * w,
+		               f[matIdx(3,0)] * v.x + f[matIdx(3,1)] * v.y + f[matIdx(3,2)] * v.z + f[matIdx(3,3)] * w);
+	}
+#endif
+}
+
 const Vec3f Matrix4f::GetPosition() const
 {
 	return Vec3f(f[12], f[13], f[14]);
@@ -26,6 +26,7 @@
 #pragma once
 
 class Vec3f;
+struct Vec4f;
 class Quatf;
 
 #include <string.h>
@@ -76,6 +77,10 @@ class Matrix4f
 
 		Vec3f Transform(const Vec3f &v, const float w=1.0f) const;
 
+		// transforms count positions into clip space, without the divide by w. Uses SSE
+		// where available, for transforming whole vertex streams on the CPU.
+		void Transform(const Vec3f *in, Vec4f *out, size_t count, const float w=1.0f) const;
+
 		const float * const Data() const { return &f[0]; }
 		
 		const Vec3f GetPosition() const;
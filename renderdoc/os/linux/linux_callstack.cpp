@@ -23,8 +23,10 @@
  ******************************************************************************/
 
 #include "os/os_specific.h"
+#include "core/core.h"
 
 #include <execinfo.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -34,6 +36,72 @@
 void *renderdocBase = NULL;
 void *renderdocEnd = NULL;
 
+// the calling thread's stack, looked up the first time it walks frame pointers. If the
+// lookup fails stackHi is left as 1, so it isn't tried again.
+static __thread uintptr_t stackLo = 0;
+static __thread uintptr_t stackHi = 0;
+
+// walks the chain of saved frame pointers up from the caller, filling out return addresses.
+// Each frame holds the caller's frame pointer, then the return address. Returns the number
+// of levels, or -1 if the chain is broken - it leaves the stack, isn't aligned, or doesn't
+// move towards the base - which means some frame wasn't built with frame pointers.
+static int WalkFramePointers(void **addrs, int maxLevels)
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+	if(stackHi == 0)
+	{
+		stackHi = 1;
+
+		pthread_attr_t attr;
+		if(pthread_getattr_np(pthread_self(), &attr) == 0)
+		{
+			void *addr = NULL;
+			size_t size = 0;
+			if(pthread_attr_getstack(&attr, &addr, &size) == 0)
+			{
+				stackLo = (uintptr_t)addr;
+				stackHi = stackLo + size;
+			}
+			pthread_attr_destroy(&attr);
+		}
+	}
+
+	if(stackHi <= stackLo)
+		return -1;
+
+	uintptr_t fp = (uintptr_t)__builtin_frame_address(0);
+
+	int numLevels = 0;
+
+	while(numLevels < maxLevels)
+	{
+		if(fp < stackLo || fp + 2*sizeof(uintptr_t) > stackHi || (fp & (sizeof(uintptr_t)-1)))
+			return -1;
+
+		uintptr_t *frame = (uintptr_t *)fp;
+
+		// the outermost frame has a NULL return address or frame pointer
+		if(frame[1] == 0)
+			break;
+
+		addrs[numLevels++] = (void *)frame[1];
+
+		if(frame[0] == 0)
+			break;
+
+		// callers are always further up the stack
+		if(frame[0] <= fp)
+			return -1;
+
+		fp = frame[0];
+	}
+
+	return numLevels;
+#else
+	return -1;
+#endif
+}
+
 class LinuxCallstack : public Callstack::Stackwalk
 {
 	public:
@@ -60,7 +128,13 @@ class LinuxCallstack : public Callstack::Stackwalk
 		{
 			void *addrs_ptr[ARRAY_COUNT(addrs)];
 
-			numLevels = backtrace(addrs_ptr, ARRAY_COUNT(addrs));
+			numLevels = -1;
+
+			if(RenderDoc::Inst().GetCaptureOptions().FramePointerCallstacks)
+				numLevels = WalkFramePointers(addrs_ptr, ARRAY_COUNT(addrs));
+
+			if(numLevels < 0)
+				numLevels = backtrace(addrs_ptr, ARRAY_COUNT(addrs));
 
 			int offs = 0;
 			// if we want to trim levels of the stack, we can do that here
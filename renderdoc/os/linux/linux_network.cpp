@@ -34,6 +34,8 @@
 #include <unistd.h>
 #include <netdb.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <sys/uio.h>
 
 #include <string>
 using std::string;
@@ -97,52 +99,133 @@ Socket *Socket::AcceptClient(bool wait)
 			Shutdown();
 		}
 
-		Threading::Sleep(4);
-	} while(wait);
+		if(wait && Connected())
+			WaitForIncoming(1000);
+	} while(wait && Connected());
 
 	return NULL;
 }
 
+// sockets are left non-blocking all the time so AcceptClient and IsRecvDataWaiting can poll,
+// so the blocking calls wait for the socket to become ready rather than switching modes.
+static bool WaitForSocket(int s, bool write)
+{
+	pollfd pfd;
+	pfd.fd = s;
+	pfd.events = write ? POLLOUT : POLLIN;
+	pfd.revents = 0;
+
+	int ret = 0;
+	do
+	{
+		ret = poll(&pfd, 1, -1);
+	} while(ret < 0 && errno == EINTR);
+
+	if(ret < 0)
+	{
+		RDCWARN("poll: %d", errno);
+		return false;
+	}
+
+	return true;
+}
+
+bool Socket::WaitForIncoming(uint32_t timeoutMS)
+{
+	if(!Connected())
+		return false;
+
+	pollfd pfd;
+	pfd.fd = (int)socket;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	int ret = 0;
+	do
+	{
+		ret = poll(&pfd, 1, (int)timeoutMS);
+	} while(ret < 0 && errno == EINTR);
+
+	if(ret < 0)
+	{
+		RDCWARN("poll: %d", errno);
+		return false;
+	}
+
+	return ret > 0;
+}
+
 bool Socket::SendDataBlocking(const void *buf, uint32_t length)
 {
-	if(length == 0) return true;
+	SendBuffer send = { buf, length };
+	return SendDataBlocking(&send, 1);
+}
+
+bool Socket::SendDataBlocking(const SendBuffer *bufs, uint32_t count)
+{
+	RDCASSERT(count <= MaxSendBuffers);
+
+	iovec iov[MaxSendBuffers];
+	size_t numIov = 0;
 
-	uint32_t sent = 0;
+	for(uint32_t i=0; i < count && i < MaxSendBuffers; i++)
+	{
+		if(bufs[i].length == 0) continue;
 
-	char *src = (char *)buf;
+		iov[numIov].iov_base = (void *)bufs[i].data;
+		iov[numIov].iov_len = bufs[i].length;
+		numIov++;
+	}
 
-	int flags = fcntl(socket, F_GETFL, 0);
-	fcntl(socket, F_SETFL, flags & ~O_NONBLOCK);
+	msghdr msg;
+	RDCEraseEl(msg);
+	msg.msg_iov = iov;
+	msg.msg_iovlen = numIov;
 
-	while(sent < length)
+	while(msg.msg_iovlen > 0)
 	{
-		int ret = send(socket, src, length-sent, 0);
+		ssize_t ret = sendmsg(socket, &msg, MSG_NOSIGNAL);
 
-		if(ret <= 0)
+		if(ret < 0)
 		{
 			int err = errno;
 
-			if(err == EWOULDBLOCK)
+			if(err == EINTR)
+				continue;
+
+			if(err == EWOULDBLOCK || err == EAGAIN)
 			{
-				ret = 0;
+				if(WaitForSocket(socket, true))
+					continue;
 			}
 			else
 			{
 				RDCWARN("send: %d", err);
-				Shutdown();
-				return false;
 			}
+
+			Shutdown();
+			return false;
 		}
 
-		sent += ret;
-		src += ret;
+		// skip past whatever was sent, which can end partway through a buffer
+		size_t sent = (size_t)ret;
+		while(sent > 0 && msg.msg_iovlen > 0)
+		{
+			if(sent >= msg.msg_iov->iov_len)
+			{
+				sent -= msg.msg_iov->iov_len;
+				msg.msg_iov++;
+				msg.msg_iovlen--;
+			}
+			else
+			{
+				msg.msg_iov->iov_base = (char *)msg.msg_iov->iov_base + sent;
+				msg.msg_iov->iov_len -= sent;
+				sent = 0;
+			}
+		}
 	}
 
-	flags = fcntl(socket, F_GETFL, 0);
-	fcntl(socket, F_SETFL, flags | O_NONBLOCK);
-
-	RDCASSERT(sent == length);
-
 	return true;
 }
 
@@ -182,41 +265,40 @@ bool Socket::RecvDataBlocking(void *buf, uint32_t length)
 	uint32_t received = 0;
 
 	char *dst = (char *)buf;
-	
-	int flags = fcntl(socket, F_GETFL, 0);
-	fcntl(socket, F_SETFL, flags & ~O_NONBLOCK);
 
 	while(received < length)
 	{
-		int ret = recv(socket, dst, length-received, 0);
+		ssize_t ret = recv(socket, dst, length-received, 0);
 
 		if(ret == 0)
 		{
 			Shutdown();
 			return false;
 		}
-		else if(ret <= 0)
+		else if(ret < 0)
 		{
 			int err = errno;
 
-			if(err == EWOULDBLOCK)
+			if(err == EINTR)
+				continue;
+
+			if(err == EWOULDBLOCK || err == EAGAIN)
 			{
-				ret = 0;
+				if(WaitForSocket(socket, false))
+					continue;
 			}
 			else
 			{
 				RDCWARN("recv: %d", err);
-				Shutdown();
-				return false;
 			}
+
+			Shutdown();
+			return false;
 		}
 
-		received += ret;
+		received += (uint32_t)ret;
 		dst += ret;
 	}
-	
-	flags = fcntl(socket, F_GETFL, 0);
-	fcntl(socket, F_SETFL, flags | O_NONBLOCK);
 
 	RDCASSERT(received == length);
 
@@ -31,8 +31,12 @@
 #include <dlfcn.h>
 #include <string.h>
 #include <libgen.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/mman.h>
 
 #include "serialise/string_utils.h"
+#include "common/threading.h"
 
 uint32_t Process::InjectIntoProcess(uint32_t pid, const char *logfile, const CaptureOptions *opts, bool waitForExit)
 {
@@ -379,3 +383,337 @@ uint32_t Process::GetCurrentPID()
 {
 	return (uint32_t)getpid();
 }
+
+// writes are watched by keeping pages read-only until they're written. The first write
+// faults, and the SIGSEGV handler flags the page and makes it writable again.
+//
+// This only sees writes from user code. If the application hands watched memory to the
+// kernel, e.g. to read() into, the kernel doesn't fault and the call fails with EFAULT
+// instead. It also relies on our handler staying installed - if the application installs
+// its own SIGSEGV handler later without chaining to ours, faults on watched pages go to it.
+// We check for that whenever pages are collected and stop protecting anything from then on,
+// but a write before that check can't be caught. Hence this is behind an opt-in capture option.
+namespace WriteWatch
+{
+	// page flags. Collecting marks a written page that GetWrittenPages is in the middle
+	// of resetting, so it can tell if the page is written again while it's doing so.
+	enum { Page_Clean = 0, Page_Written, Page_Collecting };
+
+	struct Region
+	{
+		byte *volatile base;
+		size_t size;
+		volatile byte *pages;
+	};
+
+	// fixed so that the fault handler can search it without taking a lock. If it fills up,
+	// Alloc fails and callers fall back to comparing.
+	static const int MaxRegions = 1024;
+	static Region regions[MaxRegions];
+
+	// serialises Alloc/Free/GetWrittenPages, never taken by the fault handler
+	static Threading::CriticalSection regionLock;
+
+	static bool handlerInstalled = false;
+	// set once our handler has been replaced, after which nothing is protected
+	static bool handlerLost = false;
+	static struct sigaction prevHandler;
+	static size_t pageSize = 0;
+
+	static void FaultHandler(int sig, siginfo_t *info, void *context)
+	{
+		byte *addr = (byte *)info->si_addr;
+
+		for(int i=0; i < MaxRegions; i++)
+		{
+			byte *base = regions[i].base;
+
+			if(base && addr >= base && addr < base + regions[i].size)
+			{
+				size_t page = size_t(addr - base)/pageSize;
+
+				mprotect(base + page*pageSize, pageSize, PROT_READ|PROT_WRITE);
+
+				// flag the page only once it's writable. The write that faulted hasn't happened
+				// yet, so if GetWrittenPages re-protects the page between the two, the write just
+				// faults again. Flagging first could let it reset the flag after we return.
+				__sync_synchronize();
+				regions[i].pages[page] = Page_Written;
+				return;
+			}
+		}
+
+		// not one of ours, so pass it on to whatever was handling faults before
+		if(prevHandler.sa_flags & SA_SIGINFO)
+		{
+			prevHandler.sa_sigaction(sig, info, context);
+		}
+		else if(prevHandler.sa_handler == SIG_DFL || prevHandler.sa_handler == SIG_IGN)
+		{
+			// returning re-runs the faulting instruction, which will now crash as it would have
+			signal(sig, SIG_DFL);
+		}
+		else
+		{
+			prevHandler.sa_handler(sig);
+		}
+	}
+
+	static Region *FindRegion(byte *mem)
+	{
+		for(int i=0; i < MaxRegions; i++)
+			if(regions[i].base == mem)
+				return &regions[i];
+
+		return NULL;
+	}
+
+	void *Alloc(size_t size)
+	{
+		if(size == 0)
+			return NULL;
+
+		SCOPED_LOCK(regionLock);
+
+		if(handlerLost)
+			return NULL;
+
+		if(!handlerInstalled)
+		{
+			pageSize = (size_t)sysconf(_SC_PAGESIZE);
+
+			struct sigaction sa;
+			memset(&sa, 0, sizeof(sa));
+			sa.sa_sigaction = &FaultHandler;
+			sa.sa_flags = SA_SIGINFO|SA_RESTART;
+			sigemptyset(&sa.sa_mask);
+
+			if(sigaction(SIGSEGV, &sa, &prevHandler) != 0)
+			{
+				RDCERR("Couldn't install fault handler to watch writes - errno %d", errno);
+				return NULL;
+			}
+
+			handlerInstalled = true;
+		}
+
+		Region *region = FindRegion(NULL);
+		if(region == NULL)
+		{
+			RDCWARN("Watching writes to too many allocations, falling back");
+			return NULL;
+		}
+
+		size = AlignUp(size, pageSize);
+
+		byte *mem = (byte *)mmap(NULL, size, PROT_READ, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+		if(mem == MAP_FAILED)
+		{
+			RDCERR("Couldn't allocate %llu bytes to watch writes - errno %d", (uint64_t)size, errno);
+			return NULL;
+		}
+
+		region->size = size;
+		region->pages = new byte[size/pageSize];
+		memset((byte *)region->pages, Page_Clean, size/pageSize);
+
+		// the handler may look at this region as soon as base is set
+		__sync_synchronize();
+		region->base = mem;
+
+		return mem;
+	}
+
+	void Free(void *mem, size_t size)
+	{
+		if(mem == NULL)
+			return;
+
+		SCOPED_LOCK(regionLock);
+
+		Region *region = FindRegion((byte *)mem);
+		if(region == NULL)
+		{
+			RDCERR("Freeing memory %p that wasn't being watched", mem);
+			return;
+		}
+
+		region->base = NULL;
+		__sync_synchronize();
+
+		munmap(mem, region->size);
+
+		delete[] (byte *)region->pages;
+		region->pages = NULL;
+		region->size = 0;
+	}
+
+	void GetWrittenPages(void *memPtr, size_t size, vector<size_t> &pageOffsets)
+	{
+		byte *mem = (byte *)memPtr;
+		SCOPED_LOCK(regionLock);
+
+		Region *region = FindRegion(mem);
+		if(region == NULL)
+		{
+			RDCERR("Getting written pages of memory %p that isn't being watched", mem);
+			return;
+		}
+
+		size_t numPages = RDCMIN(region->size, AlignUp(size, pageSize))/pageSize;
+
+		if(!handlerLost)
+		{
+			struct sigaction cur;
+			if(sigaction(SIGSEGV, NULL, &cur) == 0 && cur.sa_sigaction != &FaultHandler)
+			{
+				RDCWARN("SIGSEGV handler was replaced, no longer watching writes");
+				handlerLost = true;
+
+				for(int i=0; i < MaxRegions; i++)
+					if(regions[i].base)
+						mprotect(regions[i].base, regions[i].size, PROT_READ|PROT_WRITE);
+			}
+		}
+
+		// without the handler nothing can be tracked, so the memory is left writable and every
+		// page is reported as written
+		if(handlerLost)
+		{
+			for(size_t p=0; p < numPages; p++)
+				pageOffsets.push_back(p*pageSize);
+
+			return;
+		}
+
+		for(size_t p=0; p < numPages; p++)
+		{
+			if(region->pages[p] == Page_Clean)
+				continue;
+
+			__sync_bool_compare_and_swap(&region->pages[p], (byte)Page_Written, (byte)Page_Collecting);
+
+			// any write that completed before this is visible to the caller. Any after faults.
+			mprotect(mem + p*pageSize, pageSize, PROT_READ);
+
+			// if a write faulted after the protect, the handler has set the flag back to
+			// written (or will), so leave it for the next call.
+			__sync_bool_compare_and_swap(&region->pages[p], (byte)Page_Collecting, (byte)Page_Clean);
+
+			pageOffsets.push_back(p*pageSize);
+		}
+	}
+
+	size_t PageSize()
+	{
+		return (size_t)sysconf(_SC_PAGESIZE);
+	}
+};
+
+namespace GuardPage
+{
+	void *Alloc(size_t size)
+	{
+		if(size == 0)
+			return NULL;
+
+		size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		size_t dataSize = AlignUp(AlignUp16(size), pageSize);
+
+		byte *mem = (byte *)mmap(NULL, dataSize + pageSize, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+		if(mem == MAP_FAILED)
+		{
+			RDCERR("Couldn't allocate %llu guarded bytes - errno %d", (uint64_t)size, errno);
+			return NULL;
+		}
+
+		if(mprotect(mem + dataSize, pageSize, PROT_NONE) != 0)
+		{
+			RDCERR("Couldn't protect guard page - errno %d", errno);
+			munmap(mem, dataSize + pageSize);
+			return NULL;
+		}
+
+		return mem + dataSize - AlignUp16(size);
+	}
+
+	void Free(void *mem, size_t size)
+	{
+		if(mem == NULL)
+			return;
+
+		size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		size_t dataSize = AlignUp(AlignUp16(size), pageSize);
+
+		munmap((byte *)mem + AlignUp16(size) - dataSize, dataSize + pageSize);
+	}
+};
+
+namespace LargePage
+{
+	static volatile int64_t largeAllocs = 0;
+	static volatile int64_t fallbackAllocs = 0;
+
+	// the huge page size on x86 and most aarch64 kernels, and the alignment a region needs
+	// for transparent huge pages to back it
+	static const size_t HugePageSize = 2*1024*1024;
+
+	void *Alloc(size_t size)
+	{
+		if(size < MinSize)
+			return NULL;
+
+		size_t allocSize = AlignUp(size, HugePageSize);
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+		// explicit huge pages only work if some have been reserved, which usually isn't the case.
+		// The size is given so that a different default huge page size can't be picked.
+		void *mem = mmap(NULL, allocSize, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB|(21 << MAP_HUGE_SHIFT), -1, 0);
+		if(mem != MAP_FAILED)
+		{
+			Atomic::Inc64(&largeAllocs);
+			return mem;
+		}
+#endif
+
+		// otherwise ask for transparent huge pages over an aligned region
+		byte *base = (byte *)mmap(NULL, allocSize + HugePageSize, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+		if(base == MAP_FAILED)
+		{
+			Atomic::Inc64(&fallbackAllocs);
+			return NULL;
+		}
+
+		byte *aligned = (byte *)AlignUp((size_t)base, HugePageSize);
+
+		// trim the ends off so that Free unmaps exactly allocSize
+		if(aligned > base)
+			munmap(base, aligned - base);
+		if(base + HugePageSize > aligned)
+			munmap(aligned + allocSize, base + HugePageSize - aligned);
+
+		// the memory's still usable if this fails, just with normal pages
+#if defined(MADV_HUGEPAGE)
+		if(madvise(aligned, allocSize, MADV_HUGEPAGE) == 0)
+			Atomic::Inc64(&largeAllocs);
+		else
+#endif
+			Atomic::Inc64(&fallbackAllocs);
+
+		return aligned;
+	}
+
+	void Free(void *mem, size_t size)
+	{
+		if(mem == NULL)
+			return;
+
+		munmap(mem, AlignUp(size, HugePageSize));
+	}
+
+	void GetStats(uint64_t &large, uint64_t &fallback)
+	{
+		large = (uint64_t)largeAllocs;
+		fallback = (uint64_t)fallbackAllocs;
+	}
+};
@@ -31,6 +31,8 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <pwd.h>
 
@@ -67,11 +69,9 @@ namespace Keyboard
 	{
 	}
 
-	bool GetKeyState(int key)
+	static KeySym GetKeySym(int key)
 	{
 		KeySym ks = 0;
-		
-		if(CurrentXDisplay == NULL) return false;
 
 		if(key >= eKey_A && key <= eKey_Z) ks = key;
 		if(key >= eKey_0 && key <= eKey_9) ks = key;
@@ -108,14 +108,16 @@ namespace Keyboard
 				break;
 		}
 
+		return ks;
+	}
+
+	static bool IsKeyDown(const char *keyState, KeySym ks)
+	{
 		if(ks == 0)
 			return false;
 		
 		KeyCode kc = XKeysymToKeycode(CurrentXDisplay, ks);
 		
-		char keyState[32];
-		XQueryKeymap(CurrentXDisplay, keyState);
-		
 		int byteIdx = (kc/8);
 		int bitMask = 1 << (kc%8);
 		
@@ -123,6 +125,26 @@ namespace Keyboard
 		
 		return (keyByte & bitMask) != 0;
 	}
+
+	bool GetKeyState(int key)
+	{
+		return AnyKeyDown(&key, 1);
+	}
+
+	bool AnyKeyDown(const int *keys, size_t count)
+	{
+		if(CurrentXDisplay == NULL || count == 0) return false;
+
+		// one round trip to the server covers every key
+		char keyState[32];
+		XQueryKeymap(CurrentXDisplay, keyState);
+
+		for(size_t i=0; i < count; i++)
+			if(IsKeyDown(keyState, GetKeySym(keys[i])))
+				return true;
+
+		return false;
+	}
 }
 
 namespace FileIO
@@ -252,6 +274,11 @@ namespace FileIO
 		return ::fopen(filename, mode);
 	}
 
+	FILE *logfile_open(const char *filename)
+	{
+		return ::fopen(filename, "a");
+	}
+
 	size_t fread(void *buf, size_t elementSize, size_t count, FILE *f) { return ::fread(buf, elementSize, count, f); }
 	size_t fwrite(const void *buf, size_t elementSize, size_t count, FILE *f) { return ::fwrite(buf, elementSize, count, f); }
 
@@ -259,6 +286,41 @@ namespace FileIO
 	void fseek64(FILE *f, uint64_t offset, int origin) { ::fseek(f, (long)offset, origin); }
 
 	int fclose(FILE *f) { return ::fclose(f); }
+
+	void *MapFile(const char *filename, uint64_t &size)
+	{
+		size = 0;
+
+		int fd = ::open(filename, O_RDONLY);
+
+		if(fd < 0)
+			return NULL;
+
+		struct ::stat st;
+		if(fstat(fd, &st) != 0 || st.st_size <= 0)
+		{
+			::close(fd);
+			return NULL;
+		}
+
+		void *base = mmap(NULL, (size_t)st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+		// the mapping holds its own reference to the file
+		::close(fd);
+
+		if(base == MAP_FAILED)
+			return NULL;
+
+		size = (uint64_t)st.st_size;
+
+		return base;
+	}
+
+	void UnmapFile(void *base, uint64_t size)
+	{
+		if(base)
+			munmap(base, (size_t)size);
+	}
 };
 
 namespace StringFormat
@@ -64,7 +64,24 @@ namespace Atomic
 	
 	int64_t ExchAdd64(volatile int64_t *i, int64_t a)
 	{
-		return __sync_add_and_fetch(i, int64_t(a));
+		return __sync_fetch_and_add(i, int64_t(a));
+	}
+
+	int64_t CmpExch64(volatile int64_t *dest, int64_t exch, int64_t comp)
+	{
+		return __sync_val_compare_and_swap(dest, comp, exch);
+	}
+
+	int64_t Read64(volatile int64_t *i)
+	{
+		return __sync_val_compare_and_swap(i, int64_t(0), int64_t(0));
+	}
+
+	void *ExchPtr(void * volatile *dest, void *exch)
+	{
+		// __sync_lock_test_and_set is only an acquire barrier
+		__sync_synchronize();
+		return __sync_lock_test_and_set(dest, exch);
 	}
 };
 
@@ -165,4 +182,30 @@ namespace Threading
 	{
 		usleep(milliseconds*1000);
 	}
+
+	uint32_t NumberOfCPUs()
+	{
+		long num = sysconf(_SC_NPROCESSORS_ONLN);
+		return num > 0 ? (uint32_t)num : 1;
+	}
+
+	uint64_t AllocateTLSSlot()
+	{
+		pthread_key_t key;
+		if(pthread_key_create(&key, NULL) != 0)
+		{
+			RDCFATAL("Couldn't allocate TLS slot");
+		}
+		return (uint64_t)key;
+	}
+
+	void *GetTLSValue(uint64_t slot)
+	{
+		return pthread_getspecific((pthread_key_t)slot);
+	}
+
+	void SetTLSValue(uint64_t slot, void *value)
+	{
+		pthread_setspecific((pthread_key_t)slot, value);
+	}
 };
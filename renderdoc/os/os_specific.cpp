@@ -24,6 +24,7 @@
 
 
 #include "os/os_specific.h"
+#include "common/common.h"
 #include "serialise/string_utils.h"
 
 #include <stdarg.h>
@@ -116,4 +117,71 @@ string Callstack::AddressDetails::formattedString(const char *commonPath)
 		StringFormat::snprintf(fmt, 511, "%s", function.c_str());
 
 	return fmt;
-}
\ No newline at end of file
+}
+
+namespace Threading
+{
+
+struct ParallelRange
+{
+	RangeFunc func;
+	void *userData;
+	size_t begin, end;
+};
+
+static void ParallelRangeEntry(void *param)
+{
+	ParallelRange *range = (ParallelRange *)param;
+	range->func(range->userData, range->begin, range->end);
+}
+
+void ParallelFor(size_t count, size_t minPerThread, RangeFunc func, void *userData)
+{
+	if(count == 0)
+		return;
+
+	// no point going much wider than this for the memory-bound work this is used for
+	const size_t maxThreads = 16;
+
+	size_t numThreads = RDCMIN((size_t)NumberOfCPUs(), maxThreads);
+	if(minPerThread > 0)
+		numThreads = RDCMIN(numThreads, count/minPerThread);
+	numThreads = RDCCLAMP(numThreads, (size_t)1, count);
+
+	if(numThreads == 1)
+	{
+		func(userData, 0, count);
+		return;
+	}
+
+	ParallelRange ranges[maxThreads];
+	ThreadHandle threads[maxThreads] = {0};
+
+	for(size_t i=0; i < numThreads; i++)
+	{
+		ranges[i].func = func;
+		ranges[i].userData = userData;
+		ranges[i].begin = (count*i)/numThreads;
+		ranges[i].end = (count*(i+1))/numThreads;
+	}
+
+	for(size_t i=1; i < numThreads; i++)
+		threads[i] = CreateThread(&ParallelRangeEntry, &ranges[i]);
+
+	ParallelRangeEntry(&ranges[0]);
+
+	for(size_t i=1; i < numThreads; i++)
+	{
+		// if we couldn't spawn a thread, do its share here instead
+		if(threads[i] == 0)
+		{
+			ParallelRangeEntry(&ranges[i]);
+			continue;
+		}
+
+		JoinThread(threads[i]);
+		CloseThread(threads[i]);
+	}
+}
+
+}; // namespace Threading
@@ -90,6 +90,21 @@ namespace Threading
 	void CloseThread(ThreadHandle handle);
 	void Sleep(uint32_t milliseconds);
 
+	// number of logical processors available
+	uint32_t NumberOfCPUs();
+
+	// thread-local storage slots. Each holds one pointer per thread, initially NULL
+	// on every thread. Slots are never freed, so allocate them once up front.
+	uint64_t AllocateTLSSlot();
+	void *GetTLSValue(uint64_t slot);
+	void SetTLSValue(uint64_t slot, void *value);
+
+	// splits [0, count) into contiguous ranges and calls func(userData, begin, end) for each
+	// range concurrently, returning once they're all done. One range always runs on the calling
+	// thread, and small counts (fewer than minPerThread per thread) use fewer threads.
+	typedef void (*RangeFunc)(void *userData, size_t begin, size_t end);
+	void ParallelFor(size_t count, size_t minPerThread, RangeFunc func, void *userData);
+
 	// kind of windows specific, to handle this case:
 	// http://blogs.msdn.com/b/oldnewthing/archive/2013/11/05/10463645.aspx
 	void KeepModuleAlive();
@@ -98,6 +113,12 @@ namespace Threading
 
 namespace Network
 {
+	struct SendBuffer
+	{
+		const void *data;
+		uint32_t length;
+	};
+
 	class Socket
 	{
 		public:
@@ -110,9 +131,16 @@ namespace Network
 			Socket *AcceptClient(bool wait);
 
 			bool IsRecvDataWaiting();
+			// blocks until there's data to receive (or a client to accept), the socket closes,
+			// or timeoutMS passes. Returns true if the socket became ready
+			bool WaitForIncoming(uint32_t timeoutMS);
 
 			bool SendDataBlocking(const void *buf, uint32_t length);
+			// sends several buffers back to back, in as few packets as the OS will manage
+			bool SendDataBlocking(const SendBuffer *bufs, uint32_t count);
 			bool RecvDataBlocking(void *data, uint32_t length);
+
+			static const uint32_t MaxSendBuffers = 8;
 		private:
 			ptrdiff_t socket;
 	};
@@ -129,7 +157,15 @@ namespace Atomic
 	int32_t Inc32(volatile int32_t *i);
 	int64_t Inc64(volatile int64_t *i);
 	int64_t Dec64(volatile int64_t *i);
+	// returns the value before the add
 	int64_t ExchAdd64(volatile int64_t *i, int64_t a);
+	// sets *dest to exch if it's equal to comp. Returns the value before the exchange
+	int64_t CmpExch64(volatile int64_t *dest, int64_t exch, int64_t comp);
+	// reads all 64 bits at once, even on 32-bit platforms
+	int64_t Read64(volatile int64_t *i);
+	// sets *dest to exch with a full barrier, so everything written before is visible to
+	// any thread that sees the new pointer. Returns the value before the exchange
+	void *ExchPtr(void * volatile *dest, void *exch);
 };
 
 namespace Callstack
@@ -158,6 +194,14 @@ namespace Callstack
 	public:
 		virtual ~StackResolver() {}
 		virtual AddressDetails GetAddr(uint64_t addr) = 0;
+
+		// resolves num addresses into out. Resolvers that can look up many addresses at once
+		// more cheaply than one at a time override this.
+		virtual void GetAddrs(const uint64_t *addrs, size_t num, AddressDetails *out)
+		{
+			for(size_t i=0; i < num; i++)
+				out[i] = GetAddr(addrs[i]);
+		}
 	};
 
 	void Init();
@@ -184,6 +228,10 @@ namespace FileIO
 
 	FILE *fopen(const char *filename, const char *mode);
 
+	// opens a file for appending that other processes can still open and read while
+	// it's held open, e.g. the logfile.
+	FILE *logfile_open(const char *filename);
+
 	size_t fread(void *buf, size_t elementSize, size_t count, FILE *f);
 	size_t fwrite(const void *buf, size_t elementSize, size_t count, FILE *f);
 
@@ -191,6 +239,57 @@ namespace FileIO
 	void fseek64(FILE *f, uint64_t offset, int origin);
 
 	int fclose(FILE *f);
+
+	// map a whole file into memory for reading. The mapping is private copy-on-write so
+	// writes to it are never seen in the file. Returns NULL if the file can't be mapped,
+	// in which case callers should fall back to normal reads.
+	void *MapFile(const char *filename, uint64_t &size);
+	void UnmapFile(void *base, uint64_t size);
+};
+
+// finds which pages of a block of memory have been written to, without comparing its
+// contents. Used so that large buffers with only small changes don't need a full scan.
+namespace WriteWatch
+{
+	// allocates size bytes of page-aligned, zeroed memory where writes are watched from the
+	// start. Returns NULL if that isn't possible, and callers should fall back to comparing.
+	// On linux the memory is write-protected until written, so it mustn't be passed to system
+	// calls that write into it (they fail with EFAULT) - see linux_process.cpp.
+	void *Alloc(size_t size);
+	void Free(void *mem, size_t size);
+
+	// appends the offsets of the pages in mem written to since it was allocated or since the
+	// last call, in increasing order, then resets them to unwritten. A write that races with
+	// this call is reported either by it or by the next call.
+	void GetWrittenPages(void *mem, size_t size, vector<size_t> &pageOffsets);
+
+	size_t PageSize();
+};
+
+// memory followed directly by an inaccessible page, so that writing past the end faults at
+// the write itself instead of being found later.
+namespace GuardPage
+{
+	// allocates size bytes, 16-byte aligned, with the end of the allocation rounded up to 16
+	// bytes sitting right at the guard page. Returns NULL if the memory can't be guarded.
+	void *Alloc(size_t size);
+	void Free(void *mem, size_t size);
+};
+
+// memory backed by large pages where the OS allows it, for big buffers that are copied and
+// compared in full, to cut down on TLB misses.
+namespace LargePage
+{
+	// smallest allocation that's worth trying large pages for
+	static const size_t MinSize = 4*1024*1024;
+
+	// returns NULL if size is below MinSize or the memory can't be allocated this way, and the
+	// caller should allocate normally. Memory is aligned to at least a normal page.
+	void *Alloc(size_t size);
+	void Free(void *mem, size_t size);
+
+	// how many allocations Alloc was tried for got large pages, and how many didn't
+	void GetStats(uint64_t &largeAllocs, uint64_t &fallbackAllocs);
 };
 
 namespace Keyboard
@@ -199,6 +298,8 @@ namespace Keyboard
 	void AddInputWindow(void *wnd);
 	void RemoveInputWindow(void *wnd);
 	bool GetKeyState(int key);
+	// true if any of the given keys are down, querying the OS as few times as possible
+	bool AnyKeyDown(const int *keys, size_t count);
 };
 
 // implemented per-platform
@@ -219,6 +320,17 @@ namespace StringFormat
 	int vsnprintf(char *str, size_t bufSize, const char *format, va_list v);
 	int snprintf(char *str, size_t bufSize, const char *format, ...);
 
+	// format count values with a single conversion like "%.3f" or "%08x", parsed once, and
+	// append them to output as rows of columns values. colSep goes between values in a row,
+	// rowSep after every row. Output is identical to formatting each value with snprintf.
+	// Returns false if the format isn't a single conversion of the right type.
+	bool FormatFloats(const char *format, const float *values, size_t count, size_t columns,
+	                  const char *colSep, const char *rowSep, string &output);
+	bool FormatInts(const char *format, const int32_t *values, size_t count, size_t columns,
+	                const char *colSep, const char *rowSep, string &output);
+	bool FormatUInts(const char *format, const uint32_t *values, size_t count, size_t columns,
+	                 const char *colSep, const char *rowSep, string &output);
+
 	int Wide2UTF8(wchar_t chr, char mbchr[4]);
 };
 
@@ -27,6 +27,7 @@
 #include "serialise/string_utils.h"
 
 #include <vector>
+#include <map>
 #include <string>
 #include <algorithm>
 
@@ -64,6 +65,7 @@ class Win32CallstackResolver : public Callstack::StackResolver
 		~Win32CallstackResolver();
 
 		Callstack::AddressDetails GetAddr(uint64_t addr);
+		void GetAddrs(const uint64_t *addrs, size_t num, Callstack::AddressDetails *out);
 	private:
 		// must match definition in pdblocate.cpp
 		struct AddrInfo
@@ -78,22 +80,38 @@ class Win32CallstackResolver : public Callstack::StackResolver
 		wstring pdbBrowse(wstring startingPoint);
 		wstring LookupModule(wchar_t *modName, GUID guid, DWORD age);
 
-		void *SendRecvPipeMessage(wstring message);
+		void *SendRecvPipeMessage(wstring message, size_t *replyLen = NULL);
 		
 		void OpenPdblocateHandle();
 		uint32_t GetModuleID(wstring pdbName, GUID guid, DWORD age);
 		void SetModuleBaseAddress(uint32_t moduleId, DWORD64 base);
-		AddrInfo GetAddrInfoForModule(uint32_t moduleId, DWORD64 addr);
 
 		struct Module
 		{
 			wstring name;
 			DWORD64 base;
 			DWORD size;
+			GUID guid;
+			DWORD age;
 
 			uint32_t moduleId;
+
+			// resolved addresses, relative to base so they stay valid for any run of
+			// the same binary. Saved on disk between sessions, keyed by the pdb GUID/age
+			std::map<DWORD64, AddrInfo> cache;
+			bool cacheDirty;
 		};
 
+		// most addresses sent to pdblocate in one message
+		static const size_t MaxBatchAddrs = 64;
+
+		Module *FindModule(DWORD64 addr);
+		void ResolveAddrs(Module &m, const vector<DWORD64> &addrs);
+
+		string GetCacheFilename(const Module &m);
+		void LoadCache(Module &m);
+		void SaveCache(const Module &m);
+
 		HANDLE pdblocateProcess;
 		HANDLE pdblocatePipe;
 
@@ -101,7 +119,7 @@ class Win32CallstackResolver : public Callstack::StackResolver
 		vector<wstring> pdbIgnores;
 		vector<Module> modules;
 
-		char pipeMessageBuf[2048];
+		vector<byte> pipeMessageBuf;
 };
 
 ///////////////////////////////////////////////////
@@ -431,7 +449,7 @@ void Win32CallstackResolver::OpenPdblocateHandle()
 	}
 }
 
-void *Win32CallstackResolver::SendRecvPipeMessage(wstring message)
+void *Win32CallstackResolver::SendRecvPipeMessage(wstring message, size_t *replyLen)
 {
 	if(pdblocatePipe == NULL) return NULL;
 
@@ -445,13 +463,16 @@ void *Win32CallstackResolver::SendRecvPipeMessage(wstring message)
 		return NULL;
 	}
 
-	byte *bufPtr = (byte *)pipeMessageBuf;
-	DWORD bufSize = sizeof(pipeMessageBuf);
+	// batched replies can be much bigger than a single address, so grow the buffer as needed
+	size_t received = 0;
 
 	do 
 	{ 
+		if(pipeMessageBuf.size() - received < 4096)
+			pipeMessageBuf.resize(pipeMessageBuf.size() + 64*1024);
+
 		DWORD read = 0;
-		success = ReadFile(pdblocatePipe, bufPtr, bufSize, &read, NULL);
+		success = ReadFile(pdblocatePipe, &pipeMessageBuf[received], (DWORD)(pipeMessageBuf.size() - received), &read, NULL);
 
 		RDCDEBUG("'%ls' -> %lu", message.c_str(), read);
 
@@ -461,13 +482,13 @@ void *Win32CallstackResolver::SendRecvPipeMessage(wstring message)
 			break; 
 		}
 
-		bufPtr += read;
-		bufSize -= read;
+		received += read;
 	} while (!success);
 
-	RDCDEBUG("buf: %02x %02x %02x %02x", bufPtr[0], bufPtr[1], bufPtr[2], bufPtr[3]);
+	if(replyLen)
+		*replyLen = received;
 
-	return pipeMessageBuf;
+	return &pipeMessageBuf[0];
 }
 
 std::wstring Win32CallstackResolver::LookupModule(wchar_t *modName, GUID guid, DWORD age)
@@ -510,13 +531,109 @@ uint32_t Win32CallstackResolver::GetModuleID(wstring pdbName, GUID guid, DWORD a
 	return modID == NULL ? 0 : *modID;
 }
 
-Win32CallstackResolver::AddrInfo Win32CallstackResolver::GetAddrInfoForModule(uint32_t moduleId, DWORD64 addr)
+void Win32CallstackResolver::ResolveAddrs(Module &m, const vector<DWORD64> &addrs)
 {
-	wchar_t msg[1024];
-	swprintf_s(msg, L"getaddr %d %llu", moduleId, addr);
+	for(size_t first=0; first < addrs.size(); first += MaxBatchAddrs)
+	{
+		size_t count = RDCMIN(MaxBatchAddrs, addrs.size()-first);
+
+		wchar_t num[32];
+		swprintf_s(num, L"getaddrs %d", m.moduleId);
+
+		wstring msg = num;
+		for(size_t i=0; i < count; i++)
+		{
+			swprintf_s(num, L" %llu", addrs[first+i]);
+			msg += num;
+		}
+
+		size_t replyLen = 0;
+		AddrInfo *infos = (AddrInfo *)SendRecvPipeMessage(msg, &replyLen);
+
+		// the reply has a trailing NULL after the AddrInfos
+		if(infos == NULL || replyLen < count*sizeof(AddrInfo))
+		{
+			RDCWARN("Failed to resolve %u addresses in %ls", (uint32_t)count, m.name.c_str());
+			continue;
+		}
+
+		for(size_t i=0; i < count; i++)
+			m.cache[addrs[first+i] - m.base] = infos[i];
+
+		m.cacheDirty = true;
+	}
+}
+
+string Win32CallstackResolver::GetCacheFilename(const Module &m)
+{
+	return FileIO::GetAppFolderFilename(StringFormat::Fmt("symcache_%08x%04x%04x%02x%02x%02x%02x%02x%02x%02x%02x_%u.bin",
+		m.guid.Data1, m.guid.Data2, m.guid.Data3,
+		m.guid.Data4[0], m.guid.Data4[1], m.guid.Data4[2], m.guid.Data4[3],
+		m.guid.Data4[4], m.guid.Data4[5], m.guid.Data4[6], m.guid.Data4[7],
+		m.age));
+}
+
+// the cache file is a magic, version and entry count as uint32_t followed by that many
+// pairs of a uint64_t address relative to the module base, and its AddrInfo.
+static const uint32_t SymbolCacheMagic = MAKE_FOURCC('R', 'D', 'S', 'C');
+static const uint32_t SymbolCacheVersion = 1;
+
+void Win32CallstackResolver::LoadCache(Module &m)
+{
+	FILE *f = FileIO::fopen(GetCacheFilename(m).c_str(), "rb");
+
+	if(!f)
+		return;
+
+	uint32_t header[3] = { 0, 0, 0 };
+	FileIO::fread(header, sizeof(uint32_t), 3, f);
+
+	if(header[0] == SymbolCacheMagic && header[1] == SymbolCacheVersion)
+	{
+		for(uint32_t i=0; i < header[2]; i++)
+		{
+			uint64_t rva = 0;
+			AddrInfo info;
+
+			if(FileIO::fread(&rva, sizeof(uint64_t), 1, f) != 1 ||
+				 FileIO::fread(&info, sizeof(AddrInfo), 1, f) != 1)
+			{
+				RDCWARN("Truncated symbol cache for %ls", m.name.c_str());
+				break;
+			}
+
+			// don't trust strings from disk to be terminated
+			info.funcName[126] = 0;
+			info.fileName[126] = 0;
+
+			m.cache[rva] = info;
+		}
+	}
+
+	FileIO::fclose(f);
+}
+
+void Win32CallstackResolver::SaveCache(const Module &m)
+{
+	FILE *f = FileIO::fopen(GetCacheFilename(m).c_str(), "wb");
+
+	if(!f)
+	{
+		RDCWARN("Couldn't write symbol cache for %ls", m.name.c_str());
+		return;
+	}
+
+	uint32_t header[3] = { SymbolCacheMagic, SymbolCacheVersion, (uint32_t)m.cache.size() };
+	FileIO::fwrite(header, sizeof(uint32_t), 3, f);
+
+	for(auto it = m.cache.begin(); it != m.cache.end(); ++it)
+	{
+		uint64_t rva = it->first;
+		FileIO::fwrite(&rva, sizeof(uint64_t), 1, f);
+		FileIO::fwrite(&it->second, sizeof(AddrInfo), 1, f);
+	}
 
-	AddrInfo *info = (AddrInfo *)SendRecvPipeMessage(msg);
-	return info == NULL ? AddrInfo() : *info;
+	FileIO::fclose(f);
 }
 
 Win32CallstackResolver::Win32CallstackResolver(char *moduleDB, size_t DBSize, string pdbSearchPaths, volatile bool *killSignal)
@@ -537,6 +654,8 @@ Win32CallstackResolver::Win32CallstackResolver(char *moduleDB, size_t DBSize, st
 
 	split(widepdbsearch, pdbRememberedPaths, L';');
 
+	pipeMessageBuf.resize(2048);
+
 	pdblocateProcess = NULL;
 	pdblocatePipe = NULL;
 
@@ -571,7 +690,10 @@ Win32CallstackResolver::Win32CallstackResolver(char *moduleDB, size_t DBSize, st
 		m.name = modName;
 		m.base = chunk->base;
 		m.size = chunk->size;
+		m.guid = chunk->guid;
+		m.age = chunk->age;
 		m.moduleId = 0;
+		m.cacheDirty = false;
 
 		if(find(pdbIgnores.begin(), pdbIgnores.end(), m.name) != pdbIgnores.end())
 		{
@@ -694,6 +816,10 @@ Win32CallstackResolver::Win32CallstackResolver(char *moduleDB, size_t DBSize, st
 		
 		RDCLOG("Loaded Symbols for %ls", m.name.c_str());
 
+		// without a GUID the pdb wasn't validated, so it might not match next time
+		if(m.guid.Data1 != 0 || m.guid.Data2 != 0)
+			LoadCache(m);
+
 		modules.push_back(m); 
 	}
 
@@ -707,6 +833,10 @@ Win32CallstackResolver::Win32CallstackResolver(char *moduleDB, size_t DBSize, st
 
 Win32CallstackResolver::~Win32CallstackResolver()
 {
+	for(size_t i=0; i < modules.size(); i++)
+		if(modules[i].cacheDirty && (modules[i].guid.Data1 != 0 || modules[i].guid.Data2 != 0))
+			SaveCache(modules[i]);
+
 	if(pdblocatePipe != NULL)
 		CloseHandle(pdblocatePipe);
 	if(pdblocateProcess != NULL)
@@ -724,19 +854,25 @@ Callstack::AddressDetails Win32CallstackResolver::GetAddr(DWORD64 addr)
 	wcsncpy_s(info.fileName, L"Unknown", 126);
 	wsprintfW(info.funcName, L"0x%08I64x", addr);
 
-	for(size_t i=0; i < modules.size(); i++)
+	Module *m = FindModule(addr);
+
+	if(m)
 	{
-		DWORD64 base = modules[i].base;
-		DWORD size = modules[i].size;
-		if(addr > modules[i].base && addr < modules[i].base + modules[i].size)
+		if(m->moduleId != 0)
 		{
-			if(modules[i].moduleId != 0)
-				info = GetAddrInfoForModule(modules[i].moduleId, addr);
+			auto it = m->cache.find(addr - m->base);
 
-			wcsncpy_s(info.fileName, modules[i].name.c_str(), 126);
+			if(it == m->cache.end())
+			{
+				ResolveAddrs(*m, vector<DWORD64>(1, addr));
+				it = m->cache.find(addr - m->base);
+			}
 
-			break;
+			if(it != m->cache.end())
+				info = it->second;
 		}
+
+		wcsncpy_s(info.fileName, m->name.c_str(), 126);
 	}
 
 	Callstack::AddressDetails ret;
@@ -747,6 +883,41 @@ Callstack::AddressDetails Win32CallstackResolver::GetAddr(DWORD64 addr)
 	return ret;
 }
 
+void Win32CallstackResolver::GetAddrs(const uint64_t *addrs, size_t num, Callstack::AddressDetails *out)
+{
+	// gather up what isn't cached yet for each module, so they can be looked up in batches
+	std::map< Module *, vector<DWORD64> > missing;
+
+	for(size_t i=0; i < num; i++)
+	{
+		Module *m = FindModule(addrs[i]);
+
+		if(m && m->moduleId != 0 && m->cache.find(addrs[i] - m->base) == m->cache.end())
+			missing[m].push_back(addrs[i]);
+	}
+
+	for(auto it = missing.begin(); it != missing.end(); ++it)
+	{
+		vector<DWORD64> &list = it->second;
+		std::sort(list.begin(), list.end());
+		list.erase(std::unique(list.begin(), list.end()), list.end());
+
+		ResolveAddrs(*it->first, list);
+	}
+
+	for(size_t i=0; i < num; i++)
+		out[i] = GetAddr(addrs[i]);
+}
+
+Win32CallstackResolver::Module *Win32CallstackResolver::FindModule(DWORD64 addr)
+{
+	for(size_t i=0; i < modules.size(); i++)
+		if(addr > modules[i].base && addr < modules[i].base + modules[i].size)
+			return &modules[i];
+
+	return NULL;
+}
+
 ////////////////////////////////////////////////////////////////////
 // implement public interface
 
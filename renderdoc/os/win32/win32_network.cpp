@@ -91,12 +91,37 @@ Socket *Socket::AcceptClient(bool wait)
 			Shutdown();
 		}
 
-		Threading::Sleep(4);
-	} while(wait);
+		if(wait && Connected())
+			WaitForIncoming(1000);
+	} while(wait && Connected());
 
 	return NULL;
 }
 
+bool Socket::WaitForIncoming(uint32_t timeoutMS)
+{
+	if(!Connected())
+		return false;
+
+	fd_set set;
+	FD_ZERO(&set);
+	FD_SET((SOCKET)socket, &set);
+
+	timeval timeout;
+	timeout.tv_sec = (timeoutMS/1000);
+	timeout.tv_usec = (timeoutMS%1000)*1000;
+
+	int ret = select(0, &set, NULL, NULL, &timeout);
+
+	if(ret == SOCKET_ERROR)
+	{
+		RDCWARN("select: %d", WSAGetLastError());
+		return false;
+	}
+
+	return ret > 0;
+}
+
 bool Socket::SendDataBlocking(const void *buf, uint32_t length)
 {
 	if(length == 0) return true;
@@ -146,6 +171,15 @@ bool Socket::SendDataBlocking(const void *buf, uint32_t length)
 	return true;
 }
 
+bool Socket::SendDataBlocking(const SendBuffer *bufs, uint32_t count)
+{
+	for(uint32_t i=0; i < count; i++)
+		if(!SendDataBlocking(bufs[i].data, bufs[i].length))
+			return false;
+
+	return true;
+}
+
 bool Socket::IsRecvDataWaiting()
 {
 	char dummy;
@@ -510,3 +510,179 @@ uint32_t Process::GetCurrentPID()
 	return (uint32_t)GetCurrentProcessId();
 }
 
+// windows tracks this for us in memory allocated with MEM_WRITE_WATCH, so there's no need
+// to protect pages and catch the faults ourselves.
+namespace WriteWatch
+{
+	void *Alloc(size_t size)
+	{
+		if(size == 0)
+			return NULL;
+
+		byte *mem = (byte *)VirtualAlloc(NULL, size, MEM_RESERVE|MEM_COMMIT|MEM_WRITE_WATCH, PAGE_READWRITE);
+
+		if(mem == NULL)
+			RDCERR("Couldn't allocate %llu bytes to watch writes - error %d", (uint64_t)size, GetLastError());
+
+		return mem;
+	}
+
+	void Free(void *mem, size_t size)
+	{
+		if(mem)
+			VirtualFree(mem, 0, MEM_RELEASE);
+	}
+
+	void GetWrittenPages(void *memPtr, size_t size, vector<size_t> &pageOffsets)
+	{
+		byte *mem = (byte *)memPtr;
+		size_t pageSize = PageSize();
+
+		ULONG_PTR count = (ULONG_PTR)((size + pageSize - 1)/pageSize);
+		DWORD granularity = 0;
+
+		vector<PVOID> addrs((size_t)count);
+
+		if(count == 0)
+			return;
+
+		UINT ret = GetWriteWatch(WRITE_WATCH_FLAG_RESET, mem, size, &addrs[0], &count, &granularity);
+
+		if(ret != 0)
+		{
+			RDCERR("Couldn't get written pages - error %d", GetLastError());
+
+			// report everything, to be safe
+			for(size_t offs=0; offs < size; offs += pageSize)
+				pageOffsets.push_back(offs);
+
+			return;
+		}
+
+		for(ULONG_PTR i=0; i < count; i++)
+			pageOffsets.push_back(size_t((byte *)addrs[i] - mem));
+	}
+
+	size_t PageSize()
+	{
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return (size_t)info.dwPageSize;
+	}
+};
+
+namespace GuardPage
+{
+	void *Alloc(size_t size)
+	{
+		if(size == 0)
+			return NULL;
+
+		size_t pageSize = WriteWatch::PageSize();
+		size_t dataSize = AlignUp(AlignUp16(size), pageSize);
+
+		byte *mem = (byte *)VirtualAlloc(NULL, dataSize + pageSize, MEM_RESERVE|MEM_COMMIT, PAGE_READWRITE);
+		if(mem == NULL)
+		{
+			RDCERR("Couldn't allocate %llu guarded bytes - error %d", (uint64_t)size, GetLastError());
+			return NULL;
+		}
+
+		DWORD oldProtect = 0;
+		if(!VirtualProtect(mem + dataSize, pageSize, PAGE_NOACCESS, &oldProtect))
+		{
+			RDCERR("Couldn't protect guard page - error %d", GetLastError());
+			VirtualFree(mem, 0, MEM_RELEASE);
+			return NULL;
+		}
+
+		return mem + dataSize - AlignUp16(size);
+	}
+
+	void Free(void *mem, size_t size)
+	{
+		if(mem == NULL)
+			return;
+
+		size_t pageSize = WriteWatch::PageSize();
+		size_t dataSize = AlignUp(AlignUp16(size), pageSize);
+
+		VirtualFree((byte *)mem + AlignUp16(size) - dataSize, 0, MEM_RELEASE);
+	}
+};
+
+namespace LargePage
+{
+	static volatile int64_t largeAllocs = 0;
+	static volatile int64_t fallbackAllocs = 0;
+
+	static bool privilegeChecked = false;
+	static bool privilegeHeld = false;
+
+	// large pages need SeLockMemoryPrivilege, which has to be granted to the user by policy and
+	// then enabled in the process token
+	static bool EnableLockMemoryPrivilege()
+	{
+		HANDLE token = NULL;
+		if(!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES|TOKEN_QUERY, &token))
+			return false;
+
+		TOKEN_PRIVILEGES tp;
+		tp.PrivilegeCount = 1;
+		tp.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+		BOOL ok = LookupPrivilegeValue(NULL, SE_LOCK_MEMORY_NAME, &tp.Privileges[0].Luid);
+		if(ok)
+			ok = AdjustTokenPrivileges(token, FALSE, &tp, 0, NULL, NULL);
+
+		// AdjustTokenPrivileges succeeds even if the privilege isn't granted
+		bool ret = ok && GetLastError() == ERROR_SUCCESS;
+
+		CloseHandle(token);
+
+		return ret;
+	}
+
+	void *Alloc(size_t size)
+	{
+		if(size < MinSize)
+			return NULL;
+
+		size_t pageSize = GetLargePageMinimum();
+
+		if(!privilegeChecked)
+		{
+			privilegeHeld = pageSize > 0 && EnableLockMemoryPrivilege();
+			privilegeChecked = true;
+
+			if(!privilegeHeld)
+				RDCLOG("Large pages aren't available, SeLockMemoryPrivilege isn't held");
+		}
+
+		void *mem = NULL;
+
+		if(privilegeHeld)
+			mem = VirtualAlloc(NULL, AlignUp(size, pageSize), MEM_RESERVE|MEM_COMMIT|MEM_LARGE_PAGES, PAGE_READWRITE);
+
+		if(mem)
+			Atomic::Inc64(&largeAllocs);
+		else
+			Atomic::Inc64(&fallbackAllocs);
+
+		return mem;
+	}
+
+	void Free(void *mem, size_t size)
+	{
+		if(mem == NULL)
+			return;
+
+		VirtualFree(mem, 0, MEM_RELEASE);
+	}
+
+	void GetStats(uint64_t &large, uint64_t &fallback)
+	{
+		large = (uint64_t)largeAllocs;
+		fallback = (uint64_t)fallbackAllocs;
+	}
+};
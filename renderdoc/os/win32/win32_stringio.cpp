@@ -30,6 +30,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <share.h>
 #include <shlobj.h>
 #include <tchar.h>
 
@@ -147,6 +148,15 @@ namespace Keyboard
 
 		return false;
 	}
+
+	bool AnyKeyDown(const int *keys, size_t count)
+	{
+		for(size_t i=0; i < count; i++)
+			if(GetKeyState(keys[i]))
+				return true;
+
+		return false;
+	}
 }
 
 namespace FileIO
@@ -256,6 +266,14 @@ namespace FileIO
 		return ret;
 	}
 
+	FILE *logfile_open(const char *filename)
+	{
+		wstring wfn = StringFormat::UTF82Wide(string(filename));
+
+		// _wfopen_s doesn't allow any sharing
+		return ::_wfsopen(wfn.c_str(), L"a", _SH_DENYNO);
+	}
+
 	size_t fread(void *buf, size_t elementSize, size_t count, FILE *f) { return ::fread(buf, elementSize, count, f); }
 	size_t fwrite(const void *buf, size_t elementSize, size_t count, FILE *f) { return ::fwrite(buf, elementSize, count, f); }
 
@@ -263,6 +281,51 @@ namespace FileIO
 	void fseek64(FILE *f, uint64_t offset, int origin) { ::_fseeki64(f, offset, origin); }
 
 	int fclose(FILE *f) { return ::fclose(f); }
+
+	void *MapFile(const char *filename, uint64_t &size)
+	{
+		size = 0;
+
+		wstring wfn = StringFormat::UTF82Wide(string(filename));
+
+		HANDLE file = CreateFileW(wfn.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+		if(file == INVALID_HANDLE_VALUE)
+			return NULL;
+
+		LARGE_INTEGER fileSize;
+		if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0 ||
+			 (uint64_t)fileSize.QuadPart > (uint64_t)(~(size_t)0))
+		{
+			CloseHandle(file);
+			return NULL;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+		void *base = NULL;
+
+		if(mapping)
+			base = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+
+		// the view keeps the mapping and the file alive until it's unmapped
+		if(mapping)
+			CloseHandle(mapping);
+		CloseHandle(file);
+
+		if(base == NULL)
+			return NULL;
+
+		size = (uint64_t)fileSize.QuadPart;
+
+		return base;
+	}
+
+	void UnmapFile(void *base, uint64_t size)
+	{
+		if(base)
+			UnmapViewOfFile(base);
+	}
 };
 
 namespace StringFormat
@@ -68,6 +68,21 @@ namespace Atomic
 	{
 		return (int64_t)InterlockedExchangeAdd64((volatile LONG64 *)i, a);
 	}
+
+	int64_t CmpExch64(volatile int64_t *dest, int64_t exch, int64_t comp)
+	{
+		return (int64_t)InterlockedCompareExchange64((volatile LONG64 *)dest, exch, comp);
+	}
+
+	int64_t Read64(volatile int64_t *i)
+	{
+		return (int64_t)InterlockedCompareExchange64((volatile LONG64 *)i, 0, 0);
+	}
+
+	void *ExchPtr(void * volatile *dest, void *exch)
+	{
+		return InterlockedExchangePointer(dest, exch);
+	}
 };
 
 namespace Threading
@@ -164,4 +179,31 @@ namespace Threading
 	{
 		::Sleep((DWORD)milliseconds);
 	}
+
+	uint32_t NumberOfCPUs()
+	{
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return info.dwNumberOfProcessors > 0 ? (uint32_t)info.dwNumberOfProcessors : 1;
+	}
+
+	uint64_t AllocateTLSSlot()
+	{
+		DWORD slot = TlsAlloc();
+		if(slot == TLS_OUT_OF_INDEXES)
+		{
+			RDCFATAL("Couldn't allocate TLS slot");
+		}
+		return (uint64_t)slot;
+	}
+
+	void *GetTLSValue(uint64_t slot)
+	{
+		return TlsGetValue((DWORD)slot);
+	}
+
+	void SetTLSValue(uint64_t slot, void *value)
+	{
+		TlsSetValue((DWORD)slot, value);
+	}
 };
@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include "common/common.h"
+#include "common/timing.h"
 #include "maths/camera.h"
 #include "maths/formatpacking.h"
 #include "serialise/serialiser.h"
@@ -107,7 +108,10 @@ void RENDERDOC_CC RENDERDOC_LogText(const char *text)
 extern "C" RENDERDOC_API
 const char* RENDERDOC_CC RENDERDOC_GetLogFile()
 {
-	return RDCGETLOGFILE();
+	// the returned pointer stays valid until the next call
+	static string logfile;
+	logfile = RDCGETLOGFILE();
+	return logfile.c_str();
 }
 
 extern "C" RENDERDOC_API
@@ -135,6 +139,39 @@ bool32 RENDERDOC_CC RENDERDOC_GetCapture(uint32_t idx, char *logfile, uint32_t *
 	return true;
 }
 
+extern "C" RENDERDOC_API
+uint32_t RENDERDOC_CC RENDERDOC_GetResourceMemoryUsage(ResourceMemoryUsage *usage, uint32_t count)
+{
+	vector<ResourceMemoryUsage> res = RenderDoc::Inst().GetResourceMemoryUsage();
+
+	for(uint32_t i=0; usage && i < count && i < (uint32_t)res.size(); i++)
+		usage[i] = res[i];
+
+	return (uint32_t)res.size();
+}
+
+extern "C" RENDERDOC_API
+uint32_t RENDERDOC_CC RENDERDOC_GetChunkMemoryUsage(ChunkMemoryUsage *usage, uint32_t count)
+{
+	vector<ChunkMemoryUsage> chunks = RenderDoc::Inst().GetChunkMemoryUsage();
+
+	for(uint32_t i=0; usage && i < count && i < (uint32_t)chunks.size(); i++)
+		usage[i] = chunks[i];
+
+	return (uint32_t)chunks.size();
+}
+
+extern "C" RENDERDOC_API
+uint32_t RENDERDOC_CC RENDERDOC_GetCaptureOverhead(CaptureOverhead *overhead, uint32_t count)
+{
+	vector<CaptureOverhead> entries = Overhead::Fetch();
+
+	for(uint32_t i=0; overhead && i < count && i < (uint32_t)entries.size(); i++)
+		overhead[i] = entries[i];
+
+	return (uint32_t)entries.size();
+}
+
 extern "C" RENDERDOC_API
 void RENDERDOC_CC RENDERDOC_TriggerExceptionHandler(void *exceptionPtrs, bool32 crashed)
 {
@@ -212,6 +249,23 @@ ReplayCreateStatus RENDERDOC_CC RENDERDOC_CreateReplayRenderer(const char *logfi
 	return eReplayCreate_Success;
 }
 
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_SetHeadlessReplay(bool32 headless)
+{
+	RDCLOG("Headless replay %s", headless ? "enabled" : "disabled");
+	RenderDoc::Inst().SetHeadlessReplay(headless != 0);
+}
+
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_SetReplayAdapter(uint32_t adapterIndex)
+{
+	if(adapterIndex == ~0U)
+		RDCLOG("Replaying on the default adapter");
+	else
+		RDCLOG("Replaying on adapter %u", adapterIndex);
+	RenderDoc::Inst().SetReplayAdapter(adapterIndex);
+}
+
 extern "C" RENDERDOC_API
 void RENDERDOC_CC RENDERDOC_SetLogFile(const char *logfile)
 {
@@ -226,6 +280,12 @@ void RENDERDOC_CC RENDERDOC_SetCaptureOptions(const CaptureOptions *opts)
 	RenderDoc::Inst().SetCaptureOptions(opts);
 }
 
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_SetCallstackFilter(const char *filter)
+{
+	RenderDoc::Inst().SetCallstackFilter(filter);
+}
+
 extern "C" RENDERDOC_API
 uint32_t RENDERDOC_CC RENDERDOC_ExecuteAndInject(const char *app, const char *workingDir, const char *cmdLine,
 									 const char *logfile, const CaptureOptions *opts, bool32 waitForExit)
@@ -257,6 +317,30 @@ void RENDERDOC_CC RENDERDOC_TriggerCapture()
 	RenderDoc::Inst().TriggerCapture();
 }
 
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_TriggerMultiFrameCapture(uint32_t numFrames)
+{
+	RenderDoc::Inst().TriggerCapture(numFrames);
+}
+
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_SavePreviousFrame()
+{
+	RenderDoc::Inst().SavePreviousFrame();
+}
+
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_SetCaptureTrigger(const CaptureTrigger *trigger)
+{
+	RenderDoc::Inst().SetCaptureTrigger(trigger);
+}
+
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_CaptureMarkerRegion(const char *marker)
+{
+	RenderDoc::Inst().SetCaptureRegionMarker(marker);
+}
+
 extern "C" RENDERDOC_API
 void RENDERDOC_CC RENDERDOC_StartFrameCapture(void *device, void *wndHandle)
 {
@@ -351,15 +435,95 @@ bool32 RENDERDOC_CC RENDERDOC_GetThumbnail(const char *filename, byte *buf, uint
 	return true;
 }
 
+extern "C" RENDERDOC_API
+bool32 RENDERDOC_CC RENDERDOC_ArchiveLogFile(const char *logfile, const char *archivefile)
+{
+	return Serialiser::WriteArchive(logfile, archivefile);
+}
+
+extern "C" RENDERDOC_API
+bool32 RENDERDOC_CC RENDERDOC_WriteProfileTrace(const char *filename)
+{
+	return Profiler::WriteChromeTrace(filename);
+}
+
+extern "C" RENDERDOC_API
+bool32 RENDERDOC_CC RENDERDOC_FormatFloats(const char *format, const float *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output)
+{
+	if(output == NULL || (values == NULL && count > 0)) return false;
+
+	string str;
+	if(!StringFormat::FormatFloats(format, values, count, numColumns, colSep, rowSep, str))
+		return false;
+
+	*output = str;
+	return true;
+}
+
+extern "C" RENDERDOC_API
+bool32 RENDERDOC_CC RENDERDOC_FormatInts(const char *format, const int32_t *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output)
+{
+	if(output == NULL || (values == NULL && count > 0)) return false;
+
+	string str;
+	if(!StringFormat::FormatInts(format, values, count, numColumns, colSep, rowSep, str))
+		return false;
+
+	*output = str;
+	return true;
+}
+
+extern "C" RENDERDOC_API
+bool32 RENDERDOC_CC RENDERDOC_FormatUInts(const char *format, const uint32_t *values, uint32_t count, uint32_t numColumns, const char *colSep, const char *rowSep, rdctype::str *output)
+{
+	if(output == NULL || (values == NULL && count > 0)) return false;
+
+	string str;
+	if(!StringFormat::FormatUInts(format, values, count, numColumns, colSep, rowSep, str))
+		return false;
+
+	*output = str;
+	return true;
+}
+
+extern "C" RENDERDOC_API
+void* RENDERDOC_CC RENDERDOC_AllocArrayMem(uint64_t sz)
+{
+	return ResultArena::Allocate((size_t)sz);
+}
+
 extern "C" RENDERDOC_API
 void RENDERDOC_CC RENDERDOC_FreeArrayMem(const void *mem)
 {
-	rdctype::array<char>::deallocate(mem);
+	ResultArena::Free(mem);
+}
+
+extern "C" RENDERDOC_API
+ResultArena* RENDERDOC_CC RENDERDOC_CreateResultArena()
+{
+	return new ResultArena();
+}
+
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_SetResultArena(ResultArena *arena)
+{
+	ResultArena::SetRequested(arena);
+}
+
+extern "C" RENDERDOC_API
+void RENDERDOC_CC RENDERDOC_FreeResultArena(ResultArena *arena)
+{
+	if(ResultArena::GetRequested() == arena)
+		ResultArena::SetRequested(NULL);
+	delete arena;
 }
 
 extern "C" RENDERDOC_API
 void RENDERDOC_CC RENDERDOC_InitRemoteAccess(uint32_t *ident)
 {
+	// a bootstrapped child still needs to be reachable by ident
+	RenderDoc::Inst().EnsureRemoteAccess();
+
 	if(ident) *ident = RenderDoc::Inst().GetRemoteAccessIdent();
 }
 
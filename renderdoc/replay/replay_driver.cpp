@@ -0,0 +1,776 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 Crytek
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "replay_driver.h"
+
+#include "maths/formatpacking.h"
+#include "maths/half_convert.h"
+#include "common/timing.h"
+
+#include <algorithm>
+#include <map>
+#include <math.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+// SSE2 conversions for four component normalised vertex formats
+#define VERTEX_DECODE_SSE2
+#include <emmintrin.h>
+#endif
+
+enum VertexDecodeMode
+{
+	eDecode_Generic,
+	eDecode_Float,
+	eDecode_UNorm8x4,
+	eDecode_UNorm16x4,
+	eDecode_R10G10B10A2,
+	eDecode_R11G11B10,
+};
+
+static void DecodeUNorm8x4(const byte *src, float *dst)
+{
+#if defined(VERTEX_DECODE_SSE2)
+	uint32_t packed;
+	memcpy(&packed, src, sizeof(packed));
+
+	__m128i zero = _mm_setzero_si128();
+	__m128i comps = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)packed), zero), zero);
+
+	_mm_storeu_ps(dst, _mm_div_ps(_mm_cvtepi32_ps(comps), _mm_set1_ps(255.0f)));
+#else
+	for(int c=0; c < 4; c++)
+		dst[c] = float(src[c])/255.0f;
+#endif
+}
+
+static void DecodeUNorm16x4(const byte *src, float *dst)
+{
+#if defined(VERTEX_DECODE_SSE2)
+	__m128i comps = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)src), _mm_setzero_si128());
+
+	_mm_storeu_ps(dst, _mm_div_ps(_mm_cvtepi32_ps(comps), _mm_set1_ps(65535.0f)));
+#else
+	uint16_t comps[4];
+	memcpy(comps, src, sizeof(comps));
+
+	for(int c=0; c < 4; c++)
+		dst[c] = float(comps[c])/65535.0f;
+#endif
+}
+
+bool DecodeVertexStream(const MeshFormat &fmt, const byte *data, const byte *end, const uint32_t *verts, uint32_t numVerts, FloatVector *out)
+{
+	ResourceFormat compFmt;
+	compFmt.compByteWidth = fmt.compByteWidth;
+	compFmt.compCount = fmt.compCount;
+	compFmt.compType = fmt.compType;
+
+	VertexDecodeMode mode = eDecode_Generic;
+	bool swizzleBGRA = false;
+
+	if(fmt.specialFormat == eSpecial_R10G10B10A2)
+	{
+		mode = eDecode_R10G10B10A2;
+	}
+	else if(fmt.specialFormat == eSpecial_R11G11B10)
+	{
+		mode = eDecode_R11G11B10;
+	}
+	else
+	{
+		if(fmt.specialFormat == eSpecial_B8G8R8A8)
+		{
+			compFmt.compByteWidth = 1;
+			compFmt.compCount = 4;
+			compFmt.compType = eCompType_UNorm;
+			swizzleBGRA = true;
+		}
+
+		if(compFmt.compType == eCompType_Float && compFmt.compByteWidth == 4)
+			mode = eDecode_Float;
+		else if(compFmt.compType == eCompType_UNorm && compFmt.compCount == 4 && compFmt.compByteWidth == 1)
+			mode = eDecode_UNorm8x4;
+		else if(compFmt.compType == eCompType_UNorm && compFmt.compCount == 4 && compFmt.compByteWidth == 2)
+			mode = eDecode_UNorm16x4;
+	}
+
+	uint32_t compCount = RDCMIN(compFmt.compCount, 4U);
+
+	size_t vertSize = compFmt.compCount*compFmt.compByteWidth;
+	if(mode == eDecode_R10G10B10A2 || mode == eDecode_R11G11B10)
+		vertSize = sizeof(uint32_t);
+
+	size_t dataSize = end > data ? size_t(end - data) : 0;
+
+	bool valid = true;
+
+	for(uint32_t i=0; i < numVerts; i++)
+	{
+		FloatVector &o = out[i];
+		o = FloatVector(0.0f, 0.0f, 0.0f, 1.0f);
+
+		size_t offs = size_t(verts ? verts[i] : i)*fmt.stride;
+
+		if(offs + vertSize > dataSize)
+		{
+			valid = false;
+			continue;
+		}
+
+		const byte *src = data + offs;
+		float *dst = &o.x;
+
+		switch(mode)
+		{
+			case eDecode_Float:
+				memcpy(dst, src, compCount*sizeof(float));
+				break;
+			case eDecode_UNorm8x4:
+				DecodeUNorm8x4(src, dst);
+				break;
+			case eDecode_UNorm16x4:
+				DecodeUNorm16x4(src, dst);
+				break;
+			case eDecode_R10G10B10A2:
+			{
+				uint32_t packed;
+				memcpy(&packed, src, sizeof(packed));
+
+				Vec4f v = ConvertFromR10G10B10A2(packed);
+				o = FloatVector(v.x, v.y, v.z, v.w);
+				break;
+			}
+			case eDecode_R11G11B10:
+			{
+				uint32_t packed;
+				memcpy(&packed, src, sizeof(packed));
+
+				Vec3f v = ConvertFromR11G11B10(packed);
+				o.x = v.x;
+				o.y = v.y;
+				o.z = v.z;
+				break;
+			}
+			case eDecode_Generic:
+				for(uint32_t c=0; c < compCount; c++)
+					dst[c] = ConvertComponent(compFmt, (byte *)src + c*compFmt.compByteWidth);
+				break;
+		}
+
+		if(swizzleBGRA)
+			std::swap(o.x, o.z);
+	}
+
+	return valid;
+}
+
+static double CounterValue(const CounterDescription &desc, const CounterResult &res)
+{
+	if(desc.resultCompType == eCompType_Double)
+		return res.d;
+	if(desc.resultCompType == eCompType_Float)
+		return double(res.f);
+	if(desc.resultByteWidth == 4)
+		return double(res.u32);
+	return double(res.u64);
+}
+
+// median of sorted values, averaging the middle pair for an even count
+static double SortedMedian(const vector<double> &sorted)
+{
+	size_t n = sorted.size();
+	if(n % 2)
+		return sorted[n/2];
+	return (sorted[n/2 - 1] + sorted[n/2])*0.5;
+}
+
+vector<CounterResult> FetchCounterRuns(IRemoteDriver *driver, uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters, uint32_t numRuns)
+{
+	// runs further than this many (scaled) median absolute deviations from the median are
+	// outliers. 1.4826 scales the MAD to match a standard deviation for normal data.
+	const double OutlierDeviations = 3.0*1.4826;
+
+	RDCASSERT(numRuns > 1);
+
+	SCOPED_TIMER("Fetch counters over %u runs", numRuns);
+
+	driver->FetchCounters(frameID, minEventID, maxEventID, counters, 1);
+
+	vector< vector<CounterResult> > runs(numRuns);
+
+	for(uint32_t r=0; r < numRuns; r++)
+	{
+		runs[r] = driver->FetchCounters(frameID, minEventID, maxEventID, counters, 1);
+
+		if(runs[r].size() != runs[0].size())
+		{
+			RDCERR("Counter run %u returned %u results, expected %u", r, (uint32_t)runs[r].size(), (uint32_t)runs[0].size());
+			return runs[0];
+		}
+	}
+
+	map<uint32_t, CounterDescription> descs;
+
+	vector<CounterResult> ret;
+	ret.reserve(runs[0].size());
+
+	vector<double> values(numRuns);
+	vector<double> sorted(numRuns);
+	vector<double> deviations(numRuns);
+
+	for(size_t i=0; i < runs[0].size(); i++)
+	{
+		const CounterResult &first = runs[0][i];
+
+		if(descs.find(first.counterID) == descs.end())
+			driver->DescribeCounter(first.counterID, descs[first.counterID]);
+
+		const CounterDescription &desc = descs[first.counterID];
+
+		for(uint32_t r=0; r < numRuns; r++)
+		{
+			const CounterResult &res = runs[r][i];
+
+			if(res.eventID != first.eventID || res.counterID != first.counterID)
+			{
+				RDCERR("Counter run %u returned results in a different order", r);
+				return runs[0];
+			}
+
+			values[r] = sorted[r] = CounterValue(desc, res);
+		}
+
+		std::sort(sorted.begin(), sorted.end());
+
+		double median = SortedMedian(sorted);
+
+		// the typed value comes from a run at the (lower) median, so it's a real sample
+		double medianSample = sorted[(numRuns-1)/2];
+		uint32_t medianRun = 0;
+		while(values[medianRun] != medianSample)
+			medianRun++;
+
+		CounterResult combined = runs[medianRun][i];
+
+		for(uint32_t r=0; r < numRuns; r++)
+			deviations[r] = fabs(values[r] - median);
+
+		std::sort(deviations.begin(), deviations.end());
+
+		// if over half the runs agree exactly, nothing is rejected
+		double limit = SortedMedian(deviations)*OutlierDeviations;
+
+		double sum = 0.0;
+		uint32_t inliers = 0;
+
+		for(uint32_t r=0; r < numRuns; r++)
+		{
+			if(limit > 0.0 && fabs(values[r] - median) > limit)
+				continue;
+
+			sum += values[r];
+			inliers++;
+		}
+
+		double mean = sum/double(inliers);
+		double variance = 0.0;
+
+		for(uint32_t r=0; r < numRuns; r++)
+		{
+			if(limit > 0.0 && fabs(values[r] - median) > limit)
+				continue;
+
+			variance += (values[r] - mean)*(values[r] - mean);
+		}
+
+		if(inliers > 1)
+			variance /= double(inliers - 1);
+
+		combined.numRuns = numRuns;
+		combined.numOutliers = numRuns - inliers;
+		combined.minimum = sorted[0];
+		combined.median = median;
+		combined.mean = mean;
+		combined.stddev = sqrt(variance);
+
+		ret.push_back(combined);
+	}
+
+	return ret;
+}
+
+void SecondaryMeshArena::Clear()
+{
+	positions.clear();
+	indices.clear();
+	unpacked.clear();
+	m_Source.clear();
+
+	RDCEraseEl(firstIndex);
+	RDCEraseEl(numIndices);
+}
+
+bool SecondaryMeshArena::Matches(const vector<MeshFormat> &draws) const
+{
+	if(draws.size() != m_Source.size())
+		return false;
+
+	for(size_t i=0; i < draws.size(); i++)
+	{
+		const MeshFormat &a = draws[i];
+		const MeshFormat &b = m_Source[i];
+
+		if(a.buf != b.buf || a.offset != b.offset || a.stride != b.stride ||
+			 a.idxbuf != b.idxbuf || a.idxoffs != b.idxoffs || a.idxByteWidth != b.idxByteWidth ||
+			 a.topo != b.topo || a.numVerts != b.numVerts)
+			return false;
+	}
+
+	return true;
+}
+
+bool SecondaryMeshArena::Build(IRemoteDriver *driver, const vector<MeshFormat> &draws)
+{
+	Clear();
+
+	m_Source = draws;
+
+	vector<uint32_t> classIndices[eClass_Count];
+
+	for(size_t i=0; i < draws.size(); i++)
+	{
+		if(draws[i].buf == ResourceId())
+			continue;
+
+		if(!Pack(driver, draws[i], classIndices))
+			unpacked.push_back(draws[i]);
+	}
+
+	for(int c=0; c < eClass_Count; c++)
+	{
+		firstIndex[c] = (uint32_t)indices.size();
+		numIndices[c] = (uint32_t)classIndices[c].size();
+		indices.insert(indices.end(), classIndices[c].begin(), classIndices[c].end());
+	}
+
+	return !indices.empty();
+}
+
+void SecondaryMeshArena::FreeData()
+{
+	vector<Vec4f>().swap(positions);
+	vector<uint32_t>().swap(indices);
+}
+
+bool SecondaryMeshArena::Pack(IRemoteDriver *driver, const MeshFormat &fmt, vector<uint32_t> classIndices[eClass_Count])
+{
+	int cls = eClass_Points;
+	bool strip = false;
+
+	switch(fmt.topo)
+	{
+		case eTopology_PointList: cls = eClass_Points; break;
+		case eTopology_LineList: cls = eClass_Lines; break;
+		case eTopology_LineStrip: cls = eClass_Lines; strip = true; break;
+		case eTopology_TriangleList: cls = eClass_Triangles; break;
+		case eTopology_TriangleStrip: cls = eClass_Triangles; strip = true; break;
+		default: return false;
+	}
+
+	// positions are always float4 at the start of each vertex
+	if(fmt.stride < sizeof(Vec4f))
+		return false;
+
+	if(fmt.numVerts == 0)
+		return true;
+
+	vector<uint32_t> idx;
+	idx.resize(fmt.numVerts);
+
+	// only strips can be cut, and only by an actual index
+	uint32_t restart = ~0U;
+	bool canRestart = false;
+
+	if(fmt.idxbuf != ResourceId())
+	{
+		uint32_t width = fmt.idxByteWidth;
+		if(width != 1 && width != 2)
+			width = 4;
+
+		vector<byte> idxdata = driver->GetBufferData(fmt.idxbuf, fmt.idxoffs, fmt.numVerts*width);
+
+		if(idxdata.size() < (size_t)fmt.numVerts*width)
+			return false;
+
+		for(uint32_t i=0; i < fmt.numVerts; i++)
+		{
+			if(width == 1)
+				idx[i] = idxdata[i];
+			else if(width == 2)
+				idx[i] = ((uint16_t *)&idxdata[0])[i];
+			else
+				idx[i] = ((uint32_t *)&idxdata[0])[i];
+		}
+
+		if(width < 4)
+			restart = (1U << (width*8)) - 1;
+		canRestart = strip;
+	}
+	else
+	{
+		for(uint32_t i=0; i < fmt.numVerts; i++)
+			idx[i] = i;
+	}
+
+	uint32_t maxIdx = 0;
+	for(uint32_t i=0; i < fmt.numVerts; i++)
+		if(!canRestart || idx[i] != restart)
+			maxIdx = RDCMAX(maxIdx, idx[i]);
+
+	if(positions.size() + maxIdx + 1 > MaxVertices)
+		return false;
+
+	if(uint64_t(maxIdx)*fmt.stride + sizeof(Vec4f) > UINT32_MAX)
+		return false;
+
+	uint32_t len = maxIdx*fmt.stride + sizeof(Vec4f);
+
+	vector<byte> vertdata = driver->GetBufferData(fmt.buf, fmt.offset, len);
+
+	if(vertdata.size() < len)
+		return false;
+
+	uint32_t base = (uint32_t)positions.size();
+
+	positions.resize(base + maxIdx + 1);
+	for(uint32_t i=0; i <= maxIdx; i++)
+		memcpy(&positions[base+i], &vertdata[i*fmt.stride], sizeof(Vec4f));
+
+	vector<uint32_t> &out = classIndices[cls];
+
+	uint32_t primSize = 1;
+	if(cls == eClass_Lines) primSize = 2;
+	if(cls == eClass_Triangles) primSize = 3;
+
+	if(!strip)
+	{
+		// any trailing partial primitive is dropped, the same as the GPU would
+		uint32_t numPrims = fmt.numVerts/primSize;
+
+		for(uint32_t i=0; i < numPrims*primSize; i++)
+			out.push_back(base + idx[i]);
+	}
+	else
+	{
+		// expand each primitive in the strip. Winding doesn't need to alternate since
+		// secondary draws are only ever rendered as unculled wireframe.
+		uint32_t stripStart = 0;
+
+		for(uint32_t i=0; i < fmt.numVerts; i++)
+		{
+			if(canRestart && idx[i] == restart)
+			{
+				stripStart = i+1;
+				continue;
+			}
+
+			if(i+1 - stripStart < primSize)
+				continue;
+
+			for(uint32_t p=0; p < primSize; p++)
+				out.push_back(base + idx[i+1-primSize+p]);
+		}
+	}
+
+	return true;
+}
+
+vector<byte> FetchStridedBufferData(IRemoteDriver *driver, ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows)
+{
+	vector<byte> ret;
+
+	if(numRows == 0 || rowSize == 0)
+		return ret;
+
+	if(stride < rowSize)
+		stride = rowSize;
+
+	uint64_t range = uint64_t(numRows-1)*stride + rowSize;
+
+	if(range > 0xffffffffULL)
+	{
+		RDCERR("Strided buffer read of %u rows with stride %u is too large", numRows, stride);
+		return ret;
+	}
+
+	ret = driver->GetBufferData(buff, offset, (uint32_t)range);
+
+	if(stride == rowSize)
+		return ret;
+
+	// pack in place, each row moves down so it never overlaps one that hasn't moved yet
+	size_t packed = 0;
+	for(uint32_t r=0; r < numRows; r++)
+	{
+		size_t src = size_t(r)*stride;
+		if(src >= ret.size())
+			break;
+
+		size_t len = RDCMIN((size_t)rowSize, ret.size() - src);
+		memmove(&ret[packed], &ret[src], len);
+		packed += len;
+	}
+
+	ret.resize(packed);
+
+	return ret;
+}
+
+static void DecodeComponents(const byte *src, const ResourceFormat &fmt, ShaderVariable &var)
+{
+	var.rows = 1;
+	var.columns = RDCMIN(fmt.compCount, 4U);
+	var.type = eVar_Float;
+
+	// the largest value of each normalised component, and of its signed magnitude
+	double unormMax = fmt.compByteWidth >= 8 ? 18446744073709551615.0 : double((1ULL << (fmt.compByteWidth*8)) - 1);
+	double snormMax = fmt.compByteWidth >= 8 ? 9223372036854775807.0 : double((1ULL << (fmt.compByteWidth*8 - 1)) - 1);
+
+	bool isInt = (fmt.compType == eCompType_UInt || fmt.compType == eCompType_SInt);
+
+	if(isInt)
+		var.type = fmt.compType == eCompType_UInt ? eVar_UInt : eVar_Int;
+	else if(fmt.compType == eCompType_Double || (fmt.compType == eCompType_Float && fmt.compByteWidth == 8))
+		var.type = eVar_Double;
+
+	for(uint32_t c=0; c < fmt.compCount && c < 4; c++)
+	{
+		const byte *comp = src + c*fmt.compByteWidth;
+
+		uint64_t raw = 0;
+		memcpy(&raw, comp, RDCMIN(fmt.compByteWidth, (uint32_t)sizeof(raw)));
+
+		// sign-extend the raw bits for the signed types
+		int64_t sraw = (int64_t)raw;
+		if(fmt.compByteWidth > 0 && fmt.compByteWidth < 8)
+		{
+			uint32_t shift = 64 - fmt.compByteWidth*8;
+			sraw = int64_t(raw << shift) >> shift;
+		}
+
+		if(var.type == eVar_UInt)
+		{
+			var.value.uv[c] = (uint32_t)raw;
+		}
+		else if(var.type == eVar_Int)
+		{
+			var.value.iv[c] = (int32_t)sraw;
+		}
+		else if(var.type == eVar_Double)
+		{
+			double d = 0.0;
+			if(fmt.compByteWidth == 8) memcpy(&d, comp, sizeof(d));
+			else if(fmt.compByteWidth == 4) { float f; memcpy(&f, comp, sizeof(f)); d = f; }
+			var.value.dv[c] = d;
+		}
+		else if(fmt.compType == eCompType_UNorm || fmt.compType == eCompType_Depth)
+		{
+			if(fmt.compType == eCompType_Depth && fmt.compByteWidth == 4)
+				memcpy(&var.value.fv[c], comp, sizeof(float));
+			else
+				var.value.fv[c] = float(double(raw) / unormMax);
+		}
+		else if(fmt.compType == eCompType_SNorm)
+		{
+			var.value.fv[c] = RDCMAX(-1.0f, float(double(sraw) / snormMax));
+		}
+		else
+		{
+			if(fmt.compByteWidth == 4)
+				memcpy(&var.value.fv[c], comp, sizeof(float));
+			else if(fmt.compByteWidth == 2)
+				var.value.fv[c] = ConvertFromHalf((uint16_t)raw);
+			else
+				var.value.fv[c] = float(raw);
+		}
+	}
+}
+
+static uint32_t ElementSize(const ResourceFormat &fmt)
+{
+	if(!fmt.special)
+		return fmt.compCount*fmt.compByteWidth;
+
+	switch(fmt.specialFormat)
+	{
+		case eSpecial_R10G10B10A2:
+		case eSpecial_R11G11B10:
+		case eSpecial_B8G8R8A8:
+			return 4;
+		default:
+			break;
+	}
+
+	return 0;
+}
+
+void DecodeBufferElements(const byte *data, uint32_t numRows, uint32_t rowSize, const BufferElement *elements, uint32_t numElements, vector<ShaderVariable> &out)
+{
+	out.resize(size_t(numRows)*numElements);
+
+	for(uint32_t r=0; r < numRows; r++)
+	{
+		const byte *row = data + size_t(r)*rowSize;
+
+		for(uint32_t e=0; e < numElements; e++)
+		{
+			const BufferElement &el = elements[e];
+			ShaderVariable &var = out[size_t(r)*numElements + e];
+
+			var.name = el.name;
+
+			uint32_t size = ElementSize(el.format);
+			if(size == 0 || el.byteOffset + size > rowSize)
+				continue;
+
+			const byte *src = row + el.byteOffset;
+
+			if(!el.format.special)
+			{
+				DecodeComponents(src, el.format, var);
+				continue;
+			}
+
+			uint32_t packed = 0;
+			memcpy(&packed, src, sizeof(packed));
+
+			var.rows = 1;
+			var.type = eVar_Float;
+
+			if(el.format.specialFormat == eSpecial_R10G10B10A2)
+			{
+				var.columns = 4;
+				if(el.format.compType == eCompType_UInt)
+				{
+					var.type = eVar_UInt;
+					var.value.u.x = (packed >> 0) & 0x3ff;
+					var.value.u.y = (packed >> 10) & 0x3ff;
+					var.value.u.z = (packed >> 20) & 0x3ff;
+					var.value.u.w = (packed >> 30) & 0x3;
+				}
+				else
+				{
+					Vec4f v = ConvertFromR10G10B10A2(packed);
+					var.value.f.x = v.x; var.value.f.y = v.y; var.value.f.z = v.z; var.value.f.w = v.w;
+				}
+			}
+			else if(el.format.specialFormat == eSpecial_R11G11B10)
+			{
+				var.columns = 3;
+				Vec3f v = ConvertFromR11G11B10(packed);
+				var.value.f.x = v.x; var.value.f.y = v.y; var.value.f.z = v.z;
+			}
+			else if(el.format.specialFormat == eSpecial_B8G8R8A8)
+			{
+				var.columns = 4;
+				var.value.f.x = float((packed >> 16) & 0xff) / 255.0f;
+				var.value.f.y = float((packed >> 8) & 0xff) / 255.0f;
+				var.value.f.z = float((packed >> 0) & 0xff) / 255.0f;
+				var.value.f.w = float((packed >> 24) & 0xff) / 255.0f;
+			}
+		}
+	}
+}
+
+bool TextureRegionSupported(const FetchTexture &tex)
+{
+	if(tex.depth > 1 || tex.msSamp > 1)
+		return false;
+
+	if(tex.format.special)
+	{
+		switch(tex.format.specialFormat)
+		{
+			case eSpecial_R10G10B10A2:
+			case eSpecial_R11G11B10:
+			case eSpecial_B5G6R5:
+			case eSpecial_B5G5R5A1:
+			case eSpecial_R9G9B9E5:
+			case eSpecial_B8G8R8A8:
+			case eSpecial_B4G4R4A4:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	return tex.format.compCount > 0 && tex.format.compByteWidth > 0;
+}
+
+byte *FetchTextureRegion(IRemoteDriver *driver, ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize)
+{
+	dataSize = 0;
+
+	FetchTexture details = driver->GetTexture(tex);
+
+	if(!TextureRegionSupported(details))
+		return NULL;
+
+	uint32_t mipWidth = RDCMAX(1U, details.width>>mip);
+	uint32_t mipHeight = RDCMAX(1U, details.height>>mip);
+
+	if(x >= mipWidth || y >= mipHeight || width == 0 || height == 0)
+		return NULL;
+
+	width = RDCMIN(width, mipWidth - x);
+	height = RDCMIN(height, mipHeight - y);
+
+	size_t size = 0;
+	byte *data = driver->GetTextureData(tex, arrayIdx, mip, false, false, 0.0f, 0.0f, size);
+
+	// the data is tightly packed, so the texel size follows from its size. If it isn't a whole
+	// number of texels the layout isn't what we expect, and the region can't be found.
+	size_t texels = size_t(mipWidth)*mipHeight;
+
+	if(data == NULL || size == 0 || size % texels != 0)
+	{
+		delete[] data;
+		return NULL;
+	}
+
+	size_t texelSize = size / texels;
+	size_t srcPitch = texelSize*mipWidth;
+	size_t dstPitch = texelSize*width;
+
+	byte *ret = new byte[dstPitch*height];
+
+	for(uint32_t row=0; row < height; row++)
+		memcpy(ret + dstPitch*row, data + srcPitch*(y + row) + texelSize*x, dstPitch);
+
+	delete[] data;
+
+	dataSize = dstPitch*height;
+
+	return ret;
+}
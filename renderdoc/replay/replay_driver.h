@@ -84,7 +84,13 @@ class IRemoteDriver
 		virtual MeshFormat GetPostVSBuffers(uint32_t frameID, uint32_t eventID, uint32_t instID, MeshDataStage stage) = 0;
 		
 		virtual vector<byte> GetBufferData(ResourceId buff, uint32_t offset, uint32_t len) = 0;
+		// numRows rows of rowSize bytes each, stride bytes apart from offset, packed together
+		virtual vector<byte> GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows) = 0;
 		virtual byte *GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip, bool resolve, bool forceRGBA8unorm, float blackPoint, float whitePoint, size_t &dataSize) = 0;
+		// a rectangle of one 2D subresource with its rows packed together, in the same layout as
+		// GetTextureData. Returns NULL for textures that can't be read by region (see
+		// TextureRegionSupported), which should be fetched whole instead.
+		virtual byte *GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize) = 0;
 		
 		virtual void BuildTargetShader(string source, string entry, const uint32_t compileFlags, ShaderStageType type, ResourceId *id, string *errors) = 0;
 		virtual void ReplaceResource(ResourceId from, ResourceId to) = 0;
@@ -93,7 +99,9 @@ class IRemoteDriver
 		
 		virtual vector<uint32_t> EnumerateCounters() = 0;
 		virtual void DescribeCounter(uint32_t counterID, CounterDescription &desc) = 0;
-		virtual vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counterID) = 0;
+		// with numRuns > 1 the counters are fetched that many times after a discarded warm-up run,
+		// and each result reports the spread across runs (see FetchCounterRuns)
+		virtual vector<CounterResult> FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counterID, uint32_t numRuns) = 0;
 		
 		virtual void FillCBufferVariables(ResourceId shader, uint32_t cbufSlot, vector<ShaderVariable> &outvars, const vector<byte> &data) = 0;
 
@@ -116,6 +124,10 @@ class IReplayDriver : public IRemoteDriver
 	public:
 		virtual bool IsRemoteProxy() = 0;
 
+		// identifies the GPU and driver doing the replay, for results kept between sessions
+		// that are only valid on the same hardware. 0 if it can't be identified.
+		virtual uint64_t GetReplayDeviceHash() = 0;
+
 		virtual uint64_t MakeOutputWindow(void *w, bool depth) = 0;
 		virtual void DestroyOutputWindow(uint64_t id) = 0;
 		virtual bool CheckResizeOutputWindow(uint64_t id) = 0;
@@ -131,6 +143,7 @@ class IReplayDriver : public IRemoteDriver
 
 		virtual ResourceId CreateProxyTexture(FetchTexture templateTex) = 0;
 		virtual void SetProxyTextureData(ResourceId texid, uint32_t arrayIdx, uint32_t mip, byte *data, size_t dataSize) = 0;
+		virtual void SetProxyTextureRegion(ResourceId texid, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, byte *data, size_t dataSize) = 0;
 		
 		virtual ResourceId CreateProxyBuffer(FetchBuffer templateBuf) = 0;
 		virtual void SetProxyBufferData(ResourceId bufid, byte *data, size_t dataSize) = 0;
@@ -148,3 +161,113 @@ class IReplayDriver : public IRemoteDriver
 		
 		virtual void PickPixel(ResourceId texture, uint32_t x, uint32_t y, uint32_t sliceFace, uint32_t mip, uint32_t sample, float pixel[4]) = 0;
 };
+
+// decodes the position of each vertex listed in verts (or 0..numVerts-1 if verts is NULL)
+// from data, which should point at the first vertex of fmt, into out. The conversion is
+// chosen once for the whole stream rather than per component, and common formats are
+// converted with SIMD where available. Vertices that would read past end are left as
+// (0,0,0,1) and make the function return false.
+bool DecodeVertexStream(const MeshFormat &fmt, const byte *data, const byte *end, const uint32_t *verts, uint32_t numVerts, FloatVector *out);
+
+// a source of vendor hardware counters, like NVIDIA PerfKit or AMD GPUPerfAPI, that a driver
+// exposes alongside its generic counters. Counter IDs are in the vendor's reserved range of
+// GPUCounters. Gathering follows the session/pass/sample model both libraries use: the
+// enabled counters can need several passes, and the caller replays the same events in every
+// pass, wrapping each one it wants results for in the sample with the same index.
+class IHardwareCounters
+{
+	public:
+		virtual ~IHardwareCounters() {}
+
+		virtual bool HasCounter(uint32_t counterID) = 0;
+		virtual vector<uint32_t> EnumerateCounters() = 0;
+		virtual void DescribeCounter(uint32_t counterID, CounterDescription &desc) = 0;
+
+		// enables the counters and returns how many passes are needed, or 0 on failure
+		virtual uint32_t BeginSession(const vector<uint32_t> &counters) = 0;
+		virtual void BeginPass(uint32_t pass) = 0;
+		virtual void BeginSample(uint32_t sample) = 0;
+		virtual void EndSample(uint32_t sample) = 0;
+		virtual void EndPass(uint32_t pass) = 0;
+
+		// ends the session and returns each enabled counter for every sample, where sample i
+		// was taken around sampleEvents[i]. Samples that were never taken report 0.
+		virtual vector<CounterResult> EndSession(const vector<uint32_t> &sampleEvents) = 0;
+};
+
+// fetches counters through driver numRuns times, after one run that's thrown away to warm up
+// shaders and caches, and combines them into one result per event and counter with the
+// min, median, mean and standard deviation across runs filled out. Runs further than a few
+// median absolute deviations from the median are counted as outliers and left out of the
+// mean and standard deviation. Drivers call this from FetchCounters when numRuns > 1.
+vector<CounterResult> FetchCounterRuns(IRemoteDriver *driver, uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, const vector<uint32_t> &counters, uint32_t numRuns);
+
+// reads the range covering numRows rows of a buffer through driver and packs the rows
+// together, dropping the bytes between them. Drivers call this from GetBufferDataStrided so
+// that only the rows asked for are copied out, rather than the whole buffer.
+vector<byte> FetchStridedBufferData(IRemoteDriver *driver, ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows);
+
+// whether a texture's subresources can be read and uploaded by region - 1D, 2D, array and
+// cube textures in uncompressed, single-sampled formats
+bool TextureRegionSupported(const FetchTexture &tex);
+
+// reads the subresource through driver and crops out the rectangle, clamped to the mip's
+// size. Drivers call this from GetTextureDataRegion, so the readback is still of the whole
+// subresource but only the region is copied out (or sent on, from a replay host).
+byte *FetchTextureRegion(IRemoteDriver *driver, ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, size_t &dataSize);
+
+// decodes every element from numRows tightly packed rows of rowSize bytes into out, one
+// variable per element per row in row order. Components that fall outside of a row, or
+// formats that can't be decoded, are left as 0.
+void DecodeBufferElements(const byte *data, uint32_t numRows, uint32_t rowSize, const BufferElement *elements, uint32_t numElements, vector<ShaderVariable> &out);
+
+// packs the positions of the secondary draws in a mesh preview into one shared vertex and
+// index arena, so that a whole pass can be drawn with one indexed draw per primitive class
+// instead of thousands of tiny draws with their own buffer bindings. Positions are read
+// back once as float4 and all topologies are turned into lists, so the arena only needs
+// rebuilding when the set of draws changes - not each time the camera moves.
+struct SecondaryMeshArena
+{
+	enum
+	{
+		eClass_Points = 0,
+		eClass_Lines,
+		eClass_Triangles,
+		eClass_Count,
+	};
+
+	SecondaryMeshArena() { Clear(); }
+
+	// upper limit on packed vertices, any draws beyond this are left to be drawn on their own
+	static const size_t MaxVertices = 4*1024*1024;
+
+	// the renderable data. Indices for each class are contiguous and reference positions
+	// directly, with any primitive restarts already removed
+	vector<Vec4f> positions;
+	vector<uint32_t> indices;
+	uint32_t firstIndex[eClass_Count];
+	uint32_t numIndices[eClass_Count];
+
+	// draws that couldn't be packed (adjacency, patches, unreadable buffers) and need
+	// to be rendered individually as before
+	vector<MeshFormat> unpacked;
+
+	void Clear();
+
+	// returns true if the arena was built from exactly this list of draws
+	bool Matches(const vector<MeshFormat> &draws) const;
+
+	// reads back every draw's data through driver and packs it. Returns true if
+	// anything was packed and the renderable data needs to be uploaded.
+	bool Build(IRemoteDriver *driver, const vector<MeshFormat> &draws);
+
+	// frees the packed positions and indices once they've been uploaded. The index ranges
+	// and unpacked draws remain valid.
+	void FreeData();
+
+	private:
+		// the draws this arena was built from
+		vector<MeshFormat> m_Source;
+
+		bool Pack(IRemoteDriver *driver, const MeshFormat &fmt, vector<uint32_t> classIndices[eClass_Count]);
+};
@@ -24,11 +24,15 @@
 
 
 #include "common/common.h"
+#include "common/timing.h"
 
 #include "replay_renderer.h"
 
 #include "serialise/string_utils.h"
 #include "maths/matrix.h"
+#include "os/os_specific.h"
+
+#include <algorithm>
 
 ReplayOutput::ReplayOutput(ReplayRenderer *parent, void *w)
 {
@@ -37,6 +41,7 @@ ReplayOutput::ReplayOutput(ReplayRenderer *parent, void *w)
 	m_MainOutput.dirty = true;
 
 	m_OverlayDirty = true;
+	m_Previewing = false;
 
 	m_pDevice = parent->GetDevice();
 
@@ -60,6 +65,8 @@ ReplayOutput::ReplayOutput(ReplayRenderer *parent, void *w)
 	
 	m_pDevice->GetOutputWindowDimensions(m_MainOutput.outputID, m_Width, m_Height);
 
+	m_FrameID = ~0U;
+	m_EventID = 0;
 	m_FirstDeferredEvent = 0;
 	m_LastDeferredEvent = 0;
 
@@ -110,18 +117,81 @@ void ReplayOutput::SetContextFilter(ResourceId id, uint32_t firstDefEv, uint32_t
 
 void ReplayOutput::SetFrameEvent(int frameID, int eventID)
 {
+	bool sameFrame = (m_FrameID == (uint32_t)frameID);
+	uint32_t prevEvent = m_EventID;
+
 	m_FrameID = frameID;
 	m_EventID = eventID;
 
+	m_Previewing = false;
 	m_OverlayDirty = true;
 	m_MainOutput.dirty = true;
 	
+	// thumbnails show the texture contents after the current event, so they only change if
+	// something wrote to the texture between the old event and the new one.
 	for(size_t i=0; i < m_Thumbnails.size(); i++)
-		m_Thumbnails[i].dirty = true;
+		if(!sameFrame || ThumbnailWritten(i, RDCMIN(prevEvent, m_EventID), RDCMAX(prevEvent, m_EventID)))
+			m_Thumbnails[i].dirty = true;
 
 	RefreshOverlay();
 }
 
+void ReplayOutput::SetPreviewEvent()
+{
+	// m_EventID is left alone so the overlay, mesh and thumbnails can catch up from it
+	// once SetFrameEvent is called again.
+	m_Previewing = true;
+
+	if(m_Config.m_Type == eOutputType_TexDisplay)
+		m_MainOutput.dirty = true;
+}
+
+void ReplayOutput::InvalidateThumbnails()
+{
+	for(size_t i=0; i < m_Thumbnails.size(); i++)
+	{
+		FetchThumbnailWrites(i);
+		m_Thumbnails[i].dirty = true;
+	}
+}
+
+void ReplayOutput::FetchThumbnailWrites(size_t i)
+{
+	OutputPair &thumb = m_Thumbnails[i];
+
+	thumb.writes.clear();
+
+	if(thumb.texture == ResourceId())
+		return;
+
+	vector<EventUsage> usage = m_pDevice->GetUsage(m_pDevice->GetLiveID(thumb.texture));
+
+	for(size_t u=0; u < usage.size(); u++)
+		if(IsWriteUsage(usage[u].usage))
+			thumb.writes.push_back(usage[u].eventID);
+
+	std::sort(thumb.writes.begin(), thumb.writes.end());
+}
+
+bool ReplayOutput::ThumbnailWritten(size_t i, uint32_t fromEvent, uint32_t toEvent)
+{
+	const vector<uint32_t> &writes = m_Thumbnails[i].writes;
+
+	// any write in (fromEvent, toEvent]
+	vector<uint32_t>::const_iterator it = std::upper_bound(writes.begin(), writes.end(), fromEvent);
+
+	return it != writes.end() && *it <= toEvent;
+}
+
+bool ReplayOutput::HasPendingThumbnails()
+{
+	for(size_t i=0; i < m_Thumbnails.size(); i++)
+		if(m_Thumbnails[i].dirty && m_pDevice->IsOutputWindowVisible(m_Thumbnails[i].outputID))
+			return true;
+
+	return false;
+}
+
 void ReplayOutput::RefreshOverlay()
 {
 	FetchDrawcall *draw = m_pRenderer->GetDrawcallByEID(m_EventID, m_LastDeferredEvent);
@@ -248,6 +318,8 @@ bool ReplayOutput::AddThumbnail(void *wnd, ResourceId texID)
 
 			m_Thumbnails[i].dirty = true;
 
+			FetchThumbnailWrites(i);
+
 			return true;
 		}
 	}
@@ -262,6 +334,8 @@ bool ReplayOutput::AddThumbnail(void *wnd, ResourceId texID)
 
 	m_Thumbnails.push_back(p);
 
+	FetchThumbnailWrites(m_Thumbnails.size()-1);
+
 	return true;
 }
 
@@ -373,6 +447,11 @@ void ReplayOutput::DisplayContext()
 
 bool ReplayOutput::Display()
 {
+	SCOPED_PROFILE("Debug rendering");
+
+	// show the last event a scrub was coalesced to, in case nothing else comes along after it
+	m_pRenderer->FlushScrub();
+
 	if(m_pDevice->CheckResizeOutputWindow(m_MainOutput.outputID))
 	{
 		m_pDevice->GetOutputWindowDimensions(m_MainOutput.outputID, m_Width, m_Height);
@@ -383,11 +462,23 @@ bool ReplayOutput::Display()
 		if(m_pDevice->CheckResizeOutputWindow(m_Thumbnails[i].outputID))
 			m_Thumbnails[i].dirty = true;
 
+	uint64_t thumbStart = Timing::GetTick();
+	double tickFreqMS = Timing::GetTickFrequency()/1000.0;
+
+	// thumbnails are all rendered before any are flipped, so presenting one doesn't hold up
+	// rendering the next
+	vector<uint64_t> flips;
+	flips.reserve(m_Thumbnails.size());
+
 	for(size_t i=0; i < m_Thumbnails.size(); i++)
 	{
-		if(!m_Thumbnails[i].dirty)
+		// once over budget, leave remaining dirty thumbnails showing their old contents until
+		// the next Display()
+		bool overBudget = double(Timing::GetTick() - thumbStart)/tickFreqMS > (double)ThumbnailBudgetMS;
+
+		if(!m_Thumbnails[i].dirty || overBudget)
 		{
-			m_pDevice->FlipOutputWindow(m_Thumbnails[i].outputID);
+			flips.push_back(m_Thumbnails[i].outputID);
 			continue;
 		}
 		if(!m_pDevice->IsOutputWindowVisible(m_Thumbnails[i].outputID))
@@ -402,7 +493,7 @@ bool ReplayOutput::Display()
 			color[0] = 0.4f;
 			m_pDevice->ClearOutputWindowColour(m_Thumbnails[i].outputID, color);
 		
-			m_pDevice->FlipOutputWindow(m_Thumbnails[i].outputID);
+			flips.push_back(m_Thumbnails[i].outputID);
 			continue;
 		}
 		
@@ -430,10 +521,13 @@ bool ReplayOutput::Display()
 
 		m_pDevice->RenderTexture(disp);
 
-		m_pDevice->FlipOutputWindow(m_Thumbnails[i].outputID);
+		flips.push_back(m_Thumbnails[i].outputID);
 
 		m_Thumbnails[i].dirty = false;
 	}
+
+	for(size_t i=0; i < flips.size(); i++)
+		m_pDevice->FlipOutputWindow(flips[i]);
 	
 	if(m_pDevice->CheckResizeOutputWindow(m_PixelContext.outputID))
 		m_MainOutput.dirty = true;
@@ -485,6 +579,10 @@ void ReplayOutput::DisplayTex()
 	texDisplay.rawoutput = false;
 	texDisplay.texid = m_pDevice->GetLiveID(texDisplay.texid);
 
+	// the overlay belongs to m_EventID, not the event being previewed
+	if(m_Previewing)
+		draw = NULL;
+
 	if(m_RenderData.texDisplay.overlay != eTexOverlay_None && draw)
 	{
 		if(m_OverlayDirty)
@@ -497,7 +595,7 @@ void ReplayOutput::DisplayTex()
 		
 	if(m_RenderData.texDisplay.CustomShader != ResourceId())
 	{
-		m_CustomShaderResourceId = m_pDevice->ApplyCustomShader(m_RenderData.texDisplay.CustomShader, texDisplay.texid, texDisplay.mip);
+		m_CustomShaderResourceId = m_pRenderer->ApplyCustomShader(m_RenderData.texDisplay.CustomShader, texDisplay.texid, texDisplay.mip);
 
 		texDisplay.texid = m_pDevice->GetLiveID(m_CustomShaderResourceId);
 		texDisplay.CustomShader = ResourceId();
@@ -623,6 +721,8 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_ClearThumbnails(Replay
 { return output->ClearThumbnails(); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_AddThumbnail(ReplayOutput *output, void *wnd, ResourceId texID)
 { return output->AddThumbnail(wnd, texID); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_HasPendingThumbnails(ReplayOutput *output)
+{ return output->HasPendingThumbnails(); }
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayOutput_Display(ReplayOutput *output)
 { return output->Display(); }
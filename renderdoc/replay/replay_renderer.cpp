@@ -28,6 +28,9 @@
 #include <string.h>
 #include <time.h>
 
+#include <algorithm>
+#include <deque>
+
 #include "serialise/string_utils.h"
 #include "maths/formatpacking.h"
 #include "os/os_specific.h"
@@ -142,6 +145,21 @@ ReplayRenderer::ReplayRenderer()
 	m_DeferredCtx = ResourceId();
 	m_FirstDeferredEvent = 0;
 	m_LastDeferredEvent = 0;
+
+	m_CustomShaderUse = 0;
+	m_LastCustomShaderOutput = CustomShaderOutput();
+
+	m_CounterCacheDevice = 0;
+	m_CounterCacheLoaded = false;
+
+	m_ResourceGeneration = 0;
+
+	m_Scrubbing = false;
+	m_ScrubFrameID = 0;
+	m_ScrubEventID = 0;
+	m_PreviewFrameID = 0;
+	m_PreviewEventID = 0;
+	m_LastScrubTick = 0;
 }
 
 ReplayRenderer::~ReplayRenderer()
@@ -151,10 +169,12 @@ ReplayRenderer::~ReplayRenderer()
 
 	m_Outputs.clear();
 
-	for(auto it=m_CustomShaders.begin(); it != m_CustomShaders.end(); ++it)
-		m_pDevice->FreeCustomShader(*it);
+	for(auto it=m_CustomShaderBuilds.begin(); it != m_CustomShaderBuilds.end(); ++it)
+		if(it->second.id != ResourceId())
+			m_pDevice->FreeCustomShader(it->second.id);
 
-	m_CustomShaders.clear();
+	m_CustomShaderBuilds.clear();
+	m_CustomShaderKeys.clear();
 
 	for(auto it=m_TargetResources.begin(); it != m_TargetResources.end(); ++it)
 		m_pDevice->FreeTargetResource(*it);
@@ -192,21 +212,104 @@ bool ReplayRenderer::SetFrameEvent(uint32_t frameID, uint32_t eventID)
 
 bool ReplayRenderer::SetFrameEvent(uint32_t frameID, uint32_t eventID, bool force)
 {
+	if(m_Scrubbing && !force)
+		return ScrubFrameEvent(frameID, eventID);
+
 	if(m_FrameID != frameID || eventID != m_EventID || force)
-	{
-		m_FrameID = frameID;
-		m_EventID = eventID;
+		RefreshFrameEvent(frameID, eventID, force);
+
+	return true;
+}
+
+void ReplayRenderer::RefreshFrameEvent(uint32_t frameID, uint32_t eventID, bool force)
+{
+	m_FrameID = frameID;
+	m_EventID = eventID;
 
-		m_pDevice->ReplayLog(frameID, 0, eventID, eReplay_WithoutDraw);
+	m_ScrubFrameID = m_PreviewFrameID = frameID;
+	m_ScrubEventID = m_PreviewEventID = eventID;
+
+	m_pDevice->ReplayLog(frameID, 0, eventID, eReplay_WithoutDrawIncremental);
+
+	if(force)
+	{
+		m_PipelineStateCache.clear();
+		m_TextureStatsCache.clear();
+		m_LastCustomShaderOutput = CustomShaderOutput();
+	}
 
+	if(!FetchCachedPipelineState(frameID, eventID))
+	{
 		FetchPipelineState();
+		CachePipelineState(frameID, eventID);
+	}
 
-		for(size_t i=0; i < m_Outputs.size(); i++)
-			m_Outputs[i]->SetFrameEvent(frameID, eventID);
-		
-		m_pDevice->ReplayLog(frameID, 0, eventID, eReplay_OnlyDraw);
+	for(size_t i=0; i < m_Outputs.size(); i++)
+	{
+		// a forced refresh means the results at each event may have changed
+		if(force)
+			m_Outputs[i]->InvalidateThumbnails();
+		m_Outputs[i]->SetFrameEvent(frameID, eventID);
+	}
+
+	m_pDevice->ReplayLog(frameID, 0, eventID, eReplay_OnlyDraw);
+}
+
+bool ReplayRenderer::ScrubFrameEvent(uint32_t frameID, uint32_t eventID)
+{
+	m_ScrubFrameID = frameID;
+	m_ScrubEventID = eventID;
+
+	// only the latest of a burst of changes is worth replaying, the ones in between would be
+	// replaced before they were seen. Whatever is held back here is picked up by FlushScrub.
+	double tickFreqMS = Timing::GetTickFrequency()/1000.0;
+	if(double(Timing::GetTick() - m_LastScrubTick)/tickFreqMS < (double)ScrubIntervalMS)
+		return true;
+
+	FlushScrub();
+
+	return true;
+}
+
+void ReplayRenderer::FlushScrub()
+{
+	if(!m_Scrubbing || (m_ScrubFrameID == m_PreviewFrameID && m_ScrubEventID == m_PreviewEventID))
+		return;
+
+	m_LastScrubTick = Timing::GetTick();
+	m_PreviewFrameID = m_ScrubFrameID;
+	m_PreviewEventID = m_ScrubEventID;
+
+	// stepping forward picks up from the last preview, as with SetFrameEvent. Nothing else is
+	// fetched, the outputs just redraw the texture as it is after this event.
+	m_pDevice->ReplayLog(m_ScrubFrameID, 0, m_ScrubEventID, eReplay_WithoutDrawIncremental);
+	m_pDevice->ReplayLog(m_ScrubFrameID, 0, m_ScrubEventID, eReplay_OnlyDraw);
+
+	for(size_t i=0; i < m_Outputs.size(); i++)
+		m_Outputs[i]->SetPreviewEvent();
+}
+
+bool ReplayRenderer::SetScrubbing(bool scrubbing)
+{
+	if(scrubbing == m_Scrubbing)
+		return true;
+
+	m_Scrubbing = scrubbing;
+
+	if(scrubbing)
+	{
+		m_ScrubFrameID = m_PreviewFrameID = m_FrameID;
+		m_ScrubEventID = m_PreviewEventID = m_EventID;
+		m_LastScrubTick = 0;
+		return true;
 	}
 
+	// if the device was replayed elsewhere for a preview it needs to go back even if the
+	// scrub ended on the event it started from.
+	if(m_PreviewFrameID != m_FrameID || m_PreviewEventID != m_EventID ||
+		 m_ScrubFrameID != m_FrameID || m_ScrubEventID != m_EventID)
+		RefreshFrameEvent(m_ScrubFrameID, m_ScrubEventID, false);
+
 	return true;
 }
 
@@ -214,6 +317,7 @@ bool ReplayRenderer::GetD3D11PipelineState(D3D11PipelineState *state)
 {
 	if(state)
 	{
+		ResultArenaScope arena;
 		*state = m_D3D11PipelineState;
 		return true;
 	}
@@ -221,10 +325,78 @@ bool ReplayRenderer::GetD3D11PipelineState(D3D11PipelineState *state)
 	return false;
 }
 
+bool ReplayRenderer::FetchEventBatch(uint32_t frameID, uint32_t *eventIDs, uint32_t numEvents,
+                                     ResourceId *textures, uint32_t numTextures, uint32_t arrayIdx, uint32_t mip,
+                                     rdctype::array<D3D11PipelineState> *d3d11, rdctype::array<GLPipelineState> *gl,
+                                     rdctype::array< rdctype::array<byte> > *textureData)
+{
+	if(frameID >= (uint32_t)m_FrameRecord.size() || (numEvents > 0 && eventIDs == NULL) ||
+		 (numTextures > 0 && textures == NULL))
+		return false;
+
+	{
+		ResultArenaScope arena;
+		if(d3d11) create_array(*d3d11, numEvents);
+		if(gl) create_array(*gl, numEvents);
+		if(textureData) create_array(*textureData, numEvents*numTextures);
+	}
+
+	// visit the events in order so that each replay carries on from the last one
+	vector< pair<uint32_t, uint32_t> > order;
+	order.reserve(numEvents);
+	for(uint32_t i=0; i < numEvents; i++)
+		order.push_back(std::make_pair(eventIDs[i], i));
+	std::sort(order.begin(), order.end());
+
+	// fetching the pipeline state overwrites the current event's
+	D3D11PipelineState curD3D11 = m_D3D11PipelineState;
+	GLPipelineState curGL = m_GLPipelineState;
+
+	for(size_t i=0; i < order.size(); i++)
+	{
+		uint32_t eventID = order[i].first;
+		uint32_t idx = order[i].second;
+
+		m_pDevice->ReplayLog(frameID, 0, eventID, eReplay_WithoutDrawIncremental);
+
+		if(d3d11 || gl)
+		{
+			if(!FetchCachedPipelineState(frameID, eventID))
+			{
+				FetchPipelineState();
+				CachePipelineState(frameID, eventID);
+			}
+
+			ResultArenaScope arena;
+			if(d3d11) d3d11->elems[idx] = m_D3D11PipelineState;
+			if(gl) gl->elems[idx] = m_GLPipelineState;
+		}
+
+		m_pDevice->ReplayLog(frameID, 0, eventID, eReplay_OnlyDraw);
+
+		if(textureData)
+		{
+			for(uint32_t t=0; t < numTextures; t++)
+				GetTextureData(textures[t], arrayIdx, mip, &textureData->elems[idx*numTextures + t]);
+		}
+	}
+
+	m_D3D11PipelineState = curD3D11;
+	m_GLPipelineState = curGL;
+
+	// put the replay back at the current event. The outputs haven't seen any other event
+	// so don't need to be told.
+	m_pDevice->ReplayLog(m_FrameID, 0, m_EventID, eReplay_WithoutDrawIncremental);
+	m_pDevice->ReplayLog(m_FrameID, 0, m_EventID, eReplay_OnlyDraw);
+
+	return true;
+}
+
 bool ReplayRenderer::GetGLPipelineState(GLPipelineState *state)
 {
 	if(state)
 	{
+		ResultArenaScope arena;
 		*state = m_GLPipelineState;
 		return true;
 	}
@@ -236,6 +408,7 @@ bool ReplayRenderer::GetFrameInfo(rdctype::array<FetchFrameInfo> *arr)
 {
 	if(arr == NULL) return false;
 
+	ResultArenaScope arena;
 	create_array_uninit(*arr, m_FrameRecord.size());
 	for(size_t i=0; i < m_FrameRecord.size(); i++)
 		arr->elems[i] = m_FrameRecord[i].frameInfo;
@@ -258,25 +431,213 @@ bool ReplayRenderer::GetDrawcalls(uint32_t frameID, rdctype::array<FetchDrawcall
 	if(frameID >= (uint32_t)m_FrameRecord.size() || draws == NULL)
 		return false;
 
+	ResultArenaScope arena;
 	*draws = m_FrameRecord[frameID].m_DrawCallList;
 	return true;
 }
 
 bool ReplayRenderer::FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID,
-                                   uint32_t *counters, uint32_t numCounters, rdctype::array<CounterResult> *results)
+                                   uint32_t *counters, uint32_t numCounters, uint32_t numRuns, rdctype::array<CounterResult> *results)
 {
 	if(frameID >= (uint32_t)m_FrameRecord.size() || results == NULL)
 		return false;
 
-	vector<uint32_t> counterArray;
-	counterArray.reserve(numCounters);
+	CounterCacheKey key;
+	key.frameID = frameID;
+	key.minEventID = minEventID;
+	key.maxEventID = maxEventID;
+	key.numRuns = numRuns;
+	key.counters.reserve(numCounters);
 	for(uint32_t i=0; i < numCounters; i++)
-		counterArray.push_back(counters[i]);
+		key.counters.push_back(counters[i]);
+
+	bool cacheable = m_ReplacedResources.empty() && !m_Logfile.empty();
 
-	*results = m_pDevice->FetchCounters(frameID, minEventID, maxEventID, counterArray);
+	if(cacheable)
+	{
+		LoadCounterCache();
+
+		auto it = m_CounterCache.find(key);
+		if(it != m_CounterCache.end())
+		{
+			*results = it->second;
+			return true;
+		}
+	}
+
+	vector<CounterResult> res = m_pDevice->FetchCounters(frameID, minEventID, maxEventID, key.counters, numRuns);
+
+	if(cacheable && m_CounterCacheDevice != 0 && !res.empty())
+	{
+		m_CounterCache[key] = res;
+		SaveCounterCache();
+	}
+
+	*results = res;
 	
 	return true;
 }
+
+bool ReplayRenderer::CounterCacheKey::operator <(const CounterCacheKey &o) const
+{
+	if(frameID != o.frameID) return frameID < o.frameID;
+	if(minEventID != o.minEventID) return minEventID < o.minEventID;
+	if(maxEventID != o.maxEventID) return maxEventID < o.maxEventID;
+	if(numRuns != o.numRuns) return numRuns < o.numRuns;
+	return counters < o.counters;
+}
+
+string ReplayRenderer::GetCounterCacheFilename()
+{
+	return m_Logfile + ".counters";
+}
+
+// the file is the version, the replay device hash and log timestamp it was made with, then
+// a count and that many key/results pairs.
+void ReplayRenderer::LoadCounterCache()
+{
+	if(m_CounterCacheLoaded)
+		return;
+
+	m_CounterCacheLoaded = true;
+
+	m_CounterCacheDevice = m_pDevice->GetReplayDeviceHash();
+
+	if(m_CounterCacheDevice == 0)
+		return;
+
+	string cachefile = GetCounterCacheFilename();
+
+	FILE *f = FileIO::fopen(cachefile.c_str(), "rb");
+	if(!f)
+		return;
+
+	FileIO::fseek64(f, 0, SEEK_END);
+	uint64_t cachelen = FileIO::ftell64(f);
+	FileIO::fseek64(f, 0, SEEK_SET);
+
+	if(cachelen < sizeof(uint32_t) + sizeof(uint64_t)*2)
+	{
+		RDCERR("Invalid counter cache %s", cachefile.c_str());
+		FileIO::fclose(f);
+		return;
+	}
+
+	vector<byte> cache((size_t)cachelen);
+	FileIO::fread(&cache[0], 1, (size_t)cachelen, f);
+
+	FileIO::fclose(f);
+
+	Serialiser ser((size_t)cachelen, &cache[0], false);
+
+	uint32_t version = 0;
+	uint64_t device = 0, timestamp = 0;
+	ser.Serialise("version", version);
+	ser.Serialise("device", device);
+	ser.Serialise("timestamp", timestamp);
+
+	if(version != CounterCacheVersion || device != m_CounterCacheDevice ||
+	   timestamp != FileIO::GetModifiedTimestamp(m_Logfile.c_str()))
+	{
+		RDCDEBUG("Ignoring counter cache %s made for a different log, version or replay device", cachefile.c_str());
+		return;
+	}
+
+	uint32_t numentries = 0;
+	ser.Serialise("numentries", numentries);
+
+	// every entry takes more than a byte, so larger counts can only come from a corrupt file
+	bool valid = !ser.HasError() && numentries <= cachelen;
+
+	for(uint32_t i=0; valid && i < numentries; i++)
+	{
+		CounterCacheKey key;
+		ser.Serialise("frameID", key.frameID);
+		ser.Serialise("minEventID", key.minEventID);
+		ser.Serialise("maxEventID", key.maxEventID);
+		ser.Serialise("numRuns", key.numRuns);
+
+		uint32_t count = 0;
+		ser.Serialise("numCounters", count);
+		valid = !ser.HasError() && count <= cachelen;
+
+		for(uint32_t c=0; valid && c < count; c++)
+		{
+			uint32_t counter = 0;
+			ser.Serialise("counter", counter);
+			key.counters.push_back(counter);
+		}
+
+		vector<CounterResult> &results = m_CounterCache[key];
+
+		ser.Serialise("numResults", count);
+		valid = valid && !ser.HasError() && count <= cachelen;
+
+		for(uint32_t r=0; valid && r < count; r++)
+		{
+			results.push_back(CounterResult());
+			ser.Serialise("result", results.back());
+		}
+
+		valid = valid && !ser.HasError();
+	}
+
+	if(!valid || m_CounterCache.size() != numentries)
+	{
+		RDCERR("Invalid counter cache %s", cachefile.c_str());
+		m_CounterCache.clear();
+	}
+	else
+	{
+		RDCDEBUG("Loaded %u counter results from %s", numentries, cachefile.c_str());
+	}
+}
+
+void ReplayRenderer::SaveCounterCache()
+{
+	Serialiser ser(NULL, Serialiser::WRITING, false);
+
+	uint32_t version = CounterCacheVersion;
+	uint64_t timestamp = FileIO::GetModifiedTimestamp(m_Logfile.c_str());
+	uint32_t numentries = (uint32_t)m_CounterCache.size();
+	ser.Serialise("version", version);
+	ser.Serialise("device", m_CounterCacheDevice);
+	ser.Serialise("timestamp", timestamp);
+	ser.Serialise("numentries", numentries);
+
+	for(auto it=m_CounterCache.begin(); it != m_CounterCache.end(); ++it)
+	{
+		CounterCacheKey key = it->first;
+		ser.Serialise("frameID", key.frameID);
+		ser.Serialise("minEventID", key.minEventID);
+		ser.Serialise("maxEventID", key.maxEventID);
+		ser.Serialise("numRuns", key.numRuns);
+
+		uint32_t count = (uint32_t)key.counters.size();
+		ser.Serialise("numCounters", count);
+		for(uint32_t c=0; c < count; c++)
+			ser.Serialise("counter", key.counters[c]);
+
+		count = (uint32_t)it->second.size();
+		ser.Serialise("numResults", count);
+		for(uint32_t r=0; r < count; r++)
+			ser.Serialise("result", it->second[r]);
+	}
+
+	string cachefile = GetCounterCacheFilename();
+
+	// the log's directory might not be writeable, in which case results just aren't kept
+	FILE *f = FileIO::fopen(cachefile.c_str(), "wb");
+	if(f)
+	{
+		FileIO::fwrite(ser.GetRawPtr(0), 1, (size_t)ser.GetOffset(), f);
+		FileIO::fclose(f);
+	}
+	else
+	{
+		RDCWARN("Couldn't open counter cache %s for write", cachefile.c_str());
+	}
+}
 		
 bool ReplayRenderer::EnumerateCounters(rdctype::array<uint32_t> *counters)
 {
@@ -298,9 +659,11 @@ bool ReplayRenderer::DescribeCounter(uint32_t counterID, CounterDescription *des
 	return true;
 }
 
-bool ReplayRenderer::GetBuffers(rdctype::array<FetchBuffer> *out)
+void ReplayRenderer::FetchResourceLists()
 {
-	if(m_Buffers.empty())
+	if(m_ResourceGeneration != 0)
+		return;
+
 	{
 		vector<ResourceId> ids = m_pDevice->GetBuffers();
 
@@ -310,8 +673,32 @@ bool ReplayRenderer::GetBuffers(rdctype::array<FetchBuffer> *out)
 			m_Buffers[i] = m_pDevice->GetBuffer(ids[i]);
 	}
 
+	{
+		vector<ResourceId> ids = m_pDevice->GetTextures();
+
+		m_Textures.resize(ids.size());
+
+		for(size_t i=0; i < ids.size(); i++)
+			m_Textures[i] = m_pDevice->GetTexture(ids[i]);
+	}
+
+	m_ResourceGeneration++;
+}
+
+uint32_t ReplayRenderer::GetResourceGeneration()
+{
+	FetchResourceLists();
+
+	return m_ResourceGeneration;
+}
+
+bool ReplayRenderer::GetBuffers(rdctype::array<FetchBuffer> *out)
+{
+	FetchResourceLists();
+
 	if(out)
 	{
+		ResultArenaScope arena;
 		*out = m_Buffers;
 		return true;
 	}
@@ -321,18 +708,11 @@ bool ReplayRenderer::GetBuffers(rdctype::array<FetchBuffer> *out)
 
 bool ReplayRenderer::GetTextures(rdctype::array<FetchTexture> *out)
 {
-	if(m_Textures.empty())
-	{
-		vector<ResourceId> ids = m_pDevice->GetTextures();
-
-		m_Textures.resize(ids.size());
-
-		for(size_t i=0; i < ids.size(); i++)
-			m_Textures[i] = m_pDevice->GetTexture(ids[i]);
-	}
+	FetchResourceLists();
 	
 	if(out)
 	{
+		ResultArenaScope arena;
 		*out = m_Textures;
 		return true;
 	}
@@ -346,6 +726,8 @@ bool ReplayRenderer::GetResolve(uint64_t *callstack, uint32_t callstackLen, rdct
 
 	Callstack::StackResolver *resolv = m_pDevice->GetCallstackResolver();
 
+	ResultArenaScope arena;
+
 	if(resolv == NULL)
 	{
 		create_array_uninit(*arr, 1);
@@ -353,12 +735,12 @@ bool ReplayRenderer::GetResolve(uint64_t *callstack, uint32_t callstackLen, rdct
 		return true;
 	}
 
+	vector<Callstack::AddressDetails> details(callstackLen);
+	resolv->GetAddrs(callstack, callstackLen, &details[0]);
+
 	create_array_uninit(*arr, callstackLen);
 	for(size_t i=0; i < callstackLen; i++)
-	{
-		Callstack::AddressDetails info = resolv->GetAddr(callstack[i]);
-		arr->elems[i] = info.formattedString();
-	}
+		arr->elems[i] = details[i].formattedString();
 
 	return true;
 }
@@ -367,7 +749,10 @@ bool ReplayRenderer::GetDebugMessages(rdctype::array<DebugMessage> *msgs)
 {
 	if(msgs)
 	{
-		*msgs = m_pDevice->GetDebugMessages();
+		vector<DebugMessage> ret = m_pDevice->GetDebugMessages();
+
+		ResultArenaScope arena;
+		*msgs = ret;
 		return true;
 	}
 
@@ -378,7 +763,10 @@ bool ReplayRenderer::GetUsage(ResourceId id, rdctype::array<EventUsage> *usage)
 {
 	if(usage)
 	{
-		*usage = m_pDevice->GetUsage(m_pDevice->GetLiveID(id));
+		vector<EventUsage> ret = m_pDevice->GetUsage(m_pDevice->GetLiveID(id));
+
+		ResultArenaScope arena;
+		*usage = ret;
 		return true;
 	}
 
@@ -403,6 +791,86 @@ bool ReplayRenderer::GetPostVSData(uint32_t instID, MeshDataStage stage, MeshFor
 	return true;
 }
 
+bool IsWriteUsage(ResourceUsage usage)
+{
+	switch(usage)
+	{
+		case eUsage_SO:
+		case eUsage_VS_RWResource:
+		case eUsage_HS_RWResource:
+		case eUsage_DS_RWResource:
+		case eUsage_GS_RWResource:
+		case eUsage_PS_RWResource:
+		case eUsage_CS_RWResource:
+		case eUsage_ColourTarget:
+		case eUsage_DepthStencilTarget:
+		case eUsage_Clear:
+		case eUsage_GenMips:
+		case eUsage_Resolve:
+		case eUsage_ResolveDst:
+		case eUsage_Copy:
+		case eUsage_CopyDst:
+			return true;
+		default:
+			break;
+	}
+
+	return false;
+}
+
+ReplayRenderer::CachedTextureStats *ReplayRenderer::FindTextureStats(const CachedTextureStats &key)
+{
+	for(auto it=m_TextureStatsCache.begin(); it != m_TextureStatsCache.end(); ++it)
+	{
+		if(it->tex != key.tex || it->sliceFace != key.sliceFace || it->mip != key.mip ||
+			 it->sample != key.sample || it->frameID != key.frameID || it->histogram != key.histogram)
+			continue;
+
+		if(key.histogram &&
+			 (it->minval != key.minval || it->maxval != key.maxval ||
+			  memcmp(it->channels, key.channels, sizeof(key.channels))))
+			continue;
+
+		// still valid if nothing wrote to the texture in (first, last]
+		uint32_t first = RDCMIN(it->eventID, key.eventID);
+		uint32_t last = RDCMAX(it->eventID, key.eventID);
+
+		vector<EventUsage> usage = m_pDevice->GetUsage(key.tex);
+
+		// usage is sorted by event, so skip straight to the first event after 'first'
+		vector<EventUsage>::iterator u = std::lower_bound(usage.begin(), usage.end(), EventUsage(first+1, eUsage_None));
+
+		bool written = false;
+		for(; u != usage.end() && u->eventID <= last; ++u)
+		{
+			if(IsWriteUsage(u->usage))
+			{
+				written = true;
+				break;
+			}
+		}
+
+		if(written)
+		{
+			m_TextureStatsCache.erase(it);
+			return NULL;
+		}
+
+		m_TextureStatsCache.splice(m_TextureStatsCache.begin(), m_TextureStatsCache, it);
+		return &m_TextureStatsCache.front();
+	}
+
+	return NULL;
+}
+
+void ReplayRenderer::CacheTextureStats(const CachedTextureStats &stats)
+{
+	if(m_TextureStatsCache.size() >= TextureStatsCacheSize)
+		m_TextureStatsCache.pop_back();
+
+	m_TextureStatsCache.push_front(stats);
+}
+
 bool ReplayRenderer::GetMinMax(ResourceId tex, uint32_t sliceFace, uint32_t mip, uint32_t sample, PixelValue *minval, PixelValue *maxval)
 {
 	PixelValue *a = minval;
@@ -413,19 +881,67 @@ bool ReplayRenderer::GetMinMax(ResourceId tex, uint32_t sliceFace, uint32_t mip,
 	if(a == NULL) a = &dummy;
 	if(b == NULL) b = &dummy;
 
-	return m_pDevice->GetMinMax(m_pDevice->GetLiveID(tex), sliceFace, mip, sample, &a->value_f[0], &b->value_f[0]);
+	CachedTextureStats key;
+	key.tex = m_pDevice->GetLiveID(tex);
+	key.sliceFace = sliceFace;
+	key.mip = mip;
+	key.sample = sample;
+	key.frameID = m_FrameID;
+	key.eventID = m_EventID;
+	key.histogram = false;
+	key.minval = key.maxval = 0.0f;
+	key.channels[0] = key.channels[1] = key.channels[2] = key.channels[3] = false;
+
+	CachedTextureStats *cached = FindTextureStats(key);
+	if(cached)
+	{
+		*a = cached->minResult;
+		*b = cached->maxResult;
+		return true;
+	}
+
+	bool ret = m_pDevice->GetMinMax(key.tex, sliceFace, mip, sample, &a->value_f[0], &b->value_f[0]);
+
+	if(ret)
+	{
+		key.minResult = *a;
+		key.maxResult = *b;
+		CacheTextureStats(key);
+	}
+
+	return ret;
 }
 
 bool ReplayRenderer::GetHistogram(ResourceId tex, uint32_t sliceFace, uint32_t mip, uint32_t sample, float minval, float maxval, bool channels[4], rdctype::array<uint32_t> *histogram)
 {
 	if(histogram == NULL) return false;
 
-	vector<uint32_t> hist;
+	CachedTextureStats key;
+	key.tex = m_pDevice->GetLiveID(tex);
+	key.sliceFace = sliceFace;
+	key.mip = mip;
+	key.sample = sample;
+	key.frameID = m_FrameID;
+	key.eventID = m_EventID;
+	key.histogram = true;
+	key.minval = minval;
+	key.maxval = maxval;
+	memcpy(key.channels, channels, sizeof(key.channels));
+
+	CachedTextureStats *cached = FindTextureStats(key);
+	if(cached)
+	{
+		*histogram = cached->histResult;
+		return true;
+	}
 
-	bool ret = m_pDevice->GetHistogram(m_pDevice->GetLiveID(tex), sliceFace, mip, sample, minval, maxval, channels, hist);
+	bool ret = m_pDevice->GetHistogram(key.tex, sliceFace, mip, sample, minval, maxval, channels, key.histResult);
 
 	if(ret)
-		*histogram = hist;
+	{
+		*histogram = key.histResult;
+		CacheTextureStats(key);
+	}
 
 	return ret;
 }
@@ -434,7 +950,54 @@ bool ReplayRenderer::GetBufferData(ResourceId buff, uint32_t offset, uint32_t le
 {
 	if(data == NULL) return false;
 
-	*data = m_pDevice->GetBufferData(m_pDevice->GetLiveID(buff), offset, len);
+	vector<byte> ret = m_pDevice->GetBufferData(m_pDevice->GetLiveID(buff), offset, len);
+
+	ResultArenaScope arena;
+	*data = ret;
+
+	return true;
+}
+
+bool ReplayRenderer::GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows, rdctype::array<byte> *data)
+{
+	if(data == NULL) return false;
+
+	vector<byte> ret = m_pDevice->GetBufferDataStrided(m_pDevice->GetLiveID(buff), offset, stride, rowSize, numRows);
+
+	ResultArenaScope arena;
+	*data = ret;
+
+	return true;
+}
+
+bool ReplayRenderer::GetBufferElements(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t numRows, const BufferElement *elements, uint32_t numElements, rdctype::array<ShaderVariable> *vars)
+{
+	if(vars == NULL || (elements == NULL && numElements > 0)) return false;
+
+	// only fetch as much of each row as the elements cover
+	uint32_t rowSize = 0;
+	for(uint32_t e=0; e < numElements; e++)
+	{
+		const ResourceFormat &fmt = elements[e].format;
+		uint32_t size = fmt.special ? 4 : fmt.compCount*fmt.compByteWidth;
+		rowSize = RDCMAX(rowSize, elements[e].byteOffset + size);
+	}
+
+	if(stride == 0)
+		stride = rowSize;
+
+	rowSize = RDCMIN(rowSize, stride);
+
+	vector<byte> data = m_pDevice->GetBufferDataStrided(m_pDevice->GetLiveID(buff), offset, stride, rowSize, numRows);
+
+	// decode only the complete rows that came back
+	uint32_t rows = rowSize > 0 ? uint32_t(data.size() / rowSize) : 0;
+
+	vector<ShaderVariable> ret;
+	DecodeBufferElements(data.empty() ? NULL : &data[0], rows, rowSize, elements, numElements, ret);
+
+	ResultArenaScope arena;
+	*vars = ret;
 
 	return true;
 }
@@ -446,7 +1009,10 @@ bool ReplayRenderer::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t
 	size_t sz;
 	byte *bytes = m_pDevice->GetTextureData(m_pDevice->GetLiveID(tex), arrayIdx, mip, false, false, 0.0f, 0.0f, sz);
 
-	create_array_uninit(*data, sz);
+	{
+		ResultArenaScope arena;
+		create_array_uninit(*data, sz);
+	}
 	memcpy(data->elems, bytes, sz);
 
 	delete[] bytes;
@@ -454,13 +1020,247 @@ bool ReplayRenderer::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t
 	return true;
 }
 
+bool ReplayRenderer::GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, rdctype::array<byte> *data)
+{
+	if(data == NULL) return false;
+
+	size_t sz = 0;
+	byte *bytes = m_pDevice->GetTextureDataRegion(m_pDevice->GetLiveID(tex), arrayIdx, mip, x, y, width, height, sz);
+
+	if(bytes == NULL)
+		return false;
+
+	{
+		ResultArenaScope arena;
+		create_array_uninit(*data, sz);
+	}
+	memcpy(data->elems, bytes, sz);
+
+	delete[] bytes;
+
+	return true;
+}
+
+// writes subresources to a file from a separate thread, in the order they're queued, so that
+// reading back the next subresource from the GPU overlaps with writing out the last one.
+class SubresourceWriter
+{
+	public:
+		SubresourceWriter(FILE *f)
+			: m_File(f), m_Done(false), m_Failed(false)
+		{
+			m_Thread = Threading::CreateThread(&SubresourceWriter::WriteThread, this);
+		}
+
+		~SubresourceWriter()
+		{
+			Finish();
+		}
+
+		// takes ownership of data, which is delete[]'d once it's written. Waits while a few
+		// subresources are already pending, so only those are ever held in memory.
+		void Queue(byte *data, size_t size)
+		{
+			if(m_Thread == 0)
+			{
+				Write(data, size);
+				return;
+			}
+
+			while(true)
+			{
+				{
+					SCOPED_LOCK(m_Lock);
+					if(m_Queue.size() < MaxPending)
+					{
+						m_Queue.push_back(std::make_pair(data, size));
+						return;
+					}
+				}
+
+				Threading::Sleep(1);
+			}
+		}
+
+		// waits for everything queued to be written, and returns whether it all succeeded
+		bool Finish()
+		{
+			if(m_Thread)
+			{
+				m_Done = true;
+				Threading::JoinThread(m_Thread);
+				Threading::CloseThread(m_Thread);
+				m_Thread = 0;
+			}
+
+			return !m_Failed;
+		}
+
+	private:
+		static const size_t MaxPending = 4;
+
+		void Write(byte *data, size_t size)
+		{
+			if(FileIO::fwrite(data, 1, size, m_File) != size)
+				m_Failed = true;
+
+			delete[] data;
+		}
+
+		static void WriteThread(void *param)
+		{
+			SubresourceWriter *writer = (SubresourceWriter *)param;
+
+			while(true)
+			{
+				// check this before looking at the queue, so that anything queued before Finish()
+				// is always written
+				bool done = writer->m_Done;
+
+				pair<byte *, size_t> item(NULL, 0);
+
+				{
+					SCOPED_LOCK(writer->m_Lock);
+					if(!writer->m_Queue.empty())
+					{
+						item = writer->m_Queue.front();
+						writer->m_Queue.pop_front();
+					}
+				}
+
+				if(item.first)
+				{
+					writer->Write(item.first, item.second);
+					continue;
+				}
+
+				if(done)
+					break;
+
+				Threading::Sleep(1);
+			}
+		}
+
+		FILE *m_File;
+		Threading::ThreadHandle m_Thread;
+
+		Threading::CriticalSection m_Lock;
+		std::deque< pair<byte *, size_t> > m_Queue;
+
+		volatile bool m_Done;
+		bool m_Failed;
+};
+
+struct FloatConversion
+{
+	ResourceFormat fmt;
+	const byte *src;
+	size_t srcPitch;
+	float *dst;
+	uint32_t width;
+	bool clampNegative;
+};
+
+// converts rows [begin, end) of an image to RGBA32 float, for HDR or EXR output
+static void ConvertRowsToFloat(void *userData, size_t begin, size_t end)
+{
+	FloatConversion &conv = *(FloatConversion *)userData;
+	const ResourceFormat &fmt = conv.fmt;
+
+	bool halfRGBA = !fmt.special && fmt.compType == eCompType_Float && fmt.compByteWidth == 2 && fmt.compCount == 4;
+
+	for(size_t y=begin; y < end; y++)
+	{
+		byte *srcData = (byte *)conv.src + y*conv.srcPitch;
+		float *dstData = conv.dst + y*conv.width*4;
+
+		// formats with a batch conversion are done a whole row at a time
+		if(fmt.special && fmt.specialFormat == eSpecial_R10G10B10A2)
+		{
+			ConvertFromR10G10B10A2((const uint32_t *)srcData, (Vec4f *)dstData, conv.width);
+		}
+		else if(fmt.special && fmt.specialFormat == eSpecial_R11G11B10)
+		{
+			ConvertFromR11G11B10((const uint32_t *)srcData, (Vec4f *)dstData, conv.width);
+		}
+		else if(fmt.special && fmt.specialFormat == eSpecial_R9G9B9E5)
+		{
+			ConvertFromR9G9B9E5((const uint32_t *)srcData, (Vec4f *)dstData, conv.width);
+		}
+		else if(halfRGBA)
+		{
+			ConvertFromHalf((const uint16_t *)srcData, dstData, conv.width*4);
+		}
+		else
+		{
+			for(uint32_t x=0; x < conv.width; x++)
+			{
+				float r = 0.0f;
+				float g = 0.0f;
+				float b = 0.0f;
+				float a = 1.0f;
+
+				if(fmt.compCount >= 1)
+					r = ConvertComponent(fmt, srcData + fmt.compByteWidth*0);
+				if(fmt.compCount >= 2)
+					g = ConvertComponent(fmt, srcData + fmt.compByteWidth*1);
+				if(fmt.compCount >= 3)
+					b = ConvertComponent(fmt, srcData + fmt.compByteWidth*2);
+				if(fmt.compCount >= 4)
+					a = ConvertComponent(fmt, srcData + fmt.compByteWidth*3);
+
+				srcData += fmt.compCount * fmt.compByteWidth;
+
+				dstData[x*4 + 0] = r;
+				dstData[x*4 + 1] = g;
+				dstData[x*4 + 2] = b;
+				dstData[x*4 + 3] = a;
+			}
+		}
+
+		// HDR can't represent negative values
+		if(conv.clampNegative)
+		{
+			for(uint32_t i=0; i < conv.width*4; i++)
+				dstData[i] = RDCMAX(dstData[i], 0.0f);
+		}
+	}
+}
+
+// a texture that has been read back from the GPU and is waiting to be encoded and written
+// to disk. Owns the subresource data.
+struct PendingTextureSave
+{
+	TextureSave sd;
+	FetchTexture td;
+	string path;
+	vector<byte *> subdata;
+	uint32_t rowPitch;
+};
+
 bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
 {
+	PendingTextureSave *pending = NULL;
+
+	if(!FetchTextureSave(saveData, path, &pending))
+		return false;
+
+	// DDS files are written out while fetching
+	if(pending == NULL)
+		return true;
+
+	bool success = WriteTextureSave(*pending);
+	delete pending;
+	return success;
+}
+
+bool ReplayRenderer::FetchTextureSave(const TextureSave &saveData, const char *path, PendingTextureSave **pending)
+{
+	*pending = NULL;
+
 	TextureSave sd = saveData; // mutable copy
 	ResourceId liveid = m_pDevice->GetLiveID(sd.id);
 	FetchTexture td = m_pDevice->GetTexture(liveid);
-
-	bool success = false;
 	
 	// clamp sample/mip/slice indices
 	if(td.msSamp == 1)
@@ -695,6 +1495,38 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
 		slicePitch = rowPitch * td.height;
 	}
 
+	dds_data ddsData = {};
+
+	FILE *ddsFile = NULL;
+	SubresourceWriter *ddsWriter = NULL;
+
+	// DDS files can be written a subresource at a time, so write the header now and stream
+	// each subresource out as it's fetched instead of holding them all in memory.
+	if(sd.destType == eFileType_DDS)
+	{
+		ddsData.width = td.width;
+		ddsData.height = td.height;
+		ddsData.depth = td.depth;
+		ddsData.format = td.format;
+		ddsData.mips = numMips;
+		ddsData.slices = numSlices/td.depth;
+		ddsData.cubemap = td.cubemap && numSlices == 6;
+
+		ddsFile = FileIO::fopen(path, "wb");
+
+		if(!ddsFile)
+			return false;
+
+		if(!write_dds_header(ddsFile, ddsData))
+		{
+			FileIO::fclose(ddsFile);
+			FileIO::Delete(path);
+			return false;
+		}
+
+		ddsWriter = new SubresourceWriter(ddsFile);
+	}
+
 	// loop over fetching subresources
 	for(uint32_t s=0; s < numSlices; s++)
 	{
@@ -714,12 +1546,22 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
 				for(size_t i=0; i < subdata.size(); i++)
 					delete[] subdata[i];
 
+				if(ddsWriter)
+				{
+					SAFE_DELETE(ddsWriter);
+					FileIO::fclose(ddsFile);
+					FileIO::Delete(path);
+				}
+
 				return false;
 			}
 
 			if(td.depth == 1)
 			{
-				subdata.push_back(bytes);
+				if(ddsWriter)
+					ddsWriter->Queue(bytes, dds_subresource_size(ddsData, m));
+				else
+					subdata.push_back(bytes);
 				continue;
 			}
 
@@ -747,7 +1589,11 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
 				byte *depthslice = new byte[mipSlicePitch];
 				byte *b = bytes + mipSlicePitch*sliceOffset;
 				memcpy(depthslice, b, slicePitch);
-				subdata.push_back(depthslice);
+
+				if(ddsWriter)
+					ddsWriter->Queue(depthslice, mipSlicePitch);
+				else
+					subdata.push_back(depthslice);
 
 				delete[] bytes;
 				continue;
@@ -764,7 +1610,10 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
 
 				memcpy(depthslice, b, mipSlicePitch);
 
-				subdata.push_back(depthslice);
+				if(ddsWriter)
+					ddsWriter->Queue(depthslice, mipSlicePitch);
+				else
+					subdata.push_back(depthslice);
 
 				b += mipSlicePitch;
 			}
@@ -772,6 +1621,38 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
 			delete[] bytes;
 		}
 	}
+
+	if(ddsWriter)
+	{
+		// everything has been queued, wait for the last writes to finish
+		bool success = ddsWriter->Finish();
+		SAFE_DELETE(ddsWriter);
+		FileIO::fclose(ddsFile);
+
+		return success;
+	}
+
+	*pending = new PendingTextureSave();
+	(*pending)->sd = sd;
+	(*pending)->td = td;
+	(*pending)->path = path;
+	(*pending)->subdata.swap(subdata);
+	(*pending)->rowPitch = rowPitch;
+
+	return true;
+}
+
+// encodes fetched texture data into the destination format and writes it out. This doesn't
+// touch the replay device so it can run on a different thread to the fetch.
+bool ReplayRenderer::WriteTextureSave(PendingTextureSave &pending)
+{
+	const TextureSave &sd = pending.sd;
+	FetchTexture &td = pending.td;
+	vector<byte *> &subdata = pending.subdata;
+	uint32_t rowPitch = pending.rowPitch;
+	const char *path = pending.path.c_str();
+
+	bool success = false;
 	
 	// should have been handled above, but verify incoming data is RGBA8
 	if(sd.slice.slicesAsGrid && td.format.compByteWidth == 1 && td.format.compCount == 4)
@@ -961,22 +1842,7 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
 	}
 	else
 	{
-		if(sd.destType == eFileType_DDS)
-		{
-			dds_data ddsData;
-
-			ddsData.width = td.width;
-			ddsData.height = td.height;
-			ddsData.depth = td.depth;
-			ddsData.format = td.format;
-			ddsData.mips = numMips;
-			ddsData.slices = numSlices/td.depth;
-			ddsData.subdata = &subdata[0];
-			ddsData.cubemap = td.cubemap && numSlices == 6;
-
-			success = write_dds_to_file(f, ddsData);
-		}
-		else if(sd.destType == eFileType_BMP)
+		if(sd.destType == eFileType_BMP)
 		{
 			int ret = stbi_write_bmp_to_file(f, td.width, td.height, numComps, subdata[0]);
 			success = (ret != 0);
@@ -996,129 +1862,275 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
 			jpge::params p;
 			p.m_quality = sd.jpegQuality;
 
-			int len = td.width*td.height*td.format.compCount;
+			int len = td.width*td.height*td.format.compCount;
+
+			char *jpgdst = new char[len];
+
+			success = jpge::compress_image_to_jpeg_file_in_memory(jpgdst, len, td.width, td.height, numComps, subdata[0], p);
+
+			if(success)
+				fwrite(jpgdst, 1, len, f);
+
+			delete[] jpgdst;
+		}
+		else if(sd.destType == eFileType_HDR || sd.destType == eFileType_EXR)
+		{
+			float *fldata = new float[td.width*td.height*4];
+
+			FloatConversion conv;
+			conv.fmt = td.format;
+			conv.src = subdata[0];
+			conv.srcPitch = td.width * (td.format.special ? 4U : td.format.compCount * td.format.compByteWidth);
+			conv.dst = fldata;
+			conv.width = td.width;
+			conv.clampNegative = (sd.destType == eFileType_HDR);
+
+			// the conversion is per-pixel and independent, so large images are split across threads
+			Threading::ParallelFor(td.height, 64, &ConvertRowsToFloat, &conv);
+
+			if(sd.destType == eFileType_HDR)
+			{
+				int ret = stbi_write_hdr_to_file(f, td.width, td.height, 4, fldata);
+				success = (ret != 0);
+			}
+			else if(sd.destType == eFileType_EXR)
+			{
+				const char *err = NULL;
+				int ret = SaveEXRFP(fldata, (int)td.width, (int)td.height, f, &err);
+				success = (ret == 0);
+				if(!success)
+					RDCERR("Error saving EXR file %d: '%s'", ret, err);
+			}
+
+			delete[] fldata;
+		}
+
+		FileIO::fclose(f);
+	}
+
+	for(size_t i=0; i < subdata.size(); i++)
+		delete[] subdata[i];
+	subdata.clear();
+
+	return success;
+}
+
+// encodes and writes fetched textures from a separate thread, so that reading back the next
+// texture from the GPU overlaps with encoding and writing out the last one.
+class TextureSaveWriter
+{
+	public:
+		TextureSaveWriter(uint32_t numJobs, float *progress)
+			: m_NumJobs(numJobs), m_Completed(0), m_Progress(progress), m_Done(false)
+		{
+			m_Thread = Threading::CreateThread(&TextureSaveWriter::WriteThread, this);
+		}
+
+		~TextureSaveWriter()
+		{
+			Finish();
+		}
+
+		// takes ownership of pending. Waits while a couple of textures are already pending, so
+		// only those are ever held in memory.
+		void Queue(PendingTextureSave *pending, TextureSaveJob *job)
+		{
+			if(m_Thread == 0)
+			{
+				Write(pending, job);
+				return;
+			}
+
+			while(true)
+			{
+				{
+					SCOPED_LOCK(m_Lock);
+					if(m_Queue.size() < MaxPending)
+					{
+						m_Queue.push_back(std::make_pair(pending, job));
+						return;
+					}
+				}
+
+				Threading::Sleep(1);
+			}
+		}
+
+		// marks a job as finished without anything to write, e.g. if it failed to fetch
+		void Complete(TextureSaveJob *job, bool success)
+		{
+			job->success = success;
+
+			SCOPED_LOCK(m_Lock);
+			m_Completed++;
+			if(m_Progress)
+				*m_Progress = float(m_Completed)/float(m_NumJobs);
+		}
+
+		// waits for everything queued to be written
+		void Finish()
+		{
+			if(m_Thread)
+			{
+				m_Done = true;
+				Threading::JoinThread(m_Thread);
+				Threading::CloseThread(m_Thread);
+				m_Thread = 0;
+			}
+		}
+
+	private:
+		static const size_t MaxPending = 2;
+
+		void Write(PendingTextureSave *pending, TextureSaveJob *job)
+		{
+			bool success = ReplayRenderer::WriteTextureSave(*pending);
+			delete pending;
+
+			Complete(job, success);
+		}
+
+		static void WriteThread(void *param)
+		{
+			TextureSaveWriter *writer = (TextureSaveWriter *)param;
+
+			while(true)
+			{
+				// check this before looking at the queue, so that anything queued before Finish()
+				// is always written
+				bool done = writer->m_Done;
+
+				pair<PendingTextureSave *, TextureSaveJob *> item(NULL, NULL);
+
+				{
+					SCOPED_LOCK(writer->m_Lock);
+					if(!writer->m_Queue.empty())
+					{
+						item = writer->m_Queue.front();
+						writer->m_Queue.pop_front();
+					}
+				}
+
+				if(item.first)
+				{
+					writer->Write(item.first, item.second);
+					continue;
+				}
+
+				if(done)
+					break;
+
+				Threading::Sleep(1);
+			}
+		}
+
+		uint32_t m_NumJobs;
+		uint32_t m_Completed;
+		float *m_Progress;
 
-			char *jpgdst = new char[len];
+		Threading::ThreadHandle m_Thread;
 
-			success = jpge::compress_image_to_jpeg_file_in_memory(jpgdst, len, td.width, td.height, numComps, subdata[0], p);
+		Threading::CriticalSection m_Lock;
+		std::deque< pair<PendingTextureSave *, TextureSaveJob *> > m_Queue;
 
-			if(success)
-				fwrite(jpgdst, 1, len, f);
+		volatile bool m_Done;
+};
 
-			delete[] jpgdst;
-		}
-		else if(sd.destType == eFileType_HDR || sd.destType == eFileType_EXR)
-		{
-			float *fldata = new float[td.width*td.height*4];
+// orders jobs by the point in the frame they need to be replayed to
+struct JobEventOrder
+{
+	JobEventOrder(const TextureSaveJob *j) : jobs(j) {}
+	const TextureSaveJob *jobs;
 
-			byte *srcData = subdata[0];
-			
-			for(uint32_t y=0; y < td.height; y++)
-			{
-				for(uint32_t x=0; x < td.width; x++)
-				{
-					float r = 0.0f;
-					float g = 0.0f;
-					float b = 0.0f;
-					float a = 1.0f;
+	bool operator() (uint32_t a, uint32_t b) const
+	{
+		if(jobs[a].frameID != jobs[b].frameID)
+			return jobs[a].frameID < jobs[b].frameID;
+		return jobs[a].eventID < jobs[b].eventID;
+	}
+};
 
-					if(td.format.special && td.format.specialFormat == eSpecial_R10G10B10A2)
-					{
-						uint32_t *u32 = (uint32_t *)srcData;
+bool ReplayRenderer::SaveTextures(TextureSaveJob *jobs, uint32_t numJobs, float *progress)
+{
+	if(progress)
+		*progress = 0.0f;
 
-						Vec4f vec = ConvertFromR10G10B10A2(*u32);
+	if(jobs == NULL || numJobs == 0)
+		return true;
 
-						r = vec.x;
-						g = vec.y;
-						b = vec.z;
-						a = vec.w;
+	// replay through the frame once in event order rather than the order jobs were given in
+	vector<uint32_t> order;
+	order.reserve(numJobs);
+	for(uint32_t i=0; i < numJobs; i++)
+		order.push_back(i);
 
-						srcData += 4;
-					}
-					else if(td.format.special && td.format.specialFormat == eSpecial_R11G11B10)
-					{
-						uint32_t *u32 = (uint32_t *)srcData;
+	std::stable_sort(order.begin(), order.end(), JobEventOrder(jobs));
 
-						Vec3f vec = ConvertFromR11G11B10(*u32);
+	TextureSaveWriter writer(numJobs, progress);
 
-						r = vec.x;
-						g = vec.y;
-						b = vec.z;
-						a = 1.0f;
+	uint32_t curFrame = ~0U;
+	uint32_t curEvent = ~0U;
 
-						srcData += 4;
-					}
-					else
-					{
-						if(td.format.compCount >= 1)
-							r = ConvertComponent(td.format, srcData + td.format.compByteWidth*0);
-						if(td.format.compCount >= 2)
-							g = ConvertComponent(td.format, srcData + td.format.compByteWidth*1);
-						if(td.format.compCount >= 3)
-							b = ConvertComponent(td.format, srcData + td.format.compByteWidth*2);
-						if(td.format.compCount >= 4)
-							a = ConvertComponent(td.format, srcData + td.format.compByteWidth*3);
-
-						srcData += td.format.compCount * td.format.compByteWidth;
-					}
+	for(size_t i=0; i < order.size(); i++)
+	{
+		TextureSaveJob &job = jobs[order[i]];
 
-					// HDR can't represent negative values
-					if(sd.destType == eFileType_HDR)
-					{
-						r = RDCMAX(r, 0.0f);
-						g = RDCMAX(g, 0.0f);
-						b = RDCMAX(b, 0.0f);
-						a = RDCMAX(a, 0.0f);
-					}
+		// only the replay is needed here, the pipeline state and outputs are left at the
+		// current event and the replay is restored to it below.
+		if(job.frameID != curFrame || job.eventID != curEvent)
+		{
+			curFrame = job.frameID;
+			curEvent = job.eventID;
 
-					fldata[(y*td.width + x) * 4 + 0] = r;
-					fldata[(y*td.width + x) * 4 + 1] = g;
-					fldata[(y*td.width + x) * 4 + 2] = b;
-					fldata[(y*td.width + x) * 4 + 3] = a;
-				}
-			}
+			m_pDevice->ReplayLog(curFrame, 0, curEvent, eReplay_WithoutDrawIncremental);
+			m_pDevice->ReplayLog(curFrame, 0, curEvent, eReplay_OnlyDraw);
+		}
 
-			if(sd.destType == eFileType_HDR)
-			{
-				int ret = stbi_write_hdr_to_file(f, td.width, td.height, 4, fldata);
-				success = (ret != 0);
-			}
-			else if(sd.destType == eFileType_EXR)
-			{
-				const char *err = NULL;
-				int ret = SaveEXRFP(fldata, (int)td.width, (int)td.height, f, &err);
-				success = (ret == 0);
-				if(!success)
-					RDCERR("Error saving EXR file %d: '%s'", ret, err);
-			}
+		PendingTextureSave *pending = NULL;
 
-			delete[] fldata;
+		if(job.path == NULL || !FetchTextureSave(job.save, job.path, &pending))
+		{
+			RDCERR("Failed to fetch texture %llu at event %u for saving", job.save.id, job.eventID);
+			writer.Complete(&job, false);
+		}
+		else if(pending == NULL)
+		{
+			// DDS files are written out while fetching
+			writer.Complete(&job, true);
 		}
+		else
+		{
+			writer.Queue(pending, &job);
+		}
+	}
 
-		FileIO::fclose(f);
+	writer.Finish();
+
+	if(curFrame != m_FrameID || curEvent != m_EventID)
+	{
+		m_pDevice->ReplayLog(m_FrameID, 0, m_EventID, eReplay_WithoutDrawIncremental);
+		m_pDevice->ReplayLog(m_FrameID, 0, m_EventID, eReplay_OnlyDraw);
 	}
 
-	for(size_t i=0; i < subdata.size(); i++)
-		delete[] subdata[i];
+	bool success = true;
+	for(uint32_t i=0; i < numJobs; i++)
+		success &= (jobs[i].success != 0);
 
 	return success;
 }
 
-bool ReplayRenderer::PixelHistory(ResourceId target, uint32_t x, uint32_t y, uint32_t sampleIdx, rdctype::array<PixelModification> *history)
+void ReplayRenderer::GetPixelHistoryEvents(ResourceId target, uint32_t &sampleIdx, uint32_t &width, uint32_t &height, vector<EventUsage> &events)
 {
-	bool outofbounds = false;
+	width = height = ~0U;
+
+	FetchResourceLists();
 	
 	for(size_t t=0; t < m_Textures.size(); t++)
 	{
 		if(m_Textures[t].ID == target)
 		{
-			if(x >= m_Textures[t].width || y >= m_Textures[t].height)
-			{
-				RDCDEBUG("PixelHistory out of bounds on %llx (%u,%u) vs (%u,%u)", target, x, y, m_Textures[t].width, m_Textures[t].height);
-				history->count = 0;
-				history->elems = NULL;
-				return false;
-			}
+			width = m_Textures[t].width;
+			height = m_Textures[t].height;
 
 			if(m_Textures[t].msSamp == 1)
 				sampleIdx = ~0U;
@@ -1129,8 +2141,6 @@ bool ReplayRenderer::PixelHistory(ResourceId target, uint32_t x, uint32_t y, uin
 
 	auto usage = m_pDevice->GetUsage(m_pDevice->GetLiveID(target));
 
-	vector<EventUsage> events;
-
 	for(size_t i=0; i < usage.size(); i++)
 	{
 		if(usage[i].eventID > m_EventID)
@@ -1179,6 +2189,61 @@ bool ReplayRenderer::PixelHistory(ResourceId target, uint32_t x, uint32_t y, uin
 
 		events.push_back(usage[i]);
 	}
+}
+
+bool ReplayRenderer::ReplayLoop(uint32_t frameID, uint32_t loops, ReplayOutput *output, float *progress)
+{
+	if(frameID >= (uint32_t)m_FrameRecord.size())
+		return false;
+
+	const vector<int32_t> &eventRow = m_FrameRecord[frameID].m_Flat.eventRow;
+
+	if(eventRow.empty())
+		return false;
+
+	uint32_t lastEvent = (uint32_t)eventRow.size()-1;
+
+	for(uint32_t i=0; i < loops; i++)
+	{
+		// a full replay from the start applies the initial contents, which the drivers keep as
+		// GPU-side copies, and never starts from a replay checkpoint.
+		m_pDevice->ReplayLog(frameID, 0, lastEvent, eReplay_Full);
+
+		if(output)
+		{
+			output->m_MainOutput.dirty = true;
+			output->Display();
+		}
+
+		if(progress)
+			*progress = float(i+1)/float(loops);
+	}
+
+	// the last loop leaves the replay at the end of the frame, so unless that's already the
+	// selected event, go back to it.
+	if(loops > 0 && (m_FrameID != frameID || m_EventID < lastEvent))
+	{
+		m_pDevice->ReplayLog(m_FrameID, 0, m_EventID, eReplay_WithoutDraw);
+		m_pDevice->ReplayLog(m_FrameID, 0, m_EventID, eReplay_OnlyDraw);
+	}
+
+	return true;
+}
+
+bool ReplayRenderer::PixelHistory(ResourceId target, uint32_t x, uint32_t y, uint32_t sampleIdx, rdctype::array<PixelModification> *history)
+{
+	uint32_t width = 0, height = 0;
+	vector<EventUsage> events;
+
+	GetPixelHistoryEvents(target, sampleIdx, width, height, events);
+
+	if(x >= width || y >= height)
+	{
+		RDCDEBUG("PixelHistory out of bounds on %llx (%u,%u) vs (%u,%u)", target, x, y, width, height);
+		history->count = 0;
+		history->elems = NULL;
+		return false;
+	}
 	
 	if(events.empty())
 	{
@@ -1188,7 +2253,54 @@ bool ReplayRenderer::PixelHistory(ResourceId target, uint32_t x, uint32_t y, uin
 		return false;
 	}
 
-	*history = m_pDevice->PixelHistory(m_FrameID, events, m_pDevice->GetLiveID(target), x, y, sampleIdx);
+	vector<PixelModification> ret = m_pDevice->PixelHistory(m_FrameID, events, m_pDevice->GetLiveID(target), x, y, sampleIdx);
+
+	{
+		ResultArenaScope arena;
+		*history = ret;
+	}
+	
+	SetFrameEvent(m_FrameID, m_EventID, true);
+
+	return true;
+}
+
+bool ReplayRenderer::PixelHistoryBatch(ResourceId target, uint32_t *coords, uint32_t numPixels, uint32_t sampleIdx,
+                                       rdctype::array< rdctype::array<PixelModification> > *histories)
+{
+	if(histories == NULL || (numPixels > 0 && coords == NULL))
+		return false;
+
+	create_array(*histories, numPixels);
+
+	uint32_t width = 0, height = 0;
+	vector<EventUsage> events;
+
+	// the candidate events only depend on the target, so they're worked out once for
+	// every pixel, and the replay is only restored to the current event at the end
+	GetPixelHistoryEvents(target, sampleIdx, width, height, events);
+
+	if(events.empty())
+	{
+		RDCDEBUG("Target %llx not written to before %u", target, m_EventID);
+		return false;
+	}
+
+	ResourceId liveID = m_pDevice->GetLiveID(target);
+
+	for(uint32_t i=0; i < numPixels; i++)
+	{
+		uint32_t x = coords[i*2 + 0];
+		uint32_t y = coords[i*2 + 1];
+
+		if(x >= width || y >= height)
+		{
+			RDCDEBUG("PixelHistory out of bounds on %llx (%u,%u) vs (%u,%u)", target, x, y, width, height);
+			continue;
+		}
+
+		(*histories)[i] = m_pDevice->PixelHistory(m_FrameID, events, liveID, x, y, sampleIdx);
+	}
 	
 	SetFrameEvent(m_FrameID, m_EventID, true);
 
@@ -1199,7 +2311,12 @@ bool ReplayRenderer::DebugVertex(uint32_t vertid, uint32_t instid, uint32_t idx,
 {
 	if(trace == NULL) return false;
 
-	*trace = m_pDevice->DebugVertex(m_FrameID, m_EventID, vertid, instid, idx, instOffset, vertOffset);
+	ShaderDebugTrace ret = m_pDevice->DebugVertex(m_FrameID, m_EventID, vertid, instid, idx, instOffset, vertOffset);
+
+	{
+		ResultArenaScope arena;
+		*trace = ret;
+	}
 
 	SetFrameEvent(m_FrameID, m_EventID, true);
 
@@ -1210,7 +2327,12 @@ bool ReplayRenderer::DebugPixel(uint32_t x, uint32_t y, uint32_t sample, uint32_
 {
 	if(trace == NULL) return false;
 
-	*trace = m_pDevice->DebugPixel(m_FrameID, m_EventID, x, y, sample, primitive);
+	ShaderDebugTrace ret = m_pDevice->DebugPixel(m_FrameID, m_EventID, x, y, sample, primitive);
+
+	{
+		ResultArenaScope arena;
+		*trace = ret;
+	}
 	
 	SetFrameEvent(m_FrameID, m_EventID, true);
 
@@ -1221,7 +2343,12 @@ bool ReplayRenderer::DebugThread(uint32_t groupid[3], uint32_t threadid[3], Shad
 {
 	if(trace == NULL) return false;
 
-	*trace = m_pDevice->DebugThread(m_FrameID, m_EventID, groupid, threadid);
+	ShaderDebugTrace ret = m_pDevice->DebugThread(m_FrameID, m_EventID, groupid, threadid);
+
+	{
+		ResultArenaScope arena;
+		*trace = ret;
+	}
 	
 	SetFrameEvent(m_FrameID, m_EventID, true);
 
@@ -1240,6 +2367,7 @@ bool ReplayRenderer::GetCBufferVariableContents(ResourceId shader, uint32_t cbuf
 
 	m_pDevice->FillCBufferVariables(m_pDevice->GetLiveID(shader), cbufslot, v, data);
 
+	ResultArenaScope arena;
 	*vars = v;
 
 	return true;
@@ -1313,16 +2441,91 @@ ResourceId ReplayRenderer::BuildCustomShader(const char *entry, const char *sour
 			return ResourceId();
 	}
 
+	string key = StringFormat::Fmt("%d %u %s\n", (int)type, compileFlags, entry ? entry : "");
+	if(source) key += source;
+
+	auto it = m_CustomShaderBuilds.find(key);
+	if(it != m_CustomShaderBuilds.end())
+	{
+		it->second.lastUse = ++m_CustomShaderUse;
+		if(it->second.id != ResourceId())
+			it->second.refs++;
+
+		if(errors) *errors = it->second.errors;
+
+		return it->second.id;
+	}
+
 	m_pDevice->BuildCustomShader(source, entry, compileFlags, type, &id, &errs);
 
+	CustomShaderBuild &build = m_CustomShaderBuilds[key];
+	build.id = id;
+	build.errors = errs;
+	build.refs = (id != ResourceId()) ? 1 : 0;
+	build.lastUse = ++m_CustomShaderUse;
+
 	if(id != ResourceId())
-		m_CustomShaders.insert(id);
+		m_CustomShaderKeys[id] = key;
+
+	TrimCustomShaderBuilds();
 	
 	if(errors) *errors = errs;
 
 	return id;
 }
 
+void ReplayRenderer::TrimCustomShaderBuilds()
+{
+	for(;;)
+	{
+		size_t unused = 0;
+		auto oldest = m_CustomShaderBuilds.end();
+
+		for(auto it=m_CustomShaderBuilds.begin(); it != m_CustomShaderBuilds.end(); ++it)
+		{
+			if(it->second.refs > 0)
+				continue;
+
+			unused++;
+			if(oldest == m_CustomShaderBuilds.end() || it->second.lastUse < oldest->second.lastUse)
+				oldest = it;
+		}
+
+		if(unused <= UnusedCustomShaderCount)
+			return;
+
+		if(oldest->second.id != ResourceId())
+		{
+			m_pDevice->FreeCustomShader(oldest->second.id);
+			m_CustomShaderKeys.erase(oldest->second.id);
+
+			if(m_LastCustomShaderOutput.shader == oldest->second.id)
+				m_LastCustomShaderOutput = CustomShaderOutput();
+		}
+
+		m_CustomShaderBuilds.erase(oldest);
+	}
+}
+
+ResourceId ReplayRenderer::ApplyCustomShader(ResourceId shader, ResourceId texid, uint32_t mip)
+{
+	CustomShaderOutput &last = m_LastCustomShaderOutput;
+
+	if(last.result != ResourceId() && last.shader == shader && last.texid == texid && last.mip == mip &&
+		 last.frameID == m_FrameID && last.eventID == m_EventID && last.lastDeferredEvent == m_LastDeferredEvent)
+		return last.result;
+
+	last.shader = shader;
+	last.texid = texid;
+	last.mip = mip;
+	last.frameID = m_FrameID;
+	last.eventID = m_EventID;
+	last.lastDeferredEvent = m_LastDeferredEvent;
+	last.result = m_pDevice->ApplyCustomShader(shader, texid, mip);
+
+	return last.result;
+}
+
 bool ReplayRenderer::FreeTargetResource(ResourceId id)
 {
 	m_TargetResources.erase(id);
@@ -1333,8 +2536,22 @@ bool ReplayRenderer::FreeTargetResource(ResourceId id)
 
 bool ReplayRenderer::FreeCustomShader(ResourceId id)
 {
-	m_CustomShaders.erase(id);
-	m_pDevice->FreeCustomShader(id);
+	auto key = m_CustomShaderKeys.find(id);
+
+	// not one of ours, free it directly
+	if(key == m_CustomShaderKeys.end())
+	{
+		m_pDevice->FreeCustomShader(id);
+		return true;
+	}
+
+	CustomShaderBuild &build = m_CustomShaderBuilds[key->second];
+
+	// the shader stays alive while it's cached, in case the same source is built again
+	if(build.refs > 0)
+		build.refs--;
+
+	TrimCustomShaderBuilds();
 
 	return true;
 }
@@ -1343,6 +2560,12 @@ bool ReplayRenderer::ReplaceResource(ResourceId from, ResourceId to)
 {
 	m_pDevice->ReplaceResource(from, to);
 
+	m_ReplacedResources.insert(from);
+
+	// shader details are looked up through replacements
+	if(m_ResourceGeneration != 0)
+		m_ResourceGeneration++;
+
 	SetFrameEvent(m_FrameID, m_EventID, true);
 	
 	for(size_t i=0; i < m_Outputs.size(); i++)
@@ -1356,6 +2579,12 @@ bool ReplayRenderer::RemoveReplacement(ResourceId id)
 {
 	m_pDevice->RemoveReplacement(id);
 
+	m_ReplacedResources.erase(id);
+
+	// shader details are looked up through replacements
+	if(m_ResourceGeneration != 0)
+		m_ResourceGeneration++;
+
 	SetFrameEvent(m_FrameID, m_EventID, true);
 	
 	for(size_t i=0; i < m_Outputs.size(); i++)
@@ -1385,6 +2614,7 @@ ReplayCreateStatus ReplayRenderer::CreateDevice(const char *logfile)
 	if(driver && status == eReplayCreate_Success)
 	{
 		RDCLOG("Created replay driver.");
+		m_Logfile = logfile;
 		return PostCreateInit(driver);
 	}
 	
@@ -1422,6 +2652,9 @@ ReplayCreateStatus ReplayRenderer::PostCreateInit(IReplayDriver *device)
 		m_FrameRecord.back().m_DrawCallList = fr[i].drawcallList;
 		
 		SetupDrawcallPointers(fr[i].frameInfo, m_FrameRecord.back().m_DrawCallList, NULL, NULL);
+
+		map<string, uint32_t> nameOffsets;
+		FlattenDrawcalls(m_FrameRecord.back(), m_FrameRecord.back().m_DrawCallList, -1, nameOffsets);
 	}
 
 	return eReplayCreate_Success;
@@ -1462,6 +2695,155 @@ FetchDrawcall *ReplayRenderer::SetupDrawcallPointers(FetchFrameInfo frame, rdcty
 	return ret;
 }
 
+void ReplayRenderer::FlattenDrawcalls(FrameRecord &frame, rdctype::array<FetchDrawcall> &draws, int32_t parentRow, map<string, uint32_t> &nameOffsets)
+{
+	FrameRecord::FlatDrawcalls &flat = frame.m_Flat;
+
+	int32_t prevRow = -1;
+
+	for(int32_t i=0; i < draws.count; i++)
+	{
+		FetchDrawcall *draw = &draws[i];
+		int32_t row = (int32_t)flat.draw.size();
+
+		string name(draw->name.elems ? draw->name.elems : "", draw->name.count);
+
+		auto it = nameOffsets.find(name);
+		if(it == nameOffsets.end())
+		{
+			it = nameOffsets.insert(std::make_pair(name, (uint32_t)flat.names.size())).first;
+			flat.names.insert(flat.names.end(), name.c_str(), name.c_str()+name.size()+1);
+		}
+
+		flat.draw.push_back(draw);
+		flat.parent.push_back(parentRow);
+		flat.firstChild.push_back(-1);
+		flat.nextSibling.push_back(-1);
+		flat.nameOffset.push_back(it->second);
+
+		if(prevRow >= 0)
+			flat.nextSibling[prevRow] = row;
+		else if(parentRow >= 0)
+			flat.firstChild[parentRow] = row;
+		prevRow = row;
+
+		if(draw->eventID >= flat.eventRow.size())
+			flat.eventRow.resize(draw->eventID+1, -1);
+		// markers can share an event ID with the drawcall after them, keep the first
+		if(flat.eventRow[draw->eventID] < 0)
+			flat.eventRow[draw->eventID] = row;
+
+		FlattenDrawcalls(frame, draw->children, row, nameOffsets);
+	}
+}
+
+bool ReplayRenderer::GetDrawcallCount(uint32_t frameID, uint32_t *count)
+{
+	if(frameID >= (uint32_t)m_FrameRecord.size() || count == NULL)
+		return false;
+
+	*count = (uint32_t)m_FrameRecord[frameID].m_Flat.draw.size();
+	return true;
+}
+
+bool ReplayRenderer::GetDrawcallTable(uint32_t frameID, uint32_t firstRow, uint32_t numRows, FetchDrawcallTable *table)
+{
+	if(frameID >= (uint32_t)m_FrameRecord.size() || table == NULL)
+		return false;
+
+	const FrameRecord::FlatDrawcalls &flat = m_FrameRecord[frameID].m_Flat;
+
+	uint32_t total = (uint32_t)flat.draw.size();
+	firstRow = RDCMIN(firstRow, total);
+	numRows = RDCMIN(numRows, total-firstRow);
+
+	table->firstRow = firstRow;
+
+	ResultArenaScope arena;
+
+	create_array_uninit(table->eventID, numRows);
+	create_array_uninit(table->drawcallID, numRows);
+	create_array_uninit(table->flags, numRows);
+	create_array_uninit(table->parent, numRows);
+	create_array_uninit(table->firstChild, numRows);
+	create_array_uninit(table->nextSibling, numRows);
+	create_array_uninit(table->nameOffset, numRows);
+
+	// only the names this page uses are returned, so offsets are remapped into a page pool
+	vector<char> names;
+	map<uint32_t, uint32_t> remap;
+
+	for(uint32_t i=0; i < numRows; i++)
+	{
+		uint32_t row = firstRow+i;
+		const FetchDrawcall *draw = flat.draw[row];
+
+		table->eventID[i] = draw->eventID;
+		table->drawcallID[i] = draw->drawcallID;
+		table->flags[i] = draw->flags;
+		table->parent[i] = flat.parent[row];
+		table->firstChild[i] = flat.firstChild[row];
+		table->nextSibling[i] = flat.nextSibling[row];
+
+		auto it = remap.find(flat.nameOffset[row]);
+		if(it == remap.end())
+		{
+			it = remap.insert(std::make_pair(flat.nameOffset[row], (uint32_t)names.size())).first;
+
+			const char *name = &flat.names[flat.nameOffset[row]];
+			names.insert(names.end(), name, name+strlen(name)+1);
+		}
+
+		table->nameOffset[i] = it->second;
+	}
+
+	table->names = names;
+
+	return true;
+}
+
+bool ReplayRenderer::FindDrawcallRow(uint32_t frameID, uint32_t eventID, int32_t *row)
+{
+	if(frameID >= (uint32_t)m_FrameRecord.size() || row == NULL)
+		return false;
+
+	const FrameRecord::FlatDrawcalls &flat = m_FrameRecord[frameID].m_Flat;
+
+	if(eventID >= flat.eventRow.size() || flat.eventRow[eventID] < 0)
+		return false;
+
+	*row = flat.eventRow[eventID];
+	return true;
+}
+
+bool ReplayRenderer::GetDrawcall(uint32_t frameID, uint32_t row, FetchDrawcall *draw)
+{
+	if(frameID >= (uint32_t)m_FrameRecord.size() || draw == NULL)
+		return false;
+
+	const FrameRecord::FlatDrawcalls &flat = m_FrameRecord[frameID].m_Flat;
+
+	if(row >= flat.draw.size())
+		return false;
+
+	// detach the children while copying, so a marker doesn't drag its whole subtree along
+	rdctype::array<FetchDrawcall> &children = flat.draw[row]->children;
+	FetchDrawcall *elems = children.elems;
+	int32_t count = children.count;
+	children.elems = NULL;
+	children.count = 0;
+
+	{
+		ResultArenaScope arena;
+		*draw = *flat.draw[row];
+	}
+
+	children.elems = elems;
+	children.count = count;
+
+	return true;
+}
+
 bool ReplayRenderer::HasCallstacks()
 {
 	return m_pDevice->HasCallstacks();
@@ -1500,6 +2882,37 @@ void ReplayRenderer::FetchPipelineState()
 	}
 }
 
+bool ReplayRenderer::FetchCachedPipelineState(uint32_t frameID, uint32_t eventID)
+{
+	for(auto it = m_PipelineStateCache.begin(); it != m_PipelineStateCache.end(); ++it)
+	{
+		if(it->frameID == frameID && it->eventID == eventID)
+		{
+			m_D3D11PipelineState = it->d3d11;
+			m_GLPipelineState = it->gl;
+
+			m_PipelineStateCache.splice(m_PipelineStateCache.begin(), m_PipelineStateCache, it);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ReplayRenderer::CachePipelineState(uint32_t frameID, uint32_t eventID)
+{
+	m_PipelineStateCache.push_front(CachedPipelineState());
+
+	CachedPipelineState &cached = m_PipelineStateCache.front();
+	cached.frameID = frameID;
+	cached.eventID = eventID;
+	cached.d3d11 = m_D3D11PipelineState;
+	cached.gl = m_GLPipelineState;
+
+	if(m_PipelineStateCache.size() > PipelineStateCacheSize)
+		m_PipelineStateCache.pop_back();
+}
+
 extern "C" RENDERDOC_API void RENDERDOC_CC ReplayRenderer_GetAPIProperties(ReplayRenderer *rend, APIProperties *props)
 { if(props) *props = rend->GetAPIProperties(); }
 
@@ -1519,10 +2932,17 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SetContextFilter(Rep
 { return rend->SetContextFilter(id, firstDefEv, lastDefEv); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SetFrameEvent(ReplayRenderer *rend, uint32_t frameID, uint32_t eventID)
 { return rend->SetFrameEvent(frameID, eventID); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SetScrubbing(ReplayRenderer *rend, bool32 scrubbing)
+{ return rend->SetScrubbing(scrubbing != 0); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetD3D11PipelineState(ReplayRenderer *rend, D3D11PipelineState *state)
 { return rend->GetD3D11PipelineState(state); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetGLPipelineState(ReplayRenderer *rend, GLPipelineState *state)
 { return rend->GetGLPipelineState(state); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FetchEventBatch(ReplayRenderer *rend, uint32_t frameID, uint32_t *eventIDs, uint32_t numEvents,
+                                                                            ResourceId *textures, uint32_t numTextures, uint32_t arrayIdx, uint32_t mip,
+                                                                            rdctype::array<D3D11PipelineState> *d3d11, rdctype::array<GLPipelineState> *gl,
+                                                                            rdctype::array< rdctype::array<byte> > *textureData)
+{ return rend->FetchEventBatch(frameID, eventIDs, numEvents, textures, numTextures, arrayIdx, mip, d3d11, gl, textureData); }
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_BuildCustomShader(ReplayRenderer *rend, const char *entry, const char *source, const uint32_t compileFlags, ShaderStageType type, ResourceId *shaderID, rdctype::str *errors)
 {
@@ -1554,8 +2974,16 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetFrameInfo(ReplayR
 { return rend->GetFrameInfo(frame); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDrawcalls(ReplayRenderer *rend, uint32_t frameID, rdctype::array<FetchDrawcall> *draws)
 { return rend->GetDrawcalls(frameID, draws); }
-extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FetchCounters(ReplayRenderer *rend, uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, uint32_t *counters, uint32_t numCounters, rdctype::array<CounterResult> *results)
-{ return rend->FetchCounters(frameID, minEventID, maxEventID, counters, numCounters, results); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDrawcallCount(ReplayRenderer *rend, uint32_t frameID, uint32_t *count)
+{ return rend->GetDrawcallCount(frameID, count); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDrawcallTable(ReplayRenderer *rend, uint32_t frameID, uint32_t firstRow, uint32_t numRows, FetchDrawcallTable *table)
+{ return rend->GetDrawcallTable(frameID, firstRow, numRows, table); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FindDrawcallRow(ReplayRenderer *rend, uint32_t frameID, uint32_t eventID, int32_t *row)
+{ return rend->FindDrawcallRow(frameID, eventID, row); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDrawcall(ReplayRenderer *rend, uint32_t frameID, uint32_t row, FetchDrawcall *draw)
+{ return rend->GetDrawcall(frameID, row, draw); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_FetchCounters(ReplayRenderer *rend, uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, uint32_t *counters, uint32_t numCounters, uint32_t numRuns, rdctype::array<CounterResult> *results)
+{ return rend->FetchCounters(frameID, minEventID, maxEventID, counters, numCounters, numRuns, results); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_EnumerateCounters(ReplayRenderer *rend, rdctype::array<uint32_t> *counters)
 { return rend->EnumerateCounters(counters); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_DescribeCounter(ReplayRenderer *rend, uint32_t counterID, CounterDescription *desc)
@@ -1564,6 +2992,8 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetTextures(ReplayRe
 { return rend->GetTextures(texs); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetBuffers(ReplayRenderer *rend, rdctype::array<FetchBuffer> *bufs)
 { return rend->GetBuffers(bufs); }
+extern "C" RENDERDOC_API uint32_t RENDERDOC_CC ReplayRenderer_GetResourceGeneration(ReplayRenderer *rend)
+{ return rend->GetResourceGeneration(); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetResolve(ReplayRenderer *rend, uint64_t *callstack, uint32_t callstackLen, rdctype::array<rdctype::str> *trace)
 { return rend->GetResolve(callstack, callstackLen, trace); }
 extern "C" RENDERDOC_API ShaderReflection* RENDERDOC_CC ReplayRenderer_GetShaderDetails(ReplayRenderer *rend, ResourceId shader)
@@ -1573,6 +3003,9 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetDebugMessages(Rep
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_PixelHistory(ReplayRenderer *rend, ResourceId target, uint32_t x, uint32_t y, uint32_t sampleIdx, rdctype::array<PixelModification> *history)
 { return rend->PixelHistory(target, x, y, sampleIdx, history); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_PixelHistoryBatch(ReplayRenderer *rend, ResourceId target, uint32_t *coords, uint32_t numPixels, uint32_t sampleIdx,
+                                                                              rdctype::array< rdctype::array<PixelModification> > *histories)
+{ return rend->PixelHistoryBatch(target, coords, numPixels, sampleIdx, histories); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_DebugVertex(ReplayRenderer *rend, uint32_t vertid, uint32_t instid, uint32_t idx, uint32_t instOffset, uint32_t vertOffset, ShaderDebugTrace *trace)
 { return rend->DebugVertex(vertid, instid, idx, instOffset, vertOffset, trace); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_DebugPixel(ReplayRenderer *rend, uint32_t x, uint32_t y, uint32_t sample, uint32_t primitive, ShaderDebugTrace *trace)
@@ -1588,6 +3021,10 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetCBufferVariableCo
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SaveTexture(ReplayRenderer *rend, const TextureSave &saveData, const char *path)
 { return rend->SaveTexture(saveData, path); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_SaveTextures(ReplayRenderer *rend, TextureSaveJob *jobs, uint32_t numJobs, float *progress)
+{ return rend->SaveTextures(jobs, numJobs, progress); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_ReplayLoop(ReplayRenderer *rend, uint32_t frameID, uint32_t loops, ReplayOutput *output, float *progress)
+{ return rend->ReplayLoop(frameID, loops, output, progress); }
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetPostVSData(ReplayRenderer *rend, uint32_t instID, MeshDataStage stage, MeshFormat *data)
 { return rend->GetPostVSData(instID, stage, data); }
@@ -1602,6 +3039,11 @@ extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetHistogram(ReplayR
 
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetBufferData(ReplayRenderer *rend, ResourceId buff, uint32_t offset, uint32_t len, rdctype::array<byte> *data)
 { return rend->GetBufferData(buff, offset, len, data); }
-
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetBufferDataStrided(ReplayRenderer *rend, ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows, rdctype::array<byte> *data)
+{ return rend->GetBufferDataStrided(buff, offset, stride, rowSize, numRows, data); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetBufferElements(ReplayRenderer *rend, ResourceId buff, uint32_t offset, uint32_t stride, uint32_t numRows, const BufferElement *elements, uint32_t numElements, rdctype::array<ShaderVariable> *vars)
+{ return rend->GetBufferElements(buff, offset, stride, numRows, elements, numElements, vars); }
 extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetTextureData(ReplayRenderer *rend, ResourceId tex, uint32_t arrayIdx, uint32_t mip, rdctype::array<byte> *data)
 { return rend->GetTextureData(tex, arrayIdx, mip, data); }
+extern "C" RENDERDOC_API bool32 RENDERDOC_CC ReplayRenderer_GetTextureDataRegion(ReplayRenderer *rend, ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, rdctype::array<byte> *data)
+{ return rend->GetTextureDataRegion(tex, arrayIdx, mip, x, y, width, height, data); }
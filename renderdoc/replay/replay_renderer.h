@@ -32,10 +32,16 @@
 
 #include <vector>
 #include <set>
+#include <list>
+#include <map>
 
 #include "type_helpers.h"
 
 struct ReplayRenderer;
+struct PendingTextureSave;
+
+// true for any usage that can change a resource's contents
+bool IsWriteUsage(ResourceUsage usage);
 
 struct ReplayOutput
 {
@@ -48,6 +54,7 @@ public:
 	bool AddThumbnail(void *wnd, ResourceId texID);
 
 	bool Display();
+	bool HasPendingThumbnails();
 
 	OutputType GetType() { return m_Config.m_Type; }
 	
@@ -63,10 +70,15 @@ private:
 	~ReplayOutput();
 	
 	void SetFrameEvent(int frameID, int eventID);
+	void SetPreviewEvent();
 	void SetContextFilter(ResourceId id, uint32_t firstDefEv, uint32_t lastDefEv);
 	
 	void RefreshOverlay();
 
+	void InvalidateThumbnails();
+	void FetchThumbnailWrites(size_t i);
+	bool ThumbnailWritten(size_t i, uint32_t fromEvent, uint32_t toEvent);
+
 
 	void DisplayContext();
 	void DisplayTex();
@@ -79,6 +91,10 @@ private:
 
 	bool m_OverlayDirty;
 
+	// the device has been replayed to a different event than m_EventID while scrubbing, so
+	// only the texture is redrawn until the next SetFrameEvent.
+	bool m_Previewing;
+
 	IReplayDriver *m_pDevice;
 
 	uint32_t m_TexWidth, m_TexHeight;
@@ -91,8 +107,16 @@ private:
 		uint64_t outputID;
 
 		bool dirty;
+
+		// events that write to the texture, sorted, so that a thumbnail only needs to be
+		// redrawn when moving past one of them
+		vector<uint32_t> writes;
 	} m_MainOutput;
 
+	// thumbnails are redrawn until this much time has been spent in a Display(), the rest
+	// stay dirty until the next one.
+	static const uint32_t ThumbnailBudgetMS = 10;
+
 	ResourceId m_OverlayResourceId;
 	ResourceId m_CustomShaderResourceId;
 
@@ -139,11 +163,22 @@ struct ReplayRenderer
 		bool SetContextFilter(ResourceId id, uint32_t firstDefEv, uint32_t lastDefEv);
 		bool SetFrameEvent(uint32_t frameID, uint32_t eventID);
 		bool SetFrameEvent(uint32_t frameID, uint32_t eventID, bool force);
+		// while scrubbing, SetFrameEvent only previews the texture displays at the new event
+		// and changes arriving faster than ScrubIntervalMS are coalesced - the last of them
+		// is previewed on the next output Display(). Pipeline state, overlays, meshes and
+		// thumbnails stay at the last event until scrubbing stops, which brings everything up
+		// to date at the last event set.
+		bool SetScrubbing(bool scrubbing);
 
 		void FetchPipelineState();
 
 		bool GetD3D11PipelineState(D3D11PipelineState *state);
 		bool GetGLPipelineState(GLPipelineState *state);
+
+		bool FetchEventBatch(uint32_t frameID, uint32_t *eventIDs, uint32_t numEvents,
+		                     ResourceId *textures, uint32_t numTextures, uint32_t arrayIdx, uint32_t mip,
+		                     rdctype::array<D3D11PipelineState> *d3d11, rdctype::array<GLPipelineState> *gl,
+		                     rdctype::array< rdctype::array<byte> > *textureData);
 		
 		ResourceId BuildCustomShader(const char *entry, const char *source, const uint32_t compileFlags, ShaderStageType type, rdctype::str *errors);
 		bool FreeCustomShader(ResourceId id);
@@ -155,16 +190,31 @@ struct ReplayRenderer
 		
 		bool GetFrameInfo(rdctype::array<FetchFrameInfo> *frame);
 		bool GetDrawcalls(uint32_t frameID, rdctype::array<FetchDrawcall> *draws);
-		bool FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, uint32_t *counters, uint32_t numCounters, rdctype::array<CounterResult> *results);
+		// paged access to the same drawcalls without copying the tree, see FetchDrawcallTable.
+		// Rows past the end are clamped off, and GetDrawcall returns the drawcall's events but
+		// leaves its children empty.
+		bool GetDrawcallCount(uint32_t frameID, uint32_t *count);
+		bool GetDrawcallTable(uint32_t frameID, uint32_t firstRow, uint32_t numRows, FetchDrawcallTable *table);
+		bool FindDrawcallRow(uint32_t frameID, uint32_t eventID, int32_t *row);
+		bool GetDrawcall(uint32_t frameID, uint32_t row, FetchDrawcall *draw);
+		bool FetchCounters(uint32_t frameID, uint32_t minEventID, uint32_t maxEventID, uint32_t *counters, uint32_t numCounters, uint32_t numRuns, rdctype::array<CounterResult> *results);
 		bool EnumerateCounters(rdctype::array<uint32_t> *counters);
 		bool DescribeCounter(uint32_t counterID, CounterDescription *desc);
 		bool GetTextures(rdctype::array<FetchTexture> *texs);
 		bool GetBuffers(rdctype::array<FetchBuffer> *bufs);
+		// the textures, buffers and shader reflection returned above don't change while this
+		// returns the same value, so callers can hold on to what they fetched instead of
+		// marshalling it again.
+		uint32_t GetResourceGeneration();
 		bool GetResolve(uint64_t *callstack, uint32_t callstackLen, rdctype::array<rdctype::str> *trace);
 		ShaderReflection *GetShaderDetails(ResourceId shader);
 		bool GetDebugMessages(rdctype::array<DebugMessage> *msgs);
 		
 		bool PixelHistory(ResourceId target, uint32_t x, uint32_t y, uint32_t sampleIdx, rdctype::array<PixelModification> *history);
+		// coords holds numPixels x,y pairs. histories gets one entry per pixel, empty if the
+		// pixel is out of bounds
+		bool PixelHistoryBatch(ResourceId target, uint32_t *coords, uint32_t numPixels, uint32_t sampleIdx,
+		                       rdctype::array< rdctype::array<PixelModification> > *histories);
 		bool DebugVertex(uint32_t vertid, uint32_t instid, uint32_t idx, uint32_t instOffset, uint32_t vertOffset, ShaderDebugTrace *trace);
 		bool DebugPixel(uint32_t x, uint32_t y, uint32_t sample, uint32_t primitive, ShaderDebugTrace *trace);
 		bool DebugThread(uint32_t groupid[3], uint32_t threadid[3], ShaderDebugTrace *trace);
@@ -177,9 +227,20 @@ struct ReplayRenderer
 		bool GetUsage(ResourceId id, rdctype::array<EventUsage> *usage);
 		
 		bool GetBufferData(ResourceId buff, uint32_t offset, uint32_t len, rdctype::array<byte> *data);
+		bool GetBufferDataStrided(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t rowSize, uint32_t numRows, rdctype::array<byte> *data);
+		bool GetBufferElements(ResourceId buff, uint32_t offset, uint32_t stride, uint32_t numRows, const BufferElement *elements, uint32_t numElements, rdctype::array<ShaderVariable> *vars);
 		bool GetTextureData(ResourceId buff, uint32_t arrayIdx, uint32_t mip, rdctype::array<byte> *data);
+		bool GetTextureDataRegion(ResourceId tex, uint32_t arrayIdx, uint32_t mip, uint32_t x, uint32_t y, uint32_t width, uint32_t height, rdctype::array<byte> *data);
 		
 		bool SaveTexture(const TextureSave &saveData, const char *path);
+		bool SaveTextures(TextureSaveJob *jobs, uint32_t numJobs, float *progress);
+
+		// each loop restores the initial contents and replays the frame to its last drawcall with
+		// no other work in between, so the GPU sees the same workload every time.
+		bool ReplayLoop(uint32_t frameID, uint32_t loops, ReplayOutput *output, float *progress);
+
+		// doesn't need the replay device, so can be run on another thread after fetching
+		static bool WriteTextureSave(PendingTextureSave &pending);
 
 		bool GetCBufferVariableContents(ResourceId shader, uint32_t cbufslot, ResourceId buffer, uint32_t offs, rdctype::array<ShaderVariable> *vars);
 	
@@ -189,15 +250,40 @@ struct ReplayRenderer
 		
 		FetchDrawcall *GetDrawcallByEID(uint32_t eventID, uint32_t defEventID);
 		FetchDrawcall *SetupDrawcallPointers(FetchFrameInfo frame, rdctype::array<FetchDrawcall> &draws, FetchDrawcall *parent, FetchDrawcall *previous);
+
+		// the events before the current one that wrote to target. width and height are ~0U
+		// if target isn't a known texture.
+		void GetPixelHistoryEvents(ResourceId target, uint32_t &sampleIdx, uint32_t &width, uint32_t &height, vector<EventUsage> &events);
 	
 		IReplayDriver *GetDevice() { return m_pDevice; }
+
+		// reads back the texture at the current event. DDS files are written out directly and
+		// pending is left NULL, otherwise the data is returned to be passed to WriteTextureSave.
+		bool FetchTextureSave(const TextureSave &saveData, const char *path, PendingTextureSave **pending);
 		
 		struct FrameRecord
 		{
 			FetchFrameInfo frameInfo;
 
 			rdctype::array<FetchDrawcall> m_DrawCallList;
+
+			// m_DrawCallList flattened in tree order, one entry per row in each vector
+			struct FlatDrawcalls
+			{
+				vector<FetchDrawcall *> draw;
+				vector<int32_t> parent;
+				vector<int32_t> firstChild;
+				vector<int32_t> nextSibling;
+				vector<uint32_t> nameOffset;
+
+				// NUL-terminated names, each distinct name stored once
+				vector<char> names;
+
+				// indexed by event ID, -1 for events that aren't a drawcall
+				vector<int32_t> eventRow;
+			} m_Flat;
 		};
+		void FlattenDrawcalls(FrameRecord &frame, rdctype::array<FetchDrawcall> &draws, int32_t parentRow, map<string, uint32_t> &nameOffsets);
 		vector<FrameRecord> m_FrameRecord;
 		vector<FetchDrawcall*> m_Drawcalls;
 
@@ -210,15 +296,133 @@ struct ReplayRenderer
 		D3D11PipelineState m_D3D11PipelineState;
 		GLPipelineState m_GLPipelineState;
 
+		// the pipeline states for recently visited events, most recent first, so that going
+		// back to an event doesn't fetch and rebuild its state again. Cleared whenever the
+		// replay itself changes (context filter, resource replacement).
+		struct CachedPipelineState
+		{
+			uint32_t frameID;
+			uint32_t eventID;
+			D3D11PipelineState d3d11;
+			GLPipelineState gl;
+		};
+		static const size_t PipelineStateCacheSize = 64;
+		std::list<CachedPipelineState> m_PipelineStateCache;
+
+		void RefreshFrameEvent(uint32_t frameID, uint32_t eventID, bool force);
+		bool ScrubFrameEvent(uint32_t frameID, uint32_t eventID);
+
+		void FlushScrub();
+
+		// the event most recently asked for while scrubbing, and the event the device was
+		// last replayed to - either m_EventID or the last preview.
+		bool m_Scrubbing;
+		uint32_t m_ScrubFrameID;
+		uint32_t m_ScrubEventID;
+		uint32_t m_PreviewFrameID;
+		uint32_t m_PreviewEventID;
+		uint64_t m_LastScrubTick;
+		static const uint32_t ScrubIntervalMS = 30;
+
+		bool FetchCachedPipelineState(uint32_t frameID, uint32_t eventID);
+		void CachePipelineState(uint32_t frameID, uint32_t eventID);
+
+		// min/max and histogram results for recently used subresources. A result is reused at
+		// another event as long as nothing wrote to the texture in between, going by its usage.
+		// Cleared along with the pipeline state cache.
+		struct CachedTextureStats
+		{
+			ResourceId tex;
+			uint32_t sliceFace, mip, sample;
+			uint32_t frameID, eventID;
+
+			// histograms are also keyed on the range and channels they were calculated for
+			bool histogram;
+			float minval, maxval;
+			bool channels[4];
+
+			PixelValue minResult, maxResult;
+			vector<uint32_t> histResult;
+		};
+		static const size_t TextureStatsCacheSize = 32;
+		std::list<CachedTextureStats> m_TextureStatsCache;
+
+		CachedTextureStats *FindTextureStats(const CachedTextureStats &key);
+		void CacheTextureStats(const CachedTextureStats &stats);
+
 		std::vector<ReplayOutput *> m_Outputs;
 
+		// built together on first use. m_ResourceGeneration is 0 until then, and is bumped
+		// whenever anything GetResourceGeneration covers might have changed.
 		std::vector<FetchBuffer> m_Buffers;
 		std::vector<FetchTexture> m_Textures;
+		uint32_t m_ResourceGeneration;
+
+		void FetchResourceLists();
 
 		IReplayDriver *m_pDevice;
 
 		std::set<ResourceId> m_TargetResources;
-		std::set<ResourceId> m_CustomShaders;
+
+		// resources currently replaced, e.g. by an edited shader. Anything measured while
+		// there are replacements isn't the captured frame's, so isn't cached.
+		std::set<ResourceId> m_ReplacedResources;
+
+		// counter results are kept in a file next to the log, so that reopening it on the
+		// same GPU and driver shows timings without replaying for them again. The file is
+		// only used if the replay device hash and the log's timestamp both match.
+		struct CounterCacheKey
+		{
+			uint32_t frameID, minEventID, maxEventID, numRuns;
+			vector<uint32_t> counters;
+
+			bool operator <(const CounterCacheKey &o) const;
+		};
+		static const uint32_t CounterCacheVersion = 1;
+		string m_Logfile;
+		uint64_t m_CounterCacheDevice;
+		bool m_CounterCacheLoaded;
+		std::map<CounterCacheKey, vector<CounterResult> > m_CounterCache;
+
+		string GetCounterCacheFilename();
+		void LoadCounterCache();
+		void SaveCounterCache();
+
+		// custom shaders are cached by their full source and compile parameters, so that
+		// rebuilding a shader the user has already compiled (e.g. switching back to it, or
+		// undoing an edit) reuses the existing shader instead of compiling again. Builds
+		// that are no longer referenced are kept around until there are more than
+		// UnusedCustomShaderCount of them, failed builds are cached for their errors.
+		struct CustomShaderBuild
+		{
+			ResourceId id;
+			string errors;
+			uint32_t refs;
+			uint64_t lastUse;
+		};
+		static const size_t UnusedCustomShaderCount = 8;
+		std::map<string, CustomShaderBuild> m_CustomShaderBuilds;
+		std::map<ResourceId, string> m_CustomShaderKeys;
+		uint64_t m_CustomShaderUse;
+
+		void TrimCustomShaderBuilds();
+
+		// the last custom shader application. Only one output texture exists in the
+		// driver, so this is only reused while the same shader is applied to the same
+		// subresource at the same event as last time.
+		struct CustomShaderOutput
+		{
+			CustomShaderOutput() : mip(0), frameID(0), eventID(0), lastDeferredEvent(0) {}
+
+			ResourceId shader, texid;
+			uint32_t mip;
+			uint32_t frameID, eventID;
+			uint32_t lastDeferredEvent;
+			ResourceId result;
+		};
+		CustomShaderOutput m_LastCustomShaderOutput;
+
+		ResourceId ApplyCustomShader(ResourceId shader, ResourceId texid, uint32_t mip);
 
 		friend struct ReplayOutput;
 };
@@ -47,6 +47,100 @@ string ToStrHelper<false, ResourceId>::Get(const ResourceId &el)
 	return tostrBuf;
 }
 
+#include "os/os_specific.h"
+
+// keeps every allocation 16-byte aligned
+struct ArrayMemHeader
+{
+	ResultArena *arena;
+	uint64_t pad;
+};
+
+// small allocations are packed into blocks this big, larger ones get their own block
+static const size_t ArenaBlockSize = 1024*1024;
+
+static uint64_t s_RequestedArenaSlot = Threading::AllocateTLSSlot();
+static uint64_t s_ActiveArenaSlot = Threading::AllocateTLSSlot();
+
+ResultArena::~ResultArena()
+{
+	for(size_t i=0; i < m_Blocks.size(); i++)
+		free(m_Blocks[i]);
+}
+
+void *ResultArena::Bump(size_t size)
+{
+	size = (size + 15) & ~size_t(15);
+
+	if(size > ArenaBlockSize/4)
+	{
+		char *block = (char *)malloc(size);
+		// insert before the current block, so it keeps being bumped into
+		m_Blocks.insert(m_Blocks.empty() ? m_Blocks.end() : m_Blocks.end()-1, block);
+		return block;
+	}
+
+	if(m_Used + size > m_Capacity)
+	{
+		m_Blocks.push_back((char *)malloc(ArenaBlockSize));
+		m_Used = 0;
+		m_Capacity = ArenaBlockSize;
+	}
+
+	char *ret = m_Blocks.back() + m_Used;
+	m_Used += size;
+	return ret;
+}
+
+void *ResultArena::Allocate(size_t size)
+{
+	ResultArena *arena = (ResultArena *)Threading::GetTLSValue(s_ActiveArenaSlot);
+
+	ArrayMemHeader *header = NULL;
+	if(arena)
+		header = (ArrayMemHeader *)arena->Bump(sizeof(ArrayMemHeader) + size);
+	else
+		header = (ArrayMemHeader *)malloc(sizeof(ArrayMemHeader) + size);
+
+	header->arena = arena;
+	header->pad = 0;
+
+	return header+1;
+}
+
+void ResultArena::Free(const void *p)
+{
+	if(p == NULL)
+		return;
+
+	ArrayMemHeader *header = (ArrayMemHeader *)p - 1;
+
+	// arena memory is only freed with the whole arena
+	if(header->arena == NULL)
+		free(header);
+}
+
+void ResultArena::SetRequested(ResultArena *arena)
+{
+	Threading::SetTLSValue(s_RequestedArenaSlot, arena);
+}
+
+ResultArena *ResultArena::GetRequested()
+{
+	return (ResultArena *)Threading::GetTLSValue(s_RequestedArenaSlot);
+}
+
+ResultArenaScope::ResultArenaScope()
+{
+	m_Prev = (ResultArena *)Threading::GetTLSValue(s_ActiveArenaSlot);
+	Threading::SetTLSValue(s_ActiveArenaSlot, ResultArena::GetRequested());
+}
+
+ResultArenaScope::~ResultArenaScope()
+{
+	Threading::SetTLSValue(s_ActiveArenaSlot, m_Prev);
+}
+
 namespace rdctype
 {
 str &str::operator =(const std::string &in)
@@ -68,4 +68,38 @@ void create_array_uninit(array<T> &ret, size_t count)
 	}
 }
 
-}; // namespace rdctype
\ No newline at end of file
+}; // namespace rdctype
+
+// backs RENDERDOC_CreateResultArena. Every array allocation has a small header saying which
+// arena (if any) it came from, so that RENDERDOC_FreeArrayMem knows whether to free it.
+struct ResultArena
+{
+	ResultArena() : m_Used(0), m_Capacity(0) {}
+	~ResultArena();
+
+	static void *Allocate(size_t size);
+	static void Free(const void *p);
+
+	// the arena the caller asked for on this thread. Allocations only come from it while a
+	// ResultArenaScope is active, so internal state never ends up in an arena.
+	static void SetRequested(ResultArena *arena);
+	static ResultArena *GetRequested();
+
+	private:
+		friend struct ResultArenaScope;
+
+		void *Bump(size_t size);
+
+		std::vector<char *> m_Blocks;
+		size_t m_Used, m_Capacity;
+};
+
+// placed around copying results out to the caller
+struct ResultArenaScope
+{
+	ResultArenaScope();
+	~ResultArenaScope();
+
+	private:
+		ResultArena *m_Prev;
+};
\ No newline at end of file
@@ -197,8 +197,9 @@ static int gen_digits(const diy_fp &lower, const diy_fp &upper, char *digits, in
 	// generate 1.0 to the desired exponent so we can split integer from decimal part
 	diy_fp one(uint64_t(1) << -upper.exp, upper.exp);
 
-	// mask off integer and decimal parts
-	uint64_t intpart = upper.mantissa >> -one.exp;
+	// mask off integer and decimal parts. The cached power puts the exponent in [-60,-32]
+	// so the integer part always fits in 32 bits, and 32-bit divides are much cheaper
+	uint32_t intpart = uint32_t(upper.mantissa >> -one.exp);
 	uint64_t decpart = upper.mantissa & (one.mantissa - 1);
 
 	// len is current number of digits produced
@@ -209,11 +210,18 @@ static int gen_digits(const diy_fp &lower, const diy_fp &upper, char *digits, in
 	int kappa = 10;
 	uint32_t div = 1000000000; // highest possible pow10 in 32bits = 10^9
 
+	// skip straight to the first non-zero digit. Leading 0s aren't output, and the remainder
+	// can't be within delta before any digits are produced, so this gives the same result.
+	while(div > 1 && intpart < div)
+	{
+		kappa--; div /= 10;
+	}
+
 	// handle integer component before decimal separator
 	while(kappa > 0)
 	{
 		// get digit at current power of ten
-		uint64_t digit = intpart / div;
+		uint32_t digit = intpart / div;
 
 		// don't include preceeding 0 digits (so either include if
 		// digit is non-0, or if we've started including digits ie.
@@ -221,14 +229,14 @@ static int gen_digits(const diy_fp &lower, const diy_fp &upper, char *digits, in
 		if(digit || len) digits[len++] = '0' + char(digit);
 
 		// remove this pow10 from the int for future iterations
-		intpart %= div; kappa--; div /= 10;
+		intpart -= digit*div; kappa--; div /= 10;
 
 		// this is our termination condition, when we've produced the number.
 		// delta is the difference between upper and lower, and the left side
 		// is the current remainder after the currently generated digits have
 		// been removed. If that is small enough that we've produced the number,
 		// exit and increment kout to account for the extra exponential
-		if( (intpart << -one.exp) + decpart <= delta.mantissa)
+		if( (uint64_t(intpart) << -one.exp) + decpart <= delta.mantissa)
 		{
 			kout += kappa;
 			return len;
@@ -26,9 +26,15 @@
 #include "serialiser.h"
 
 #include "core/core.h"
+#include "api/replay/renderdoc_replay.h"
 
 #include "serialise/string_utils.h"
 
+#include "lz4/lz4.h"
+#include "miniz/miniz.h"
+
+#include <algorithm>
+
 #ifdef _MSC_VER
 #pragma warning (disable : 4422) // warning C4422: 'snprintf' : too many arguments passed for format string
                                  // false positive as VS is trying to parse renderdoc's custom format strings
@@ -42,8 +48,89 @@ int64_t Chunk::m_MaxChunks = 0;
 
 #endif
 
+int64_t Chunk::m_TypeLiveChunks[Chunk::MaxTrackedChunkType+1] = {0};
+int64_t Chunk::m_TypeTotalMem[Chunk::MaxTrackedChunkType+1] = {0};
+
+// decompresses one block of a compressed or archived capture, returning false if it doesn't
+// produce exactly the expected number of bytes. Doesn't touch any serialiser state, so
+// blocks can be decompressed on several threads at once.
+static bool DecompressBlock(bool archived, const byte *src, uint32_t srcSize, byte *dst, size_t dstCapacity, uint32_t expectedSize)
+{
+	int decompSize = -1;
+
+	if(archived)
+	{
+		mz_ulong destLen = (mz_ulong)dstCapacity;
+		if(mz_uncompress(dst, &destLen, src, (mz_ulong)srcSize) == 0)
+			decompSize = (int)destLen;
+	}
+	else
+	{
+		decompSize = LZ4_decompress_safe((const char *)src, (char *)dst, (int)srcSize, (int)dstCapacity);
+	}
+
+	return decompSize >= 0 && (uint32_t)decompSize == expectedSize;
+}
+
+struct MemoryBlockDecompress
+{
+	const byte *base;
+	size_t blockHeaderSize;
+	bool archived;
+	// offset of each block in base, and its decompressed size
+	const vector< pair<uint64_t, uint32_t> > *blocks;
+	vector<byte *> dst;
+	vector<char> ok;
+};
+
+static void DecompressMemoryBlocks(void *userData, size_t begin, size_t end)
+{
+	MemoryBlockDecompress *decomp = (MemoryBlockDecompress *)userData;
+
+	for(size_t i=begin; i < end; i++)
+	{
+		const byte *block = decomp->base + (*decomp->blocks)[i].first;
+		const uint32_t *sizes = (const uint32_t *)block;
+
+		decomp->ok[i] = DecompressBlock(decomp->archived, block + decomp->blockHeaderSize, sizes[0],
+		                                decomp->dst[i], sizes[1], sizes[1]);
+	}
+}
+
 const uint32_t Serialiser::MAGIC_HEADER = MAKE_FOURCC('R', 'D', 'O', 'C');
 const size_t Serialiser::BufferAlignment = 16;
+const size_t Serialiser::CompressedBlockSize = 256*1024;
+const size_t Serialiser::ArchiveMinBlockSize = 4*1024;
+const size_t Serialiser::ArchiveMaxBlockSize = 256*1024;
+// gives an average block of around 16kb beyond the minimum
+const uint64_t Serialiser::ArchiveBoundaryMask = 0xfffc000000000000ULL;
+const uint64_t Serialiser::MaxMappedSize32 = 256*1024*1024;
+
+const size_t Serialiser::ChunkArenaPageSize = 1024*1024;
+const size_t Serialiser::MinExternalBufferSize = 64*1024;
+// chunks bigger than this are always allocated on their own, to avoid wasting
+// the rest of a page.
+const size_t Serialiser::ChunkArenaMaxAlloc = 64*1024;
+
+struct ChunkArenaPage
+{
+	byte *data;
+	size_t used;
+
+	// one reference for each chunk allocated from the page, plus one held by the
+	// serialiser while it's the current page
+	volatile int64_t refcount;
+
+	void AddRef() { Atomic::Inc64(&refcount); }
+	void Release()
+	{
+		if(Atomic::Dec64(&refcount) == 0)
+		{
+			Serialiser::FreeAlignedBuffer(data);
+			delete this;
+		}
+	}
+};
 
 Chunk::Chunk(Serialiser *ser, uint32_t chunkType, size_t alignment, bool temporary)
 {
@@ -51,35 +138,51 @@ Chunk::Chunk(Serialiser *ser, uint32_t chunkType, size_t alignment, bool tempora
 
 	RDCASSERT(ser->GetOffset() < 0xffffffff);
 
+	// any external payloads are referenced rather than copied
+	m_DataLength = uint32_t(m_Length - ser->m_ExternalBytes);
+	m_Payloads.swap(ser->m_PayloadRefs);
+	ser->m_ExternalBytes = 0;
+
 	m_ChunkType = chunkType;
 
 	m_Temporary = temporary;
 
-	if(alignment)
+	m_ArenaPage = NULL;
+
+	m_Alignment = alignment ? alignment : (size_t)Serialiser::BufferAlignment;
+
+	if(ser->m_ChunkArenaEnabled && m_DataLength <= Serialiser::ChunkArenaMaxAlloc)
+	{
+		m_Data = ser->AllocChunkData(m_DataLength, alignment ? alignment : (size_t)Serialiser::BufferAlignment, m_ArenaPage);
+		m_AlignedData = (alignment || ser->HasAlignedData());
+	}
+	else if(alignment)
 	{
-		m_Data = Serialiser::AllocAlignedBuffer(m_Length, alignment);
+		m_Data = Serialiser::AllocAlignedBuffer(m_DataLength, alignment);
 		m_AlignedData = true;
 	}
 	else if(ser->HasAlignedData())
 	{
-		m_Data = Serialiser::AllocAlignedBuffer(m_Length);
+		m_Data = Serialiser::AllocAlignedBuffer(m_DataLength);
 		m_AlignedData = true;
 	}
 	else
 	{
-		m_Data = new byte[m_Length];
+		m_Data = new byte[m_DataLength];
 		m_AlignedData = false;
 	}
 
-	memcpy(m_Data, ser->GetRawPtr(0), m_Length);
+	memcpy(m_Data, ser->GetRawPtr(0), m_DataLength);
 
 	m_DebugStr = ser->GetDebugStr();
 
 	ser->Rewind();
+
+	TrackLive(1);
 	
 #if !defined(RELEASE)
 	int64_t newval = Atomic::Inc64(&m_LiveChunks);
-	Atomic::ExchAdd64(&m_TotalMem, m_Length);
+	Atomic::ExchAdd64(&m_TotalMem, m_DataLength);
 
 	if(newval > m_MaxChunks)
 	{
@@ -90,14 +193,154 @@ Chunk::Chunk(Serialiser *ser, uint32_t chunkType, size_t alignment, bool tempora
 #endif
 }
 
+const byte *Chunk::GetSegment(size_t idx, size_t &len)
+{
+	// odd segments are the payloads, even segments the data in between them
+	if(idx & 1)
+	{
+		const ChunkPayloadRef &ref = m_Payloads[idx/2];
+		len = ref.length;
+		return ref.data;
+	}
+
+	size_t piece = idx/2;
+
+	size_t start = piece == 0 ? 0 : m_Payloads[piece-1].physOffset;
+	size_t end = piece < m_Payloads.size() ? m_Payloads[piece].physOffset : m_DataLength;
+
+	len = end - start;
+	return m_Data + start;
+}
+
+void Chunk::Flatten()
+{
+	byte *flat = Serialiser::AllocAlignedBuffer(m_Length, m_Alignment);
+
+	byte *dst = flat;
+	for(size_t s=0; s < NumSegments(); s++)
+	{
+		size_t segLen = 0;
+		const byte *seg = GetSegment(s, segLen);
+		memcpy(dst, seg, segLen);
+		dst += segLen;
+	}
+
+	RDCASSERT(dst == flat + m_Length);
+
+	for(size_t i=0; i < m_Payloads.size(); i++)
+		m_Payloads[i].payload->Release();
+	m_Payloads.clear();
+
+	if(m_ArenaPage)
+	{
+		m_ArenaPage->Release();
+		m_ArenaPage = NULL;
+	}
+	else if(m_AlignedData)
+	{
+		Serialiser::FreeAlignedBuffer(m_Data);
+	}
+	else
+	{
+		SAFE_DELETE_ARRAY(m_Data);
+	}
+
+#if !defined(RELEASE)
+	Atomic::ExchAdd64(&m_TotalMem, int64_t(m_Length) - int64_t(m_DataLength));
+#endif
+
+	m_Data = flat;
+	m_DataLength = m_Length;
+	m_AlignedData = true;
+}
+
+void Chunk::TrackLive(int64_t delta)
+{
+	// count the full length including any payloads, as that's what the chunk adds to a
+	// capture. Payloads shared between duplicated chunks are counted once for each.
+	uint32_t type = TrackedType(m_ChunkType);
+	Atomic::ExchAdd64(&m_TypeLiveChunks[type], delta);
+	Atomic::ExchAdd64(&m_TypeTotalMem[type], delta*int64_t(m_Length));
+}
+
+ChunkPayload *ChunkPayload::Create(size_t size)
+{
+	ChunkPayload *ret = new ChunkPayload();
+	ret->m_Data = Serialiser::AllocAlignedBuffer(size);
+	ret->m_Size = size;
+	ret->m_RefCount = 1;
+	return ret;
+}
+
+ChunkPayload::~ChunkPayload()
+{
+	Serialiser::FreeAlignedBuffer(m_Data);
+}
+
+void ChunkPayload::Release()
+{
+	if(Atomic::Dec64(&m_RefCount) == 0)
+		delete this;
+}
+
+Chunk *Chunk::Duplicate()
+{
+	Chunk *ret = new Chunk();
+
+	ret->m_Length = m_Length;
+	ret->m_DataLength = m_DataLength;
+	ret->m_ChunkType = m_ChunkType;
+	ret->m_Temporary = true;
+	ret->m_AlignedData = m_AlignedData;
+	ret->m_Alignment = (size_t)Serialiser::BufferAlignment;
+	ret->m_ArenaPage = NULL;
+
+	if(m_AlignedData)
+		ret->m_Data = Serialiser::AllocAlignedBuffer(m_DataLength);
+	else
+		ret->m_Data = new byte[m_DataLength];
+
+	memcpy(ret->m_Data, m_Data, m_DataLength);
+
+	// payloads are immutable so can be shared rather than copied
+	ret->m_Payloads = m_Payloads;
+	for(size_t i=0; i < ret->m_Payloads.size(); i++)
+		ret->m_Payloads[i].payload->AddRef();
+
+	ret->m_DebugStr = m_DebugStr;
+
+	ret->TrackLive(1);
+
+#if !defined(RELEASE)
+	int64_t newval = Atomic::Inc64(&m_LiveChunks);
+	Atomic::ExchAdd64(&m_TotalMem, m_DataLength);
+
+	m_MaxChunks = RDCMAX(newval, m_MaxChunks);
+#endif
+
+	return ret;
+}
+
 Chunk::~Chunk()
 {
+	TrackLive(-1);
+
 #if !defined(RELEASE)
 	Atomic::Dec64(&m_LiveChunks);
-	Atomic::ExchAdd64(&m_TotalMem, -int64_t(m_Length));
+	Atomic::ExchAdd64(&m_TotalMem, -int64_t(m_DataLength));
 #endif
 
-	if(m_AlignedData)
+	for(size_t i=0; i < m_Payloads.size(); i++)
+		m_Payloads[i].payload->Release();
+	m_Payloads.clear();
+
+	if(m_ArenaPage)
+	{
+		m_ArenaPage->Release();
+		m_ArenaPage = NULL;
+		m_Data = NULL;
+	}
+	else if(m_AlignedData)
 	{
 		if(m_Data)
 			Serialiser::FreeAlignedBuffer(m_Data);
@@ -130,8 +373,22 @@ void Serialiser::Reset()
 
 	m_Indent = 0;
 
+	m_ChunkName = NULL;
+	m_CallstackTable.clear();
+
+	m_FileVersion = SERIALISE_VERSION;
+	m_VarintParams = true;
+	m_VarintResourceIds = true;
+
 	SAFE_DELETE_ARRAY(m_pCallstack);
 	SAFE_DELETE_ARRAY(m_pResolver);
+	if(m_MappedBase)
+	{
+		FileIO::UnmapFile(m_MappedBase, m_MappedSize);
+		m_MappedBase = NULL;
+		m_MappedSize = 0;
+		m_Buffer = NULL;
+	}
 	if(m_Buffer)
 	{
 		FreeAlignedBuffer(m_Buffer);
@@ -146,13 +403,183 @@ void Serialiser::Reset()
 	
 	m_ReadFileHandle = NULL;
 
+	FreeBlockData();
+	m_Compressed = false;
+	m_Archived = false;
+	m_BlockSize = 0;
+	m_BlockOffsets.clear();
+	m_BlockStarts.clear();
+	m_BlockIdx = ~0ULL;
+	m_BlockLength = 0;
+
+	m_ChunkIndexOffset = 0;
+	m_ChunkIndexLoaded = false;
+	m_ChunkIndex.clear();
+	m_ChunkTypeIndex.clear();
+
+	m_SpilledChunks = NULL;
+
+	ReleasePayloadRefs();
+
+	SetChunkArena(false);
+
 	m_Buffer = NULL;
 	m_BufferSize = 0;
 	m_BufferHead = NULL;
 }
 
+size_t Serialiser::GetHeaderSize(uint64_t version)
+{
+	// the header has only grown, so older versions have a prefix of it. Here we list which
+	// non-current versions we support, and what changed
+	switch(version)
+	{
+		case SERIALISE_VERSION:
+			return sizeof(DebuggerHeader);
+		// from 0x33 to 0x34, callstacks are stored once in a table and chunks refer to them by index
+		case 0x00000033:
+			return offsetof(DebuggerHeader, callstackTableOffset);
+		// from 0x32 to 0x33, an index of the chunks is appended to the file
+		case 0x00000032:
+			return offsetof(DebuggerHeader, chunkIndexOffset);
+		// from 0x31 to 0x32, the chunk stream can be compressed, and its size is stored
+		case 0x00000031:
+			return offsetof(DebuggerHeader, flags);
+		default:
+			break;
+	}
+
+	return 0;
+}
+
+size_t Serialiser::CheckHeader(DebuggerHeader &header)
+{
+	size_t headerSize = GetHeaderSize(header.version);
+
+	if(headerSize == 0)
+	{
+		RDCERR("Capture file from wrong version. This program is logfile version %llu, file is logfile version %llu", SERIALISE_VERSION, header.version);
+		return 0;
+	}
+
+	if(header.version != SERIALISE_VERSION)
+	{
+		RDCWARN("Old logfile version %llu, latest is %llu.", header.version, SERIALISE_VERSION);
+
+		// what was read past the end of the old header is the start of the symbol DB or chunks
+		DebuggerHeader defaults;
+		memcpy((byte *)&header + headerSize, (byte *)&defaults + headerSize, sizeof(DebuggerHeader) - headerSize);
+	}
+
+	return headerSize;
+}
+
+void Serialiser::SetChunkArena(bool enabled)
+{
+	m_ChunkArenaEnabled = enabled;
+
+	// drop our reference to the current page. It's freed as soon as all the
+	// chunks allocated from it are gone.
+	if(!enabled && m_ChunkArenaPage)
+	{
+		m_ChunkArenaPage->Release();
+		m_ChunkArenaPage = NULL;
+	}
+}
+
+byte *Serialiser::AllocChunkData(size_t length, size_t alignment, ChunkArenaPage *&page)
+{
+	RDCASSERT(length <= ChunkArenaMaxAlloc && alignment <= ChunkArenaMaxAlloc);
+
+	size_t offs = 0;
+
+	if(m_ChunkArenaPage)
+		offs = AlignUp(m_ChunkArenaPage->used, alignment);
+
+	if(m_ChunkArenaPage == NULL || offs + length > ChunkArenaPageSize)
+	{
+		if(m_ChunkArenaPage)
+			m_ChunkArenaPage->Release();
+
+		m_ChunkArenaPage = new ChunkArenaPage();
+		m_ChunkArenaPage->data = AllocAlignedBuffer(ChunkArenaPageSize, RDCMAX(alignment, (size_t)BufferAlignment));
+		m_ChunkArenaPage->used = 0;
+		m_ChunkArenaPage->refcount = 1;
+
+		offs = 0;
+	}
+
+	m_ChunkArenaPage->used = offs + length;
+	m_ChunkArenaPage->AddRef();
+
+	page = m_ChunkArenaPage;
+
+	return m_ChunkArenaPage->data + offs;
+}
+
+void Serialiser::FreeBlockData()
+{
+	StopPrefetch();
+
+	FreeAlignedBuffer(m_BlockData);
+	m_BlockData = NULL;
+	SAFE_DELETE_ARRAY(m_BlockScratch);
+	m_BlockScratchSize = 0;
+
+	for(size_t i=0; i < m_BlockPrefetch.size(); i++)
+	{
+		FreeAlignedBuffer(m_BlockPrefetch[i].data);
+		SAFE_DELETE_ARRAY(m_BlockPrefetch[i].scratch);
+	}
+	m_BlockPrefetch.clear();
+}
+
+byte *Serialiser::ResetForReading(size_t length)
+{
+	RDCASSERT(m_ReadFileHandle == NULL);
+
+	// only an in-memory reader's buffer size is known, anything else is thrown away
+	byte *buf = m_MappedBase ? NULL : m_Buffer;
+	size_t capacity = m_Mode == READING ? m_CurrentBufferSize : 0;
+
+	// don't let one huge packet pin its allocation for every small one that follows
+	const size_t maxSlack = 16*1024*1024;
+	if(buf && (capacity < length || capacity - length > RDCMAX(length, maxSlack)))
+	{
+		FreeAlignedBuffer(buf);
+		buf = NULL;
+	}
+
+	// detach the buffer so Reset() doesn't free it
+	if(buf)
+		m_Buffer = NULL;
+
+	Reset();
+
+	if(buf == NULL)
+	{
+		capacity = RDCMAX(length, (size_t)64);
+		buf = AllocAlignedBuffer(capacity);
+	}
+
+	m_DebugTextWriting = false;
+
+	m_Mode = READING;
+	m_DebugEnabled = false;
+	m_HasResolver = false;
+
+	m_FileStartOffset = 0;
+
+	m_BufferSize = length;
+	m_CurrentBufferSize = capacity;
+	m_BufferHead = m_Buffer = buf;
+	m_ReadOffset = 0;
+
+	return m_Buffer;
+}
+
 Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
-	: m_pCallstack(NULL), m_pResolver(NULL), m_Buffer(NULL)
+	: m_pCallstack(NULL), m_pResolver(NULL), m_Buffer(NULL), m_BlockData(NULL), m_BlockScratch(NULL), m_MappedBase(NULL), m_MappedSize(0), m_ChunkArenaPage(NULL)
 {
 	m_ResolverThread = 0; 
 
@@ -174,13 +601,15 @@ Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
 		m_BufferHead = m_Buffer = AllocAlignedBuffer(m_CurrentBufferSize);
 		m_ReadOffset = 0;
 
-		memcpy(m_Buffer, memoryBuf + m_FileStartOffset, m_CurrentBufferSize);
+		if(memoryBuf)
+			memcpy(m_Buffer, memoryBuf + m_FileStartOffset, m_CurrentBufferSize);
 		return;
 	}
 	
-	DebuggerHeader *header = (DebuggerHeader *)memoryBuf;
+	DebuggerHeader fileHeader;
+	DebuggerHeader *header = &fileHeader;
 
-	if(length < sizeof(DebuggerHeader))
+	if(length < GetHeaderSize(0x00000031))
 	{
 		RDCERR("Can't read from in-memory buffer, truncated header");
 		m_ErrorCode = eSerError_Corrupt;
@@ -188,6 +617,8 @@ Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
 		return;
 	}
 
+	memcpy(header, memoryBuf, RDCMIN(length, sizeof(DebuggerHeader)));
+
 	if(header->magic != MAGIC_HEADER)
 	{
 		char magicRef[5] = { 0 };
@@ -201,15 +632,25 @@ Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
 		return;
 	}
 
-	if(header->version != SERIALISE_VERSION)
+	size_t headerSize = CheckHeader(*header);
+
+	if(headerSize == 0)
 	{
-		RDCERR("Capture file from wrong version. This program is on logfile version %llu, file is logfile version %llu", SERIALISE_VERSION, header->version);
-		
 		m_ErrorCode = eSerError_UnsupportedVersion;
 		m_HasError = true;
 		return;
 	}
 
+	if(length < headerSize)
+	{
+		RDCERR("Can't read from in-memory buffer, truncated header");
+		m_ErrorCode = eSerError_Corrupt;
+		m_HasError = true;
+		return;
+	}
+
+	m_FileVersion = header->version;
+
 	if(header->fileSize < length)
 	{
 		RDCERR("Overlong in-memory buffer. Expected length 0x016llx, got 0x016llx", header->fileSize, length);
@@ -221,9 +662,93 @@ Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
 	
 	m_HasResolver = header->resolveDBSize > 0;
 
-	m_FileStartOffset = AlignUp16(sizeof(DebuggerHeader) + header->resolveDBSize);
+	m_FileStartOffset = AlignUp16(headerSize + header->resolveDBSize);
+
+	if(length < m_FileStartOffset)
+	{
+		RDCERR("Can't read from in-memory buffer, truncated symbol database");
+		m_ErrorCode = eSerError_Corrupt;
+		m_HasError = true;
+		return;
+	}
+
+	if(header->flags & eHeaderFlag_Compressed)
+	{
+		m_BufferSize = 0;
+		m_ReadOffset = 0;
+
+		bool archived = (header->flags & eHeaderFlag_Archived) != 0;
+
+		// archived blocks also store the stream offset they were first stored for
+		size_t blockHeaderSize = sizeof(uint32_t)*2 + (archived ? sizeof(uint64_t) : 0);
+
+		// the buffer might only hold the start of the file (e.g. when reading just
+		// the thumbnail), so decompress as many whole blocks as are available.
+		vector< pair<uint64_t, uint32_t> > blocks;
+		uint64_t offs = m_FileStartOffset;
+		while(offs + blockHeaderSize <= length)
+		{
+			const uint32_t *sizes = (const uint32_t *)(memoryBuf + offs);
+
+			if(offs >= header->blockTableOffset || offs + blockHeaderSize + sizes[0] > length)
+				break;
+
+			// in an archive, a block that repeats earlier data isn't stored again. Blocks
+			// are stored in stream order, so stop at the first gap.
+			if(archived)
+			{
+				uint64_t streamOffs = 0;
+				memcpy(&streamOffs, sizes + 2, sizeof(uint64_t));
+				if(streamOffs != m_BufferSize)
+					break;
+			}
+
+			blocks.push_back(std::make_pair(offs, sizes[1]));
+			m_BufferSize += sizes[1];
+			offs += blockHeaderSize + sizes[0];
+		}
+
+		m_CurrentBufferSize = (size_t)m_BufferSize;
+		m_BufferHead = m_Buffer = AllocAlignedBuffer(m_CurrentBufferSize);
+
+		// every block's destination is known up front, so decompress them all in parallel
+		MemoryBlockDecompress decomp;
+		decomp.base = memoryBuf;
+		decomp.blockHeaderSize = blockHeaderSize;
+		decomp.archived = archived;
+		decomp.blocks = &blocks;
+		decomp.dst.resize(blocks.size());
+		decomp.ok.resize(blocks.size());
+
+		byte *dst = m_Buffer;
+		for(size_t i=0; i < blocks.size(); i++)
+		{
+			decomp.dst[i] = dst;
+			dst += blocks[i].second;
+		}
+
+		Threading::ParallelFor(blocks.size(), 4, &DecompressMemoryBlocks, &decomp);
+
+		for(size_t i=0; i < blocks.size(); i++)
+		{
+			if(!decomp.ok[i])
+			{
+				RDCERR("Can't read from in-memory buffer, corrupted compressed block %u", (uint32_t)i);
+				m_ErrorCode = eSerError_Corrupt;
+				m_HasError = true;
+				return;
+			}
+		}
+
+		return;
+	}
 
 	m_BufferSize = length-m_FileStartOffset;
+
+	// as when reading from a file, stop before the callstack table and chunk index
+	if(header->streamSize > 0 && header->streamSize <= m_BufferSize)
+		m_BufferSize = header->streamSize;
+
 	m_CurrentBufferSize = (size_t)m_BufferSize;
 	m_BufferHead = m_Buffer = AllocAlignedBuffer(m_CurrentBufferSize);
 	m_ReadOffset = 0;
@@ -232,7 +757,7 @@ Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
 }
 
 Serialiser::Serialiser(const char *path, Mode mode, bool debugMode)
-	: m_pCallstack(NULL), m_pResolver(NULL), m_Buffer(NULL)
+	: m_pCallstack(NULL), m_pResolver(NULL), m_Buffer(NULL), m_BlockData(NULL), m_BlockScratch(NULL), m_MappedBase(NULL), m_MappedSize(0), m_ChunkArenaPage(NULL)
 {
 	m_ResolverThread = 0; 
 
@@ -274,10 +799,10 @@ Serialiser::Serialiser(const char *path, Mode mode, bool debugMode)
 			return;
 		}
 		
-		if(header.version != SERIALISE_VERSION)
+		size_t headerSize = CheckHeader(header);
+
+		if(headerSize == 0)
 		{
-			RDCERR("Capture file from wrong version. This program is logfile version %llu, file is logfile version %llu", SERIALISE_VERSION, header.version);
-			
 			m_ErrorCode = eSerError_UnsupportedVersion;
 			m_HasError = true;
 			FileIO::fclose(m_ReadFileHandle);
@@ -285,6 +810,8 @@ Serialiser::Serialiser(const char *path, Mode mode, bool debugMode)
 			return;
 		}
 
+		m_FileVersion = header.version;
+
 		FileIO::fseek64(m_ReadFileHandle, 0, SEEK_END);
 
 		uint64_t realLength = FileIO::ftell64(m_ReadFileHandle);
@@ -301,295 +828,1623 @@ Serialiser::Serialiser(const char *path, Mode mode, bool debugMode)
 
 		m_HasResolver = header.resolveDBSize > 0;
 
-		m_FileStartOffset = AlignUp16(sizeof(DebuggerHeader) + header.resolveDBSize);
+		m_FileStartOffset = AlignUp16(headerSize + header.resolveDBSize);
 
 		m_BufferSize = realLength-m_FileStartOffset;
-		m_CurrentBufferSize = (size_t)RDCMIN(m_BufferSize, (uint64_t)64*1024);
-		m_BufferHead = m_Buffer = AllocAlignedBuffer(m_CurrentBufferSize);
-		m_ReadOffset = 0;
 
-		ReadFromFile(0, m_CurrentBufferSize);
-	}
-	else
-	{
-		m_pResolver = NULL;
+		// the callstack table and chunk index follow the chunk stream, so they mustn't be
+		// read as chunks. Compressed files set this again below from the same value.
+		if(header.streamSize > 0 && header.streamSize <= m_BufferSize)
+			m_BufferSize = header.streamSize;
 
-		if(m_Filename != "")
-		{
-			m_BufferSize = 0;
-			m_BufferHead = m_Buffer = NULL;
-		}
-		else
+		if(header.chunkIndexOffset > 0 && header.chunkIndexOffset + sizeof(uint64_t) <= realLength)
+			m_ChunkIndexOffset = header.chunkIndexOffset;
+
+		if(header.callstackTableOffset > 0)
 		{
-			m_BufferSize = 128*1024;
-			m_BufferHead = m_Buffer = AllocAlignedBuffer((size_t)m_BufferSize);
-		}
+			uint64_t numCallstacks = 0;
 
-		m_ReadOffset = 0;
-		m_FileStartOffset = 0;
-	}
-}
+			FileIO::fseek64(m_ReadFileHandle, header.callstackTableOffset, SEEK_SET);
+			FileIO::fread(&numCallstacks, sizeof(uint64_t), 1, m_ReadFileHandle);
 
-void Serialiser::ReadFromFile(uint64_t destOffs, size_t chunkLen)
-{
-	RDCASSERT(m_ReadFileHandle);
+			bool validTable = header.callstackTableOffset + (numCallstacks+1)*sizeof(uint64_t) <= realLength;
 
-	if(m_ReadFileHandle == NULL)
-		return;
+			if(validTable)
+				m_CallstackTable.resize((size_t)numCallstacks);
 
-	FileIO::fseek64(m_ReadFileHandle, m_FileStartOffset+destOffs, SEEK_SET);
-	FileIO::fread(m_Buffer + destOffs - m_ReadOffset, 1, chunkLen, m_ReadFileHandle);
+			for(size_t i=0; validTable && i < m_CallstackTable.size(); i++)
+			{
+				uint64_t numLevels = 0;
+				FileIO::fread(&numLevels, sizeof(uint64_t), 1, m_ReadFileHandle);
+
+				validTable = numLevels <= 0xff &&
+					FileIO::ftell64(m_ReadFileHandle) + numLevels*sizeof(uint64_t) <= realLength;
+
+				if(validTable && numLevels > 0)
+				{
+					m_CallstackTable[i].resize((size_t)numLevels);
+					FileIO::fread(&m_CallstackTable[i][0], sizeof(uint64_t), (size_t)numLevels, m_ReadFileHandle);
+				}
+			}
+
+			if(!validTable)
+			{
+				RDCERR("Corrupted capture file, invalid callstack table");
+
+				m_ErrorCode = eSerError_Corrupt;
+				m_HasError = true;
+				FileIO::fclose(m_ReadFileHandle);
+				m_ReadFileHandle = 0;
+				return;
+			}
+		}
+
+		if(header.flags & eHeaderFlag_Compressed)
+		{
+			uint64_t table[2] = { 0, 0 };
+
+			FileIO::fseek64(m_ReadFileHandle, header.blockTableOffset, SEEK_SET);
+			FileIO::fread(table, sizeof(uint64_t), 2, m_ReadFileHandle);
+
+			uint64_t numBlocks = table[1];
+
+			m_BlockSize = (size_t)table[0];
+			m_Archived = (header.flags & eHeaderFlag_Archived) != 0;
+
+			// archive block tables also hold the stream offset of each block
+			uint64_t tableEntries = m_Archived ? numBlocks*2 : numBlocks;
+
+			bool validTable = m_BlockSize > 0 && numBlocks <= realLength &&
+				header.blockTableOffset + (tableEntries+2)*sizeof(uint64_t) <= realLength;
+
+			if(validTable && !m_Archived)
+				validTable = numBlocks == (header.streamSize + m_BlockSize - 1)/m_BlockSize;
+
+			if(validTable && m_Archived && numBlocks > 0)
+			{
+				m_BlockStarts.resize((size_t)numBlocks);
+				FileIO::fseek64(m_ReadFileHandle, header.blockTableOffset + (numBlocks+2)*sizeof(uint64_t), SEEK_SET);
+				FileIO::fread(&m_BlockStarts[0], sizeof(uint64_t), (size_t)numBlocks, m_ReadFileHandle);
+
+				// blocks must tile the stream from the start with none too large
+				validTable = m_BlockStarts[0] == 0;
+				for(size_t i=0; validTable && i < m_BlockStarts.size(); i++)
+				{
+					uint64_t end = i+1 < m_BlockStarts.size() ? m_BlockStarts[i+1] : header.streamSize;
+					validTable = end > m_BlockStarts[i] && end - m_BlockStarts[i] <= m_BlockSize;
+				}
+			}
+
+			if(!validTable)
+			{
+				RDCERR("Corrupted compressed capture file, invalid block table");
+
+				m_ErrorCode = eSerError_Corrupt;
+				m_HasError = true;
+				FileIO::fclose(m_ReadFileHandle);
+				m_ReadFileHandle = 0;
+				return;
+			}
+
+			m_BlockOffsets.resize((size_t)numBlocks);
+			if(numBlocks > 0)
+			{
+				FileIO::fseek64(m_ReadFileHandle, header.blockTableOffset + 2*sizeof(uint64_t), SEEK_SET);
+				FileIO::fread(&m_BlockOffsets[0], sizeof(uint64_t), (size_t)numBlocks, m_ReadFileHandle);
+			}
+
+			m_Compressed = true;
+			m_BlockData = AllocAlignedBuffer(m_BlockSize);
+			if(m_Archived)
+				m_BlockScratchSize = (size_t)mz_compressBound((mz_ulong)m_BlockSize);
+			else
+				m_BlockScratchSize = (size_t)LZ4_compressBound((int)m_BlockSize);
+			m_BlockScratch = new byte[m_BlockScratchSize];
+			m_BlockIdx = ~0ULL;
+			m_BlockLength = 0;
+
+			m_BufferSize = header.streamSize;
+		}
+
+		// map the whole file in if we can. Then the whole stream is always in our window
+		// and reading, skipping or seeking anywhere in the file never needs to copy.
+		// Compressed files have to be decompressed into a window as we go.
+		if(!m_Compressed && (sizeof(void *) > 4 || realLength <= MaxMappedSize32))
+			m_MappedBase = (byte *)FileIO::MapFile(m_Filename.c_str(), m_MappedSize);
+
+		if(m_MappedBase && m_MappedSize == realLength)
+		{
+			RDCDEBUG("Mapped capture file for read");
+
+			FileIO::fclose(m_ReadFileHandle);
+			m_ReadFileHandle = 0;
+
+			m_CurrentBufferSize = (size_t)m_BufferSize;
+			m_BufferHead = m_Buffer = m_MappedBase + m_FileStartOffset;
+			m_ReadOffset = 0;
+			return;
+		}
+		else if(m_MappedBase)
+		{
+			FileIO::UnmapFile(m_MappedBase, m_MappedSize);
+			m_MappedBase = NULL;
+			m_MappedSize = 0;
+		}
+
+		m_CurrentBufferSize = (size_t)RDCMIN(m_BufferSize, (uint64_t)64*1024);
+		m_BufferHead = m_Buffer = AllocAlignedBuffer(m_CurrentBufferSize);
+		m_ReadOffset = 0;
+
+		ReadFromFile(0, m_CurrentBufferSize);
+	}
+	else
+	{
+		m_pResolver = NULL;
+
+		if(m_Filename != "")
+		{
+			m_BufferSize = 0;
+			m_BufferHead = m_Buffer = NULL;
+		}
+		else
+		{
+			m_BufferSize = 128*1024;
+			m_BufferHead = m_Buffer = AllocAlignedBuffer((size_t)m_BufferSize);
+		}
+
+		m_ReadOffset = 0;
+		m_FileStartOffset = 0;
+	}
 }
 
-byte *Serialiser::AllocAlignedBuffer(size_t size, size_t alignment)
+void Serialiser::ReadFromFile(uint64_t destOffs, size_t chunkLen)
 {
-	byte *rawAlloc = NULL;
-	
-#if defined(__EXCEPTIONS) || defined(_CPPUNWIND)
-	try
-#endif
+	RDCASSERT(m_ReadFileHandle);
+
+	if(m_ReadFileHandle == NULL)
+		return;
+
+	ReadStreamData(destOffs, m_Buffer + destOffs - m_ReadOffset, chunkLen);
+}
+
+bool Serialiser::ReadStreamData(uint64_t offs, byte *dst, size_t len)
+{
+	if(m_MappedBase)
 	{
-		rawAlloc = new byte[size+sizeof(byte*)+alignment];
+		memcpy(dst, m_MappedBase + m_FileStartOffset + offs, len);
+		return true;
 	}
-#if defined(__EXCEPTIONS) || defined(_CPPUNWIND)
-	catch(std::bad_alloc&)
+
+	if(m_Compressed)
 	{
-		rawAlloc = NULL;
+		// copy out of each block overlapping the range, decompressing them as we go
+		while(len > 0)
+		{
+			uint64_t blockIdx = FindBlock(offs);
+
+			if(!LoadBlock(blockIdx))
+				return false;
+
+			size_t blockOffs = (size_t)(offs - GetBlockStart(blockIdx));
+
+			if(blockOffs >= m_BlockLength)
+			{
+				RDCERR("Reading past the end of compressed capture file");
+				return false;
+			}
+
+			size_t copyLen = RDCMIN(len, m_BlockLength-blockOffs);
+
+			memcpy(dst, m_BlockData + blockOffs, copyLen);
+
+			dst += copyLen;
+			offs += copyLen;
+			len -= copyLen;
+		}
+
+		return true;
 	}
-#endif
 
-	if(rawAlloc == NULL)
-		RDCFATAL("Allocation for %llu bytes failed", (uint64_t)size);
+	FileIO::fseek64(m_ReadFileHandle, m_FileStartOffset+offs, SEEK_SET);
+	return FileIO::fread(dst, 1, len, m_ReadFileHandle) == len;
+}
 
-	RDCASSERT(rawAlloc);
+const vector<Serialiser::ChunkIndexEntry> &Serialiser::GetChunkIndex()
+{
+	if(m_ChunkIndexLoaded || m_ChunkIndexOffset == 0)
+		return m_ChunkIndex;
 
-	byte *alignedAlloc = (byte *)AlignUp((size_t)(rawAlloc+sizeof(byte*)), alignment);
+	m_ChunkIndexLoaded = true;
 
-	byte **realPointer = (byte **)alignedAlloc;
-	realPointer[-1] = rawAlloc;
+	uint64_t numEntries = 0;
 
-	return alignedAlloc;
+	uint64_t fileSize = 0;
+
+	if(m_MappedBase)
+	{
+		fileSize = m_MappedSize;
+		memcpy(&numEntries, m_MappedBase + m_ChunkIndexOffset, sizeof(uint64_t));
+	}
+	else if(m_ReadFileHandle)
+	{
+		FileIO::fseek64(m_ReadFileHandle, 0, SEEK_END);
+		fileSize = FileIO::ftell64(m_ReadFileHandle);
+
+		FileIO::fseek64(m_ReadFileHandle, m_ChunkIndexOffset, SEEK_SET);
+		FileIO::fread(&numEntries, sizeof(uint64_t), 1, m_ReadFileHandle);
+	}
+	else
+	{
+		// file has already been closed (e.g. after SetBase)
+		return m_ChunkIndex;
+	}
+
+	uint64_t indexStart = m_ChunkIndexOffset + sizeof(uint64_t);
+
+	if(numEntries > (fileSize - indexStart)/sizeof(ChunkIndexEntry))
+	{
+		RDCERR("Invalid chunk index in capture file, %llu entries", numEntries);
+		return m_ChunkIndex;
+	}
+
+	m_ChunkIndex.resize((size_t)numEntries);
+
+	if(numEntries > 0)
+	{
+		if(m_MappedBase)
+			memcpy(&m_ChunkIndex[0], m_MappedBase + indexStart, sizeof(ChunkIndexEntry)*(size_t)numEntries);
+		else
+			FileIO::fread(&m_ChunkIndex[0], sizeof(ChunkIndexEntry), (size_t)numEntries, m_ReadFileHandle);
+	}
+
+	for(size_t i=0; i < m_ChunkIndex.size(); i++)
+	{
+		if(m_ChunkIndex[i].offset + m_ChunkIndex[i].length > m_BufferSize)
+		{
+			RDCERR("Invalid chunk index entry %u in capture file, offset %llu", (uint32_t)i, m_ChunkIndex[i].offset);
+			m_ChunkIndex.clear();
+			m_ChunkTypeIndex.clear();
+			return m_ChunkIndex;
+		}
+
+		m_ChunkTypeIndex[m_ChunkIndex[i].type].push_back(i);
+	}
+
+	RDCDEBUG("Loaded index of %llu chunks", numEntries);
+
+	return m_ChunkIndex;
 }
 
-void Serialiser::FreeAlignedBuffer(byte *buf)
+bool Serialiser::SkipToIndexedChunk(uint32_t chunkIdx)
 {
-	if(buf == NULL) return;
+	if(m_Mode != READING || m_HasError || GetChunkIndex().empty())
+		return false;
 
-	byte **realPointer = (byte **)buf;
-	byte *rawAlloc = realPointer[-1];
+	uint64_t offs = GetOffset();
 
-	delete[] rawAlloc;
+	auto it = m_ChunkTypeIndex.find(chunkIdx);
+
+	if(it != m_ChunkTypeIndex.end())
+	{
+		const vector<size_t> &idxs = it->second;
+
+		// entries are in file order, so binary search for the first at or after our offset
+		size_t lo = 0, hi = idxs.size();
+		while(lo < hi)
+		{
+			size_t mid = (lo+hi)/2;
+			if(m_ChunkIndex[idxs[mid]].offset < offs)
+				lo = mid+1;
+			else
+				hi = mid;
+		}
+
+		if(lo < idxs.size())
+		{
+			int indent = m_Indent;
+			SetOffset(m_ChunkIndex[idxs[lo]].offset);
+			m_Indent = indent;
+			return true;
+		}
+	}
+
+	// no more chunks of this type, skip to the end as a linear search would
+	SetOffset(m_BufferSize);
+
+	return true;
 }
 
-void Serialiser::InitCallstackResolver()
+uint64_t Serialiser::FindBlock(uint64_t offs)
 {
-	if(m_pResolver == NULL && m_ResolverThread == 0)
+	if(!m_Archived)
+		return offs/m_BlockSize;
+
+	// last block starting at or before offs
+	size_t lo = 0, hi = m_BlockStarts.size();
+	while(hi - lo > 1)
 	{
-		m_ResolverThreadKillSignal = false;
-		m_ResolverThread = Threading::CreateThread(&Serialiser::CreateResolver, (void *)this);
+		size_t mid = (lo+hi)/2;
+		if(m_BlockStarts[mid] <= offs)
+			lo = mid;
+		else
+			hi = mid;
 	}
+
+	return (uint64_t)lo;
 }
 
-void Serialiser::SetCallstack(uint64_t *levels, size_t numLevels)
+uint64_t Serialiser::GetBlockStart(uint64_t blockIdx)
 {
-	SAFE_DELETE(m_pCallstack);
+	if(!m_Archived)
+		return blockIdx*m_BlockSize;
 
-	if(levels != NULL && numLevels != 0)
-		m_pCallstack = Callstack::Load(levels, numLevels);
+	return m_BlockStarts[(size_t)blockIdx];
+}
+
+bool Serialiser::ReadBlockSource(FILE *f, uint64_t blockIdx, byte *scratch, uint32_t *sizes)
+{
+	sizes[0] = sizes[1] = 0;
+
+	FileIO::fseek64(f, m_BlockOffsets[(size_t)blockIdx], SEEK_SET);
+	FileIO::fread(sizes, sizeof(uint32_t), 2, f);
+
+	// the stream offset is only needed when walking the blocks in memory
+	if(m_Archived)
+	{
+		uint64_t streamOffs = 0;
+		FileIO::fread(&streamOffs, sizeof(uint64_t), 1, f);
+	}
+
+	if(sizes[1] > m_BlockSize || sizes[0] > m_BlockScratchSize)
+	{
+		RDCERR("Corrupted compressed block %llu, sizes %u -> %u", blockIdx, sizes[0], sizes[1]);
+		return false;
+	}
+
+	FileIO::fread(scratch, 1, sizes[0], f);
+
+	return true;
+}
+
+void Serialiser::StartPrefetch()
+{
+	// one worker per core, leaving one for the reader. Each worker keeps at most one slot
+	// busy, and the slot count is capped to keep the memory held ahead of the reader small.
+	const size_t maxAhead = 8;
+
+	size_t numCPUs = (size_t)Threading::NumberOfCPUs();
+
+	if(numCPUs <= 1 || m_BlockOffsets.size() <= 2)
+		return;
+
+	size_t numSlots = RDCMIN(numCPUs, maxAhead);
+
+	m_PrefetchBase = m_PrefetchNext = (uint64_t)m_BlockOffsets.size();
+	m_PrefetchGeneration = 0;
+	m_PrefetchKillSignal = false;
+
+	for(size_t i=0; i < numSlots; i++)
+	{
+		PrefetchedBlock block;
+		block.idx = ~0ULL;
+		block.sizes[0] = block.sizes[1] = 0;
+		block.data = AllocAlignedBuffer(m_BlockSize);
+		block.scratch = new byte[m_BlockScratchSize];
+		block.busy = false;
+		block.ready = false;
+		block.valid = false;
+		m_BlockPrefetch.push_back(block);
+	}
+
+	for(size_t i=0; i+1 < numSlots; i++)
+	{
+		Threading::ThreadHandle thread = Threading::CreateThread(&PrefetchThreadEntry, this);
+		if(thread != 0)
+			m_PrefetchThreads.push_back(thread);
+	}
+}
+
+void Serialiser::StopPrefetch()
+{
+	m_PrefetchKillSignal = true;
+
+	for(size_t i=0; i < m_PrefetchThreads.size(); i++)
+	{
+		Threading::JoinThread(m_PrefetchThreads[i]);
+		Threading::CloseThread(m_PrefetchThreads[i]);
+	}
+	m_PrefetchThreads.clear();
+
+	for(size_t i=0; i < m_BlockPrefetch.size(); i++)
+	{
+		FreeAlignedBuffer(m_BlockPrefetch[i].data);
+		SAFE_DELETE_ARRAY(m_BlockPrefetch[i].scratch);
+	}
+	m_BlockPrefetch.clear();
+}
+
+void Serialiser::PrefetchThreadEntry(void *param)
+{
+	((Serialiser *)param)->PrefetchThread();
+}
+
+void Serialiser::PrefetchThread()
+{
+	// each worker reads through its own handle, so none of them share a file position
+	FILE *f = FileIO::fopen(m_Filename.c_str(), "rb");
+
+	if(f == NULL)
+		return;
+
+	const uint64_t numSlots = (uint64_t)m_BlockPrefetch.size();
+	const uint64_t numBlocks = (uint64_t)m_BlockOffsets.size();
+
+	uint32_t idlePolls = 0;
+
+	while(!m_PrefetchKillSignal)
+	{
+		PrefetchedBlock *block = NULL;
+		uint64_t blockIdx = 0;
+		uint32_t generation = 0;
+
+		{
+			SCOPED_LOCK(m_PrefetchLock);
+
+			if(m_PrefetchNext < numBlocks && m_PrefetchNext < m_PrefetchBase+numSlots &&
+				 !m_BlockPrefetch[(size_t)(m_PrefetchNext%numSlots)].busy)
+			{
+				blockIdx = m_PrefetchNext++;
+				generation = m_PrefetchGeneration;
+
+				block = &m_BlockPrefetch[(size_t)(blockIdx%numSlots)];
+				block->idx = blockIdx;
+				block->busy = true;
+				block->ready = false;
+			}
+		}
+
+		if(block == NULL)
+		{
+			// poll quickly while the reader is moving, and back off once it's gone idle
+			idlePolls++;
+			Threading::Sleep(idlePolls > 100 ? 10 : 1);
+			continue;
+		}
+
+		idlePolls = 0;
+
+		// only the reader swaps the slot's data, and never while it's busy
+		bool valid = ReadBlockSource(f, blockIdx, block->scratch, block->sizes) &&
+			DecompressBlock(m_Archived, block->scratch, block->sizes[0], block->data, m_BlockSize, block->sizes[1]);
+
+		{
+			SCOPED_LOCK(m_PrefetchLock);
+
+			block->busy = false;
+
+			if(generation == m_PrefetchGeneration)
+			{
+				block->ready = true;
+				block->valid = valid;
+			}
+			else
+			{
+				block->idx = ~0ULL;
+			}
+		}
+	}
+
+	FileIO::fclose(f);
 }
 
-void Serialiser::CreateResolver(void *ths)
-{
-	Serialiser *ser = (Serialiser *)ths;
-	FILE *binFile = FileIO::fopen(ser->m_Filename.c_str(), "rb");
+bool Serialiser::TakePrefetchedBlock(uint64_t blockIdx, bool sequential, bool &valid)
+{
+	const uint64_t numSlots = (uint64_t)m_BlockPrefetch.size();
+
+	PrefetchedBlock &block = m_BlockPrefetch[(size_t)(blockIdx%numSlots)];
+
+	m_PrefetchLock.Lock();
+
+	if(blockIdx >= m_PrefetchBase && blockIdx < m_PrefetchNext && block.idx == blockIdx)
+	{
+		// a worker has claimed it, it might not have finished yet
+		while(!block.ready)
+		{
+			m_PrefetchLock.Unlock();
+			Threading::Sleep(0);
+			m_PrefetchLock.Lock();
+		}
+
+		// take over the decompressed data, the slot gets the old block's buffer
+		std::swap(m_BlockData, block.data);
+		m_BlockLength = block.sizes[1];
+		valid = block.valid;
+
+		block.idx = ~0ULL;
+		block.ready = false;
+
+		// frees up a slot for the workers to carry on with
+		m_PrefetchBase = blockIdx+1;
+
+		m_PrefetchLock.Unlock();
+
+		return true;
+	}
+
+	// the workers haven't got to this block. Throw away whatever they've done, then have them
+	// start again after this block if the reader is moving straight through, or wait for the
+	// next time it is if this is a seek.
+	m_PrefetchGeneration++;
+	m_PrefetchBase = m_PrefetchNext = sequential ? blockIdx+1 : (uint64_t)m_BlockOffsets.size();
+
+	for(size_t i=0; i < m_BlockPrefetch.size(); i++)
+	{
+		if(!m_BlockPrefetch[i].busy)
+		{
+			m_BlockPrefetch[i].idx = ~0ULL;
+			m_BlockPrefetch[i].ready = false;
+		}
+	}
+
+	m_PrefetchLock.Unlock();
+
+	return false;
+}
+
+bool Serialiser::LoadBlock(uint64_t blockIdx)
+{
+	// reads are mostly sequential, so we typically hit the same block repeatedly
+	if(blockIdx == m_BlockIdx)
+		return true;
+
+	if(blockIdx >= m_BlockOffsets.size())
+	{
+		RDCERR("Reading compressed block %llu past end of capture file (%llu blocks)", blockIdx, (uint64_t)m_BlockOffsets.size());
+		return false;
+	}
+
+	// moving straight on from the previous block, so the reader will most likely continue
+	// through the following ones too. Start workers decompressing ahead of it.
+	bool sequential = (m_BlockIdx != ~0ULL && blockIdx == m_BlockIdx+1);
+
+	if(sequential && m_BlockPrefetch.empty() && m_ReadFileHandle)
+		StartPrefetch();
+
+	bool valid = false;
+
+	if(!m_BlockPrefetch.empty() && TakePrefetchedBlock(blockIdx, sequential, valid))
+	{
+		if(!valid)
+		{
+			RDCERR("Failed to decompress block %llu, expected %u bytes", blockIdx, (uint32_t)m_BlockLength);
+			m_BlockIdx = ~0ULL;
+			return false;
+		}
+
+		m_BlockIdx = blockIdx;
+
+		return true;
+	}
+
+	uint32_t sizes[2] = { 0, 0 };
+
+	if(!ReadBlockSource(m_ReadFileHandle, blockIdx, m_BlockScratch, sizes))
+	{
+		m_BlockIdx = ~0ULL;
+		return false;
+	}
+
+	if(!DecompressBlock(m_Archived, m_BlockScratch, sizes[0], m_BlockData, m_BlockSize, sizes[1]))
+	{
+		RDCERR("Failed to decompress block %llu, expected %u bytes", blockIdx, sizes[1]);
+		m_BlockIdx = ~0ULL;
+		return false;
+	}
+
+	m_BlockIdx = blockIdx;
+	m_BlockLength = sizes[1];
+
+	return true;
+}
+
+void Serialiser::WriteStream(FILE *f, const void *data, size_t len)
+{
+	if(!m_Compressed)
+	{
+		FileIO::fwrite(data, 1, len, f);
+		return;
+	}
+
+	const byte *src = (const byte *)data;
+
+	while(len > 0)
+	{
+		size_t copyLen = RDCMIN(len, m_BlockSize-m_BlockLength);
+
+		memcpy(m_BlockData + m_BlockLength, src, copyLen);
+
+		m_BlockLength += copyLen;
+		src += copyLen;
+		len -= copyLen;
+
+		if(m_BlockLength == m_BlockSize)
+			FlushStreamBlock(f);
+	}
+}
+
+void Serialiser::FlushStreamBlock(FILE *f)
+{
+	if(m_BlockLength == 0)
+		return;
+
+	m_BlockOffsets.push_back(FileIO::ftell64(f));
+
+	int compSize = LZ4_compress((const char *)m_BlockData, (char *)m_BlockScratch, (int)m_BlockLength);
+
+	uint32_t sizes[2] = { (uint32_t)compSize, (uint32_t)m_BlockLength };
+
+	FileIO::fwrite(sizes, sizeof(uint32_t), 2, f);
+	FileIO::fwrite(m_BlockScratch, 1, (size_t)compSize, f);
+
+	m_BlockLength = 0;
+}
+
+byte *Serialiser::AllocAlignedBuffer(size_t size, size_t alignment)
+{
+	byte *rawAlloc = NULL;
+	
+#if defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+	try
+#endif
+	{
+		rawAlloc = new byte[size+sizeof(byte*)+alignment];
+	}
+#if defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+	catch(std::bad_alloc&)
+	{
+		rawAlloc = NULL;
+	}
+#endif
+
+	if(rawAlloc == NULL)
+		RDCFATAL("Allocation for %llu bytes failed", (uint64_t)size);
+
+	RDCASSERT(rawAlloc);
+
+	byte *alignedAlloc = (byte *)AlignUp((size_t)(rawAlloc+sizeof(byte*)), alignment);
+
+	byte **realPointer = (byte **)alignedAlloc;
+	realPointer[-1] = rawAlloc;
+
+	return alignedAlloc;
+}
+
+void Serialiser::FreeAlignedBuffer(byte *buf)
+{
+	if(buf == NULL) return;
+
+	byte **realPointer = (byte **)buf;
+	byte *rawAlloc = realPointer[-1];
+
+	delete[] rawAlloc;
+}
+
+void Serialiser::InitCallstackResolver()
+{
+	if(m_pResolver == NULL && m_ResolverThread == 0)
+	{
+		m_ResolverThreadKillSignal = false;
+		m_ResolverThread = Threading::CreateThread(&Serialiser::CreateResolver, (void *)this);
+	}
+}
+
+void Serialiser::SetCallstack(uint64_t *levels, size_t numLevels)
+{
+	SAFE_DELETE(m_pCallstack);
+
+	if(levels != NULL && numLevels != 0)
+		m_pCallstack = Callstack::Load(levels, numLevels);
+}
+
+// every distinct callstack collected in this process, indexed by the IDs written into chunks
+static Threading::CriticalSection s_CallstackLock;
+static vector< vector<uint64_t> > s_Callstacks;
+static map<uint64_t, uint32_t> s_CallstackHashes;
+
+static void WriteCallstackTable(FILE *f, const vector< vector<uint64_t> > &table)
+{
+	uint64_t numCallstacks = (uint64_t)table.size();
+	FileIO::fwrite(&numCallstacks, sizeof(uint64_t), 1, f);
+
+	for(size_t i=0; i < table.size(); i++)
+	{
+		uint64_t numLevels = (uint64_t)table[i].size();
+		FileIO::fwrite(&numLevels, sizeof(uint64_t), 1, f);
+		if(numLevels > 0)
+			FileIO::fwrite(&table[i][0], sizeof(uint64_t), table[i].size(), f);
+	}
+}
+
+uint32_t Serialiser::RegisterCallstack(Callstack::Stackwalk *call)
+{
+	const uint64_t *addrs = call->GetAddrs();
+	size_t numLevels = call->NumLevels();
+
+	// FNV-1a over the addresses
+	uint64_t hash = 14695981039346656037ULL;
+	for(size_t i=0; i < numLevels; i++)
+	{
+		hash ^= addrs[i];
+		hash *= 1099511628211ULL;
+	}
+
+	SCOPED_LOCK(s_CallstackLock);
+
+	map<uint64_t, uint32_t>::iterator it = s_CallstackHashes.find(hash);
+	if(it != s_CallstackHashes.end())
+	{
+		const vector<uint64_t> &existing = s_Callstacks[it->second];
+		if(existing.size() == numLevels &&
+		   (numLevels == 0 || memcmp(&existing[0], addrs, numLevels*sizeof(uint64_t)) == 0))
+			return it->second;
+	}
+
+	uint32_t id = (uint32_t)s_Callstacks.size();
+	s_Callstacks.push_back(vector<uint64_t>(addrs, addrs+numLevels));
+
+	// on a hash collision the first callstack keeps the entry, later ones just aren't deduplicated
+	if(it == s_CallstackHashes.end())
+		s_CallstackHashes[hash] = id;
+
+	return id;
+}
+
+void Serialiser::SetCallstackFromTable(uint32_t callstackID)
+{
+	if(callstackID < m_CallstackTable.size() && !m_CallstackTable[callstackID].empty())
+		SetCallstack(&m_CallstackTable[callstackID][0], m_CallstackTable[callstackID].size());
+	else
+		SetCallstack(NULL, 0);
+}
+
+void Serialiser::SerialiseCallstack()
+{
+	uint32_t callstackID = 0;
+
+	if(m_Mode >= WRITING)
+	{
+		SCOPED_OVERHEAD(eOverhead_Callstack);
+		Callstack::Stackwalk *call = Callstack::Collect();
+
+		RDCASSERT(call->NumLevels() < 0xff);
+
+		callstackID = RegisterCallstack(call);
+
+		SAFE_DELETE(call);
+	}
+
+	if(m_Mode == READING && m_FileVersion < 0x00000034)
+	{
+		// older logs store the callstack inline
+		size_t numLevels = 0;
+		uint64_t *stack = NULL;
+
+		Serialise("callstack", stack, numLevels);
+
+		SetCallstack(stack, numLevels);
+
+		SAFE_DELETE_ARRAY(stack);
+		return;
+	}
+
+	Serialise("callstackID", callstackID);
+
+	if(m_Mode == READING)
+		SetCallstackFromTable(callstackID);
+}
+
+void Serialiser::CreateResolver(void *ths)
+{
+	Serialiser *ser = (Serialiser *)ths;
+	FILE *binFile = FileIO::fopen(ser->m_Filename.c_str(), "rb");
+
+	if(!binFile)
+	{
+		RDCERR("Can't open capture file '%s' for read - errno %d", ser->m_Filename.c_str(), errno);
+		return;
+	}
+	
+	DebuggerHeader header;
+	FileIO::fread(&header, 1, sizeof(DebuggerHeader), binFile);
+
+	if(header.magic != MAGIC_HEADER)
+	{
+		RDCERR("Invalid capture file. Expected 0x%08lx, got 0x%08llx", MAGIC_HEADER, header.magic);
+		FileIO::fclose(binFile);
+		return;
+	}
+
+	size_t headerSize = CheckHeader(header);
+
+	if(headerSize == 0)
+	{
+		FileIO::fclose(binFile);
+		return;
+	}
+
+	FileIO::fseek64(binFile, 0, SEEK_END);
+
+	uint64_t realLength = FileIO::ftell64(binFile);
+	if(header.fileSize != realLength)
+	{
+		RDCERR("Truncated/overlong capture file. Expected length 0x08llx, got 0x08lx", header.fileSize, realLength);
+		FileIO::fclose(binFile);
+		return;
+	}
+
+	if(header.resolveDBSize == 0)
+	{
+		RDCWARN("Trying to create resolver when no resolve DB is in the capture file");
+		FileIO::fclose(binFile);
+		return;
+	}
+
+	FileIO::fseek64(binFile, headerSize, SEEK_SET);
+
+	RDCASSERT(header.resolveDBSize < 0xffffffff);
+
+	char *resolveDB = new char[(size_t)header.resolveDBSize];
+
+	FileIO::fread(resolveDB, 1, (size_t)header.resolveDBSize, binFile);
+
+	FileIO::fclose(binFile);
+		
+	string dir = dirname(ser->m_Filename);
+
+	Callstack::StackResolver *resolver = Callstack::MakeResolver(resolveDB, (size_t)header.resolveDBSize, dir, &ser->m_ResolverThreadKillSignal);
+
+	// resolve every address in the capture's callstacks up front while we're still on the
+	// resolver thread, so that browsing callstacks later doesn't wait on symbol lookups.
+	if(resolver && !ser->m_CallstackTable.empty())
+	{
+		SCOPED_PROFILE("Callstack prefetch");
+
+		vector<uint64_t> addrs;
+		for(size_t i=0; i < ser->m_CallstackTable.size(); i++)
+			addrs.insert(addrs.end(), ser->m_CallstackTable[i].begin(), ser->m_CallstackTable[i].end());
+
+		std::sort(addrs.begin(), addrs.end());
+		addrs.erase(std::unique(addrs.begin(), addrs.end()), addrs.end());
+
+		const size_t batchSize = 256;
+		vector<Callstack::AddressDetails> details(batchSize);
+
+		for(size_t i=0; i < addrs.size() && !ser->m_ResolverThreadKillSignal; i += batchSize)
+			resolver->GetAddrs(&addrs[i], RDCMIN(batchSize, addrs.size()-i), &details[0]);
+	}
+
+	ser->m_pResolver = resolver;
+
+	SAFE_DELETE_ARRAY(resolveDB);
+}
+
+void Serialiser::TakeOwnershipOfChunks()
+{
+	for(size_t i=0; i < m_Chunks.size(); i++)
+	{
+		if(!m_Chunks[i]->IsTemporary())
+			m_Chunks[i] = m_Chunks[i]->Duplicate();
+	}
+}
+
+size_t Serialiser::EncodePadding(uint64_t offs, byte *padding)
+{
+	uint64_t alignedoffs = AlignUp16(offs);
+
+	if(offs == alignedoffs)
+		return 0;
+
+	size_t len = 0;
+
+	uint16_t chunkIdx = 0; // write a '0' chunk that indicates special behaviour
+	memcpy(padding+len, &chunkIdx, sizeof(chunkIdx));
+	len += sizeof(chunkIdx);
+
+	uint8_t controlByte = 0; // control byte 0 indicates padding
+	padding[len++] = controlByte;
+
+	len++; // we will have to write out a byte indicating how much padding exists, so add 1
+	alignedoffs = AlignUp16(offs+len);
+
+	RDCCOMPILE_ASSERT(BufferAlignment < 0x100, "Buffer alignment must be less than 256"); // with a byte at most indicating how many bytes to pad,
+	// this is our maximal representable alignment
+
+	uint8_t padLength = (alignedoffs-(offs+len))&0xff;
+	padding[len-1] = padLength;
+
+	// we might have padded with the control bytes, so only write some bytes if we need to
+	memset(padding+len, 0, padLength);
+	len += padLength;
+
+	return len;
+}
+
+uint64_t Serialiser::WriteSpilledChunks(FILE *f, uint64_t offs, uint64_t streamStart, vector<ChunkIndexEntry> &chunkIndex)
+{
+	ChunkSpillWriter *spill = m_SpilledChunks;
+	m_SpilledChunks = NULL;
+
+	spill->Finish();
+
+	if(spill->HasError())
+	{
+		RDCERR("Chunks spilled during capture couldn't be written to '%s', capture will be incomplete", spill->GetFilename());
+		return offs;
+	}
+
+	FILE *spillFile = FileIO::fopen(spill->GetFilename(), "rb");
+
+	if(!spillFile)
+	{
+		RDCERR("Can't open spilled chunks file '%s', errno %d", spill->GetFilename(), errno);
+		return offs;
+	}
+
+	// the spilled stream was encoded from an aligned offset, so align here to keep
+	// any aligned chunks within it aligned.
+	byte padChunk[BufferAlignment+4];
+	size_t padLen = EncodePadding(offs, padChunk);
+
+	WriteStream(f, padChunk, padLen);
+	offs += padLen;
+
+	const vector<ChunkIndexEntry> &spillIndex = spill->GetChunkIndex();
+
+	for(size_t i=0; i < spillIndex.size(); i++)
+	{
+		ChunkIndexEntry entry = spillIndex[i];
+		entry.offset += offs - streamStart;
+		chunkIndex.push_back(entry);
+	}
+
+	const size_t copySize = 1024*1024;
+	byte *copyBuf = new byte[copySize];
+
+	uint64_t remaining = spill->GetStreamSize();
+
+	while(remaining > 0)
+	{
+		size_t len = (size_t)RDCMIN((uint64_t)copySize, remaining);
+		size_t numRead = FileIO::fread(copyBuf, 1, len, spillFile);
+
+		if(numRead != len)
+		{
+			RDCERR("Failed to read spilled chunks with %llu bytes remaining", remaining);
+
+			// fill with zeroes so the index and stream size remain consistent
+			memset(copyBuf+numRead, 0, len-numRead);
+		}
+
+		WriteStream(f, copyBuf, len);
+		remaining -= len;
+	}
+
+	offs += spill->GetStreamSize();
+
+	SAFE_DELETE_ARRAY(copyBuf);
+
+	FileIO::fclose(spillFile);
+
+	RDCDEBUG("Stitched in %llu spilled chunks, %llu bytes", (uint64_t)spillIndex.size(), spill->GetStreamSize());
+
+	return offs;
+}
+
+uint64_t Serialiser::FlushToDisk()
+{
+	SCOPED_PROFILE("FlushToDisk");
+
+	if(m_Filename != "" && !m_HasError && m_Mode == WRITING)
+	{
+		RDCDEBUG("writing capture files");
+
+		if(m_DebugEnabled && !m_DebugText.empty())
+		{
+			FILE *dbgFile = FileIO::fopen((m_Filename + ".txt").c_str(), "wb");
+
+			if(!dbgFile)
+			{
+				RDCERR("Can't open debug capture file '%s'", (m_Filename + ".txt").c_str());
+			}
+			else
+			{
+				FileIO::fwrite(m_DebugText.c_str(), 1, m_DebugText.length(), dbgFile);
+
+				FileIO::fclose(dbgFile);
+			}
+		}
+
+		FILE *binFile = FileIO::fopen(m_Filename.c_str(), "wb");
+
+		if(!binFile)
+		{
+			RDCERR("Can't open capture file '%s' for write, errno %d", m_Filename.c_str(), errno);
+			m_ErrorCode = eSerError_FileIO;
+			m_HasError = true;
+			return 0;
+		}
+
+		RDCDEBUG("Opened capture file for write");
+
+		DebuggerHeader header;
+		
+		char *symbolDB = NULL;
+		size_t symbolDBSize = 0;
+
+		if(RenderDoc::Inst().GetCaptureOptions().CaptureCallstacks ||
+			RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws)
+		{
+			// get symbol database
+			Callstack::GetLoadedModules(symbolDB, symbolDBSize);
+
+			symbolDB = new char[symbolDBSize];
+			symbolDBSize = 0;
+
+			Callstack::GetLoadedModules(symbolDB, symbolDBSize);
+		}
+
+		header.resolveDBSize = symbolDBSize;
+
+		// write header
+		FileIO::fwrite(&header, 1, sizeof(DebuggerHeader), binFile);
+		
+		// write symbol database
+		if(symbolDBSize > 0)
+			FileIO::fwrite(symbolDB, 1, symbolDBSize, binFile);
+		
+		static const byte padding[BufferAlignment] = {0};
+
+		uint64_t offs = sizeof(DebuggerHeader) + symbolDBSize;
+		uint64_t alignedoffs = AlignUp16(offs);
+
+		FileIO::fwrite(padding, 1, (size_t)(alignedoffs-offs), binFile);
+
+		offs = alignedoffs;
+
+		uint64_t streamStart = offs;
+
+		vector<ChunkIndexEntry> chunkIndex;
+		chunkIndex.reserve(m_Chunks.size());
+
+		if(m_Compressed)
+		{
+			m_BlockSize = CompressedBlockSize;
+			m_BlockOffsets.clear();
+			m_BlockData = AllocAlignedBuffer(m_BlockSize);
+			m_BlockScratchSize = (size_t)LZ4_compressBound((int)m_BlockSize);
+			m_BlockScratch = new byte[m_BlockScratchSize];
+			m_BlockLength = 0;
+		}
+
+		// write serialise contents
+		for(size_t i=0; i < m_Chunks.size(); i++)
+		{
+			Chunk *chunk = m_Chunks[i];
+
+			if(chunk->IsAligned())
+			{
+				byte padChunk[BufferAlignment+4];
+				size_t padLen = EncodePadding(offs, padChunk);
+
+				WriteStream(binFile, padChunk, padLen);
+				offs += padLen;
+			}
+			
+			ChunkIndexEntry entry = { offs - streamStart, chunk->GetChunkType(), chunk->GetLength() };
+			chunkIndex.push_back(entry);
+
+			if(chunk->HasPayloads())
+			{
+				for(size_t s=0; s < chunk->NumSegments(); s++)
+				{
+					size_t segLen = 0;
+					const byte *seg = chunk->GetSegment(s, segLen);
+					WriteStream(binFile, seg, segLen);
+				}
+			}
+			else
+			{
+				WriteStream(binFile, chunk->GetData(), chunk->GetLength());
+			}
+
+			offs += chunk->GetLength();
+
+			if(chunk->IsTemporary())
+				SAFE_DELETE(chunk);
+		}
+
+		m_Chunks.clear();
+
+		if(m_SpilledChunks)
+			offs = WriteSpilledChunks(binFile, offs, streamStart, chunkIndex);
+
+		header.streamSize = offs - streamStart;
+		header.fileSize = offs;
+
+		if(m_Compressed)
+		{
+			FlushStreamBlock(binFile);
+
+			header.flags |= eHeaderFlag_Compressed;
+			header.blockTableOffset = FileIO::ftell64(binFile);
+
+			uint64_t table[2] = { (uint64_t)m_BlockSize, (uint64_t)m_BlockOffsets.size() };
+			FileIO::fwrite(table, sizeof(uint64_t), 2, binFile);
+			if(!m_BlockOffsets.empty())
+				FileIO::fwrite(&m_BlockOffsets[0], sizeof(uint64_t), m_BlockOffsets.size(), binFile);
+
+			header.fileSize = FileIO::ftell64(binFile);
+
+			RDCDEBUG("Compressed %llu byte chunk stream into %llu blocks, %llu bytes on disk", header.streamSize, (uint64_t)m_BlockOffsets.size(), header.fileSize);
+
+			FreeBlockData();
+			m_BlockOffsets.clear();
+		}
+
+		// write the callstack table that chunks refer to, if callstacks were captured
+		if(symbolDB)
+		{
+			FileIO::fseek64(binFile, header.fileSize, SEEK_SET);
+
+			header.callstackTableOffset = header.fileSize;
+
+			{
+				SCOPED_LOCK(s_CallstackLock);
+				WriteCallstackTable(binFile, s_Callstacks);
+			}
+
+			header.fileSize = FileIO::ftell64(binFile);
+		}
+
+		// write the chunk index so readers can seek without scanning the whole stream
+		{
+			FileIO::fseek64(binFile, header.fileSize, SEEK_SET);
+
+			header.chunkIndexOffset = header.fileSize;
+
+			uint64_t numEntries = (uint64_t)chunkIndex.size();
+			FileIO::fwrite(&numEntries, sizeof(uint64_t), 1, binFile);
+			if(!chunkIndex.empty())
+				FileIO::fwrite(&chunkIndex[0], sizeof(ChunkIndexEntry), chunkIndex.size(), binFile);
+
+			header.fileSize += sizeof(uint64_t) + sizeof(ChunkIndexEntry)*chunkIndex.size();
+		}
+
+		FileIO::fseek64(binFile, 0, SEEK_SET);
+		
+		// write header with correct filesize (accounting for all padding)
+		FileIO::fwrite(&header, 1, sizeof(DebuggerHeader), binFile);
+
+		FileIO::fclose(binFile);
+
+		SAFE_DELETE_ARRAY(symbolDB);
+
+		return header.fileSize;
+	}
+
+	return 0;
+}
+
+namespace
+{
+// random values for each byte, used by the rolling hash that finds archive block boundaries.
+// They only need to be fixed within one run - the boundaries aren't needed to read an archive
+struct ArchiveGearTable
+{
+	ArchiveGearTable()
+	{
+		uint64_t x = 0x9e3779b97f4a7c15ULL;
+		for(int i=0; i < 256; i++)
+		{
+			x ^= x << 13;
+			x ^= x >> 7;
+			x ^= x << 17;
+			gear[i] = x;
+		}
+	}
+
+	uint64_t gear[256];
+};
+
+uint64_t HashArchiveBlock(const byte *data, size_t len)
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ULL;
+	for(size_t i=0; i < len; i++)
+	{
+		hash ^= data[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+};
+
+bool Serialiser::WriteArchive(const char *srcPath, const char *dstPath)
+{
+	Serialiser src(srcPath, READING, false);
+
+	if(src.HasError())
+		return false;
+
+	// the header and chunk stream are copied across as they are, so must already be current
+	if(src.GetFileVersion() != SERIALISE_VERSION)
+	{
+		RDCERR("Can't archive capture file '%s' from old logfile version %llu", srcPath, src.GetFileVersion());
+		return false;
+	}
+
+	// the header and symbol database are carried across as-is
+	DebuggerHeader header;
+	vector<byte> symbolDB;
+
+	{
+		FILE *f = FileIO::fopen(srcPath, "rb");
+
+		if(!f)
+		{
+			RDCERR("Can't open capture file '%s' for read - errno %d", srcPath, errno);
+			return false;
+		}
+
+		FileIO::fread(&header, 1, sizeof(DebuggerHeader), f);
+
+		symbolDB.resize((size_t)header.resolveDBSize);
+		if(!symbolDB.empty())
+			FileIO::fread(&symbolDB[0], 1, symbolDB.size(), f);
+
+		FileIO::fclose(f);
+	}
+
+	// uncompressed files don't distinguish the stream from the chunk index after it
+	uint64_t streamSize = header.streamSize > 0 ? header.streamSize : src.m_BufferSize;
+
+	vector<ChunkIndexEntry> chunkIndex = src.GetChunkIndex();
+
+	FILE *binFile = FileIO::fopen(dstPath, "w+b");
+
+	if(!binFile)
+	{
+		RDCERR("Can't open archive file '%s' for write - errno %d", dstPath, errno);
+		return false;
+	}
+
+	header.flags = eHeaderFlag_Compressed|eHeaderFlag_Archived;
+	header.streamSize = streamSize;
+
+	FileIO::fwrite(&header, 1, sizeof(DebuggerHeader), binFile);
+
+	if(!symbolDB.empty())
+		FileIO::fwrite(&symbolDB[0], 1, symbolDB.size(), binFile);
+
+	{
+		static const byte padding[BufferAlignment] = {0};
+
+		uint64_t offs = sizeof(DebuggerHeader) + symbolDB.size();
+		FileIO::fwrite(padding, 1, (size_t)(AlignUp16(offs)-offs), binFile);
+	}
+
+	static ArchiveGearTable gearTable;
+	const uint64_t *gear = gearTable.gear;
+
+	// holds the next ArchiveMaxBlockSize bytes of the stream, so every boundary can be found
+	byte *window = new byte[ArchiveMaxBlockSize];
+	byte *compare = new byte[ArchiveMaxBlockSize];
+	mz_ulong scratchSize = mz_compressBound((mz_ulong)ArchiveMaxBlockSize);
+	byte *scratch = new byte[scratchSize];
+	size_t windowLen = 0;
+
+	vector<uint64_t> blockOffsets, blockStarts;
+	map<uint64_t, vector<size_t> > blocksByHash;
+
+	uint64_t uniqueBytes = 0;
+	uint64_t offs = 0;
+	bool success = true;
+
+	while(offs < streamSize)
+	{
+		// top up the window
+		size_t fill = (size_t)RDCMIN((uint64_t)(ArchiveMaxBlockSize - windowLen), streamSize - offs - windowLen);
+		if(fill > 0 && !src.ReadStreamData(offs + windowLen, window + windowLen, fill))
+		{
+			RDCERR("Failed to read capture file '%s' at %llu", srcPath, offs + windowLen);
+			success = false;
+			break;
+		}
+		windowLen += fill;
+
+		// find the end of this block
+		size_t blockLen = windowLen;
+		if(windowLen > ArchiveMinBlockSize)
+		{
+			uint64_t hash = 0;
+			for(size_t i=0; i < windowLen; i++)
+			{
+				hash = (hash << 1) + gear[window[i]];
+				if(i+1 >= ArchiveMinBlockSize && (hash & ArchiveBoundaryMask) == 0)
+				{
+					blockLen = i+1;
+					break;
+				}
+			}
+		}
+
+		uint64_t hash = HashArchiveBlock(window, blockLen);
+
+		// see if we've already stored the same contents
+		uint64_t fileOffset = 0;
+		bool duplicate = false;
+
+		vector<size_t> &candidates = blocksByHash[hash];
+		for(size_t c=0; c < candidates.size() && !duplicate; c++)
+		{
+			size_t idx = candidates[c];
+			uint64_t start = blockStarts[idx];
+			uint64_t end = idx+1 < blockStarts.size() ? blockStarts[idx+1] : offs;
+
+			if(end-start != blockLen)
+				continue;
+
+			if(src.ReadStreamData(start, compare, blockLen) && memcmp(compare, window, blockLen) == 0)
+			{
+				fileOffset = blockOffsets[idx];
+				duplicate = true;
+			}
+		}
+
+		if(!duplicate)
+		{
+			mz_ulong compSize = scratchSize;
+			if(mz_compress2(scratch, &compSize, window, (mz_ulong)blockLen, MZ_BEST_COMPRESSION) != 0)
+			{
+				RDCERR("Failed to compress archive block at %llu", offs);
+				success = false;
+				break;
+			}
+
+			fileOffset = FileIO::ftell64(binFile);
+
+			uint32_t sizes[2] = { (uint32_t)compSize, (uint32_t)blockLen };
+			FileIO::fwrite(sizes, sizeof(uint32_t), 2, binFile);
+			FileIO::fwrite(&offs, sizeof(uint64_t), 1, binFile);
+			FileIO::fwrite(scratch, 1, (size_t)compSize, binFile);
+
+			candidates.push_back(blockOffsets.size());
+			uniqueBytes += blockLen;
+		}
 
-	if(!binFile)
-	{
-		RDCERR("Can't open capture file '%s' for read - errno %d", ser->m_Filename.c_str(), errno);
-		return;
-	}
-	
-	DebuggerHeader header;
-	FileIO::fread(&header, 1, sizeof(DebuggerHeader), binFile);
+		blockOffsets.push_back(fileOffset);
+		blockStarts.push_back(offs);
 
-	if(header.magic != MAGIC_HEADER)
-	{
-		RDCERR("Invalid capture file. Expected 0x%08lx, got 0x%08llx", MAGIC_HEADER, header.magic);
-		FileIO::fclose(binFile);
-		return;
+		offs += blockLen;
+		windowLen -= blockLen;
+		memmove(window, window + blockLen, windowLen);
 	}
 
-	if(header.version != SERIALISE_VERSION)
+	SAFE_DELETE_ARRAY(window);
+	SAFE_DELETE_ARRAY(compare);
+	SAFE_DELETE_ARRAY(scratch);
+
+	if(!success)
 	{
-		RDCERR("Capture file from wrong version. This program is logfile version %llu, file is logfile version %llu", SERIALISE_VERSION, header.version);
 		FileIO::fclose(binFile);
-		return;
+		FileIO::Delete(dstPath);
+		return false;
 	}
 
-	FileIO::fseek64(binFile, 0, SEEK_END);
+	header.blockTableOffset = FileIO::ftell64(binFile);
 
-	uint64_t realLength = FileIO::ftell64(binFile);
-	if(header.fileSize != realLength)
+	uint64_t table[2] = { (uint64_t)ArchiveMaxBlockSize, (uint64_t)blockOffsets.size() };
+	FileIO::fwrite(table, sizeof(uint64_t), 2, binFile);
+	if(!blockOffsets.empty())
 	{
-		RDCERR("Truncated/overlong capture file. Expected length 0x08llx, got 0x08lx", header.fileSize, realLength);
-		FileIO::fclose(binFile);
-		return;
+		FileIO::fwrite(&blockOffsets[0], sizeof(uint64_t), blockOffsets.size(), binFile);
+		FileIO::fwrite(&blockStarts[0], sizeof(uint64_t), blockStarts.size(), binFile);
 	}
 
-	if(header.resolveDBSize == 0)
+	header.callstackTableOffset = 0;
+	if(!src.m_CallstackTable.empty())
 	{
-		RDCWARN("Trying to create resolver when no resolve DB is in the capture file");
-		FileIO::fclose(binFile);
-		return;
+		header.callstackTableOffset = FileIO::ftell64(binFile);
+		WriteCallstackTable(binFile, src.m_CallstackTable);
 	}
 
-	FileIO::fseek64(binFile, sizeof(DebuggerHeader), SEEK_SET);
+	header.chunkIndexOffset = FileIO::ftell64(binFile);
 
-	RDCASSERT(header.resolveDBSize < 0xffffffff);
+	uint64_t numEntries = (uint64_t)chunkIndex.size();
+	FileIO::fwrite(&numEntries, sizeof(uint64_t), 1, binFile);
+	if(!chunkIndex.empty())
+		FileIO::fwrite(&chunkIndex[0], sizeof(ChunkIndexEntry), chunkIndex.size(), binFile);
 
-	char *resolveDB = new char[(size_t)header.resolveDBSize];
+	header.fileSize = FileIO::ftell64(binFile);
 
-	FileIO::fread(resolveDB, 1, (size_t)header.resolveDBSize, binFile);
+	FileIO::fseek64(binFile, 0, SEEK_SET);
+	FileIO::fwrite(&header, 1, sizeof(DebuggerHeader), binFile);
 
 	FileIO::fclose(binFile);
-		
-	string dir = dirname(ser->m_Filename);
-
-	Callstack::StackResolver *resolver = Callstack::MakeResolver(resolveDB, (size_t)header.resolveDBSize, dir, &ser->m_ResolverThreadKillSignal);
 
-	ser->m_pResolver = resolver;
+	RDCLOG("Archived %llu byte chunk stream into %llu blocks (%llu bytes unique), %llu bytes on disk",
+	       streamSize, (uint64_t)blockOffsets.size(), uniqueBytes, header.fileSize);
 
-	SAFE_DELETE_ARRAY(resolveDB);
+	return true;
 }
 
-uint64_t Serialiser::FlushToDisk()
+ChunkSpillWriter::ChunkSpillWriter(const char *filename, uint64_t highWaterMark)
 {
-	if(m_Filename != "" && !m_HasError && m_Mode == WRITING)
-	{
-		RDCDEBUG("writing capture files");
-
-		if(m_DebugEnabled && !m_DebugText.empty())
-		{
-			FILE *dbgFile = FileIO::fopen((m_Filename + ".txt").c_str(), "wb");
+	m_Filename = filename;
+	m_HasError = false;
+	m_Offset = 0;
+	m_HighWaterMark = highWaterMark;
+	m_QueuedBytes = 0;
+	m_Thread = 0;
+	m_Finishing = false;
 
-			if(!dbgFile)
-			{
-				RDCERR("Can't open debug capture file '%s'", (m_Filename + ".txt").c_str());
-			}
-			else
-			{
-				FileIO::fwrite(m_DebugText.c_str(), 1, m_DebugText.length(), dbgFile);
+	m_File = FileIO::fopen(filename, "wb");
 
-				FileIO::fclose(dbgFile);
-			}
-		}
+	if(!m_File)
+	{
+		RDCERR("Can't open spilled chunks file '%s' for write, errno %d", filename, errno);
+		m_HasError = true;
+		return;
+	}
 
-		FILE *binFile = FileIO::fopen(m_Filename.c_str(), "wb");
+	m_Thread = Threading::CreateThread(&ChunkSpillWriter::WriterThreadEntry, this);
 
-		if(!binFile)
-		{
-			RDCERR("Can't open capture file '%s' for write, errno %d", m_Filename.c_str(), errno);
-			m_ErrorCode = eSerError_FileIO;
-			m_HasError = true;
-			return 0;
-		}
+	if(m_Thread == 0)
+	{
+		RDCERR("Couldn't start thread to write spilled chunks");
+		m_HasError = true;
+	}
+}
 
-		RDCDEBUG("Opened capture file for write");
+ChunkSpillWriter::~ChunkSpillWriter()
+{
+	Finish();
 
-		DebuggerHeader header;
-		
-		char *symbolDB = NULL;
-		size_t symbolDBSize = 0;
+	FileIO::Delete(m_Filename.c_str());
+}
 
-		if(RenderDoc::Inst().GetCaptureOptions().CaptureCallstacks ||
-			RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws)
-		{
-			// get symbol database
-			Callstack::GetLoadedModules(symbolDB, symbolDBSize);
+void ChunkSpillWriter::Append(Chunk *chunk)
+{
+	int64_t len = (int64_t)chunk->GetLength();
 
-			symbolDB = new char[symbolDBSize];
-			symbolDBSize = 0;
+	{
+		SCOPED_LOCK(m_QueueLock);
+		m_Queue.push_back(chunk);
+	}
 
-			Callstack::GetLoadedModules(symbolDB, symbolDBSize);
-		}
+	int64_t queued = Atomic::ExchAdd64(&m_QueuedBytes, len);
 
-		header.resolveDBSize = symbolDBSize;
+	// stall the producer until the writer thread has caught up enough to bring
+	// the memory held by pending chunks back under the high-water mark.
+	while(m_Thread != 0 && queued > (int64_t)m_HighWaterMark)
+	{
+		Threading::Sleep(1);
+		queued = Atomic::ExchAdd64(&m_QueuedBytes, 0);
+	}
+}
 
-		// write header
-		FileIO::fwrite(&header, 1, sizeof(DebuggerHeader), binFile);
-		
-		// write symbol database
-		if(symbolDBSize > 0)
-			FileIO::fwrite(symbolDB, 1, symbolDBSize, binFile);
-		
-		static const byte padding[BufferAlignment] = {0};
+void ChunkSpillWriter::Finish()
+{
+	if(m_Thread != 0)
+	{
+		m_Finishing = true;
 
-		size_t offs = sizeof(DebuggerHeader) + symbolDBSize;
-		size_t alignedoffs = AlignUp16(offs);
+		Threading::JoinThread(m_Thread);
+		Threading::CloseThread(m_Thread);
+		m_Thread = 0;
+	}
 
-		FileIO::fwrite(padding, 1, alignedoffs-offs, binFile);
+	// if the writer thread was never started, just free anything queued
+	{
+		SCOPED_LOCK(m_QueueLock);
+		for(size_t i=0; i < m_Queue.size(); i++)
+			SAFE_DELETE(m_Queue[i]);
+		m_Queue.clear();
+	}
 
-		offs = alignedoffs;
+	if(m_File)
+	{
+		FileIO::fclose(m_File);
+		m_File = NULL;
+	}
+}
 
-		// write serialise contents
-		for(size_t i=0; i < m_Chunks.size(); i++)
-		{
-			Chunk *chunk = m_Chunks[i];
+void ChunkSpillWriter::WriterThreadEntry(void *param)
+{
+	((ChunkSpillWriter *)param)->WriterThread();
+}
 
-			alignedoffs = AlignUp16(offs);
+void ChunkSpillWriter::WriterThread()
+{
+	vector<Chunk *> chunks;
 
-			if(offs != alignedoffs && chunk->IsAligned())
-			{
-				uint16_t chunkIdx = 0; // write a '0' chunk that indicates special behaviour
-				FileIO::fwrite(&chunkIdx, sizeof(chunkIdx), 1, binFile);
-				offs += sizeof(chunkIdx);
+	while(true)
+	{
+		// check this before taking the queue, so that once it's set we know
+		// all chunks have already been appended.
+		bool finishing = m_Finishing;
 
-				uint8_t controlByte = 0; // control byte 0 indicates padding
-				FileIO::fwrite(&controlByte, sizeof(controlByte), 1, binFile);
-				offs += sizeof(controlByte);
+		{
+			SCOPED_LOCK(m_QueueLock);
+			chunks.swap(m_Queue);
+		}
 
-				offs++; // we will have to write out a byte indicating how much padding exists, so add 1
-				alignedoffs = AlignUp16(offs);
+		if(chunks.empty())
+		{
+			if(finishing)
+				break;
 
-				RDCCOMPILE_ASSERT(BufferAlignment < 0x100, "Buffer alignment must be less than 256"); // with a byte at most indicating how many bytes to pad,
-				// this is our maximal representable alignment
+			Threading::Sleep(1);
+			continue;
+		}
 
-				uint8_t padLength = (alignedoffs-offs)&0xff;
-				FileIO::fwrite(&padLength, sizeof(padLength), 1, binFile);
+		for(size_t i=0; i < chunks.size(); i++)
+		{
+			int64_t len = (int64_t)chunks[i]->GetLength();
 
-				// we might have padded with the control bytes, so only write some bytes if we need to
-				if(padLength > 0)
-				{
-					FileIO::fwrite(padding, 1, alignedoffs-offs, binFile);
-					offs += alignedoffs-offs;
-				}
-			}
-			
-			FileIO::fwrite(chunk->GetData(), 1, chunk->GetLength(), binFile);
+			if(!m_HasError)
+				WriteChunk(chunks[i]);
 
-			offs += chunk->GetLength();
+			SAFE_DELETE(chunks[i]);
 
-			if(chunk->IsTemporary())
-				SAFE_DELETE(chunk);
+			Atomic::ExchAdd64(&m_QueuedBytes, -len);
 		}
 
-		m_Chunks.clear();
-		
-		header.fileSize = offs;
+		chunks.clear();
+	}
+}
 
-		FileIO::fseek64(binFile, 0, SEEK_SET);
-		
-		// write header with correct filesize (accounting for all padding)
-		FileIO::fwrite(&header, 1, sizeof(DebuggerHeader), binFile);
+void ChunkSpillWriter::WriteChunk(Chunk *chunk)
+{
+	size_t written = 0;
+	size_t expected = 0;
 
-		FileIO::fclose(binFile);
+	if(chunk->IsAligned())
+	{
+		byte padChunk[Serialiser::BufferAlignment+4];
+		size_t padLen = Serialiser::EncodePadding(m_Offset, padChunk);
 
-		SAFE_DELETE_ARRAY(symbolDB);
+		if(padLen > 0)
+			written += FileIO::fwrite(padChunk, 1, padLen, m_File);
+		expected += padLen;
+		m_Offset += padLen;
+	}
 
-		return header.fileSize;
+	Serialiser::ChunkIndexEntry entry = { m_Offset, chunk->GetChunkType(), chunk->GetLength() };
+	m_Index.push_back(entry);
+
+	if(chunk->HasPayloads())
+	{
+		for(size_t s=0; s < chunk->NumSegments(); s++)
+		{
+			size_t segLen = 0;
+			const byte *seg = chunk->GetSegment(s, segLen);
+			if(segLen > 0)
+				written += FileIO::fwrite(seg, 1, segLen, m_File);
+		}
 	}
+	else
+	{
+		written += FileIO::fwrite(chunk->GetData(), 1, chunk->GetLength(), m_File);
+	}
+	expected += chunk->GetLength();
+	m_Offset += chunk->GetLength();
 
-	return 0;
+	if(written != expected)
+	{
+		RDCERR("Failed to write spilled chunks to '%s', errno %d", m_Filename.c_str(), errno);
+		m_HasError = true;
+	}
 }
 
 Serialiser::~Serialiser()
@@ -618,6 +2473,13 @@ Serialiser::~Serialiser()
 
 	SAFE_DELETE(m_pResolver);
 	SAFE_DELETE(m_pCallstack);
+	if(m_MappedBase)
+	{
+		FileIO::UnmapFile(m_MappedBase, m_MappedSize);
+		m_MappedBase = NULL;
+		m_MappedSize = 0;
+		m_Buffer = NULL;
+	}
 	if(m_Buffer)
 	{
 		FreeAlignedBuffer(m_Buffer);
@@ -625,6 +2487,10 @@ Serialiser::~Serialiser()
 	}
 	m_Buffer = NULL;
 	m_BufferHead = NULL;
+
+	FreeBlockData();
+
+	SetChunkArena(false);
 }
 
 void Serialiser::DebugPrint(const char *fmt, ...)
@@ -681,9 +2547,13 @@ uint32_t Serialiser::PushContext(const char *name, uint32_t chunkIdx, bool small
 
 			if(m_Indent == 0)
 			{
+				m_ChunkName = name;
+
 				if(RenderDoc::Inst().GetCaptureOptions().CaptureCallstacks &&
-					!RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws)
-				{			
+					!RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws &&
+					RenderDoc::Inst().ShouldCollectCallstack(name))
+				{
+					SCOPED_OVERHEAD(eOverhead_Callstack);
 					call = Callstack::Collect();
 
 					RDCASSERT(call->NumLevels() < 0xff);
@@ -699,13 +2569,12 @@ uint32_t Serialiser::PushContext(const char *name, uint32_t chunkIdx, bool small
 
 			if(call)
 			{
-				uint8_t numLevels = call->NumLevels()&0xff;
-				WriteFrom(numLevels);
-
-				if(call->NumLevels())
+				uint32_t callstackID = 0;
 				{
-					WriteBytes((byte *)call->GetAddrs(), sizeof(uint64_t)*numLevels);
+					SCOPED_OVERHEAD(eOverhead_Callstack);
+					callstackID = RegisterCallstack(call);
 				}
+				WriteFrom(callstackID);
 
 				SAFE_DELETE(call);
 			}
@@ -725,7 +2594,7 @@ uint32_t Serialiser::PushContext(const char *name, uint32_t chunkIdx, bool small
 			}
 		}
 
-		if(m_DebugTextWriting)
+		if(GetDebugText())
 		{
 			DebugPrint("%s (%d)\n", name, chunkIdx);
 			DebugPrint("{\n");
@@ -743,14 +2612,18 @@ uint32_t Serialiser::PushContext(const char *name, uint32_t chunkIdx, bool small
 
 			// chunk index 0 is not allowed in normal situations.
 			// allows us to indicate some control bytes
-			while(c == 0)
+			while(c == 0 && !m_HasError)
 			{
 				uint8_t *controlByte = (uint8_t *)ReadBytes(1);
+				if(controlByte == NULL)
+					break;
 
 				if(*controlByte == 0x0)
 				{
 					// padding
 					uint8_t *padLength = (uint8_t *)ReadBytes(1);
+					if(padLength == NULL)
+						break;
 
 					// might have padded with these 5 control bytes,
 					// so a pad length of 0 IS VALID.
@@ -775,7 +2648,7 @@ uint32_t Serialiser::PushContext(const char *name, uint32_t chunkIdx, bool small
 			
 			if(m_Indent == 0)
 			{
-				if(callstack)
+				if(callstack && m_FileVersion < 0x00000034)
 				{
 					uint8_t callLen = 0;
 					ReadInto(callLen);
@@ -783,6 +2656,13 @@ uint32_t Serialiser::PushContext(const char *name, uint32_t chunkIdx, bool small
 					uint64_t *calls = (uint64_t *)ReadBytes(callLen*sizeof(uint64_t));
 					SetCallstack(calls, callLen);
 				}
+				else if(callstack)
+				{
+					uint32_t callstackID = 0;
+					ReadInto(callstackID);
+
+					SetCallstackFromTable(callstackID);
+				}
 				else
 				{
 					SetCallstack(NULL, 0);
@@ -810,7 +2690,7 @@ uint32_t Serialiser::PushContext(const char *name, uint32_t chunkIdx, bool small
 		if(!name && m_ChunkLookup)
 			name = m_ChunkLookup(chunkIdx);
 		
-		if(m_DebugTextWriting)
+		if(GetDebugText())
 		{
 			DebugPrint("%s\n", name ? name : "Unknown");
 			DebugPrint("{\n");
@@ -863,12 +2743,12 @@ void Serialiser::PopContext(const char *name, uint32_t chunkIdx)
 			m_BufferHead = head;
 		}
 		
-		if(m_DebugTextWriting)
+		if(GetDebugText())
 			DebugPrint("} // %s\n", name);
 	}
 	else
 	{
-		if(m_DebugTextWriting)
+		if(GetDebugText())
 			DebugPrint("}\n");
 	}
 }
@@ -879,6 +2759,84 @@ void Serialiser::PopContext(const char *name, uint32_t chunkIdx)
 /////////////////////////////////////////////////////////////
 // generic
 
+void Serialiser::SerialiseVarintBytes(uint64_t &v)
+{
+	if(m_Mode == WRITING)
+	{
+		byte bytes[10];
+		size_t len = 0;
+
+		uint64_t val = v;
+		do
+		{
+			bytes[len] = byte(val & 0x7f);
+			val >>= 7;
+			if(val) bytes[len] |= 0x80;
+			len++;
+		} while(val);
+
+		WriteBytes(bytes, len);
+	}
+	else if(m_Mode == READING)
+	{
+		uint64_t val = 0;
+
+		for(uint32_t shift=0; shift < 64; shift += 7)
+		{
+			byte *b = (byte *)ReadBytes(1);
+			if(b == NULL)
+				break;
+
+			val |= uint64_t(*b & 0x7f) << shift;
+
+			if((*b & 0x80) == 0)
+				break;
+		}
+
+		v = val;
+	}
+}
+
+void Serialiser::SerialiseResourceIdBytes(uint64_t &id)
+{
+	if(m_Mode == READING && !m_VarintResourceIds)
+		ReadInto(id);
+	else
+		SerialiseVarintBytes(id);
+}
+
+void Serialiser::Serialise(const char *name, ResourceId &el)
+{
+	SerialiseResourceIdBytes(el.id);
+
+	if(name != NULL && GetDebugText())
+		DebugPrint("%s: %s\n", name, ToStr::Get<ResourceId>(el).c_str());
+}
+
+void Serialiser::Serialise(const char *name, ResourceId *&el, size_t &Num)
+{
+	uint32_t numElems = (uint32_t)Num;
+
+	if(m_Mode == WRITING)
+		WriteFrom(numElems);
+	else if(m_Mode == READING)
+		ReadInto(numElems);
+
+	if(m_Mode == READING && el == NULL)
+		el = new ResourceId[numElems];
+
+	for(uint32_t i=0; i < numElems; i++)
+		SerialiseResourceIdBytes(el[i].id);
+
+	Num = (size_t)numElems;
+
+	if(name != NULL && GetDebugText())
+	{
+		for(size_t i=0; i < Num; i++)
+			DebugPrint("%s[%d] = %s\n", name, i, ToStr::Get<ResourceId>(el[i]).c_str());
+	}
+}
+
 void Serialiser::SerialiseString(const char *name, string &el)
 {
 	uint32_t len = (uint32_t)el.length();
@@ -892,7 +2850,7 @@ void Serialiser::SerialiseString(const char *name, string &el)
 	{
 		WriteBytes((byte *)el.c_str(), len);
 		
-		if(m_DebugTextWriting)
+		if(GetDebugText())
 		{
 			string s = el;
 			if(s.length() > 64)
@@ -902,9 +2860,13 @@ void Serialiser::SerialiseString(const char *name, string &el)
 	}
 	else
 	{
-		memcpy(&el[0], ReadBytes(len), len);
+		char *src = (char *)ReadBytes(len);
+		if(src == NULL)
+			el.clear();
+		else
+			memcpy(&el[0], src, len);
 		
-		if(m_DebugTextWriting)
+		if(GetDebugText())
 		{
 			string s = el;
 			if(s.length() > 64)
@@ -921,6 +2883,13 @@ void Serialiser::Insert(Chunk *chunk)
 	m_DebugText += chunk->GetDebugString();
 }
 
+void Serialiser::InsertFirst(Chunk *chunk)
+{
+	m_Chunks.insert(m_Chunks.begin(), chunk);
+
+	m_DebugText = chunk->GetDebugString() + m_DebugText;
+}
+
 void Serialiser::SkipBuffer()
 {
 	RDCASSERT(m_Mode < WRITING);
@@ -1018,36 +2987,110 @@ void Serialiser::SerialiseBuffer(const char *name, byte *&buf, size_t &len)
 			ReadBytes((size_t)(alignedoffs-offs));
 		}
 
+		byte *src = (byte *)ReadBytes((size_t)bufLen);
+		if(src == NULL)
+			bufLen = 0;
+
 		if(buf == NULL)
 			buf = new byte[bufLen];
-		memcpy(buf, ReadBytes(bufLen), bufLen);
+		if(src)
+			memcpy(buf, src, bufLen);
 	}
 
 	len = (size_t)bufLen;
 	
-	if(m_DebugTextWriting && name && name[0])
+	if(GetDebugText() && name && name[0])
+		DebugPrintBuffer(name, buf, bufLen);
+}
+
+void Serialiser::SerialiseExternalBuffer(const char *name, byte *&buf, size_t &len)
+{
+	// small buffers aren't worth referencing, and only chunks support external payloads
+	if(m_Mode != WRITING || len < MinExternalBufferSize)
 	{
-		const char *ellipsis = "...";
+		SerialiseBuffer(name, buf, len);
+		return;
+	}
 
-		float *fbuf = new float[4];
-		fbuf[0] = fbuf[1] = fbuf[2] = fbuf[3] = 0.0f;
-		uint32_t *lbuf = (uint32_t *)fbuf;
+	uint32_t bufLen = (uint32_t)len;
 
-		memcpy(fbuf, buf, RDCMIN(len, 4*sizeof(float)));
+	WriteFrom(bufLen);
 
-		if(bufLen <= 16)
-		{
-			ellipsis = "   ";
-		}
-		
-		DebugPrint("%s: RawBuffer % 5d:< 0x%08x 0x%08x 0x%08x 0x%08x %s   %  8.4ff %  8.4ff %  8.4ff %  8.4ff %s >\n"
-						, name
-						, bufLen, lbuf[0], lbuf[1], lbuf[2], lbuf[3], ellipsis
-						, fbuf[0], fbuf[1], fbuf[2], fbuf[3], ellipsis);
+	// ensure byte alignment
+	uint64_t offs = GetOffset();
+	uint64_t alignedoffs = AlignUp16(offs);
+
+	if(offs != alignedoffs)
+	{
+		static const byte padding[BufferAlignment] = {0};
+		WriteBytes(&padding[0], (size_t)(alignedoffs-offs));
+	}
+
+	RDCASSERT((GetOffset()%BufferAlignment)==0);
+
+	ChunkPayload *payload = ChunkPayload::Create(len);
+	memcpy(payload->GetData(), buf, len);
+
+	ChunkPayloadRef ref;
+	ref.data = payload->GetData();
+	ref.payload = payload;
+	ref.length = len;
+	ref.physOffset = size_t(m_BufferHead - m_Buffer);
+
+	m_PayloadRefs.push_back(ref);
+	m_ExternalBytes += len;
+
+	m_AlignedData = true;
+
+	if(GetDebugText() && name && name[0])
+		DebugPrintBuffer(name, buf, bufLen);
+}
+
+uint64_t Serialiser::GetPhysicalOffset(uint64_t offs) const
+{
+	uint64_t external = 0;
 
-		SAFE_DELETE_ARRAY(fbuf);
+	for(size_t i=0; i < m_PayloadRefs.size(); i++)
+	{
+		if(m_PayloadRefs[i].physOffset + external >= offs)
+			break;
+
+		RDCASSERT(offs >= m_PayloadRefs[i].physOffset + external + m_PayloadRefs[i].length);
+		external += m_PayloadRefs[i].length;
+	}
+
+	return offs - external;
+}
+
+void Serialiser::ReleasePayloadRefs()
+{
+	for(size_t i=0; i < m_PayloadRefs.size(); i++)
+		m_PayloadRefs[i].payload->Release();
+	m_PayloadRefs.clear();
+	m_ExternalBytes = 0;
+}
+
+void Serialiser::DebugPrintBuffer(const char *name, const byte *buf, uint32_t bufLen)
+{
+	const char *ellipsis = "...";
+
+	float *fbuf = new float[4];
+	fbuf[0] = fbuf[1] = fbuf[2] = fbuf[3] = 0.0f;
+	uint32_t *lbuf = (uint32_t *)fbuf;
+
+	memcpy(fbuf, buf, RDCMIN((size_t)bufLen, 4*sizeof(float)));
+
+	if(bufLen <= 16)
+	{
+		ellipsis = "   ";
 	}
+	
+	DebugPrint("%s: RawBuffer % 5d:< 0x%08x 0x%08x 0x%08x 0x%08x %s   %  8.4ff %  8.4ff %  8.4ff %  8.4ff %s >\n"
+					, name
+					, bufLen, lbuf[0], lbuf[1], lbuf[2], lbuf[3], ellipsis
+					, fbuf[0], fbuf[1], fbuf[2], fbuf[3], ellipsis);
 
+	SAFE_DELETE_ARRAY(fbuf);
 }
 
 template<> void Serialiser::Serialise(const char *name, string &el)
@@ -1065,6 +3108,8 @@ template<> void Serialiser::ReadInto(float &f)
 	}
 
 	char *data = (char *)ReadBytes(sizeof(float));
+	if(data == NULL)
+		return;
 
 	memcpy(&f, data, sizeof(float));
 }
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "common/common.h"
+#include "common/timing.h"
 #include "os/os_specific.h"
 #include "api/replay/basic_types.h"
 
@@ -37,9 +38,11 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <map>
 #include <utility>
 #include <set>
 using std::set;
+using std::map;
 using std::string;
 
 // template helpers
@@ -61,6 +64,38 @@ struct is_pointer<const T *>
   enum {value = true};
 };
 
+// types that are serialised as their raw bytes, ie. through the default Serialise()
+// with no specialisation, so arrays of them can be copied in bulk as long as no debug
+// text is being generated. Opt-in since a specialisation can't be detected.
+template <class T>
+struct is_pod_serialisable
+{
+  enum {value = false};
+};
+
+#define DECLARE_POD_SERIALISABLE(type) \
+template <> \
+struct is_pod_serialisable<type> \
+{ \
+  enum {value = true}; \
+};
+
+DECLARE_POD_SERIALISABLE(char);
+DECLARE_POD_SERIALISABLE(int8_t);
+DECLARE_POD_SERIALISABLE(uint8_t);
+DECLARE_POD_SERIALISABLE(int16_t);
+DECLARE_POD_SERIALISABLE(uint16_t);
+DECLARE_POD_SERIALISABLE(int32_t);
+DECLARE_POD_SERIALISABLE(uint32_t);
+DECLARE_POD_SERIALISABLE(int64_t);
+DECLARE_POD_SERIALISABLE(uint64_t);
+DECLARE_POD_SERIALISABLE(float);
+DECLARE_POD_SERIALISABLE(double);
+
+// ResourceId has its own variable-length Serialise overloads, so it isn't
+// bulk-copied in vectors and arrays
+struct ResourceId;
+
 template<bool isptr, class T>
 struct ToStrHelper
 {
@@ -80,6 +115,46 @@ typedef const char *(*ChunkLookup)(uint32_t chunkType);
 
 class Serialiser;
 class ScopedContext;
+class ChunkSpillWriter;
+struct ChunkArenaPage;
+
+// refcounted memory that a chunk references instead of holding its own copy, for large
+// payloads like buffer and texture uploads. Shared between a chunk and its duplicates.
+// See SerialiseExternalBuffer. The contents must not be modified once a chunk references them.
+class ChunkPayload
+{
+	public:
+		// allocates size bytes of storage, with one reference held by the caller
+		static ChunkPayload *Create(size_t size);
+
+		byte *GetData() { return m_Data; }
+		size_t GetSize() { return m_Size; }
+
+		void AddRef() { Atomic::Inc64(&m_RefCount); }
+		void Release();
+
+	private:
+		ChunkPayload() {}
+		~ChunkPayload();
+
+		// no copy semantics
+		ChunkPayload(const ChunkPayload &);
+		ChunkPayload &operator =(const ChunkPayload &);
+
+		byte *m_Data;
+		size_t m_Size;
+		volatile int64_t m_RefCount;
+};
+
+// a reference from a chunk into a payload, inserted at physOffset in the chunk's
+// own data.
+struct ChunkPayloadRef
+{
+	ChunkPayload *payload;
+	byte *data;
+	size_t length;
+	size_t physOffset;
+};
 
 // holds the memory, length and type for a given chunk, so that it can be
 // passed around and moved between owners before being serialised out
@@ -89,10 +164,19 @@ class Chunk
 		~Chunk();
 		
 		const char *GetDebugString() { return m_DebugStr.c_str(); }
-		byte *GetData() { return m_Data; }
+		// chunks with external payloads are copied into one contiguous buffer on first
+		// call, e.g. when they become a resource's backing data to be updated in place.
+		byte *GetData() { if(!m_Payloads.empty()) Flatten(); return m_Data; }
 		uint32_t GetLength() { return m_Length; }
 		uint32_t GetChunkType() { return m_ChunkType; }
 
+		// if the chunk references external payloads its contents aren't contiguous, and
+		// are best accessed as a sequence of segments (some of which may be empty) instead
+		// of through GetData()
+		bool HasPayloads() { return !m_Payloads.empty(); }
+		size_t NumSegments() { return m_Payloads.size()*2 + 1; }
+		const byte *GetSegment(size_t idx, size_t &len);
+
 		bool IsAligned() { return m_AlignedData; }
 		bool IsTemporary() { return m_Temporary; }
 		
@@ -103,29 +187,57 @@ class Chunk
 		static uint64_t NumLiveChunks() { return 0; }
 		static uint64_t TotalMem() { return 0; }
 #endif
+
+		// the number and total length of live chunks of a given type. Unlike the totals above
+		// these are tracked in all builds, to break down capture overhead by chunk type. Any
+		// types past MaxTrackedChunkType are counted together under MaxTrackedChunkType.
+		enum { MaxTrackedChunkType = 1023 };
+		static uint64_t NumLiveChunks(uint32_t chunkType) { return (uint64_t)m_TypeLiveChunks[TrackedType(chunkType)]; }
+		static uint64_t TotalMem(uint32_t chunkType) { return (uint64_t)m_TypeTotalMem[TrackedType(chunkType)]; }
 		
 		// grab current contents of the serialiser into this chunk
 		Chunk(Serialiser *ser, uint32_t chunkType, size_t alignment, bool temp); 
 
+		// make a temporary copy of this chunk's contents
+		Chunk *Duplicate();
+
 	private:
+		Chunk() {}
+
 		// no copy semantics
 		Chunk(const Chunk &);
 		Chunk &operator =(const Chunk &);
 
 		friend class ScopedContext;
 
+		static uint32_t TrackedType(uint32_t chunkType) { return RDCMIN(chunkType, (uint32_t)MaxTrackedChunkType); }
+		void TrackLive(int64_t delta);
+		void Flatten();
+
 		bool m_AlignedData;
+		size_t m_Alignment;
 		bool m_Temporary;
 
+		// if m_Data was sub-allocated from a serialiser's chunk arena, the page
+		// it lives in. Otherwise NULL and m_Data is owned by this chunk.
+		ChunkArenaPage *m_ArenaPage;
+
 		uint32_t m_ChunkType;
 
 		uint32_t m_Length;
 		byte *m_Data;
 		string m_DebugStr;
+
+		// m_Length includes the external payloads, m_DataLength is just what's in m_Data
+		uint32_t m_DataLength;
+		vector<ChunkPayloadRef> m_Payloads;
 		
 #if !defined(RELEASE)
 		static int64_t m_LiveChunks, m_MaxChunks, m_TotalMem;
 #endif
+
+		static int64_t m_TypeLiveChunks[MaxTrackedChunkType+1];
+		static int64_t m_TypeTotalMem[MaxTrackedChunkType+1];
 };
 
 // this class has a few functions. It can be used to serialise chunks - on writing it enforces
@@ -165,11 +277,17 @@ class Serialiser
 		// version number of overall file format or chunk organisation. If the contents/meaning/order of
 		// chunks have changed this does not need to be bumped, there are version numbers within each
 		// API that interprets the stream that can be bumped.
-		static const uint64_t SERIALISE_VERSION = 0x00000031;
+		static const uint64_t SERIALISE_VERSION = 0x00000034;
+
+		// when reading, the version of the file. Older versions that can still be read are
+		// listed in GetHeaderSize
+		uint64_t GetFileVersion() { return m_FileVersion; }
 
 		//////////////////////////////////////////
 		// Init and error handling
 
+		// if memoryBuf is NULL (without a file header) the buffer is left uninitialised, to
+		// be filled through GetRawPtr(0)
 		Serialiser(size_t length, const byte *memoryBuf, bool fileheader);
 		Serialiser(const char *path, Mode mode, bool debugMode = false);
 		~Serialiser();
@@ -177,6 +295,28 @@ class Serialiser
 		bool HasError() { return m_HasError; }
 		SerialiserError ErrorCode() { return m_ErrorCode; }
 
+		const char *GetFilename() { return m_Filename.c_str(); }
+
+		// when writing to a file, compress the chunk stream on disk in independently
+		// decodable LZ4 blocks. Must be set before FlushToDisk. On reading this is
+		// detected from the file header.
+		void SetCompressed(bool compressed) { m_Compressed = compressed; }
+		bool IsCompressed() { return m_Compressed; }
+
+		// re-encodes the capture file at srcPath into a compact archive at dstPath,
+		// for long-term storage rather than fast capture. The chunk stream is split
+		// at content-defined boundaries so that repeated data (e.g. the same texture
+		// uploaded several times) produces identical blocks which are only stored
+		// once, and each unique block is deflated at the highest level. Archives are
+		// read back transparently like any other capture.
+		static bool WriteArchive(const char *srcPath, const char *dstPath);
+
+		// while enabled, chunks grabbed from this serialiser sub-allocate their contents
+		// from large shared pages rather than each making their own allocation. Enabled
+		// for the duration of a captured frame. Pages are freed once the arena has moved
+		// on and every chunk in them has been deleted, so chunks may outlive the frame.
+		void SetChunkArena(bool enabled);
+
 		//////////////////////////////////////////
 		// Utility functions
 
@@ -199,7 +339,7 @@ class Serialiser
 			}
 
 			RDCASSERT(m_BufferHead && m_Buffer && m_BufferHead >= m_Buffer);
-			return m_BufferHead - m_Buffer + m_ReadOffset;
+			return m_BufferHead - m_Buffer + m_ReadOffset + m_ExternalBytes;
 		}
 
 		uint64_t GetSize()
@@ -215,11 +355,21 @@ class Serialiser
 			return m_Buffer+offs;
 		}
 
+		// turns this into an in-memory reader of length bytes, keeping the existing buffer
+		// if it's big enough (and not wastefully big), and returns the buffer to be filled.
+		// Lets a serialiser be kept around to receive packet after packet without
+		// allocating or copying for each one.
+		byte *ResetForReading(size_t length);
+
 		// Set up the base pointer and size. Serialiser will allocate enough for
 		// the rest of the file and keep it all in memory (useful to keep everything
 		// in actual frame data resident in memory).
 		void SetBase(uint64_t offs)
 		{
+			// a mapped file is always entirely resident
+			if(m_MappedBase)
+				return;
+
 			FreeAlignedBuffer(m_Buffer);
 
 			RDCASSERT(m_BufferSize - offs < 0xffffffff);
@@ -242,7 +392,8 @@ class Serialiser
 			}
 
 			// if we're jumping back before our in-memory window just reset the window
-			// and load it all in from scratch.
+			// and load it all in from scratch. A mapped file's window covers the whole
+			// stream so this never happens.
 			if(m_Mode == READING && offs < m_ReadOffset)
 			{
 				FreeAlignedBuffer(m_Buffer);
@@ -254,6 +405,10 @@ class Serialiser
 				ReadFromFile(offs, m_CurrentBufferSize);
 			}
 
+			// when writing, external payloads occupy offsets but not space in m_Buffer
+			if(m_ExternalBytes > 0)
+				offs = GetPhysicalOffset(offs);
+
 			RDCASSERT(m_BufferHead && m_Buffer && offs <= GetSize());
 			m_BufferHead = m_Buffer + offs - m_ReadOffset;
 			m_Indent = 0;
@@ -264,12 +419,31 @@ class Serialiser
 			m_DebugText = "";
 			m_Indent = 0;
 			m_AlignedData = false;
+			ReleasePayloadRefs();
 			SetOffset(0);
 		}
 
+		// one entry per top-level chunk in a capture file, in file order.
+		// offset is relative to the start of the chunk stream (ie. as GetOffset)
+		// and length includes the chunk's header.
+		struct ChunkIndexEntry
+		{
+			uint64_t offset;
+			uint32_t type;
+			uint32_t length;
+		};
+
+		// returns the chunk index stored at the end of the capture file, loading it
+		// on first use. Empty if the file has no index (or this isn't a file reader)
+		const vector<ChunkIndexEntry> &GetChunkIndex();
+
 		// assumes buffer head is sitting before a chunk (ie. pushcontext will be valid)
 		void SkipToChunk(uint32_t chunkIdx)
 		{
+			// if the file has an index, jump straight to the next chunk of that type
+			if(SkipToIndexedChunk(chunkIdx))
+				return;
+
 			do
 			{
 				size_t offs = m_BufferHead-m_Buffer + (size_t)m_ReadOffset;
@@ -315,6 +489,13 @@ class Serialiser
 			return m_pCallstack;
 		}
 
+		// when writing, collects the current callstack and serialises its ID in the
+		// callstack table. When reading, looks the ID up and sets it as the last callstack
+		void SerialiseCallstack();
+
+		// when writing, the name of the top-level chunk currently being serialised
+		const char *GetChunkName() { return m_ChunkName; }
+
 		//////////////////////////////////////////
 		// Public serialisation interface
 
@@ -325,6 +506,10 @@ class Serialiser
 		// Write a chunk to disk
 		void Insert(Chunk *el);
 
+		// as Insert, but the chunk is written before any others inserted so far. For
+		// header chunks whose contents are only ready once the rest has been serialised.
+		void InsertFirst(Chunk *el);
+
 		// serialise a fixed-size array.
 		template<int Num, class T>
 		void Serialise(const char *name, T *el)
@@ -356,12 +541,14 @@ class Serialiser
 
 				size_t length = numElems*sizeof(T);
 
-				memcpy(el, ReadBytes(length), length);
+				byte *src = (byte *)ReadBytes(length);
+				if(src)
+					memcpy(el, src, length);
 			}
 
 			Num = (size_t)numElems;
 			
-			if(name != NULL && m_DebugTextWriting)
+			if(name != NULL && GetDebugText())
 			{
 				for(size_t i=0; i < Num; i++)
 					DebugPrint("%s[%d] = %s\n", name, i, ToStr::Get<T>(el[i]).c_str());
@@ -380,16 +567,71 @@ class Serialiser
 				ReadInto(el);
 			}
 			
-			if(name != NULL && m_DebugTextWriting)
+			if(name != NULL && GetDebugText())
+				DebugPrint("%s: %s\n", name, ToStr::Get<T>(el).c_str());
+		}
+
+		// serialise an integer in only as many bytes as it needs, 7 bits at a time. Meant for
+		// the parameters of chunks that appear very often with small values, like draws.
+		// Unsigned integers and enums are stored directly, int32_t is zigzag encoded so that
+		// small negative values stay small too.
+		template<class T> void SerialiseVarint(const char *name, T &el)
+		{
+			if(m_Mode == READING && !m_VarintParams)
+			{
+				Serialise(name, el);
+				return;
+			}
+
+			uint64_t v = (uint64_t)el;
+			SerialiseVarintBytes(v);
+			el = (T)v;
+
+			if(name != NULL && GetDebugText())
 				DebugPrint("%s: %s\n", name, ToStr::Get<T>(el).c_str());
 		}
 
+		void SerialiseVarint(const char *name, int32_t &el)
+		{
+			if(m_Mode == READING && !m_VarintParams)
+			{
+				Serialise(name, el);
+				return;
+			}
+
+			uint64_t v = (uint32_t(el) << 1) ^ uint32_t(el >> 31);
+			SerialiseVarintBytes(v);
+			el = int32_t(uint32_t(v) >> 1) ^ -int32_t(uint32_t(v) & 1);
+
+			if(name != NULL && GetDebugText())
+				DebugPrint("%s: %d\n", name, el);
+		}
+
+		// ResourceIds come from a single counter so are small integers in practice, and
+		// they're in nearly every chunk (and most of a GL state vector is unbound slots).
+		// They're stored as varints, making most 1-3 bytes instead of 8.
+		void Serialise(const char *name, ResourceId &el);
+		void Serialise(const char *name, ResourceId *&el, size_t &Num);
+
+		// logs from before SerialiseVarint and varint ResourceIds store those values at their
+		// full size. Both are on by default, and the driver turns them off when reading once
+		// it knows the log's API version.
+		void SetVarintEncoding(bool params, bool resourceIds) { m_VarintParams = params; m_VarintResourceIds = resourceIds; }
+
 		template<typename X>
 		void Serialise(const char *name, std::vector<X> &el)
 		{
 			uint64_t sz = el.size();
 			Serialise(name, sz);
-			if(m_Mode == WRITING)
+			if(is_pod_serialisable<X>::value && !GetDebugText() && (m_Mode == WRITING || m_Mode == READING))
+			{
+				if(m_Mode == READING)
+					el.resize((size_t)sz);
+
+				if(sz > 0)
+					SerialisePODArray((byte *)&el[0], sizeof(X)*(size_t)sz);
+			}
+			else if(m_Mode == WRITING)
 			{
 				for(size_t i=0; i < sz; i++)
 					Serialise("[]", el[i]);
@@ -412,7 +654,15 @@ class Serialiser
 		{
 			int32_t sz = el.count;
 			Serialise(name, sz);
-			if(m_Mode == WRITING)
+			if(is_pod_serialisable<X>::value && !GetDebugText() && (m_Mode == WRITING || m_Mode == READING))
+			{
+				if(m_Mode == READING)
+					create_array_uninit(el, sz);
+
+				if(sz > 0)
+					SerialisePODArray((byte *)el.elems, sizeof(X)*(size_t)sz);
+			}
+			else if(m_Mode == WRITING)
 			{
 				for(int32_t i=0; i < sz; i++)
 					Serialise("[]", el.elems[i]);
@@ -486,6 +736,12 @@ class Serialiser
 		// If serialising in, buf must either be NULL in which case allocated
 		// memory will be returned, or it must be already large enough.
 		void SerialiseBuffer(const char *name, byte *&buf, size_t &len);
+
+		// serialised identically to SerialiseBuffer, but on writing large buffers aren't
+		// copied into the serialiser. buf is copied once into a new payload, which the chunk
+		// grabbed next references and which is written straight out when it's flushed -
+		// one copy instead of two.
+		void SerialiseExternalBuffer(const char *name, byte *&buf, size_t &len);
 		void SkipBuffer();
 		void AlignNextBuffer(const size_t alignment);
 
@@ -511,6 +767,16 @@ class Serialiser
 
 		uint64_t FlushToDisk();
 
+		// chunks that were spilled to disk while the frame was captured. They are
+		// written after any chunks inserted into this serialiser when flushing to
+		// disk. The spill writer is not owned and must outlive FlushToDisk.
+		void SetSpilledChunks(ChunkSpillWriter *spill) { m_SpilledChunks = spill; }
+
+		// replaces any inserted chunks that are owned elsewhere (ie. not temporary)
+		// with temporary copies, so that the serialiser can be flushed to disk after
+		// the original owners have moved on.
+		void TakeOwnershipOfChunks();
+
 		// set a function used when serialising a text representation
 		// of the chunks
 		void SetChunkNameLookup(ChunkLookup lookup)
@@ -523,9 +789,15 @@ class Serialiser
 			m_DebugTextWriting = enabled;
 		}
 
+		// when debug text is stripped this is constant, so all name and value
+		// formatting compiles away and reads only do the binary work.
 		bool GetDebugText()
 		{
+#if defined(STRIP_SERIALISER_DEBUG_TEXT)
+			return false;
+#else
 			return m_DebugTextWriting;
+#endif
 		}
 
 		string GetDebugStr()
@@ -597,6 +869,15 @@ class Serialiser
 			// if we would read off the end of our current window
 			if(m_BufferHead+nBytes > m_Buffer+m_CurrentBufferSize)
 			{
+				// a mapped file is entirely in the window, so this is reading off the end
+				if(m_MappedBase)
+				{
+					RDCERR("Reading %llu bytes past the end of mapped capture file", (uint64_t)nBytes);
+					m_ErrorCode = eSerError_Corrupt;
+					m_HasError = true;
+					return NULL;
+				}
+
 				size_t BufferOffset = m_BufferHead-m_Buffer;
 
 				if(nBytes+64 > m_CurrentBufferSize)
@@ -631,6 +912,58 @@ class Serialiser
 
 		void ReadFromFile(uint64_t destOffs, size_t chunkLen);
 
+		void DebugPrintBuffer(const char *name, const byte *buf, uint32_t bufLen);
+
+		// bulk read or write of an array of is_pod_serialisable elements, laid out
+		// identically to serialising each element in turn
+		void SerialisePODArray(byte *data, size_t length)
+		{
+			if(m_Mode == WRITING)
+			{
+				WriteBytes(data, length);
+			}
+			else
+			{
+				byte *src = (byte *)ReadBytes(length);
+				if(src)
+					memcpy(data, src, length);
+			}
+		}
+
+		uint64_t GetPhysicalOffset(uint64_t offs) const;
+		void ReleasePayloadRefs();
+		static const size_t MinExternalBufferSize;
+
+		bool SkipToIndexedChunk(uint32_t chunkIdx);
+
+		// compressed block stream helpers
+		uint64_t FindBlock(uint64_t offs);
+		uint64_t GetBlockStart(uint64_t blockIdx);
+		bool LoadBlock(uint64_t blockIdx);
+		bool ReadBlockSource(FILE *f, uint64_t blockIdx, byte *scratch, uint32_t *sizes);
+		void StartPrefetch();
+		void StopPrefetch();
+		bool TakePrefetchedBlock(uint64_t blockIdx, bool sequential, bool &valid);
+		static void PrefetchThreadEntry(void *param);
+		void PrefetchThread();
+		bool ReadStreamData(uint64_t offs, byte *dst, size_t len);
+		void WriteStream(FILE *f, const void *data, size_t len);
+
+		byte *AllocChunkData(size_t length, size_t alignment, ChunkArenaPage *&page);
+		static const size_t ChunkArenaPageSize;
+		static const size_t ChunkArenaMaxAlloc;
+		void FlushStreamBlock(FILE *f);
+		void FreeBlockData();
+
+		// encodes a padding chunk taking a stream at offs up to the next BufferAlignment
+		// boundary into padding, which must hold BufferAlignment+4 bytes. Returns the
+		// number of bytes to write, 0 if offs is already aligned.
+		static size_t EncodePadding(uint64_t offs, byte *padding);
+		uint64_t WriteSpilledChunks(FILE *f, uint64_t offs, uint64_t streamStart, vector<ChunkIndexEntry> &chunkIndex);
+
+		void SerialiseVarintBytes(uint64_t &v);
+		void SerialiseResourceIdBytes(uint64_t &id);
+
 		template<class T> void WriteFrom(const T &f)
 		{
 			WriteBytes((byte *)&f, sizeof(T));
@@ -645,6 +978,9 @@ class Serialiser
 			}
 
 			char *data = (char *)ReadBytes(sizeof(T));
+			if(data == NULL)
+				return;
+
 			f = *((T *)data);
 		}
 
@@ -670,19 +1006,79 @@ class Serialiser
 
 		static const size_t BufferAlignment;
 
+		// largest file we'll map into memory when reading in a 32-bit process, to
+		// avoid exhausting the address space. Larger files use a rolling window.
+		static const uint64_t MaxMappedSize32;
+
+		// uncompressed size of each block when the chunk stream is compressed.
+		// Every block but the last is exactly this size.
+		static const size_t CompressedBlockSize;
+
+		// archived blocks are cut where a rolling hash of the contents matches, but
+		// never smaller than the minimum (except the last) or larger than the maximum
+		static const size_t ArchiveMinBlockSize;
+		static const size_t ArchiveMaxBlockSize;
+		static const uint64_t ArchiveBoundaryMask;
+
+		enum HeaderFlags
+		{
+			eHeaderFlag_None = 0x0,
+			eHeaderFlag_Compressed = 0x1,
+			eHeaderFlag_Archived = 0x2,
+		};
+
 		struct DebuggerHeader
 		{
 			DebuggerHeader()
 			{
 				magic = MAGIC_HEADER;
 				version = SERIALISE_VERSION;
+				fileSize = resolveDBSize = 0;
+				flags = eHeaderFlag_None;
+				streamSize = 0;
+				blockTableOffset = 0;
+				chunkIndexOffset = 0;
+				callstackTableOffset = 0;
 			}
 
 			uint64_t magic;
 			uint64_t version;
 			uint64_t fileSize;
 			uint64_t resolveDBSize;
+			uint64_t flags;
+
+			// size of the (uncompressed) chunk stream, after the header and symbol DB
+			uint64_t streamSize;
+
+			// if compressed, absolute file offset of the block table. The table is the
+			// uncompressed block size and block count as uint64_t, followed by the absolute
+			// file offset of each block. Each block on disk is its compressed size and
+			// uncompressed size as uint32_t, followed by the LZ4 compressed data.
+			//
+			// If also archived, blocks vary in size and the first entry in the table is
+			// the largest block size. The file offsets are followed by the stream offset
+			// of each block, and several blocks may share a file offset if they have the
+			// same contents. Each block on disk is its compressed size and uncompressed
+			// size as uint32_t and the stream offset it was first stored for as uint64_t,
+			// followed by the deflated data.
+			uint64_t blockTableOffset;
+
+			// absolute file offset of the chunk index, or 0 if there is none. The index is
+			// the number of entries as uint64_t followed by that many ChunkIndexEntry.
+			uint64_t chunkIndexOffset;
+
+			// absolute file offset of the callstack table, or 0 if there is none. Chunks
+			// refer to callstacks by their index in the table, so each distinct callstack
+			// is only stored once. The table is the number of callstacks as uint64_t, then
+			// for each its number of levels as uint64_t followed by that many addresses.
+			uint64_t callstackTableOffset;
 		};
+
+		// the size of the header in files of this version, or 0 if they can't be read
+		static size_t GetHeaderSize(uint64_t version);
+		// returns the header's size in the file, or 0 if its version can't be read. Any fields
+		// the file's version doesn't have are reset to their defaults
+		static size_t CheckHeader(DebuggerHeader &header);
 		
 		//////////////////////////////////////////
 		
@@ -697,6 +1093,17 @@ class Serialiser
 		bool m_HasResolver;
 		Callstack::Stackwalk *m_pCallstack;
 		Callstack::StackResolver *m_pResolver;
+
+		// callstacks are collected into one table for the whole process, as they're written
+		// into chunks before it's known which log the chunks will end up in. Returns the
+		// callstack's index in the table, adding it if it isn't already there
+		static uint32_t RegisterCallstack(Callstack::Stackwalk *call);
+		void SetCallstackFromTable(uint32_t callstackID);
+
+		// when reading, the callstack table loaded from the file
+		vector< vector<uint64_t> > m_CallstackTable;
+
+		const char *m_ChunkName;
 		Threading::ThreadHandle m_ResolverThread;
 		volatile bool m_ResolverThreadKillSignal;
 
@@ -708,6 +1115,10 @@ class Serialiser
 		byte *m_BufferHead;
 		size_t m_LastChunkLen;
 		bool m_AlignedData;
+
+		uint64_t m_FileVersion;
+		bool m_VarintParams;
+		bool m_VarintResourceIds;
 		vector<uint64_t> m_ChunkFixups;
 
 		// reading from file:
@@ -725,8 +1136,69 @@ class Serialiser
 		// the file pointer to read from
 		FILE *m_ReadFileHandle;
 
+		// if the file is mapped into memory for reading, the base and size of the
+		// whole mapping. m_Buffer then points into it and covers the whole stream.
+		byte *m_MappedBase;
+		uint64_t m_MappedSize;
+
+		// compressed chunk stream. When reading, m_BlockData holds the decompressed
+		// contents of block m_BlockIdx. When writing it accumulates the current block.
+		// m_BlockStarts is only used for archives, where blocks vary in size.
+		bool m_Compressed;
+		bool m_Archived;
+		size_t m_BlockSize;
+		vector<uint64_t> m_BlockOffsets;
+		vector<uint64_t> m_BlockStarts;
+		byte *m_BlockData;
+		byte *m_BlockScratch;
+		size_t m_BlockScratchSize;
+		uint64_t m_BlockIdx;
+		size_t m_BlockLength;
+
+		// blocks after m_BlockIdx, decompressed by worker threads that stay ahead of a
+		// sequential read. Block i only ever goes in slot i % m_BlockPrefetch.size().
+		// Reaching one swaps its data with m_BlockData and frees the slot.
+		struct PrefetchedBlock
+		{
+			uint64_t idx;
+			uint32_t sizes[2];
+			byte *data;
+			byte *scratch;
+			bool busy;  // a worker is decompressing into it
+			bool ready; // decompressed, waiting for the reader
+			bool valid;
+		};
+		vector<PrefetchedBlock> m_BlockPrefetch;
+		vector<Threading::ThreadHandle> m_PrefetchThreads;
+		volatile bool m_PrefetchKillSignal;
+
+		// protects the slots and the window. Workers claim blocks from m_PrefetchNext
+		// onwards, up to as many blocks past m_PrefetchBase (the next block the
+		// reader wants) as there are slots. Moving the window bumps the generation, so
+		// anything claimed before then is thrown away.
+		Threading::CriticalSection m_PrefetchLock;
+		uint64_t m_PrefetchBase;
+		uint64_t m_PrefetchNext;
+		uint32_t m_PrefetchGeneration;
+
 		// writing to file
 		vector<Chunk *> m_Chunks;
+		ChunkSpillWriter *m_SpilledChunks;
+
+		// payloads referenced by the chunk being written, and their total size
+		vector<ChunkPayloadRef> m_PayloadRefs;
+		uint64_t m_ExternalBytes;
+
+		// current page that chunk contents are allocated from, if the arena is enabled
+		bool m_ChunkArenaEnabled;
+		ChunkArenaPage *m_ChunkArenaPage;
+
+		// chunk index at the end of the file, loaded on demand when reading.
+		// m_ChunkTypeIndex maps from chunk type to indices in m_ChunkIndex
+		uint64_t m_ChunkIndexOffset;
+		bool m_ChunkIndexLoaded;
+		vector<ChunkIndexEntry> m_ChunkIndex;
+		map<uint32_t, vector<size_t> > m_ChunkTypeIndex;
 
 		// a database of strings read from the file, useful when serialised structures
 		// expect a char* to return and point to static memory
@@ -738,6 +1210,62 @@ class Serialiser
 		ChunkLookup m_ChunkLookup;
 		
 		Threading::CriticalSection m_DebugLock;
+
+		friend class Chunk;
+		friend class ChunkSpillWriter;
+};
+
+// receives finished chunks while a frame is being captured and writes them to a
+// temporary file on a background thread, so that the whole frame doesn't have to be
+// held in memory until the capture ends. The chunks are encoded exactly as they will
+// appear in the logfile's chunk stream, and the file serialiser copies them in after
+// the header and initial contents when it's flushed (see SetSpilledChunks).
+//
+// If more than highWaterMark bytes of chunks are waiting to be written, Append blocks
+// until the writer thread catches up, which bounds the memory held by the capture.
+class ChunkSpillWriter
+{
+	public:
+		ChunkSpillWriter(const char *filename, uint64_t highWaterMark);
+		~ChunkSpillWriter();
+
+		bool HasError() { return m_HasError; }
+
+		// takes ownership of the chunk
+		void Append(Chunk *chunk);
+
+		// waits for all queued chunks to be written and stops the writer thread
+		void Finish();
+
+		const char *GetFilename() { return m_Filename.c_str(); }
+		uint64_t GetStreamSize() { return m_Offset; }
+		const vector<Serialiser::ChunkIndexEntry> &GetChunkIndex() { return m_Index; }
+
+	private:
+		// no copy semantics
+		ChunkSpillWriter(const ChunkSpillWriter &);
+		ChunkSpillWriter &operator =(const ChunkSpillWriter &);
+
+		static void WriterThreadEntry(void *param);
+		void WriterThread();
+		void WriteChunk(Chunk *chunk);
+
+		string m_Filename;
+		FILE *m_File;
+		volatile bool m_HasError;
+
+		// only accessed by the writer thread until Finish() returns
+		uint64_t m_Offset;
+		vector<Serialiser::ChunkIndexEntry> m_Index;
+
+		uint64_t m_HighWaterMark;
+		volatile int64_t m_QueuedBytes;
+
+		Threading::CriticalSection m_QueueLock;
+		vector<Chunk *> m_Queue;
+
+		Threading::ThreadHandle m_Thread;
+		volatile bool m_Finishing;
 };
 
 template<> void Serialiser::Serialise(const char *name, string &el);
@@ -755,14 +1283,31 @@ class ScopedContext
 #endif
 		{
 			m_Alignment = 0;
-			m_Name = string(n) + " = " + t;
-			m_Ser->PushContext(m_Name.c_str(), m_Idx, smallChunk);
+			BeginOverhead();
+			
+			// the name is only ever used for debug text, so don't pay for
+			// building it unless someone will see it
+#ifdef DEBUG_TEXT_SERIALISER
+			if(m_Ser->GetDebugText() || m_DebugSer)
+#else
+			if(m_Ser->GetDebugText())
+#endif
+			{
+				m_NameStorage = string(n) + " = " + t;
+				m_Name = m_NameStorage.c_str();
+			}
+			else
+			{
+				m_Name = n;
+			}
+
+			m_Ser->PushContext(m_Name, m_Idx, smallChunk);
 			
 #ifdef DEBUG_TEXT_SERIALISER
 			if(m_DebugSer)
 			{
 				m_DebugSer->DebugLock();
-				m_DebugSer->PushContext(m_Name.c_str(), m_Idx, smallChunk);
+				m_DebugSer->PushContext(m_Name, m_Idx, smallChunk);
 			}
 #endif
 		}
@@ -773,14 +1318,15 @@ class ScopedContext
 #endif
 		{
 			m_Alignment = 0;
+			BeginOverhead();
 			m_Name = n;
-			m_Ser->PushContext(m_Name.c_str(), m_Idx, smallChunk);
+			m_Ser->PushContext(m_Name, m_Idx, smallChunk);
 
 #ifdef DEBUG_TEXT_SERIALISER
 			if(m_DebugSer)
 			{
 				m_DebugSer->DebugLock();
-				m_DebugSer->PushContext(m_Name.c_str(), m_Idx, smallChunk);
+				m_DebugSer->PushContext(m_Name, m_Idx, smallChunk);
 			}
 #endif
 		}
@@ -801,7 +1347,8 @@ class ScopedContext
 			return new Chunk(m_Ser, m_Idx, m_Alignment, temporary);
 		}
 	private:
-		std::string m_Name;
+		const char *m_Name;
+		std::string m_NameStorage;
 		uint32_t m_Idx;
 		size_t m_Alignment;
 		Serialiser *m_Ser;
@@ -811,20 +1358,33 @@ class ScopedContext
 
 		bool m_Ended;
 
+		bool m_Overhead;
+		Overhead::Scope m_PrevOverhead;
+
+		void BeginOverhead()
+		{
+			m_Overhead = Overhead::Active;
+			if(m_Overhead)
+				m_PrevOverhead = Overhead::BeginChunk(m_Idx);
+		}
+
 		void End()
 		{
 			RDCASSERT(!m_Ended);
 
-			m_Ser->PopContext(m_Name.c_str(), m_Idx);
+			m_Ser->PopContext(m_Name, m_Idx);
 
 #ifdef DEBUG_TEXT_SERIALISER
 			if(m_DebugSer)
 			{
-				m_DebugSer->PopContext(m_Name.c_str(), m_Idx);
+				m_DebugSer->PopContext(m_Name, m_Idx);
 				m_DebugSer->DebugUnlock();
 			}
 #endif
 
+			if(m_Overhead)
+				Overhead::End(m_PrevOverhead);
+
 			m_Ended = true;
 		}
 };
@@ -834,25 +1394,31 @@ class ScopedContext
 #define SCOPED_SERIALISE_SMALL_CONTEXT(n) ScopedContext scope(m_pSerialiser, m_pDebugSerialiser, GetChunkName(n), n, true);
 
 #define SERIALISE_ELEMENT(type, name, inValue) type name; if(m_State >= WRITING) name = (inValue); m_pSerialiser->Serialise(#name, name); m_pDebugSerialiser->Serialise(#name, name);
+#define SERIALISE_ELEMENT_VARINT(type, name, inValue) type name = type(); if(m_State >= WRITING) name = (inValue); m_pSerialiser->SerialiseVarint(#name, name); m_pDebugSerialiser->SerialiseVarint(#name, name);
 #define SERIALISE_ELEMENT_OPT(type, name, inValue, Condition) type name = type(); if(Condition) { if(m_State >= WRITING) name = (inValue); m_pSerialiser->Serialise(#name, name); m_pDebugSerialiser->Serialise(#name, name); }
 #define SERIALISE_ELEMENT_ARR(type, name, inValues, count) type *name = new type[count]; for(size_t serialiseIdx=0; serialiseIdx < count; serialiseIdx++) { if(m_State >= WRITING) name[serialiseIdx] = (inValues)[serialiseIdx]; m_pSerialiser->Serialise(#name, name[serialiseIdx]); m_pDebugSerialiser->Serialise(#name, name[serialiseIdx]); }
 #define SERIALISE_ELEMENT_ARR_OPT(type, name, inValues, count, Condition) type *name = NULL; if(Condition) { name = new type[count]; for(size_t serialiseIdx=0; serialiseIdx < count; serialiseIdx++) { if(m_State >= WRITING) name[serialiseIdx] = (inValues)[serialiseIdx]; m_pSerialiser->Serialise(#name, name[serialiseIdx]); m_pDebugSerialiser->Serialise(#name, name[serialiseIdx]); } }
 #define SERIALISE_ELEMENT_PTR(type, name, inValue) type name; if(inValue && m_State >= WRITING) name = *(inValue); m_pSerialiser->Serialise(#name, name); m_pDebugSerialiser->Serialise(#name, name);
 #define SERIALISE_ELEMENT_PTR_OPT(type, name, inValue, Condition) type name; if(Condition) { if(inValue && m_State >= WRITING) name = *(inValue); m_pSerialiser->Serialise(#name, name); m_pDebugSerialiser->Serialise(#name, name); }
 #define SERIALISE_ELEMENT_BUF(type, name, inBuf, Len) type name = (type)NULL; if(m_State >= WRITING) name = (type)(inBuf); size_t CONCAT(buflen, __LINE__) = Len; m_pSerialiser->SerialiseBuffer(#name, name, CONCAT(buflen, __LINE__)); m_pDebugSerialiser->SerialiseBuffer(#name, name, CONCAT(buflen, __LINE__));
+#define SERIALISE_ELEMENT_BUF_EXTERNAL(type, name, inBuf, Len) type name = (type)NULL; if(m_State >= WRITING) name = (type)(inBuf); size_t CONCAT(buflen, __LINE__) = Len; m_pSerialiser->SerialiseExternalBuffer(#name, name, CONCAT(buflen, __LINE__)); m_pDebugSerialiser->SerialiseBuffer(#name, name, CONCAT(buflen, __LINE__));
 #define SERIALISE_ELEMENT_BUF_OPT(type, name, inBuf, Len, Condition) type name = (type)NULL; if(Condition) { if(m_State >= WRITING) name = (type)(inBuf); size_t CONCAT(buflen, __LINE__) = Len; m_pSerialiser->SerialiseBuffer(#name, name, CONCAT(buflen, __LINE__)); m_pDebugSerialiser->SerialiseBuffer(#name, name, CONCAT(buflen, __LINE__)); }
+#define SERIALISE_ELEMENT_BUF_OPT_EXTERNAL(type, name, inBuf, Len, Condition) type name = (type)NULL; if(Condition) { if(m_State >= WRITING) name = (type)(inBuf); size_t CONCAT(buflen, __LINE__) = Len; m_pSerialiser->SerialiseExternalBuffer(#name, name, CONCAT(buflen, __LINE__)); m_pDebugSerialiser->SerialiseBuffer(#name, name, CONCAT(buflen, __LINE__)); }
 #else
 #define SCOPED_SERIALISE_CONTEXT(n) ScopedContext scope(m_pSerialiser, NULL, GetChunkName(n), n, false);
 #define SCOPED_SERIALISE_SMALL_CONTEXT(n) ScopedContext scope(m_pSerialiser, NULL, GetChunkName(n), n, true);
 
 #define SERIALISE_ELEMENT(type, name, inValue) type name; if(m_State >= WRITING) name = (inValue); m_pSerialiser->Serialise(#name, name);
+#define SERIALISE_ELEMENT_VARINT(type, name, inValue) type name = type(); if(m_State >= WRITING) name = (inValue); m_pSerialiser->SerialiseVarint(#name, name);
 #define SERIALISE_ELEMENT_OPT(type, name, inValue, Condition) type name = type(); if(Condition) { if(m_State >= WRITING) name = (inValue); m_pSerialiser->Serialise(#name, name); }
 #define SERIALISE_ELEMENT_ARR(type, name, inValues, count) type *name = new type[count]; for(size_t serialiseIdx=0; serialiseIdx < count; serialiseIdx++) { if(m_State >= WRITING) name[serialiseIdx] = (inValues)[serialiseIdx]; m_pSerialiser->Serialise(#name, name[serialiseIdx]); }
 #define SERIALISE_ELEMENT_ARR_OPT(type, name, inValues, count, Condition) type *name = NULL; if(Condition) { name = new type[count]; for(size_t serialiseIdx=0; serialiseIdx < count; serialiseIdx++) { if(m_State >= WRITING) name[serialiseIdx] = (inValues)[serialiseIdx]; m_pSerialiser->Serialise(#name, name[serialiseIdx]); } }
 #define SERIALISE_ELEMENT_PTR(type, name, inValue) type name; if(inValue && m_State >= WRITING) name = *(inValue); m_pSerialiser->Serialise(#name, name);
 #define SERIALISE_ELEMENT_PTR_OPT(type, name, inValue, Condition) type name; if(Condition) { if(inValue && m_State >= WRITING) name = *(inValue); m_pSerialiser->Serialise(#name, name); }
 #define SERIALISE_ELEMENT_BUF(type, name, inBuf, Len) type name = (type)NULL; if(m_State >= WRITING) name = (type)(inBuf); size_t CONCAT(buflen, __LINE__) = Len; m_pSerialiser->SerialiseBuffer(#name, name, CONCAT(buflen, __LINE__));
+#define SERIALISE_ELEMENT_BUF_EXTERNAL(type, name, inBuf, Len) type name = (type)NULL; if(m_State >= WRITING) name = (type)(inBuf); size_t CONCAT(buflen, __LINE__) = Len; m_pSerialiser->SerialiseExternalBuffer(#name, name, CONCAT(buflen, __LINE__));
 #define SERIALISE_ELEMENT_BUF_OPT(type, name, inBuf, Len, Condition) type name = (type)NULL; if(Condition) { if(m_State >= WRITING) name = (type)(inBuf); size_t CONCAT(buflen, __LINE__) = Len; m_pSerialiser->SerialiseBuffer(#name, name, CONCAT(buflen, __LINE__)); }
+#define SERIALISE_ELEMENT_BUF_OPT_EXTERNAL(type, name, inBuf, Len, Condition) type name = (type)NULL; if(Condition) { if(m_State >= WRITING) name = (type)(inBuf); size_t CONCAT(buflen, __LINE__) = Len; m_pSerialiser->SerialiseExternalBuffer(#name, name, CONCAT(buflen, __LINE__)); }
 #endif
 
 // forward declare generic pointer version to void*
@@ -24,6 +24,13 @@
 
 #include "common/common.h"
 
+#include <string.h>
+#include <vector>
+#include <algorithm>
+using std::vector;
+
+#include "common/threading.h"
+
 // grisu2 double-to-string function, returns number of digits written to digits array
 int grisu2(uint64_t mantissa, int exponent, char digits[18], int &kout);
 
@@ -1062,6 +1069,130 @@ void formatargument(char type, void *rawarg, FormatterParams formatter, char *&o
 	}
 }
 
+// parses the flags, width, precision and length modifier of an argument specifier (after the %),
+// returning a pointer to the format specifier character.
+static const char *ParseFormatter(const char *iter, FormatterParams &formatter)
+{
+	//////////////////////////////
+	// now parsing an argument specifier
+
+	// parse out 0 or more flags
+	do
+	{
+		// if flag is found, continue looping to possibly find more flags
+		// otherwise break out of this loop
+		     if(*iter == '-') formatter.Flags |= LeftJustify;
+		else if(*iter == '+') formatter.Flags |= PrependPos;
+		else if(*iter == ' ') formatter.Flags |= PrependSpace;
+		else if(*iter == '#') formatter.Flags |= AlternateForm;
+		else if(*iter == '0') formatter.Flags |= PadZeroes;
+		else                  break;
+
+		// left justify overrides pad with zeroes
+		if(formatter.Flags & LeftJustify)
+			formatter.Flags &= ~PadZeroes;
+
+		// prepend + overrides prepend ' '
+		if(formatter.Flags & PrependPos)
+			formatter.Flags &= ~PrependSpace;
+
+		iter++;
+	} while(true);
+
+	// possibly parse a width. Note that width always started with 1-9 as it's decimal,
+	// and 0 or - would have been picked up as a flag above
+	{
+		// note standard printf supports * here to read precision from a vararg before
+		// the actual argument. We don't support that
+
+		// Width found
+		if(*iter >= '1' && *iter <= '9')
+		{
+			formatter.Width = int(*iter - '0');
+			iter++; // step to next character
+
+			// continue while encountering digits, accumulating into width
+			while(*iter >= '0' && *iter <= '9')
+			{
+				formatter.Width *= 10;
+				formatter.Width += int(*iter - '0');
+				iter++;
+			}
+
+			// unterminated formatter
+			if(*iter == 0) RDCDUMPMSG("Unterminated % formatter found after width");
+		}
+		else
+		{
+			// no width specified
+			formatter.Width = FormatterParams::NoWidth;
+		}
+	}
+
+	// parse out precision. 0 is valid here, but negative isn't
+	{
+		// precision found
+		if(*iter == '.')
+		{
+			iter++;
+
+			// invalid character following '.' it should be an integer
+			// note standard printf supports * here to read precision from a vararg
+			if(*iter < '0' || *iter > '9') RDCDUMPMSG("Unexpected character expecting precision");
+
+			formatter.Precision = int(*iter - '0');
+			iter++; // step to next character
+
+			// continue while encountering digits, accumulating into width
+			while(*iter >= '0' && *iter <= '9')
+			{
+				formatter.Precision *= 10;
+				formatter.Precision += int(*iter - '0');
+				iter++;
+			}
+
+			// unterminated formatter
+			if(*iter == 0) RDCDUMPMSG("Unterminated % formatter found after precision");
+		}
+		else
+		{
+			// no precision specified
+			formatter.Precision = FormatterParams::NoPrecision;
+		}
+	}
+
+	// parse out length modifier
+	{
+		// length modifier characters are assumed to be disjoint with format specifiers
+		// so that we don't have to look-ahead to determine if a character is a length
+		// modifier or format specifier.
+		
+		     if(*iter == 'z')  formatter.Length = SizeT;
+		else if(*iter == 'l')
+		{
+			if(*(iter+1) == 'l') formatter.Length = LongLong;
+			else                 formatter.Length = Long;
+		}
+		else if(*iter == 'L')  formatter.Length = Long;
+		else if(*iter == 'h')
+		{
+			if(*(iter+1) == 'h') formatter.Length = HalfHalf;
+			else                 formatter.Length = Half;
+		}
+		else
+		{
+			formatter.Length = None;
+		}
+
+		if(formatter.Length == HalfHalf || formatter.Length == LongLong)
+			iter += 2;
+		else if(formatter.Length != None)
+			iter++;
+	}
+
+	return iter;
+}
+
 int utf8printf(char *buf, size_t bufsize, const char *fmt, va_list args)
 {
 	// format, buffer and string arguments are assumed to be UTF-8 (except wide strings).
@@ -1101,122 +1232,7 @@ int utf8printf(char *buf, size_t bufsize, const char *fmt, va_list args)
 		
 		FormatterParams formatter;
 
-		//////////////////////////////
-		// now parsing an argument specifier
-
-		// parse out 0 or more flags
-		do
-		{
-			// if flag is found, continue looping to possibly find more flags
-			// otherwise break out of this loop
-			     if(*iter == '-') formatter.Flags |= LeftJustify;
-			else if(*iter == '+') formatter.Flags |= PrependPos;
-			else if(*iter == ' ') formatter.Flags |= PrependSpace;
-			else if(*iter == '#') formatter.Flags |= AlternateForm;
-			else if(*iter == '0') formatter.Flags |= PadZeroes;
-			else                  break;
-
-			// left justify overrides pad with zeroes
-			if(formatter.Flags & LeftJustify)
-				formatter.Flags &= ~PadZeroes;
-
-			// prepend + overrides prepend ' '
-			if(formatter.Flags & PrependPos)
-				formatter.Flags &= ~PrependSpace;
-
-			iter++;
-		} while(true);
-
-		// possibly parse a width. Note that width always started with 1-9 as it's decimal,
-		// and 0 or - would have been picked up as a flag above
-		{
-			// note standard printf supports * here to read precision from a vararg before
-			// the actual argument. We don't support that
-
-			// Width found
-			if(*iter >= '1' && *iter <= '9')
-			{
-				formatter.Width = int(*iter - '0');
-				iter++; // step to next character
-
-				// continue while encountering digits, accumulating into width
-				while(*iter >= '0' && *iter <= '9')
-				{
-					formatter.Width *= 10;
-					formatter.Width += int(*iter - '0');
-					iter++;
-				}
-
-				// unterminated formatter
-				if(*iter == 0) RDCDUMPMSG("Unterminated % formatter found after width");
-			}
-			else
-			{
-				// no width specified
-				formatter.Width = FormatterParams::NoWidth;
-			}
-		}
-
-		// parse out precision. 0 is valid here, but negative isn't
-		{
-			// precision found
-			if(*iter == '.')
-			{
-				iter++;
-
-				// invalid character following '.' it should be an integer
-				// note standard printf supports * here to read precision from a vararg
-				if(*iter < '0' || *iter > '9') RDCDUMPMSG("Unexpected character expecting precision");
-
-				formatter.Precision = int(*iter - '0');
-				iter++; // step to next character
-
-				// continue while encountering digits, accumulating into width
-				while(*iter >= '0' && *iter <= '9')
-				{
-					formatter.Precision *= 10;
-					formatter.Precision += int(*iter - '0');
-					iter++;
-				}
-
-				// unterminated formatter
-				if(*iter == 0) RDCDUMPMSG("Unterminated % formatter found after precision");
-			}
-			else
-			{
-				// no precision specified
-				formatter.Precision = FormatterParams::NoPrecision;
-			}
-		}
-
-		// parse out length modifier
-		{
-			// length modifier characters are assumed to be disjoint with format specifiers
-			// so that we don't have to look-ahead to determine if a character is a length
-			// modifier or format specifier.
-			
-			     if(*iter == 'z')  formatter.Length = SizeT;
-			else if(*iter == 'l')
-			{
-				if(*(iter+1) == 'l') formatter.Length = LongLong;
-				else                 formatter.Length = Long;
-			}
-			else if(*iter == 'L')  formatter.Length = Long;
-			else if(*iter == 'h')
-			{
-				if(*(iter+1) == 'h') formatter.Length = HalfHalf;
-				else                 formatter.Length = Half;
-			}
-			else
-			{
-				formatter.Length = None;
-			}
-
-			if(formatter.Length == HalfHalf || formatter.Length == LongLong)
-				iter += 2;
-			else if(formatter.Length != None)
-				iter++;
-		}
+		iter = ParseFormatter(iter, formatter);
 
 		// now we parse the format specifier itself and apply all the information
 		// we grabbed above
@@ -1320,3 +1336,161 @@ int utf8printf(char *buf, size_t bufsize, const char *fmt, va_list args)
 
 	return int(actualsize);
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// bulk formatting of arrays of values with one pre-parsed conversion
+
+template<typename T>
+struct BulkFormat
+{
+	FormatterParams formatter;
+	char type;
+	bool floatType;
+
+	const T *values;
+	size_t count, columns;
+
+	const char *colSep, *rowSep;
+	size_t colSepLen, rowSepLen;
+
+	// formatted text for each range of rows, keyed by its first row
+	Threading::CriticalSection lock;
+	vector< std::pair<size_t, string> > chunks;
+};
+
+template<typename T>
+static void FormatValueRange(const BulkFormat<T> &fmt, size_t begin, size_t end, string &output)
+{
+	output.reserve(output.size() + (end-begin)*(12 + fmt.colSepLen) + ((end-begin)/fmt.columns)*fmt.rowSepLen);
+
+	char buf[128];
+	vector<char> big;
+
+	for(size_t i=begin; i < end; i++)
+	{
+		uint64_t elem = 0;
+		if(fmt.floatType)
+			*(double *)&elem = (double)fmt.values[i];
+		else
+			*(T *)&elem = fmt.values[i];
+
+		char *out = buf;
+		size_t actualsize = 0;
+		formatargument(fmt.type, &elem, fmt.formatter, out, actualsize, buf + sizeof(buf));
+
+		if(actualsize <= sizeof(buf))
+		{
+			output.append(buf, actualsize);
+		}
+		else
+		{
+			// very wide or very long %f output, format again with enough space
+			big.resize(actualsize);
+			out = &big[0];
+			actualsize = 0;
+			formatargument(fmt.type, &elem, fmt.formatter, out, actualsize, &big[0] + big.size());
+			output.append(&big[0], actualsize);
+		}
+
+		if((i+1) % fmt.columns == 0)
+			output.append(fmt.rowSep, fmt.rowSepLen);
+		else
+			output.append(fmt.colSep, fmt.colSepLen);
+	}
+}
+
+template<typename T>
+static void FormatRowRange(void *userData, size_t beginRow, size_t endRow)
+{
+	BulkFormat<T> &fmt = *(BulkFormat<T> *)userData;
+
+	string str;
+	FormatValueRange(fmt, beginRow*fmt.columns, RDCMIN(endRow*fmt.columns, fmt.count), str);
+
+	SCOPED_LOCK(fmt.lock);
+	fmt.chunks.push_back(std::make_pair(beginRow, string()));
+	fmt.chunks.back().second.swap(str);
+}
+
+template<typename T>
+static bool FormatValues(const char *format, bool floatType, const T *values, size_t count, size_t columns,
+                         const char *colSep, const char *rowSep, string &output)
+{
+	if(format == NULL || format[0] != '%')
+	{
+		RDCERR("Bulk format '%s' must be a single %% conversion", format ? format : "");
+		return false;
+	}
+
+	BulkFormat<T> fmt;
+
+	const char *iter = ParseFormatter(format+1, fmt.formatter);
+	fmt.type = *iter;
+
+	char type = fmt.type;
+	bool typeFloat = (type == 'e' || type == 'E' || type == 'f' || type == 'F' || type == 'g' || type == 'G');
+	bool typeInt = (type == 'b' || type == 'B' || type == 'o' || type == 'x' || type == 'X' ||
+	                type == 'd' || type == 'i' || type == 'u');
+
+	if(iter[0] == 0 || iter[1] != 0 || (floatType ? !typeFloat : !typeInt))
+	{
+		RDCERR("Bulk format '%s' must be a single %s conversion", format, floatType ? "floating point" : "integer");
+		return false;
+	}
+
+	// values are always 32-bit, the length modifier can only truncate them further
+	if(fmt.formatter.Length != Half && fmt.formatter.Length != HalfHalf)
+		fmt.formatter.Length = None;
+
+	fmt.floatType = floatType;
+	fmt.values = values;
+	fmt.count = count;
+	fmt.columns = RDCMAX((size_t)1, columns);
+	fmt.colSep = colSep ? colSep : "";
+	fmt.rowSep = rowSep ? rowSep : "";
+	fmt.colSepLen = strlen(fmt.colSep);
+	fmt.rowSepLen = strlen(fmt.rowSep);
+
+	// each value is formatted independently, so large arrays are split by rows across threads
+	// and the pieces joined in order afterwards
+	size_t numRows = (count + fmt.columns - 1) / fmt.columns;
+	size_t minRowsPerThread = RDCMAX((size_t)1, (size_t)16384 / fmt.columns);
+
+	Threading::ParallelFor(numRows, minRowsPerThread, &FormatRowRange<T>, &fmt);
+
+	std::sort(fmt.chunks.begin(), fmt.chunks.end());
+
+	size_t total = 0;
+	for(size_t i=0; i < fmt.chunks.size(); i++)
+		total += fmt.chunks[i].second.size();
+
+	output.reserve(output.size() + total);
+
+	for(size_t i=0; i < fmt.chunks.size(); i++)
+		output.append(fmt.chunks[i].second);
+
+	return true;
+}
+
+namespace StringFormat
+{
+
+bool FormatFloats(const char *format, const float *values, size_t count, size_t columns,
+                  const char *colSep, const char *rowSep, string &output)
+{
+	return FormatValues(format, true, values, count, columns, colSep, rowSep, output);
+}
+
+bool FormatInts(const char *format, const int32_t *values, size_t count, size_t columns,
+                const char *colSep, const char *rowSep, string &output)
+{
+	return FormatValues(format, false, values, count, columns, colSep, rowSep, output);
+}
+
+bool FormatUInts(const char *format, const uint32_t *values, size_t count, size_t columns,
+                 const char *colSep, const char *rowSep, string &output)
+{
+	return FormatValues(format, false, values, count, columns, colSep, rowSep, output);
+}
+
+};
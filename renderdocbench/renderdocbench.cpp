@@ -0,0 +1,161 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 Crytek
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <app/renderdoc_app.h>
+
+#include "renderdocbench.h"
+
+using std::vector;
+
+// frames run before timing, so first-use costs like shader compiles in the driver don't count
+static const int warmupFrames = 5;
+
+static void Usage()
+{
+	fprintf(stderr, "renderdocbench usage:\n\n");
+	fprintf(stderr, "  --capture                         Capture every timed frame. renderdoc must be loaded.\n");
+	fprintf(stderr, "  --frames N                        Number of frames to time for each workload (default 20).\n");
+	fprintf(stderr, "  --workload NAME                   Only run the named workload.\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, "Run natively, then launched through renderdoc, then launched through renderdoc with\n");
+	fprintf(stderr, "--capture, and compare the us_per_call of each result. Results are one JSON object\n");
+	fprintf(stderr, "per line on stdout.\n");
+}
+
+int renderdocbench(int argc, char **argv)
+{
+	bool capture = false;
+	int frames = 20;
+	const char *only = NULL;
+
+	for(int i=1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "--capture"))
+		{
+			capture = true;
+		}
+		else if(!strcmp(argv[i], "--frames") && i+1 < argc)
+		{
+			frames = atoi(argv[++i]);
+		}
+		else if(!strcmp(argv[i], "--workload") && i+1 < argc)
+		{
+			only = argv[++i];
+		}
+		else
+		{
+			Usage();
+			return 1;
+		}
+	}
+
+	if(frames <= 0)
+	{
+		Usage();
+		return 1;
+	}
+
+	pRENDERDOC_StartFrameCapture startCapture = (pRENDERDOC_StartFrameCapture)GetRenderDocFunction("RENDERDOC_StartFrameCapture");
+	pRENDERDOC_EndFrameCapture endCapture = (pRENDERDOC_EndFrameCapture)GetRenderDocFunction("RENDERDOC_EndFrameCapture");
+
+	bool loaded = startCapture && endCapture;
+
+	if(capture && !loaded)
+	{
+		fprintf(stderr, "--capture needs renderdoc to be loaded into the process\n");
+		return 1;
+	}
+
+	const char *mode = capture ? "capture" : (loaded ? "idle" : "native");
+
+	if(!InitAPI())
+	{
+		fprintf(stderr, "Couldn't initialise %s\n", GetAPIName());
+		return 1;
+	}
+
+	vector<Workload *> workloads;
+	CreateWorkloads(workloads);
+
+	for(size_t w=0; w < workloads.size(); w++)
+	{
+		Workload *work = workloads[w];
+
+		if(only && strcmp(only, work->Name()))
+			continue;
+
+		if(!work->Init())
+		{
+			fprintf(stderr, "Skipping %s, not supported\n", work->Name());
+			work->Shutdown();
+			continue;
+		}
+
+		for(int f=0; f < warmupFrames; f++)
+		{
+			work->Run();
+			Present();
+		}
+
+		double time = 0.0;
+		uint64_t calls = 0;
+
+		// only the workload's own calls are timed, not the end of the capture which is
+		// dominated by writing the capture to disk
+		for(int f=0; f < frames; f++)
+		{
+			if(capture)
+				startCapture(NULL, NULL);
+
+			double start = GetTimeMilliseconds();
+			calls += work->Run();
+			time += GetTimeMilliseconds() - start;
+
+			if(capture)
+				endCapture(NULL, NULL);
+
+			Present();
+		}
+
+		work->Shutdown();
+
+		printf("{ \"api\": \"%s\", \"workload\": \"%s\", \"mode\": \"%s\", \"frames\": %d, \"calls\": %llu, "
+		       "\"ms_per_frame\": %.4f, \"us_per_call\": %.4f }\n",
+		       GetAPIName(), work->Name(), mode, frames, (unsigned long long)calls,
+		       time/double(frames), calls ? time*1000.0/double(calls) : 0.0);
+		fflush(stdout);
+	}
+
+	for(size_t w=0; w < workloads.size(); w++)
+		delete workloads[w];
+
+	ShutdownAPI();
+
+	return 0;
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 Crytek
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// one synthetic pattern of API calls, run once per frame. The benchmark times Run() with
+// renderdoc absent, injected but idle, and capturing, so each workload should spend nearly
+// all its time making API calls rather than doing its own work.
+struct Workload
+{
+	virtual ~Workload() {}
+
+	virtual const char *Name() = 0;
+
+	// returns false if the workload isn't supported here, and it's skipped
+	virtual bool Init() = 0;
+	// makes one frame's worth of calls, and returns how many API calls it made
+	virtual uint32_t Run() = 0;
+	virtual void Shutdown() = 0;
+};
+
+// defined in platform .cpps
+
+// create a window and device or context to run workloads on
+bool InitAPI();
+void ShutdownAPI();
+const char *GetAPIName();
+void Present();
+
+void CreateWorkloads(std::vector<Workload *> &workloads);
+
+double GetTimeMilliseconds();
+
+// looks up an exported function from renderdoc, or NULL if renderdoc isn't loaded
+void *GetRenderDocFunction(const char *name);
+
+// the GL workloads in renderdocbench_gl.cpp are portable, but only built on linux for now
+
+// looks up a GL entry point, for the GL workloads
+void *GetGLFunction(const char *name);
+
+void CreateGLWorkloads(std::vector<Workload *> &workloads);
@@ -0,0 +1,331 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 Crytek
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include <string.h>
+#include <stdio.h>
+
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+#include "renderdocbench.h"
+
+using std::vector;
+
+#define GL_FUNCS(F) \
+	F(PFNGLGETSTRINGIPROC, glGetStringi) \
+	F(PFNGLGENBUFFERSPROC, glGenBuffers) \
+	F(PFNGLBINDBUFFERPROC, glBindBuffer) \
+	F(PFNGLBUFFERDATAPROC, glBufferData) \
+	F(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange) \
+	F(PFNGLUNMAPBUFFERPROC, glUnmapBuffer) \
+	F(PFNGLDELETEBUFFERSPROC, glDeleteBuffers) \
+	F(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays) \
+	F(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray) \
+	F(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays) \
+	F(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray) \
+	F(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer) \
+	F(PFNGLCREATESHADERPROC, glCreateShader) \
+	F(PFNGLSHADERSOURCEPROC, glShaderSource) \
+	F(PFNGLCOMPILESHADERPROC, glCompileShader) \
+	F(PFNGLDELETESHADERPROC, glDeleteShader) \
+	F(PFNGLCREATEPROGRAMPROC, glCreateProgram) \
+	F(PFNGLATTACHSHADERPROC, glAttachShader) \
+	F(PFNGLLINKPROGRAMPROC, glLinkProgram) \
+	F(PFNGLGETPROGRAMIVPROC, glGetProgramiv) \
+	F(PFNGLUSEPROGRAMPROC, glUseProgram) \
+	F(PFNGLDELETEPROGRAMPROC, glDeleteProgram)
+
+// only needs GL_ARB_buffer_storage, for the persistent map workload
+#define GL_OPTIONAL_FUNCS(F) \
+	F(PFNGLBUFFERSTORAGEPROC, glBufferStorage)
+
+#define DECLARE_FUNC(type, name) static type name = NULL;
+GL_FUNCS(DECLARE_FUNC)
+GL_OPTIONAL_FUNCS(DECLARE_FUNC)
+#undef DECLARE_FUNC
+
+static bool LoadGLFunctions()
+{
+	bool ret = true;
+
+#define LOAD_FUNC(type, name) name = (type)GetGLFunction(#name); if(name == NULL) { fprintf(stderr, "Missing " #name "\n"); ret = false; }
+	GL_FUNCS(LOAD_FUNC)
+#undef LOAD_FUNC
+
+#define LOAD_FUNC(type, name) name = (type)GetGLFunction(#name);
+	GL_OPTIONAL_FUNCS(LOAD_FUNC)
+#undef LOAD_FUNC
+
+	return ret;
+}
+
+static bool HasExtension(const char *ext)
+{
+	GLint num = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &num);
+
+	for(GLint i=0; i < num; i++)
+		if(!strcmp((const char *)glGetStringi(GL_EXTENSIONS, i), ext))
+			return true;
+
+	return false;
+}
+
+static const char *vertexSource =
+	"#version 330 core\n"
+	"layout(location = 0) in vec2 pos;\n"
+	"void main() { gl_Position = vec4(pos, 0.0, 1.0); }\n";
+
+static const char *fragmentSource =
+	"#version 330 core\n"
+	"out vec4 col;\n"
+	"void main() { col = vec4(1.0, 0.0, 0.0, 1.0); }\n";
+
+static GLuint CompileProgram(const char *vs, const char *fs)
+{
+	GLuint vsh = glCreateShader(GL_VERTEX_SHADER);
+	GLuint fsh = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(vsh, 1, &vs, NULL);
+	glShaderSource(fsh, 1, &fs, NULL);
+	glCompileShader(vsh);
+	glCompileShader(fsh);
+
+	GLuint prog = glCreateProgram();
+	glAttachShader(prog, vsh);
+	glAttachShader(prog, fsh);
+	glLinkProgram(prog);
+
+	glDeleteShader(vsh);
+	glDeleteShader(fsh);
+
+	return prog;
+}
+
+// a single triangle, drawn many times with nothing changing in between
+struct GLSmallDraws : public Workload
+{
+	static const uint32_t numDraws = 1000;
+
+	GLuint prog, vao, vbo;
+
+	GLSmallDraws() : prog(0), vao(0), vbo(0) {}
+
+	const char *Name() { return "small_draws"; }
+
+	bool Init()
+	{
+		const float verts[] = { -0.1f, -0.1f, 0.1f, -0.1f, 0.0f, 0.1f };
+
+		prog = CompileProgram(vertexSource, fragmentSource);
+
+		glGenVertexArrays(1, &vao);
+		glBindVertexArray(vao);
+
+		glGenBuffers(1, &vbo);
+		glBindBuffer(GL_ARRAY_BUFFER, vbo);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(verts), verts, GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+		glEnableVertexAttribArray(0);
+
+		GLint linked = 0;
+		glGetProgramiv(prog, GL_LINK_STATUS, &linked);
+		return linked != 0;
+	}
+
+	uint32_t Run()
+	{
+		glUseProgram(prog);
+		glBindVertexArray(vao);
+
+		for(uint32_t i=0; i < numDraws; i++)
+			glDrawArrays(GL_TRIANGLES, 0, 3);
+
+		return numDraws + 2;
+	}
+
+	void Shutdown()
+	{
+		glDeleteProgram(prog);
+		glDeleteBuffers(1, &vbo);
+		glDeleteVertexArrays(1, &vao);
+	}
+};
+
+// repeatedly mapping a dynamic buffer, orphaning it each time
+struct GLBufferMaps : public Workload
+{
+	static const uint32_t numMaps = 200;
+	static const GLsizeiptr bufferSize = 64*1024;
+
+	GLuint buf;
+
+	GLBufferMaps() : buf(0) {}
+
+	const char *Name() { return "buffer_maps"; }
+
+	bool Init()
+	{
+		glGenBuffers(1, &buf);
+		glBindBuffer(GL_ARRAY_BUFFER, buf);
+		glBufferData(GL_ARRAY_BUFFER, bufferSize, NULL, GL_DYNAMIC_DRAW);
+		return true;
+	}
+
+	uint32_t Run()
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, buf);
+
+		for(uint32_t i=0; i < numMaps; i++)
+		{
+			void *ptr = glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, GL_MAP_WRITE_BIT|GL_MAP_INVALIDATE_BUFFER_BIT);
+			if(ptr)
+				memset(ptr, i&0xff, (size_t)bufferSize);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+
+		return numMaps*2 + 1;
+	}
+
+	void Shutdown()
+	{
+		glDeleteBuffers(1, &buf);
+	}
+};
+
+// a persistently mapped vertex buffer, written to a different region before each draw
+struct GLPersistentMaps : public Workload
+{
+	static const uint32_t numDraws = 200;
+	static const GLsizeiptr regionSize = 16*1024;
+
+	GLuint prog, vao, buf;
+	float *ptr;
+
+	GLPersistentMaps() : prog(0), vao(0), buf(0), ptr(NULL) {}
+
+	const char *Name() { return "persistent_maps"; }
+
+	bool Init()
+	{
+		if(glBufferStorage == NULL || !HasExtension("GL_ARB_buffer_storage"))
+			return false;
+
+		prog = CompileProgram(vertexSource, fragmentSource);
+
+		glGenVertexArrays(1, &vao);
+		glBindVertexArray(vao);
+
+		GLbitfield flags = GL_MAP_WRITE_BIT|GL_MAP_PERSISTENT_BIT|GL_MAP_COHERENT_BIT;
+
+		glGenBuffers(1, &buf);
+		glBindBuffer(GL_ARRAY_BUFFER, buf);
+		glBufferStorage(GL_ARRAY_BUFFER, regionSize*numDraws, NULL, flags);
+		ptr = (float *)glMapBufferRange(GL_ARRAY_BUFFER, 0, regionSize*numDraws, flags);
+
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+		glEnableVertexAttribArray(0);
+
+		return ptr != NULL;
+	}
+
+	uint32_t Run()
+	{
+		glUseProgram(prog);
+		glBindVertexArray(vao);
+
+		const GLint vertsPerRegion = GLint(regionSize/(sizeof(float)*2));
+
+		for(uint32_t i=0; i < numDraws; i++)
+		{
+			float *region = ptr + i*(regionSize/sizeof(float));
+			for(GLint v=0; v < 3; v++)
+			{
+				region[v*2+0] = float(v&1)*0.1f;
+				region[v*2+1] = float(v>>1)*0.1f;
+			}
+
+			glDrawArrays(GL_TRIANGLES, GLint(i)*vertsPerRegion, 3);
+		}
+
+		return numDraws + 2;
+	}
+
+	void Shutdown()
+	{
+		if(buf)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, buf);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+		glDeleteProgram(prog);
+		glDeleteBuffers(1, &buf);
+		glDeleteVertexArrays(1, &vao);
+	}
+};
+
+// creating and linking many programs, each with unique source so nothing can be cached
+struct GLShaderStorm : public Workload
+{
+	static const uint32_t numPrograms = 20;
+
+	uint32_t counter;
+
+	GLShaderStorm() : counter(0) {}
+
+	const char *Name() { return "shader_storm"; }
+
+	bool Init() { return true; }
+
+	uint32_t Run()
+	{
+		for(uint32_t i=0; i < numPrograms; i++)
+		{
+			char vs[512], fs[512];
+			snprintf(vs, sizeof(vs), "%s// %u\n", vertexSource, counter);
+			snprintf(fs, sizeof(fs), "%s// %u\n", fragmentSource, counter);
+			counter++;
+
+			GLuint prog = CompileProgram(vs, fs);
+			glDeleteProgram(prog);
+		}
+
+		// create, source and compile for each shader, create, 2 attaches, link, 2 shader
+		// deletes and the program delete
+		return numPrograms*13;
+	}
+
+	void Shutdown() {}
+};
+
+void CreateGLWorkloads(vector<Workload *> &workloads)
+{
+	if(!LoadGLFunctions())
+		return;
+
+	workloads.push_back(new GLSmallDraws());
+	workloads.push_back(new GLBufferMaps());
+	workloads.push_back(new GLPersistentMaps());
+	workloads.push_back(new GLShaderStorm());
+}
@@ -0,0 +1,170 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 Crytek
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include <stdio.h>
+#include <time.h>
+#include <dlfcn.h>
+
+#include <X11/X.h>
+#include <X11/Xlib.h>
+#include <GL/glx.h>
+#include <GL/glxext.h>
+
+#include "renderdocbench.h"
+
+using std::vector;
+
+static Display *dpy = NULL;
+static Window win = 0;
+static GLXContext ctx = NULL;
+
+bool InitAPI()
+{
+	dpy = XOpenDisplay(NULL);
+
+	if(dpy == NULL)
+		return false;
+
+	static int visAttribs[] = { 
+		GLX_X_RENDERABLE, True,
+		GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT,
+		GLX_RENDER_TYPE, GLX_RGBA_BIT,
+		GLX_X_VISUAL_TYPE, GLX_TRUE_COLOR,
+		GLX_RED_SIZE, 8,
+		GLX_GREEN_SIZE, 8,
+		GLX_BLUE_SIZE, 8,
+		GLX_ALPHA_SIZE, 8,
+		GLX_DOUBLEBUFFER, True,
+		0
+	};
+	int numCfgs = 0;
+	GLXFBConfig *fbcfg = glXChooseFBConfig(dpy, DefaultScreen(dpy), visAttribs, &numCfgs);
+
+	if(fbcfg == NULL)
+		return false;
+
+	PFNGLXCREATECONTEXTATTRIBSARBPROC createContext =
+		(PFNGLXCREATECONTEXTATTRIBSARBPROC)glXGetProcAddress((const GLubyte *)"glXCreateContextAttribsARB");
+
+	if(createContext == NULL)
+	{
+		XFree(fbcfg);
+		return false;
+	}
+
+	XVisualInfo *vInfo = glXGetVisualFromFBConfig(dpy, fbcfg[0]);
+
+	XSetWindowAttributes swa = {0};
+	swa.event_mask = StructureNotifyMask;
+	swa.colormap = XCreateColormap(dpy, RootWindow(dpy, vInfo->screen), vInfo->visual, AllocNone);
+
+	win = XCreateWindow(dpy, RootWindow(dpy, vInfo->screen), 200, 200, 512, 512,
+	                    0, vInfo->depth, InputOutput, vInfo->visual,
+	                    CWBorderPixel | CWColormap | CWEventMask, &swa);
+
+	XStoreName(dpy, win, "renderdocbench");
+	XMapWindow(dpy, win);
+
+	XFree(vInfo);
+
+	// the newest core context we can get, persistent maps need 4.4 or GL_ARB_buffer_storage
+	const int versions[][2] = { { 4, 5 }, { 4, 3 }, { 3, 3 } };
+
+	for(size_t v=0; ctx == NULL && v < sizeof(versions)/sizeof(versions[0]); v++)
+	{
+		int attribs[] = {
+			GLX_CONTEXT_MAJOR_VERSION_ARB, versions[v][0],
+			GLX_CONTEXT_MINOR_VERSION_ARB, versions[v][1],
+			GLX_CONTEXT_PROFILE_MASK_ARB, GLX_CONTEXT_CORE_PROFILE_BIT_ARB,
+			0
+		};
+
+		ctx = createContext(dpy, fbcfg[0], 0, True, attribs);
+	}
+
+	XFree(fbcfg);
+
+	if(ctx == NULL)
+		return false;
+
+	glXMakeContextCurrent(dpy, win, win, ctx);
+
+	return true;
+}
+
+void ShutdownAPI()
+{
+	if(ctx)
+	{
+		glXMakeContextCurrent(dpy, 0, 0, NULL);
+		glXDestroyContext(dpy, ctx);
+	}
+
+	if(win)
+		XDestroyWindow(dpy, win);
+
+	if(dpy)
+		XCloseDisplay(dpy);
+}
+
+const char *GetAPIName()
+{
+	return "OpenGL";
+}
+
+void Present()
+{
+	glXSwapBuffers(dpy, win);
+}
+
+void CreateWorkloads(vector<Workload *> &workloads)
+{
+	CreateGLWorkloads(workloads);
+}
+
+double GetTimeMilliseconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return double(ts.tv_sec)*1000.0 + double(ts.tv_nsec)/1000000.0;
+}
+
+void *GetRenderDocFunction(const char *name)
+{
+	// when renderdoc is preloaded its exports are visible from the global scope
+	return dlsym(RTLD_DEFAULT, name);
+}
+
+void *GetGLFunction(const char *name)
+{
+	return (void *)glXGetProcAddress((const GLubyte *)name);
+}
+
+int renderdocbench(int argc, char **argv);
+
+int main(int argc, char *argv[])
+{
+	return renderdocbench(argc, argv);
+}
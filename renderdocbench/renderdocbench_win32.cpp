@@ -0,0 +1,424 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 Crytek
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include <windows.h>
+#include <d3d11.h>
+#include <d3dcompiler.h>
+
+#include <stdio.h>
+
+#include "renderdocbench.h"
+
+using std::vector;
+
+static HWND wnd = NULL;
+static ID3D11Device *device = NULL;
+static ID3D11DeviceContext *context = NULL;
+static IDXGISwapChain *swap = NULL;
+static ID3D11RenderTargetView *backbufferRTV = NULL;
+
+static const char *shaderSource =
+	"float4 vsmain(float2 pos : POSITION) : SV_Position { return float4(pos, 0, 1); }\n"
+	"float4 psmain() : SV_Target0 { return float4(1, 0, 0, 1); }\n";
+
+static ID3DBlob *Compile(const char *entry, const char *profile)
+{
+	ID3DBlob *blob = NULL;
+	ID3DBlob *errors = NULL;
+
+	HRESULT hr = D3DCompile(shaderSource, strlen(shaderSource), "renderdocbench", NULL, NULL,
+	                        entry, profile, 0, 0, &blob, &errors);
+
+	if(errors)
+		errors->Release();
+
+	if(FAILED(hr))
+		return NULL;
+
+	return blob;
+}
+
+// shaders and vertex input shared by the drawing workloads
+struct D3D11Pipeline
+{
+	ID3D11VertexShader *vs;
+	ID3D11PixelShader *ps;
+	ID3D11InputLayout *layout;
+	ID3D11Buffer *vb;
+
+	D3D11Pipeline() : vs(NULL), ps(NULL), layout(NULL), vb(NULL) {}
+
+	bool Init()
+	{
+		ID3DBlob *vsBlob = Compile("vsmain", "vs_4_0");
+		ID3DBlob *psBlob = Compile("psmain", "ps_4_0");
+
+		if(vsBlob == NULL || psBlob == NULL)
+		{
+			if(vsBlob) vsBlob->Release();
+			if(psBlob) psBlob->Release();
+			return false;
+		}
+
+		device->CreateVertexShader(vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), NULL, &vs);
+		device->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), NULL, &ps);
+
+		D3D11_INPUT_ELEMENT_DESC elem = { "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+		device->CreateInputLayout(&elem, 1, vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), &layout);
+
+		vsBlob->Release();
+		psBlob->Release();
+
+		const float verts[] = { -0.1f, -0.1f, 0.0f, 0.1f, 0.1f, -0.1f };
+
+		D3D11_BUFFER_DESC desc = { sizeof(verts), D3D11_USAGE_IMMUTABLE, D3D11_BIND_VERTEX_BUFFER, 0, 0, 0 };
+		D3D11_SUBRESOURCE_DATA data = { verts, 0, 0 };
+		device->CreateBuffer(&desc, &data, &vb);
+
+		return vs && ps && layout && vb;
+	}
+
+	// returns the number of calls made
+	uint32_t Bind(ID3D11DeviceContext *ctx)
+	{
+		UINT stride = sizeof(float)*2, offset = 0;
+		D3D11_VIEWPORT view = { 0.0f, 0.0f, 512.0f, 512.0f, 0.0f, 1.0f };
+
+		ctx->IASetInputLayout(layout);
+		ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		ctx->IASetVertexBuffers(0, 1, &vb, &stride, &offset);
+		ctx->VSSetShader(vs, NULL, 0);
+		ctx->PSSetShader(ps, NULL, 0);
+		ctx->RSSetViewports(1, &view);
+		ctx->OMSetRenderTargets(1, &backbufferRTV, NULL);
+
+		return 7;
+	}
+
+	void Shutdown()
+	{
+		if(vs) vs->Release();
+		if(ps) ps->Release();
+		if(layout) layout->Release();
+		if(vb) vb->Release();
+		vs = NULL; ps = NULL; layout = NULL; vb = NULL;
+	}
+};
+
+// a single triangle, drawn many times with nothing changing in between
+struct D3D11SmallDraws : public Workload
+{
+	static const uint32_t numDraws = 1000;
+
+	D3D11Pipeline pipe;
+
+	const char *Name() { return "small_draws"; }
+
+	bool Init() { return pipe.Init(); }
+
+	uint32_t Run()
+	{
+		uint32_t calls = pipe.Bind(context);
+
+		for(uint32_t i=0; i < numDraws; i++)
+			context->Draw(3, 0);
+
+		return calls + numDraws;
+	}
+
+	void Shutdown() { pipe.Shutdown(); }
+};
+
+// repeatedly mapping a dynamic buffer with discard
+struct D3D11BufferMaps : public Workload
+{
+	static const uint32_t numMaps = 200;
+	static const UINT bufferSize = 64*1024;
+
+	ID3D11Buffer *buf;
+
+	D3D11BufferMaps() : buf(NULL) {}
+
+	const char *Name() { return "buffer_maps"; }
+
+	bool Init()
+	{
+		D3D11_BUFFER_DESC desc = { bufferSize, D3D11_USAGE_DYNAMIC, D3D11_BIND_VERTEX_BUFFER, D3D11_CPU_ACCESS_WRITE, 0, 0 };
+		return SUCCEEDED(device->CreateBuffer(&desc, NULL, &buf));
+	}
+
+	uint32_t Run()
+	{
+		for(uint32_t i=0; i < numMaps; i++)
+		{
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			if(SUCCEEDED(context->Map(buf, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+			{
+				memset(mapped.pData, i&0xff, bufferSize);
+				context->Unmap(buf, 0);
+			}
+		}
+
+		return numMaps*2;
+	}
+
+	void Shutdown()
+	{
+		if(buf) buf->Release();
+		buf = NULL;
+	}
+};
+
+// recording draws on several deferred contexts and executing the command lists
+struct D3D11DeferredContexts : public Workload
+{
+	static const uint32_t numContexts = 4;
+	static const uint32_t drawsPerContext = 250;
+
+	D3D11Pipeline pipe;
+	ID3D11DeviceContext *deferred[numContexts];
+
+	D3D11DeferredContexts()
+	{
+		for(uint32_t i=0; i < numContexts; i++)
+			deferred[i] = NULL;
+	}
+
+	const char *Name() { return "deferred_contexts"; }
+
+	bool Init()
+	{
+		for(uint32_t i=0; i < numContexts; i++)
+			if(FAILED(device->CreateDeferredContext(0, &deferred[i])))
+				return false;
+
+		return pipe.Init();
+	}
+
+	uint32_t Run()
+	{
+		uint32_t calls = 0;
+
+		ID3D11CommandList *lists[numContexts] = { NULL };
+
+		for(uint32_t i=0; i < numContexts; i++)
+		{
+			calls += pipe.Bind(deferred[i]);
+
+			for(uint32_t d=0; d < drawsPerContext; d++)
+				deferred[i]->Draw(3, 0);
+
+			deferred[i]->FinishCommandList(FALSE, &lists[i]);
+
+			calls += drawsPerContext + 1;
+		}
+
+		for(uint32_t i=0; i < numContexts; i++)
+		{
+			if(lists[i])
+			{
+				context->ExecuteCommandList(lists[i], TRUE);
+				lists[i]->Release();
+			}
+
+			calls++;
+		}
+
+		return calls;
+	}
+
+	void Shutdown()
+	{
+		for(uint32_t i=0; i < numContexts; i++)
+		{
+			if(deferred[i]) deferred[i]->Release();
+			deferred[i] = NULL;
+		}
+
+		pipe.Shutdown();
+	}
+};
+
+// creating many shaders from the same bytecode
+struct D3D11ShaderStorm : public Workload
+{
+	static const uint32_t numShaders = 50;
+
+	ID3DBlob *vsBlob, *psBlob;
+
+	D3D11ShaderStorm() : vsBlob(NULL), psBlob(NULL) {}
+
+	const char *Name() { return "shader_storm"; }
+
+	bool Init()
+	{
+		vsBlob = Compile("vsmain", "vs_4_0");
+		psBlob = Compile("psmain", "ps_4_0");
+
+		return vsBlob && psBlob;
+	}
+
+	uint32_t Run()
+	{
+		for(uint32_t i=0; i < numShaders; i++)
+		{
+			ID3D11VertexShader *vs = NULL;
+			ID3D11PixelShader *ps = NULL;
+
+			device->CreateVertexShader(vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), NULL, &vs);
+			device->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), NULL, &ps);
+
+			if(vs) vs->Release();
+			if(ps) ps->Release();
+		}
+
+		return numShaders*4;
+	}
+
+	void Shutdown()
+	{
+		if(vsBlob) vsBlob->Release();
+		if(psBlob) psBlob->Release();
+		vsBlob = psBlob = NULL;
+	}
+};
+
+static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
+{
+	if(msg == WM_CLOSE) { DestroyWindow(hwnd); return 0; }
+	if(msg == WM_DESTROY) { PostQuitMessage(0); return 0; }
+	return DefWindowProc(hwnd, msg, wParam, lParam);
+}
+
+bool InitAPI()
+{
+	HINSTANCE hInstance = GetModuleHandle(NULL);
+
+	WNDCLASSEX wc;
+	ZeroMemory(&wc, sizeof(wc));
+	wc.cbSize = sizeof(WNDCLASSEX);
+	wc.lpfnWndProc = WndProc;
+	wc.hInstance = hInstance;
+	wc.hCursor = LoadCursor(NULL, IDC_ARROW);
+	wc.lpszClassName = L"renderdocbench";
+
+	if(!RegisterClassEx(&wc))
+		return false;
+
+	wnd = CreateWindowEx(WS_EX_CLIENTEDGE, L"renderdocbench", L"renderdocbench", WS_OVERLAPPEDWINDOW,
+	                     CW_USEDEFAULT, CW_USEDEFAULT, 512, 512, NULL, NULL, hInstance, NULL);
+
+	if(wnd == NULL)
+		return false;
+
+	ShowWindow(wnd, SW_SHOW);
+
+	DXGI_SWAP_CHAIN_DESC swapDesc;
+	ZeroMemory(&swapDesc, sizeof(swapDesc));
+	swapDesc.BufferCount = 1;
+	swapDesc.BufferDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	swapDesc.BufferDesc.Width = 512;
+	swapDesc.BufferDesc.Height = 512;
+	swapDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+	swapDesc.OutputWindow = wnd;
+	swapDesc.SampleDesc.Count = 1;
+	swapDesc.Windowed = TRUE;
+
+	HRESULT hr = D3D11CreateDeviceAndSwapChain(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, 0, NULL, 0,
+	                                           D3D11_SDK_VERSION, &swapDesc, &swap, &device, NULL, &context);
+
+	if(FAILED(hr))
+		return false;
+
+	ID3D11Texture2D *backbuffer = NULL;
+	swap->GetBuffer(0, __uuidof(ID3D11Texture2D), (void **)&backbuffer);
+	device->CreateRenderTargetView(backbuffer, NULL, &backbufferRTV);
+	backbuffer->Release();
+
+	return true;
+}
+
+void ShutdownAPI()
+{
+	if(backbufferRTV) backbufferRTV->Release();
+	if(swap) swap->Release();
+	if(context) context->Release();
+	if(device) device->Release();
+
+	if(wnd)
+		DestroyWindow(wnd);
+}
+
+const char *GetAPIName()
+{
+	return "D3D11";
+}
+
+void Present()
+{
+	MSG msg;
+	while(PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+	{
+		TranslateMessage(&msg);
+		DispatchMessage(&msg);
+	}
+
+	swap->Present(0, 0);
+}
+
+void CreateWorkloads(vector<Workload *> &workloads)
+{
+	workloads.push_back(new D3D11SmallDraws());
+	workloads.push_back(new D3D11BufferMaps());
+	workloads.push_back(new D3D11DeferredContexts());
+	workloads.push_back(new D3D11ShaderStorm());
+}
+
+double GetTimeMilliseconds()
+{
+	LARGE_INTEGER freq, now;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+
+	return double(now.QuadPart)*1000.0/double(freq.QuadPart);
+}
+
+void *GetRenderDocFunction(const char *name)
+{
+	// only present if renderdoc injected itself into the process
+	HMODULE mod = GetModuleHandleA("renderdoc.dll");
+
+	if(mod == NULL)
+		return NULL;
+
+	return (void *)GetProcAddress(mod, name);
+}
+
+int renderdocbench(int argc, char **argv);
+
+int main(int argc, char *argv[])
+{
+	return renderdocbench(argc, argv);
+}
@@ -23,12 +23,15 @@
  ******************************************************************************/
 
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #include <replay/renderdoc_replay.h>
 #include <app/renderdoc_app.h>
 
 using std::string;
 using std::wstring;
+using std::vector;
 
 uint32_t wtoi(wchar_t *str)
 {
@@ -70,11 +73,12 @@ bool argequal(const char *a, const char *b)
 	return *a == 0 && *b == 0;
 }
 
-// defined in platform .cpps
-void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg);
+// defined in platform .cpps. If loops is non-zero, the whole frame is replayed and presented
+// that many times and then the window closes, otherwise it's displayed until closed.
+void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg, uint32_t loops);
 wstring GetUsername();
 
-void DisplayRendererPreview(ReplayRenderer *renderer)
+void DisplayRendererPreview(ReplayRenderer *renderer, uint32_t loops)
 {
 	if(renderer == NULL) return;
 
@@ -110,7 +114,318 @@ void DisplayRendererPreview(ReplayRenderer *renderer)
 		}
 	}
 
-	DisplayRendererPreview(renderer, d);
+	DisplayRendererPreview(renderer, d, loops);
+}
+
+// defined in platform .cpps
+double GetTimeMilliseconds();
+uint64_t GetPeakMemoryBytes();
+
+static void CollectDrawEvents(const rdctype::array<FetchDrawcall> &draws, vector<uint32_t> &events)
+{
+	for(int32_t i=0; i < draws.count; i++)
+	{
+		if(draws[i].children.count > 0)
+			CollectDrawEvents(draws[i].children, events);
+		else
+			events.push_back(draws[i].eventID);
+	}
+}
+
+static string EscapeJSON(const char *str)
+{
+	string escaped;
+	for(const char *c=str; *c; c++)
+	{
+		if(*c == '"' || *c == '\\')
+			escaped.push_back('\\');
+		escaped.push_back(*c);
+	}
+	return escaped;
+}
+
+static void WriteTimings(FILE *f, const char *name, vector<double> &times)
+{
+	std::sort(times.begin(), times.end());
+
+	double total = 0.0;
+	for(size_t i=0; i < times.size(); i++)
+		total += times[i];
+
+	size_t n = times.size();
+
+	fprintf(f, "  \"%s\": { \"samples\": %u, \"min_ms\": %.3f, \"median_ms\": %.3f, \"mean_ms\": %.3f, \"max_ms\": %.3f },\n",
+		name, (uint32_t)n,
+		n ? times[0] : 0.0,
+		n ? times[n/2] : 0.0,
+		n ? total/double(n) : 0.0,
+		n ? times[n-1] : 0.0);
+}
+
+// opens a logfile and times each part of replaying it separately, writing the results as JSON
+// so they can be compared between versions over a set of captures
+static int Benchmark(const char *logfile, const char *resultsfile)
+{
+	// how many times to replay the whole frame, and how many events to time seeking to
+	const int frameRuns = 5;
+	const size_t maxSampledEvents = 32;
+	const int32_t maxTextures = 64;
+
+	FILE *f = stdout;
+	if(resultsfile)
+	{
+		f = fopen(resultsfile, "w");
+		if(f == NULL)
+		{
+			fprintf(stderr, "Can't open '%s' to write benchmark results\n", resultsfile);
+			return 1;
+		}
+	}
+
+	float progress = 0.0f;
+	ReplayRenderer *renderer = NULL;
+
+	double start = GetTimeMilliseconds();
+	auto status = RENDERDOC_CreateReplayRenderer(logfile, &progress, &renderer);
+	double loadTime = GetTimeMilliseconds() - start;
+
+	if(renderer == NULL || status != eReplayCreate_Success)
+	{
+		fprintf(stderr, "Failed to open '%s'\n", logfile);
+		if(renderer)
+			ReplayRenderer_Shutdown(renderer);
+		if(f != stdout)
+			fclose(f);
+		return 1;
+	}
+
+	rdctype::array<FetchDrawcall> draws;
+	ReplayRenderer_GetDrawcalls(renderer, 0, &draws);
+
+	vector<uint32_t> events;
+	CollectDrawEvents(draws, events);
+
+	uint32_t lastEvent = events.empty() ? 0 : events.back();
+
+	// each seek replays from the start of the frame, so seeking between the first and last
+	// events alternately gives a full frame replay each time
+	vector<double> frameTimes;
+	for(int i=0; i < frameRuns && !events.empty(); i++)
+	{
+		ReplayRenderer_SetFrameEvent(renderer, 0, events[0]);
+
+		start = GetTimeMilliseconds();
+		ReplayRenderer_SetFrameEvent(renderer, 0, lastEvent);
+		frameTimes.push_back(GetTimeMilliseconds() - start);
+	}
+
+	vector<double> seekTimes;
+	size_t numSamples = std::min(events.size(), maxSampledEvents);
+	for(size_t i=0; i < numSamples; i++)
+	{
+		uint32_t eventID = events[i*events.size()/numSamples];
+
+		start = GetTimeMilliseconds();
+		ReplayRenderer_SetFrameEvent(renderer, 0, eventID);
+		seekTimes.push_back(GetTimeMilliseconds() - start);
+	}
+
+	// read back textures as they are at the end of the frame
+	ReplayRenderer_SetFrameEvent(renderer, 0, lastEvent);
+
+	rdctype::array<FetchTexture> texs;
+	ReplayRenderer_GetTextures(renderer, &texs);
+
+	uint64_t textureBytes = 0;
+	double textureTime = 0.0;
+	int32_t numTextures = std::min(texs.count, maxTextures);
+
+	for(int32_t i=0; i < numTextures; i++)
+	{
+		rdctype::array<byte> data;
+
+		start = GetTimeMilliseconds();
+		ReplayRenderer_GetTextureData(renderer, texs[i].ID, 0, 0, &data);
+		textureTime += GetTimeMilliseconds() - start;
+
+		textureBytes += (uint64_t)data.count;
+	}
+
+	ReplayRenderer_Shutdown(renderer);
+
+	fprintf(f, "{\n");
+	fprintf(f, "  \"logfile\": \"%s\",\n", EscapeJSON(logfile).c_str());
+	fprintf(f, "  \"draws\": %u,\n", (uint32_t)events.size());
+	// includes ReadLogInitialisation and the first replay of the frame
+	fprintf(f, "  \"load_ms\": %.3f,\n", loadTime);
+	WriteTimings(f, "frame_replay", frameTimes);
+	WriteTimings(f, "set_frame_event", seekTimes);
+	fprintf(f, "  \"texture_data\": { \"textures\": %d, \"bytes\": %llu, \"total_ms\": %.3f, \"mb_per_sec\": %.3f },\n",
+		numTextures, (unsigned long long)textureBytes, textureTime,
+		textureTime > 0.0 ? (double(textureBytes)/(1024.0*1024.0))/(textureTime/1000.0) : 0.0);
+	fprintf(f, "  \"peak_memory_bytes\": %llu\n", (unsigned long long)GetPeakMemoryBytes());
+	fprintf(f, "}\n");
+
+	if(f != stdout)
+		fclose(f);
+
+	return 0;
+}
+
+// runs the same queries on one logfile for BatchAnalyse, writing a single line of JSON
+static bool AnalyseLogfile(const char *logfile, const char *outdir, uint32_t index, FILE *results)
+{
+	float progress = 0.0f;
+	ReplayRenderer *renderer = NULL;
+
+	double start = GetTimeMilliseconds();
+	auto status = RENDERDOC_CreateReplayRenderer(logfile, &progress, &renderer);
+	double loadTime = GetTimeMilliseconds() - start;
+
+	if(renderer == NULL || status != eReplayCreate_Success)
+	{
+		fprintf(stderr, "Failed to open '%s'\n", logfile);
+		fprintf(results, "{ \"logfile\": \"%s\", \"success\": false, \"status\": %d }\n",
+			EscapeJSON(logfile).c_str(), (int)status);
+		if(renderer)
+			ReplayRenderer_Shutdown(renderer);
+		return false;
+	}
+
+	APIProperties props;
+	ReplayRenderer_GetAPIProperties(renderer, &props);
+
+	rdctype::array<FetchDrawcall> draws;
+	ReplayRenderer_GetDrawcalls(renderer, 0, &draws);
+
+	vector<uint32_t> events;
+	CollectDrawEvents(draws, events);
+
+	uint32_t lastEvent = events.empty() ? 0 : events.back();
+
+	// total GPU time over the frame, if the driver can time events
+	double gpuDuration = -1.0;
+
+	rdctype::array<uint32_t> counters;
+	ReplayRenderer_EnumerateCounters(renderer, &counters);
+
+	for(int32_t i=0; i < counters.count; i++)
+	{
+		if(counters[i] != eCounter_EventGPUDuration)
+			continue;
+
+		uint32_t counter = eCounter_EventGPUDuration;
+		rdctype::array<CounterResult> counterResults;
+		ReplayRenderer_FetchCounters(renderer, 0, 0, ~0U, &counter, 1, 1, &counterResults);
+
+		gpuDuration = 0.0;
+		for(int32_t r=0; r < counterResults.count; r++)
+			gpuDuration += counterResults[r].d;
+		break;
+	}
+
+	// export the backbuffer as it is at the end of the frame
+	ReplayRenderer_SetFrameEvent(renderer, 0, lastEvent);
+
+	rdctype::array<FetchTexture> texs;
+	ReplayRenderer_GetTextures(renderer, &texs);
+
+	string backbuffer;
+
+	for(int32_t i=0; i < texs.count && outdir; i++)
+	{
+		if((texs[i].creationFlags & eTextureCreate_SwapBuffer) == 0)
+			continue;
+
+		char filename[32];
+		sprintf(filename, "%u_backbuffer.png", index);
+		string path = string(outdir) + "/" + filename;
+
+		TextureSave save;
+		memset(&save, 0, sizeof(save));
+		save.id = texs[i].ID;
+		save.destType = eFileType_PNG;
+		save.mip = 0;
+		save.comp.blackPoint = 0.0f;
+		save.comp.whitePoint = 1.0f;
+		save.sample.sampleIndex = ~0U;
+		save.alpha = eAlphaMap_Discard;
+
+		if(ReplayRenderer_SaveTexture(renderer, save, path.c_str()))
+			backbuffer = path;
+		else
+			fprintf(stderr, "Failed to save backbuffer of '%s' to '%s'\n", logfile, path.c_str());
+		break;
+	}
+
+	ReplayRenderer_Shutdown(renderer);
+
+	fprintf(results, "{ \"logfile\": \"%s\", \"success\": true, \"api\": \"%s\", \"draws\": %u, "
+		"\"load_ms\": %.3f, \"gpu_duration_ms\": %.3f, \"backbuffer\": \"%s\" }\n",
+		EscapeJSON(logfile).c_str(),
+		props.pipelineType == ePipelineState_D3D11 ? "D3D11" : "OpenGL",
+		(uint32_t)events.size(), loadTime,
+		gpuDuration < 0.0 ? -1.0 : gpuDuration*1000.0,
+		EscapeJSON(backbuffer.c_str()).c_str());
+	fflush(results);
+
+	return true;
+}
+
+// analyses every logfile listed in listfile (or stdin if it's "-"), one per line, in this process,
+// so only the first one pays for loading the replay libraries and shader caches. Results are written
+// to stdout as one JSON object per line, and backbuffers are saved to outdir if given.
+//
+// With shardCount > 1 only every shardCount'th logfile from shardIndex is analysed, so the list can
+// be split between several processes - e.g. one per GPU with a different adapter each - and their
+// output concatenated afterwards.
+static int BatchAnalyse(const char *listfile, const char *outdir, uint32_t adapter, uint32_t shardIndex, uint32_t shardCount)
+{
+	FILE *list = stdin;
+	if(strcmp(listfile, "-"))
+	{
+		list = fopen(listfile, "r");
+		if(list == NULL)
+		{
+			fprintf(stderr, "Can't open '%s' to read list of logfiles\n", listfile);
+			return 1;
+		}
+	}
+
+	// nothing is displayed, so only create what the queries need
+	RENDERDOC_SetHeadlessReplay(true);
+	RENDERDOC_SetReplayAdapter(adapter);
+
+	uint32_t index = 0, analysed = 0, failed = 0;
+	char line[1024];
+
+	while(fgets(line, sizeof(line), list))
+	{
+		size_t len = strlen(line);
+		while(len > 0 && (line[len-1] == '\n' || line[len-1] == '\r' || line[len-1] == ' '))
+			line[--len] = 0;
+
+		if(len == 0 || line[0] == '#')
+			continue;
+
+		// indices count every logfile in the list, so backbuffer names don't clash between shards
+		if(index % shardCount == shardIndex)
+		{
+			if(!AnalyseLogfile(line, outdir, index, stdout))
+				failed++;
+
+			analysed++;
+		}
+
+		index++;
+	}
+
+	if(list != stdin)
+		fclose(list);
+
+	fprintf(stderr, "Analysed %u logfiles, %u failed\n", analysed, failed);
+
+	return failed > 0 ? 1 : 0;
 }
 
 int renderdoccmd(int argc, char **argv)
@@ -135,7 +450,7 @@ int renderdoccmd(int argc, char **argv)
 			auto status = RENDERDOC_CreateReplayRenderer(argv[1], &progress, &renderer);
 
 			if(renderer && status == eReplayCreate_Success)
-				DisplayRendererPreview(renderer);
+				DisplayRendererPreview(renderer, 0);
 
 			ReplayRenderer_Shutdown(renderer);
 			return 0;
@@ -150,7 +465,7 @@ int renderdoccmd(int argc, char **argv)
 				auto status = RENDERDOC_CreateReplayRenderer(argv[2], &progress, &renderer);
 
 				if(renderer && status == eReplayCreate_Success)
-					DisplayRendererPreview(renderer);
+					DisplayRendererPreview(renderer, 0);
 
 				ReplayRenderer_Shutdown(renderer);
 				return 0;
@@ -160,6 +475,44 @@ int renderdoccmd(int argc, char **argv)
 				fprintf(stderr, "Not enough parameters to --replay");
 			}
 		}
+		// replay a logfile's frame over and over, e.g. to profile it in a vendor tool
+		else if(argequal(argv[1], "--loop") || argequal(argv[1], "-l"))
+		{
+			if(argc >= 3)
+			{
+				uint32_t loops = argc >= 4 ? (uint32_t)atoi(argv[3]) : 1000;
+
+				if(loops == 0)
+				{
+					fprintf(stderr, "Invalid loop count '%s'\n", argv[3]);
+					return 1;
+				}
+
+				float progress = 0.0f;
+				ReplayRenderer *renderer = NULL;
+				auto status = RENDERDOC_CreateReplayRenderer(argv[2], &progress, &renderer);
+
+				if(renderer && status == eReplayCreate_Success)
+				{
+					double start = GetTimeMilliseconds();
+					DisplayRendererPreview(renderer, loops);
+					double duration = GetTimeMilliseconds() - start;
+
+					fprintf(stderr, "Replayed %u loops in %.3f ms, %.3f ms per loop\n", loops, duration, duration/double(loops));
+				}
+				else
+				{
+					fprintf(stderr, "Failed to open '%s'\n", argv[2]);
+				}
+
+				ReplayRenderer_Shutdown(renderer);
+				return 0;
+			}
+			else
+			{
+				fprintf(stderr, "Not enough parameters to --loop");
+			}
+		}
 #ifdef WIN32
 		// if we were given an executable on windows, inject into it
 		// can't do this on other platforms as there's no nice extension
@@ -254,7 +607,7 @@ int renderdoccmd(int argc, char **argv)
 				status = RemoteRenderer_CreateProxyRenderer(remote, 0, argv[3], &progress, &renderer);
 
 				if(renderer && status == eReplayCreate_Success)
-					DisplayRendererPreview(renderer);
+					DisplayRendererPreview(renderer, 0);
 
 				RemoteRenderer_Shutdown(remote);
 				return 0;
@@ -264,6 +617,103 @@ int renderdoccmd(int argc, char **argv)
 				fprintf(stderr, "Not enough parameters to --remotereplay");
 			}
 		}
+		// re-encode a logfile into a compact archive
+		else if(argequal(argv[1], "--archive") || argequal(argv[1], "-a"))
+		{
+			if(argc >= 4)
+			{
+				if(!RENDERDOC_ArchiveLogFile(argv[2], argv[3]))
+				{
+					fprintf(stderr, "Failed to archive '%s' to '%s'\n", argv[2], argv[3]);
+					return 1;
+				}
+
+				return 0;
+			}
+			else
+			{
+				fprintf(stderr, "Not enough parameters to --archive");
+			}
+		}
+		// time each replay phase of a logfile
+		else if(argequal(argv[1], "--benchmark") || argequal(argv[1], "-b"))
+		{
+			if(argc >= 3)
+			{
+				return Benchmark(argv[2], argc >= 4 ? argv[3] : NULL);
+			}
+			else
+			{
+				fprintf(stderr, "Not enough parameters to --benchmark");
+			}
+		}
+		// open a logfile and write out a timeline of what renderdoc did while loading it
+		else if(argequal(argv[1], "--batch"))
+		{
+			if(argc >= 3)
+			{
+				const char *outdir = NULL;
+				uint32_t adapter = ~0U;
+				uint32_t shardIndex = 0, shardCount = 1;
+
+				for(int a=3; a < argc; a++)
+				{
+					if(argequal(argv[a], "--adapter") && a+1 < argc)
+					{
+						adapter = (uint32_t)atoi(argv[++a]);
+					}
+					else if(argequal(argv[a], "--shard") && a+1 < argc)
+					{
+						if(sscanf(argv[++a], "%u/%u", &shardIndex, &shardCount) != 2 ||
+						   shardCount == 0 || shardIndex >= shardCount)
+						{
+							fprintf(stderr, "Invalid shard '%s', expected INDEX/COUNT\n", argv[a]);
+							return 1;
+						}
+					}
+					else
+					{
+						outdir = argv[a];
+					}
+				}
+
+				return BatchAnalyse(argv[2], outdir, adapter, shardIndex, shardCount);
+			}
+			else
+			{
+				fprintf(stderr, "Not enough parameters to --batch");
+			}
+		}
+		else if(argequal(argv[1], "--profile") || argequal(argv[1], "-p"))
+		{
+			if(argc >= 4)
+			{
+				float progress = 0.0f;
+				ReplayRenderer *renderer = NULL;
+				auto status = RENDERDOC_CreateReplayRenderer(argv[2], &progress, &renderer);
+
+				if(renderer)
+					ReplayRenderer_Shutdown(renderer);
+
+				if(status != eReplayCreate_Success)
+				{
+					fprintf(stderr, "Failed to open '%s'\n", argv[2]);
+					return 1;
+				}
+
+				if(!RENDERDOC_WriteProfileTrace(argv[3]))
+				{
+					fprintf(stderr, "Failed to write profile trace to '%s'\n", argv[3]);
+					return 1;
+				}
+
+				return 0;
+			}
+			else
+			{
+				fprintf(stderr, "Not enough parameters to --profile");
+			}
+		}
 		// not documented/useful for manual use on the cmd line, used internally
 		else if(argequal(argv[1], "--cap32for64"))
 		{
@@ -304,10 +754,24 @@ int renderdoccmd(int argc, char **argv)
 	fprintf(stderr, "  -i,  --inject PID                 Injects into the specified PID to capture.\n");
 	fprintf(stderr, "  -r,  --replay LOGFILE             Launch a preview window that replays this logfile and\n");
 	fprintf(stderr, "                                    displays the backbuffer.\n");
+	fprintf(stderr, "  -l,  --loop LOGFILE [N]           Replay the whole frame N times (default 1000) in a window,\n");
+	fprintf(stderr, "                                    presenting after each, for profiling in external tools.\n");
 	fprintf(stderr, "  -rh, --replayhost                 Starts a replay host server that can be used to remotely\n");
 	fprintf(stderr, "                                    replay logfiles from another machine.\n");
 	fprintf(stderr, "  -rr, --remotereplay HOST LOGFILE  Launch a replay of the logfile and display a preview\n");
 	fprintf(stderr, "                                    window. Use the remote host to replay all commands.\n");
+	fprintf(stderr, "  -a,  --archive LOGFILE ARCHIVE    Re-encode the logfile into a smaller archive for storage,\n");
+	fprintf(stderr, "                                    which can be replayed like any other logfile.\n");
+	fprintf(stderr, "  -b,  --benchmark LOGFILE [OUT]    Time loading and replaying the logfile, and write the\n");
+	fprintf(stderr, "                                    results as JSON to OUT or stdout.\n");
+	fprintf(stderr, "  -p,  --profile LOGFILE TRACE      Open the logfile and write a timeline of loading it to\n");
+	fprintf(stderr, "                                    TRACE, as JSON for chrome://tracing.\n");
+	fprintf(stderr, "       --batch LIST [OUTDIR]        Analyse each logfile listed in LIST (- for stdin) in turn,\n");
+	fprintf(stderr, "                                    writing a line of JSON for each to stdout, and saving\n");
+	fprintf(stderr, "                                    backbuffers to OUTDIR.\n");
+	fprintf(stderr, "         [--adapter N]              Replay on the Nth GPU instead of the default one.\n");
+	fprintf(stderr, "         [--shard I/C]              Only analyse every Cth logfile from the Ith, to split a\n");
+	fprintf(stderr, "                                    batch between processes on different GPUs.\n");
 
 	return 1;
 }
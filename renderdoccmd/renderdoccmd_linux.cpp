@@ -34,6 +34,8 @@
 #include <GL/glx.h>
 
 #include <unistd.h>
+#include <time.h>
+#include <sys/resource.h>
 
 #include <replay/renderdoc_replay.h>
 
@@ -47,7 +49,24 @@ string GetUsername()
 	return string(buf, buf+strlen(buf));
 }
 
-void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg)
+double GetTimeMilliseconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return double(ts.tv_sec)*1000.0 + double(ts.tv_nsec)/1000000.0;
+}
+
+uint64_t GetPeakMemoryBytes()
+{
+	rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+
+	// ru_maxrss is in kilobytes on linux
+	return uint64_t(usage.ru_maxrss)*1024;
+}
+
+void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg, uint32_t loops)
 {
 	Display *dpy = XOpenDisplay(NULL);
 
@@ -99,6 +118,7 @@ void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg)
 	ReplayOutput_SetTextureDisplay(out, displayCfg);
 
 	bool done = false;
+	uint32_t looped = 0;
 	while(!done)
 	{
 		while(XPending(dpy) > 0)
@@ -112,6 +132,14 @@ void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg)
 			}
 		}
 
+		if(loops > 0)
+		{
+			// one loop at a time so the window still responds in between
+			ReplayRenderer_ReplayLoop(renderer, 0, 1, out, NULL);
+			done |= (++looped >= loops);
+			continue;
+		}
+
 		ReplayRenderer_SetFrameEvent(renderer, 0, 10000000+rand()%1000);
 		ReplayOutput_Display(out);
 
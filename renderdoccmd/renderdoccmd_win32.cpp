@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include <windows.h>
+#include <psapi.h>
 #include <string>
 #include <vector>
 
@@ -207,7 +208,26 @@ wstring GetUsername()
 	return username;
 }
 
-void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg)
+double GetTimeMilliseconds()
+{
+	LARGE_INTEGER freq, now;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+
+	return double(now.QuadPart)*1000.0/double(freq.QuadPart);
+}
+
+uint64_t GetPeakMemoryBytes()
+{
+	PROCESS_MEMORY_COUNTERS counters;
+	counters.cb = sizeof(counters);
+	if(!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		return 0;
+
+	return (uint64_t)counters.PeakWorkingSetSize;
+}
+
+void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg, uint32_t loops)
 {
 	HWND wnd = CreateWindowEx(WS_EX_CLIENTEDGE, L"renderdoccmd", L"renderdoccmd", WS_OVERLAPPEDWINDOW,
 	                          CW_USEDEFAULT, CW_USEDEFAULT, 1280, 720, NULL, NULL, hInstance, NULL);
@@ -226,6 +246,7 @@ void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg)
 
 	MSG msg;
 	ZeroMemory(&msg, sizeof(msg));
+	uint32_t looped = 0;
 	while(true)
 	{
 		// Check to see if any messages are waiting in the queue
@@ -239,6 +260,14 @@ void DisplayRendererPreview(ReplayRenderer *renderer, TextureDisplay displayCfg)
 		// If the message is WM_QUIT, exit the while loop
 		if(msg.message == WM_QUIT) break;
 
+		if(loops > 0)
+		{
+			// one loop at a time so the window still responds in between
+			ReplayRenderer_ReplayLoop(renderer, 0, 1, out, NULL);
+			if(++looped >= loops) break;
+			continue;
+		}
+
 		// set to random event beyond the end of the frame to ensure output is marked as dirty
 		ReplayRenderer_SetFrameEvent(renderer, 0, 10000000+rand()%1000);
 		ReplayOutput_Display(out);
@@ -104,6 +104,10 @@ void CheckHook()
 			LOGPRINT(data->pathmatchstring);
 			LOGPRINT(L"'\n");
 
+			// most processes matched by a global hook never render, so have renderdoc only do
+			// the minimum until a device is created.
+			SetEnvironmentVariableW(L"RENDERDOC_BOOTSTRAP", L"1");
+
 			HMODULE mod = LoadLibraryW(data->rdocpath);
 
 			if(mod)
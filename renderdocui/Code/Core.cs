@@ -78,6 +78,9 @@ public class Core
         private List<ILogViewerForm> m_LogViewers = new List<ILogViewerForm>();
         private List<ILogLoadProgressListener> m_ProgressListeners = new List<ILogLoadProgressListener>();
 
+        // set between SetScrubbing(true) and SetScrubbing(false)
+        private bool m_Scrubbing = false;
+
         private MainWindow m_MainWindow = null;
         private EventBrowser m_EventBrowser = null;
         private APIInspector m_APIInspector = null;
@@ -589,6 +592,7 @@ public void CloseLogfile()
             UnreadMessageCount = 0;
 
             m_LogLoaded = false;
+            m_Scrubbing = false;
 
             foreach (var logviewer in m_LogViewers)
             {
@@ -812,6 +816,28 @@ public void SetEventID(ILogViewerForm exclude, UInt32 frameID, UInt32 eventID)
             m_DeferredEvent = 0;
 
             m_Renderer.Invoke((ReplayRenderer r) => { r.SetContextFilter(ResourceId.Null, 0, 0); });
+
+            if (m_Scrubbing)
+            {
+                m_Renderer.Invoke((ReplayRenderer r) => { r.SetFrameEvent(m_FrameID, m_EventID); });
+
+                foreach (var logviewer in m_LogViewers)
+                {
+                    var preview = logviewer as IScrubPreviewForm;
+
+                    if (logviewer == exclude || preview == null)
+                        continue;
+
+                    Control c = (Control)logviewer;
+                    if (c.InvokeRequired)
+                        c.BeginInvoke(new Action(() => preview.OnScrubPreview(frameID, eventID)));
+                    else
+                        preview.OnScrubPreview(frameID, eventID);
+                }
+
+                return;
+            }
+
             m_Renderer.Invoke((ReplayRenderer r) =>
             {
                 r.SetFrameEvent(m_FrameID, m_EventID);
@@ -833,6 +859,46 @@ public void SetEventID(ILogViewerForm exclude, UInt32 frameID, UInt32 eventID)
             }
         }
 
+        // while scrubbing, events set only preview the texture displays. The pipeline state and
+        // the other log viewers are brought up to date at the last event once scrubbing stops.
+        public void SetScrubbing(ILogViewerForm exclude, bool scrubbing)
+        {
+            if (scrubbing == m_Scrubbing)
+                return;
+
+            m_Scrubbing = scrubbing;
+
+            m_Renderer.Invoke((ReplayRenderer r) =>
+            {
+                r.SetScrubbing(scrubbing);
+
+                if (!scrubbing)
+                {
+                    m_D3D11PipelineState = r.GetD3D11PipelineState();
+                    m_GLPipelineState = r.GetGLPipelineState();
+                    m_PipelineState.SetStates(m_APIProperties, m_D3D11PipelineState, m_GLPipelineState);
+                }
+            });
+
+            if (scrubbing)
+                return;
+
+            UInt32 frameID = m_FrameID;
+            UInt32 eventID = m_EventID;
+
+            foreach (var logviewer in m_LogViewers)
+            {
+                if (logviewer == exclude)
+                    continue;
+
+                Control c = (Control)logviewer;
+                if (c.InvokeRequired)
+                    c.BeginInvoke(new Action(() => logviewer.OnEventSelected(frameID, eventID)));
+                else
+                    logviewer.OnEventSelected(frameID, eventID);
+            }
+        }
+
         #endregion
     }
 }
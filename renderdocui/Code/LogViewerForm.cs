@@ -37,6 +37,13 @@ public interface ILogViewerForm
         void OnEventSelected(UInt32 frameID, UInt32 eventID);
     }
 
+    // log viewers that show a preview of each event stepped over while scrubbing, without
+    // being sent OnEventSelected until the scrub ends
+    public interface IScrubPreviewForm
+    {
+        void OnScrubPreview(UInt32 frameID, UInt32 eventID);
+    }
+
     public interface ILogLoadProgressListener
     {
         void LogfileProgressBegin();
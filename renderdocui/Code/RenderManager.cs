@@ -36,23 +36,55 @@
 namespace renderdocui.Code
 {
     public delegate void InvokeMethod(ReplayRenderer r);
+    public delegate void InvokeCallback(RenderManager.InvokeHandle cmd);
+
+    // background work is only picked up when nothing else is waiting, so that long analyses
+    // (pixel history, shader debugging) don't hold up interactive work queued after them.
+    // A call that's already running can't be interrupted though.
+    public enum InvokePriority
+    {
+        Normal,
+        Background,
+    };
 
     // this class owns the thread that interacts with the main library, to ensure that we don't
     // have to worry elsewhere about threading access. Elsewhere in the UI you can do Invoke or
     // BeginInvoke and get a ReplayRenderer reference back to access through
     public class RenderManager
     {
-        private class InvokeHandle
+        public class InvokeHandle
         {
             public InvokeHandle(InvokeMethod m)
             {
                 method = m;
                 processed = false;
+                cancelled = false;
+                done = new ManualResetEvent(false);
             }
 
             public InvokeMethod method;
+            public string tag = null;
+            public InvokePriority priority = InvokePriority.Normal;
+            public InvokeCallback callback = null;
             volatile public bool processed;
+            volatile public bool cancelled;
             public Exception ex = null;
+            private ManualResetEvent done;
+
+            public bool Processed { get { return processed; } }
+            public bool Cancelled { get { return cancelled; } }
+            public Exception Exception { get { return ex; } }
+
+            public void SetProcessed()
+            {
+                processed = true;
+                done.Set();
+            }
+
+            public void Wait()
+            {
+                done.WaitOne();
+            }
         };
 
         ////////////////////////////////////////////
@@ -129,13 +161,54 @@ public void BeginInvoke(InvokeMethod m)
             PushInvoke(cmd);
         }
 
+        // any requests with the same tag that are still waiting are stale once this is queued, so
+        // they are cancelled. The callback is called on the render thread once the request has
+        // either run or been cancelled.
+        public InvokeHandle BeginInvoke(string tag, InvokePriority priority, InvokeMethod m, InvokeCallback callback)
+        {
+            InvokeHandle cmd = new InvokeHandle(m);
+            cmd.tag = tag;
+            cmd.priority = priority;
+            cmd.callback = callback;
+
+            PushInvoke(cmd);
+
+            return cmd;
+        }
+
+        public InvokeHandle BeginInvoke(string tag, InvokeMethod m)
+        {
+            return BeginInvoke(tag, InvokePriority.Normal, m, null);
+        }
+
+        // cancels any requests with this tag that haven't started yet
+        public void CancelInvoke(string tag)
+        {
+            List<InvokeHandle> cancelled = new List<InvokeHandle>();
+
+            lock (m_renderQueue)
+            {
+                m_renderQueue.RemoveAll(cmd =>
+                {
+                    if (cmd.tag != tag)
+                        return false;
+
+                    cancelled.Add(cmd);
+                    return true;
+                });
+            }
+
+            foreach (var cmd in cancelled)
+                Cancel(cmd);
+        }
+
         public void Invoke(InvokeMethod m)
         {
             InvokeHandle cmd = new InvokeHandle(m);
 
             PushInvoke(cmd);
 
-            while (!cmd.processed) ;
+            cmd.Wait();
 
             if (cmd.ex != null)
                 throw cmd.ex;
@@ -145,18 +218,66 @@ private void PushInvoke(InvokeHandle cmd)
         {
             if (m_Thread == null || !Running)
             {
-                cmd.processed = true;
+                cmd.SetProcessed();
                 return;
             }
 
             m_WakeupEvent.Set();
 
+            if (cmd.tag != null)
+                CancelInvoke(cmd.tag);
+
             lock (m_renderQueue)
             {
                 m_renderQueue.Add(cmd);
             }
         }
 
+        private void Cancel(InvokeHandle cmd)
+        {
+            cmd.cancelled = true;
+
+            // callbacks always run on the render thread, so if we're not on it queue up a
+            // request just to run the callback
+            if (cmd.callback != null)
+            {
+                if (Thread.CurrentThread == m_Thread)
+                {
+                    cmd.callback(cmd);
+                }
+                else
+                {
+                    InvokeHandle notify = new InvokeHandle((ReplayRenderer r) => { cmd.callback(cmd); });
+
+                    lock (m_renderQueue)
+                    {
+                        m_renderQueue.Insert(0, notify);
+                    }
+                }
+            }
+
+            cmd.SetProcessed();
+        }
+
+        // returns the next request to run - the oldest one of the highest priority - or null
+        // if the queue is empty.
+        private InvokeHandle PopInvoke()
+        {
+            lock (m_renderQueue)
+            {
+                if (m_renderQueue.Count == 0)
+                    return null;
+
+                int idx = m_renderQueue.FindIndex(cmd => cmd.priority == InvokePriority.Normal);
+                if (idx < 0)
+                    idx = 0;
+
+                InvokeHandle ret = m_renderQueue[idx];
+                m_renderQueue.RemoveAt(idx);
+                return ret;
+            }
+        }
+
         ////////////////////////////////////////////
         // Internals
 
@@ -204,50 +325,54 @@ private void RunThread()
 
                     while (Running)
                     {
-                        List<InvokeHandle> queue = new List<InvokeHandle>();
-                        lock (m_renderQueue)
-                        {
-                            foreach (var cmd in m_renderQueue)
-                                queue.Add(cmd);
+                        // take one request at a time, so anything queued while a request is
+                        // running gets its chance to go ahead of waiting background work
+                        InvokeHandle cmd = PopInvoke();
 
-                            m_renderQueue.Clear();
+                        if (cmd == null)
+                        {
+                            m_WakeupEvent.WaitOne(10);
+                            continue;
                         }
 
-                        foreach (var cmd in queue)
+                        if (cmd.method != null)
                         {
-                            if (cmd.method != null)
+                            if (CatchExceptions)
                             {
-                                if (CatchExceptions)
+                                try
                                 {
-                                    try
-                                    {
-                                        cmd.method(renderer);
-                                    }
-                                    catch (Exception ex)
-                                    {
-                                        cmd.ex = ex;
-                                    }
+                                    cmd.method(renderer);
                                 }
-                                else
+                                catch (Exception ex)
                                 {
-                                    cmd.method(renderer);
+                                    cmd.ex = ex;
                                 }
                             }
-
-                            cmd.processed = true;
+                            else
+                            {
+                                cmd.method(renderer);
+                            }
                         }
 
-                        m_WakeupEvent.WaitOne(10);
+                        if (cmd.callback != null)
+                            cmd.callback(cmd);
+
+                        cmd.SetProcessed();
                     }
 
+                    List<InvokeHandle> remaining = new List<InvokeHandle>();
                     lock (m_renderQueue)
                     {
-                        foreach (var cmd in m_renderQueue)
-                            cmd.processed = true;
-
+                        remaining.AddRange(m_renderQueue);
                         m_renderQueue.Clear();
                     }
 
+                    foreach (var cmd in remaining)
+                    {
+                        cmd.cancelled = true;
+                        cmd.SetProcessed();
+                    }
+
                     renderer.Shutdown();
                     if (remote != null) remote.Shutdown();
                 }
@@ -78,6 +78,17 @@ public class CaptureOptions
         public bool RefAllResources;
         public bool SaveAllInitials;
         public bool CaptureAllCmdLists;
+        public bool CompressCaptures;
+        public bool SpillChunksToDisk;
+        public UInt32 SpillHighWaterMark;
+        public bool AsyncCaptureWrites;
+        public bool DeltaInitialContents;
+        public bool TrackPersistentMapWrites;
+        public UInt32 CmdListMemoryLimit;
+        public bool FilterRedundantState;
+        public UInt32 CallstackSampleRate;
+        public bool RetroCapture;
+        public bool FramePointerCallstacks;
         
         public static CaptureOptions Defaults
         {
@@ -95,6 +106,17 @@ public static CaptureOptions Defaults
                 defs.RefAllResources = false;
                 defs.SaveAllInitials = false;
                 defs.CaptureAllCmdLists = false;
+                defs.CompressCaptures = false;
+                defs.SpillChunksToDisk = false;
+                defs.SpillHighWaterMark = 64;
+                defs.AsyncCaptureWrites = false;
+                defs.DeltaInitialContents = false;
+                defs.TrackPersistentMapWrites = false;
+                defs.CmdListMemoryLimit = 0;
+                defs.FilterRedundantState = false;
+                defs.CallstackSampleRate = 0;
+                defs.RetroCapture = false;
+                defs.FramePointerCallstacks = false;
                 return defs;
             }
         }
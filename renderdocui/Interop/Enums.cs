@@ -413,6 +413,9 @@ public enum GPUCounters
         PSInvocations,
         RasterizedPrimitives,
         SamplesWritten,
+        IAPrimitives,
+        GSPrimitives,
+        CSInvocations,
 
         FirstAMD = 1000000,
 
@@ -441,6 +444,7 @@ public enum ReplayCreateStatus
         APIInitFailed,
         APIIncompatibleVersion,
         APIHardwareUnsupported,
+        FileMissingDependency,
     };
 
     public enum RemoteMessageType
@@ -453,6 +457,10 @@ public enum RemoteMessageType
         CaptureCopied,
         RegisterAPI,
         NewChild,
+        MemoryUsage,
+        CaptureCopyProgress,
+        FrameStats,
+        CaptureOverhead,
     };
 
     public static class EnumString
@@ -515,6 +523,7 @@ public static string Str(this ReplayCreateStatus status)
                 case ReplayCreateStatus.APIInitFailed: return "Replay API failed to initialise";
                 case ReplayCreateStatus.APIIncompatibleVersion: return "API-specific data used in logfile is of an incompatible version";
                 case ReplayCreateStatus.APIHardwareUnsupported: return "Your hardware or software configuration doesn't meet this API's minimum requirements";
+                case ReplayCreateStatus.FileMissingDependency: return "Logfile stores initial contents as changes to an earlier logfile, which can't be found";
             }
 
             return "Unknown Error Code";
@@ -528,6 +528,13 @@ public struct ValueUnion
 
         [CustomMarshalAs(CustomUnmanagedType.Union)]
         public ValueUnion value;
+
+        public UInt32 numRuns;
+        public UInt32 numOutliers;
+        public double minimum;
+        public double median;
+        public double mean;
+        public double stddev;
     };
 
     [StructLayout(LayoutKind.Sequential)]
@@ -73,6 +73,80 @@ public struct NewChildData
         };
         [CustomMarshalAs(CustomUnmanagedType.CustomClass)]
         public NewChildData NewChild;
+
+        [StructLayout(LayoutKind.Sequential)]
+        public struct MemoryUsageData
+        {
+            [StructLayout(LayoutKind.Sequential)]
+            public class ResourceUsage
+            {
+                public ResourceId ID;
+                public UInt32 NumChunks;
+                public UInt64 ChunkBytes;
+                public UInt64 ShadowBytes;
+                public UInt64 InitialContentsBytes;
+            };
+            [CustomMarshalAs(CustomUnmanagedType.TemplatedArray)]
+            public ResourceUsage[] Resources;
+
+            [StructLayout(LayoutKind.Sequential)]
+            public class ChunkUsage
+            {
+                public UInt32 ChunkType;
+                public UInt32 NumChunks;
+                public UInt64 Bytes;
+            };
+            [CustomMarshalAs(CustomUnmanagedType.TemplatedArray)]
+            public ChunkUsage[] Chunks;
+        };
+        [CustomMarshalAs(CustomUnmanagedType.CustomClass)]
+        public MemoryUsageData MemoryUsage;
+
+        [StructLayout(LayoutKind.Sequential)]
+        public struct CopyProgressData
+        {
+            public UInt32 ID;
+            public float progress;
+        };
+        [CustomMarshalAs(CustomUnmanagedType.CustomClass)]
+        public CopyProgressData CopyProgress;
+
+        [StructLayout(LayoutKind.Sequential)]
+        public struct FrameStatsData
+        {
+            public UInt32 NumFrames;
+            public UInt32 LastFrameNumber;
+            public double TotalFrameTime;
+            public double MaxFrameTime;
+            public UInt64 APICalls;
+            public UInt64 Draws;
+            public UInt64 Dispatches;
+            public UInt64 Maps;
+            public UInt64 BytesMapped;
+            public UInt64 CaptureChunkBytes;
+        };
+        [CustomMarshalAs(CustomUnmanagedType.CustomClass)]
+        public FrameStatsData FrameStats;
+
+        [StructLayout(LayoutKind.Sequential)]
+        public struct CaptureOverheadData
+        {
+            [StructLayout(LayoutKind.Sequential)]
+            public class EntryPoint
+            {
+                public UInt32 ChunkType;
+                public UInt64 Calls;
+                public double SerialiseTime;
+                public double RecordLookupTime;
+                public double LockTime;
+                public double ShadowDiffTime;
+                public double CallstackTime;
+            };
+            [CustomMarshalAs(CustomUnmanagedType.TemplatedArray)]
+            public EntryPoint[] EntryPoints;
+        };
+        [CustomMarshalAs(CustomUnmanagedType.CustomClass)]
+        public CaptureOverheadData CaptureOverhead;
     };
 
     public class ReplayOutput
@@ -91,6 +165,8 @@ public class ReplayOutput
 
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayOutput_Display(IntPtr real);
+        [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
+        private static extern bool ReplayOutput_HasPendingThumbnails(IntPtr real);
 
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayOutput_SetPixelContext(IntPtr real, IntPtr wnd);
@@ -134,6 +210,11 @@ public bool Display()
             return ReplayOutput_Display(m_Real);
         }
 
+        public bool HasPendingThumbnails()
+        {
+            return ReplayOutput_HasPendingThumbnails(m_Real);
+        }
+
         public bool SetPixelContext(IntPtr wnd)
         {
             return ReplayOutput_SetPixelContext(m_Real, wnd);
@@ -188,6 +269,8 @@ public class ReplayRenderer
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayRenderer_SetFrameEvent(IntPtr real, UInt32 frameID, UInt32 eventID);
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
+        private static extern bool ReplayRenderer_SetScrubbing(IntPtr real, bool scrubbing);
+        [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayRenderer_GetD3D11PipelineState(IntPtr real, IntPtr mem);
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayRenderer_GetGLPipelineState(IntPtr real, IntPtr mem);
@@ -211,7 +294,7 @@ public class ReplayRenderer
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayRenderer_GetDrawcalls(IntPtr real, UInt32 frameID, IntPtr outdraws);
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        private static extern bool ReplayRenderer_FetchCounters(IntPtr real, UInt32 frameID, UInt32 minEventID, UInt32 maxEventID, IntPtr counters, UInt32 numCounters, IntPtr outresults);
+        private static extern bool ReplayRenderer_FetchCounters(IntPtr real, UInt32 frameID, UInt32 minEventID, UInt32 maxEventID, IntPtr counters, UInt32 numCounters, UInt32 numRuns, IntPtr outresults);
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayRenderer_EnumerateCounters(IntPtr real, IntPtr outcounters);
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
@@ -221,6 +304,8 @@ public class ReplayRenderer
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayRenderer_GetBuffers(IntPtr real, IntPtr outbufs);
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
+        private static extern UInt32 ReplayRenderer_GetResourceGeneration(IntPtr real);
+        [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern bool ReplayRenderer_GetResolve(IntPtr real, UInt64[] callstack, UInt32 callstackLen, IntPtr outtrace);
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern IntPtr ReplayRenderer_GetShaderDetails(IntPtr real, ResourceId shader);
@@ -260,8 +345,29 @@ public class ReplayRenderer
 
         private IntPtr m_Real = IntPtr.Zero;
 
+        // textures, buffers and shader reflection only change when the generation does, so
+        // they're kept here rather than marshalled again on every call. Callers must treat
+        // what's returned as read-only, since it's shared.
+        private UInt32 m_ResourceGeneration = 0;
+        private FetchTexture[] m_Textures = null;
+        private FetchBuffer[] m_Buffers = null;
+        private Dictionary<ResourceId, ShaderReflection> m_ShaderDetails = new Dictionary<ResourceId, ShaderReflection>();
+
         public ReplayRenderer(IntPtr real) { m_Real = real; }
 
+        private void CheckResourceGeneration()
+        {
+            UInt32 gen = ReplayRenderer_GetResourceGeneration(m_Real);
+
+            if (gen != m_ResourceGeneration)
+            {
+                m_ResourceGeneration = gen;
+                m_Textures = null;
+                m_Buffers = null;
+                m_ShaderDetails.Clear();
+            }
+        }
+
         public void Shutdown()
         {
             if (m_Real != IntPtr.Zero)
@@ -305,6 +411,9 @@ public bool SetContextFilter(ResourceId id, UInt32 firstDefEv, UInt32 lastDefEv)
         public bool SetFrameEvent(UInt32 frameID, UInt32 eventID)
         { return ReplayRenderer_SetFrameEvent(m_Real, frameID, eventID); }
 
+        public bool SetScrubbing(bool scrubbing)
+        { return ReplayRenderer_SetScrubbing(m_Real, scrubbing); }
+
         public GLPipelineState GetGLPipelineState()
         {
             IntPtr mem = CustomMarshal.Alloc(typeof(GLPipelineState));
@@ -437,6 +546,12 @@ private void FixupDraws(Dictionary<Int64, FetchDrawcall> map, FetchDrawcall[] dr
         }
 
         public Dictionary<uint, List<CounterResult>> FetchCounters(UInt32 frameID, UInt32 minEventID, UInt32 maxEventID, UInt32[] counters)
+        {
+            return FetchCounters(frameID, minEventID, maxEventID, counters, 1);
+        }
+
+        // with numRuns > 1 each result holds the median run, along with the spread across runs
+        public Dictionary<uint, List<CounterResult>> FetchCounters(UInt32 frameID, UInt32 minEventID, UInt32 maxEventID, UInt32[] counters, UInt32 numRuns)
         {
             IntPtr mem = CustomMarshal.Alloc(typeof(templated_array));
 
@@ -446,7 +561,7 @@ private void FixupDraws(Dictionary<Int64, FetchDrawcall> map, FetchDrawcall[] dr
             for (int i = 0; i < counters.Length; i++)
                 Marshal.WriteInt32(countersmem, sizeof(UInt32) * i, (int)counters[i]);
 
-            bool success = ReplayRenderer_FetchCounters(m_Real, frameID, minEventID, maxEventID, countersmem, (uint)counters.Length, mem);
+            bool success = ReplayRenderer_FetchCounters(m_Real, frameID, minEventID, maxEventID, countersmem, (uint)counters.Length, numRuns, mem);
 
             CustomMarshal.Free(countersmem);
 
@@ -534,6 +649,11 @@ public FetchDrawcall[] GetDrawcalls(UInt32 frameID)
 
         public FetchTexture[] GetTextures()
         {
+            CheckResourceGeneration();
+
+            if (m_Textures != null)
+                return m_Textures;
+
             IntPtr mem = CustomMarshal.Alloc(typeof(templated_array));
 
             bool success = ReplayRenderer_GetTextures(m_Real, mem);
@@ -545,11 +665,18 @@ public FetchTexture[] GetTextures()
 
             CustomMarshal.Free(mem);
 
+            m_Textures = ret;
+
             return ret;
         }
 
         public FetchBuffer[] GetBuffers()
         {
+            CheckResourceGeneration();
+
+            if (m_Buffers != null)
+                return m_Buffers;
+
             IntPtr mem = CustomMarshal.Alloc(typeof(templated_array));
 
             bool success = ReplayRenderer_GetBuffers(m_Real, mem);
@@ -561,6 +688,8 @@ public FetchBuffer[] GetBuffers()
 
             CustomMarshal.Free(mem);
 
+            m_Buffers = ret;
+
             return ret;
         }
 
@@ -584,13 +713,21 @@ public string[] GetResolve(UInt64[] callstack)
 
         public ShaderReflection GetShaderDetails(ResourceId shader)
         {
-            IntPtr mem = ReplayRenderer_GetShaderDetails(m_Real, shader);
+            CheckResourceGeneration();
 
             ShaderReflection ret = null;
 
+            if (m_ShaderDetails.TryGetValue(shader, out ret))
+                return ret;
+
+            IntPtr mem = ReplayRenderer_GetShaderDetails(m_Real, shader);
+
             if (mem != IntPtr.Zero)
                 ret = (ShaderReflection)CustomMarshal.PtrToStructure(mem, typeof(ShaderReflection), false);
 
+            if (ret != null)
+                m_ShaderDetails.Add(shader, ret);
+
             return ret;
         }
 
@@ -908,6 +1045,12 @@ public class RemoteAccess
         private static extern void RemoteAccess_QueueCapture(IntPtr real, UInt32 frameNumber);
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern void RemoteAccess_CopyCapture(IntPtr real, UInt32 remoteID, IntPtr localpath);
+        [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void RemoteAccess_RequestMemoryUsage(IntPtr real);
+        [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void RemoteAccess_RequestCaptureOverhead(IntPtr real);
+        [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void RemoteAccess_SetFrameStatsInterval(IntPtr real, UInt32 milliseconds);
 
         [DllImport("renderdoc.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         private static extern void RemoteAccess_ReceiveMessage(IntPtr real, IntPtr outmsg);
@@ -941,6 +1084,8 @@ public RemoteAccess(IntPtr real)
             CaptureExists = false;
             CaptureCopied = false;
             InfoUpdated = false;
+            MemoryUsageUpdated = false;
+            CaptureOverheadUpdated = false;
         }
 
         public static UInt32[] GetRemoteIdents(string host)
@@ -986,6 +1131,23 @@ public void CopyCapture(UInt32 id, string localpath)
             CustomMarshal.Free(localpath_mem);
         }
 
+        public void RequestMemoryUsage()
+        {
+            RemoteAccess_RequestMemoryUsage(m_Real);
+        }
+
+        // the first request starts tracking on the target, and gets an empty reply
+        public void RequestCaptureOverhead()
+        {
+            RemoteAccess_RequestCaptureOverhead(m_Real);
+        }
+
+        // 0 stops the statistics
+        public void SetFrameStatsInterval(UInt32 milliseconds)
+        {
+            RemoteAccess_SetFrameStatsInterval(m_Real, milliseconds);
+        }
+
         public void ReceiveMessage()
         {
             if (m_Real != IntPtr.Zero)
@@ -1019,6 +1181,16 @@ public void ReceiveMessage()
                     CaptureFile.ID = msg.NewCapture.ID;
                     CaptureFile.localpath = msg.NewCapture.localpath;
                     CaptureCopied = true;
+                    CopyProgress = 1.0f;
+                }
+                else if (msg.Type == RemoteMessageType.CaptureCopyProgress)
+                {
+                    CopyProgress = msg.CopyProgress.progress;
+                }
+                else if (msg.Type == RemoteMessageType.FrameStats)
+                {
+                    FrameStats = msg.FrameStats;
+                    FrameStatsUpdated = true;
                 }
                 else if (msg.Type == RemoteMessageType.RegisterAPI)
                 {
@@ -1030,6 +1202,16 @@ public void ReceiveMessage()
                     NewChild = msg.NewChild;
                     ChildAdded = true;
                 }
+                else if (msg.Type == RemoteMessageType.MemoryUsage)
+                {
+                    MemoryUsage = msg.MemoryUsage;
+                    MemoryUsageUpdated = true;
+                }
+                else if (msg.Type == RemoteMessageType.CaptureOverhead)
+                {
+                    CaptureOverhead = msg.CaptureOverhead;
+                    CaptureOverheadUpdated = true;
+                }
             }
         }
 
@@ -1042,9 +1224,21 @@ public void ReceiveMessage()
         public bool ChildAdded;
         public bool CaptureCopied;
         public bool InfoUpdated;
+        public bool MemoryUsageUpdated;
+        public bool FrameStatsUpdated;
+        public bool CaptureOverheadUpdated;
+
+        // progress of the capture copy currently in flight, 0 to 1
+        public float CopyProgress;
 
         public RemoteMessage.NewCaptureData CaptureFile = new RemoteMessage.NewCaptureData();
 
         public RemoteMessage.NewChildData NewChild = new RemoteMessage.NewChildData();
+
+        public RemoteMessage.MemoryUsageData MemoryUsage = new RemoteMessage.MemoryUsageData();
+
+        public RemoteMessage.FrameStatsData FrameStats = new RemoteMessage.FrameStatsData();
+
+        public RemoteMessage.CaptureOverheadData CaptureOverhead = new RemoteMessage.CaptureOverheadData();
     };
 };
@@ -179,6 +179,19 @@ public struct IndexableTempArray
         public IndexableTempArray[] indexableTemps;
 
         public UInt32 nextInstruction;
+
+        public bool keyframe;
+
+        [StructLayout(LayoutKind.Sequential)]
+        public class RegisterChange
+        {
+            public UInt32 set;
+            public UInt32 index;
+            [CustomMarshalAs(CustomUnmanagedType.CustomClass)]
+            public ShaderVariable value;
+        };
+        [CustomMarshalAs(CustomUnmanagedType.TemplatedArray)]
+        public RegisterChange[] changes;
     };
     
     [StructLayout(LayoutKind.Sequential)]
@@ -198,6 +211,40 @@ public struct CBuffer
 
         [CustomMarshalAs(CustomUnmanagedType.TemplatedArray)]
         public ShaderDebugState[] states;
+
+        // only keyframes in states have full register contents, this rebuilds them for any
+        // step by applying the changes since the closest keyframe before it.
+        public ShaderDebugState GetState(int step)
+        {
+            int key = step;
+            while (key > 0 && !states[key].keyframe)
+                key--;
+
+            ShaderDebugState ret = new ShaderDebugState();
+            ret.nextInstruction = states[step].nextInstruction;
+            ret.keyframe = true;
+            ret.changes = new ShaderDebugState.RegisterChange[0];
+            ret.registers = (ShaderVariable[])states[key].registers.Clone();
+            ret.outputs = (ShaderVariable[])states[key].outputs.Clone();
+            ret.indexableTemps = new ShaderDebugState.IndexableTempArray[states[key].indexableTemps.Length];
+            for (int i = 0; i < ret.indexableTemps.Length; i++)
+                ret.indexableTemps[i].temps = (ShaderVariable[])states[key].indexableTemps[i].temps.Clone();
+
+            for (int s = key + 1; s <= step; s++)
+            {
+                foreach (var c in states[s].changes)
+                {
+                    if (c.set == 0)
+                        ret.registers[c.index] = c.value;
+                    else if (c.set == 1)
+                        ret.outputs[c.index] = c.value;
+                    else
+                        ret.indexableTemps[c.set - 2].temps[c.index] = c.value;
+                }
+            }
+
+            return ret;
+        }
     };
     
     [StructLayout(LayoutKind.Sequential)]
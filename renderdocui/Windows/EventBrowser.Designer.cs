@@ -141,6 +141,11 @@ private void InitializeComponent()
             this.eventView.ViewOptions.UserRearrangeableColumns = true;
             this.eventView.AfterSelect += new System.Windows.Forms.TreeViewEventHandler(this.eventView_AfterSelect);
             this.eventView.KeyDown += new System.Windows.Forms.KeyEventHandler(this.eventView_KeyDown);
+            this.eventView.KeyUp += new System.Windows.Forms.KeyEventHandler(this.eventView_KeyUp);
+            this.eventView.PreviewKeyDown += new System.Windows.Forms.PreviewKeyDownEventHandler(this.eventView_PreviewKeyDown);
+            this.eventView.MouseDown += new System.Windows.Forms.MouseEventHandler(this.eventView_MouseDown);
+            this.eventView.MouseMove += new System.Windows.Forms.MouseEventHandler(this.eventView_MouseMove);
+            this.eventView.MouseUp += new System.Windows.Forms.MouseEventHandler(this.eventView_MouseUp);
             // 
             // toolStrip1
             // 
@@ -643,6 +643,77 @@ private void HideJumpAndFind()
             }
         }
 
+        // holding down a navigation key or dragging across the events scrubs through them, only
+        // previewing the texture at each one until the key or button is let go.
+        private Keys m_ScrubKey = Keys.None;
+        private bool m_DragSelecting = false;
+        private bool m_Scrubbing = false;
+
+        private void StartScrubbing()
+        {
+            if (m_Scrubbing) return;
+
+            m_Scrubbing = true;
+            m_Core.SetScrubbing(this, true);
+        }
+
+        private void StopScrubbing()
+        {
+            if (!m_Scrubbing) return;
+
+            m_Scrubbing = false;
+            m_Core.SetScrubbing(this, false);
+        }
+
+        private void eventView_PreviewKeyDown(object sender, PreviewKeyDownEventArgs e)
+        {
+            if (!m_Core.LogLoaded) return;
+
+            if (e.KeyCode == Keys.Up || e.KeyCode == Keys.Down ||
+                e.KeyCode == Keys.PageUp || e.KeyCode == Keys.PageDown)
+            {
+                // a second key down without a key up in between is the key repeating
+                if (m_ScrubKey == e.KeyCode)
+                    StartScrubbing();
+
+                m_ScrubKey = e.KeyCode;
+            }
+        }
+
+        private void eventView_KeyUp(object sender, KeyEventArgs e)
+        {
+            m_ScrubKey = Keys.None;
+            StopScrubbing();
+        }
+
+        private void eventView_MouseDown(object sender, MouseEventArgs e)
+        {
+            if (m_Core.LogLoaded && e.Button == MouseButtons.Left && eventView.CalcHitNode(e.Location) != null)
+                m_DragSelecting = true;
+        }
+
+        private void eventView_MouseMove(object sender, MouseEventArgs e)
+        {
+            if (!m_DragSelecting) return;
+
+            TreelistView.Node node = eventView.CalcHitNode(e.Location);
+
+            if (node == null || node.Tag == null || node == eventView.FocusedNode)
+                return;
+
+            StartScrubbing();
+
+            eventView.NodesSelection.Clear();
+            eventView.NodesSelection.Add(node);
+            eventView.FocusedNode = node;
+        }
+
+        private void eventView_MouseUp(object sender, MouseEventArgs e)
+        {
+            m_DragSelecting = false;
+            StopScrubbing();
+        }
+
         private void eventView_KeyDown(object sender, KeyEventArgs e)
         {
             if (!m_Core.LogLoaded) return;
@@ -829,7 +829,7 @@ private void hoverTimer_Tick(object sender, EventArgs e)
                 hoverPoint = new Point(m_HoverScintilla.ClientRectangle.Left + pt.X + 10, m_HoverScintilla.ClientRectangle.Top + pt.Y + 10);
                 hoverWin = m_HoverScintilla;
 
-                var state = m_Trace.states[CurrentStep];
+                var state = m_Trace.GetState(CurrentStep);
 
                 string regtype = m_HoverReg.Substring(0, 1);
                 string regidx = m_HoverReg.Substring(1);
@@ -960,7 +960,7 @@ public void UpdateDebugging()
                 return;
             }
 
-            var state = m_Trace.states[CurrentStep];
+            var state = m_Trace.GetState(CurrentStep);
 
             //curInstruction.Text = CurrentStep.ToString();
 
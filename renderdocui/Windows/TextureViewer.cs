@@ -40,7 +40,7 @@
 
 namespace renderdocui.Windows
 {
-    public partial class TextureViewer : DockContent, ILogViewerForm
+    public partial class TextureViewer : DockContent, ILogViewerForm, IScrubPreviewForm
     {
         #region Privates
 
@@ -472,7 +472,7 @@ public void ViewTexture(ResourceId ID, bool focus)
                         Show();
 
                     lockedTabs[ID].Show();
-                    m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+                    m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
                     return;
                 }
 
@@ -506,7 +506,7 @@ public void ViewTexture(ResourceId ID, bool focus)
 
                     lockedTabs.Add(ID, newPanel);
 
-                    m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+                    m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
                     return;
                 }
             }
@@ -782,7 +782,7 @@ public void OnLogfileLoaded()
             m_TexDisplay.darkBackgroundColour = darkBack;
             m_TexDisplay.lightBackgroundColour = lightBack;
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
         }
 
         void CustomShaderModified(object sender, FileSystemEventArgs e)
@@ -1173,12 +1173,21 @@ public void OnEventSelected(UInt32 frameID, UInt32 eventID)
 
             texPanel.RefreshLayout();
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
 
             if(autoFit.Checked)
                 AutoFitRange();
         }
 
+        public void OnScrubPreview(UInt32 frameID, UInt32 eventID)
+        {
+            if (IsDisposed) return;
+
+            // the bindings shown don't change until scrubbing stops, just redraw the current
+            // texture as it is after this event
+            render.Invalidate();
+        }
+
         #endregion
 
         #region Update UI state
@@ -1878,7 +1887,7 @@ private void UI_UpdateChannels()
 
             channelStrip.ResumeLayout();
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
             m_Core.Renderer.BeginInvoke(RT_UpdateVisualRange);
         }
 
@@ -1949,7 +1958,20 @@ private void render_Paint(object sender, PaintEventArgs e)
             foreach (var prev in texPanel.Thumbnails)
                 if (prev.Unbound) prev.Clear();
 
-            m_Core.Renderer.Invoke((ReplayRenderer r) => { if (m_Output != null) m_Output.Display(); });
+            bool pending = false;
+
+            m_Core.Renderer.Invoke((ReplayRenderer r) =>
+            {
+                if (m_Output != null)
+                {
+                    m_Output.Display();
+                    pending = m_Output.HasPendingThumbnails();
+                }
+            });
+
+            // not all thumbnails fit in the time budget for one display, come back for the rest
+            if (pending)
+                BeginInvoke(new Action(() => { render.Invalidate(); }));
         }
 
         #endregion
@@ -2082,7 +2104,7 @@ Point ScrollPosition
                         renderVScroll.Value = (int)Math.Min(renderVScroll.Maximum, (int)-m_TexDisplay.offy);
                 }
 
-                m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+                m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
             }
         }
 
@@ -2111,7 +2133,7 @@ private void UI_SetScale(float s, int x, int y)
             //render.Width = Math.Min(500, (int)(tex.width * m_TexDisplay.scale));
             //render.Height = Math.Min(500, (int)(tex.height * m_TexDisplay.scale));
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
 
             float scaleDelta = (m_TexDisplay.scale / prevScale);
 
@@ -2172,6 +2194,7 @@ private void render_Layout(object sender, LayoutEventArgs e)
 
         private Point m_CurHoverPixel = Point.Empty;
         private Point m_PickedPoint = Point.Empty;
+        private int m_PixelHistoryCount = 0;
 
         private PixelValue m_CurRealValue = null;
         private PixelValue m_CurPixelValue = null;
@@ -2516,7 +2539,7 @@ private void backcolorPick_Click(object sender, EventArgs e)
                 checkerBack.Checked = false;
             }
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
 
             if (m_Output == null)
             {
@@ -2535,7 +2558,7 @@ private void checkerBack_Click(object sender, EventArgs e)
             backcolorPick.Checked = false;
             checkerBack.Checked = true;
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
 
             if (m_Output == null)
             {
@@ -2571,7 +2594,7 @@ private void mipLevel_SelectedIndexChanged(object sender, EventArgs e)
                 });
             }
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
         }
 
         private void overlay_SelectedIndexChanged(object sender, EventArgs e)
@@ -2581,7 +2604,7 @@ private void overlay_SelectedIndexChanged(object sender, EventArgs e)
             if (overlay.SelectedIndex > 0)
                 m_TexDisplay.overlay = (TextureDisplayOverlay)overlay.SelectedIndex;
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
         }
 
         private void sliceFace_SelectedIndexChanged(object sender, EventArgs e)
@@ -2599,7 +2622,7 @@ private void sliceFace_SelectedIndexChanged(object sender, EventArgs e)
                 });
             }
 
-            m_Core.Renderer.BeginInvoke(RT_UpdateAndDisplay);
+            m_Core.Renderer.BeginInvoke("texdisplay", RT_UpdateAndDisplay);
         }
 
         private void updateChannelsHandler(object sender, EventArgs e)
@@ -2906,23 +2929,26 @@ private void pixelHistory_Click(object sender, EventArgs e)
 
             hist.Show(DockPanel);
 
-            // add a short delay so that controls repainting after a new panel appears can get at the
-            // render thread before we insert the long blocking pixel history task
-            var delayedHistory = new BackgroundWorker();
-            delayedHistory.DoWork += delegate
+            ResourceId id = CurrentTexture.ID;
+            Point picked = m_PickedPoint;
+            UInt32 sampleIdx = m_TexDisplay.sampleIdx;
+
+            // each window has its own tag, so opening another doesn't cancel this one and leave
+            // it empty. Closing the window before its history is fetched cancels the request.
+            string tag = String.Format("pixelhistory{0}", m_PixelHistoryCount++);
+            hist.FormClosed += (object s, FormClosedEventArgs ev) => { m_Core.Renderer.CancelInvoke(tag); };
+
+            // run in the background so that controls repainting after the new panel appears can
+            // get at the render thread before the long blocking pixel history task
+            m_Core.Renderer.BeginInvoke(tag, InvokePriority.Background, (ReplayRenderer r) =>
             {
-                Thread.Sleep(100);
-                m_Core.Renderer.BeginInvoke((ReplayRenderer r) =>
-                {
-                    history = r.PixelHistory(CurrentTexture.ID, (UInt32)m_PickedPoint.X, (UInt32)m_PickedPoint.Y, m_TexDisplay.sampleIdx);
+                history = r.PixelHistory(id, (UInt32)picked.X, (UInt32)picked.Y, sampleIdx);
 
-                    this.BeginInvoke(new Action(() =>
-                    {
-                        hist.SetHistory(history);
-                    }));
-                });
-            };
-            delayedHistory.RunWorkerAsync();
+                this.BeginInvoke(new Action(() =>
+                {
+                    hist.SetHistory(history);
+                }));
+            }, null);
         }
 
         private void debugPixel_Click(object sender, EventArgs e)